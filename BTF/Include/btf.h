@@ -183,7 +183,10 @@ int64_t btf_l_strongcomp (int64_t, int64_t *,
  * columns of P*A*Q to denote which columns are not matched.  If the matrix is
  * structurally rank deficient, some of the entries on the diagonal of the
  * permuted matrix will be zero.  BTF_ORDER then calls btf_strongcomp to find
- * the strongly-connected components.
+ * the strongly-connected components.  For large matrices (n >= 100,000), if
+ * BTF is compiled with OpenMP and at least 4 threads are available, the
+ * strongly-connected components are found in parallel instead.  The blocks are
+ * the same, but they may appear in a different (equally valid) order.
  *
  * On output, P and Q are the row and column permutations, where i = P[k] if
  * row i of A is the kth row of P*A*Q, and j = BTF_UNFLIP(Q[k]) if column j of
@@ -62,4 +62,26 @@
 #define EMPTY (-1)
 #define MIN(a,b) (((a) < (b)) ?  (a) : (b))
 
+/* ========================================================================== */
+/* parallel strongly connected components, used by btf_order */
+/* ========================================================================== */
+
+/* btf_order uses btf_pstrongcomp only if n >= BTF_PARALLEL_NMIN and at least
+ * BTF_PARALLEL_NTHREADS OpenMP threads are available.  The parallel method does
+ * two to three times the memory traffic of Tarjan's method, so it only pays off
+ * with several threads.  Otherwise, btf_strongcomp is used. */
+#ifndef BTF_PARALLEL_NMIN
+#define BTF_PARALLEL_NMIN 100000
+#endif
+#ifndef BTF_PARALLEL_NTHREADS
+#define BTF_PARALLEL_NTHREADS 4
+#endif
+
+/* returns EMPTY (with P, Q, and R unmodified) if out of memory */
+Int BTF(pstrongcomp)
+(
+    Int n, Int Ap [ ], Int Ai [ ], Int Q [ ], Int P [ ], Int R [ ],
+    Int Work [ ], int nthreads
+) ;
+
 #endif
@@ -35,7 +35,7 @@ if (details)
 end
 eval (s) ;
 
-s = [mexcmd 'btf.c ../Source/btf_l_maxtrans.c ../Source/btf_l_strongcomp.c ../Source/btf_l_order.c'] ;
+s = [mexcmd 'btf.c ../Source/btf_l_maxtrans.c ../Source/btf_l_strongcomp.c ../Source/btf_l_pstrongcomp.c ../Source/btf_l_order.c ../../SuiteSparse_config/SuiteSparse_config.c'] ;
 if (details)
     fprintf ('%s\n', s) ;
 end
@@ -26,6 +26,15 @@
  * might not be zero-free, and the number of nonzeros on the diagonal of A(P,Q)
  * might not be equal to the structural rank.
  *
+ * If n >= BTF_PARALLEL_NMIN and at least BTF_PARALLEL_NTHREADS OpenMP threads
+ * are available, the strongly connected components are found in parallel (see
+ * btf_pstrongcomp.c).  The blocks found are the same, although they may appear
+ * in a different order.  The sequential btf_strongcomp is used for smaller
+ * matrices, or if the parallel method runs out of memory.  The maximum
+ * transversal is always found with the sequential btf_maxtrans; its cheap
+ * assignment phase makes nearly all the matches in linear time for matrices
+ * with a mostly zero-free diagonal.
+ *
  * See btf.h for more details.
  */
 
@@ -57,6 +66,9 @@ Int BTF(order)      /* returns number of blocks found */
 {
     Int *Flag ;
     Int nblocks, i, j, nbadcol ;
+    int nthreads ;
+
+    nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
 
     /* ---------------------------------------------------------------------- */
     /* compute the maximum matching */
@@ -130,6 +142,14 @@ Int BTF(order)      /* returns number of blocks found */
     /* find the strongly connected components */
     /* ---------------------------------------------------------------------- */
 
-    nblocks = BTF(strongcomp) (n, Ap, Ai, Q, P, R, Work) ;
+    nblocks = EMPTY ;
+    if (n >= BTF_PARALLEL_NMIN && nthreads >= BTF_PARALLEL_NTHREADS)
+    {
+        nblocks = BTF(pstrongcomp) (n, Ap, Ai, Q, P, R, Work, nthreads) ;
+    }
+    if (nblocks == EMPTY)
+    {
+        nblocks = BTF(strongcomp) (n, Ap, Ai, Q, P, R, Work) ;
+    }
     return (nblocks) ;
 }
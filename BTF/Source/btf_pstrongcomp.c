@@ -0,0 +1,598 @@
+//------------------------------------------------------------------------------
+// BTF/Source/btf_pstrongcomp: parallel strongly connected components
+//------------------------------------------------------------------------------
+
+// BTF, Copyright (c) 2004-2024, University of Florida.  All Rights Reserved.
+// Author: Timothy A. Davis.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* Finds the strongly connected components of the graph of A*Q, in parallel.
+ * The inputs and outputs are the same as btf_strongcomp: on output, P, Q, and
+ * R define an upper block triangular form of P*A*Q, and the nodes within each
+ * block are in their natural order.  The blocks themselves may appear in a
+ * different (but equally valid) order than the one found by btf_strongcomp.
+ * The result does not depend on the number of threads.
+ *
+ * Node j of the graph is column j of A*Q, and has an edge to node i for each
+ * entry A(i,jj), where jj = BTF_UNFLIP (Q [j]).  Self-edges are ignored.
+ *
+ * The method is the forward-backward algorithm of Fleischer, Hendrickson, and
+ * Pinar ("On identifying strongly connected components in parallel", IPDPS
+ * Workshops, 2000).  The nodes are held in a single array, Order, partitioned
+ * into contiguous segments.  Initially there is one segment with all n nodes.
+ * For a segment with a pivot node v, let F be the set of nodes reachable from
+ * v and B the set of nodes that reach v, both within the segment.  Then S = F
+ * intersect B is the strongly connected component containing v, and the
+ * remaining nodes fall into F\S, B\S, and R (the rest).  No edges go from F\S
+ * to S, R, or B\S; none from S to R or B\S; and none from R to B\S.  So the
+ * segment can be replaced, in place, with four segments in the order F\S, S,
+ * R, B\S, and each of them is then processed independently.  The reachable
+ * sets are found with a level-synchronous breadth-first search, with each
+ * level done in parallel.
+ *
+ * Segments smaller than BTF_PARALLEL_CHUNK, or for which a few pivots fail to
+ * split off a large enough part, are finished with Tarjan's method
+ * (restricted to the nodes of the segment), with the segments themselves done
+ * in parallel.  Each segment keeps its nodes in ascending order, so the result
+ * is deterministic.
+ *
+ * Returns the number of blocks, or EMPTY if out of memory (in which case P, Q,
+ * and R are not modified).  Work is the same size-5n workspace used by
+ * btf_strongcomp.
+ */
+
+#include "btf.h"
+#include "btf_internal.h"
+
+/* segments smaller than this are done with Tarjan's method */
+#define BTF_PARALLEL_CHUNK 4096
+
+/* a breadth-first search level is done in parallel only if it is this large */
+#define BTF_PARALLEL_FRONT 1024
+
+/* number of pivots to try before giving up on splitting a segment */
+#define BTF_PARALLEL_NPIVOTS 4
+
+#define UNVISITED (-2)
+#define UNASSIGNED (-1)
+
+/* ========================================================================== */
+/* === reach ================================================================ */
+/* ========================================================================== */
+
+/* Find all nodes reachable from the root, within the segment s.  If Q is
+ * non-NULL, the out-edges of node j are Gi [Gp [jj] ... Gp [jj+1]-1] where
+ * jj = BTF_UNFLIP (Q [j]); otherwise, jj = j.  Each node reached is marked
+ * with Mark [i] = stamp.  Returns the number of nodes reached. */
+
+static Int reach
+(
+    Int root,
+    Int s,
+    Int Gp [ ],
+    Int Gi [ ],
+    Int Q [ ],
+    Int Sub [ ],        /* Sub [i] = s if node i is in the segment s */
+    Int Mark [ ],
+    Int stamp,
+    Int Front [ ],      /* size n, workspace */
+    Int Next [ ],       /* size n, workspace */
+    int nthreads
+)
+{
+    Int *W ;
+    Int f, nfront, nnext, count ;
+
+    Mark [root] = stamp ;
+    Front [0] = root ;
+    nfront = 1 ;
+    count = 1 ;
+
+    while (nfront > 0)
+    {
+        nnext = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,256) \
+            if (nfront >= BTF_PARALLEL_FRONT)
+        for (f = 0 ; f < nfront ; f++)
+        {
+            Int i, j, jj, p, mark, k ;
+            j = Front [f] ;
+            jj = (Q == (Int *) NULL) ? (j) : (BTF_UNFLIP (Q [j])) ;
+            for (p = Gp [jj] ; p < Gp [jj+1] ; p++)
+            {
+                i = Gi [p] ;
+                if (Sub [i] != s) continue ;
+                #pragma omp atomic read
+                mark = Mark [i] ;
+                if (mark == stamp) continue ;
+                /* claim node i; only the first thread to get here wins */
+                #pragma omp atomic capture
+                { mark = Mark [i] ; Mark [i] = stamp ; }
+                if (mark != stamp)
+                {
+                    #pragma omp atomic capture
+                    k = nnext++ ;
+                    Next [k] = i ;
+                }
+            }
+        }
+        count += nnext ;
+        W = Front ; Front = Next ; Next = W ;
+        nfront = nnext ;
+    }
+    return (count) ;
+}
+
+
+/* ========================================================================== */
+/* === split ================================================================ */
+/* ========================================================================== */
+
+/* Partition the segment Order [s ... e-1] into F\S, S, R, and B\S, in that
+ * order, preserving the relative order of the nodes within each part.  The
+ * nodes of S are assigned to a block starting at position Key [i] in the final
+ * ordering; the others are given new segments.  Tmp is size n, and Count is
+ * size 4*nthreads. */
+
+static void split
+(
+    Int s,
+    Int e,
+    Int Order [ ],
+    Int Sub [ ],
+    Int Seg [ ],
+    Int Key [ ],
+    Int Fw [ ],
+    Int Bw [ ],
+    Int stamp,
+    Int Tmp [ ],
+    Int Count [ ],
+    int nthreads
+)
+{
+    Int Start [4] ;
+    Int m, t, c, pos ;
+
+    m = e - s ;
+
+    /* count the nodes of each class in each chunk of the segment */
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int k, i, c2, k1, k2 ;
+        k1 = s + (Int) (((double) m * t) / nthreads) ;
+        k2 = s + (Int) (((double) m * (t+1)) / nthreads) ;
+        for (c2 = 0 ; c2 < 4 ; c2++)
+        {
+            Count [4*t + c2] = 0 ;
+        }
+        for (k = k1 ; k < k2 ; k++)
+        {
+            i = Order [k] ;
+            /* class: 0 = F\S, 1 = S, 2 = R, 3 = B\S */
+            c2 = (Fw [i] == stamp) ? ((Bw [i] == stamp) ? 1 : 0)
+                                   : ((Bw [i] == stamp) ? 3 : 2) ;
+            Count [4*t + c2]++ ;
+        }
+    }
+
+    /* replace the counts with the starting position of each class/chunk */
+    pos = s ;
+    for (c = 0 ; c < 4 ; c++)
+    {
+        Start [c] = pos ;
+        for (t = 0 ; t < nthreads ; t++)
+        {
+            Int cnt = Count [4*t + c] ;
+            Count [4*t + c] = pos ;
+            pos += cnt ;
+        }
+    }
+    ASSERT (pos == e) ;
+
+    /* scatter the nodes into Tmp and update their segments */
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int k, i, c2, k1, k2 ;
+        k1 = s + (Int) (((double) m * t) / nthreads) ;
+        k2 = s + (Int) (((double) m * (t+1)) / nthreads) ;
+        for (k = k1 ; k < k2 ; k++)
+        {
+            i = Order [k] ;
+            c2 = (Fw [i] == stamp) ? ((Bw [i] == stamp) ? 1 : 0)
+                                   : ((Bw [i] == stamp) ? 3 : 2) ;
+            Tmp [Count [4*t + c2]++] = i ;
+            if (c2 == 1)
+            {
+                /* node i is in the strongly connected component S */
+                Sub [i] = EMPTY ;
+                Key [i] = Start [1] ;
+            }
+            else
+            {
+                Sub [i] = Start [c2] ;
+            }
+        }
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (pos = s ; pos < e ; pos++)
+    {
+        Order [pos] = Tmp [pos] ;
+    }
+
+    /* define the new segments */
+    for (c = 0 ; c < 4 ; c++)
+    {
+        Int c_end = (c < 3) ? Start [c+1] : e ;
+        if (c_end > Start [c])
+        {
+            Seg [Start [c]] = c_end ;
+        }
+    }
+}
+
+
+/* ========================================================================== */
+/* === tarjan =============================================================== */
+/* ========================================================================== */
+
+/* Find the strongly connected components of the segment Order [s ... e-1],
+ * using the same non-recursive version of Tarjan's algorithm as the dfs in
+ * btf_strongcomp.c, except that edges leaving the segment are ignored.  The
+ * blocks are found in topological order, and the kth one is assigned the
+ * position in the final ordering that follows the blocks found before it.
+ * Time, Low, and Flag are indexed by node; the three stacks are indexed by
+ * position in the segment. */
+
+static void tarjan
+(
+    Int s,
+    Int e,
+    Int Ap [ ],
+    Int Ai [ ],
+    Int Q [ ],
+    Int Order [ ],
+    Int Sub [ ],
+    Int Key [ ],
+    Int Time [ ],
+    Int Low [ ],
+    Int Flag [ ],
+    Int Cstack [ ],
+    Int Jstack [ ],
+    Int Pstack [ ]
+)
+{
+    Int chead, jhead, i, j, jj, k, p, pend, parent, timestamp, pos, nk ;
+
+    timestamp = 0 ;
+    pos = s ;
+    Cstack += s ;
+    Jstack += s ;
+    Pstack += s ;
+
+    for (k = s ; k < e ; k++)
+    {
+        j = Order [k] ;
+        if (Flag [j] != UNVISITED) continue ;
+
+        chead = -1 ;
+        jhead = 0 ;
+        Jstack [0] = j ;
+
+        while (jhead >= 0)
+        {
+            j = Jstack [jhead] ;
+            jj = (Q == (Int *) NULL) ? (j) : (BTF_UNFLIP (Q [j])) ;
+            pend = Ap [jj+1] ;
+
+            if (Flag [j] == UNVISITED)
+            {
+                /* prework at node j */
+                Cstack [++chead] = j ;
+                timestamp++ ;
+                Time [j] = timestamp ;
+                Low [j] = timestamp ;
+                Flag [j] = UNASSIGNED ;
+                Pstack [jhead] = Ap [jj] ;
+            }
+
+            for (p = Pstack [jhead] ; p < pend ; p++)
+            {
+                i = Ai [p] ;
+                if (Sub [i] != s) continue ;    /* edge leaves the segment */
+                if (Flag [i] == UNVISITED)
+                {
+                    Pstack [jhead] = p + 1 ;
+                    Jstack [++jhead] = i ;
+                    break ;
+                }
+                else if (Flag [i] == UNASSIGNED)
+                {
+                    Low [j] = MIN (Low [j], Time [i]) ;
+                }
+            }
+
+            if (p == pend)
+            {
+                jhead-- ;
+
+                /* postwork at node j */
+                if (Low [j] == Time [j])
+                {
+                    /* pop the block from the Cstack, and place it at pos */
+                    nk = 0 ;
+                    while (TRUE)
+                    {
+                        i = Cstack [chead--] ;
+                        Flag [i] = 0 ;
+                        Key [i] = pos ;
+                        nk++ ;
+                        if (i == j) break ;
+                    }
+                    /* the next block starts after this one */
+                    pos += nk ;
+                }
+                if (jhead >= 0)
+                {
+                    parent = Jstack [jhead] ;
+                    Low [parent] = MIN (Low [parent], Low [j]) ;
+                }
+            }
+        }
+    }
+    ASSERT (pos == e) ;
+}
+
+
+/* ========================================================================== */
+/* === btf_pstrongcomp ====================================================== */
+/* ========================================================================== */
+
+Int BTF(pstrongcomp)
+(
+    /* input, not modified: */
+    Int n,          /* A is n-by-n in compressed column form */
+    Int Ap [ ],     /* size n+1 */
+    Int Ai [ ],     /* size nz = Ap [n] */
+
+    /* optional input, modified (if present) on output: */
+    Int Q [ ],      /* size n, input column permutation */
+
+    /* output, not defined on input */
+    Int P [ ],      /* size n.  P [k] = j if row and column j are kth row/col
+                     * in permuted matrix. */
+    Int R [ ],      /* size n+1.  block b is in rows/cols R[b] ... R[b+1]-1 */
+
+    /* workspace, not defined on input or output */
+    Int Work [ ],   /* size 5n */
+    int nthreads
+)
+{
+    Int *Tp, *Ti, *Order, *Sub, *Seg, *Fw, *Bw, *Key, *Count, *Mem,
+        *Time, *Low, *Flag, *Jstack, *Pstack, *Cstack, *Front, *Next, *Tmp,
+        *List ;
+    Int j, k, b, s, e, m, nz, nblocks, nlist, stamp, tries, nf, nb, root ;
+    size_t memsize ;
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate workspace */
+    /* ---------------------------------------------------------------------- */
+
+    nz = Ap [n] ;
+    memsize = 7 * ((size_t) n) + 1 + ((size_t) nz) + 4 * ((size_t) nthreads) ;
+    Mem = SuiteSparse_malloc (memsize, sizeof (Int)) ;
+    if (Mem == (Int *) NULL)
+    {
+        return (EMPTY) ;
+    }
+    Tp    = Mem ;
+    Ti    = Tp + n + 1 ;
+    Order = Ti + nz ;
+    Sub   = Order + n ;
+    Seg   = Sub + n ;
+    Fw    = Seg + n ;
+    Bw    = Fw + n ;
+    Key   = Bw + n ;
+    Count = Key + n ;
+
+    /* Work and R are used in two phases: first for the forward-backward
+     * splitting, and then for Tarjan's method */
+    Time   = Work ;
+    Low    = Work + n ;
+    Flag   = Work + 2*n ;
+    Jstack = Work + 3*n ;
+    Pstack = Work + 4*n ;
+    Cstack = R ;
+    Tmp    = Time ;
+    Front  = Jstack ;
+    Next   = Pstack ;
+
+    /* ---------------------------------------------------------------------- */
+    /* construct the transpose of the graph, for the backward search */
+    /* ---------------------------------------------------------------------- */
+
+    /* node j is in Ti [Tp [i] ... Tp [i+1]-1] if the graph has the edge (j,i) */
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (j = 0 ; j <= n ; j++)
+    {
+        Tp [j] = 0 ;
+    }
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (j = 0 ; j < n ; j++)
+    {
+        Int jj, p ;
+        jj = (Q == (Int *) NULL) ? (j) : (BTF_UNFLIP (Q [j])) ;
+        for (p = Ap [jj] ; p < Ap [jj+1] ; p++)
+        {
+            #pragma omp atomic
+            Tp [Ai [p] + 1]++ ;
+        }
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+        Tp [j+1] += Tp [j] ;
+    }
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (j = 0 ; j < n ; j++)
+    {
+        Fw [j] = Tp [j] ;
+    }
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (j = 0 ; j < n ; j++)
+    {
+        Int jj, p, q ;
+        jj = (Q == (Int *) NULL) ? (j) : (BTF_UNFLIP (Q [j])) ;
+        for (p = Ap [jj] ; p < Ap [jj+1] ; p++)
+        {
+            #pragma omp atomic capture
+            q = Fw [Ai [p]]++ ;
+            Ti [q] = j ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* start with a single segment containing all the nodes */
+    /* ---------------------------------------------------------------------- */
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (j = 0 ; j < n ; j++)
+    {
+        Order [j] = j ;
+        Sub [j] = 0 ;
+        Fw [j] = 0 ;
+        Bw [j] = 0 ;
+    }
+    Seg [0] = n ;
+    stamp = 0 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* split the large segments with forward-backward searches */
+    /* ---------------------------------------------------------------------- */
+
+    /* Seg [s] = e if Order [s ... e-1] is a segment, or BTF_FLIP (e) if the
+     * segment is to be left for Tarjan's method.  A segment whose nodes have
+     * Sub [i] == EMPTY is a block that has already been found. */
+
+    s = 0 ;
+    while (s < n)
+    {
+        e = Seg [s] ;
+        if (e < 0 || Sub [Order [s]] == EMPTY || e - s < BTF_PARALLEL_CHUNK)
+        {
+            /* skip this segment */
+            s = BTF_UNFLIP (e) ;
+            continue ;
+        }
+        m = e - s ;
+        for (tries = 0 ; tries < BTF_PARALLEL_NPIVOTS ; tries++)
+        {
+            /* try pivots spread evenly across the segment */
+            root = Order [s + (Int) (((double) m * (2*tries + 1)) /
+                (2*BTF_PARALLEL_NPIVOTS))] ;
+            stamp++ ;
+            nf = reach (root, s, Ap, Ai, Q, Sub, Fw, stamp, Front, Next,
+                nthreads) ;
+            nb = reach (root, s, Tp, Ti, NULL, Sub, Bw, stamp, Front, Next,
+                nthreads) ;
+            if (nf + nb > m / 16) break ;
+        }
+        if (tries == BTF_PARALLEL_NPIVOTS)
+        {
+            /* The pivots only reach small parts of the segment; splitting
+             * it would cost more than it saves. */
+            Seg [s] = BTF_FLIP (e) ;
+            s = e ;
+            continue ;
+        }
+        /* replace the segment with F\S, S, R, and B\S, and then continue
+         * with its first part */
+        split (s, e, Order, Sub, Seg, Key, Fw, Bw, stamp, Tmp, Count,
+            nthreads) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* finish the remaining segments with Tarjan's method, in parallel */
+    /* ---------------------------------------------------------------------- */
+
+    List = Fw ;
+    nlist = 0 ;
+    for (s = 0 ; s < n ; s = e)
+    {
+        e = BTF_UNFLIP (Seg [s]) ;
+        Seg [s] = e ;
+        if (Sub [Order [s]] != EMPTY)
+        {
+            List [nlist++] = s ;
+        }
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (j = 0 ; j < n ; j++)
+    {
+        Flag [j] = UNVISITED ;
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (k = 0 ; k < nlist ; k++)
+    {
+        Int s2 = List [k] ;
+        tarjan (s2, Seg [s2], Ap, Ai, Q, Order, Sub, Key, Time, Low, Flag,
+            Cstack, Jstack, Pstack) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* construct the block boundary array, R, and the permutation P */
+    /* ---------------------------------------------------------------------- */
+
+    /* Key [j] is the position of the first node of the block containing node
+     * j.  Renumber the blocks 0 to nblocks-1 in increasing order of Key, using
+     * Bw as workspace. */
+    for (k = 0 ; k < n ; k++)
+    {
+        Bw [k] = EMPTY ;
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+        Bw [Key [j]] = 0 ;
+    }
+    nblocks = 0 ;
+    for (k = 0 ; k < n ; k++)
+    {
+        if (Bw [k] == 0)
+        {
+            R [nblocks] = k ;
+            Bw [k] = nblocks++ ;
+        }
+    }
+    R [nblocks] = n ;
+
+    /* place the nodes of each block in their natural order */
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        Time [b] = R [b] ;
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+        P [Time [Bw [Key [j]]]++] = j ;
+    }
+
+    /* if Q is present on input, set Q = Q*P' */
+    if (Q != (Int *) NULL)
+    {
+        for (k = 0 ; k < n ; k++)
+        {
+            Time [k] = Q [P [k]] ;
+        }
+        for (k = 0 ; k < n ; k++)
+        {
+            Q [k] = Time [k] ;
+        }
+    }
+
+    SuiteSparse_free (Mem) ;
+    return (nblocks) ;
+}
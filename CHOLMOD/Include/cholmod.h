@@ -876,7 +876,7 @@ typedef struct cholmod_common_struct
     double SPQR_grain ;     // task size is >= max (total flops / grain)
     double SPQR_small ;     // task size is >= small
     int SPQR_shrink ;       // controls stack realloc method
-    int SPQR_nthreads ;     // number of TBB threads, 0 = auto
+    int SPQR_nthreads ;     // number of OpenMP threads, 0 = auto
 
     // statistics:
     double SPQR_flopcount ;         // flop count for SPQR
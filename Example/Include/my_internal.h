@@ -69,8 +69,8 @@
 #endif
 
 #include "klu.h"
-#if !defined (KLU__VERSION) || KLU__VERSION < SUITESPARSE__VERCODE(2,3,5)
-#error "This library requires KLU 2.3.5 or later"
+#if !defined (KLU__VERSION) || KLU__VERSION < SUITESPARSE__VERCODE(3,0,0)
+#error "This library requires KLU 3.0.0 or later"
 #endif
 
 #include "ldl.h"
@@ -89,13 +89,13 @@
 #endif
 
 #include "SuiteSparseQR_C.h"
-#if !defined (SPQR__VERSION) || SPQR__VERSION < SUITESPARSE__VERCODE(4,3,4)
-#error "This library requires SPQR 4.3.4 or later"
+#if !defined (SPQR__VERSION) || SPQR__VERSION < SUITESPARSE__VERCODE(4,4,0)
+#error "This library requires SPQR 4.4.0 or later"
 #endif
 
 #include "umfpack.h"
-#if !defined (UMFPACK__VERSION) || UMFPACK__VERSION < SUITESPARSE__VERCODE(6,3,5)
-#error "This library requires UMFPACK 6.3.5 or later"
+#if !defined (UMFPACK__VERSION) || UMFPACK__VERSION < SUITESPARSE__VERCODE(7,0,0)
+#error "This library requires UMFPACK 7.0.0 or later"
 #endif
 
 // SuiteSparse include files for C++:
@@ -110,6 +110,15 @@ typedef struct
     void *Offx ;        /* size nzoff, numerical values */
     int32_t nzoff ;
 
+    /* workspace for klu_spsolve, allocated by its first call (NULL until
+     * then).  It is left in a cleared state by each call to klu_spsolve. */
+    size_t spworksize ; /* size (in bytes) of SpWork */
+    void *SpWork ;      /* workspace */
+
+    /* reciprocal pivot growth of each block, size nblocks.  Computed by
+     * klu_refactor if Common->track_growth is TRUE (NULL until then). */
+    double *Bgrowth ;
+
 } klu_numeric ;
 
 typedef struct          /* 64-bit version (otherwise same as above) */
@@ -126,6 +135,9 @@ typedef struct          /* 64-bit version (otherwise same as above) */
     int64_t *Offp, *Offi ;
     void *Offx ;
     int64_t nzoff ;
+    size_t spworksize ;
+    void *SpWork ;
+    double *Bgrowth ;
 
 } klu_l_numeric ;
 
@@ -211,6 +223,49 @@ typedef struct klu_common_struct
     size_t memusage ;   /* current memory usage, in bytes */
     size_t mempeak ;    /* peak memory usage, in bytes */
 
+    /* ---------------------------------------------------------------------- */
+    /* parameters for solving with many right-hand-sides */
+    /* ---------------------------------------------------------------------- */
+
+    /* These and the parameters below were added in KLU 3.0.0.  They change
+     * the size of the struct, which the user allocates and klu_defaults
+     * fills in, so applications compiled with KLU 2.x must be recompiled. */
+
+    int nrhs_block ;        /* klu_solve and klu_tsolve solve B in chunks of
+        * 4 columns at a time, using Numeric->Xwork as workspace.  If
+        * nrhs_block > 4 and B has more than 4 columns, B is instead solved in
+        * chunks of nrhs_block columns at a time, using workspace of size
+        * n*nrhs_block for each thread allocated by klu_solve or klu_tsolve.
+        * Independent chunks are solved in parallel if KLU is compiled with
+        * OpenMP.  Default: 0 (use the 4-column kernels). */
+
+    int nthreads_max ;      /* max # of threads to use in klu_solve and
+        * klu_tsolve when nrhs_block > 4.  If <= 0, the max # of OpenMP threads
+        * is used.  Default: 0. */
+
+    /* ---------------------------------------------------------------------- */
+    /* pivot growth monitoring, for klu_refactor and klu_adaptive_factor */
+    /* ---------------------------------------------------------------------- */
+
+    int track_growth ;      /* if TRUE, klu_refactor computes Common->rgrowth
+        * (the same value as klu_rgrowth) and the reciprocal pivot growth of
+        * each block, Numeric->Bgrowth, as it goes.  Default: FALSE. */
+
+    double rgrowth_tol ;    /* klu_adaptive_factor re-pivots each block whose
+        * reciprocal pivot growth is less than rgrowth_tol.  Default: 1e-8. */
+
+    int nrepivot ;          /* # of blocks re-pivoted by the last call to
+        * klu_adaptive_factor, -1 if not computed */
+
+    /* ---------------------------------------------------------------------- */
+    /* memory reuse, for klu_factor_reuse */
+    /* ---------------------------------------------------------------------- */
+
+    double memslack ;       /* when the factorization of a block is done, its
+        * LU factors are left with memslack*nnz(L+U) of unused space, so that
+        * klu_factor_reuse can factorize a matrix with more fill-in without
+        * growing them.  Default: 0. */
+
 } klu_common ;
 
 typedef struct klu_l_common_struct /* 64-bit version (otherwise same as above)*/
@@ -225,6 +280,11 @@ typedef struct klu_l_common_struct /* 64-bit version (otherwise same as above)*/
     int64_t structural_rank, numerical_rank, singular_col, noffdiag ;
     double flops, rcond, condest, rgrowth, work ;
     size_t memusage, mempeak ;
+    int nrhs_block, nthreads_max ;
+    int track_growth ;
+    double rgrowth_tol ;
+    int nrepivot ;
+    double memslack ;
 
 } klu_l_common ;
 
@@ -391,6 +451,57 @@ int klu_zl_tsolve (klu_l_symbolic *, klu_l_numeric *,
     int64_t, int64_t, double *, int, klu_l_common * ) ;
 
 
+/* -------------------------------------------------------------------------- */
+/* klu_spsolve: solves Ax=b with sparse b and sparse x */
+/* -------------------------------------------------------------------------- */
+
+/* Solves Ax=b where b is a single sparse column, and returns the sparse
+ * solution x.  The work is proportional to the number of entries of L, U,
+ * and the off-diagonal blocks that are needed to compute x, not to n.  Blocks
+ * of the BTF form that x does not touch are skipped entirely.  x is returned
+ * in Xi [0..xnz-1] and Xx [0..xnz-1], in no particular order.  Its pattern is
+ * the structural pattern of x, so it may include explicit zeros due to
+ * numerical cancellation.  Uses workspace held in the Numeric object, so
+ * concurrent calls with the same Numeric object are not allowed (the same is
+ * true for klu_solve). */
+
+int klu_spsolve             /* return TRUE if successful, FALSE otherwise */
+(
+    /* inputs, not modified */
+    klu_symbolic *Symbolic,
+    klu_numeric *Numeric,
+    int32_t bnz,            /* # of entries in b */
+    int32_t Bi [ ],         /* size bnz, row indices of b */
+    double Bx [ ],          /* size bnz, numerical values of b */
+    /* outputs, allocated on input */
+    int32_t *xnz,           /* # of entries in x */
+    int32_t Xi [ ],         /* size n, row indices of x */
+    double Xx [ ],          /* size n, numerical values of x */
+    klu_common *Common
+) ;
+
+int klu_z_spsolve
+(
+    /* inputs, not modified */
+    klu_symbolic *Symbolic,
+    klu_numeric *Numeric,
+    int32_t bnz,            /* # of entries in b */
+    int32_t Bi [ ],         /* size bnz, row indices of b */
+    double Bx [ ],          /* size 2*bnz, numerical values of b */
+    /* outputs, allocated on input */
+    int32_t *xnz,           /* # of entries in x */
+    int32_t Xi [ ],         /* size n, row indices of x */
+    double Xx [ ],          /* size 2*n, numerical values of x */
+    klu_common *Common
+) ;
+
+int klu_l_spsolve (klu_l_symbolic *, klu_l_numeric *, int64_t, int64_t *,
+    double *, int64_t *, int64_t *, double *, klu_l_common *) ;
+
+int klu_zl_spsolve (klu_l_symbolic *, klu_l_numeric *, int64_t, int64_t *,
+    double *, int64_t *, int64_t *, double *, klu_l_common *) ;
+
+
 /* -------------------------------------------------------------------------- */
 /* klu_refactor: refactorizes matrix with same ordering as klu_factor */
 /* -------------------------------------------------------------------------- */
@@ -426,6 +537,89 @@ int klu_zl_refactor (int64_t *, int64_t *,
     double *, klu_l_symbolic *, klu_l_numeric *, klu_l_common *) ;
 
 
+/* -------------------------------------------------------------------------- */
+/* klu_factor_reuse: factorizes with pivoting, reusing a Numeric object */
+/* -------------------------------------------------------------------------- */
+
+/* Same as klu_factor, except that the factorization is done in place, in an
+ * existing Numeric object created by klu_factor with the same Symbolic object.
+ * The LU factors of each block are reused without allocating any memory, and
+ * are grown only if they are too small (see Common->memslack).  If an error
+ * occurs, or if the matrix is singular and Common->halt_if_singular is TRUE,
+ * the Numeric object is left only partially defined, but it can still be
+ * passed to klu_factor_reuse again, or to klu_free_numeric. */
+
+int klu_factor_reuse        /* return TRUE if successful, FALSE otherwise */
+(
+    /* inputs, not modified */
+    int32_t Ap [ ],         /* size n+1, column pointers */
+    int32_t Ai [ ],         /* size nz, row indices */
+    double Ax [ ],      /* size nz, numerical values */
+    klu_symbolic *Symbolic,
+    /* input, and numerical values and pivoting modified on output */
+    klu_numeric *Numeric,
+    klu_common *Common
+) ;
+
+int klu_z_factor_reuse      /* return TRUE if successful, FALSE otherwise */
+(
+     /* inputs, not modified */
+     int32_t Ap [ ],        /* size n+1, column pointers */
+     int32_t Ai [ ],        /* size nz, row indices */
+     double Ax [ ],     /* size 2*nz, numerical values */
+     klu_symbolic *Symbolic,
+     /* input, and numerical values and pivoting modified on output */
+     klu_numeric *Numeric,
+     klu_common *Common
+) ;
+
+int klu_l_factor_reuse (int64_t *, int64_t *,
+    double *, klu_l_symbolic *, klu_l_numeric *, klu_l_common *) ;
+
+int klu_zl_factor_reuse (int64_t *, int64_t *,
+    double *, klu_l_symbolic *, klu_l_numeric *, klu_l_common *) ;
+
+
+/* -------------------------------------------------------------------------- */
+/* klu_adaptive_factor: refactorizes, re-pivoting only unstable blocks */
+/* -------------------------------------------------------------------------- */
+
+/* Same as klu_refactor, except that each diagonal block of the BTF form whose
+ * reciprocal pivot growth drops below Common->rgrowth_tol (or that has a zero
+ * pivot) is factorized again with partial pivoting.  Numeric->Pnum and
+ * Numeric->Pinv may change; Symbolic is not modified. */
+
+int klu_adaptive_factor     /* return TRUE if successful, FALSE otherwise */
+(
+    /* inputs, not modified */
+    int32_t Ap [ ],         /* size n+1, column pointers */
+    int32_t Ai [ ],         /* size nz, row indices */
+    double Ax [ ],      /* size nz, numerical values */
+    klu_symbolic *Symbolic,
+    /* input, and numerical values (and pivoting) modified on output */
+    klu_numeric *Numeric,
+    klu_common *Common
+) ;
+
+int klu_z_adaptive_factor   /* return TRUE if successful, FALSE otherwise */
+(
+     /* inputs, not modified */
+     int32_t Ap [ ],        /* size n+1, column pointers */
+     int32_t Ai [ ],        /* size nz, row indices */
+     double Ax [ ],     /* size 2*nz, numerical values */
+     klu_symbolic *Symbolic,
+     /* input, and numerical values (and pivoting) modified on output */
+     klu_numeric *Numeric,
+     klu_common *Common
+) ;
+
+int klu_l_adaptive_factor (int64_t *, int64_t *,
+    double *, klu_l_symbolic *, klu_l_numeric *, klu_l_common *) ;
+
+int klu_zl_adaptive_factor (int64_t *, int64_t *,
+    double *, klu_l_symbolic *, klu_l_numeric *, klu_l_common *) ;
+
+
 /* -------------------------------------------------------------------------- */
 /* klu_free_symbolic: destroys the Symbolic object */
 /* -------------------------------------------------------------------------- */
@@ -823,33 +1017,33 @@ void klu_version (int version [3]) ;
  *      #endif
  */
 
-#define KLU_DATE "Oct 10, 2024"
-#define KLU_MAIN_VERSION   2
-#define KLU_SUB_VERSION    3
-#define KLU_SUBSUB_VERSION 5
+#define KLU_DATE "Oct 19, 2026"
+#define KLU_MAIN_VERSION   3
+#define KLU_SUB_VERSION    0
+#define KLU_SUBSUB_VERSION 0
 
 #define KLU_VERSION_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
-#define KLU_VERSION KLU_VERSION_CODE(2,3)
+#define KLU_VERSION KLU_VERSION_CODE(3,0)
 
-#define KLU__VERSION SUITESPARSE__VERCODE(2,3,5)
+#define KLU__VERSION SUITESPARSE__VERCODE(3,0,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,3))
-#error "KLU 2.3.5 requires SuiteSparse_config 7.8.3 or later"
+#error "KLU 3.0.0 requires SuiteSparse_config 7.8.3 or later"
 #endif
 
 #if !defined (AMD__VERSION) || \
     (AMD__VERSION < SUITESPARSE__VERCODE(3,3,3))
-#error "KLU 2.3.5 requires AMD 3.3.3 or later"
+#error "KLU 3.0.0 requires AMD 3.3.3 or later"
 #endif
 
 #if !defined (COLAMD__VERSION) || \
     (COLAMD__VERSION < SUITESPARSE__VERCODE(3,3,4))
-#error "KLU 2.3.5 requires COLAMD 3.3.4 or later"
+#error "KLU 3.0.0 requires COLAMD 3.3.4 or later"
 #endif
 
 #if !defined (BTF__VERSION) || \
     (BTF__VERSION < SUITESPARSE__VERCODE(2,3,2))
-#error "KLU 2.3.5 requires BTF 2.3.2 or later"
+#error "KLU 3.0.0 requires BTF 2.3.2 or later"
 #endif
 
 #endif
@@ -121,6 +121,7 @@ size_t KLU_kernel   /* final size of LU on output */
     Int Offp [ ],   /* off-diagonal matrix (modified by this routine) */
     Int Offi [ ],
     Entry Offx [ ],
+    Int keep,           /* if TRUE, LU is not shrunk when done */
     KLU_common *Common  /* the control input/output structure */
 ) ;
 
@@ -135,8 +136,12 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     Int Q [ ],      /* size n, optional column permutation */
     double Lsize,   /* initial size of L and U */
 
+    /* input/output */
+    Unit **p_LU,        /* row indices and values of L and U.  On input,
+                         * NULL, or a buffer of size LUsize_in to reuse */
+    size_t LUsize_in,   /* size of *p_LU on input */
+
     /* outputs, not defined on input */
-    Unit **p_LU,        /* row indices and values of L and U */
     Entry Udiag [ ],    /* size n, diagonal of U */
     Int Llen [ ],       /* size n, column length of L */
     Int Ulen [ ],       /* size n, column length of U */
@@ -219,6 +224,33 @@ void KLU_utsolve
     Entry X [ ]
 ) ;
 
+int KLU_solve_block
+(
+    /* inputs, not modified */
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,              /* leading dimension of B */
+    Int nrhs,           /* number of right-hand-sides */
+    /* right-hand-side on input, solution to Ax=b on output */
+    double B [ ],
+    KLU_common *Common
+) ;
+
+int KLU_tsolve_block
+(
+    /* inputs, not modified */
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,              /* leading dimension of B */
+    Int nrhs,           /* number of right-hand-sides */
+    /* right-hand-side on input, solution to A'x=b on output */
+    double B [ ],
+#ifdef COMPLEX
+    Int conj_solve,
+#endif
+    KLU_common *Common
+) ;
+
 Int KLU_valid 
 (
     Int n, 
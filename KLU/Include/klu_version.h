@@ -55,9 +55,14 @@
 #define KLU_scale klu_zl_scale
 #define KLU_solve klu_zl_solve
 #define KLU_tsolve klu_zl_tsolve
+#define KLU_solve_block klu_zl_solve_block
+#define KLU_tsolve_block klu_zl_tsolve_block
+#define KLU_spsolve klu_zl_spsolve
 #define KLU_free_numeric klu_zl_free_numeric
 #define KLU_factor klu_zl_factor
+#define KLU_factor_reuse klu_zl_factor_reuse
 #define KLU_refactor klu_zl_refactor
+#define KLU_adaptive_factor klu_zl_adaptive_factor
 #define KLU_kernel_factor klu_zl_kernel_factor 
 #define KLU_lsolve klu_zl_lsolve
 #define KLU_ltsolve klu_zl_ltsolve
@@ -79,9 +84,14 @@
 #define KLU_scale klu_z_scale
 #define KLU_solve klu_z_solve
 #define KLU_tsolve klu_z_tsolve
+#define KLU_solve_block klu_z_solve_block
+#define KLU_tsolve_block klu_z_tsolve_block
+#define KLU_spsolve klu_z_spsolve
 #define KLU_free_numeric klu_z_free_numeric
 #define KLU_factor klu_z_factor
+#define KLU_factor_reuse klu_z_factor_reuse
 #define KLU_refactor klu_z_refactor
+#define KLU_adaptive_factor klu_z_adaptive_factor
 #define KLU_kernel_factor klu_z_kernel_factor 
 #define KLU_lsolve klu_z_lsolve
 #define KLU_ltsolve klu_z_ltsolve
@@ -107,9 +117,14 @@
 #define KLU_scale klu_l_scale
 #define KLU_solve klu_l_solve
 #define KLU_tsolve klu_l_tsolve
+#define KLU_solve_block klu_l_solve_block
+#define KLU_tsolve_block klu_l_tsolve_block
+#define KLU_spsolve klu_l_spsolve
 #define KLU_free_numeric klu_l_free_numeric
 #define KLU_factor klu_l_factor
+#define KLU_factor_reuse klu_l_factor_reuse
 #define KLU_refactor klu_l_refactor
+#define KLU_adaptive_factor klu_l_adaptive_factor
 #define KLU_kernel_factor klu_l_kernel_factor 
 #define KLU_lsolve klu_l_lsolve
 #define KLU_ltsolve klu_l_ltsolve
@@ -131,9 +146,14 @@
 #define KLU_scale klu_scale
 #define KLU_solve klu_solve
 #define KLU_tsolve klu_tsolve
+#define KLU_solve_block klu_solve_block
+#define KLU_tsolve_block klu_tsolve_block
+#define KLU_spsolve klu_spsolve
 #define KLU_free_numeric klu_free_numeric
 #define KLU_factor klu_factor
+#define KLU_factor_reuse klu_factor_reuse
 #define KLU_refactor klu_refactor
+#define KLU_adaptive_factor klu_adaptive_factor
 #define KLU_kernel_factor klu_kernel_factor 
 #define KLU_lsolve klu_lsolve
 #define KLU_ltsolve klu_ltsolve
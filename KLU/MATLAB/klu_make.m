@@ -189,7 +189,8 @@ end
 btf_src = {
     '../../BTF/Source/btf_l_maxtrans', ...
     '../../BTF/Source/btf_l_order', ...
-    '../../BTF/Source/btf_l_strongcomp' } ;
+    '../../BTF/Source/btf_l_strongcomp', ...
+    '../../BTF/Source/btf_l_pstrongcomp' } ;
 
 klu_src = {
     '../Source/klu_l_free_symbolic', ...
@@ -211,7 +212,10 @@ klu_zlsrc = {
     '../Source/klu_zl_solve', ...
     '../Source/klu_zl_scale', ...
     '../Source/klu_zl_refactor', ...
+    '../Source/klu_zl_adaptive_factor', ...
     '../Source/klu_zl_tsolve', ...
+    '../Source/klu_zl_solve_block', ...
+    '../Source/klu_zl_spsolve', ...
     '../Source/klu_zl_diagnostics', ...
     '../Source/klu_zl_sort', ...
     '../Source/klu_zl_extract', ...
@@ -226,7 +230,10 @@ klu_lsrc = {
     '../Source/klu_l_solve', ...
     '../Source/klu_l_scale', ...
     '../Source/klu_l_refactor', ...
+    '../Source/klu_l_adaptive_factor', ...
     '../Source/klu_l_tsolve', ...
+    '../Source/klu_l_solve_block', ...
+    '../Source/klu_l_spsolve', ...
     '../Source/klu_l_diagnostics', ...
     '../Source/klu_l_sort', ...
     '../Source/klu_l_extract', ...
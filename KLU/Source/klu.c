@@ -70,8 +70,12 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     Int Q [ ],      /* size n, optional column permutation */
     double Lsize,   /* estimate of number of nonzeros in L */
 
+    /* input/output */
+    Unit **p_LU,        /* row indices and values of L and U.  On input,
+                         * NULL, or a buffer of size LUsize_in to reuse */
+    size_t LUsize_in,   /* size of *p_LU on input */
+
     /* outputs, not defined on input */
-    Unit **p_LU,        /* row indices and values of L and U */
     Entry Udiag [ ],    /* size n, diagonal of U */
     Int Llen [ ],       /* size n, column length of L */
     Int Ulen [ ],       /* size n, column length of U */
@@ -101,7 +105,7 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     double maxlnz, dunits ;
     Unit *LU ;
     Int *Pinv, *Lpend, *Stack, *Flag, *Ap_pos, *W ;
-    Int lsize, usize, anz, ok ;
+    Int lsize, usize, anz, ok, reuse ;
     size_t lusize ;
     ASSERT (Common != NULL) ;
 
@@ -140,6 +144,10 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     /* allocate workspace and outputs */
     /* ---------------------------------------------------------------------- */
 
+    /* an existing buffer is reused, if given */
+    LU = *p_LU ;
+    reuse = (LU != NULL) ;
+
     /* return arguments are not yet assigned */
     *p_LU = (Unit *) NULL ;
 
@@ -151,11 +159,19 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     Lpend = (Int *) W ;     W += n ;
     Ap_pos = (Int *) W ;    W += n ;
 
-    dunits = DUNITS (Int, lsize) + DUNITS (Entry, lsize) +
-             DUNITS (Int, usize) + DUNITS (Entry, usize) ;
-    lusize = (size_t) dunits ;
-    ok = !INT_OVERFLOW (dunits) ; 
-    LU = ok ? KLU_malloc (lusize, sizeof (Unit), Common) : NULL ;
+    if (LU != NULL)
+    {
+        /* reuse the buffer as-is; KLU_kernel grows it if it is too small */
+        lusize = LUsize_in ;
+    }
+    else
+    {
+        dunits = DUNITS (Int, lsize) + DUNITS (Entry, lsize) +
+                 DUNITS (Int, usize) + DUNITS (Entry, usize) ;
+        lusize = (size_t) dunits ;
+        ok = !INT_OVERFLOW (dunits) ; 
+        LU = ok ? KLU_malloc (lusize, sizeof (Unit), Common) : NULL ;
+    }
     if (LU == NULL)
     {
         /* out of memory, or problem too large */
@@ -172,7 +188,7 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
     lusize = KLU_kernel (n, Ap, Ai, Ax, Q, lusize,
             Pinv, P, &LU, Udiag, Llen, Ulen, Lip, Uip, lnz, unz,
             X, Stack, Flag, Ap_pos, Lpend,
-            k1, PSinv, Rs, Offp, Offi, Offx, Common) ;
+            k1, PSinv, Rs, Offp, Offi, Offx, reuse, Common) ;
 
     /* ---------------------------------------------------------------------- */
     /* return LU factors, or return nothing if an error occurred */
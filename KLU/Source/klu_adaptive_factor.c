@@ -0,0 +1,386 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_adaptive_factor: refactor, re-pivoting only unstable blocks
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (c) 2004-2022, University of Florida.  All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* Factor a matrix with the same pattern as the one given to KLU_factor, using
+ * the fast non-pivoting KLU_refactor where it is numerically safe, and
+ * falling back to a pivoting factorization only for the blocks of the BTF
+ * form where it is not.
+ *
+ * KLU_refactor is first used (with Common->track_growth enabled) to compute
+ * the new factorization and the reciprocal pivot growth of each block.  Each
+ * block whose reciprocal pivot growth is less than Common->rgrowth_tol, or
+ * that has a zero pivot, is then factorized again with partial pivoting, using
+ * KLU_kernel_factor just as KLU_factor does.  The old pivot row of each column
+ * is treated as its "diagonal" entry, so Common->tol keeps as many of the old
+ * pivots as it can.  The other blocks, and the off-diagonal blocks, are left
+ * as computed by KLU_refactor.
+ *
+ * On output, Numeric->Bgrowth [block] and Common->rgrowth hold the reciprocal
+ * pivot growth of each block and of the whole matrix, for the final
+ * factorization (see KLU_refactor).  Common->nrepivot is the number of blocks
+ * that were re-pivoted, and Common->noffdiag is the number of pivot rows that
+ * changed in those blocks.
+ *
+ * Returns TRUE if successful, FALSE otherwise.  If the matrix is singular,
+ * Common->status is KLU_SINGULAR, and FALSE is returned only if
+ * Common->halt_if_singular is TRUE.  If Common->status is KLU_OUT_OF_MEMORY,
+ * the Numeric object can no longer be used, except by KLU_free_numeric.
+ */
+
+#include "klu_internal.h"
+
+/* ========================================================================== */
+/* === block_rgrowth ======================================================== */
+/* ========================================================================== */
+
+/* Reciprocal pivot growth of a single block, as computed by KLU_rgrowth.
+ * 0 is returned if the block has a zero pivot.  Pinv and Rs must be in their
+ * final (pivotal) order. */
+
+static double block_rgrowth
+(
+    Int Ap [ ],
+    Int Ai [ ],
+    Entry Az [ ],
+    Int Q [ ],
+    Int k1,
+    Int k2,
+    Unit *LU,
+    Int Uip [ ],
+    Int Ulen [ ],
+    Entry Ukk [ ],
+    Int Pinv [ ],
+    double Rs [ ]
+)
+{
+    double temp, max_ai, max_ui, rgrowth ;
+    Entry aik, *Ux ;
+    Int j, k, nk, oldcol, oldrow, newrow, pend, len ;
+
+    nk = k2 - k1 ;
+    rgrowth = 1 ;
+    for (j = 0 ; j < nk ; j++)
+    {
+        if (IS_ZERO (Ukk [j]))
+        {
+            return (0) ;
+        }
+        max_ai = 0 ;
+        max_ui = 0 ;
+        oldcol = Q [j + k1] ;
+        pend = Ap [oldcol + 1] ;
+        for (k = Ap [oldcol] ; k < pend ; k++)
+        {
+            oldrow = Ai [k] ;
+            newrow = Pinv [oldrow] ;
+            if (newrow < k1)
+            {
+                continue ;  /* skip entry outside the block */
+            }
+            ASSERT (newrow < k2) ;
+            if (Rs != NULL)
+            {
+                /* aik = Az [k] / Rs [newrow] */
+                SCALE_DIV_ASSIGN (aik, Az [k], Rs [newrow]) ;
+            }
+            else
+            {
+                aik = Az [k] ;
+            }
+            /* temp = ABS (aik) */
+            ABS (temp, aik) ;
+            if (temp > max_ai)
+            {
+                max_ai = temp ;
+            }
+        }
+        GET_X_POINTER (LU, Uip, Ulen, Ux, j) ;
+        len = Ulen [j] ;
+        for (k = 0 ; k < len ; k++)
+        {
+            /* temp = ABS (Ux [k]) */
+            ABS (temp, Ux [k]) ;
+            if (temp > max_ui)
+            {
+                max_ui = temp ;
+            }
+        }
+        /* consider the diagonal element */
+        ABS (temp, Ukk [j]) ;
+        if (temp > max_ui)
+        {
+            max_ui = temp ;
+        }
+        temp = max_ai / max_ui ;
+        if (temp < rgrowth)
+        {
+            rgrowth = temp ;
+        }
+    }
+    return (rgrowth) ;
+}
+
+
+/* ========================================================================== */
+/* === KLU_adaptive_factor ================================================== */
+/* ========================================================================== */
+
+int KLU_adaptive_factor /* returns TRUE if successful, FALSE otherwise */
+(
+    /* inputs, not modified */
+    Int Ap [ ],         /* size n+1, column pointers */
+    Int Ai [ ],         /* size nz, row indices */
+    double Ax [ ],
+    KLU_symbolic *Symbolic,
+
+    /* input/output */
+    KLU_numeric *Numeric,
+    KLU_common  *Common
+)
+{
+    double lsize, rgrowth_tol ;
+    double *Rs, *Bgrowth ;
+    Entry *Offx, *X, *Az, *Udiag ;
+    Int *Q, *R, *Pnum, *Pinv, *Offp, *Offi, *Lip, *Uip, *Llen, *Ulen, *Iwork,
+        *Pblock ;
+    Unit **LUbx ;
+    Int k1, k2, nk, k, block, n, p, nblocks, nzoff, lnz_block, unz_block,
+        lnz_old, unz_old, lnz, unz ;
+    int ok, track_growth, halt_if_singular, nrepivot, singular ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check inputs */
+    /* ---------------------------------------------------------------------- */
+
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    Common->status = KLU_OK ;
+    Common->nrepivot = EMPTY ;
+
+    if (Symbolic == NULL || Numeric == NULL)
+    {
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* refactor, and find the pivot growth of each block */
+    /* ---------------------------------------------------------------------- */
+
+    /* do not halt if a block is singular; it may be fixed by pivoting */
+    track_growth = Common->track_growth ;
+    halt_if_singular = Common->halt_if_singular ;
+    Common->track_growth = TRUE ;
+    Common->halt_if_singular = FALSE ;
+    ok = KLU_refactor (Ap, Ai, Ax, Symbolic, Numeric, Common) ;
+    Common->track_growth = track_growth ;
+    Common->halt_if_singular = halt_if_singular ;
+    if (!ok)
+    {
+        /* invalid matrix, or out of memory */
+        return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* get the contents of the Symbolic and Numeric objects */
+    /* ---------------------------------------------------------------------- */
+
+    n = Symbolic->n ;
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+    nblocks = Symbolic->nblocks ;
+    nzoff = Symbolic->nzoff ;
+
+    Pnum = Numeric->Pnum ;
+    Pinv = Numeric->Pinv ;
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+    Offx = (Entry *) Numeric->Offx ;
+    Lip = Numeric->Lip ;
+    Uip = Numeric->Uip ;
+    Llen = Numeric->Llen ;
+    Ulen = Numeric->Ulen ;
+    LUbx = (Unit **) Numeric->LUbx ;
+    Udiag = Numeric->Udiag ;
+    Rs = Numeric->Rs ;
+    Bgrowth = Numeric->Bgrowth ;
+    X = (Entry *) Numeric->Xwork ;
+    Iwork = Numeric->Iwork ;
+    Pblock = Iwork + 5*((size_t) Symbolic->maxblock) ;
+    Az = (Entry *) Ax ;
+
+    rgrowth_tol = Common->rgrowth_tol ;
+    nrepivot = 0 ;
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        if (R [block+1] - R [block] > 1 && !(Bgrowth [block] >= rgrowth_tol))
+        {
+            nrepivot++ ;
+        }
+    }
+    Common->nrepivot = nrepivot ;
+
+    if (nrepivot > 0)
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* return Rs and Offi to the original row order, as KLU_factor has */
+        /* ------------------------------------------------------------------ */
+
+        if (Rs != NULL)
+        {
+            for (k = 0 ; k < n ; k++)
+            {
+                REAL (X [k]) = Rs [k] ;
+            }
+            for (k = 0 ; k < n ; k++)
+            {
+                Rs [Pnum [k]] = REAL (X [k]) ;
+            }
+        }
+        for (p = 0 ; p < nzoff ; p++)
+        {
+            Offi [p] = Pnum [Offi [p]] ;
+        }
+
+        /* ------------------------------------------------------------------ */
+        /* factorize each unstable block with partial pivoting */
+        /* ------------------------------------------------------------------ */
+
+        Common->noffdiag = 0 ;
+        lnz = Numeric->lnz ;
+        unz = Numeric->unz ;
+
+        for (block = 0 ; block < nblocks ; block++)
+        {
+            k1 = R [block] ;
+            k2 = R [block+1] ;
+            nk = k2 - k1 ;
+            if (nk == 1 || Bgrowth [block] >= rgrowth_tol)
+            {
+                continue ;
+            }
+            PRINTF (("REPIVOT BLOCK %d, k1 %d k2-1 %d nk %d growth %g\n",
+                block, k1, k2-1, nk, Bgrowth [block])) ;
+
+            /* the old factors of this block are overwritten */
+            lnz_old = nk ;
+            unz_old = nk ;
+            for (k = k1 ; k < k2 ; k++)
+            {
+                lnz_old += Llen [k] ;
+                unz_old += Ulen [k] ;
+            }
+
+            /* The rows of the block are pivotal in the order given by the
+             * current Pinv, which KLU_kernel_factor uses as its symbolic
+             * pre-ordering.  Rows of other blocks are not yet renumbered, so
+             * Pinv still partitions the rows into the same blocks. */
+            lsize = Common->initmem_amd * MAX (lnz_old, unz_old) + nk ;
+            Numeric->LUsize [block] = KLU_kernel_factor (nk, Ap, Ai, Az, Q,
+                    lsize, &LUbx [block], Numeric->LUsize [block],
+                    Udiag + k1, Llen + k1, Ulen + k1,
+                    Lip + k1, Uip + k1, Pblock, &lnz_block, &unz_block,
+                    X, Iwork, k1, Pinv, Rs, Offp, Offi, Offx, Common) ;
+            if (Common->status < KLU_OK)
+            {
+                /* out of memory */
+                return (FALSE) ;
+            }
+
+            lnz += lnz_block - lnz_old ;
+            unz += unz_block - unz_old ;
+            Numeric->max_lnz_block = MAX (Numeric->max_lnz_block, lnz_block) ;
+            Numeric->max_unz_block = MAX (Numeric->max_unz_block, unz_block) ;
+
+            /* combine the new row ordering of the block with the old one */
+            for (k = 0 ; k < nk ; k++)
+            {
+                Iwork [k] = Pnum [Pblock [k] + k1] ;
+            }
+            for (k = 0 ; k < nk ; k++)
+            {
+                Pnum [k + k1] = Iwork [k] ;
+            }
+        }
+
+        Numeric->lnz = lnz ;
+        Numeric->unz = unz ;
+
+        /* ------------------------------------------------------------------ */
+        /* compute the inverse of Pnum, and permute Rs and Offi with it */
+        /* ------------------------------------------------------------------ */
+
+        for (k = 0 ; k < n ; k++)
+        {
+            ASSERT (Pnum [k] >= 0 && Pnum [k] < n) ;
+            Pinv [Pnum [k]] = k ;
+        }
+        if (Rs != NULL)
+        {
+            for (k = 0 ; k < n ; k++)
+            {
+                REAL (X [k]) = Rs [Pnum [k]] ;
+            }
+            for (k = 0 ; k < n ; k++)
+            {
+                Rs [k] = REAL (X [k]) ;
+            }
+        }
+        for (p = 0 ; p < nzoff ; p++)
+        {
+            ASSERT (Offi [p] >= 0 && Offi [p] < n) ;
+            Offi [p] = Pinv [Offi [p]] ;
+        }
+        ASSERT (KLU_valid (n, Offp, Offi, Offx)) ;
+
+        /* ------------------------------------------------------------------ */
+        /* find the pivot growth of the re-pivoted blocks */
+        /* ------------------------------------------------------------------ */
+
+        Common->rgrowth = 1 ;
+        for (block = 0 ; block < nblocks ; block++)
+        {
+            k1 = R [block] ;
+            k2 = R [block+1] ;
+            if (k2 - k1 > 1 && !(Bgrowth [block] >= rgrowth_tol))
+            {
+                Bgrowth [block] = block_rgrowth (Ap, Ai, Az, Q, k1, k2,
+                    LUbx [block], Uip + k1, Ulen + k1, Udiag + k1, Pinv, Rs) ;
+            }
+            if (Bgrowth [block] < Common->rgrowth)
+            {
+                Common->rgrowth = Bgrowth [block] ;
+            }
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* check for singularity */
+    /* ---------------------------------------------------------------------- */
+
+    Common->status = KLU_OK ;
+    Common->numerical_rank = EMPTY ;
+    Common->singular_col = EMPTY ;
+    singular = FALSE ;
+    for (k = 0 ; k < n && !singular ; k++)
+    {
+        if (IS_ZERO (Udiag [k]))
+        {
+            Common->status = KLU_SINGULAR ;
+            Common->numerical_rank = k ;
+            Common->singular_col = Q [k] ;
+            singular = TRUE ;
+        }
+    }
+    return (!(singular && Common->halt_if_singular)) ;
+}
@@ -36,6 +36,11 @@ int KLU_defaults
                                  * 0: none, but check for errors,
                                  * 1: sum, 2: max */
     Common->halt_if_singular = TRUE ;   /* quick halt if matrix is singular */
+    Common->nrhs_block = 0 ;    /* klu_solve, klu_tsolve: 4 columns at a time */
+    Common->nthreads_max = 0 ;  /* use default # of OpenMP threads */
+    Common->track_growth = FALSE ;  /* klu_refactor does not compute rgrowth */
+    Common->rgrowth_tol = 1e-8 ;    /* klu_adaptive_factor re-pivot threshold */
+    Common->memslack = 0 ;      /* LU factors are shrunk to fit when done */
 
     /* user ordering function and optional argument */
     Common->user_order = NULL ;
@@ -51,6 +56,7 @@ int KLU_defaults
     Common->rcond = EMPTY ;
     Common->condest = EMPTY ;
     Common->rgrowth = EMPTY ;
+    Common->nrepivot = EMPTY ;
     Common->work = 0 ;          /* work done by btf_order */
 
     Common->memusage = 0 ;
@@ -9,7 +9,8 @@
 //------------------------------------------------------------------------------
 
 /* Factor the matrix, after ordering and analyzing it with KLU_analyze
- * or KLU_analyze_given.
+ * or KLU_analyze_given.  KLU_factor_reuse does the same, in place, in an
+ * existing Numeric object.
  */
 
 #include "klu_internal.h"
@@ -244,9 +245,10 @@ static void factor2
                 lsize = Common->initmem_amd * Lnz [block] + nk ;
             }
 
-            /* allocates 1 arrays: LUbx [block] */
+            /* allocates 1 arrays: LUbx [block], or reuses it if not NULL */
             Numeric->LUsize [block] = KLU_kernel_factor (nk, Ap, Ai, Ax, Q,
-                    lsize, &LUbx [block], Udiag + k1, Llen + k1, Ulen + k1,
+                    lsize, &LUbx [block], Numeric->LUsize [block],
+                    Udiag + k1, Llen + k1, Ulen + k1,
                     Lip + k1, Uip + k1, Pblock, &lnz_block, &unz_block,
                     X, Iwork, k1, Pinv, Rs, Offp, Offi, Offx, Common) ;
 
@@ -457,6 +459,9 @@ KLU_numeric *KLU_factor         /* returns NULL if error, or a valid
     Numeric->n = n ;
     Numeric->nblocks = nblocks ;
     Numeric->nzoff = nzoff ;
+    Numeric->spworksize = 0 ;
+    Numeric->SpWork = NULL ;
+    Numeric->Bgrowth = NULL ;
     Numeric->Pnum = KLU_malloc (n, sizeof (Int), Common) ;
     Numeric->Offp = KLU_malloc (n1, sizeof (Int), Common) ;
     Numeric->Offi = KLU_malloc (nzoff1, sizeof (Int), Common) ;
@@ -477,6 +482,13 @@ KLU_numeric *KLU_factor         /* returns NULL if error, or a valid
             Numeric->LUbx [k] = NULL ;
         }
     }
+    if (Numeric->LUsize != NULL)
+    {
+        for (k = 0 ; k < nblocks ; k++)
+        {
+            Numeric->LUsize [k] = 0 ;
+        }
+    }
 
     Numeric->Udiag = KLU_malloc (n, sizeof (Entry), Common) ;
 
@@ -547,3 +559,128 @@ KLU_numeric *KLU_factor         /* returns NULL if error, or a valid
     }
     return (Numeric) ;
 }
+
+
+/* ========================================================================== */
+/* === KLU_factor_reuse ===================================================== */
+/* ========================================================================== */
+
+/* Factorize a matrix with partial pivoting, just like KLU_factor, but in an
+ * existing Numeric object created by KLU_factor from the same Symbolic object,
+ * instead of a new one.  All of its arrays are reused.  The LU factors of each
+ * block are grown, by the usual reallocation in KLU_kernel, only if the new
+ * factors do not fit; they are never shrunk.  Thus once each block has seen
+ * its largest factorization, no memory is allocated at all.  Setting
+ * Common->memslack leaves extra room in the LU factors of each block when they
+ * are first computed (by KLU_factor or KLU_factor_reuse), so that a later
+ * factorization with more fill-in need not grow them.
+ *
+ * The Numeric object is not freed if an error occurs, but it is only partially
+ * defined.  It can still be passed to KLU_factor_reuse or KLU_free_numeric.
+ */
+
+int KLU_factor_reuse    /* returns TRUE if successful, FALSE otherwise */
+(
+    /* inputs, not modified */
+    Int Ap [ ],         /* size n+1, column pointers */
+    Int Ai [ ],         /* size nz, row indices */
+    double Ax [ ],
+    KLU_symbolic *Symbolic,
+
+    /* input/output */
+    KLU_numeric *Numeric,
+    KLU_common *Common
+)
+{
+    Int n, nblocks, maxblock, ok = TRUE ;
+    size_t s, b6, n3 ;
+
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    Common->status = KLU_OK ;
+    Common->numerical_rank = EMPTY ;
+    Common->singular_col = EMPTY ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the Symbolic and Numeric objects */
+    /* ---------------------------------------------------------------------- */
+
+    if (Symbolic == NULL || Numeric == NULL)
+    {
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+
+    n = Symbolic->n ;
+    nblocks = Symbolic->nblocks ;
+    maxblock = Symbolic->maxblock ;
+
+    /* the Numeric object must have been created with the same Symbolic
+     * object, or one with the same dimensions */
+    s = KLU_mult_size_t (n, sizeof (Entry), &ok) ;
+    n3 = KLU_mult_size_t (n, 3 * sizeof (Entry), &ok) ;
+    b6 = KLU_mult_size_t (maxblock, 6 * sizeof (Int), &ok) ;
+    if (Numeric->n != n || Numeric->nblocks != nblocks ||
+        Numeric->nzoff != Symbolic->nzoff ||
+        Numeric->worksize < KLU_add_size_t (s, MAX (n3, b6), &ok))
+    {
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* get control parameters and make sure they are in the proper range */
+    /* ---------------------------------------------------------------------- */
+
+    Common->initmem_amd = MAX (1.0, Common->initmem_amd) ;
+    Common->initmem = MAX (1.0, Common->initmem) ;
+    Common->tol = MIN (Common->tol, 1.0) ;
+    Common->tol = MAX (0.0, Common->tol) ;
+    Common->memgrow = MAX (1.0, Common->memgrow) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the scale factors, if not already present */
+    /* ---------------------------------------------------------------------- */
+
+    if (Common->scale > 0)
+    {
+        if (Numeric->Rs == NULL)
+        {
+            Numeric->Rs = KLU_malloc (n, sizeof (double), Common) ;
+            if (Common->status < KLU_OK)
+            {
+                Common->status = KLU_OUT_OF_MEMORY ;
+                return (FALSE) ;
+            }
+        }
+    }
+    else
+    {
+        /* no scaling; this does nothing if Numeric->Rs is already NULL */
+        Numeric->Rs = KLU_free (Numeric->Rs, n, sizeof (double), Common) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize the blocks, reusing their LU factors */
+    /* ---------------------------------------------------------------------- */
+
+    factor2 (Ap, Ai, (Entry *) Ax, Symbolic, Numeric, Common) ;
+
+    if (Common->status < KLU_OK)
+    {
+        /* out of memory or inputs invalid */
+        return (FALSE) ;
+    }
+    else if (Common->status == KLU_SINGULAR)
+    {
+        /* the Numeric object is only partially defined if we halted early */
+        return (!Common->halt_if_singular) ;
+    }
+
+    /* successful non-singular factorization */
+    Common->numerical_rank = n ;
+    Common->singular_col = n ;
+    return (TRUE) ;
+}
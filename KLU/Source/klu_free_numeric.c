@@ -69,6 +69,8 @@ int KLU_free_numeric
     KLU_free (Numeric->Pinv, n, sizeof (Int), Common) ;
 
     KLU_free (Numeric->Work, Numeric->worksize, 1, Common) ;
+    KLU_free (Numeric->SpWork, Numeric->spworksize, 1, Common) ;
+    KLU_free (Numeric->Bgrowth, nblocks, sizeof (double), Common) ;
 
     KLU_free (Numeric, 1, sizeof (KLU_numeric), Common) ;
 
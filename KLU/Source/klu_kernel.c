@@ -673,6 +673,7 @@ size_t KLU_kernel   /* final size of LU on output */
     Int Offp [ ],   /* off-diagonal matrix (modified by this routine) */
     Int Offi [ ],
     Entry Offx [ ],
+    Int keep,       /* if TRUE, LU is not shrunk when done */
     /* --------------- */
     KLU_common *Common
 )
@@ -1006,11 +1007,18 @@ size_t KLU_kernel   /* final size of LU on output */
     /* shrink the LU factors to just the required size */
     /* ---------------------------------------------------------------------- */
 
-    newlusize = lup ;
+    /* Common->memslack of extra space is left, so that a later factorization
+     * that reuses LU need not grow it.  A reused LU is not shrunk at all. */
+    xsize = ((double) lup) * (1 + MAX (Common->memslack, 0)) ;
+    newlusize = (keep || xsize >= (double) lusize) ? lusize : (size_t) xsize ;
+    newlusize = MAX (newlusize, (size_t) lup) ;
     ASSERT ((size_t) newlusize <= lusize) ;
 
-    /* this cannot fail, since the block is descreasing in size */
-    LU = KLU_realloc (newlusize, lusize, sizeof (Unit), LU, Common) ;
+    if (newlusize < lusize)
+    {
+        /* this cannot fail, since the block is descreasing in size */
+        LU = KLU_realloc (newlusize, lusize, sizeof (Unit), LU, Common) ;
+    }
     *p_LU = LU ;
     return (newlusize) ;
 }
@@ -0,0 +1,11 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_l_adaptive_factor.c: int64_t version of klu_adaptive_factor
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (C) 2004-2022, University of Florida, All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+#define DLONG
+#include "klu_adaptive_factor.c"
+
@@ -0,0 +1,11 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_l_solve_block.c: int64_t version of klu_solve_block
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (C) 2004-2024, University of Florida, All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+#define DLONG
+#include "klu_solve_block.c"
+
@@ -12,6 +12,13 @@
  * factoring it once with KLU_factor.  This routine cannot do any numerical
  * pivoting.  The pattern of the input matrix (Ap, Ai) must be identical to
  * the pattern given to KLU_factor.
+ *
+ * If Common->track_growth is TRUE, the reciprocal pivot growth of each block
+ * is computed as the factorization proceeds, with the same definition as
+ * KLU_rgrowth.  It is returned in Numeric->Bgrowth [block] (1 for singletons,
+ * and 0 for a block with a zero pivot), and the smallest one is returned in
+ * Common->rgrowth.  This costs much less than a separate call to KLU_rgrowth,
+ * since the entries of A and U are already at hand.
  */
 
 #include "klu_internal.h"
@@ -36,12 +43,14 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
 {
     Entry ukk, ujk, s ;
     Entry *Offx, *Lx, *Ux, *X, *Az, *Udiag ;
-    double *Rs ;
+    double *Rs, *Bgrowth ;
+    double temp, max_ai, max_ui, block_rgrowth ;
     Int *Q, *R, *Pnum, *Ui, *Li, *Pinv, *Lip, *Uip, *Llen, *Ulen ;
     Unit **LUbx ;
     Unit *LU ;
     Int k1, k2, nk, k, block, oldcol, pend, oldrow, n, p, newrow, scale,
         nblocks, poff, i, j, up, ulen, llen, maxblock, nzoff ;
+    int track ;
 
     /* ---------------------------------------------------------------------- */
     /* check inputs */
@@ -84,6 +93,29 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
 
     LUbx = (Unit **) Numeric->LUbx ;
 
+    /* ---------------------------------------------------------------------- */
+    /* get workspace for the pivot growth of each block, if requested */
+    /* ---------------------------------------------------------------------- */
+
+    track = Common->track_growth ;
+    if (track)
+    {
+        if (Numeric->Bgrowth == NULL)
+        {
+            Numeric->Bgrowth = KLU_malloc (nblocks, sizeof (double), Common) ;
+            if (Common->status < KLU_OK)
+            {
+                Common->status = KLU_OUT_OF_MEMORY ;
+                return (FALSE) ;
+            }
+        }
+        Common->rgrowth = 1 ;
+    }
+    Bgrowth = Numeric->Bgrowth ;
+    max_ai = 0 ;
+    max_ui = 0 ;
+    block_rgrowth = 1 ;
+
     scale = Common->scale ;
     if (scale > 0)
     {
@@ -186,6 +218,10 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                     }
                 }
                 Udiag [k1] = s ;
+                if (track)
+                {
+                    Bgrowth [block] = 1 ;
+                }
 
             }
             else
@@ -200,6 +236,7 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                 Uip  = Numeric->Uip  + k1 ;
                 Ulen = Numeric->Ulen + k1 ;
                 LU = LUbx [block] ;
+                block_rgrowth = 1 ;
 
                 for (k = 0 ; k < nk ; k++)
                 {
@@ -223,6 +260,15 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         {
                             /* (newrow,k) is an entry in the block */
                             X [newrow] = Az [p] ;
+                            if (track)
+                            {
+                                /* max_ai = max (max_ai, ABS (X [newrow])) */
+                                ABS (temp, X [newrow]) ;
+                                if (temp > max_ai)
+                                {
+                                    max_ai = temp ;
+                                }
+                            }
                         }
                     }
 
@@ -238,6 +284,15 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         /* X [j] = 0 */
                         CLEAR (X [j]) ;
                         Ux [up] = ujk ;
+                        if (track)
+                        {
+                            /* max_ui = max (max_ui, ABS (ujk)) */
+                            ABS (temp, ujk) ;
+                            if (temp > max_ui)
+                            {
+                                max_ui = temp ;
+                            }
+                        }
                         GET_POINTER (LU, Lip, Llen, Li, Lx, j, llen) ;
                         for (p = 0 ; p < llen ; p++)
                         {
@@ -266,6 +321,27 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         }
                     }
                     Udiag [k+k1] = ukk ;
+                    if (track)
+                    {
+                        /* column k of the block is done; U(k,k) is the last
+                         * entry of U(:,k) to consider */
+                        ABS (temp, ukk) ;
+                        if (temp > max_ui)
+                        {
+                            max_ui = temp ;
+                        }
+                        if (IS_ZERO (ukk))
+                        {
+                            block_rgrowth = 0 ;
+                        }
+                        else if (!SCALAR_IS_ZERO (max_ui)
+                            && max_ai / max_ui < block_rgrowth)
+                        {
+                            block_rgrowth = max_ai / max_ui ;
+                        }
+                        max_ai = 0 ;
+                        max_ui = 0 ;
+                    }
                     /* gather and divide by pivot to get kth column of L */
                     GET_POINTER (LU, Lip, Llen, Li, Lx, k, llen) ;
                     for (p = 0 ; p < llen ; p++)
@@ -274,7 +350,14 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         DIV (Lx [p], X [i], ukk) ;
                         CLEAR (X [i]) ;
                     }
-
+                }
+                if (track)
+                {
+                    Bgrowth [block] = block_rgrowth ;
+                    if (block_rgrowth < Common->rgrowth)
+                    {
+                        Common->rgrowth = block_rgrowth ;
+                    }
                 }
             }
         }
@@ -327,6 +410,10 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                     }
                 }
                 Udiag [k1] = s ;
+                if (track)
+                {
+                    Bgrowth [block] = 1 ;
+                }
 
             }
             else
@@ -341,6 +428,7 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                 Uip  = Numeric->Uip  + k1 ;
                 Ulen = Numeric->Ulen + k1 ;
                 LU = LUbx [block] ;
+                block_rgrowth = 1 ;
 
                 for (k = 0 ; k < nk ; k++)
                 {
@@ -367,6 +455,15 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                             /* (newrow,k) is an entry in the block */
                             /* X [newrow] = Az [p] / Rs [oldrow] */
                             SCALE_DIV_ASSIGN (X [newrow], Az [p], Rs [oldrow]) ;
+                            if (track)
+                            {
+                                /* max_ai = max (max_ai, ABS (X [newrow])) */
+                                ABS (temp, X [newrow]) ;
+                                if (temp > max_ai)
+                                {
+                                    max_ai = temp ;
+                                }
+                            }
                         }
                     }
 
@@ -382,6 +479,15 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         /* X [j] = 0 */
                         CLEAR (X [j]) ;
                         Ux [up] = ujk ;
+                        if (track)
+                        {
+                            /* max_ui = max (max_ui, ABS (ujk)) */
+                            ABS (temp, ujk) ;
+                            if (temp > max_ui)
+                            {
+                                max_ui = temp ;
+                            }
+                        }
                         GET_POINTER (LU, Lip, Llen, Li, Lx, j, llen) ;
                         for (p = 0 ; p < llen ; p++)
                         {
@@ -410,6 +516,27 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         }
                     }
                     Udiag [k+k1] = ukk ;
+                    if (track)
+                    {
+                        /* column k of the block is done; U(k,k) is the last
+                         * entry of U(:,k) to consider */
+                        ABS (temp, ukk) ;
+                        if (temp > max_ui)
+                        {
+                            max_ui = temp ;
+                        }
+                        if (IS_ZERO (ukk))
+                        {
+                            block_rgrowth = 0 ;
+                        }
+                        else if (!SCALAR_IS_ZERO (max_ui)
+                            && max_ai / max_ui < block_rgrowth)
+                        {
+                            block_rgrowth = max_ai / max_ui ;
+                        }
+                        max_ai = 0 ;
+                        max_ui = 0 ;
+                    }
                     /* gather and divide by pivot to get kth column of L */
                     GET_POINTER (LU, Lip, Llen, Li, Lx, k, llen) ;
                     for (p = 0 ; p < llen ; p++)
@@ -419,6 +546,14 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         CLEAR (X [i]) ;
                     }
                 }
+                if (track)
+                {
+                    Bgrowth [block] = block_rgrowth ;
+                    if (block_rgrowth < Common->rgrowth)
+                    {
+                        Common->rgrowth = block_rgrowth ;
+                    }
+                }
             }
         }
     }
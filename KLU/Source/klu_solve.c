@@ -12,7 +12,9 @@
  * (or KLU_analyze_given) and KLU_factor.  Note that no iterative refinement is
  * performed.  Uses Numeric->Xwork as workspace (undefined on input and output),
  * of size 4n Entry's (note that columns 2 to 4 of Xwork overlap with
- * Numeric->Iwork).
+ * Numeric->Iwork).  If Common->nrhs_block > 4 and nrhs > 4, the solve is
+ * done instead by KLU_solve_block, which uses its own workspace and solves
+ * nrhs_block columns at a time, in parallel.
  */
 
 #include "klu_internal.h"
@@ -55,6 +57,16 @@ int KLU_solve
     }
     Common->status = KLU_OK ;
 
+    /* ---------------------------------------------------------------------- */
+    /* solve in chunks of Common->nrhs_block columns, if requested */
+    /* ---------------------------------------------------------------------- */
+
+    if (Common->nrhs_block > 4 && nrhs > 4 &&
+        KLU_solve_block (Symbolic, Numeric, d, nrhs, B, Common))
+    {
+        return (TRUE) ;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* get the contents of the Symbolic object */
     /* ---------------------------------------------------------------------- */
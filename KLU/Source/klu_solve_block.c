@@ -0,0 +1,649 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_solve_block: solve Ax=b or A'x=b with wide blocks of B
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (c) 2004-2024, University of Florida.  All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* Solve Ax=b or A'x=b, where B has many columns.  Used by KLU_solve and
+ * KLU_tsolve when Common->nrhs_block > 4.  B is split into chunks of
+ * nrhs_block columns.  Each chunk is copied into a workspace X in row form
+ * with row dimension nr (the same layout KLU_solve uses for Numeric->Xwork,
+ * with nr up to nrhs_block instead of 4), so the innermost loop of each
+ * forward/backsolve operates on nr contiguous entries, and each entry of L, U,
+ * and the off-diagonal blocks is loaded once per chunk.  The chunks are
+ * independent, and are solved in parallel if KLU is compiled with OpenMP.
+ * Each thread has its own workspace of size n*nrhs_block Entry's, allocated
+ * here; Numeric->Xwork is not used.
+ *
+ * Returns TRUE if successful.  Returns FALSE if the workspace cannot be
+ * allocated, in which case B is not modified, Common->status is left as
+ * KLU_OK, and the caller falls back to the 4-column solve.  No error checking
+ * is done on the inputs; that is done by KLU_solve and KLU_tsolve.
+ */
+
+#include "klu_internal.h"
+
+/* ========================================================================== */
+/* === block_lsolve ========================================================= */
+/* ========================================================================== */
+
+/* Solve Lx=b, where L is unit lower triangular with the unit diagonal not
+ * stored, and X is n-by-nr in row form with row dimension nr. */
+
+static void block_lsolve
+(
+    Int n,
+    Int Lip [ ],
+    Int Llen [ ],
+    Unit LU [ ],
+    Int nr,
+    Entry X [ ]
+)
+{
+    Entry lik, *xk, *xi ;
+    Entry *Lx ;
+    Int *Li ;
+    Int k, p, len, j ;
+
+    for (k = 0 ; k < n ; k++)
+    {
+        GET_POINTER (LU, Lip, Llen, Li, Lx, k, len) ;
+        xk = X + nr*k ;
+        for (p = 0 ; p < len ; p++)
+        {
+            lik = Lx [p] ;
+            xi = X + nr*Li [p] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                /* X (i,j) -= L (i,k) * X (k,j) */
+                MULT_SUB (xi [j], lik, xk [j]) ;
+            }
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === block_usolve ========================================================= */
+/* ========================================================================== */
+
+/* Solve Ux=b, where the diagonal of U is held in Udiag and not in LU. */
+
+static void block_usolve
+(
+    Int n,
+    Int Uip [ ],
+    Int Ulen [ ],
+    Unit LU [ ],
+    Entry Udiag [ ],
+    Int nr,
+    Entry X [ ]
+)
+{
+    Entry uik, ukk, *xk, *xi ;
+    Entry *Ux ;
+    Int *Ui ;
+    Int k, p, len, j ;
+
+    for (k = n-1 ; k >= 0 ; k--)
+    {
+        GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, len) ;
+        ukk = Udiag [k] ;
+        xk = X + nr*k ;
+        for (j = 0 ; j < nr ; j++)
+        {
+            DIV (xk [j], xk [j], ukk) ;
+        }
+        for (p = 0 ; p < len ; p++)
+        {
+            uik = Ux [p] ;
+            xi = X + nr*Ui [p] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                /* X (i,j) -= U (i,k) * X (k,j) */
+                MULT_SUB (xi [j], uik, xk [j]) ;
+            }
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === block_ltsolve ======================================================== */
+/* ========================================================================== */
+
+/* Solve L'x=b (or L.'x=b for the complex case when conj_solve is FALSE). */
+
+static void block_ltsolve
+(
+    Int n,
+    Int Lip [ ],
+    Int Llen [ ],
+    Unit LU [ ],
+    Int nr,
+#ifdef COMPLEX
+    Int conj_solve,
+#endif
+    Entry X [ ]
+)
+{
+    Entry lik, *xk, *xi ;
+    Entry *Lx ;
+    Int *Li ;
+    Int k, p, len, j ;
+
+    for (k = n-1 ; k >= 0 ; k--)
+    {
+        GET_POINTER (LU, Lip, Llen, Li, Lx, k, len) ;
+        xk = X + nr*k ;
+        for (p = 0 ; p < len ; p++)
+        {
+#ifdef COMPLEX
+            if (conj_solve)
+            {
+                CONJ (lik, Lx [p]) ;
+            }
+            else
+#endif
+            {
+                lik = Lx [p] ;
+            }
+            xi = X + nr*Li [p] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                /* X (k,j) -= L (i,k) * X (i,j) */
+                MULT_SUB (xk [j], lik, xi [j]) ;
+            }
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === block_utsolve ======================================================== */
+/* ========================================================================== */
+
+/* Solve U'x=b (or U.'x=b for the complex case when conj_solve is FALSE). */
+
+static void block_utsolve
+(
+    Int n,
+    Int Uip [ ],
+    Int Ulen [ ],
+    Unit LU [ ],
+    Entry Udiag [ ],
+    Int nr,
+#ifdef COMPLEX
+    Int conj_solve,
+#endif
+    Entry X [ ]
+)
+{
+    Entry uik, ukk, *xk, *xi ;
+    Entry *Ux ;
+    Int *Ui ;
+    Int k, p, len, j ;
+
+    for (k = 0 ; k < n ; k++)
+    {
+        GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, len) ;
+        xk = X + nr*k ;
+        for (p = 0 ; p < len ; p++)
+        {
+#ifdef COMPLEX
+            if (conj_solve)
+            {
+                CONJ (uik, Ux [p]) ;
+            }
+            else
+#endif
+            {
+                uik = Ux [p] ;
+            }
+            xi = X + nr*Ui [p] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                /* X (k,j) -= U (i,k) * X (i,j) */
+                MULT_SUB (xk [j], uik, xi [j]) ;
+            }
+        }
+#ifdef COMPLEX
+        if (conj_solve)
+        {
+            CONJ (ukk, Udiag [k]) ;
+        }
+        else
+#endif
+        {
+            ukk = Udiag [k] ;
+        }
+        for (j = 0 ; j < nr ; j++)
+        {
+            DIV (xk [j], xk [j], ukk) ;
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === block_solve ========================================================== */
+/* ========================================================================== */
+
+/* Solve A*X=B for a single chunk of nr columns of B, using X as workspace. */
+
+static void block_solve
+(
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,
+    Int nr,
+    Entry *Bz,
+    Entry *X
+)
+{
+    Entry offik, s, *xk, *xi, *Offx, *Udiag ;
+    double rs, *Rs ;
+    Int *Q, *R, *Pnum, *Offp, *Offi, *Lip, *Uip, *Llen, *Ulen ;
+    Unit **LUbx ;
+    Int k1, k2, nk, k, block, pend, n, p, nblocks, i, j ;
+
+    n = Symbolic->n ;
+    nblocks = Symbolic->nblocks ;
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+
+    Pnum = Numeric->Pnum ;
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+    Offx = (Entry *) Numeric->Offx ;
+    Lip  = Numeric->Lip ;
+    Llen = Numeric->Llen ;
+    Uip  = Numeric->Uip ;
+    Ulen = Numeric->Ulen ;
+    LUbx = (Unit **) Numeric->LUbx ;
+    Udiag = Numeric->Udiag ;
+    Rs = Numeric->Rs ;
+
+    /* ---------------------------------------------------------------------- */
+    /* scale and permute the right hand side, X = P*(R\B) */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        i = Pnum [k] ;
+        xk = X + nr*k ;
+        if (Rs == NULL)
+        {
+            for (j = 0 ; j < nr ; j++)
+            {
+                xk [j] = Bz [i + d*j] ;
+            }
+        }
+        else
+        {
+            rs = Rs [k] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                SCALE_DIV_ASSIGN (xk [j], Bz [i + d*j], rs) ;
+            }
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve X = (L*U + Off)\X */
+    /* ---------------------------------------------------------------------- */
+
+    for (block = nblocks-1 ; block >= 0 ; block--)
+    {
+        k1 = R [block] ;
+        k2 = R [block+1] ;
+        nk = k2 - k1 ;
+
+        /* solve the block system */
+        if (nk == 1)
+        {
+            s = Udiag [k1] ;
+            xk = X + nr*k1 ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                DIV (xk [j], xk [j], s) ;
+            }
+        }
+        else
+        {
+            block_lsolve (nk, Lip + k1, Llen + k1, LUbx [block], nr,
+                X + nr*k1) ;
+            block_usolve (nk, Uip + k1, Ulen + k1, LUbx [block], Udiag + k1,
+                nr, X + nr*k1) ;
+        }
+
+        /* block back-substitution for the off-diagonal-block entries */
+        if (block > 0)
+        {
+            for (k = k1 ; k < k2 ; k++)
+            {
+                pend = Offp [k+1] ;
+                xk = X + nr*k ;
+                for (p = Offp [k] ; p < pend ; p++)
+                {
+                    offik = Offx [p] ;
+                    xi = X + nr*Offi [p] ;
+                    for (j = 0 ; j < nr ; j++)
+                    {
+                        MULT_SUB (xi [j], offik, xk [j]) ;
+                    }
+                }
+            }
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* permute the result, Bz = Q*X */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        i = Q [k] ;
+        xk = X + nr*k ;
+        for (j = 0 ; j < nr ; j++)
+        {
+            Bz [i + d*j] = xk [j] ;
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === block_tsolve ========================================================= */
+/* ========================================================================== */
+
+/* Solve A'*X=B for a single chunk of nr columns of B, using X as workspace. */
+
+static void block_tsolve
+(
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,
+    Int nr,
+    Entry *Bz,
+#ifdef COMPLEX
+    Int conj_solve,
+#endif
+    Entry *X
+)
+{
+    Entry offik, s, *xk, *xi, *Offx, *Udiag ;
+    double rs, *Rs ;
+    Int *Q, *R, *Pnum, *Offp, *Offi, *Lip, *Uip, *Llen, *Ulen ;
+    Unit **LUbx ;
+    Int k1, k2, nk, k, block, pend, n, p, nblocks, i, j ;
+
+    n = Symbolic->n ;
+    nblocks = Symbolic->nblocks ;
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+
+    Pnum = Numeric->Pnum ;
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+    Offx = (Entry *) Numeric->Offx ;
+    Lip  = Numeric->Lip ;
+    Llen = Numeric->Llen ;
+    Uip  = Numeric->Uip ;
+    Ulen = Numeric->Ulen ;
+    LUbx = (Unit **) Numeric->LUbx ;
+    Udiag = Numeric->Udiag ;
+    Rs = Numeric->Rs ;
+
+    /* ---------------------------------------------------------------------- */
+    /* permute the right hand side, X = Q'*B */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        i = Q [k] ;
+        xk = X + nr*k ;
+        for (j = 0 ; j < nr ; j++)
+        {
+            xk [j] = Bz [i + d*j] ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve X = (L*U + Off)'\X */
+    /* ---------------------------------------------------------------------- */
+
+    for (block = 0 ; block < nblocks ; block++)
+    {
+        k1 = R [block] ;
+        k2 = R [block+1] ;
+        nk = k2 - k1 ;
+
+        /* block back-substitution for the off-diagonal-block entries */
+        if (block > 0)
+        {
+            for (k = k1 ; k < k2 ; k++)
+            {
+                pend = Offp [k+1] ;
+                xk = X + nr*k ;
+                for (p = Offp [k] ; p < pend ; p++)
+                {
+#ifdef COMPLEX
+                    if (conj_solve)
+                    {
+                        CONJ (offik, Offx [p]) ;
+                    }
+                    else
+#endif
+                    {
+                        offik = Offx [p] ;
+                    }
+                    xi = X + nr*Offi [p] ;
+                    for (j = 0 ; j < nr ; j++)
+                    {
+                        MULT_SUB (xk [j], offik, xi [j]) ;
+                    }
+                }
+            }
+        }
+
+        /* solve the block system */
+        if (nk == 1)
+        {
+#ifdef COMPLEX
+            if (conj_solve)
+            {
+                CONJ (s, Udiag [k1]) ;
+            }
+            else
+#endif
+            {
+                s = Udiag [k1] ;
+            }
+            xk = X + nr*k1 ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                DIV (xk [j], xk [j], s) ;
+            }
+        }
+        else
+        {
+            block_utsolve (nk, Uip + k1, Ulen + k1, LUbx [block], Udiag + k1,
+                nr,
+#ifdef COMPLEX
+                conj_solve,
+#endif
+                X + nr*k1) ;
+            block_ltsolve (nk, Lip + k1, Llen + k1, LUbx [block], nr,
+#ifdef COMPLEX
+                conj_solve,
+#endif
+                X + nr*k1) ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* scale and permute the result, Bz = P'(R\X) */
+    /* ---------------------------------------------------------------------- */
+
+    for (k = 0 ; k < n ; k++)
+    {
+        i = Pnum [k] ;
+        xk = X + nr*k ;
+        if (Rs == NULL)
+        {
+            for (j = 0 ; j < nr ; j++)
+            {
+                Bz [i + d*j] = xk [j] ;
+            }
+        }
+        else
+        {
+            rs = Rs [k] ;
+            for (j = 0 ; j < nr ; j++)
+            {
+                SCALE_DIV_ASSIGN (Bz [i + d*j], xk [j], rs) ;
+            }
+        }
+    }
+}
+
+/* ========================================================================== */
+/* === block_workspace ====================================================== */
+/* ========================================================================== */
+
+/* Determine the number of threads to use, and allocate their workspace.
+ * Returns NULL (with Common->status unchanged) if out of memory. */
+
+static Entry *block_workspace
+(
+    Int n,
+    Int nrhs,
+    Int nb,             /* # of columns in each chunk */
+    Int *p_nthreads,    /* output: # of threads to use */
+    size_t *p_wsize,    /* output: size of the workspace, in Entry's */
+    KLU_common *Common
+)
+{
+    Entry *X ;
+    size_t wsize ;
+    Int nchunks, nthreads, ok = TRUE ;
+    int status = Common->status ;
+
+    nchunks = (nrhs + nb - 1) / nb ;
+    nthreads = Common->nthreads_max ;
+    if (nthreads <= 0)
+    {
+        nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+    }
+    nthreads = MAX (1, MIN (nthreads, nchunks)) ;
+
+    wsize = KLU_mult_size_t (MAX (n,1), nb, &ok) ;
+    wsize = KLU_mult_size_t (wsize, nthreads, &ok) ;
+    X = ok ? KLU_malloc (wsize, sizeof (Entry), Common) : NULL ;
+    Common->status = status ;
+
+    (*p_nthreads) = nthreads ;
+    (*p_wsize) = wsize ;
+    return (X) ;
+}
+
+/* ========================================================================== */
+/* === KLU_solve_block ====================================================== */
+/* ========================================================================== */
+
+int KLU_solve_block
+(
+    /* inputs, not modified */
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,                  /* leading dimension of B */
+    Int nrhs,               /* number of right-hand-sides */
+
+    /* right-hand-side on input, overwritten with solution to Ax=b on output */
+    double B [ ],           /* size n*nrhs, in column-oriented form, with
+                             * leading dimension d. */
+    /* --------------- */
+    KLU_common *Common
+)
+{
+    Entry *Bz, *X ;
+    size_t wsize ;
+    Int n, nb, nchunks, nthreads, chunk ;
+
+    n = Symbolic->n ;
+    nb = Common->nrhs_block ;
+    nchunks = (nrhs + nb - 1) / nb ;
+    X = block_workspace (n, nrhs, nb, &nthreads, &wsize, Common) ;
+    if (X == NULL)
+    {
+        return (FALSE) ;
+    }
+    Bz = (Entry *) B ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (chunk = 0 ; chunk < nchunks ; chunk++)
+    {
+        Int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+        Int nr = MIN (nrhs - chunk*nb, nb) ;
+        block_solve (Symbolic, Numeric, d, nr,
+            Bz + ((size_t) d) * nb * chunk, X + ((size_t) tid) * n * nb) ;
+    }
+
+    KLU_free (X, wsize, sizeof (Entry), Common) ;
+    return (TRUE) ;
+}
+
+/* ========================================================================== */
+/* === KLU_tsolve_block ===================================================== */
+/* ========================================================================== */
+
+int KLU_tsolve_block
+(
+    /* inputs, not modified */
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int d,                  /* leading dimension of B */
+    Int nrhs,               /* number of right-hand-sides */
+
+    /* right-hand-side on input, overwritten with solution to A'x=b on output */
+    double B [ ],           /* size n*nrhs, in column-oriented form, with
+                             * leading dimension d. */
+#ifdef COMPLEX
+    Int conj_solve,         /* TRUE for conjugate transpose solve, FALSE for
+                             * array transpose solve.  Used for the complex
+                             * case only. */
+#endif
+    /* --------------- */
+    KLU_common *Common
+)
+{
+    Entry *Bz, *X ;
+    size_t wsize ;
+    Int n, nb, nchunks, nthreads, chunk ;
+
+    n = Symbolic->n ;
+    nb = Common->nrhs_block ;
+    nchunks = (nrhs + nb - 1) / nb ;
+    X = block_workspace (n, nrhs, nb, &nthreads, &wsize, Common) ;
+    if (X == NULL)
+    {
+        return (FALSE) ;
+    }
+    Bz = (Entry *) B ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (chunk = 0 ; chunk < nchunks ; chunk++)
+    {
+        Int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+        Int nr = MIN (nrhs - chunk*nb, nb) ;
+        block_tsolve (Symbolic, Numeric, d, nr,
+            Bz + ((size_t) d) * nb * chunk,
+#ifdef COMPLEX
+            conj_solve,
+#endif
+            X + ((size_t) tid) * n * nb) ;
+    }
+
+    KLU_free (X, wsize, sizeof (Entry), Common) ;
+    return (TRUE) ;
+}
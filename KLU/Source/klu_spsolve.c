@@ -0,0 +1,497 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_spsolve: solve x=A\b with sparse b and sparse x
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (c) 2004-2024, University of Florida.  All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+/* Solve Ax=b where b is a single sparse column, using the symbolic and numeric
+ * objects from KLU_analyze (or KLU_analyze_given) and KLU_factor, and return
+ * the sparse solution x.  No iterative refinement is performed.
+ *
+ * A (P,Q) is block upper triangular, with diagonal blocks factorized as L*U
+ * and off-diagonal blocks held in Offp/Offi/Offx.  The solve follows the same
+ * steps as KLU_solve, but each step only visits what it needs:
+ *
+ *  (1) b is scaled and permuted and scattered into the workspace X.  The
+ *      BTF blocks that hold an entry are recorded, in a heap ordered by block
+ *      index, each with a list of its nonzero rows.
+ *  (2) the block with the largest index is removed from the heap.  The reach
+ *      of its nonzero rows in the graph of L is found by a depth-first search
+ *      (as in KLU_kernel), giving the pattern of L\b in topological order, and
+ *      the forward solve is done over just that pattern.  The same is then
+ *      done with U.
+ *  (3) the off-diagonal columns of the block's nonzero rows update earlier
+ *      blocks, which are added to the heap when they first receive an entry.
+ *  (4) steps (2) and (3) repeat until the heap is empty.  Blocks that never
+ *      receive an entry are not touched.
+ *
+ * The total work is O(flops + bnz + nactive * log (nblocks)), where flops is
+ * the # of floating-point operations and nactive is the # of blocks touched.
+ *
+ * The workspace is kept in Numeric->SpWork.  It is allocated and cleared by
+ * the first call to KLU_spsolve (which takes O(n) time), and each call leaves
+ * it cleared, so later calls take no O(n) time at all.  Its contents are:
+ *
+ *      X       size n Entry's, all zero between calls
+ *      Flag    size n, TRUE if the row is in the pattern of x; all FALSE
+ *              between calls
+ *      Visit   size n, used for the depth-first searches; all FALSE between
+ *              calls
+ *      Next    size n, linked list of the nonzero rows of each block
+ *      Stack   size n, recursion stack for the depth-first search
+ *      Pstack  size n, position stack for the depth-first search
+ *      Lreach  size n, pattern of L\b for a single block
+ *      Ureach  size n, pattern of U\(L\b) for a single block
+ *      Block   size n, Block [k] is the block containing row k
+ *      Head    size nblocks, Head [b] is the first nonzero row of block b, or
+ *              EMPTY; all EMPTY between calls
+ *      Heap    size nblocks, max-heap of blocks to solve
+ */
+
+#include "klu_internal.h"
+
+/* ========================================================================== */
+/* === heap_insert ========================================================== */
+/* ========================================================================== */
+
+/* Add block b to the max-heap Heap [0..nheap-1], and return the new size. */
+
+static Int heap_insert (Int Heap [ ], Int nheap, Int b)
+{
+    Int i, parent ;
+    i = nheap++ ;
+    while (i > 0)
+    {
+        parent = (i-1) / 2 ;
+        if (Heap [parent] >= b)
+        {
+            break ;
+        }
+        Heap [i] = Heap [parent] ;
+        i = parent ;
+    }
+    Heap [i] = b ;
+    return (nheap) ;
+}
+
+/* ========================================================================== */
+/* === heap_delete ========================================================== */
+/* ========================================================================== */
+
+/* Remove the largest block from the max-heap Heap [0..nheap-1], return it in
+ * *b, and return the new size of the heap. */
+
+static Int heap_delete (Int Heap [ ], Int nheap, Int *b)
+{
+    Int i, child, last ;
+    *b = Heap [0] ;
+    last = Heap [--nheap] ;
+    i = 0 ;
+    for ( ; ; )
+    {
+        child = 2*i + 1 ;
+        if (child >= nheap)
+        {
+            break ;
+        }
+        if (child + 1 < nheap && Heap [child+1] > Heap [child])
+        {
+            child++ ;
+        }
+        if (last >= Heap [child])
+        {
+            break ;
+        }
+        Heap [i] = Heap [child] ;
+        i = child ;
+    }
+    if (nheap > 0)
+    {
+        Heap [i] = last ;
+    }
+    return (nheap) ;
+}
+
+/* ========================================================================== */
+/* === reach ================================================================ */
+/* ========================================================================== */
+
+/* Depth-first search in the graph of L or U of a single block, starting at
+ * each node in Start [0..nstart-1].  The nodes reached are placed in
+ * Reach [top..nk-1] in topological order, where nk is the size of the block
+ * and top is returned.  All indices are local to the block.  Visit is left
+ * TRUE for all reached nodes; the caller must clear it. */
+
+static Int reach
+(
+    Int nk,             /* size of the block */
+    Int Xip [ ],        /* column pointers of L or U of the block */
+    Int Xlen [ ],       /* column lengths of L or U of the block */
+    Unit LU [ ],        /* LU factors of the block */
+    Int nstart,
+    Int Start [ ],      /* starting nodes */
+    /* output */
+    Int Reach [ ],      /* size nk */
+    /* workspace */
+    Int Visit [ ],      /* size nk */
+    Int Stack [ ],      /* size nk */
+    Int Pstack [ ]      /* size nk */
+)
+{
+    Int *Xi ;
+    Int s, j, i, p, len, head, top, done ;
+
+    top = nk ;
+    for (s = 0 ; s < nstart ; s++)
+    {
+        if (Visit [Start [s]])
+        {
+            continue ;
+        }
+
+        /* non-recursive depth-first search starting at Start [s] */
+        head = 0 ;
+        Stack [0] = Start [s] ;
+        while (head >= 0)
+        {
+            j = Stack [head] ;
+            GET_I_POINTER (LU, Xip, Xi, j) ;
+            len = Xlen [j] ;
+            if (!Visit [j])
+            {
+                /* first time j has been visited */
+                Visit [j] = TRUE ;
+                Pstack [head] = 0 ;
+            }
+            done = TRUE ;
+            for (p = Pstack [head] ; p < len ; p++)
+            {
+                i = Xi [p] ;
+                if (!Visit [i])
+                {
+                    /* pause the search of j and start the search of i */
+                    Pstack [head] = p + 1 ;
+                    Stack [++head] = i ;
+                    done = FALSE ;
+                    break ;
+                }
+            }
+            if (done)
+            {
+                /* all descendants of j have been visited; j is finished */
+                head-- ;
+                Reach [--top] = j ;
+            }
+        }
+    }
+    return (top) ;
+}
+
+/* ========================================================================== */
+/* === KLU_spsolve ========================================================== */
+/* ========================================================================== */
+
+int KLU_spsolve
+(
+    /* inputs, not modified */
+    KLU_symbolic *Symbolic,
+    KLU_numeric *Numeric,
+    Int bnz,                /* # of entries in b */
+    Int Bi [ ],             /* size bnz, row indices of b */
+    double Bx [ ],          /* size bnz, numerical values of b */
+    /* outputs, allocated on input */
+    Int *xnz,               /* # of entries in x */
+    Int Xi [ ],             /* size n, row indices of x */
+    double Xx [ ],          /* size n, numerical values of x */
+    /* --------------- */
+    KLU_common *Common
+)
+{
+    Entry xk, *X, *Bz, *Xz, *Offx, *Udiag ;
+    double *Rs ;
+    Int *Q, *R, *Pinv, *Offp, *Offi, *Lip, *Uip, *Llen, *Ulen, *Flag, *Visit,
+        *Next, *Stack, *Pstack, *Lreach, *Ureach, *Block, *Head, *Heap ;
+    Entry *Lx, *Ux ;
+    Int *Li, *Ui ;
+    Unit **LUbx, *LU ;
+    Int n, nblocks, nheap, nx, block, iblock, k1, k2, nk, k, i, p, t, len,
+        pend, ltop, utop, ok = TRUE ;
+    size_t s ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check inputs */
+    /* ---------------------------------------------------------------------- */
+
+    if (Common == NULL)
+    {
+        return (FALSE) ;
+    }
+    if (Numeric == NULL || Symbolic == NULL || bnz < 0 ||
+        (bnz > 0 && (Bi == NULL || Bx == NULL)) ||
+        xnz == NULL || Xi == NULL || Xx == NULL)
+    {
+        Common->status = KLU_INVALID ;
+        return (FALSE) ;
+    }
+    n = Symbolic->n ;
+    for (t = 0 ; t < bnz ; t++)
+    {
+        if (Bi [t] < 0 || Bi [t] >= n)
+        {
+            Common->status = KLU_INVALID ;
+            return (FALSE) ;
+        }
+    }
+    Common->status = KLU_OK ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the contents of the Symbolic and Numeric objects */
+    /* ---------------------------------------------------------------------- */
+
+    nblocks = Symbolic->nblocks ;
+    Q = Symbolic->Q ;
+    R = Symbolic->R ;
+
+    ASSERT (nblocks == Numeric->nblocks) ;
+    Pinv = Numeric->Pinv ;
+    Offp = Numeric->Offp ;
+    Offi = Numeric->Offi ;
+    Offx = (Entry *) Numeric->Offx ;
+    Lip  = Numeric->Lip ;
+    Llen = Numeric->Llen ;
+    Uip  = Numeric->Uip ;
+    Ulen = Numeric->Ulen ;
+    LUbx = (Unit **) Numeric->LUbx ;
+    Udiag = Numeric->Udiag ;
+    Rs = Numeric->Rs ;
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate and initialize the workspace, if this is the first call */
+    /* ---------------------------------------------------------------------- */
+
+    if (Numeric->SpWork == NULL)
+    {
+        /* n Entry's and 8*n + 2*nblocks Int's */
+        s = KLU_mult_size_t (n, sizeof (Entry), &ok) ;
+        s = KLU_add_size_t (s, KLU_mult_size_t (n, 8 * sizeof (Int), &ok),
+            &ok) ;
+        s = KLU_add_size_t (s,
+            KLU_mult_size_t (nblocks, 2 * sizeof (Int), &ok), &ok) ;
+        if (!ok)
+        {
+            Common->status = KLU_TOO_LARGE ;
+            return (FALSE) ;
+        }
+        Numeric->SpWork = KLU_malloc (s, 1, Common) ;
+        if (Common->status < KLU_OK)
+        {
+            return (FALSE) ;
+        }
+        Numeric->spworksize = s ;
+
+        X = (Entry *) Numeric->SpWork ;
+        Flag = (Int *) (X + n) ;
+        Visit = Flag + n ;
+        Block = Flag + 7*n ;
+        Head = Flag + 8*n ;
+        for (k = 0 ; k < n ; k++)
+        {
+            CLEAR (X [k]) ;
+            Flag [k] = FALSE ;
+            Visit [k] = FALSE ;
+        }
+        for (block = 0 ; block < nblocks ; block++)
+        {
+            Head [block] = EMPTY ;
+            for (k = R [block] ; k < R [block+1] ; k++)
+            {
+                Block [k] = block ;
+            }
+        }
+    }
+
+    X = (Entry *) Numeric->SpWork ;
+    Flag   = (Int *) (X + n) ;
+    Visit  = Flag + n ;
+    Next   = Flag + 2*n ;
+    Stack  = Flag + 3*n ;
+    Pstack = Flag + 4*n ;
+    Lreach = Flag + 5*n ;
+    Ureach = Flag + 6*n ;
+    Block  = Flag + 7*n ;
+    Head   = Flag + 8*n ;
+    Heap   = Head + nblocks ;
+
+    /* ---------------------------------------------------------------------- */
+    /* scale, permute, and scatter b into X, and find the blocks it touches */
+    /* ---------------------------------------------------------------------- */
+
+    /* the pattern of x is kept in Xi [0..nx-1], in the permuted order of
+     * A (P,Q), until it is permuted back at the end */
+    Bz = (Entry *) Bx ;
+    nx = 0 ;
+    nheap = 0 ;
+    for (t = 0 ; t < bnz ; t++)
+    {
+        k = Pinv [Bi [t]] ;
+        if (!Flag [k])
+        {
+            Flag [k] = TRUE ;
+            Xi [nx++] = k ;
+            block = Block [k] ;
+            if (Head [block] == EMPTY)
+            {
+                nheap = heap_insert (Heap, nheap, block) ;
+            }
+            Next [k] = Head [block] ;
+            Head [block] = k ;
+        }
+        if (Rs == NULL)
+        {
+            ASSEMBLE (X [k], Bz [t]) ;
+        }
+        else
+        {
+            /* X [k] += Bz [t] / Rs [k], duplicates in b are summed */
+            SCALE_DIV_ASSIGN (xk, Bz [t], Rs [k]) ;
+            ASSEMBLE (X [k], xk) ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve X = (L*U + Off)\X, one block at a time, last block first */
+    /* ---------------------------------------------------------------------- */
+
+    while (nheap > 0)
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* get the next block with a nonzero entry */
+        /* ------------------------------------------------------------------ */
+
+        nheap = heap_delete (Heap, nheap, &block) ;
+        k1 = R [block] ;
+        k2 = R [block+1] ;
+        nk = k2 - k1 ;
+        PRINTF (("spsolve %d, k1 %d k2-1 %d nk %d\n", block, k1,k2-1,nk)) ;
+
+        /* ------------------------------------------------------------------ */
+        /* solve the block system */
+        /* ------------------------------------------------------------------ */
+
+        if (nk == 1)
+        {
+            DIV (X [k1], X [k1], Udiag [k1]) ;
+            Ureach [0] = 0 ;
+            utop = 0 ;
+        }
+        else
+        {
+            /* get the nonzero rows of the block, local to the block */
+            t = 0 ;
+            for (k = Head [block] ; k != EMPTY ; k = Next [k])
+            {
+                Ureach [t++] = k - k1 ;
+            }
+            LU = LUbx [block] ;
+
+            /* find the pattern of L\b, in topological order */
+            ltop = reach (nk, Lip + k1, Llen + k1, LU, t, Ureach,
+                Lreach, Visit + k1, Stack, Pstack) ;
+
+            /* forward solve with L over just that pattern */
+            for (t = ltop ; t < nk ; t++)
+            {
+                k = k1 + Lreach [t] ;
+                Visit [k] = FALSE ;
+                if (!Flag [k])
+                {
+                    Flag [k] = TRUE ;
+                    Xi [nx++] = k ;
+                }
+                GET_POINTER (LU, Lip, Llen, Li, Lx, k, len) ;
+                xk = X [k] ;
+                for (p = 0 ; p < len ; p++)
+                {
+                    MULT_SUB (X [k1 + Li [p]], Lx [p], xk) ;
+                }
+            }
+
+            /* find the pattern of U\(L\b), in topological order */
+            utop = reach (nk, Uip + k1, Ulen + k1, LU, nk - ltop,
+                Lreach + ltop, Ureach, Visit + k1, Stack, Pstack) ;
+
+            /* back solve with U over just that pattern */
+            for (t = utop ; t < nk ; t++)
+            {
+                k = k1 + Ureach [t] ;
+                Visit [k] = FALSE ;
+                if (!Flag [k])
+                {
+                    Flag [k] = TRUE ;
+                    Xi [nx++] = k ;
+                }
+                GET_POINTER (LU, Uip, Ulen, Ui, Ux, k, len) ;
+                DIV (xk, X [k], Udiag [k]) ;
+                X [k] = xk ;
+                for (p = 0 ; p < len ; p++)
+                {
+                    MULT_SUB (X [k1 + Ui [p]], Ux [p], xk) ;
+                }
+            }
+        }
+        Head [block] = EMPTY ;
+
+        /* ------------------------------------------------------------------ */
+        /* block back-substitution for the off-diagonal-block entries */
+        /* ------------------------------------------------------------------ */
+
+        if (block > 0)
+        {
+            for (t = utop ; t < nk ; t++)
+            {
+                k = k1 + Ureach [t] ;
+                xk = X [k] ;
+                pend = Offp [k+1] ;
+                for (p = Offp [k] ; p < pend ; p++)
+                {
+                    i = Offi [p] ;
+                    if (!Flag [i])
+                    {
+                        /* first entry in row i: add it to its block */
+                        iblock = Block [i] ;
+                        Flag [i] = TRUE ;
+                        Xi [nx++] = i ;
+                        if (Head [iblock] == EMPTY)
+                        {
+                            nheap = heap_insert (Heap, nheap, iblock) ;
+                        }
+                        Next [i] = Head [iblock] ;
+                        Head [iblock] = i ;
+                    }
+                    MULT_SUB (X [i], Offx [p], xk) ;
+                }
+            }
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* gather and permute the result, x = Q*X, and clear the workspace */
+    /* ---------------------------------------------------------------------- */
+
+    Xz = (Entry *) Xx ;
+    for (t = 0 ; t < nx ; t++)
+    {
+        k = Xi [t] ;
+        Xz [t] = X [k] ;
+        Xi [t] = Q [k] ;
+        CLEAR (X [k]) ;
+        Flag [k] = FALSE ;
+    }
+    *xnz = nx ;
+    return (TRUE) ;
+}
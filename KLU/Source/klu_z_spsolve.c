@@ -0,0 +1,11 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_z_spsolve.c: complex int32_t version of klu_spsolve
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (C) 2004-2024, University of Florida, All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+#define COMPLEX
+#include "klu_spsolve.c"
+
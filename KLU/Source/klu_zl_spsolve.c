@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+// KLU/Source/klu_zl_spsolve.c: complex int64_t version of klu_spsolve
+//------------------------------------------------------------------------------
+
+// KLU, Copyright (C) 2004-2024, University of Florida, All Rights Reserved.
+// Authors: Timothy A. Davis and Ekanathan Palamadai.
+// SPDX-License-Identifier: LGPL-2.1+
+
+#define COMPLEX
+#define DLONG
+#include "klu_spsolve.c"
+
@@ -37,9 +37,12 @@
 #define klu_z_scale klu_zl_scale
 #define klu_z_solve klu_zl_solve
 #define klu_z_tsolve klu_zl_tsolve
+#define klu_z_spsolve klu_zl_spsolve
 #define klu_z_free_numeric klu_zl_free_numeric
 #define klu_z_factor klu_zl_factor
 #define klu_z_refactor klu_zl_refactor
+#define klu_z_adaptive_factor klu_zl_adaptive_factor
+#define klu_z_factor_reuse klu_zl_factor_reuse
 #define klu_z_lsolve klu_zl_lsolve
 #define klu_z_ltsolve klu_zl_ltsolve
 #define klu_z_usolve klu_zl_usolve
@@ -54,9 +57,12 @@
 #define klu_scale klu_l_scale
 #define klu_solve klu_l_solve
 #define klu_tsolve klu_l_tsolve
+#define klu_spsolve klu_l_spsolve
 #define klu_free_numeric klu_l_free_numeric
 #define klu_factor klu_l_factor
 #define klu_refactor klu_l_refactor
+#define klu_adaptive_factor klu_l_adaptive_factor
+#define klu_factor_reuse klu_l_factor_reuse
 #define klu_lsolve klu_l_lsolve
 #define klu_ltsolve klu_l_ltsolve
 #define klu_usolve klu_l_usolve
@@ -378,6 +384,101 @@ static Int *randperm (Int n, Int seed)
 }
 
 
+/* ========================================================================== */
+/* === do_spsolve =========================================================== */
+/* ========================================================================== */
+
+/* Solve A*x=b with klu_spsolve, where b is the first column of B, and compare
+ * with X, the first column of the solution from klu_solve.  Returns the
+ * largest difference, relative to the largest entry in x.  The test is skipped
+ * if x is not finite (A is singular), since klu_solve may compute NaN's in x
+ * where klu_spsolve leaves structural zeros. */
+
+static double do_spsolve (KLU_symbolic *Symbolic, KLU_numeric *Numeric,
+    Int n, Int isreal, double *Bx, double *Xx, KLU_common *Common)
+{
+    Int *Bi, *Xi, *Mark, bnz, xnz, i, k, e, ok ;
+    double *Bsx, *Xsx, err = 0, xnorm = 0 ;
+
+    e = isreal ? 1 : 2 ;
+    for (i = 0 ; i < e*n ; i++)
+    {
+        if (!isfinite (Xx [i])) return (0) ;
+    }
+
+    Bi  = malloc ((n+1) * sizeof (Int)) ;
+    Xi  = malloc ((n+1) * sizeof (Int)) ;
+    Mark = calloc (n+1, sizeof (Int)) ;
+    Bsx = malloc ((n+1) * e * sizeof (double)) ;
+    Xsx = malloc ((n+1) * e * sizeof (double)) ;
+    OK (Bi != NULL && Xi != NULL && Mark != NULL && Bsx != NULL && Xsx != NULL);
+
+    /* get the nonzero pattern of b, in reverse order */
+    bnz = 0 ;
+    for (i = n-1 ; i >= 0 ; i--)
+    {
+        if (Bx [e*i] != 0 || (!isreal && Bx [2*i+1] != 0))
+        {
+            Bi [bnz] = i ;
+            Bsx [e*bnz] = Bx [e*i] ;
+            if (!isreal) Bsx [2*bnz+1] = Bx [2*i+1] ;
+            bnz++ ;
+        }
+    }
+
+    if (isreal)
+    {
+        ok = klu_spsolve (Symbolic, Numeric, bnz, Bi, Bsx, &xnz, Xi, Xsx,
+            Common) ;
+    }
+    else
+    {
+        ok = klu_z_spsolve (Symbolic, Numeric, bnz, Bi, Bsx, &xnz, Xi, Xsx,
+            Common) ;
+    }
+    OK (ok) ;
+    OK (xnz >= 0 && xnz <= n) ;
+
+    /* compare the sparse x with the dense solution */
+    for (k = 0 ; k < xnz ; k++)
+    {
+        i = Xi [k] ;
+        OK (i >= 0 && i < n && !Mark [i]) ;
+        Mark [i] = TRUE ;
+        err = MAX (err, fabs (Xsx [e*k] - Xx [e*i])) ;
+        xnorm = MAX (xnorm, fabs (Xx [e*i])) ;
+        if (!isreal)
+        {
+            err = MAX (err, fabs (Xsx [2*k+1] - Xx [2*i+1])) ;
+            xnorm = MAX (xnorm, fabs (Xx [2*i+1])) ;
+        }
+    }
+    for (i = 0 ; i < n ; i++)
+    {
+        if (!Mark [i])
+        {
+            /* x(i) is not in the pattern, so it must be exactly zero */
+            OK (Xx [e*i] == 0 && (isreal || Xx [2*i+1] == 0)) ;
+        }
+    }
+
+    /* error handling */
+    FAIL (klu_spsolve (Symbolic, Numeric, -1, Bi, Bsx, &xnz, Xi, Xsx, Common));
+    OK (Common->status == KLU_INVALID) ;
+    Bi [0] = n ;
+    FAIL (klu_spsolve (Symbolic, Numeric, 1, Bi, Bsx, &xnz, Xi, Xsx, Common)) ;
+    OK (Common->status == KLU_INVALID) ;
+    Common->status = KLU_OK ;
+
+    free (Bi) ;
+    free (Xi) ;
+    free (Mark) ;
+    free (Bsx) ;
+    free (Xsx) ;
+    return (xnorm > 0 ? err / xnorm : err) ;
+}
+
+
 /* ========================================================================== */
 /* === do_1_solve =========================================================== */
 /* ========================================================================== */
@@ -393,8 +494,11 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
     cholmod_dense *X = NULL, *R = NULL ;
     cholmod_sparse *AT = NULL, *A2 = NULL, *AT2 = NULL ;
     double one [2], minusone [2],
-        rnorm, anorm, xnorm, relresid, relerr, err = 0. ;
+        rnorm, anorm, xnorm, relresid, relerr, err = 0., rgrowth = 1,
+        save_tol ;
+    size_t memusage ;
     Int i, j, nrhs2, isreal, n, nrhs, transpose, step, k, save, tries ;
+    int status ;
 
     printf ("\ndo_1_solve: btf %d maxwork %g scale %d ordering %d user: "
         ID" P,Q: %d halt: %d\n",
@@ -465,7 +569,7 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
     /* factorize then solve */
     /* ---------------------------------------------------------------------- */
 
-    for (step = 1 ; step <= 3 ; step++)
+    for (step = 1 ; step <= 5 ; step++)
     {
         printf ("step: "ID"\n", step) ;
         fflush (stdout) ;
@@ -477,6 +581,8 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
         /* step 1: factor
            step 2: refactor with same A
            step 3: refactor with modified A, and scaling forced on
+           step 4: adaptive refactor with modified A, re-pivoting all blocks
+           step 5: factor modified A again, reusing the Numeric object
            and solve each time
         */
 
@@ -526,7 +632,7 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
             }
 
         }
-        else
+        else if (step == 3)
         {
 
             /* numeric refactorization with different values */
@@ -548,7 +654,63 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
                 }
             }
             my_tries = -1 ;
+            /* refactor again, monitoring the pivot growth */
+            Common->track_growth = TRUE ;
+            if (isreal)
+            {
+                klu_refactor (Ap, Ai, Ax2, Symbolic, Numeric, Common) ;
+            }
+            else
+            {
+                klu_z_refactor (Ap, Ai, Ax2, Symbolic, Numeric, Common) ;
+            }
+            Common->track_growth = FALSE ;
             Common->scale = save ;
+            rgrowth = Common->rgrowth ;
+        }
+        else if (step == 4)
+        {
+
+            /* numeric refactorization with different values, re-pivoting
+             * every block that is not a singleton */
+            save_tol = Common->rgrowth_tol ;
+            Common->rgrowth_tol = 2 ;
+            if (isreal)
+            {
+                klu_adaptive_factor (Ap, Ai, Ax2, Symbolic, Numeric, Common) ;
+            }
+            else
+            {
+                klu_z_adaptive_factor (Ap, Ai, Ax2, Symbolic, Numeric, Common);
+            }
+            Common->rgrowth_tol = save_tol ;
+            rgrowth = Common->rgrowth ;
+            printf ("adaptive: status %d nrepivot %d noffdiag "ID"\n",
+                Common->status, Common->nrepivot, Common->noffdiag) ;
+        }
+        else if (Numeric != NULL)
+        {
+
+            /* numeric factorization with different values, reusing the
+             * Numeric object.  The second one must not allocate any memory,
+             * since the LU factors from the first one are large enough. */
+            for (tries = 0 ; tries <= 1 ; tries++)
+            {
+                memusage = Common->memusage ;
+                if (isreal)
+                {
+                    klu_factor_reuse (Ap, Ai, Ax2, Symbolic, Numeric, Common) ;
+                }
+                else
+                {
+                    klu_z_factor_reuse (Ap, Ai, Ax2, Symbolic, Numeric,
+                        Common) ;
+                }
+                printf ("reuse: status %d memusage %g nrealloc %d\n",
+                    Common->status, (double) (Common->memusage - memusage),
+                    Common->nrealloc) ;
+            }
+            OK (Common->memusage == memusage && Common->nrealloc == 0) ;
         }
 
         if (Common->status == KLU_SINGULAR)
@@ -560,7 +722,8 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
         /* diagnostics */
         /* ------------------------------------------------------------------ */
 
-        Axx = (step == 3) ? Ax2 : Ax ;
+        Axx = (step >= 3) ? Ax2 : Ax ;
+        status = Common->status ;
 
         if (isreal)
         {
@@ -580,6 +743,14 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
         printf ("growth %g condest %g rcond %g flops %g\n",
             Common->rgrowth, Common->condest, Common->rcond, Common->flops) ;
 
+        if (step >= 3 && step <= 4 && status == KLU_OK)
+        {
+            /* the pivot growth monitored by klu_refactor or klu_adaptive_factor
+             * must match klu_rgrowth */
+            printf ("monitored growth %g\n", rgrowth) ;
+            OK (fabs (rgrowth - Common->rgrowth) <= 1e-12 * Common->rgrowth) ;
+        }
+
         ludump (Symbolic, Numeric, isreal, ch, Common) ;
 
         if (Numeric == NULL || Common->status < KLU_OK)
@@ -604,6 +775,10 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
                 CHOLMOD_print_dense (X, "X before solve", ch) ;
                 Xx = X->x ;
 
+                /* with all nrhs columns, use the blocked solve, with one full
+                 * chunk of 5 columns and one partial chunk */
+                Common->nrhs_block = (nrhs2 == nrhs) ? 5 : 0 ;
+
                 if (isreal)
                 {
                     if (transpose)
@@ -615,6 +790,13 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
                     {
                         /* solve A*x=b */
                         klu_solve (Symbolic, Numeric, n, nrhs2, Xx, Common) ;
+                        if (nrhs2 == 1)
+                        {
+                            relerr = do_spsolve (Symbolic, Numeric, n, isreal,
+                                B->x, Xx, Common) ;
+                            printf ("spsolve diff %g\n", relerr) ;
+                            OK (relerr < 1e-8) ;
+                        }
                     }
                 }
                 else
@@ -629,9 +811,17 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
                     {
                         /* solve A*x=b */
                         klu_z_solve (Symbolic, Numeric, n, nrhs2, Xx, Common) ;
+                        if (nrhs2 == 1)
+                        {
+                            relerr = do_spsolve (Symbolic, Numeric, n, isreal,
+                                B->x, Xx, Common) ;
+                            printf ("spsolve diff %g\n", relerr) ;
+                            OK (relerr < 1e-8) ;
+                        }
                     }
                 }
 
+                Common->nrhs_block = 0 ;
                 CHOLMOD_print_dense (X, "X", ch) ;
 
                 /* compute the residual, R = B-A*X, B-A'*X, or B-A.'*X */
@@ -639,13 +829,13 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
                 if (transpose == -1)
                 {
                     /* R = B-A.'*X (use A.' explicitly) */
-                    CHOLMOD_sdmult ((step == 3) ? AT2 : AT,
+                    CHOLMOD_sdmult ((step >= 3) ? AT2 : AT,
                         0, minusone, one, X, R, ch) ;
                 }
                 else
                 {
                     /* R = B-A*X or B-A'*X */
-                    CHOLMOD_sdmult ((step == 3) ? A2 :A,
+                    CHOLMOD_sdmult ((step >= 3) ? A2 :A,
                         transpose, minusone, one, X, R, ch) ;
                 }
 
@@ -653,7 +843,7 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
 
                 /* compute the norms of R, A, X, and B */
                 rnorm = CHOLMOD_norm_dense (R, 1, ch) ;
-                anorm = CHOLMOD_norm_sparse ((step == 3) ? A2 : A, 1, ch) ;
+                anorm = CHOLMOD_norm_sparse ((step >= 3) ? A2 : A, 1, ch) ;
                 xnorm = CHOLMOD_norm_dense (X, 1, ch) ;
                 /* bnorm = CHOLMOD_norm_dense (B, 1, ch) ; */
 
@@ -681,7 +871,7 @@ static double do_1_solve (cholmod_sparse *A, cholmod_dense *B,
 
                 /* relative error = norm (x - xknown) / norm (xknown) */
                 /* overwrite X with X - Xknown */
-                if (transpose || step == 3)
+                if (transpose || step >= 3)
                 {
                     /* not computed */
                     relerr = -1 ;
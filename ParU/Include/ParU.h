@@ -50,28 +50,30 @@ typedef enum ParU_Info
     PARU_OUT_OF_MEMORY = -1,    // ParU ran out of memory
     PARU_INVALID = -2,          // inputs are invalid (NULL, for example)
     PARU_SINGULAR = -3,         // matrix is numerically singular
-    PARU_TOO_LARGE = -4         // problem too large for the BLAS
+    PARU_TOO_LARGE = -4,        // problem too large for the BLAS
+    PARU_PIVOT_FAILED = -5      // ParU_Refactorize: a pivot is too small;
+                                // use ParU_Factorize instead
 } ParU_Info ;
 
-#define PARU_DATE "Sept 5, 2024"
+#define PARU_DATE "Oct 19, 2026"
 #define PARU_VERSION_MAJOR  1
-#define PARU_VERSION_MINOR  0
+#define PARU_VERSION_MINOR  1
 #define PARU_VERSION_UPDATE 0
 
-#define PARU__VERSION SUITESPARSE__VERCODE(1,0,0)
+#define PARU__VERSION SUITESPARSE__VERCODE(1,1,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,3))
-#error "ParU 1.0.0 requires SuiteSparse_config 7.8.3 or later"
+#error "ParU 1.1.0 requires SuiteSparse_config 7.8.3 or later"
 #endif
 
 #if !defined (UMFPACK__VERSION) || \
-    (UMFPACK__VERSION < SUITESPARSE__VERCODE(6,3,5))
-#error "ParU 1.0.0 requires UMFPACK 6.3.5 or later"
+    (UMFPACK__VERSION < SUITESPARSE__VERCODE(7,0,0))
+#error "ParU 1.1.0 requires UMFPACK 7.0.0 or later"
 #endif
 
 #if !defined (CHOLMOD__VERSION) || \
     (CHOLMOD__VERSION < SUITESPARSE__VERCODE(5,3,0))
-#error "ParU 1.0.0 requires CHOLMOD 5.3.0 or later"
+#error "ParU 1.1.0 requires CHOLMOD 5.3.0 or later"
 #endif
 
 //  the same values as UMFPACK_STRATEGY defined in UMFPACK/Include/umfpack.h
@@ -135,6 +137,7 @@ typedef enum
     PARU_CONTROL_PRESCALE = 1010,             // prescale input matrix
     PARU_CONTROL_SINGLETONS = 1011,           // filter singletons, or not
     PARU_CONTROL_MEM_CHUNK = 1012,            // chunk size of memset and memcpy
+    PARU_CONTROL_NUMA_DOMAINS = 1015,         // # of NUMA domains to use
 
     // int64_t parameter, for ParU_Get only:
     PARU_CONTROL_OPENMP = 1013,               // if ParU compiled with OpenMP;
@@ -191,6 +194,7 @@ ParU_Control_enum ;
 #define PARU_DEFAULT_PRESCALE               PARU_PRESCALE_MAX
 #define PARU_DEFAULT_SINGLETONS             (1)
 #define PARU_DEFAULT_MEM_CHUNK              (1024*1024)
+#define PARU_DEFAULT_NUMA_DOMAINS           (1)
 #define PARU_DEFAULT_PIVOT_TOLERANCE        (0.1)
 #define PARU_DEFAULT_DIAG_PIVOT_TOLERANCE   (0.001)
 
@@ -262,6 +266,27 @@ ParU_Info ParU_Factorize
     ParU_Control Control
 ) ;
 
+//------------------------------------------------------------------------------
+// ParU_Refactorize: Numeric refactorization of a matrix with the same pattern
+// as the one factorized in Num, reusing its pivot sequence and the structure
+// of its fronts.  No pivot search is done; if a pivot is too small for the
+// pivot tolerances in Control, or the factors no longer fit in the fronts,
+// PARU_PIVOT_FAILED is returned, Num cannot be used to solve a system, and
+// ParU_Factorize must be used instead.
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Refactorize
+(
+    // input:
+    cholmod_sparse *A,          // input matrix to factorize, with the same
+                                // pattern as the one factorized in Num
+    const ParU_Symbolic Sym,    // symbolic analysis from ParU_Analyze
+    // input/output:
+    ParU_Numeric Num,           // numeric factorization from ParU_Factorize
+    // control:
+    ParU_Control Control
+) ;
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -577,6 +602,88 @@ ParU_Info ParU_Get              // get string from Control
     ParU_Control Control
 ) ;
 
+//------------------------------------------------------------------------------
+//------------ Serialize and deserialize ---------------------------------------
+//------------------------------------------------------------------------------
+
+// ParU_Serialize writes a ParU_Symbolic or ParU_Numeric object into a single
+// array of bytes (a "blob") of size given by ParU_SerializeSize, which can be
+// saved to a file.  ParU_Deserialize constructs the object from the blob.  If
+// view is false, the contents of the blob are copied into the new object.  If
+// view is true, the object uses the blob in place (a memory-mapped file, for
+// example), and the blob must not be freed or modified until the object is
+// freed.  The factors of a ParU_Numeric object are held in one contiguous
+// region at the end of its blob, so ParU_Solve can be used as soon as a saved
+// factorization is mapped.  A ParU_Numeric object is deserialized with the
+// ParU_Symbolic object used to compute it.
+
+ParU_Info ParU_SerializeSize
+(
+    // output:
+    int64_t *blobsize,          // size of the blob, in bytes
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis to serialize
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_SerializeSize
+(
+    // output:
+    int64_t *blobsize,          // size of the blob, in bytes
+    // input:
+    const ParU_Numeric Num,     // numeric factorization to serialize
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Serialize
+(
+    // output:
+    int8_t *blob,               // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,           // size of blob, >= ParU_SerializeSize
+    const ParU_Symbolic Sym,    // symbolic analysis to serialize
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Serialize
+(
+    // output:
+    int8_t *blob,               // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,           // size of blob, >= ParU_SerializeSize
+    const ParU_Numeric Num,     // numeric factorization to serialize
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Deserialize
+(
+    // input:
+    int8_t *blob,               // serialized blob from ParU_Serialize
+    int64_t blobsize,           // size of blob
+    bool view,                  // if true, use the blob in place
+    // output:
+    ParU_Symbolic *Sym_handle,  // symbolic analysis
+    // control:
+    ParU_Control Control
+) ;
+
+ParU_Info ParU_Deserialize
+(
+    // input:
+    int8_t *blob,               // serialized blob from ParU_Serialize
+    int64_t blobsize,           // size of blob
+    bool view,                  // if true, use the blob in place
+    const ParU_Symbolic Sym,    // symbolic analysis used to compute Num
+    // output:
+    ParU_Numeric *Num_handle,   // numeric factorization
+    // control:
+    ParU_Control Control
+) ;
+
 //------------------------------------------------------------------------------
 //------------ Free routines----------------------------------------------------
 //------------------------------------------------------------------------------
@@ -680,6 +787,22 @@ ParU_Info ParU_C_Factorize
     ParU_C_Control Control_C
 ) ;
 
+//------------------------------------------------------------------------------
+// ParU_C_Refactorize: Numeric refactorization of a matrix with the same
+// pattern, reusing the pivot sequence of Num_C; see ParU_Refactorize.
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_C_Refactorize
+(
+    // input:
+    cholmod_sparse *A,              // input matrix to factorize of size n-by-n
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis from ParU_Analyze
+    // input/output:
+    ParU_C_Numeric Num_C,           // numerical factorization to update
+    // control:
+    ParU_C_Control Control_C
+) ;
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -969,6 +1092,79 @@ ParU_Info ParU_C_Set_Control_FP64       // set double parameter in Control
     ParU_C_Control Control_C
 ) ;
 
+//------------------------------------------------------------------------------
+//------------ Serialize and deserialize ---------------------------------------
+//------------------------------------------------------------------------------
+
+// See ParU_Serialize and ParU_Deserialize.
+
+ParU_Info ParU_C_SerializeSize_Symbolic
+(
+    // output:
+    int64_t *blobsize,              // size of the blob, in bytes
+    // input:
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis to serialize
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_SerializeSize_Numeric
+(
+    // output:
+    int64_t *blobsize,              // size of the blob, in bytes
+    // input:
+    const ParU_C_Numeric Num_C,     // numeric factorization to serialize
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Serialize_Symbolic
+(
+    // output:
+    int8_t *blob,                   // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,               // size of blob, >= the size required
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis to serialize
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Serialize_Numeric
+(
+    // output:
+    int8_t *blob,                   // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,               // size of blob, >= the size required
+    const ParU_C_Numeric Num_C,     // numeric factorization to serialize
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Deserialize_Symbolic
+(
+    // input:
+    int8_t *blob,                   // serialized blob
+    int64_t blobsize,               // size of blob
+    bool view,                      // if true, use the blob in place
+    // output:
+    ParU_C_Symbolic *Sym_handle_C,  // symbolic analysis
+    // control:
+    ParU_C_Control Control_C
+) ;
+
+ParU_Info ParU_C_Deserialize_Numeric
+(
+    // input:
+    int8_t *blob,                   // serialized blob
+    int64_t blobsize,               // size of blob
+    bool view,                      // if true, use the blob in place
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis used to compute Num_C
+    // output:
+    ParU_C_Numeric *Num_handle_C,   // numeric factorization
+    // control:
+    ParU_C_Control Control_C
+) ;
+
 //------------------------------------------------------------------------------
 //------------ Free routines----------------------------------------------------
 //------------------------------------------------------------------------------
@@ -350,6 +350,8 @@ suitesparse_src = { ...
 
 paru_src = {
     '../Source/ParU_Factorize', ...
+    '../Source/ParU_Refactorize', ...
+    '../Source/ParU_Serialize', ...
     '../Source/ParU_Analyze', ...
     '../Source/paru_assemble', ...
     '../Source/paru_assemble_row2U', ...
@@ -374,6 +376,7 @@ paru_src = {
     '../Source/paru_heap', ...
     '../Source/paru_init_rel', ...
     '../Source/paru_init_rowFronts', ...
+    '../Source/paru_init_values', ...
     '../Source/paru_intersection', ...
     '../Source/ParU_InvPerm', ...
     '../Source/ParU_LSolve', ...
@@ -391,6 +394,7 @@ paru_src = {
     '../Source/ParU_Solve', ...
     '../Source/paru_tasked_dgemm', ...
     '../Source/paru_tasked_dtrsm', ...
+    '../Source/paru_tasked_solve', ...
     '../Source/paru_dtrsm', ...
     '../Source/paru_tuples', ...
     '../Source/paru_umfpack_info', ...
@@ -147,6 +147,35 @@ ParU_Info ParU_C_Factorize
     return (info) ;
 }
 
+//------------------------------------------------------------------------------
+// ParU_C_Refactorize: Numeric refactorization of a matrix with the same
+// pattern, reusing the pivot sequence of Num_C; see ParU_Refactorize.
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_C_Refactorize
+(
+    // input:
+    cholmod_sparse *A,          // input matrix to factorize of size n-by-n
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis from ParU_Analyze
+    // input/output:
+    ParU_C_Numeric Num_C,       // numerical factorization to update
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    if (!A || !Sym_C || !Num_C)
+    {
+        return (PARU_INVALID) ;
+    }
+
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+
+    ParU_Symbolic Sym = static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_Numeric Num = static_cast<ParU_Numeric>(Num_C->num_handle);
+    return (ParU_Refactorize(A, Sym, Num, Control)) ;
+}
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -639,6 +668,157 @@ ParU_Info ParU_C_Set_Control_FP64       // set double parameter in Control
     return (ParU_Set (field, c, Control)) ;
 }
 
+//------------------------------------------------------------------------------
+//------------ Serialize and deserialize ---------------------------------------
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_C_SerializeSize_Symbolic
+(
+    // output:
+    int64_t *blobsize,              // size of the blob, in bytes
+    // input:
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis to serialize
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Symbolic Sym = (Sym_C == NULL) ? NULL :
+        static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_SerializeSize (blobsize, Sym, Control)) ;
+}
+
+ParU_Info ParU_C_SerializeSize_Numeric
+(
+    // output:
+    int64_t *blobsize,              // size of the blob, in bytes
+    // input:
+    const ParU_C_Numeric Num_C,     // numeric factorization to serialize
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Numeric Num = (Num_C == NULL) ? NULL :
+        static_cast<ParU_Numeric>(Num_C->num_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_SerializeSize (blobsize, Num, Control)) ;
+}
+
+ParU_Info ParU_C_Serialize_Symbolic
+(
+    // output:
+    int8_t *blob,                   // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,               // size of blob, >= the size required
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis to serialize
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Symbolic Sym = (Sym_C == NULL) ? NULL :
+        static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_Serialize (blob, blobsize, Sym, Control)) ;
+}
+
+ParU_Info ParU_C_Serialize_Numeric
+(
+    // output:
+    int8_t *blob,                   // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,               // size of blob, >= the size required
+    const ParU_C_Numeric Num_C,     // numeric factorization to serialize
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    ParU_Numeric Num = (Num_C == NULL) ? NULL :
+        static_cast<ParU_Numeric>(Num_C->num_handle);
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+    return (ParU_Serialize (blob, blobsize, Num, Control)) ;
+}
+
+ParU_Info ParU_C_Deserialize_Symbolic
+(
+    // input:
+    int8_t *blob,                   // serialized blob
+    int64_t blobsize,               // size of blob
+    bool view,                      // if true, use the blob in place
+    // output:
+    ParU_C_Symbolic *Sym_handle_C,  // symbolic analysis
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    if (!Sym_handle_C)
+    {
+        return (PARU_INVALID) ;
+    }
+
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+
+    ParU_C_Symbolic Sym_C = PARU_CALLOC (1, ParU_C_Symbolic_struct);
+    if (!Sym_C)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    ParU_Symbolic Sym ;
+    ParU_Info info = ParU_Deserialize (blob, blobsize, view, &Sym, Control) ;
+    if (info != PARU_SUCCESS)
+    {
+        PARU_FREE (1, ParU_C_Symbolic_struct, Sym_C);
+        return (info) ;
+    }
+    Sym_C->sym_handle = static_cast<void*>(Sym);
+    (*Sym_handle_C) = Sym_C;
+    return (info) ;
+}
+
+ParU_Info ParU_C_Deserialize_Numeric
+(
+    // input:
+    int8_t *blob,                   // serialized blob
+    int64_t blobsize,               // size of blob
+    bool view,                      // if true, use the blob in place
+    const ParU_C_Symbolic Sym_C,    // symbolic analysis used to compute Num_C
+    // output:
+    ParU_C_Numeric *Num_handle_C,   // numeric factorization
+    // control:
+    ParU_C_Control Control_C
+)
+{
+    if (!Sym_C || !Num_handle_C)
+    {
+        return (PARU_INVALID) ;
+    }
+
+    ParU_Control Control = (Control_C == NULL) ? NULL :
+        static_cast<ParU_Control>(Control_C->control_handle) ;
+
+    ParU_Symbolic Sym = static_cast<ParU_Symbolic>(Sym_C->sym_handle);
+    ParU_C_Numeric Num_C = PARU_CALLOC (1, ParU_C_Numeric_struct) ;
+    if (!Num_C)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    ParU_Numeric Num ;
+    ParU_Info info = ParU_Deserialize (blob, blobsize, view, Sym, &Num,
+        Control) ;
+    if (info != PARU_SUCCESS)
+    {
+        PARU_FREE (1, ParU_C_Numeric_struct, Num_C);
+        return (info) ;
+    }
+    Num_C->num_handle = static_cast<void*>(Num);
+    (*Num_handle_C) = Num_C;
+    return (info) ;
+}
+
 //------------------------------------------------------------------------------
 //------------ Free routines----------------------------------------------------
 //------------------------------------------------------------------------------
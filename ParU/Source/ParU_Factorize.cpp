@@ -116,6 +116,8 @@ ParU_Info ParU_Factorize
     Work->piv_toler        = PARU_DEFAULT_PIVOT_TOLERANCE ;
     Work->diag_toler       = PARU_DEFAULT_DIAG_PIVOT_TOLERANCE ;
     Work->prescale         = PARU_DEFAULT_PRESCALE ;
+    Work->numa_domains     = PARU_DEFAULT_NUMA_DOMAINS ;
+    Work->task_owner       = NULL ;
     if (Control != NULL)
     {
         Work->mem_chunk        = Control->mem_chunk ;
@@ -126,6 +128,7 @@ ParU_Info ParU_Factorize
         Work->piv_toler        = Control->piv_toler ;
         Work->diag_toler       = Control->diag_toler ;
         Work->prescale         = Control->prescale ;
+        Work->numa_domains     = Control->numa_domains ;
     }
 
     int32_t nthreads = Work->nthreads ;
@@ -231,56 +234,67 @@ ParU_Info ParU_Factorize
 #endif
         BLAS_set_num_threads(1);
         PARU_OPENMP_SET_MAX_ACTIVE_LEVELS(4);
-        const int64_t size = (int64_t)task_Q.size();
-        const int64_t steps = size == 0 ? 1 : size;
-        const int64_t stages = size / steps + 1;
-        int64_t chain_task = -1;
-        int64_t start = 0;
-        PRLEVEL( 1, ("%% size=" LD ", steps =" LD ", stages =" LD "\n",
-            size, steps, stages));
-
-        for (int64_t ii = 0; ii < stages; ii++)
+        if (Work->numa_domains > 1)
         {
-            if (start >= size) break;
-            int64_t end = start + steps > size ? size : start + steps;
-            PRLEVEL(1, ("%% doing Queue tasks <" LD "," LD ">\n", start, end));
-            #pragma omp parallel proc_bind(spread) num_threads(nthreads)
-            #pragma omp single nowait
-            #pragma omp task untied
-            for (int64_t i = start; i < end; i++)
+            // map subtrees of the task tree to the NUMA domains
+            PRLEVEL(1, ("NUMA-aware, " LD " domains\n", Work->numa_domains));
+            info = paru_exec_tasks_numa(Work->numa_domains, task_num_child,
+                Work, Sym, Num);
+        }
+        else
+        {
+            const int64_t size = (int64_t)task_Q.size();
+            const int64_t steps = size == 0 ? 1 : size;
+            const int64_t stages = size / steps + 1;
+            int64_t chain_task = -1;
+            int64_t start = 0;
+            PRLEVEL( 1, ("%% size=" LD ", steps =" LD ", stages =" LD "\n",
+                size, steps, stages));
+
+            for (int64_t ii = 0; ii < stages; ii++)
             {
-                int64_t t = task_Q[i];
-                int64_t d = task_depth[t];
-                #pragma omp task mergeable priority(d)
+                if (start >= size) break;
+                int64_t end = start + steps > size ? size : start + steps;
+                PRLEVEL(1, ("%% doing Queue tasks <" LD "," LD ">\n",
+                    start, end));
+                #pragma omp parallel proc_bind(spread) num_threads(nthreads)
+                #pragma omp single nowait
+                #pragma omp task untied
+                for (int64_t i = start; i < end; i++)
                 {
-                    #pragma omp atomic update
-                    Work->naft++;
-
-                    ParU_Info myInfo =
-                        paru_exec_tasks(t, task_num_child, chain_task, Work,
-                            Sym, Num);
-                    if (myInfo != PARU_SUCCESS)
+                    int64_t t = task_Q[i];
+                    int64_t d = task_depth[t];
+                    #pragma omp task mergeable priority(d)
                     {
-                        #pragma omp atomic write
-                        info = myInfo;
+                        #pragma omp atomic update
+                        Work->naft++;
+
+                        ParU_Info myInfo =
+                            paru_exec_tasks(t, task_num_child, chain_task,
+                                Work, Sym, Num);
+                        if (myInfo != PARU_SUCCESS)
+                        {
+                            #pragma omp atomic write
+                            info = myInfo;
+                        }
+                        #pragma omp atomic update
+                        Work->naft--;
+
+                        #pragma omp atomic update
+                        Work->resq--;
                     }
-                    #pragma omp atomic update
-                    Work->naft--;
-
-                    #pragma omp atomic update
-                    Work->resq--;
                 }
+                start += steps;
+            }
+            // chain break
+            if (chain_task != -1 && info == PARU_SUCCESS)
+            {
+                #pragma omp atomic write
+                Work->naft = 1;
+                PRLEVEL(1, ("Chain_taskd " LD " has remained\n", chain_task));
+                info = paru_exec_tasks_seq(chain_task, task_num_child, Work,
+                    Sym, Num);
             }
-            start += steps;
-        }
-        // chain break
-        if (chain_task != -1 && info == PARU_SUCCESS)
-        {
-            #pragma omp atomic write
-            Work->naft = 1;
-            PRLEVEL(1, ("Chain_taskd " LD " has remained\n", chain_task));
-            info = paru_exec_tasks_seq(chain_task, task_num_child, Work,
-                Sym, Num);
         }
         if (info != PARU_SUCCESS)
         {
@@ -37,6 +37,19 @@ ParU_Info ParU_FreeNumeric
 
     int64_t nf = Num->nf;
 
+    if (Num->view)
+    {
+        // the arrays are held in the blob given to ParU_Deserialize; only the
+        // lists of pointers to the fronts are owned by Num
+        PARU_FREE(nf, int64_t *, Num->frowList);
+        PARU_FREE(nf, int64_t *, Num->fcolList);
+        PARU_FREE(nf, ParU_Factors, Num->partial_LUs) ;
+        PARU_FREE(nf, ParU_Factors, Num->partial_Us) ;
+        PARU_FREE(1, ParU_Numeric_struct, Num);
+        (*Num_handle) = NULL ;
+        return (PARU_SUCCESS) ;
+    }
+
     // freeing the numerical input
     PARU_FREE(Num->snz, double, Num->Sx);
     if (Num->sunz > 0)
@@ -36,6 +36,14 @@ ParU_Info ParU_FreeSymbolic
     ParU_Symbolic Sym ;
     Sym = *Sym_handle;
 
+    if (Sym->view)
+    {
+        // the arrays are held in the blob given to ParU_Deserialize
+        PARU_FREE(1, ParU_Symbolic_struct, Sym);
+        (*Sym_handle) = NULL;
+        return (PARU_SUCCESS) ;
+    }
+
     int64_t m = Sym->m;
     int64_t n = Sym->n;
     int64_t n1 = Sym->n1;
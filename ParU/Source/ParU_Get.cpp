@@ -323,6 +323,11 @@ ParU_Info ParU_Get          // get an int64_t parameter from the Control object
                 Control->mem_chunk ;
             break ;
 
+        case PARU_CONTROL_NUMA_DOMAINS:           // # of NUMA domains to use
+            (*c) = (Control == NULL) ? PARU_DEFAULT_NUMA_DOMAINS :
+                Control->numa_domains ;
+            break ;
+
         default:
             return (PARU_INVALID) ;
             break ;
@@ -48,6 +48,7 @@ ParU_Info ParU_InitControl
     Control->prescale               = PARU_DEFAULT_PRESCALE ;
     Control->filter_singletons      = PARU_DEFAULT_SINGLETONS ;
     Control->mem_chunk              = PARU_DEFAULT_MEM_CHUNK ;
+    Control->numa_domains           = PARU_DEFAULT_NUMA_DOMAINS ;
     Control->piv_toler              = PARU_DEFAULT_PIVOT_TOLERANCE ;
     Control->diag_toler             = PARU_DEFAULT_DIAG_PIVOT_TOLERANCE ;
 
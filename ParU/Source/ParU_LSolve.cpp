@@ -29,7 +29,8 @@
  *
  *     This function just goes through LUs in the data structure and does a
  *     TRSV on triangular part
- *     Then does DGEMV on the rest for 0 to nf
+ *     Then does DGEMV on the rest for 0 to nf.  The fronts are done by
+ *     paru_tasked_lsolve, in parallel over the task tree if possible.
  *
  *           BLAS_DTRSV  is used here but I do not use BLAS_DGEMV explicitly
  *           while it needs space for each thread doing this computation.
@@ -55,7 +56,7 @@ ParU_Info ParU_LSolve
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !x)
+    if (!Sym || !Num || !x || Num->res != PARU_SUCCESS)
     {
         return (PARU_INVALID) ;
     }
@@ -65,8 +66,6 @@ ParU_Info ParU_LSolve
 
     DEBUGLEVEL(0);
     PARU_DEFINE_PRLEVEL;
-    int64_t nf = Sym->nf;
-    bool blas_ok = true ;
 #ifndef NDEBUG
     int64_t m = Sym->m;
     PRLEVEL(1, ("%%inside lsolve x is:\n%%"));
@@ -120,83 +119,8 @@ ParU_Info ParU_LSolve
     PRLEVEL(1, (" \n"));
 #endif
 
-    // gather scatter space for dgemm
-    double *work = PARU_MALLOC (Num->max_row_count, double);
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory lsolve\n"));
-        return (PARU_OUT_OF_MEMORY) ;
-    }
-
-    const ParU_Factors *LUs = Num->partial_LUs;
-    const int64_t *Super = Sym->Super;
-
-    for (int64_t f = 0; f < nf; f++)
-    {
-        int64_t rowCount = Num->frowCount[f];
-        const int64_t *frowList = Num->frowList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        double *A = LUs[f].p;
-        double *X = x + col1 + n1;
-
-        PRLEVEL(2, ("%% Working on DTRSV\n"));
-        SUITESPARSE_BLAS_dtrsv("L", "N", "U", fp, A, rowCount, X, 1, blas_ok);
-        PRLEVEL(2, ("%% DTRSV is just finished\n"));
-
-#ifndef NDEBUG
-        PR = 2;
-        PRLEVEL(PR, ("%% LUs:\n%%"));
-        for (int64_t r = 0; r < rowCount; r++)
-        {
-            PRLEVEL(PR, ("%% " LD "\t", frowList[r]));
-            for (int64_t c = col1; c < col2; c++)
-                PRLEVEL(PR, (" %2.5lf\t", A[(c - col1) * rowCount + r]));
-            PRLEVEL(PR, ("\n"));
-        }
-
-        PRLEVEL(PR, ("%% lda = " LD "\n%%", rowCount));
-        PRLEVEL(PR, ("%% during lsolve x [" LD "-" LD ")is:\n%%", col1, col2));
-        // for (int64_t k = col1; k < col2; k++)
-        int64_t m = Sym->m;
-        for (int64_t k = 0; k < m; k++)
-        {
-            PRLEVEL(PR, (" %.2lf, ", x[k]));
-        }
-        PRLEVEL(PR, (" \n"));
-#endif
-
-        if (rowCount > fp)
-        {
-            PRLEVEL(2, ("%% lsolve: Working on DGEMV\n%%"));
-            PRLEVEL(2, ("fp=" LD "  rowCount=" LD "\n", fp, rowCount));
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemv("N", rowCount - fp, fp, &alpha, A + fp,
-                                   rowCount, x + n1 + col1, 1, &beta, work, 1,
-                                   blas_ok);
-        }
-
-        // don't use parallel loop if using dgemv
-        // pragma omp parallel for
-        for (int64_t i = fp; i < rowCount; i++)
-        {
-            // alternative to dgemv; do not need work if using this
-            // computing the inner product
-            // double i_prod = 0.0;  // inner product
-            // for (int64_t j = col1; j < col2; j++)
-            //{
-            //    i_prod += A[(j - col1) * rowCount + i] * x[j + n1];
-            //}
-
-            double i_prod = work[i - fp];
-            int64_t r = Ps[frowList[i]] + n1;
-            PRLEVEL(2, ("i_prod[" LD "]=%lf  work=%lf r=" LD "\n", i, i_prod,
-                        work[i - fp], r));
-            x[r] -= i_prod;
-        }
-    }
+    // the fronts, in parallel if the task tree allows it
+    ParU_Info info = paru_tasked_lsolve (1, x, Sym, Num, Control) ;
 #ifndef NTIME
     double time = PARU_OPENMP_GET_WTIME;
     time -= start_time;
@@ -210,8 +134,7 @@ ParU_Info ParU_LSolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_row_count, double, work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return (info) ;
 }
 
 //------------------------------------------------------------------------------
@@ -231,7 +154,7 @@ ParU_Info ParU_LSolve
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !X)
+    if (!Sym || !Num || !X || Num->res != PARU_SUCCESS)
     {
         return (PARU_INVALID) ;
     }
@@ -242,8 +165,6 @@ ParU_Info ParU_LSolve
     DEBUGLEVEL(0);
     PARU_DEFINE_PRLEVEL;
     int64_t m = Sym->m;
-    int64_t nf = Sym->nf;
-    bool blas_ok = true ;
 
 #ifndef NDEBUG
     PR = 2;
@@ -316,89 +237,8 @@ ParU_Info ParU_LSolve
     PRLEVEL(PR, (" \n"));
 #endif
 
-    // gather scatter space for dgemm
-    double *work = PARU_MALLOC (Num->max_row_count * nrhs, double);
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory lsolve\n"));
-        return (PARU_OUT_OF_MEMORY) ;
-    }
-
-    const ParU_Factors *LUs = Num->partial_LUs;
-    const int64_t *Super = Sym->Super;
-
-    for (int64_t f = 0; f < nf; f++)
-    {
-        int64_t rowCount = Num->frowCount[f];
-        const int64_t *frowList = Num->frowList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        double *A = LUs[f].p;
-        PRLEVEL(2, ("%% mRHS Working on DTRSM f=" LD "\n", f));
-        double alpha = 1;
-        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", fp, nrhs, &alpha, A,
-            rowCount, X + n1 + col1, m, blas_ok);
-        PRLEVEL(2, ("%% mRHS DTRSM is just finished f=" LD "\n", f));
-#ifndef NDEBUG
-        PR = 2;
-        PRLEVEL(PR, ("%% LUs:\n%%"));
-        for (int64_t r = 0; r < rowCount; r++)
-        {
-            PRLEVEL(PR, ("%% " LD "\t", frowList[r]));
-            for (int64_t c = col1; c < col2; c++)
-                PRLEVEL(PR, (" %2.5lf\t", A[(c - col1) * rowCount + r]));
-            PRLEVEL(PR, ("\n"));
-        }
-
-        PRLEVEL(PR, ("%% lda = " LD "\n%%", rowCount));
-        PR = 1;
-        PRLEVEL(PR, ("%% during lsolve X f=" LD "[" LD "-" LD
-            ")is:\n%%", f, col1, col2));
-        for (int64_t k = 0; k < m; k++)
-        {
-            PRLEVEL(1, ("%%"));
-            for (int64_t l = 0; l < nrhs; l++)
-            {
-                PRLEVEL(1, (" %.2lf, ", X[l * m + k]));
-            }
-            PRLEVEL(1, (" \n"));
-        }
-        PRLEVEL(1, (" \n"));
-#endif
-
-        if (rowCount > fp)
-        {
-            PRLEVEL(2, ("%% mRHS lsolve: Working on DGEMM\n%%"));
-            PRLEVEL(2, ("fp=" LD "  rowCount=" LD "\n", fp, rowCount));
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemm("N", "N", rowCount - fp, nrhs, fp, &alpha,
-                                   A + fp, rowCount, X + n1 + col1, m, &beta,
-                                   work, rowCount - fp, blas_ok);
-        }
-
-        // don't use parallel loop if using dgemm
-        // pragma omp parallel for
-        for (int64_t i = fp; i < rowCount; i++)
-        {
-            // alternative to dgemm; do not need work if using this
-            // computing the inner product
-            // double i_prod[nrhs] = {0.0};  // inner product
-            // for (int64_t j = col1; j < col2; j++)
-            //{
-            //    for (int64_t l = 0; l < nrhs; l++)
-            //        i_prod[l] += A[(j - col1) * rowCount + i] * X[l*m +j+n1];
-            //}
-
-            // double* i_prod = work+i-fp;
-            int64_t r = Ps[frowList[i]] + n1;
-            for (int64_t l = 0; l < nrhs; l++)
-            {
-                X[l * m + r] -= work[i - fp + l * (rowCount - fp)];
-                // X[l*m+r] -= i_prod[l];
-            }
-        }
-    }
+    // the fronts, in parallel if the task tree allows it
+    ParU_Info info = paru_tasked_lsolve (nrhs, X, Sym, Num, Control) ;
 #ifndef NTIME
     double time = PARU_OPENMP_GET_WTIME;
     time -= start_time;
@@ -417,6 +257,5 @@ ParU_Info ParU_LSolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_row_count * nrhs, double, work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return (info) ;
 }
@@ -0,0 +1,594 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  ParU_Refactorize ///////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief    refactorize a matrix with the same pattern as the one factorized
+ *      in Num, reusing its row permutation and the structure of its fronts.
+ *
+ *      The row and column lists of each front (frowList, fcolList) and the
+ *      final row permutation Ps are kept from ParU_Factorize.  No pivot
+ *      search, row degree or tuple list bookkeeping is done; each front is
+ *      computed with dense kernels only:
+ *
+ *          (1) the entries of S are added into the fronts that hold them,
+ *          (2) for each front f, in order:
+ *              [L1,U1] = LU factorization of the pivot columns, in place and
+ *                        with the pivot order of the original factorization
+ *              U2 = L1 \ U2
+ *              the Schur complement L2*U2 is subtracted from the later fronts
+ *                        that hold each of its entries.
+ *
+ *      Since all rows of a front that can hold a pivot are kept in the front,
+ *      each pivot is compared with the largest entry in its column, with the
+ *      same tolerance the numeric factorization uses to accept a pivot.  This
+ *      bounds the growth of the entries of L and U as in ParU_Factorize.
+ *
+ *      ParU_Factorize leaves a row out of a front if its entries in the pivot
+ *      columns are numerically zero, so the fronts may not hold every entry
+ *      of the factors of the new matrix.  Such entries are collected aside,
+ *      and must again be zero, up to the roundoff of their updates or of an
+ *      update the size of the largest entry of S, once all their updates are
+ *      added.  Leaving out an entry is the same as changing the matching
+ *      entry of S by its value, so the factors are still those of a matrix
+ *      within roundoff of S.  If a pivot fails the test or one of these
+ *      entries is larger, PARU_PIVOT_FAILED is returned and Num cannot be
+ *      used to solve a system; ParU_Factorize must be used instead (or
+ *      ParU_Refactorize again, with another matrix of the same pattern).
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+#include <cfloat>
+#include <vector>
+
+#include "paru_internal.hpp"
+
+#define FREE_WORK                                           \
+{                                                           \
+    PARU_FREE (ns, int64_t, colfront);                      \
+    PARU_FREE (m + 1, int64_t, Rp);                         \
+    PARU_FREE (rnz, int64_t, Rf);                           \
+    PARU_FREE (rnz, int64_t, Ri);                           \
+    PARU_FREE (ns + 1, int64_t, Cp);                        \
+    PARU_FREE (cnz, int64_t, Cf);                           \
+    PARU_FREE (cnz, int64_t, Cj);                           \
+    PARU_FREE (wsize, double, work);                        \
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_find: find a front in the sorted list of fronts of a row/col
+//------------------------------------------------------------------------------
+
+static inline int64_t paru_refactor_find
+(
+    const int64_t *Lf,      // list of fronts, sorted
+    int64_t p1,             // list is Lf [p1...p2-1]
+    int64_t p2,
+    int64_t g               // front to find
+)
+{
+    const int64_t *p = std::lower_bound(Lf + p1, Lf + p2, g);
+    return ((p < Lf + p2 && *p == g) ? (p - Lf) : -1);
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_add: add x to the entry (r,c) of S in the fronts
+//------------------------------------------------------------------------------
+
+// The entry in row r and column c of S is held in L if c comes before the
+// pivot of row r, in the front where c is pivotal.  Otherwise it is held in U,
+// in the front where row r is pivotal.  Returns false if the entry is not in
+// the pattern of the fronts.
+
+struct paru_refactor_entry
+{
+    int64_t r, c;   // an entry of S not held in the fronts
+    double x;
+    double err;     // the roundoff in x is at most err * DBL_EPSILON
+};
+
+// paru_refactor_drop: save an entry not held in the fronts; returns false if
+// out of memory
+
+static bool paru_refactor_drop
+(
+    std::vector<paru_refactor_entry> &dropped,
+    const paru_refactor_entry &e
+)
+{
+    try
+    {
+        dropped.push_back(e);
+    }
+    catch (std::bad_alloc const &)
+    {
+        return (false);
+    }
+    return (true);
+}
+
+static inline bool paru_refactor_add
+(
+    int64_t r,
+    int64_t c,
+    double x,
+    const int64_t *colfront,    // colfront [c] is the front where c is pivotal
+    const int64_t *Rp,          // the fronts that hold row r are
+    const int64_t *Rf,          //      Rf [Rp [r] ... Rp [r+1]-1], and r is
+    const int64_t *Ri,          //      at Ri [...] in their frowList
+    const int64_t *Cp,          // the fronts that hold column c in their
+    const int64_t *Cf,          //      fcolList are Cf [Cp [c] ... Cp [c+1]-1],
+    const int64_t *Cj,          //      at Cj [...]
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    const int64_t *Super = Sym->Super;
+    int64_t pr = Num->Ps[r];    // row r is the pivot of column pr
+    if (c < pr)
+    {
+        // entry of L
+        int64_t g = colfront[c];
+        int64_t p = paru_refactor_find(Rf, Rp[r], Rp[r + 1], g);
+        if (p < 0) return (false);
+        int64_t rowCount = Num->frowCount[g];
+        Num->partial_LUs[g].p[(c - Super[g]) * rowCount + Ri[p]] += x;
+    }
+    else
+    {
+        // entry of U
+        int64_t g = colfront[pr];
+        int64_t col1 = Super[g];
+        int64_t col2 = Super[g + 1];
+        int64_t i = pr - col1;
+        if (c < col2)
+        {
+            int64_t rowCount = Num->frowCount[g];
+            Num->partial_LUs[g].p[(c - col1) * rowCount + i] += x;
+        }
+        else
+        {
+            int64_t p = paru_refactor_find(Cf, Cp[c], Cp[c + 1], g);
+            if (p < 0) return (false);
+            int64_t fp = col2 - col1;
+            Num->partial_Us[g].p[Cj[p] * fp + i] += x;
+        }
+    }
+    return (true);
+}
+
+//------------------------------------------------------------------------------
+// paru_refactor_panel: LU factorization of the pivot columns of a front
+//------------------------------------------------------------------------------
+
+// F is rowCount-by-fp with leading dimension rowCount, factorized in place
+// without pivoting, one panel of columns at a time.  Each pivot must be at
+// least tol times the largest entry in its column.
+
+static ParU_Info paru_refactor_panel
+(
+    double *F,
+    int64_t rowCount,
+    int64_t fp,
+    int64_t panel_width,
+    double tol,
+    bool &blas_ok
+)
+{
+    DEBUGLEVEL(0);
+    double one = 1;
+    double minus_one = -1;
+    for (int64_t j1 = 0; j1 < fp; j1 += panel_width)
+    {
+        int64_t j2 = std::min(j1 + panel_width, fp);
+
+        // factorize the columns j1:j2-1 of the panel
+        for (int64_t j = j1; j < j2; j++)
+        {
+            double *Fj = F + j * rowCount;
+            double piv = Fj[j];
+            double maxval = 0;
+            for (int64_t i = j; i < rowCount; i++)
+            {
+                maxval = std::max(maxval, fabs(Fj[i]));
+            }
+            if (maxval == 0 || fabs(piv) < tol * maxval)
+            {
+                PRLEVEL(1, ("%% refactorize: pivot %e rejected, max %e\n",
+                    piv, maxval));
+                return (PARU_PIVOT_FAILED);
+            }
+            for (int64_t i = j + 1; i < rowCount; i++)
+            {
+                Fj[i] /= piv;
+            }
+            if (j + 1 < j2)
+            {
+                SUITESPARSE_BLAS_dger(rowCount - j - 1, j2 - j - 1, &minus_one,
+                    Fj + j + 1, 1, F + (j + 1) * rowCount + j, rowCount,
+                    F + (j + 1) * rowCount + j + 1, rowCount, blas_ok);
+            }
+        }
+
+        // update the columns to the right of the panel
+        if (j2 < fp)
+        {
+            SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", j2 - j1, fp - j2, &one,
+                F + j1 * rowCount + j1, rowCount, F + j2 * rowCount + j1,
+                rowCount, blas_ok);
+            SUITESPARSE_BLAS_dgemm("N", "N", rowCount - j2, fp - j2, j2 - j1,
+                &minus_one, F + j1 * rowCount + j2, rowCount,
+                F + j2 * rowCount + j1, rowCount, &one,
+                F + j2 * rowCount + j2, rowCount, blas_ok);
+        }
+    }
+    return (PARU_SUCCESS);
+}
+
+//------------------------------------------------------------------------------
+// ParU_Refactorize: refactorize a sparse matrix A with the pivots of Num
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Refactorize
+(
+    // input:
+    cholmod_sparse *A,          // input matrix to factorize
+    const ParU_Symbolic Sym,    // symbolic analsys from ParU_Analyze
+    // input/output:
+    ParU_Numeric Num,           // numeric factorization from ParU_Factorize
+    // control:
+    ParU_Control Control
+)
+{
+    if (!A || !Sym || !Num ||
+        A->xtype != CHOLMOD_REAL || A->dtype != CHOLMOD_DOUBLE ||
+        Num->sym_m != Sym->m || Num->nf != Sym->nf)
+    {
+        return (PARU_INVALID) ;
+    }
+
+    DEBUGLEVEL(0);
+#ifndef NTIME
+    double my_start_time = PARU_OPENMP_GET_WTIME;
+#endif
+
+    // get Control
+    int32_t nthreads = paru_nthreads (Control) ;
+    size_t mem_chunk = PARU_DEFAULT_MEM_CHUNK ;
+    int64_t panel_width = PARU_DEFAULT_PANEL_WIDTH ;
+    double piv_toler = PARU_DEFAULT_PIVOT_TOLERANCE ;
+    double diag_toler = PARU_DEFAULT_DIAG_PIVOT_TOLERANCE ;
+    int32_t prescale = PARU_DEFAULT_PRESCALE ;
+    if (Control != NULL)
+    {
+        mem_chunk   = Control->mem_chunk ;
+        panel_width = Control->panel_width ;
+        piv_toler   = Control->piv_toler ;
+        diag_toler  = Control->diag_toler ;
+        prescale    = Control->prescale ;
+    }
+    double tol = (Sym->strategy_used == PARU_STRATEGY_SYMMETRIC) ?
+        std::min(piv_toler, diag_toler) : piv_toler ;
+
+    int64_t nf = Sym->nf;
+    int64_t n1 = Sym->n1;
+    int64_t m = Sym->m - n1;    // S is m-by-ns
+    int64_t ns = Sym->n - n1;
+    const int64_t *Super = Sym->Super;
+
+    // workspace:
+    int64_t *colfront = NULL;
+    int64_t *Rp = NULL, *Rf = NULL, *Ri = NULL;
+    int64_t *Cp = NULL, *Cf = NULL, *Cj = NULL;
+    double *work = NULL;
+    int64_t rnz = 0, cnz = 0, maxfp = 1;
+    size_t wsize = 0;
+
+    //--------------------------------------------------------------------------
+    // get the numerical values of S and the singletons
+    //--------------------------------------------------------------------------
+
+    bool prescaling = (prescale != PARU_PRESCALE_NONE) ;
+    if (Num->view && prescaling != (Num->Rs != NULL))
+    {
+        // the arrays of Num are in a blob from ParU_Deserialize, and Num->Rs
+        // cannot be allocated or freed
+        return (PARU_INVALID) ;
+    }
+
+    // From here on, Num is not a valid factorization until this method
+    // succeeds.
+    Num->res = PARU_INVALID;
+    if (prescaling && Num->Rs == NULL)
+    {
+        Num->Rs = PARU_CALLOC (Sym->m, double);
+        if (Num->Rs == NULL)
+        {
+            return (PARU_OUT_OF_MEMORY) ;
+        }
+    }
+    else if (!prescaling && Num->Rs != NULL)
+    {
+        PARU_FREE (Sym->m, double, Num->Rs);
+        Num->Rs = NULL;
+    }
+
+    ParU_Info info = paru_init_values(Num, A, Sym, prescale, true, mem_chunk,
+        nthreads);
+    if (info != PARU_SUCCESS)
+    {
+        Num->res = info;
+        return (info) ;
+    }
+
+    // the singletons are pivots of the factorization as well
+    for (int64_t i = 0; i < Sym->cs1; i++)
+    {
+        if (Num->Sux[Sym->ustons.Sup[i]] == 0)
+        {
+            Num->res = PARU_PIVOT_FAILED;
+            return (PARU_PIVOT_FAILED) ;
+        }
+    }
+    for (int64_t j = 0; j < Sym->rs1; j++)
+    {
+        if (Num->Slx[Sym->lstons.Slp[j]] == 0)
+        {
+            Num->res = PARU_PIVOT_FAILED;
+            return (PARU_PIVOT_FAILED) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find where each row and column of S is held in the fronts
+    //--------------------------------------------------------------------------
+
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t fp = Super[f + 1] - Super[f];
+        int64_t rowCount = Num->frowCount[f];
+        int64_t colCount = Num->fcolCount[f];
+        rnz += rowCount;
+        cnz += colCount;
+        maxfp = std::max(maxfp, fp);
+        wsize = std::max(wsize, (size_t) ((rowCount - fp) * colCount));
+    }
+
+    colfront = PARU_MALLOC (ns, int64_t);
+    Rp = PARU_CALLOC (m + 1, int64_t);
+    Rf = PARU_MALLOC (rnz, int64_t);
+    Ri = PARU_MALLOC (rnz, int64_t);
+    Cp = PARU_CALLOC (ns + 1, int64_t);
+    Cf = PARU_MALLOC (cnz, int64_t);
+    Cj = PARU_MALLOC (cnz, int64_t);
+    work = PARU_MALLOC (wsize, double);
+    if (colfront == NULL || Rp == NULL || Rf == NULL || Ri == NULL ||
+        Cp == NULL || Cf == NULL || Cj == NULL || work == NULL)
+    {
+        PRLEVEL(1, ("ParU: out of memory, refactorize\n"));
+        FREE_WORK;
+        Num->res = PARU_OUT_OF_MEMORY;
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+
+    for (int64_t f = 0; f < nf; f++)
+    {
+        for (int64_t c = Super[f]; c < Super[f + 1]; c++)
+        {
+            colfront[c] = f;
+        }
+        const int64_t *frowList = Num->frowList[f];
+        for (int64_t i = 0; i < Num->frowCount[f]; i++)
+        {
+            Rp[frowList[i] + 1]++;
+        }
+        const int64_t *fcolList = Num->fcolList[f];
+        for (int64_t j = 0; j < Num->fcolCount[f]; j++)
+        {
+            Cp[fcolList[j] + 1]++;
+        }
+    }
+    for (int64_t r = 0; r < m; r++) Rp[r + 1] += Rp[r];
+    for (int64_t c = 0; c < ns; c++) Cp[c + 1] += Cp[c];
+    for (int64_t f = 0; f < nf; f++)
+    {
+        // the fronts of each row and column are sorted since f is ascending
+        const int64_t *frowList = Num->frowList[f];
+        for (int64_t i = 0; i < Num->frowCount[f]; i++)
+        {
+            int64_t p = Rp[frowList[i]]++;
+            Rf[p] = f;
+            Ri[p] = i;
+        }
+        const int64_t *fcolList = Num->fcolList[f];
+        for (int64_t j = 0; j < Num->fcolCount[f]; j++)
+        {
+            int64_t p = Cp[fcolList[j]]++;
+            Cf[p] = f;
+            Cj[p] = j;
+        }
+    }
+    for (int64_t r = m; r > 0; r--) Rp[r] = Rp[r - 1];
+    for (int64_t c = ns; c > 0; c--) Cp[c] = Cp[c - 1];
+    Rp[0] = 0;
+    Cp[0] = 0;
+
+    //--------------------------------------------------------------------------
+    // assemble S into the fronts
+    //--------------------------------------------------------------------------
+
+    ParU_Factors *LUs = Num->partial_LUs;
+    ParU_Factors *Us = Num->partial_Us;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t fp = Super[f + 1] - Super[f];
+        paru_memset(LUs[f].p, 0, Num->frowCount[f] * fp * sizeof(double),
+            mem_chunk, nthreads);
+        if (Us[f].p != NULL)
+        {
+            paru_memset(Us[f].p, 0, Num->fcolCount[f] * fp * sizeof(double),
+                mem_chunk, nthreads);
+        }
+    }
+
+    // entries not held in the fronts
+    std::vector<paru_refactor_entry> dropped;
+
+    const int64_t *Sp = Sym->Sp;
+    const int64_t *Sj = Sym->Sj;
+    const double *Sx = Num->Sx;
+    double smax = 0;
+    for (int64_t r = 0; r < m && info == PARU_SUCCESS; r++)
+    {
+        for (int64_t p = Sp[r]; p < Sp[r + 1]; p++)
+        {
+            smax = std::max(smax, fabs(Sx[p]));
+            if (!paru_refactor_add(r, Sj[p], Sx[p], colfront, Rp, Rf, Ri,
+                Cp, Cf, Cj, Sym, Num))
+            {
+                if (!paru_refactor_drop(dropped,
+                    {r, Sj[p], Sx[p], fabs(Sx[p])}))
+                {
+                    info = PARU_OUT_OF_MEMORY;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // factorize each front and update the later fronts
+    //--------------------------------------------------------------------------
+
+    BLAS_set_num_threads(nthreads);
+    bool blas_ok = true;
+    double one = 1;
+    double zero = 0;
+    for (int64_t f = 0; f < nf && info == PARU_SUCCESS; f++)
+    {
+        int64_t fp = Super[f + 1] - Super[f];
+        int64_t rowCount = Num->frowCount[f];
+        int64_t colCount = Num->fcolCount[f];
+        double *F = LUs[f].p;
+
+        // [L1,U1] and L2
+        info = paru_refactor_panel(F, rowCount, fp, panel_width, tol, blas_ok);
+        if (info != PARU_SUCCESS || colCount == 0) continue;
+
+        // U2 = L1 \ U2
+        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", fp, colCount, &one, F,
+            rowCount, Us[f].p, fp, blas_ok);
+        if (rowCount == fp) continue;
+
+        // subtract L2*U2 from the later fronts
+        int64_t cbm = rowCount - fp;
+        SUITESPARSE_BLAS_dgemm("N", "N", cbm, colCount, fp, &one, F + fp,
+            rowCount, Us[f].p, fp, &zero, work, cbm, blas_ok);
+        const int64_t *frowList = Num->frowList[f];
+        const int64_t *fcolList = Num->fcolList[f];
+        for (int64_t j = 0; j < colCount; j++)
+        {
+            int64_t c = fcolList[j];
+            for (int64_t i = 0; i < cbm; i++)
+            {
+                double x = work[j * cbm + i];
+                int64_t r = frowList[fp + i];
+                if (x != 0 && !paru_refactor_add(r, c, -x, colfront, Rp, Rf, Ri,
+                    Cp, Cf, Cj, Sym, Num))
+                {
+                    // x is a dot product of length fp
+                    double err = 0;
+                    for (int64_t k = 0; k < fp; k++)
+                    {
+                        err += fabs(F[k * rowCount + fp + i]) *
+                            fabs(Us[f].p[j * fp + k]);
+                    }
+                    if (!paru_refactor_drop(dropped, {r, c, -x, fp * err}))
+                    {
+                        info = PARU_OUT_OF_MEMORY;
+                    }
+                }
+            }
+        }
+    }
+    FREE_WORK;
+
+    //--------------------------------------------------------------------------
+    // check the entries not held in the fronts
+    //--------------------------------------------------------------------------
+
+    // Each entry must cancel, as it did in ParU_Factorize; otherwise the
+    // fronts do not have room for the factors of this matrix.  An entry that
+    // is only the roundoff of its updates, or of an update the size of the
+    // largest entry of S, can be left out.
+    if (info == PARU_SUCCESS && !dropped.empty())
+    {
+        std::sort(dropped.begin(), dropped.end(),
+            [](const paru_refactor_entry &a, const paru_refactor_entry &b)
+            { return (a.r < b.r || (a.r == b.r && a.c < b.c)); });
+        size_t ndropped = dropped.size();
+        for (size_t k1 = 0; k1 < ndropped && info == PARU_SUCCESS;)
+        {
+            double sum = 0, errsum = 0;
+            size_t k2 = k1;
+            for (; k2 < ndropped && dropped[k2].r == dropped[k1].r &&
+                dropped[k2].c == dropped[k1].c; k2++)
+            {
+                sum += dropped[k2].x;
+                errsum += dropped[k2].err;
+            }
+            if (fabs(sum) >
+                DBL_EPSILON * std::max((k2 - k1) * errsum, maxfp * smax))
+            {
+                PRLEVEL(1, ("%% refactorize: entry (" LD "," LD ") = %e is not"
+                    " in the fronts\n", dropped[k1].r, dropped[k1].c, sum));
+                info = PARU_PIVOT_FAILED;
+            }
+            k1 = k2;
+        }
+    }
+    if (info == PARU_SUCCESS && !blas_ok)
+    {
+        info = PARU_TOO_LARGE;
+    }
+    if (info != PARU_SUCCESS)
+    {
+        Num->res = info;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update the statistics that depend on the numerical values
+    //--------------------------------------------------------------------------
+
+    double min_udiag = 1, max_udiag = -1;  // not to fail for nf ==0
+    if (nf > 0)
+    {
+        max_udiag = min_udiag = fabs(*(LUs[0].p));
+    }
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t fp = Super[f + 1] - Super[f];
+        int64_t rowCount = Num->frowCount[f];
+        double *X = LUs[f].p;
+        for (int64_t i = 0; i < fp; i++)
+        {
+            double udiag = fabs(X[rowCount * i + i]);
+            min_udiag = std::min(min_udiag, udiag);
+            max_udiag = std::max(max_udiag, udiag);
+        }
+    }
+    Num->min_udiag = min_udiag;
+    Num->max_udiag = max_udiag;
+    Num->rcond = min_udiag / max_udiag;
+    Num->res = PARU_SUCCESS;
+#ifndef NTIME
+    double time = PARU_OPENMP_GET_WTIME;
+    time -= my_start_time;
+    PRLEVEL(1, ("refactorization time took is %lf\n", time));
+#endif
+    return (PARU_SUCCESS) ;
+}
@@ -0,0 +1,895 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  ParU_Serialize /////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief  Serialize a ParU_Symbolic or ParU_Numeric object into a single
+ *          array of bytes (a "blob"), so that it can be saved to a file and
+ *          reused by another process without recomputing it:
+ *
+ *          ParU_SerializeSize  size of the blob, in bytes
+ *          ParU_Serialize      write the blob
+ *          ParU_Deserialize    construct the object from a blob, either by
+ *                              copying it or by using it in place
+ *
+ *  The blob consists of a header (see paru_internal.hpp), a copy of the
+ *  struct with its pointers cleared, and a directory with the offset of each
+ *  array in the blob (zero if the array is not present), followed by the
+ *  arrays themselves.
+ *
+ *  For a ParU_Numeric object, the row and column lists of all fronts are each
+ *  held in a single region, and the LU and U blocks of all the fronts are
+ *  held in one contiguous region at the end of the blob, in the order of the
+ *  fronts.  A table gives the dimensions of each block and its offset in that
+ *  region.  Each block starts at a multiple of PARU_BLOB_ALIGN bytes.
+ *
+ *  If the blob is memory-mapped from a file, and ParU_Deserialize is used
+ *  with view = true, only the structs and the lists of pointers to the fronts
+ *  are allocated; the rest of the object is used directly from the blob, so
+ *  ParU_Solve can start at once, and only the pages it touches are read.  The
+ *  blob must then remain in place until the object is freed.
+ *  ParU_Refactorize writes into the arrays of Num, so the mapping must then be
+ *  writable (private, copy-on-write, if the file is to be kept unchanged).
+ *
+ *  The blob can only be read on a platform with the same sizes of int64_t,
+ *  pointers, and the structs; ParU_Deserialize checks this, and the format
+ *  PARU_BLOB_FORMAT.
+ *
+ * @author Aznaveh
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "paru_internal.hpp"
+
+// one array of a ParU_Symbolic or ParU_Numeric object
+struct paru_blob_array
+{
+    void **p;       // the array is *p, or NULL if not present
+    int64_t n;      // number of entries in *p
+    size_t size;    // size of each entry
+};
+
+// number of arrays in each object, and the number of slots in the directory
+#define PARU_BLOB_SYM_NARRAYS 30
+#define PARU_BLOB_NUM_NARRAYS 8
+#define PARU_BLOB_NUM_NSLOTS (PARU_BLOB_NUM_NARRAYS + 4)
+
+// slots of the directory of a ParU_Numeric object after its arrays
+#define PARU_BLOB_FRONTS  (PARU_BLOB_NUM_NARRAYS)       // table of the fronts
+#define PARU_BLOB_ROWS    (PARU_BLOB_NUM_NARRAYS + 1)   // all frowList
+#define PARU_BLOB_COLS    (PARU_BLOB_NUM_NARRAYS + 2)   // all fcolList
+#define PARU_BLOB_FACTORS (PARU_BLOB_NUM_NARRAYS + 3)   // all LU and U blocks
+
+// number of entries of the table for each front: the dimensions of its LU and
+// U blocks, and their offsets in the factors region (-1 if not present)
+#define PARU_BLOB_NFRONT 6
+
+#define ARRAY(object, count, type)              \
+{                                               \
+    Array[k].p = (void **)&(object);            \
+    Array[k].n = (int64_t)(count);              \
+    Array[k].size = sizeof(type);               \
+    k++;                                        \
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_symbolic_arrays: describe the arrays of a ParU_Symbolic object
+//------------------------------------------------------------------------------
+
+// Only the scalars of Sym are used.
+
+static void paru_blob_symbolic_arrays
+(
+    ParU_Symbolic Sym,
+    paru_blob_array *Array      // size PARU_BLOB_SYM_NARRAYS
+)
+{
+    int k = 0;
+    int64_t m = Sym->m;
+    int64_t n = Sym->n;
+    int64_t nf = Sym->nf;
+    int64_t ms = m - Sym->n1;   // S is ms-by-ns
+    int64_t ns = n - Sym->n1;
+    int64_t ntasks = Sym->ntasks;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
+
+    // the matrix S and its permutations
+    ARRAY(Sym->Qfill, n, int64_t);
+    ARRAY(Sym->Pinit, m, int64_t);
+    ARRAY(Sym->Pinv, m, int64_t);
+    ARRAY(Sym->Diag_map, n, int64_t);
+    ARRAY(Sym->Sp, ms + 1, int64_t);
+    ARRAY(Sym->Sj, Sym->snz, int64_t);
+    ARRAY(Sym->Sleft, ns + 2, int64_t);
+    ARRAY(Sym->ustons.Sup, (cs1 > 0) ? cs1 + 1 : 0, int64_t);
+    ARRAY(Sym->ustons.Suj, (cs1 > 0) ? Sym->ustons.nnz : 0, int64_t);
+    ARRAY(Sym->lstons.Slp, (rs1 > 0) ? rs1 + 1 : 0, int64_t);
+    ARRAY(Sym->lstons.Sli, (rs1 > 0) ? Sym->lstons.nnz : 0, int64_t);
+
+    // the frontal matrices and their tree
+    ARRAY(Sym->Parent, nf + 1, int64_t);
+    ARRAY(Sym->Child, nf + 1, int64_t);
+    ARRAY(Sym->Childp, nf + 2, int64_t);
+    ARRAY(Sym->Depth, nf, int64_t);
+    ARRAY(Sym->aParent, ms + nf, int64_t);
+    ARRAY(Sym->aChild, ms + nf + 1, int64_t);
+    ARRAY(Sym->aChildp, ms + nf + 2, int64_t);
+    ARRAY(Sym->first, nf + 1, int64_t);
+    ARRAY(Sym->Fm, nf + 1, int64_t);
+    ARRAY(Sym->Cm, nf + 1, int64_t);
+    ARRAY(Sym->Super, nf + 1, int64_t);
+    ARRAY(Sym->row2atree, ms, int64_t);
+    ARRAY(Sym->super2atree, nf, int64_t);
+    ARRAY(Sym->front_flop_bound, nf + 1, double);
+    ARRAY(Sym->stree_flop_bound, nf + 1, double);
+
+    // the tasks
+    ARRAY(Sym->task_map, ntasks + 1, int64_t);
+    ARRAY(Sym->task_parent, ntasks, int64_t);
+    ARRAY(Sym->task_num_child, ntasks, int64_t);
+    ARRAY(Sym->task_depth, ntasks, int64_t);
+    ASSERT(k == PARU_BLOB_SYM_NARRAYS);
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_numeric_arrays: describe the arrays of a ParU_Numeric object
+//------------------------------------------------------------------------------
+
+// Only the scalars of Num are used.  The row and column lists and the factors
+// of each front are described by the table of the fronts instead.
+
+static void paru_blob_numeric_arrays
+(
+    ParU_Numeric Num,
+    paru_blob_array *Array      // size PARU_BLOB_NUM_NARRAYS
+)
+{
+    int k = 0;
+    ARRAY(Num->Rs, Num->sym_m, double);
+    ARRAY(Num->Ps, Num->sym_m, int64_t);
+    ARRAY(Num->Pfin, Num->sym_m, int64_t);
+    ARRAY(Num->Sx, Num->snz, double);
+    ARRAY(Num->Sux, Num->sunz, double);
+    ARRAY(Num->Slx, Num->slnz, double);
+    ARRAY(Num->frowCount, Num->nf, int64_t);
+    ARRAY(Num->fcolCount, Num->nf, int64_t);
+    ASSERT(k == PARU_BLOB_NUM_NARRAYS);
+}
+
+#undef ARRAY
+
+//------------------------------------------------------------------------------
+// paru_blob_prefix: size of the header, the struct, and the directory
+//------------------------------------------------------------------------------
+
+static int64_t paru_blob_prefix(size_t struct_size, int32_t nslots)
+{
+    return (PARU_BLOB_HEADER + PARU_BLOB_PAD(struct_size) +
+            PARU_BLOB_PAD(nslots * sizeof(int64_t)));
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_arrays_size: size of the arrays that are present
+//------------------------------------------------------------------------------
+
+static int64_t paru_blob_arrays_size(const paru_blob_array *Array, int narrays)
+{
+    int64_t size = 0;
+    for (int k = 0; k < narrays; k++)
+    {
+        if (*(Array[k].p) != NULL)
+        {
+            size += PARU_BLOB_PAD(Array[k].n * Array[k].size);
+        }
+    }
+    return (size);
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_factors_size: size of the LU and U blocks of the fronts
+//------------------------------------------------------------------------------
+
+static int64_t paru_blob_factors_size(ParU_Numeric Num)
+{
+    int64_t size = 0;
+    for (int64_t f = 0; f < Num->nf; f++)
+    {
+        ParU_Factors *LU = Num->partial_LUs + f;
+        ParU_Factors *U = Num->partial_Us + f;
+        size += PARU_BLOB_PAD(LU->m * LU->n * sizeof(double));
+        if (U->p != NULL)
+        {
+            size += PARU_BLOB_PAD(U->m * U->n * sizeof(double));
+        }
+    }
+    return (size);
+}
+
+//------------------------------------------------------------------------------
+// ParU_SerializeSize: size of the blob for a ParU_Symbolic object
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_SerializeSize
+(
+    // output:
+    int64_t *blobsize,          // size of the blob, in bytes
+    // input:
+    const ParU_Symbolic Sym,    // symbolic analysis to serialize
+    // control:
+    ParU_Control Control
+)
+{
+    if (!blobsize || !Sym)
+    {
+        return (PARU_INVALID) ;
+    }
+    paru_blob_array Array[PARU_BLOB_SYM_NARRAYS];
+    paru_blob_symbolic_arrays(Sym, Array);
+    (*blobsize) =
+        paru_blob_prefix(sizeof(ParU_Symbolic_struct), PARU_BLOB_SYM_NARRAYS) +
+        paru_blob_arrays_size(Array, PARU_BLOB_SYM_NARRAYS);
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_SerializeSize: size of the blob for a ParU_Numeric object
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_SerializeSize
+(
+    // output:
+    int64_t *blobsize,          // size of the blob, in bytes
+    // input:
+    const ParU_Numeric Num,     // numeric factorization to serialize
+    // control:
+    ParU_Control Control
+)
+{
+    if (!blobsize || !Num || Num->res != PARU_SUCCESS)
+    {
+        return (PARU_INVALID) ;
+    }
+    paru_blob_array Array[PARU_BLOB_NUM_NARRAYS];
+    paru_blob_numeric_arrays(Num, Array);
+    int64_t size =
+        paru_blob_prefix(sizeof(ParU_Numeric_struct), PARU_BLOB_NUM_NSLOTS) +
+        paru_blob_arrays_size(Array, PARU_BLOB_NUM_NARRAYS);
+    int64_t nf = Num->nf;
+    int64_t rows = 0, cols = 0;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        rows += Num->frowCount[f];
+        cols += Num->fcolCount[f];
+    }
+    size += PARU_BLOB_PAD(PARU_BLOB_NFRONT * nf * sizeof(int64_t));
+    size += PARU_BLOB_PAD(rows * sizeof(int64_t));
+    size += PARU_BLOB_PAD(cols * sizeof(int64_t));
+    size += paru_blob_factors_size(Num);
+    (*blobsize) = size;
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_header: write the header of a blob
+//------------------------------------------------------------------------------
+
+static void paru_blob_header
+(
+    int8_t *blob,
+    int64_t required,       // size of the blob
+    int32_t kind,           // PARU_BLOB_SYMBOLIC or PARU_BLOB_NUMERIC
+    size_t struct_size,
+    int32_t nslots
+)
+{
+    int32_t h[PARU_BLOB_NHEADER];
+    h[0] = PARU_BLOB_MAGIC;
+    h[1] = PARU_VERSION_MAJOR;
+    h[2] = PARU_VERSION_MINOR;
+    h[3] = PARU_VERSION_UPDATE;
+    h[4] = PARU_BLOB_FORMAT;
+    h[5] = PARU_BLOB_ALIGN;
+    h[6] = sizeof(int64_t);
+    h[7] = sizeof(void *);
+    h[8] = (int32_t)struct_size;
+    h[9] = kind;
+    h[10] = nslots;
+    memset(blob, 0, PARU_BLOB_HEADER);
+    memcpy(blob, &required, sizeof(int64_t));
+    memcpy(blob + sizeof(int64_t), h, PARU_BLOB_NHEADER * sizeof(int32_t));
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_check_header: check the header of a blob
+//------------------------------------------------------------------------------
+
+// Returns the size of the blob as recorded in its header, or -1 if the blob
+// is invalid.
+
+static int64_t paru_blob_check_header
+(
+    const int8_t *blob,
+    int64_t blobsize,
+    bool view,
+    int32_t kind,
+    size_t struct_size,
+    int32_t nslots
+)
+{
+    int64_t prefix = paru_blob_prefix(struct_size, nslots);
+    int64_t required = 0;
+    int32_t h[PARU_BLOB_NHEADER];
+    if (blobsize < prefix)
+    {
+        return (-1);
+    }
+    memcpy(&required, blob, sizeof(int64_t));
+    memcpy(h, blob + sizeof(int64_t), PARU_BLOB_NHEADER * sizeof(int32_t));
+    if (required < prefix || required > blobsize ||
+        h[0] != PARU_BLOB_MAGIC ||
+        h[4] != PARU_BLOB_FORMAT ||
+        h[5] != PARU_BLOB_ALIGN ||
+        h[6] != (int32_t)sizeof(int64_t) ||
+        h[7] != (int32_t)sizeof(void *) ||
+        h[8] != (int32_t)struct_size ||
+        h[9] != kind ||
+        h[10] != nslots ||
+        (view && ((uintptr_t)blob) % sizeof(double) != 0))
+    {
+        return (-1);
+    }
+    return (required);
+}
+
+// copy n bytes to the blob, and pad with zeros to a multiple of PARU_BLOB_ALIGN
+#define SERIALIZE(object, nbytes)                                   \
+{                                                                   \
+    int64_t s = (int64_t)(nbytes);                                  \
+    paru_memcpy(blob + offset, object, s, mem_chunk, nthreads);     \
+    memset(blob + offset + s, 0, PARU_BLOB_PAD(s) - s);             \
+    offset += PARU_BLOB_PAD(s);                                     \
+}
+
+//------------------------------------------------------------------------------
+// ParU_Serialize: serialize a ParU_Symbolic object
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Serialize
+(
+    // output:
+    int8_t *blob,               // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,           // size of blob, >= ParU_SerializeSize
+    const ParU_Symbolic Sym,    // symbolic analysis to serialize
+    // control:
+    ParU_Control Control
+)
+{
+    int64_t required;
+    ParU_Info info = ParU_SerializeSize(&required, Sym, Control);
+    if (info != PARU_SUCCESS || !blob || blobsize < required)
+    {
+        return (PARU_INVALID) ;
+    }
+    size_t mem_chunk = (Control == NULL) ? PARU_DEFAULT_MEM_CHUNK :
+        Control->mem_chunk;
+    int32_t nthreads = paru_nthreads(Control);
+
+    paru_blob_header(blob, required, PARU_BLOB_SYMBOLIC,
+        sizeof(ParU_Symbolic_struct), PARU_BLOB_SYM_NARRAYS);
+    int64_t offset = PARU_BLOB_HEADER;
+
+    // the struct, with its pointers cleared
+    ParU_Symbolic_struct Sym2;
+    paru_blob_array Array[PARU_BLOB_SYM_NARRAYS];
+    memcpy(&Sym2, Sym, sizeof(ParU_Symbolic_struct));
+    paru_blob_symbolic_arrays(&Sym2, Array);
+    for (int k = 0; k < PARU_BLOB_SYM_NARRAYS; k++)
+    {
+        *(Array[k].p) = NULL;
+    }
+    Sym2.Chain_start = NULL;
+    Sym2.Chain_maxrows = NULL;
+    Sym2.Chain_maxcols = NULL;
+    Sym2.view = false;
+    SERIALIZE(&Sym2, sizeof(ParU_Symbolic_struct));
+
+    // the arrays, and the directory
+    int64_t Dir[PARU_BLOB_SYM_NARRAYS];
+    int64_t dir_offset = offset;
+    offset += PARU_BLOB_PAD(PARU_BLOB_SYM_NARRAYS * sizeof(int64_t));
+    paru_blob_symbolic_arrays(Sym, Array);
+    for (int k = 0; k < PARU_BLOB_SYM_NARRAYS; k++)
+    {
+        Dir[k] = 0;
+        if (*(Array[k].p) != NULL)
+        {
+            Dir[k] = offset;
+            SERIALIZE(*(Array[k].p), Array[k].n * Array[k].size);
+        }
+    }
+    ASSERT(offset == required);
+    offset = dir_offset;
+    SERIALIZE(Dir, PARU_BLOB_SYM_NARRAYS * sizeof(int64_t));
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Serialize: serialize a ParU_Numeric object
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Serialize
+(
+    // output:
+    int8_t *blob,               // of size blobsize, allocated on input
+    // input:
+    int64_t blobsize,           // size of blob, >= ParU_SerializeSize
+    const ParU_Numeric Num,     // numeric factorization to serialize
+    // control:
+    ParU_Control Control
+)
+{
+    int64_t required;
+    ParU_Info info = ParU_SerializeSize(&required, Num, Control);
+    if (info != PARU_SUCCESS || !blob || blobsize < required)
+    {
+        return (PARU_INVALID) ;
+    }
+    size_t mem_chunk = (Control == NULL) ? PARU_DEFAULT_MEM_CHUNK :
+        Control->mem_chunk;
+    int32_t nthreads = paru_nthreads(Control);
+
+    paru_blob_header(blob, required, PARU_BLOB_NUMERIC,
+        sizeof(ParU_Numeric_struct), PARU_BLOB_NUM_NSLOTS);
+    int64_t offset = PARU_BLOB_HEADER;
+
+    // the struct, with its pointers cleared
+    ParU_Numeric_struct Num2;
+    paru_blob_array Array[PARU_BLOB_NUM_NARRAYS];
+    memcpy(&Num2, Num, sizeof(ParU_Numeric_struct));
+    paru_blob_numeric_arrays(&Num2, Array);
+    for (int k = 0; k < PARU_BLOB_NUM_NARRAYS; k++)
+    {
+        *(Array[k].p) = NULL;
+    }
+    Num2.frowList = NULL;
+    Num2.fcolList = NULL;
+    Num2.partial_LUs = NULL;
+    Num2.partial_Us = NULL;
+    Num2.view = false;
+    SERIALIZE(&Num2, sizeof(ParU_Numeric_struct));
+
+    // the arrays
+    int64_t Dir[PARU_BLOB_NUM_NSLOTS];
+    int64_t dir_offset = offset;
+    offset += PARU_BLOB_PAD(PARU_BLOB_NUM_NSLOTS * sizeof(int64_t));
+    paru_blob_numeric_arrays(Num, Array);
+    for (int k = 0; k < PARU_BLOB_NUM_NARRAYS; k++)
+    {
+        Dir[k] = 0;
+        if (*(Array[k].p) != NULL)
+        {
+            Dir[k] = offset;
+            SERIALIZE(*(Array[k].p), Array[k].n * Array[k].size);
+        }
+    }
+
+    // the table of the fronts
+    int64_t nf = Num->nf;
+    ParU_Factors *LUs = Num->partial_LUs;
+    ParU_Factors *Us = Num->partial_Us;
+    Dir[PARU_BLOB_FRONTS] = offset;
+    int64_t pos = 0;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t Front[PARU_BLOB_NFRONT];
+        Front[0] = LUs[f].m;
+        Front[1] = LUs[f].n;
+        Front[2] = Us[f].m;
+        Front[3] = Us[f].n;
+        Front[4] = pos;
+        pos += PARU_BLOB_PAD(LUs[f].m * LUs[f].n * sizeof(double));
+        Front[5] = -1;
+        if (Us[f].p != NULL)
+        {
+            Front[5] = pos;
+            pos += PARU_BLOB_PAD(Us[f].m * Us[f].n * sizeof(double));
+        }
+        memcpy(blob + offset + PARU_BLOB_NFRONT * f * sizeof(int64_t), Front,
+            PARU_BLOB_NFRONT * sizeof(int64_t));
+    }
+    int64_t s = PARU_BLOB_NFRONT * nf * sizeof(int64_t);
+    memset(blob + offset + s, 0, PARU_BLOB_PAD(s) - s);
+    offset += PARU_BLOB_PAD(s);
+
+    // the row lists and the column lists of all fronts
+    Dir[PARU_BLOB_ROWS] = offset;
+    s = 0;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t nbytes = Num->frowCount[f] * sizeof(int64_t);
+        memcpy(blob + offset + s, Num->frowList[f], nbytes);
+        s += nbytes;
+    }
+    memset(blob + offset + s, 0, PARU_BLOB_PAD(s) - s);
+    offset += PARU_BLOB_PAD(s);
+    Dir[PARU_BLOB_COLS] = offset;
+    s = 0;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        int64_t nbytes = Num->fcolCount[f] * sizeof(int64_t);
+        if (nbytes > 0) memcpy(blob + offset + s, Num->fcolList[f], nbytes);
+        s += nbytes;
+    }
+    memset(blob + offset + s, 0, PARU_BLOB_PAD(s) - s);
+    offset += PARU_BLOB_PAD(s);
+
+    // the LU and U blocks of all fronts, in one contiguous region
+    Dir[PARU_BLOB_FACTORS] = offset;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        SERIALIZE(LUs[f].p, LUs[f].m * LUs[f].n * sizeof(double));
+        if (Us[f].p != NULL)
+        {
+            SERIALIZE(Us[f].p, Us[f].m * Us[f].n * sizeof(double));
+        }
+    }
+
+    // the directory
+    ASSERT(offset == required);
+    offset = dir_offset;
+    SERIALIZE(Dir, PARU_BLOB_NUM_NSLOTS * sizeof(int64_t));
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// paru_blob_get_arrays: get the arrays of an object from a blob
+//------------------------------------------------------------------------------
+
+static ParU_Info paru_blob_get_arrays
+(
+    paru_blob_array *Array,
+    int narrays,
+    const int64_t *Dir,
+    int8_t *blob,
+    int64_t prefix,
+    int64_t required,
+    bool view,
+    size_t mem_chunk,
+    int32_t nthreads
+)
+{
+    for (int k = 0; k < narrays; k++)
+    {
+        int64_t p = Dir[k];
+        if (p == 0) continue;
+        int64_t n = Array[k].n;
+        if (n < 0 || n > required || p < prefix || p % PARU_BLOB_ALIGN != 0 ||
+            p > required - (int64_t)(n * Array[k].size))
+        {
+            return (PARU_INVALID) ;
+        }
+        if (view)
+        {
+            *(Array[k].p) = static_cast<void *>(blob + p);
+        }
+        else
+        {
+            *(Array[k].p) = paru_malloc(n, Array[k].size);
+            if (*(Array[k].p) == NULL)
+            {
+                return (PARU_OUT_OF_MEMORY) ;
+            }
+            paru_memcpy(*(Array[k].p), blob + p, n * Array[k].size,
+                mem_chunk, nthreads);
+        }
+    }
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Deserialize: construct a ParU_Symbolic object from a blob
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Deserialize
+(
+    // input:
+    int8_t *blob,               // serialized blob from ParU_Serialize
+    int64_t blobsize,           // size of blob
+    bool view,                  // if true, use the blob in place
+    // output:
+    ParU_Symbolic *Sym_handle,  // symbolic analysis
+    // control:
+    ParU_Control Control
+)
+{
+    if (!blob || !Sym_handle)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*Sym_handle) = NULL;
+    int64_t required = paru_blob_check_header(blob, blobsize, view,
+        PARU_BLOB_SYMBOLIC, sizeof(ParU_Symbolic_struct),
+        PARU_BLOB_SYM_NARRAYS);
+    if (required < 0)
+    {
+        return (PARU_INVALID) ;
+    }
+    size_t mem_chunk = (Control == NULL) ? PARU_DEFAULT_MEM_CHUNK :
+        Control->mem_chunk;
+    int32_t nthreads = paru_nthreads(Control);
+
+    // the struct, with its pointers cleared so that it can be safely freed
+    ParU_Symbolic Sym = PARU_MALLOC(1, ParU_Symbolic_struct);
+    if (Sym == NULL)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    int64_t offset = PARU_BLOB_HEADER;
+    memcpy(Sym, blob + offset, sizeof(ParU_Symbolic_struct));
+    offset += PARU_BLOB_PAD(sizeof(ParU_Symbolic_struct));
+    paru_blob_array Array[PARU_BLOB_SYM_NARRAYS];
+    paru_blob_symbolic_arrays(Sym, Array);
+    for (int k = 0; k < PARU_BLOB_SYM_NARRAYS; k++)
+    {
+        *(Array[k].p) = NULL;
+    }
+    Sym->Chain_start = NULL;
+    Sym->Chain_maxrows = NULL;
+    Sym->Chain_maxcols = NULL;
+    Sym->view = view;
+
+    ParU_Info info = PARU_SUCCESS;
+    if (Sym->m < 0 || Sym->n < 0 || Sym->nf < 0 || Sym->ntasks < 0 ||
+        Sym->n1 < 0 || Sym->n1 > std::min(Sym->m, Sym->n) || Sym->snz < 0 ||
+        Sym->cs1 < 0 || Sym->rs1 < 0 || Sym->cs1 + Sym->rs1 != Sym->n1)
+    {
+        info = PARU_INVALID;
+    }
+
+    // the arrays
+    if (info == PARU_SUCCESS)
+    {
+        int64_t Dir[PARU_BLOB_SYM_NARRAYS];
+        memcpy(Dir, blob + offset, PARU_BLOB_SYM_NARRAYS * sizeof(int64_t));
+        info = paru_blob_get_arrays(Array, PARU_BLOB_SYM_NARRAYS, Dir, blob,
+            paru_blob_prefix(sizeof(ParU_Symbolic_struct),
+                PARU_BLOB_SYM_NARRAYS),
+            required, view, mem_chunk, nthreads);
+    }
+    if (info != PARU_SUCCESS)
+    {
+        ParU_FreeSymbolic(&Sym, Control);
+        return (info) ;
+    }
+    (*Sym_handle) = Sym;
+    return (PARU_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Deserialize: construct a ParU_Numeric object from a blob
+//------------------------------------------------------------------------------
+
+ParU_Info ParU_Deserialize
+(
+    // input:
+    int8_t *blob,               // serialized blob from ParU_Serialize
+    int64_t blobsize,           // size of blob
+    bool view,                  // if true, use the blob in place
+    const ParU_Symbolic Sym,    // symbolic analysis used to compute Num
+    // output:
+    ParU_Numeric *Num_handle,   // numeric factorization
+    // control:
+    ParU_Control Control
+)
+{
+    if (!blob || !Sym || !Num_handle)
+    {
+        return (PARU_INVALID) ;
+    }
+    (*Num_handle) = NULL;
+    int64_t required = paru_blob_check_header(blob, blobsize, view,
+        PARU_BLOB_NUMERIC, sizeof(ParU_Numeric_struct), PARU_BLOB_NUM_NSLOTS);
+    if (required < 0)
+    {
+        return (PARU_INVALID) ;
+    }
+    size_t mem_chunk = (Control == NULL) ? PARU_DEFAULT_MEM_CHUNK :
+        Control->mem_chunk;
+    int32_t nthreads = paru_nthreads(Control);
+
+    // the struct, with its pointers cleared so that it can be safely freed
+    ParU_Numeric Num = PARU_MALLOC(1, ParU_Numeric_struct);
+    if (Num == NULL)
+    {
+        return (PARU_OUT_OF_MEMORY) ;
+    }
+    int64_t offset = PARU_BLOB_HEADER;
+    memcpy(Num, blob + offset, sizeof(ParU_Numeric_struct));
+    offset += PARU_BLOB_PAD(sizeof(ParU_Numeric_struct));
+    paru_blob_array Array[PARU_BLOB_NUM_NARRAYS];
+    paru_blob_numeric_arrays(Num, Array);
+    for (int k = 0; k < PARU_BLOB_NUM_NARRAYS; k++)
+    {
+        *(Array[k].p) = NULL;
+    }
+    Num->frowList = NULL;
+    Num->fcolList = NULL;
+    Num->partial_LUs = NULL;
+    Num->partial_Us = NULL;
+    Num->view = view;
+
+    // Num must be a factorization computed with Sym
+    int64_t nf = Num->nf;
+    int64_t ms = Sym->m - Sym->n1;
+    int64_t ns = Sym->n - Sym->n1;
+    ParU_Info info = PARU_SUCCESS;
+    if (Num->res != PARU_SUCCESS || nf != Sym->nf ||
+        Num->sym_m != Sym->m || Num->m != ms || Num->snz != Sym->snz ||
+        Num->sunz != ((Sym->cs1 > 0) ? Sym->ustons.nnz : 0) ||
+        Num->slnz != ((Sym->rs1 > 0) ? Sym->lstons.nnz : 0))
+    {
+        info = PARU_INVALID;
+    }
+
+    // the arrays
+    int64_t Dir[PARU_BLOB_NUM_NSLOTS];
+    memset(Dir, 0, PARU_BLOB_NUM_NSLOTS * sizeof(int64_t));
+    int64_t prefix = paru_blob_prefix(sizeof(ParU_Numeric_struct),
+        PARU_BLOB_NUM_NSLOTS);
+    if (info == PARU_SUCCESS)
+    {
+        memcpy(Dir, blob + offset, PARU_BLOB_NUM_NSLOTS * sizeof(int64_t));
+        info = paru_blob_get_arrays(Array, PARU_BLOB_NUM_NARRAYS, Dir, blob,
+            prefix, required, view, mem_chunk, nthreads);
+    }
+    if (info == PARU_SUCCESS && (Num->Ps == NULL || Num->Pfin == NULL ||
+        (nf > 0 && (Num->frowCount == NULL || Num->fcolCount == NULL))))
+    {
+        info = PARU_INVALID;
+    }
+
+    // the regions of the fronts
+    int64_t p_fronts = Dir[PARU_BLOB_FRONTS];
+    int64_t p_rows = Dir[PARU_BLOB_ROWS];
+    int64_t p_cols = Dir[PARU_BLOB_COLS];
+    int64_t p_factors = Dir[PARU_BLOB_FACTORS];
+    if (info == PARU_SUCCESS && nf > 0 &&
+        (p_fronts < prefix || p_fronts > p_rows || p_rows > p_cols ||
+         p_cols > p_factors || p_factors > required ||
+         (p_rows - p_fronts) / ((int64_t)(PARU_BLOB_NFRONT * sizeof(int64_t)))
+            < nf ||
+         p_factors % PARU_BLOB_ALIGN != 0))
+    {
+        info = PARU_INVALID;
+    }
+
+    // check the table of the fronts, and the row and column lists
+    const int64_t *Fronts = (const int64_t *)(blob + p_fronts);
+    const int64_t *Super = Sym->Super;
+    int64_t rows = 0, cols = 0;
+    int64_t max_rows = (p_cols - p_rows) / (int64_t)sizeof(int64_t);
+    int64_t max_cols = (p_factors - p_cols) / (int64_t)sizeof(int64_t);
+    int64_t factors_size = required - p_factors;
+    for (int64_t f = 0; f < nf && info == PARU_SUCCESS; f++)
+    {
+        int64_t Front[PARU_BLOB_NFRONT];
+        memcpy(Front, Fronts + PARU_BLOB_NFRONT * f,
+            PARU_BLOB_NFRONT * sizeof(int64_t));
+        int64_t fp = Super[f + 1] - Super[f];
+        int64_t rowCount = Num->frowCount[f];
+        int64_t colCount = Num->fcolCount[f];
+        if (rowCount < fp || rowCount > ms || colCount < 0 || colCount > ns ||
+            rows > max_rows - rowCount || cols > max_cols - colCount ||
+            Front[0] != rowCount || Front[1] != fp ||
+            Front[4] < 0 || Front[4] % PARU_BLOB_ALIGN != 0 ||
+            Front[4] > factors_size -
+                (int64_t)(rowCount * fp * sizeof(double)) ||
+            (Front[5] >= 0 && (Front[2] != fp || Front[3] != colCount ||
+                Front[5] % PARU_BLOB_ALIGN != 0 || Front[5] > factors_size -
+                    (int64_t)(fp * colCount * sizeof(double)))))
+        {
+            info = PARU_INVALID;
+            break;
+        }
+        const int64_t *frowList = (const int64_t *)(blob + p_rows) + rows;
+        const int64_t *fcolList = (const int64_t *)(blob + p_cols) + cols;
+        for (int64_t i = 0; i < rowCount; i++)
+        {
+            if (frowList[i] < 0 || frowList[i] >= ms) info = PARU_INVALID;
+        }
+        for (int64_t j = 0; j < colCount; j++)
+        {
+            if (fcolList[j] < 0 || fcolList[j] >= ns) info = PARU_INVALID;
+        }
+        rows += rowCount;
+        cols += colCount;
+    }
+
+    // the fronts
+    if (info == PARU_SUCCESS && nf > 0)
+    {
+        Num->frowList = PARU_CALLOC(nf, int64_t *);
+        Num->fcolList = PARU_CALLOC(nf, int64_t *);
+        Num->partial_LUs = PARU_CALLOC(nf, ParU_Factors);
+        Num->partial_Us = PARU_CALLOC(nf, ParU_Factors);
+        if (Num->frowList == NULL || Num->fcolList == NULL ||
+            Num->partial_LUs == NULL || Num->partial_Us == NULL)
+        {
+            info = PARU_OUT_OF_MEMORY;
+        }
+    }
+    rows = 0;
+    cols = 0;
+    for (int64_t f = 0; f < nf && info == PARU_SUCCESS; f++)
+    {
+        int64_t Front[PARU_BLOB_NFRONT];
+        memcpy(Front, Fronts + PARU_BLOB_NFRONT * f,
+            PARU_BLOB_NFRONT * sizeof(int64_t));
+        int64_t rowCount = Num->frowCount[f];
+        int64_t colCount = Num->fcolCount[f];
+        int64_t *frowList = (int64_t *)(blob + p_rows) + rows;
+        int64_t *fcolList = (int64_t *)(blob + p_cols) + cols;
+        double *LU = (double *)(blob + p_factors + Front[4]);
+        double *U = (Front[5] < 0) ? NULL :
+            (double *)(blob + p_factors + Front[5]);
+        int64_t lusize = Front[0] * Front[1];
+        int64_t usize = (U == NULL) ? 0 : Front[2] * Front[3];
+        ParU_Factors *LUs = Num->partial_LUs + f;
+        ParU_Factors *Us = Num->partial_Us + f;
+        LUs->m = Front[0];
+        LUs->n = Front[1];
+        Us->m = Front[2];
+        Us->n = Front[3];
+        if (view)
+        {
+            Num->frowList[f] = frowList;
+            Num->fcolList[f] = (colCount > 0) ? fcolList : NULL;
+            LUs->p = LU;
+            Us->p = U;
+        }
+        else
+        {
+            Num->frowList[f] = PARU_MALLOC(rowCount, int64_t);
+            Num->fcolList[f] = (colCount > 0) ?
+                PARU_MALLOC(colCount, int64_t) : NULL;
+            LUs->p = PARU_MALLOC(lusize, double);
+            Us->p = (U == NULL) ? NULL : PARU_MALLOC(usize, double);
+            if (Num->frowList[f] == NULL || LUs->p == NULL ||
+                (colCount > 0 && Num->fcolList[f] == NULL) ||
+                (U != NULL && Us->p == NULL))
+            {
+                info = PARU_OUT_OF_MEMORY;
+                break;
+            }
+            memcpy(Num->frowList[f], frowList, rowCount * sizeof(int64_t));
+            if (colCount > 0)
+            {
+                memcpy(Num->fcolList[f], fcolList, colCount * sizeof(int64_t));
+            }
+            paru_memcpy(LUs->p, LU, lusize * sizeof(double), mem_chunk,
+                nthreads);
+            if (U != NULL)
+            {
+                paru_memcpy(Us->p, U, usize * sizeof(double), mem_chunk,
+                    nthreads);
+            }
+        }
+        rows += rowCount;
+        cols += colCount;
+    }
+
+    if (info != PARU_SUCCESS)
+    {
+        ParU_FreeNumeric(&Num, Control);
+        return (info) ;
+    }
+    (*Num_handle) = Num;
+    return (PARU_SUCCESS) ;
+}
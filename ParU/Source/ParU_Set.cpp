@@ -112,6 +112,10 @@ ParU_Info ParU_Set
             Control->mem_chunk = (c <= 0) ? PARU_DEFAULT_MEM_CHUNK : c ;
             break ;
 
+        case PARU_CONTROL_NUMA_DOMAINS:           // # of NUMA domains to use
+            Control->numa_domains = (c <= 0) ? PARU_DEFAULT_NUMA_DOMAINS : c ;
+            break ;
+
         default:
             return (PARU_INVALID) ;
             break ;
@@ -51,7 +51,7 @@ ParU_Info ParU_Solve
 )
 {
 
-    if (!Sym || !Num || !b || !x)
+    if (!Sym || !Num || !b || !x || Num->res != PARU_SUCCESS)
     {
         return PARU_INVALID;
     }
@@ -62,7 +62,6 @@ ParU_Info ParU_Solve
     PRLEVEL(1, ("%% inside solve\n"));
 
     int64_t m = Sym->m;
-    // if (Num->res == PARU_SINGULAR)  //THIS Won't happen because Num is freed
 #ifndef NTIME
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
@@ -164,7 +163,7 @@ ParU_Info ParU_Solve
 )
 {
 
-    if (!Sym || !Num || !B || !X)
+    if (!Sym || !Num || !B || !X || Num->res != PARU_SUCCESS)
     {
         return PARU_INVALID;
     }
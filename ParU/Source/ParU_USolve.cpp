@@ -28,7 +28,8 @@
  *
  *        This function just goes through LUs and US in the data structure and
  *        does a TRSV on triangular part  Then does DGEMV on the rest
- *       for nf down to 0
+ *       for nf down to 0.  The fronts are done by paru_tasked_usolve, in
+ *       parallel over the task tree if possible.
  *
  *              BLAS_DTRSV  is used here but I do not use BLAS_DGEMV explicitly
  *              while it needs space for each thread doing this computation.
@@ -55,7 +56,7 @@ ParU_Info ParU_USolve
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !x)
+    if (!Sym || !Num || !x || Num->res != PARU_SUCCESS)
     {
         return PARU_INVALID ;
     }
@@ -64,84 +65,16 @@ ParU_Info ParU_USolve
     BLAS_set_num_threads (paru_nthreads (Control)) ;
 
     DEBUGLEVEL(0);
-    bool blas_ok = true ;
     PARU_DEFINE_PRLEVEL;
 #ifndef NTIME
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
-    int64_t nf = Sym->nf;
 
-    int64_t n1 = Sym->n1;   // row+col singletons
-    const int64_t *Ps = Num->Ps;  // row permutation
-
-    const ParU_Factors *LUs = Num->partial_LUs;
-    const ParU_Factors *Us = Num->partial_Us;
-    const int64_t *Super = Sym->Super;
-
-    double *work = PARU_MALLOC (Num->max_col_count, double);
-    if (work == NULL)
+    // the fronts, in parallel if the task tree allows it
+    ParU_Info info = paru_tasked_usolve (1, x, Sym, Num, Control) ;
+    if (info != PARU_SUCCESS)
     {
-        PRLEVEL(1, ("ParU: out of memory usolve\n"));
-        return PARU_OUT_OF_MEMORY;
-    }
-
-    for (int64_t f = nf - 1; f >= 0; --f)
-    {
-        const int64_t *frowList = Num->frowList[f];
-        const int64_t *fcolList = Num->fcolList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        int64_t colCount = Num->fcolCount[f];
-
-        // do dgemv
-        // performed on Us
-        // I am not calling BLAS_DGEMV while the column permutation is different
-
-        double *A2 = Us[f].p;
-        if (A2 != NULL)
-        {
-            PRLEVEL(2, ("%% usolve: Working on DGEMV\n%%"));
-
-            double *xg = &work[0] + fp;         // size Xg is colCount
-            for (int64_t j = 0; j < colCount; j++)  // gathering x in Xg
-            {
-                xg[j] = x[fcolList[j] + n1];
-            }
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemv("N", fp, colCount, &alpha, A2, fp, xg, 1,
-                                   &beta, work, 1, blas_ok);
-
-            for (int64_t i = 0; i < fp; i++)  // scattering the back in to x
-            {
-                int64_t r = Ps[frowList[i]] + n1;
-                x[r] -= work[i];
-            }
-
-            // pragma omp parallel for
-            // for (int64_t i = 0; i < fp; i++)
-            //{
-            //    PRLEVEL(2, ("%% USolve: Working on DGEMV\n"));
-            //    // computing the inner product
-            //    double i_prod = 0.0;  // innter product
-            //    for (int64_t j = 0; j < colCount; j++)
-            //    {
-            //        i_prod += A2[fp * j + i] * x[fcolList[j] + n1];
-            //    }
-            //    int64_t r = Ps[frowList[i]] + n1;
-            //    PRLEVEL(2, ("i_prod[" LD "]=%lf  r=" LD "\n", i, i_prod,  r));
-            //    x[r] -= i_prod;
-            //}
-        }
-
-        int64_t rowCount = Num->frowCount[f];
-
-        double *A1 = LUs[f].p;
-        PRLEVEL(2, ("%% USolve: Working on DTRSV\n"));
-        SUITESPARSE_BLAS_dtrsv("U", "N", "N", fp, A1, rowCount, x + col1 + n1,
-                               1, blas_ok);
-        PRLEVEL(2, ("%% DTRSV is just finished\n"));
+        return (info) ;
     }
 
 #ifndef NDEBUG
@@ -193,8 +126,7 @@ ParU_Info ParU_USolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_col_count, double, work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return (PARU_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
@@ -214,7 +146,7 @@ ParU_Info ParU_USolve
     ParU_Control Control
 )
 {
-    if (!Sym || !Num || !X)
+    if (!Sym || !Num || !X || Num->res != PARU_SUCCESS)
     {
         return PARU_INVALID ;
     }
@@ -223,10 +155,8 @@ ParU_Info ParU_USolve
     BLAS_set_num_threads (paru_nthreads (Control)) ;
 
     DEBUGLEVEL(0);
-    bool blas_ok = true ;
     PARU_DEFINE_PRLEVEL;
     int64_t m = Sym->m;
-    int64_t nf = Sym->nf;
 #ifndef NDEBUG
     PRLEVEL(1, ("%% mRHS inside USolve X is:\n"));
     for (int64_t k = 0; k < m; k++)
@@ -243,88 +173,11 @@ ParU_Info ParU_USolve
 #ifndef NTIME
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
-    int64_t n1 = Sym->n1;   // row+col singletons
-    const int64_t *Ps = Num->Ps;  // row permutation
-
-    const ParU_Factors *LUs = Num->partial_LUs;
-    const ParU_Factors *Us = Num->partial_Us;
-    const int64_t *Super = Sym->Super;
-
-    double *work = PARU_MALLOC (Num->max_col_count * nrhs, double);
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory USolve\n"));
-        return PARU_OUT_OF_MEMORY;
-    }
-
-    for (int64_t f = nf - 1; f >= 0; --f)
+    // the fronts, in parallel if the task tree allows it
+    ParU_Info info = paru_tasked_usolve (nrhs, X, Sym, Num, Control) ;
+    if (info != PARU_SUCCESS)
     {
-        const int64_t *frowList = Num->frowList[f];
-        const int64_t *fcolList = Num->fcolList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        int64_t colCount = Num->fcolCount[f];
-
-        // do dgemm
-        // performed on Us
-
-        double *A2 = Us[f].p;
-        if (A2 != NULL)
-        {
-            PRLEVEL(2, ("%% mRHS usolve: Working on DGEMM f=" LD "\n%%", f));
-            double *Xg = &work[0] + fp * nrhs;     // size Xg is colCount x nrhs
-            for (int64_t j = 0; j < colCount; j++)  // gathering X in Xg
-            {
-                for (int64_t l = 0; l < nrhs; l++)
-                {
-                    Xg[l * colCount + j] = X[l * m + fcolList[j] + n1];
-                }
-            }
-
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemm("N", "N", fp, nrhs, colCount, &alpha, A2, fp,
-                                   Xg, colCount, &beta, work, fp, blas_ok);
-
-            for (int64_t i = 0; i < fp; i++)  // scattering the back in to X
-            {
-                int64_t r = Ps[frowList[i]] + n1;
-                for (int64_t l = 0; l < nrhs; l++)
-                {
-                    X[l * m + r] -= work[l * fp + i];
-                }
-            }
-
-            // algternative way for dgemm
-            // pragma omp parallel for schedule(static)
-            // for (int64_t i = 0; i < fp; i++)
-            //{
-            //    // computing the inner product
-            //    double i_prod[nrhs] = {0.0};  // inner product
-            //    for (int64_t j = 0; j < colCount; j++)
-            //    {
-            //        for (int64_t l = 0; l < nrhs; l++)
-            //            i_prod[l] += A2[fp * j + i] * X[l*m + fcolList[j] +
-            //            n1];
-            //    }
-            //    int64_t r = Ps[frowList[i]] + n1;
-            //    for (int64_t l = 0; l < nrhs; l++)
-            //    {
-            //        PRLEVEL(2, ("i_prod[" LD "]=%lf  r=" LD "\nrhs", i, i_prod[i], r));
-            //        X[l*m+r] -= i_prod[l];
-            //    }
-            //}
-        }
-
-        int64_t rowCount = Num->frowCount[f];
-
-        PRLEVEL(2, ("%% mRHS USolve: Working on DTRSM\n"));
-        double *A1 = LUs[f].p;
-        double alpha = 1;
-        SUITESPARSE_BLAS_dtrsm("L", "U", "N", "N", fp, nrhs, &alpha, A1, rowCount,
-                               X + n1 + col1, m, blas_ok);
-        PRLEVEL(2, ("%% mRHS DTRSM is just finished\n"));
+        return (info) ;
     }
 
     PRLEVEL(1, ("%% mRHS USolve working on singletons \n"));
@@ -374,6 +227,5 @@ ParU_Info ParU_USolve
     }
     PRLEVEL(1, (" \n"));
 #endif
-    PARU_FREE(Num->max_col_count * nrhs, double, work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return (PARU_SUCCESS) ;
 }
@@ -64,6 +64,14 @@ ParU_Info paru_exec_tasks_seq
     if (daddy == -1) PRLEVEL(1, ("%% finished task root(" LD ")\n", t));
 #endif
 
+    const int64_t *task_owner = Work->task_owner;
+    if (daddy != -1 && task_owner != NULL && task_owner[daddy] != task_owner[t])
+    {
+        // the parent is shared by all NUMA domains; it is executed later
+        task_num_child[daddy]--;
+        return myInfo;
+    }
+
     if (daddy != -1)  // if it is not a root
     {
         if (num_original_children != 1)
@@ -139,6 +147,16 @@ ParU_Info paru_exec_tasks
     if (daddy == -1) PRLEVEL(1, ("%% finished task root(" LD ")\n", t));
 #endif
 
+    const int64_t *task_owner = Work->task_owner;
+    if (daddy != -1 && task_owner != NULL && task_owner[daddy] != task_owner[t])
+    {
+        // the parent is shared by all NUMA domains; it is executed later, by
+        // paru_exec_tasks_numa, once all of its children are done
+        #pragma omp atomic update
+        task_num_child[daddy]--;
+        return myInfo;
+    }
+
     if (daddy != -1)  // if it is not a root
     {
         if (num_original_children != 1)
@@ -198,3 +216,306 @@ ParU_Info paru_exec_tasks
     return myInfo;
 }
 
+//------------------------------------------------------------------------------
+// paru_numa_map: map subtrees of the task tree to NUMA domains
+//------------------------------------------------------------------------------
+
+// The task tree is cut into disjoint subtrees, and each subtree is owned by one
+// of the ndomains NUMA domains.  Starting with the roots of the task tree, the
+// subtree with the largest flop bound is split into the subtrees of its
+// children, until the subtrees can be assigned to the domains (largest first,
+// each to the least loaded domain) with a load at most PARU_NUMA_BALANCE times
+// the ideal one.  The tasks that have been split are near the root; they are
+// owned by no domain (task_owner [t] = -1) and are shared by all threads.
+
+#define PARU_NUMA_BALANCE 1.1
+
+static void paru_numa_map
+(
+    // input:
+    int64_t ndomains,
+    const ParU_Symbolic Sym,
+    // output:
+    std::vector<int64_t> &task_owner    // size ntasks
+)
+{
+    DEBUGLEVEL(0);
+    int64_t ntasks = Sym->ntasks;
+    const int64_t *task_map = Sym->task_map;
+    const int64_t *task_parent = Sym->task_parent;
+    const double *stree_flop_bound = Sym->stree_flop_bound;
+
+    // the last front of a task is the root of its subtree
+    auto subtree_flops = [&](int64_t t) -> double
+    { return stree_flop_bound[task_map[t + 1]]; };
+    auto smaller = [&](const int64_t &t1, const int64_t &t2) -> bool
+    { return subtree_flops(t1) < subtree_flops(t2); };
+
+    // children of each task
+    std::vector<int64_t> Childp(ntasks + 1, 0);
+    std::vector<int64_t> Child(ntasks);
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        if (task_parent[t] != -1) Childp[task_parent[t] + 1]++;
+    }
+    for (int64_t t = 0; t < ntasks; t++) Childp[t + 1] += Childp[t];
+    std::vector<int64_t> cp(Childp.begin(), Childp.end() - 1);
+    std::vector<int64_t> S;  // roots of the subtrees, a max-heap
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        if (task_parent[t] == -1)
+        {
+            S.push_back(t);
+        }
+        else
+        {
+            Child[cp[task_parent[t]]++] = t;
+        }
+    }
+    std::make_heap(S.begin(), S.end(), smaller);
+
+    // assign the subtrees in S to the domains; returns the imbalance
+    std::vector<double> load(ndomains);
+    std::vector<int64_t> roots, root_owner;
+    auto assign = [&]() -> double
+    {
+        roots.assign(S.begin(), S.end());
+        root_owner.resize(roots.size());
+        std::sort(roots.begin(), roots.end(),
+            [&](const int64_t &t1, const int64_t &t2) -> bool
+            { return subtree_flops(t1) > subtree_flops(t2); });
+        std::fill(load.begin(), load.end(), 0);
+        double total = 0;
+        for (size_t i = 0; i < roots.size(); i++)
+        {
+            int64_t d =
+                std::min_element(load.begin(), load.end()) - load.begin();
+            load[d] += subtree_flops(roots[i]);
+            total += subtree_flops(roots[i]);
+            root_owner[i] = d;
+        }
+        double max_load = *std::max_element(load.begin(), load.end());
+        return (total == 0) ? 1 : (max_load * ndomains / total);
+    };
+
+    while (true)
+    {
+        if ((int64_t)S.size() >= ndomains && assign() <= PARU_NUMA_BALANCE)
+        {
+            break;
+        }
+        // split the largest subtree; a single task cannot be split
+        int64_t t = S.front();
+        if (Childp[t] == Childp[t + 1]) break;
+        std::pop_heap(S.begin(), S.end(), smaller);
+        S.pop_back();
+        for (int64_t p = Childp[t]; p < Childp[t + 1]; p++)
+        {
+            S.push_back(Child[p]);
+            std::push_heap(S.begin(), S.end(), smaller);
+        }
+    }
+    assign();
+
+    // the tasks above the subtrees are shared, the others inherit the owner
+    // of their subtree root (the parent of a task has a larger index)
+    std::fill(task_owner.begin(), task_owner.end(), -1);
+    for (size_t i = 0; i < roots.size(); i++)
+    {
+        task_owner[roots[i]] = root_owner[i];
+    }
+    for (int64_t t = ntasks - 1; t >= 0; t--)
+    {
+        int64_t daddy = task_parent[t];
+        ASSERT(daddy == -1 || daddy > t);
+        if (daddy != -1 && task_owner[t] == -1)
+        {
+            task_owner[t] = task_owner[daddy];
+        }
+    }
+#ifndef NDEBUG
+    PRLEVEL(1, ("%% NUMA: " LD " subtrees, domain loads:", (int64_t)S.size()));
+    for (int64_t d = 0; d < ndomains; d++) PRLEVEL(1, (" %g", load[d]));
+    PRLEVEL(1, ("\n"));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// paru_exec_tasks_numa: execute all tasks in parallel, NUMA-aware
+//------------------------------------------------------------------------------
+
+// The subtrees of the task tree are mapped to NUMA domains by paru_numa_map.
+// The threads are split into one team per domain: the outer parallel region
+// spreads the teams over the OpenMP places, and each team is bound close to
+// its own partition of the places.  With OMP_PLACES=cores (or threads) and the
+// cores numbered socket by socket, each team then runs on its own socket.
+// Each team factorizes the subtrees of its domain; since the fronts and the
+// contribution blocks are allocated and first touched by the thread that
+// factorizes them, their memory is local to the domain.  The tasks near the
+// root are then factorized by all threads, as in ParU_Factorize.
+
+ParU_Info paru_exec_tasks_numa
+(
+    int64_t ndomains,
+    int64_t *task_num_child,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    int64_t ntasks = Sym->ntasks;
+    const int64_t *task_depth = Sym->task_depth;
+    int32_t nthreads = Work->nthreads;
+    ndomains = std::max((int64_t)1, std::min(ndomains, (int64_t)nthreads));
+
+    auto deeper = [&task_depth](const int64_t &t1, const int64_t &t2) -> bool
+    { return task_depth[t1] > task_depth[t2]; };
+
+    std::vector<int64_t> task_owner;
+    std::vector<std::vector<int64_t>> domain_Q;
+    std::vector<int64_t> task_Q;
+    int64_t nleaves = 0;
+    try
+    {
+        task_owner.resize(ntasks);
+        domain_Q.resize(ndomains);
+        paru_numa_map(ndomains, Sym, task_owner);
+        int64_t ntop = 0;
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            if (task_owner[t] == -1)
+            {
+                ntop++;
+            }
+            else if (Sym->task_num_child[t] == 0)
+            {
+                domain_Q[task_owner[t]].push_back(t);
+                nleaves++;
+            }
+        }
+        task_Q.reserve(ntop);
+    }
+    catch (std::bad_alloc const &)
+    {
+        // out of memory
+        PRLEVEL(1, ("ParU: Out of memory: NUMA task queues\n"));
+        return PARU_OUT_OF_MEMORY;
+    }
+    for (int64_t d = 0; d < ndomains; d++)
+    {
+        std::sort(domain_Q[d].begin(), domain_Q[d].end(), deeper);
+    }
+
+    ParU_Info info = PARU_SUCCESS;
+    int64_t chain_task = -1;
+    Work->task_owner = task_owner.data();
+
+    //--------------------------------------------------------------------------
+    // factorize the subtrees, each domain with its own team of threads
+    //--------------------------------------------------------------------------
+
+    #pragma omp atomic write
+    Work->resq = nleaves;
+    #pragma omp parallel proc_bind(spread) num_threads(ndomains)
+    {
+        int64_t d = PARU_OPENMP_GET_THREAD_NUM;
+        const std::vector<int64_t> &my_Q = domain_Q[d];
+        int32_t my_nthreads = nthreads / ndomains + (d < nthreads % ndomains);
+        PRLEVEL(1, ("%% NUMA domain " LD ": " LD " tasks, %d threads\n", d,
+            (int64_t)my_Q.size(), my_nthreads));
+        #pragma omp parallel proc_bind(close) num_threads(my_nthreads)
+        #pragma omp single nowait
+        #pragma omp task untied
+        for (size_t i = 0; i < my_Q.size(); i++)
+        {
+            int64_t t = my_Q[i];
+            int64_t depth = task_depth[t];
+            #pragma omp task mergeable priority(depth)
+            {
+                #pragma omp atomic update
+                Work->naft++;
+
+                ParU_Info myInfo =
+                    paru_exec_tasks(t, task_num_child, chain_task, Work,
+                        Sym, Num);
+                if (myInfo != PARU_SUCCESS)
+                {
+                    #pragma omp atomic write
+                    info = myInfo;
+                }
+                #pragma omp atomic update
+                Work->naft--;
+
+                #pragma omp atomic update
+                Work->resq--;
+            }
+        }
+    }
+    if (chain_task != -1 && info == PARU_SUCCESS)
+    {
+        #pragma omp atomic write
+        Work->naft = 1;
+        PRLEVEL(1, ("Chain_taskd " LD " has remained\n", chain_task));
+        info = paru_exec_tasks_seq(chain_task, task_num_child, Work, Sym, Num);
+        #pragma omp atomic write
+        Work->naft = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // factorize the tasks near the root with all threads
+    //--------------------------------------------------------------------------
+
+    if (info == PARU_SUCCESS)
+    {
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            if (task_owner[t] == -1 && task_num_child[t] == 0)
+            {
+                task_Q.push_back(t);
+            }
+        }
+        std::sort(task_Q.begin(), task_Q.end(), deeper);
+        chain_task = -1;
+        #pragma omp atomic write
+        Work->resq = task_Q.size();
+        #pragma omp parallel proc_bind(spread) num_threads(nthreads)
+        #pragma omp single nowait
+        #pragma omp task untied
+        for (size_t i = 0; i < task_Q.size(); i++)
+        {
+            int64_t t = task_Q[i];
+            int64_t depth = task_depth[t];
+            #pragma omp task mergeable priority(depth)
+            {
+                #pragma omp atomic update
+                Work->naft++;
+
+                ParU_Info myInfo =
+                    paru_exec_tasks(t, task_num_child, chain_task, Work,
+                        Sym, Num);
+                if (myInfo != PARU_SUCCESS)
+                {
+                    #pragma omp atomic write
+                    info = myInfo;
+                }
+                #pragma omp atomic update
+                Work->naft--;
+
+                #pragma omp atomic update
+                Work->resq--;
+            }
+        }
+        if (chain_task != -1 && info == PARU_SUCCESS)
+        {
+            #pragma omp atomic write
+            Work->naft = 1;
+            PRLEVEL(1, ("Chain_taskd " LD " has remained\n", chain_task));
+            info = paru_exec_tasks_seq(chain_task, task_num_child, Work,
+                Sym, Num);
+        }
+    }
+
+    Work->task_owner = NULL;
+    return info;
+}
@@ -20,13 +20,6 @@
 
 #include "paru_internal.hpp"
 
-#define FREE_WORK                           \
-{                                           \
-    PARU_FREE (m + 1, int64_t, cSp);        \
-    PARU_FREE (cs1 + 1, int64_t, cSup);     \
-    PARU_FREE (rs1 + 1, int64_t, cSlp);     \
-}
-
 ParU_Info paru_init_rowFronts
 (
     // input/output:
@@ -43,12 +36,9 @@ ParU_Info paru_init_rowFronts
     size_t mem_chunk = Work->mem_chunk ;
     int32_t prescale = Work->prescale ;
 
-    // workspace:
-    int64_t *cSp = NULL;    // copy of Sp, temporary for making Sx
-    int64_t *cSup = NULL;   // copy of Sup temporary for making Sux
-    int64_t *cSlp = NULL;   // copyf of Slp temporary, for making Slx
     int64_t cs1 = 0 ;
     int64_t rs1 = 0 ;
+    ParU_Info info ;
 
     DEBUGLEVEL(0);
     PARU_DEFINE_PRLEVEL;
@@ -134,7 +124,6 @@ ParU_Info paru_init_rowFronts
             elementList == NULL)
         {
             // out of memory
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
 
@@ -145,8 +134,7 @@ ParU_Info paru_init_rowFronts
             if (Diag_map == NULL || inv_Diag_map == NULL)
             {
                 // out of memory
-                FREE_WORK ;
-                return (PARU_OUT_OF_MEMORY) ;
+                    return (PARU_OUT_OF_MEMORY) ;
             }
 #ifndef NDEBUG
             paru_memset(Diag_map, 0, Sym->n * sizeof(int64_t),
@@ -161,10 +149,8 @@ ParU_Info paru_init_rowFronts
     int64_t snz = Num->snz = Sym->snz;
     double *Sx = NULL;
     Sx = Num->Sx = PARU_MALLOC (snz, double);
-    cSp = PARU_MALLOC (m + 1, int64_t);
     if (Num->Sx == NULL)
     {
-        FREE_WORK ;
         return (PARU_OUT_OF_MEMORY) ;
     }
 
@@ -174,27 +160,21 @@ ParU_Info paru_init_rowFronts
     {
         Num->sunz = Sym->ustons.nnz;
         Num->Sux = PARU_MALLOC (Num->sunz, double);
-        cSup = PARU_MALLOC (cs1 + 1, int64_t);
-        if (cSup == NULL || Num->Sux == NULL)
+        if (Num->Sux == NULL)
         {
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
     }
-    double *Sux = Num->Sux ;
 
     if (rs1 > 0)
     {
         Num->slnz = Sym->lstons.nnz;
         Num->Slx = PARU_MALLOC (Num->slnz, double);
-        cSlp = PARU_MALLOC (rs1 + 1, int64_t);
-        if (cSlp == NULL || Num->Slx == NULL)
+        if (Num->Slx == NULL)
         {
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
     }
-    double *Slx = Num->Slx ;
 
     bool prescaling = (prescale != PARU_PRESCALE_NONE) ;
     if (prescaling)
@@ -203,11 +183,9 @@ ParU_Info paru_init_rowFronts
         Num->Rs = PARU_CALLOC (Sym->m, double);
         if (Num->Rs == NULL)
         {
-            FREE_WORK ;
             return (PARU_OUT_OF_MEMORY) ;
         }
     }
-    double *Rs = Num->Rs ;
 
     // Initializations
     if (nf != 0)
@@ -231,179 +209,13 @@ ParU_Info paru_init_rowFronts
         PRLEVEL(PR, ("%% Work =%p\n ", Work));
     }
 
-    //////////////////Initializing numerics Sx, Sux and Slx //////////////////{
-    int64_t *Ap = static_cast<int64_t*>(A->p);
-    int64_t *Ai = static_cast<int64_t*>(A->i);
-    double *Ax = static_cast<double*>(A->x);
-    const int64_t *Sp = Sym->Sp;
-    const int64_t *Slp = (rs1 > 0) ? Sym->lstons.Slp : NULL ;
-    const int64_t *Sup = (cs1 > 0) ? Sym->ustons.Sup : NULL ;
-    paru_memcpy(cSp, Sp, (m + 1) * sizeof(int64_t), mem_chunk, nthreads) ;
-    if (cs1 > 0)
-    {
-        paru_memcpy(cSup, Sup, (cs1 + 1) * sizeof(int64_t),
-                mem_chunk, nthreads) ;
-    }
-    if (rs1 > 0)
-    {
-        paru_memcpy(cSlp, Slp, (rs1 + 1) * sizeof(int64_t),
-                mem_chunk, nthreads) ;
-    }
-#ifndef NDEBUG
-    PR = 1;
-    PRLEVEL(PR, ("Init Sup and Slp in the middle\n"));
-    if (cs1 > 0)
-    {
-        PRLEVEL(PR, ("(" LD ") Sup =", Num->sunz));
-        for (int64_t k = 0; k <= cs1; k++)
-        {
-            PRLEVEL(PR, ("" LD " ", Sup[k]));
-            PRLEVEL(PR + 2, ("c" LD " ", cSup[k]));
-            if (Sup[k] != cSup[k])
-                PRLEVEL(PR, ("Sup[" LD "] =" LD ", cSup=" LD "", k, Sup[k], cSup[k]));
-            ASSERT(Sup[k] == cSup[k]);
-        }
-        PRLEVEL(PR, ("\n"));
-    }
-    if (rs1 > 0)
-    {
-        PRLEVEL(PR, ("(" LD ") Slp =", Num->slnz));
-        for (int64_t k = 0; k <= rs1; k++)
-        {
-            PRLEVEL(PR, ("" LD " ", Slp[k]));
-            PRLEVEL(PR + 2, ("o" LD " ", cSlp[k]));
-            if (Slp[k] != cSlp[k])
-                PRLEVEL(PR,
-                        ("\nSup[" LD "] =" LD ", cSup=" LD "\n", k, Slp[k], cSlp[k]));
-            ASSERT(Slp[k] == cSlp[k]);
-        }
-        PRLEVEL(PR, ("\n"));
-    }
-#endif
-
-    int64_t n1 = Sym->n1;
-
-    const int64_t *Qinit = Sym->Qfill;
-    const int64_t *Pinv = Sym->Pinv;
-#ifndef NDEBUG
-    PR = 1;
-    PRLEVEL(PR, ("Init Pinv =\n"));
-    for (int64_t i = 0; i < m; i++) PRLEVEL(PR, ("" LD " ", Pinv[i]));
-    PRLEVEL(PR, ("\n"));
-#endif
-
-    // compute the scale factors
-    if (prescale == PARU_PRESCALE_MAX)
-    {
-        // this is the ParU default
-        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
-        {
-            int64_t oldcol = Qinit[newcol];
-            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
-            {
-                int64_t oldrow = Ai[p];
-                Rs[oldrow] = std::max(Rs[oldrow], fabs(Ax[p]));
-            }
-        }
-    }
-    else if (prescale == PARU_PRESCALE_SUM)
-    {
-        // this is the UMFPACK default
-        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
-        {
-            int64_t oldcol = Qinit[newcol];
-            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
-            {
-                int64_t oldrow = Ai[p];
-                Rs[oldrow] += fabs(Ax[p]);
-            }
-        }
-    }
-
-    PRLEVEL(PR, ("%% Rs:\n["));
-    if (prescaling)
+    //////////////////Initializing numerics Sx, Sux and Slx //////////////////
+    info = paru_init_values(Num, A, Sym, prescale, false, mem_chunk, nthreads);
+    if (info != PARU_SUCCESS)
     {
-        // making sure that every row has at most one element more than zero
-        for (int64_t k = 0; k < m; k++)
-        {
-            PRLEVEL(PR, ("%lf ", Rs[k]));
-            if (Rs[k] <= 0)
-            {
-                PRLEVEL(1, ("ParU: Matrix is singular, row " LD
-                    " is zero\n", k));
-                Num->res = PARU_SINGULAR;
-                return PARU_SINGULAR;
-            }
-        }
+        return (info) ;
     }
-    PRLEVEL(PR, ("]\n"));
-
-    for (int64_t newcol = 0; newcol < Sym->n; newcol++)
-    {
-        int64_t oldcol = Qinit[newcol];
-        for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
-        {
-            int64_t oldrow = Ai[p];
-            int64_t newrow = Pinv[oldrow];
-            int64_t srow = newrow - n1;
-            int64_t scol = newcol - n1;
-            if (srow >= 0 && scol >= 0)
-            {
-                // it is inside S otherwise it is part of singleton
-                Sx[cSp[srow]++] =
-                    (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-            }
-            else if (srow < 0 && scol >= 0)
-            {
-                // inside the U singletons
-                PRLEVEL(PR, ("Usingleton newcol = " LD " newrow=" LD "\n",
-                    newcol, newrow));
-                // let the diagonal entries be first
-                Sux[++cSup[newrow]] =
-                    (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-            }
-            else
-            {
-                if (newrow < cs1)
-                {
-                    // inside U singletons CSR
-                    // PRLEVEL(PR, ("Inside U singletons\n"));
-                    if (newcol == newrow)
-                    {
-                        // diagonal entry
-                        Sux[Sup[newrow]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                    else
-                    {
-                        Sux[++cSup[newrow]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                }
-                else
-                {
-                    // inside L singletons CSC
-                    // PRLEVEL(PR, ("Inside L singletons\n"));
-                    if (newcol == newrow)
-                    {
-                        // diagonal entry
-                        Slx[Slp[newcol - cs1]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                    else
-                    {
-                        Slx[++cSlp[newcol - cs1]] =
-                            (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
-                    }
-                }
-            }
-        }
-    }
-
-    FREE_WORK;
-
-        //////////////////Initializing numerics Sx, Sux and Slx
-        /////////////////////}
+    const int64_t *Sp = Sym->Sp;
 #ifdef COUNT_FLOPS
     // flop count init
     Work->flp_cnt_dgemm = 0.0;
@@ -573,7 +385,6 @@ ParU_Info paru_init_rowFronts
     // return result
     //--------------------------------------------------------------------------
 
-    ParU_Info info ;
     if (out_of_memory > 0)
     {
         info = PARU_OUT_OF_MEMORY;
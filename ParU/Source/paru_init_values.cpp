@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  paru_init_values  //////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*!  @brief  Initializing the numerical values of S and the singletons:
+ *         computes the row scale factors Rs, if prescaling is enabled, and
+ *         fills Sx, Sux, and Slx with the scaled values of A.  The arrays
+ *         must already be allocated in Num.
+ *
+ *         If check is true, the pattern of A is checked against the pattern
+ *         of S and the singletons in Sym, and PARU_INVALID is returned if
+ *         they differ.  This is used by ParU_Refactorize, where A is a new
+ *         matrix that must have the same pattern as the one analyzed.
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+#define FREE_WORK                           \
+{                                           \
+    PARU_FREE (m + 1, int64_t, cSp);        \
+    PARU_FREE (cs1 + 1, int64_t, cSup);     \
+    PARU_FREE (rs1 + 1, int64_t, cSlp);     \
+}
+
+ParU_Info paru_init_values
+(
+    // input/output:
+    ParU_Numeric Num,
+    // inputs, not modified:
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym,    // symbolic analysis
+    int32_t prescale,           // Control->prescale
+    bool check,                 // if true, check the pattern of A
+    size_t mem_chunk,
+    int32_t nthreads
+)
+{
+    DEBUGLEVEL(0);
+    PARU_DEFINE_PRLEVEL;
+
+    int64_t n1 = Sym->n1;
+    int64_t m = Sym->m - n1;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
+
+    if (check && ((int64_t) A->nrow != Sym->m || (int64_t) A->ncol != Sym->n
+        || !A->packed || static_cast<int64_t*>(A->p)[A->ncol] != Sym->anz))
+    {
+        PRLEVEL(1, ("ParU: pattern of A differs from the analysis\n"));
+        return PARU_INVALID;
+    }
+
+    // workspace:
+    int64_t *cSp = PARU_MALLOC (m + 1, int64_t);  // copy of Sp, for making Sx
+    int64_t *cSup = NULL;   // copy of Sup temporary for making Sux
+    int64_t *cSlp = NULL;   // copyf of Slp temporary, for making Slx
+    if (cs1 > 0) cSup = PARU_MALLOC (cs1 + 1, int64_t);
+    if (rs1 > 0) cSlp = PARU_MALLOC (rs1 + 1, int64_t);
+    if (cSp == NULL || (cs1 > 0 && cSup == NULL) || (rs1 > 0 && cSlp == NULL))
+    {
+        FREE_WORK;
+        return PARU_OUT_OF_MEMORY;
+    }
+
+    int64_t *Ap = static_cast<int64_t*>(A->p);
+    int64_t *Ai = static_cast<int64_t*>(A->i);
+    double *Ax = static_cast<double*>(A->x);
+    const int64_t *Sp = Sym->Sp;
+    const int64_t *Sj = Sym->Sj;
+    const int64_t *Slp = (rs1 > 0) ? Sym->lstons.Slp : NULL ;
+    const int64_t *Sli = (rs1 > 0) ? Sym->lstons.Sli : NULL ;
+    const int64_t *Sup = (cs1 > 0) ? Sym->ustons.Sup : NULL ;
+    const int64_t *Suj = (cs1 > 0) ? Sym->ustons.Suj : NULL ;
+    double *Sx = Num->Sx ;
+    double *Sux = Num->Sux ;
+    double *Slx = Num->Slx ;
+    double *Rs = Num->Rs ;
+    paru_memcpy(cSp, Sp, (m + 1) * sizeof(int64_t), mem_chunk, nthreads) ;
+    if (cs1 > 0)
+    {
+        paru_memcpy(cSup, Sup, (cs1 + 1) * sizeof(int64_t),
+                mem_chunk, nthreads) ;
+    }
+    if (rs1 > 0)
+    {
+        paru_memcpy(cSlp, Slp, (rs1 + 1) * sizeof(int64_t),
+                mem_chunk, nthreads) ;
+    }
+
+    const int64_t *Qinit = Sym->Qfill;
+    const int64_t *Pinv = Sym->Pinv;
+#ifndef NDEBUG
+    PR = 1;
+    PRLEVEL(PR, ("Init Pinv =\n"));
+    for (int64_t i = 0; i < m; i++) PRLEVEL(PR, ("" LD " ", Pinv[i]));
+    PRLEVEL(PR, ("\n"));
+#endif
+
+    // compute the scale factors
+    bool prescaling = (prescale != PARU_PRESCALE_NONE) ;
+    if (prescaling)
+    {
+        paru_memset(Rs, 0, Sym->m * sizeof(double), mem_chunk, nthreads) ;
+    }
+    if (prescale == PARU_PRESCALE_MAX)
+    {
+        // this is the ParU default
+        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+        {
+            int64_t oldcol = Qinit[newcol];
+            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+            {
+                int64_t oldrow = Ai[p];
+                Rs[oldrow] = std::max(Rs[oldrow], fabs(Ax[p]));
+            }
+        }
+    }
+    else if (prescale == PARU_PRESCALE_SUM)
+    {
+        // this is the UMFPACK default
+        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+        {
+            int64_t oldcol = Qinit[newcol];
+            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+            {
+                int64_t oldrow = Ai[p];
+                Rs[oldrow] += fabs(Ax[p]);
+            }
+        }
+    }
+
+    PRLEVEL(PR, ("%% Rs:\n["));
+    if (prescaling)
+    {
+        // making sure that every row has at most one element more than zero
+        for (int64_t k = 0; k < m; k++)
+        {
+            PRLEVEL(PR, ("%lf ", Rs[k]));
+            if (Rs[k] <= 0)
+            {
+                PRLEVEL(1, ("ParU: Matrix is singular, row " LD
+                    " is zero\n", k));
+                Num->res = PARU_SINGULAR;
+                FREE_WORK;
+                return PARU_SINGULAR;
+            }
+        }
+    }
+    PRLEVEL(PR, ("]\n"));
+
+    bool pattern_ok = true;
+    for (int64_t newcol = 0; newcol < Sym->n && pattern_ok; newcol++)
+    {
+        int64_t oldcol = Qinit[newcol];
+        for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+        {
+            int64_t oldrow = Ai[p];
+            int64_t newrow = Pinv[oldrow];
+            int64_t srow = newrow - n1;
+            int64_t scol = newcol - n1;
+            double x = (prescaling) ? (Ax[p] / Rs[oldrow]) : Ax[p];
+            if (srow >= 0 && scol >= 0)
+            {
+                // it is inside S otherwise it is part of singleton
+                int64_t s = cSp[srow]++;
+                if (check && (s >= Sp[srow + 1] || Sj[s] != scol))
+                {
+                    pattern_ok = false;
+                    break;
+                }
+                Sx[s] = x;
+            }
+            else if (srow < 0 && scol >= 0)
+            {
+                // inside the U singletons
+                PRLEVEL(PR, ("Usingleton newcol = " LD " newrow=" LD "\n",
+                    newcol, newrow));
+                // let the diagonal entries be first
+                int64_t s = ++cSup[newrow];
+                if (check && (s >= Sup[newrow + 1] || Suj[s] != newcol))
+                {
+                    pattern_ok = false;
+                    break;
+                }
+                Sux[s] = x;
+            }
+            else
+            {
+                if (newrow < cs1)
+                {
+                    // inside U singletons CSR
+                    int64_t s = (newcol == newrow) ?
+                        Sup[newrow] : ++cSup[newrow];
+                    if (check && (s >= Sup[newrow + 1] || Suj[s] != newcol))
+                    {
+                        pattern_ok = false;
+                        break;
+                    }
+                    Sux[s] = x;
+                }
+                else
+                {
+                    // inside L singletons CSC
+                    int64_t s = (newcol == newrow) ?
+                        Slp[newcol - cs1] : ++cSlp[newcol - cs1];
+                    if (check && (s >= Slp[newcol - cs1 + 1] ||
+                        Sli[s] != newrow))
+                    {
+                        pattern_ok = false;
+                        break;
+                    }
+                    Slx[s] = x;
+                }
+            }
+        }
+    }
+
+    FREE_WORK;
+    if (!pattern_ok)
+    {
+        PRLEVEL(1, ("ParU: pattern of A differs from the analysis\n"));
+        return PARU_INVALID;
+    }
+    return PARU_SUCCESS;
+}
@@ -100,7 +100,8 @@ struct ParU_Symbolic_struct
     int32_t strategy_used ;     // ParU strategy used (symmetric or unsymmetric)
     int32_t umfpack_strategy ;  // UMFPACK strategy used (sym. or unsym.)
     int32_t ordering_used ;     // UMFPACK ordering used
-    int32_t unused ;            // future expansion
+    int32_t view ;              // true if the arrays are held in a blob
+                                // owned by the user (see ParU_Deserialize)
 
     // -------------------------------------------------------------------------
     // frontal matrices: pattern and tree
@@ -245,6 +246,8 @@ struct ParU_Numeric_struct
     int64_t nnzU;       //nnz of U
     double sfc; //simple flop count
     ParU_Info res;  // returning value of numeric phase
+    int32_t view;   // true if the arrays are held in a blob owned by the user
+                    // (see ParU_Deserialize)
 } ;
 
 // =============================================================================
@@ -267,6 +270,7 @@ struct ParU_Control_struct
     int64_t worthwhile_dgemm ;  // dgemms bigger than this are tasked
     int64_t worthwhile_dtrsm ;  // dtrsm bigger than this are tasked
     int64_t prescale ;          // 0: none, 1: scale by sum, 2: scale by max
+    int64_t numa_domains ;      // # of NUMA domains the front tree is mapped to
 
     // Symbolic analysis parameters:
     int64_t strategy ;          // ParU strategy to use
@@ -549,6 +553,28 @@ static int print_level = -1;
 
 #define Size_max ((size_t)(-1))  // the largest value of size_t
 
+// -----------------------------------------------------------------------------
+// serialized ParU_Symbolic and ParU_Numeric objects
+// -----------------------------------------------------------------------------
+
+// A blob starts with a header of PARU_BLOB_HEADER bytes: the int64_t size of
+// the blob, followed by PARU_BLOB_NHEADER int32_t's (PARU_BLOB_MAGIC, the ParU
+// version, PARU_BLOB_FORMAT, PARU_BLOB_ALIGN, the sizes of int64_t, void *,
+// and the struct, the kind of object, and the number of slots in the
+// directory).  Each part of the blob starts at a multiple of PARU_BLOB_ALIGN
+// bytes, so that the arrays can be used in place if the blob itself is
+// suitably aligned.
+
+#define PARU_BLOB_MAGIC 0x55726150      /* "ParU" */
+#define PARU_BLOB_FORMAT 1              /* changed if the layout changes */
+#define PARU_BLOB_ALIGN 64
+#define PARU_BLOB_PAD(x) \
+    ((((int64_t) (x) + PARU_BLOB_ALIGN - 1) / PARU_BLOB_ALIGN) * PARU_BLOB_ALIGN)
+#define PARU_BLOB_HEADER PARU_BLOB_ALIGN
+#define PARU_BLOB_NHEADER 11
+#define PARU_BLOB_SYMBOLIC 1            /* kind of object in the blob */
+#define PARU_BLOB_NUMERIC 2
+
 // internal data structures
 struct heaps_info
 {
@@ -661,6 +687,11 @@ struct paru_work
     int64_t naft;  // number of actvie frontal tasks
     int64_t resq;  // number of remainig ready tasks in the queue
 
+    const int64_t *task_owner;  // size ntasks; NUMA domain of each task, or
+    // -1 for the tasks near the root that are shared by all domains.  NULL if
+    // the factorization is not NUMA-aware.  A task does not execute its
+    // parent if the parent has another owner.
+
     // Control parameters:
     int64_t worthwhile_dgemm ;
     int64_t worthwhile_dtrsm ;
@@ -671,6 +702,7 @@ struct paru_work
     size_t mem_chunk ;
     int32_t nthreads ;
     int32_t prescale ;
+    int64_t numa_domains ;
 
 };
 
@@ -874,6 +906,33 @@ ParU_Info paru_exec_tasks_seq
     ParU_Numeric Num
 ) ;
 
+ParU_Info paru_exec_tasks_numa
+(
+    int64_t ndomains,
+    int64_t *task_num_child,
+    paru_work *Work,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+) ;
+
+ParU_Info paru_tasked_lsolve
+(
+    int64_t nrhs,
+    double *X,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num,
+    ParU_Control Control
+) ;
+
+ParU_Info paru_tasked_usolve
+(
+    int64_t nrhs,
+    double *X,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num,
+    ParU_Control Control
+) ;
+
 paru_element *paru_create_element(int64_t nrows, int64_t ncols);
 
 void paru_assemble_row_2U
@@ -962,6 +1021,19 @@ ParU_Info paru_init_rowFronts
     ParU_Symbolic Sym       // symbolic analysis
 ) ;
 
+ParU_Info paru_init_values
+(
+    // input/output:
+    ParU_Numeric Num,
+    // inputs, not modified:
+    cholmod_sparse *A,
+    const ParU_Symbolic Sym,    // symbolic analysis
+    int32_t prescale,           // Control->prescale
+    bool check,                 // if true, check the pattern of A
+    size_t mem_chunk,
+    int32_t nthreads
+) ;
+
 ParU_Info paru_front
 (
     int64_t f,  // front need to be assembled
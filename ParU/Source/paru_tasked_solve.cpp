@@ -0,0 +1,643 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  paru_tasked_solve.cpp //////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022-2024, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*! @brief  forward and backward solves with the fronts of the LU factors,
+ *          using the task tree of the numeric factorization.
+ *
+ *  Each row of the matrix lives in a chain of fronts, from the front where it
+ *  is first assembled up to the front where it is pivotal.  Thus, in the
+ *  forward solve (L\x, bottom-up), a front writes only the entries of x that
+ *  are pivotal in itself or in its ancestors.  Two tasks that are not on the
+ *  same path of the task tree never touch the same entry of x, and the updates
+ *  to any one entry are applied in the same order as in the sequential solve.
+ *
+ *  In the backward solve (U\x), a front writes only its own pivotal entries of
+ *  x, but it reads the entries for the columns of its U part.  These columns
+ *  are pivotal in later fronts, which are not always its ancestors (with the
+ *  unsymmetric strategy, a column can be pivotal in another subtree).  Each
+ *  task thus waits for all the tasks that hold one of these columns.
+ *  The parallel solves therefore give the same result as the sequential ones.
+ *
+ *  The forward solve follows paru_exec_tasks: the leaf tasks are started in
+ *  order of their depth, and the last child of a task to finish continues
+ *  with its parent.  When only one chain of tasks is left, the rest of the
+ *  chain is done outside the parallel region, with a multithreaded BLAS.
+ *  The backward solve does the reverse: while a single task is ready it is
+ *  done with a multithreaded BLAS, and then each task starts the tasks that
+ *  were waiting only for it, once it is done.
+ *
+ *  The solves are sequential if there are too few leaf tasks to keep the
+ *  threads busy, using the same rule as the numeric factorization.
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+//------------------------------------------------------------------------------
+// paru_lsolve_front: forward solve with the L part of one front
+//------------------------------------------------------------------------------
+
+// X is m-by-nrhs with leading dimension m, and work has size
+// Num->max_row_count * nrhs.
+
+static void paru_lsolve_front
+(
+    int64_t f,
+    int64_t nrhs,
+    double *X,
+    double *work,
+    bool &blas_ok,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    int64_t m = Sym->m;
+    int64_t n1 = Sym->n1;   // row+col singletons
+    const int64_t *Ps = Num->Ps;  // row permutation S->LU
+
+    int64_t rowCount = Num->frowCount[f];
+    const int64_t *frowList = Num->frowList[f];
+    int64_t col1 = Sym->Super[f];
+    int64_t col2 = Sym->Super[f + 1];
+    int64_t fp = col2 - col1;
+    double *A = Num->partial_LUs[f].p;
+    double alpha = 1;
+    double beta = 0;
+
+    PRLEVEL(2, ("%% lsolve front " LD " fp=" LD " rowCount=" LD "\n",
+        f, fp, rowCount));
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_dtrsv("L", "N", "U", fp, A, rowCount, X + n1 + col1,
+            1, blas_ok);
+        if (rowCount > fp)
+        {
+            SUITESPARSE_BLAS_dgemv("N", rowCount - fp, fp, &alpha, A + fp,
+                                   rowCount, X + n1 + col1, 1, &beta, work, 1,
+                                   blas_ok);
+            for (int64_t i = fp; i < rowCount; i++)
+            {
+                int64_t r = Ps[frowList[i]] + n1;
+                X[r] -= work[i - fp];
+            }
+        }
+    }
+    else
+    {
+        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", fp, nrhs, &alpha, A,
+            rowCount, X + n1 + col1, m, blas_ok);
+        if (rowCount > fp)
+        {
+            SUITESPARSE_BLAS_dgemm("N", "N", rowCount - fp, nrhs, fp, &alpha,
+                                   A + fp, rowCount, X + n1 + col1, m, &beta,
+                                   work, rowCount - fp, blas_ok);
+            for (int64_t i = fp; i < rowCount; i++)
+            {
+                int64_t r = Ps[frowList[i]] + n1;
+                for (int64_t l = 0; l < nrhs; l++)
+                {
+                    X[l * m + r] -= work[i - fp + l * (rowCount - fp)];
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// paru_usolve_front: backward solve with the U part of one front
+//------------------------------------------------------------------------------
+
+// X is m-by-nrhs with leading dimension m, and work has size
+// Num->max_col_count * nrhs.
+
+static void paru_usolve_front
+(
+    int64_t f,
+    int64_t nrhs,
+    double *X,
+    double *work,
+    bool &blas_ok,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    int64_t m = Sym->m;
+    int64_t n1 = Sym->n1;   // row+col singletons
+    const int64_t *Ps = Num->Ps;  // row permutation
+
+    const int64_t *frowList = Num->frowList[f];
+    const int64_t *fcolList = Num->fcolList[f];
+    int64_t col1 = Sym->Super[f];
+    int64_t col2 = Sym->Super[f + 1];
+    int64_t fp = col2 - col1;
+    int64_t colCount = Num->fcolCount[f];
+    int64_t rowCount = Num->frowCount[f];
+    double *A1 = Num->partial_LUs[f].p;
+    double *A2 = Num->partial_Us[f].p;
+    double alpha = 1;
+    double beta = 0;
+
+    PRLEVEL(2, ("%% usolve front " LD " fp=" LD " colCount=" LD "\n",
+        f, fp, colCount));
+    if (nrhs == 1)
+    {
+        if (A2 != NULL)
+        {
+            double *xg = work + fp;         // size xg is colCount
+            for (int64_t j = 0; j < colCount; j++)  // gathering x in xg
+            {
+                xg[j] = X[fcolList[j] + n1];
+            }
+            SUITESPARSE_BLAS_dgemv("N", fp, colCount, &alpha, A2, fp, xg, 1,
+                                   &beta, work, 1, blas_ok);
+            for (int64_t i = 0; i < fp; i++)  // scattering the back in to x
+            {
+                int64_t r = Ps[frowList[i]] + n1;
+                X[r] -= work[i];
+            }
+        }
+        SUITESPARSE_BLAS_dtrsv("U", "N", "N", fp, A1, rowCount, X + n1 + col1,
+                               1, blas_ok);
+    }
+    else
+    {
+        if (A2 != NULL)
+        {
+            double *Xg = work + fp * nrhs;     // size Xg is colCount x nrhs
+            for (int64_t j = 0; j < colCount; j++)  // gathering X in Xg
+            {
+                for (int64_t l = 0; l < nrhs; l++)
+                {
+                    Xg[l * colCount + j] = X[l * m + fcolList[j] + n1];
+                }
+            }
+            SUITESPARSE_BLAS_dgemm("N", "N", fp, nrhs, colCount, &alpha, A2, fp,
+                                   Xg, colCount, &beta, work, fp, blas_ok);
+            for (int64_t i = 0; i < fp; i++)  // scattering the back in to X
+            {
+                int64_t r = Ps[frowList[i]] + n1;
+                for (int64_t l = 0; l < nrhs; l++)
+                {
+                    X[l * m + r] -= work[l * fp + i];
+                }
+            }
+        }
+        SUITESPARSE_BLAS_dtrsm("L", "U", "N", "N", fp, nrhs, &alpha, A1,
+                               rowCount, X + n1 + col1, m, blas_ok);
+    }
+}
+
+#if ! defined ( PARU_1TASK )
+
+//------------------------------------------------------------------------------
+// paru_lsolve_tasks: forward solve with one task, and then with its ancestors
+//------------------------------------------------------------------------------
+
+// The last child of a task to finish does its parent, as in paru_exec_tasks.
+// If it is also the last remaining chain of tasks (resq == 1), the parent is
+// left in chain_task, for the caller to do after the parallel region.
+
+static void paru_lsolve_tasks
+(
+    int64_t t,
+    int64_t *task_num_child,
+    int64_t &chain_task,
+    int64_t &resq,
+    int64_t nrhs,
+    double *X,
+    double *Work_space,     // nthreads workspaces, each of size wsize
+    size_t wsize,
+    bool &blas_ok,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    DEBUGLEVEL(0);
+    const int64_t *task_parent = Sym->task_parent;
+    const int64_t *task_map = Sym->task_map;
+
+    // a task is tied to its thread, and the work is done before any other
+    // task can be scheduled on this thread
+    double *work = Work_space + wsize * PARU_OPENMP_GET_THREAD_ID;
+    bool ok = true;
+    for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
+    {
+        paru_lsolve_front(f, nrhs, X, work, ok, Sym, Num);
+    }
+    if (!ok)
+    {
+        #pragma omp atomic write
+        blas_ok = false;
+    }
+
+    int64_t daddy = task_parent[t];
+    if (daddy == -1) return;
+
+    // the parent reads the entries of X this task has just updated
+    int64_t num_rem_children;
+    #pragma omp flush
+    #pragma omp atomic capture
+    {
+        task_num_child[daddy]--;
+        num_rem_children = task_num_child[daddy];
+    }
+    PRLEVEL(1, ("%% lsolve finished task " LD ", parent " LD " has " LD
+        " left\n", t, daddy, num_rem_children));
+    if (num_rem_children != 0) return;
+    #pragma omp flush
+
+    int64_t r;
+    #pragma omp atomic read
+    r = resq;
+    if (r == 1)
+    {
+        PRLEVEL(1, ("%% lsolve chain task " LD "\n", daddy));
+        chain_task = daddy;
+    }
+    else
+    {
+        paru_lsolve_tasks(daddy, task_num_child, chain_task, resq, nrhs, X,
+            Work_space, wsize, blas_ok, Sym, Num);
+    }
+}
+
+//------------------------------------------------------------------------------
+// paru_usolve_tasks: backward solve with one task, and then with its successors
+//------------------------------------------------------------------------------
+
+// Each task waiting for this one is started as a new task once all the tasks
+// it waits for are done.  blas_ok is passed as a pointer since it is shared by
+// all the tasks.
+
+static void paru_usolve_tasks
+(
+    int64_t t,
+    int64_t *task_ndeps,
+    const int64_t *task_succp,
+    const int64_t *task_succ,
+    int64_t nrhs,
+    double *X,
+    double *Work_space,     // nthreads workspaces, each of size wsize
+    size_t wsize,
+    bool *blas_ok,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num
+)
+{
+    const int64_t *task_map = Sym->task_map;
+
+    double *work = Work_space + wsize * PARU_OPENMP_GET_THREAD_ID;
+    bool ok = true;
+    for (int64_t f = task_map[t + 1]; f > task_map[t]; f--)
+    {
+        paru_usolve_front(f, nrhs, X, work, ok, Sym, Num);
+    }
+    if (!ok)
+    {
+        #pragma omp atomic write
+        (*blas_ok) = false;
+    }
+
+    // the successors read the entries of X this task has just computed
+    #pragma omp flush
+    for (int64_t p = task_succp[t]; p < task_succp[t + 1]; p++)
+    {
+        int64_t s = task_succ[p];
+        int64_t num_deps;
+        #pragma omp atomic capture
+        {
+            task_ndeps[s]--;
+            num_deps = task_ndeps[s];
+        }
+        if (num_deps != 0) continue;
+        #pragma omp task firstprivate(s)
+        paru_usolve_tasks(s, task_ndeps, task_succp, task_succ, nrhs, X,
+            Work_space, wsize, blas_ok, Sym, Num);
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// paru_tasked_lsolve: forward solve with all the fronts
+//------------------------------------------------------------------------------
+
+// Solves L*X=B for the fronts of L; the singletons are done by the caller.
+// X is m-by-nrhs with leading dimension m.
+
+ParU_Info paru_tasked_lsolve
+(
+    int64_t nrhs,
+    double *X,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num,
+    ParU_Control Control
+)
+{
+    DEBUGLEVEL(0);
+    int64_t nf = Sym->nf;
+    size_t wsize = Num->max_row_count * nrhs;
+    bool blas_ok = true;
+
+#if ! defined ( PARU_1TASK )
+    int32_t nthreads = paru_nthreads(Control);
+
+    //--------------------------------------------------------------------------
+    // find the leaf tasks
+    //--------------------------------------------------------------------------
+
+    int64_t ntasks = Sym->ntasks;
+    const int64_t *task_depth = Sym->task_depth;
+    int64_t nleaves = 0;
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        if (Sym->task_num_child[t] == 0) nleaves++;
+    }
+
+    if (nthreads > 1 && ntasks > 1 && nleaves * 2 > nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // allocate workspace
+        //----------------------------------------------------------------------
+
+        int64_t *task_num_child = PARU_MALLOC(ntasks, int64_t);
+        int64_t *task_Q = PARU_MALLOC(nleaves, int64_t);
+        double *Work_space = PARU_MALLOC(wsize * nthreads, double);
+        if (task_num_child == NULL || task_Q == NULL || Work_space == NULL)
+        {
+            PRLEVEL(1, ("ParU: out of memory lsolve\n"));
+            PARU_FREE(ntasks, int64_t, task_num_child);
+            PARU_FREE(nleaves, int64_t, task_Q);
+            PARU_FREE(wsize * nthreads, double, Work_space);
+            return (PARU_OUT_OF_MEMORY);
+        }
+
+        nleaves = 0;
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            task_num_child[t] = Sym->task_num_child[t];
+            if (task_num_child[t] == 0) task_Q[nleaves++] = t;
+        }
+        std::sort(task_Q, task_Q + nleaves,
+            [&task_depth](const int64_t &t1, const int64_t &t2) -> bool {
+            return task_depth[t1] > task_depth[t2];
+            });
+
+        //----------------------------------------------------------------------
+        // do the tasks in parallel, bottom-up
+        //----------------------------------------------------------------------
+
+        PRLEVEL(1, ("%% parallel lsolve: " LD " leaf tasks\n", nleaves));
+        BLAS_set_num_threads(1);
+        int64_t chain_task = -1;
+        int64_t resq = nleaves;
+        #pragma omp parallel proc_bind(spread) num_threads(nthreads)
+        #pragma omp single nowait
+        #pragma omp task untied
+        for (int64_t i = 0; i < nleaves; i++)
+        {
+            int64_t t = task_Q[i];
+            int64_t d = task_depth[t];
+            #pragma omp task mergeable priority(d)
+            {
+                paru_lsolve_tasks(t, task_num_child, chain_task, resq, nrhs,
+                    X, Work_space, wsize, blas_ok, Sym, Num);
+                #pragma omp atomic update
+                resq--;
+            }
+        }
+
+        // the rest of the last chain, with a parallel BLAS
+        if (chain_task != -1)
+        {
+            BLAS_set_num_threads(nthreads);
+            resq = 0;
+            paru_lsolve_tasks(chain_task, task_num_child, chain_task, resq,
+                nrhs, X, Work_space, wsize, blas_ok, Sym, Num);
+        }
+
+        PARU_FREE(ntasks, int64_t, task_num_child);
+        PARU_FREE(nleaves, int64_t, task_Q);
+        PARU_FREE(wsize * nthreads, double, Work_space);
+        return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    }
+#endif
+
+    //--------------------------------------------------------------------------
+    // sequential forward solve
+    //--------------------------------------------------------------------------
+
+    double *work = PARU_MALLOC(wsize, double);
+    if (work == NULL)
+    {
+        PRLEVEL(1, ("ParU: out of memory lsolve\n"));
+        return (PARU_OUT_OF_MEMORY);
+    }
+    for (int64_t f = 0; f < nf; f++)
+    {
+        paru_lsolve_front(f, nrhs, X, work, blas_ok, Sym, Num);
+    }
+    PARU_FREE(wsize, double, work);
+    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+}
+
+//------------------------------------------------------------------------------
+// paru_tasked_usolve: backward solve with all the fronts
+//------------------------------------------------------------------------------
+
+// Solves U*X=B for the fronts of U; the singletons are done by the caller.
+// X is m-by-nrhs with leading dimension m.
+
+#define FREE_USOLVE_WORK                                \
+{                                                       \
+    PARU_FREE(ns, int64_t, col_task);                   \
+    PARU_FREE(ntasks, int64_t, task_mark);              \
+    PARU_FREE(ntasks, int64_t, task_ndeps);             \
+    PARU_FREE(ntasks + 2, int64_t, task_succp);         \
+    PARU_FREE(ntasks, int64_t, task_ready);             \
+    PARU_FREE(nsucc, int64_t, task_succ);               \
+    PARU_FREE(wsize * nthreads, double, Work_space);    \
+}
+
+ParU_Info paru_tasked_usolve
+(
+    int64_t nrhs,
+    double *X,
+    const ParU_Symbolic Sym,
+    ParU_Numeric Num,
+    ParU_Control Control
+)
+{
+    DEBUGLEVEL(0);
+    int64_t nf = Sym->nf;
+    size_t wsize = Num->max_col_count * nrhs;
+    bool blas_ok = true;
+
+#if ! defined ( PARU_1TASK )
+    int32_t nthreads = paru_nthreads(Control);
+
+    int64_t ntasks = Sym->ntasks;
+    int64_t nleaves = 0;
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        if (Sym->task_num_child[t] == 0) nleaves++;
+    }
+
+    if (nthreads > 1 && ntasks > 1 && nleaves * 2 > nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // allocate workspace
+        //----------------------------------------------------------------------
+
+        // Task t waits for task_ndeps [t] tasks, and the tasks waiting for
+        // task u are task_succ [task_succp [u] ... task_succp [u+1]-1].
+        // task_succp is counted one entry ahead, in task_succp [u+2].
+        int64_t ns = Sym->Super[nf];
+        const int64_t *task_map = Sym->task_map;
+        int64_t *col_task = PARU_MALLOC(ns, int64_t);
+        int64_t *task_mark = PARU_MALLOC(ntasks, int64_t);
+        int64_t *task_ndeps = PARU_CALLOC(ntasks, int64_t);
+        int64_t *task_succp = PARU_CALLOC(ntasks + 2, int64_t);
+        int64_t *task_ready = PARU_MALLOC(ntasks, int64_t);
+        int64_t *task_succ = NULL;
+        int64_t nsucc = 0;
+        double *Work_space = PARU_MALLOC(wsize * nthreads, double);
+        if (col_task == NULL || task_mark == NULL || task_ndeps == NULL ||
+            task_succp == NULL || task_ready == NULL || Work_space == NULL)
+        {
+            PRLEVEL(1, ("ParU: out of memory usolve\n"));
+            FREE_USOLVE_WORK;
+            return (PARU_OUT_OF_MEMORY);
+        }
+
+        //----------------------------------------------------------------------
+        // find the tasks each task waits for
+        //----------------------------------------------------------------------
+
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            for (int64_t c = Sym->Super[task_map[t] + 1];
+                 c < Sym->Super[task_map[t + 1] + 1]; c++)
+            {
+                col_task[c] = t;
+            }
+        }
+        for (int64_t pass = 0; pass < 2; pass++)
+        {
+            for (int64_t t = 0; t < ntasks; t++) task_mark[t] = -1;
+            for (int64_t t = 0; t < ntasks; t++)
+            {
+                for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
+                {
+                    const int64_t *fcolList = Num->fcolList[f];
+                    for (int64_t j = 0; j < Num->fcolCount[f]; j++)
+                    {
+                        int64_t u = col_task[fcolList[j]];
+                        if (u == t || task_mark[u] == t) continue;
+                        task_mark[u] = t;
+                        if (pass == 0)
+                        {
+                            task_ndeps[t]++;
+                            task_succp[u + 2]++;
+                        }
+                        else
+                        {
+                            task_succ[task_succp[u + 1]++] = t;
+                        }
+                    }
+                }
+            }
+            if (pass == 0)
+            {
+                for (int64_t t = 2; t <= ntasks + 1; t++)
+                {
+                    task_succp[t] += task_succp[t - 1];
+                }
+                nsucc = task_succp[ntasks + 1];
+                task_succ = PARU_MALLOC(nsucc, int64_t);
+                if (task_succ == NULL)
+                {
+                    PRLEVEL(1, ("ParU: out of memory usolve\n"));
+                    FREE_USOLVE_WORK;
+                    return (PARU_OUT_OF_MEMORY);
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // do the tasks one at a time while only one is ready, with a parallel
+        // BLAS
+        //----------------------------------------------------------------------
+
+        int64_t nready = 0;
+        for (int64_t t = ntasks - 1; t >= 0; t--)
+        {
+            if (task_ndeps[t] == 0) task_ready[nready++] = t;
+        }
+        while (nready == 1)
+        {
+            int64_t t = task_ready[0];
+            nready = 0;
+            PRLEVEL(1, ("%% usolve chain task " LD "\n", t));
+            for (int64_t f = task_map[t + 1]; f > task_map[t]; f--)
+            {
+                paru_usolve_front(f, nrhs, X, Work_space, blas_ok, Sym, Num);
+            }
+            for (int64_t p = task_succp[t]; p < task_succp[t + 1]; p++)
+            {
+                int64_t s = task_succ[p];
+                if (--task_ndeps[s] == 0) task_ready[nready++] = s;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // do the rest of the tasks in parallel
+        //----------------------------------------------------------------------
+
+        PRLEVEL(1, ("%% parallel usolve: " LD " ready tasks\n", nready));
+        BLAS_set_num_threads(1);
+        bool *ok = &blas_ok;
+        #pragma omp parallel proc_bind(spread) num_threads(nthreads)
+        #pragma omp single nowait
+        #pragma omp task untied
+        for (int64_t i = 0; i < nready; i++)
+        {
+            int64_t t = task_ready[i];
+            #pragma omp task firstprivate(t)
+            paru_usolve_tasks(t, task_ndeps, task_succp, task_succ, nrhs, X,
+                Work_space, wsize, ok, Sym, Num);
+        }
+
+        FREE_USOLVE_WORK;
+        return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    }
+#endif
+
+    //--------------------------------------------------------------------------
+    // sequential backward solve
+    //--------------------------------------------------------------------------
+
+    double *work = PARU_MALLOC(wsize, double);
+    if (work == NULL)
+    {
+        PRLEVEL(1, ("ParU: out of memory usolve\n"));
+        return (PARU_OUT_OF_MEMORY);
+    }
+    for (int64_t f = nf - 1; f >= 0; --f)
+    {
+        paru_usolve_front(f, nrhs, X, work, blas_ok, Sym, Num);
+    }
+    PARU_FREE(wsize, double, work);
+    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+}
@@ -17,7 +17,9 @@
 {                                           \
     umfpack_dl_free_symbolic(&Symbolic);    \
     umfpack_dl_free_numeric(&Numeric);      \
+    ParU_C_FreeNumeric(&Num2, Control);     \
     ParU_C_FreeNumeric(&Num, Control);      \
+    ParU_C_FreeSymbolic(&Sym2, Control);    \
     ParU_C_FreeSymbolic(&Sym, Control);     \
     ParU_C_FreeControl(&Control);           \
     cholmod_l_free_sparse(&A, cc);          \
@@ -42,6 +44,10 @@
     Q  = NULL ;                             \
     if (R  != NULL) free(R);                \
     R  = NULL ;                             \
+    if (blob != NULL) free(blob);           \
+    blob = NULL ;                           \
+    if (sym_blob != NULL) free(sym_blob);   \
+    sym_blob = NULL ;                       \
 }
 
 #include "paru_cov.hpp"
@@ -51,12 +57,13 @@ int main(int argc, char **argv)
 {
     cholmod_common Common, *cc;
     cholmod_sparse *A;
-    ParU_C_Symbolic Sym = NULL;
-    ParU_C_Numeric Num = NULL ;
+    ParU_C_Symbolic Sym = NULL, Sym2 = NULL ;
+    ParU_C_Numeric Num = NULL, Num2 = NULL ;
     ParU_C_Control Control = NULL ;
     double *b = NULL, *B = NULL, *X = NULL, *xx = NULL, *x = NULL,
            *t = NULL, *T = NULL, *R = NULL ;
     int64_t *P = NULL, *Q = NULL ;
+    int8_t *blob = NULL, *sym_blob = NULL ;
     void *Symbolic = NULL, *Numeric = NULL;
 
     // default log10 of expected residual.  +1 means failure is expected
@@ -458,6 +465,106 @@ int main(int argc, char **argv)
         printf ("AXX error %g\n", err) ;
     }
 
+    // null pointer tests
+    info = ParU_C_Refactorize(NULL, Sym, Num, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_Refactorize(A, NULL, Num, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_Refactorize(A, Sym, NULL, Control);
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    // refactorize, and solve AX=B again
+    BRUTAL_ALLOC_TEST(info, ParU_C_Refactorize(A, Sym, Num, Control));
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        for (int64_t j = 0; j < nrhs; ++j)
+        {
+            B[j * n + i] = (double)(i + j + 1);
+        }
+    }
+    BRUTAL_ALLOC_TEST(info, ParU_C_Solve_AXB(Sym, Num, nrhs, B, X,
+                Control));
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_C_Residual_BAX (A, X, B, nrhs, &resid, &anorm, &xnorm,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf("refactorize mRhs Residual is |%.2e|\n", resid);
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    // serialize Sym and Num
+    int64_t sym_blobsize = 0, num_blobsize = 0 ;
+    info = ParU_C_SerializeSize_Symbolic (NULL, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_SerializeSize_Symbolic (&sym_blobsize, NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_SerializeSize_Numeric (NULL, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_SerializeSize_Numeric (&num_blobsize, NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_SerializeSize_Symbolic (&sym_blobsize, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_C_SerializeSize_Numeric (&num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    sym_blob = (int8_t *) malloc (sym_blobsize) ;
+    TEST_ASSERT (sym_blob != NULL) ;
+    blob = (int8_t *) malloc (num_blobsize) ;
+    TEST_ASSERT (blob != NULL) ;
+
+    info = ParU_C_Serialize_Symbolic (sym_blob, sym_blobsize - 1, Sym,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_Serialize_Numeric (blob, num_blobsize - 1, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_Serialize_Symbolic (sym_blob, sym_blobsize, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_C_Serialize_Numeric (blob, num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    // null pointer tests, and truncated blobs
+    info = ParU_C_Deserialize_Symbolic (sym_blob, sym_blobsize, false, NULL,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_Deserialize_Numeric (blob, num_blobsize, false, NULL, &Num2,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_C_Deserialize_Numeric (blob, num_blobsize, false, Sym, NULL,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    BRUTAL_ALLOC_TEST(info, ParU_C_Deserialize_Symbolic (sym_blob,
+        sym_blobsize - 1, false, &Sym2, Control)) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    TEST_ASSERT (Sym2 == NULL) ;
+    BRUTAL_ALLOC_TEST(info, ParU_C_Deserialize_Numeric (blob,
+        num_blobsize - 1, true, Sym, &Num2, Control)) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    TEST_ASSERT (Num2 == NULL) ;
+
+    // deserialize them as views and as copies, and solve AX=B again
+    for (int view = 1 ; view >= 0 ; view--)
+    {
+        BRUTAL_ALLOC_TEST(info, ParU_C_Deserialize_Symbolic (sym_blob,
+            sym_blobsize, (bool) view, &Sym2, Control)) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        BRUTAL_ALLOC_TEST(info, ParU_C_Deserialize_Numeric (blob,
+            num_blobsize, (bool) view, Sym2, &Num2, Control)) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_C_Solve_AXB (Sym2, Num2, nrhs, B, T, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (memcmp (T, X, n * nrhs * sizeof (double)) == 0) ;
+        info = ParU_C_FreeNumeric (&Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (Num2 == NULL) ;
+        info = ParU_C_FreeSymbolic (&Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (Sym2 == NULL) ;
+    }
+    free (blob) ;
+    blob = NULL ;
+    free (sym_blob) ;
+    sym_blob = NULL ;
+
     //~~~~~~~~~~~~~~~~~~~End computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     int64_t max_threads = omp_get_max_threads();
     omp_set_num_threads (max_threads);
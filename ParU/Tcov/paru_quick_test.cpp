@@ -17,10 +17,15 @@
 
 #define TEST_FREE_ALL                                   \
 {                                                       \
+    ParU_FreeNumeric(&Num2, Control);                   \
     ParU_FreeNumeric(&Num, Control);                    \
+    ParU_FreeSymbolic(&Sym2, Control);                  \
+    ParU_FreeSymbolic(&Sym3, Control);                  \
     ParU_FreeSymbolic(&Sym, Control);                   \
     ParU_FreeControl(&Control);                         \
     cholmod_l_free_sparse(&A, cc);                      \
+    cholmod_l_free_sparse(&A2, cc);                     \
+    cholmod_l_free_sparse(&I, cc);                      \
     cholmod_l_finish(cc);                               \
     if (B  != NULL) { free(B);  B  = NULL; }            \
     if (P  != NULL) { free(P);  P  = NULL; }            \
@@ -32,18 +37,22 @@
     if (b  != NULL) { free(b);  b  = NULL; }            \
     if (x  != NULL) { free(x);  x  = NULL; }            \
     if (xx != NULL) { free(xx); xx = NULL; }            \
+    if (blob != NULL) { free(blob); blob = NULL; }      \
+    if (blob2 != NULL) { free(blob2); blob2 = NULL; }   \
+    if (sym_blob != NULL) { free(sym_blob); sym_blob = NULL; } \
 }
 
 int main(int argc, char **argv)
 {
     cholmod_common Common, *cc;
-    cholmod_sparse *A;
-    ParU_Symbolic Sym = NULL;
-    ParU_Numeric Num = NULL ;
+    cholmod_sparse *A, *A2 = NULL, *I = NULL ;
+    ParU_Symbolic Sym = NULL, Sym2 = NULL, Sym3 = NULL ;
+    ParU_Numeric Num = NULL, Num2 = NULL ;
     ParU_Control Control = NULL ;
     double *b = NULL, *B = NULL, *X = NULL, *xx = NULL, *x = NULL,
         *Scale = NULL, *R = NULL ;
     int64_t *Perm = NULL, *P = NULL, *Q = NULL ;
+    int8_t *blob = NULL, *blob2 = NULL, *sym_blob = NULL ;
     double err = 0 ;
     ParU_Info info;
 
@@ -77,6 +86,7 @@ int main(int argc, char **argv)
     ParU_Set (PARU_CONTROL_ORDERING, ordering, Control) ;
     ParU_Set (PARU_CONTROL_MAX_THREADS, 4, Control) ;
     ParU_Set (PARU_CONTROL_STRATEGY, PARU_STRATEGY_SYMMETRIC, Control) ;
+    ParU_Set (PARU_CONTROL_NUMA_DOMAINS, 2, Control) ;
 
     int64_t nthreads2 = 0 ;
     ParU_Get (PARU_CONTROL_NUM_THREADS, &nthreads2, Control) ;
@@ -199,6 +209,8 @@ int main(int argc, char **argv)
     }
 
     // restore default scaling
+    int64_t prescale_used = PARU_DEFAULT_PRESCALE ;
+    ParU_Get (PARU_CONTROL_PRESCALE, &prescale_used, Control) ;
     info = ParU_Set (PARU_CONTROL_PRESCALE, PARU_DEFAULT_PRESCALE, Control) ;
 
     //~~~~~~~~~~~~~~~~~~~Test the results ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -557,6 +569,377 @@ int main(int argc, char **argv)
     err = err / xnorm ;
     TEST_ASSERT (err < 1e-10) ;
 
+    //--------------------------------------------------------------------------
+    // compare the parallel and sequential solves
+    //--------------------------------------------------------------------------
+
+    // With more than one thread and enough leaf tasks, the solves work on the
+    // tasks of the front tree in parallel; the result must be bitwise the
+    // same as with one thread.
+    int64_t nleaves = 0 ;
+    for (int64_t t = 0 ; t < Sym->ntasks ; t++)
+    {
+        if (Sym->task_num_child [t] == 0) nleaves++ ;
+    }
+    printf ("leaf tasks: %ld\n", nleaves) ;
+    int save_max_threads = omp_get_max_threads ( ) ;
+    omp_set_num_threads (4) ;
+
+    x = (double *)malloc(n * nrhs * sizeof(double));
+    TEST_ASSERT (x != NULL) ;
+    xx = (double *)malloc(n * nrhs * sizeof(double));
+    TEST_ASSERT (xx != NULL) ;
+
+    ParU_Set (PARU_CONTROL_MAX_THREADS, 4, Control) ;
+    info = ParU_Solve(Sym, Num, B, x, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    ParU_Set (PARU_CONTROL_MAX_THREADS, 1, Control) ;
+    info = ParU_Solve(Sym, Num, B, xx, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (memcmp (x, xx, n * sizeof (double)) == 0) ;
+
+    ParU_Set (PARU_CONTROL_MAX_THREADS, 4, Control) ;
+    info = ParU_Solve(Sym, Num, nrhs, B, x, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    ParU_Set (PARU_CONTROL_MAX_THREADS, 1, Control) ;
+    info = ParU_Solve(Sym, Num, nrhs, B, xx, Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (memcmp (x, xx, n * nrhs * sizeof (double)) == 0) ;
+
+    ParU_Set (PARU_CONTROL_MAX_THREADS, 4, Control) ;
+    omp_set_num_threads (save_max_threads) ;
+
+    //--------------------------------------------------------------------------
+    // refactorize
+    //--------------------------------------------------------------------------
+
+    info = ParU_Refactorize (NULL, Sym, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Refactorize (A, NULL, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Refactorize (A, Sym, NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    // Refactorize with the prescaling used by ParU_Factorize.  With its
+    // columns scaled (or its rows, if they are prescaled), the pivots of Num
+    // are still acceptable and the entries that cancelled in ParU_Factorize
+    // still cancel, so the refactorization must succeed.
+    ParU_Set (PARU_CONTROL_PRESCALE, prescale_used, Control) ;
+    A2 = cholmod_l_copy_sparse (A, cc) ;
+    TEST_ASSERT (A2 != NULL) ;
+    int64_t *A2p = (int64_t *) A2->p ;
+    int64_t *A2i = (int64_t *) A2->i ;
+    double *A2x = (double *) A2->x ;
+    double *Ax = (double *) A->x ;
+    for (int64_t j = 0 ; j < n ; j++)
+    {
+        for (int64_t p = A2p [j] ; p < A2p [j+1] ; p++)
+        {
+            int64_t k = (prescale_used == PARU_PRESCALE_NONE) ? j : A2i [p] ;
+            A2x [p] = Ax [p] * (1 + (k % 7) / 10.) ;
+        }
+    }
+
+    info = ParU_Refactorize (A2, Sym, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    info = ParU_Solve (Sym, Num, nrhs, B, X, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Residual (A2, X, B, nrhs, resid, anorm, xnorm, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf ("refactorize Residual is |%.2e|\n", resid) ;
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    // With perturbed values, a pivot may now be too small, or an entry that
+    // cancelled in ParU_Factorize may not.
+    for (int64_t p = 0 ; p < A2p [n] ; p++)
+    {
+        A2x [p] = Ax [p] * (1 + 1e-3 * ((p % 7) - 3)) ;
+    }
+    info = ParU_Refactorize (A2, Sym, Num, Control) ;
+    if (info == PARU_SUCCESS)
+    {
+        info = ParU_Solve (Sym, Num, nrhs, B, X, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Residual (A2, X, B, nrhs, resid, anorm, xnorm, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+        printf ("perturbed refactorize Residual is |%.2e|\n", resid) ;
+        TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+    }
+    else
+    {
+        TEST_ASSERT_INFO (info == PARU_PIVOT_FAILED, info) ;
+        printf ("perturbed refactorize: pivot failed\n") ;
+    }
+
+    // all-zero values without prescaling: the first pivot fails
+    for (int64_t p = 0 ; p < A2p [n] ; p++)
+    {
+        A2x [p] = 0 ;
+    }
+    ParU_Set (PARU_CONTROL_PRESCALE, PARU_PRESCALE_NONE, Control) ;
+    info = ParU_Refactorize (A2, Sym, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_PIVOT_FAILED, info) ;
+    ParU_Set (PARU_CONTROL_PRESCALE, prescale_used, Control) ;
+
+    // Num cannot be used until it is factorized again
+    info = ParU_Solve (Sym, Num, B, x, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Solve (Sym, Num, nrhs, B, X, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_LSolve (Sym, Num, x, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_USolve (Sym, Num, nrhs, X, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    int64_t num_blobsize = 0 ;
+    info = ParU_SerializeSize (&num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Refactorize (A, Sym, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Solve (Sym, Num, nrhs, B, X, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Residual (A, X, B, nrhs, resid, anorm, xnorm, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    // A view of a serialized Num cannot allocate or free its row scale
+    // factors, so the prescaling cannot be changed; it is otherwise
+    // refactorized in place.
+    info = ParU_SerializeSize (&num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    blob = (int8_t *) malloc (num_blobsize) ;
+    TEST_ASSERT (blob != NULL) ;
+    info = ParU_Serialize (blob, num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Deserialize (blob, num_blobsize, true, Sym, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    ParU_Set (PARU_CONTROL_PRESCALE, (prescale_used == PARU_PRESCALE_NONE) ?
+        PARU_PRESCALE_SUM : PARU_PRESCALE_NONE, Control) ;
+    info = ParU_Refactorize (A, Sym, Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    ParU_Set (PARU_CONTROL_PRESCALE, prescale_used, Control) ;
+
+    // Num2 is left unchanged
+    info = ParU_Solve (Sym, Num2, nrhs, B, x, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (memcmp (x, X, n * nrhs * sizeof (double)) == 0) ;
+
+    for (int64_t j = 0 ; j < n ; j++)
+    {
+        for (int64_t p = A2p [j] ; p < A2p [j+1] ; p++)
+        {
+            int64_t k = (prescale_used == PARU_PRESCALE_NONE) ? j : A2i [p] ;
+            A2x [p] = Ax [p] * (1 + (k % 5) / 10.) ;
+        }
+    }
+    info = ParU_Refactorize (A2, Sym, Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Solve (Sym, Num2, nrhs, B, X, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Residual (A2, X, B, nrhs, resid, anorm, xnorm, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    info = ParU_FreeNumeric (&Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    free (blob) ;
+    blob = NULL ;
+    ParU_Set (PARU_CONTROL_PRESCALE, PARU_DEFAULT_PRESCALE, Control) ;
+
+    //--------------------------------------------------------------------------
+    // serialize and deserialize
+    //--------------------------------------------------------------------------
+
+    info = ParU_Solve (Sym, Num, B, xx, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Solve (Sym, Num, nrhs, B, X, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    int64_t sym_blobsize = 0 ;
+    info = ParU_SerializeSize (NULL, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_SerializeSize (&sym_blobsize, (ParU_Symbolic) NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_SerializeSize (NULL, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_SerializeSize (&num_blobsize, (ParU_Numeric) NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_SerializeSize (&sym_blobsize, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_SerializeSize (&num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    printf ("blob sizes: Sym %ld Num %ld\n", sym_blobsize, num_blobsize) ;
+    sym_blob = (int8_t *) malloc (sym_blobsize) ;
+    TEST_ASSERT (sym_blob != NULL) ;
+    blob = (int8_t *) malloc (num_blobsize) ;
+    TEST_ASSERT (blob != NULL) ;
+    blob2 = (int8_t *) malloc (num_blobsize + sizeof (double)) ;
+    TEST_ASSERT (blob2 != NULL) ;
+
+    info = ParU_Serialize (NULL, sym_blobsize, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Serialize (sym_blob, sym_blobsize - 1, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Serialize (NULL, num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Serialize (blob, num_blobsize - 1, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    info = ParU_Serialize (sym_blob, sym_blobsize, Sym, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Serialize (blob, num_blobsize, Num, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    // Views first: freeing them must leave the blobs intact, which the copies
+    // deserialized from the same blobs then check.
+    for (int view = 1 ; view >= 0 ; view--)
+    {
+        BRUTAL_ALLOC_TEST (info, ParU_Deserialize (sym_blob, sym_blobsize,
+            (bool) view, &Sym2, Control)) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        BRUTAL_ALLOC_TEST (info, ParU_Deserialize (blob, num_blobsize,
+            (bool) view, Sym2, &Num2, Control)) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+        // the solves must be bitwise the same as with Sym and Num
+        info = ParU_Solve (Sym2, Num2, B, x, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (memcmp (x, xx, n * sizeof (double)) == 0) ;
+        info = ParU_Solve (Sym2, Num2, nrhs, B, x, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (memcmp (x, X, n * nrhs * sizeof (double)) == 0) ;
+
+        // serializing them again gives the same blobs
+        int64_t size2 = 0 ;
+        info = ParU_SerializeSize (&size2, Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (size2 == sym_blobsize) ;
+        info = ParU_Serialize (blob2, size2, Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (memcmp (blob2, sym_blob, sym_blobsize) == 0) ;
+        info = ParU_SerializeSize (&size2, Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (size2 == num_blobsize) ;
+        info = ParU_Serialize (blob2, size2, Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (memcmp (blob2, blob, num_blobsize) == 0) ;
+
+        info = ParU_FreeNumeric (&Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (Num2 == NULL) ;
+        info = ParU_FreeSymbolic (&Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (Sym2 == NULL) ;
+    }
+
+    // null arguments
+    info = ParU_Deserialize (NULL, sym_blobsize, false, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Deserialize (sym_blob, sym_blobsize, false,
+        (ParU_Symbolic *) NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Deserialize (NULL, num_blobsize, false, Sym, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Deserialize (blob, num_blobsize, false, NULL, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Deserialize (blob, num_blobsize, false, Sym,
+        (ParU_Numeric *) NULL, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    // truncated blobs
+    for (int view = 0 ; view <= 1 ; view++)
+    {
+        info = ParU_Deserialize (sym_blob, sym_blobsize - 1, (bool) view,
+            &Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        TEST_ASSERT (Sym2 == NULL) ;
+        info = ParU_Deserialize (sym_blob, sizeof (int64_t), (bool) view,
+            &Sym2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        info = ParU_Deserialize (blob, num_blobsize - 1, (bool) view, Sym,
+            &Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        TEST_ASSERT (Num2 == NULL) ;
+        info = ParU_Deserialize (blob, sizeof (int64_t), (bool) view, Sym,
+            &Num2, Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    }
+
+    // A blob truncated by one block, with its header changed to match: the
+    // last part of the object is then outside the blob.
+    int64_t short_size = sym_blobsize - PARU_BLOB_ALIGN ;
+    memcpy (sym_blob, &short_size, sizeof (int64_t)) ;
+    info = ParU_Deserialize (sym_blob, short_size, false, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    memcpy (sym_blob, &sym_blobsize, sizeof (int64_t)) ;
+    short_size = num_blobsize - PARU_BLOB_ALIGN ;
+    memcpy (blob, &short_size, sizeof (int64_t)) ;
+    info = ParU_Deserialize (blob, short_size, false, Sym, &Num2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    memcpy (blob, &num_blobsize, sizeof (int64_t)) ;
+
+    // a bad header: each int32_t of it after the ParU version
+    for (int k = 0 ; k < PARU_BLOB_NHEADER ; k++)
+    {
+        if (k >= 1 && k <= 3) continue ;
+        int8_t *h = sym_blob + sizeof (int64_t) + k * sizeof (int32_t) ;
+        (*h) ^= 1 ;
+        info = ParU_Deserialize (sym_blob, sym_blobsize, false, &Sym2,
+            Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        (*h) ^= 1 ;
+        h = blob + sizeof (int64_t) + k * sizeof (int32_t) ;
+        (*h) ^= 1 ;
+        info = ParU_Deserialize (blob, num_blobsize, false, Sym, &Num2,
+            Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        (*h) ^= 1 ;
+    }
+
+    // the wrong kind of blob
+    info = ParU_Deserialize (blob, num_blobsize, false, &Sym2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Deserialize (sym_blob, sym_blobsize, false, Sym, &Num2,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    // a view must be aligned
+    memcpy (blob2 + 1, blob, num_blobsize) ;
+    info = ParU_Deserialize (blob2 + 1, num_blobsize, true, Sym, &Num2,
+        Control) ;
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+
+    // Num must have been computed with Sym
+    I = cholmod_l_speye (n+1, n+1, CHOLMOD_REAL, cc) ;
+    TEST_ASSERT (I != NULL) ;
+    info = ParU_Analyze (I, &Sym3, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    for (int view = 0 ; view <= 1 ; view++)
+    {
+        info = ParU_Deserialize (blob, num_blobsize, (bool) view, Sym3, &Num2,
+            Control) ;
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+        TEST_ASSERT (Num2 == NULL) ;
+    }
+    ParU_FreeSymbolic (&Sym3, Control) ;
+    cholmod_l_free_sparse (&I, cc) ;
+
+    free (blob) ;
+    blob = NULL ;
+    free (blob2) ;
+    blob2 = NULL ;
+    free (sym_blob) ;
+    sym_blob = NULL ;
+
     info = ParU_FreeNumeric (NULL, Control) ;
     TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
 
@@ -823,6 +1206,25 @@ int main(int argc, char **argv)
     TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
     TEST_ASSERT (c == 10000) ;
 
+    c = -1 ;
+    info = ParU_Get (PARU_CONTROL_NUMA_DOMAINS, &c, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (c == PARU_DEFAULT_NUMA_DOMAINS) ;
+
+    c = -1 ;
+    info = ParU_Get (PARU_CONTROL_NUMA_DOMAINS, &c, NULL) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (c == PARU_DEFAULT_NUMA_DOMAINS) ;
+
+    c = -1 ;
+    info = ParU_Set (PARU_CONTROL_NUMA_DOMAINS, 2, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    c = -1 ;
+    info = ParU_Get (PARU_CONTROL_NUMA_DOMAINS, &c, Control) ;
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    TEST_ASSERT (c == 2) ;
+
     // double parameters:
     double z ;
 
@@ -12,10 +12,10 @@
 #define GPUQRENGINE_HPP
 
 // Version information:
-#define GPUQRENGINE_DATE "June 20, 2024"
+#define GPUQRENGINE_DATE "Oct 19, 2026"
 #define GPUQRENGINE_MAIN_VERSION   4
-#define GPUQRENGINE_SUB_VERSION    3
-#define GPUQRENGINE_SUBSUB_VERSION 4
+#define GPUQRENGINE_SUB_VERSION    4
+#define GPUQRENGINE_SUBSUB_VERSION 0
 
 #define GPUQRENGINE_VER_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
 #define GPUQRENGINE_VERSION \
@@ -12,10 +12,10 @@
 #define SUITESPARSE_GPURUNTIME_HPP
 
 // Version information:
-#define SUITESPARSE_GPURUNTIME_DATE "June 20, 2024"
+#define SUITESPARSE_GPURUNTIME_DATE "Oct 19, 2026"
 #define SUITESPARSE_GPURUNTIME_MAIN_VERSION   4
-#define SUITESPARSE_GPURUNTIME_SUB_VERSION    3
-#define SUITESPARSE_GPURUNTIME_SUBSUB_VERSION 4
+#define SUITESPARSE_GPURUNTIME_SUB_VERSION    4
+#define SUITESPARSE_GPURUNTIME_SUBSUB_VERSION 0
 
 #define SUITESPARSE_GPURUNTIME_VER_CODE(main,sub) \
     SUITESPARSE_VER_CODE(main,sub)
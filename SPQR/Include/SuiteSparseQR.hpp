@@ -219,6 +219,14 @@ template <typename Int = int64_t> struct spqr_symbolic
 
     spqr_gpu_impl <Int> *QRgpu ;
 
+    // -------------------------------------------------------------------------
+    // serialization
+    // -------------------------------------------------------------------------
+
+    int view ;      // TRUE if the arrays above are held in a serialized blob
+                    // (see SuiteSparseQR_deserialize), and not owned by this
+                    // object.  The QRgpu object is not serialized.
+
 } ;
 
 
@@ -308,6 +316,15 @@ template <typename Entry, typename Int = int64_t> struct spqr_numeric
                                  // front F
     Int maxfm ;     // max (Hm [0:nf-1]), computed only if H kept
 
+    // -------------------------------------------------------------------------
+    // serialization
+    // -------------------------------------------------------------------------
+
+    int view ;      // TRUE if the arrays and the stacks are held in a
+                    // serialized blob (see SuiteSparseQR_deserialize).  The
+                    // Rblock and Stacks pointer arrays are always owned by
+                    // this object.
+
 } ;
 extern template struct spqr_numeric <double, int32_t>;
 extern template struct spqr_numeric <Complex, int32_t>;
@@ -315,6 +332,49 @@ extern template struct spqr_numeric <Complex, int32_t>;
 extern template struct spqr_numeric <double, int64_t>;
 extern template struct spqr_numeric <Complex, int64_t>;
 
+// =============================================================================
+// === spqr_rupdate ============================================================
+// =============================================================================
+
+// The R factor of a QR factorization after rows have been appended to A by
+// SuiteSparseQR_append_rows.  R is n-by-n and upper triangular, in the column
+// order of A*E (where E is QR->Q1fill), and is held by rows in a pool that
+// grows as fill-in occurs.  The diagonal entry R(j,j) is the first entry in
+// row j, unless row j is empty.  Row j is dead if it is empty or if R(j,j) is
+// zero.
+
+template <typename Entry, typename Int = int64_t> struct spqr_rupdate
+{
+    Int n ;             // R is n-by-n
+    Int m ;             // number of rows of A, including all appended rows
+    Int rank ;          // number of nonzero diagonal entries of R
+
+    Int *Rp ;           // size n.  Row j is in Rj and Rx [Rp [j] ...
+    Int *Rlen ;         // size n.  ... Rp [j] + Rlen [j] - 1]
+    Int *Rcap ;         // size n.  Space reserved for row j
+    Int *Rrot ;         // size n.  Number of rotations applied to row j
+    Int *Rj ;           // size rsize, column indices of R
+    Entry *Rx ;         // size rsize, numerical values of R
+    Int rsize ;         // size of Rj and Rx
+    Int rused ;         // Rj and Rx [0..rused-1] are in use
+
+    Int rnz ;           // nnz (R)
+    Int rnz0 ;          // nnz (R) when it was taken from the factorization
+    Int maxrot ;        // max (Rrot [0..n-1])
+    Int nrhs ;          // number of columns of C = Q'*B updated with R
+
+    Int *Qinv ;         // size n.  Qinv [QR->Q1fill [j]] = j
+
+    // workspace for SuiteSparseQR_append_rows, kept to avoid O(n) work when
+    // only a few rows are appended:
+    Int *Heap ;         // size n, pattern of the row being rotated into R
+    Int *Sp ;           // size n, all EMPTY except while finding the pattern
+                        // of R after the new rows are appended
+    char *Mark ;        // size n, all zero except during a row update
+    Entry *W ;          // size n, the row being rotated into R
+    Entry *Y ;          // size n, row j of R, scattered
+} ;
+
 // =============================================================================
 // === SuiteSparseQR_factorization =============================================
 // =============================================================================
@@ -360,6 +420,15 @@ template <typename Entry, typename Int = int64_t> struct SuiteSparseQR_factoriza
                                  // ranges from 0 to min(m,n)
 
     int allow_tol ;     // if TRUE, do rank detection
+
+    // R after rows have been appended by SuiteSparseQR_append_rows; NULL if
+    // no rows have been appended.  If present, SuiteSparseQR_solve uses this
+    // R, and Q is no longer available.
+    spqr_rupdate <Entry, Int> *QRup ;
+
+    int view ;          // TRUE if R1p, ..., HP1inv are held in a serialized
+                        // blob (see SuiteSparseQR_deserialize).  Rmap and
+                        // RmapInv are never held in the blob.
 } ;
 
 
@@ -571,6 +640,21 @@ SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_factorize
     cholmod_common *cc
 ) ;
 
+// Q-less QR factorization: the same as SuiteSparseQR_factorize, except that
+// the Householder vectors are discarded as each front is factorized, so only
+// R is kept.  SuiteSparseQR_qmult cannot be used with the result; use
+// SuiteSparseQR_csne to solve a least-squares problem instead.
+template <typename Entry, typename Int = int64_t>
+SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_qless_factorize
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
 template <typename Entry, typename Int = int64_t> cholmod_dense *SuiteSparseQR_solve    // returns X
 (
     // inputs, not modified:
@@ -591,7 +675,8 @@ template <typename Entry, typename Int = int64_t> cholmod_sparse *SuiteSparseQR_
     cholmod_common *cc
 ) ;
 
-// returns Y of size m-by-n, or NULL on failure
+// returns Y of size m-by-n, or NULL on failure.  Blocks of columns of X (or
+// rows, for X*Q and X*Q') are done in parallel with cc->SPQR_nthreads threads.
 template <typename Entry, typename Int = int64_t> cholmod_dense *SuiteSparseQR_qmult
 (
     // inputs, not modified
@@ -620,6 +705,76 @@ template <typename Entry, typename Int = int64_t> int SuiteSparseQR_free
     cholmod_common *cc
 ) ;
 
+// Append rows to the factorization of A, so that QR becomes the factorization
+// of [A ; Anew], and optionally apply the same transformation to C = Q'*B.
+// Returns 1 if the rows were appended, 0 if they were appended but the fill-in
+// or rotation budget has been exceeded (the caller should then refactorize the
+// whole matrix with SuiteSparseQR_factorize), or EMPTY on failure.
+template <typename Entry, typename Int = int64_t> int SuiteSparseQR_append_rows
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    double fill_budget,     // refactorize if nnz(R) grows by more than this
+                            // factor; <= 0 means SPQR_DEFAULT_FILL_BUDGET
+    double rot_budget,      // refactorize if any row of R has been rotated
+                            // more than this many times; <= 0 means
+                            // SPQR_DEFAULT_ROTATION_BUDGET
+    // input/output
+    SuiteSparseQR_factorization <Entry, Int> *QR, // of an m-by-n matrix A
+    cholmod_dense *C,       // at least n-by-nrhs: Q'*B on the first call,
+                            // updated on output (with zero rows of B if Bnew
+                            // is NULL).  May be NULL only if it was NULL in
+                            // all prior calls, and Bnew is NULL.
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+// Return the size in bytes of the serialized form of a QR factorization from
+// SuiteSparseQR_factorize, SuiteSparseQR_symbolic, or SuiteSparseQR_numeric,
+// or EMPTY on error.
+template <typename Entry, typename Int = int64_t> int64_t
+SuiteSparseQR_serialize_size
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_common *cc
+) ;
+
+// Serialize a QR factorization into a blob of bytes, which can be written to
+// a file and read back (or memory-mapped) by another process.  Returns TRUE
+// if successful, FALSE otherwise.
+template <typename Entry, typename Int = int64_t> int SuiteSparseQR_serialize
+(
+    int8_t *blob,           // output: of size blobsize, allocated on input
+    int64_t blobsize,       // size of blob, >= SuiteSparseQR_serialize_size
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_common *cc
+) ;
+
+// Construct a QR factorization from a blob created by SuiteSparseQR_serialize.
+// If view is TRUE, the arrays of the factorization are used in place, and the
+// blob must remain unchanged until the factorization is freed.  Otherwise,
+// the blob is copied and can be freed at once.
+template <typename Entry, typename Int = int64_t>
+SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_deserialize
+(
+    int8_t *blob,           // input: serialized blob
+    int64_t blobsize,       // size of blob
+    int view,               // if TRUE, use the blob in place
+    cholmod_common *cc
+) ;
+
+// X = A\B for a least-squares problem, with the corrected semi-normal
+// equations: R'*R*X = A'*B, using only R from QR, followed by one step of
+// iterative refinement.  Returns X of size n-by-nrhs, or NULL on failure.
+template <typename Entry, typename Int = int64_t> cholmod_dense *SuiteSparseQR_csne
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR, // of an m-by-n sparse A
+    cholmod_sparse *A,      // the m-by-n sparse matrix factorized by QR
+    cholmod_dense *B,       // right-hand-side, m-by-nrhs
+    cholmod_common *cc      // workspace and parameters
+) ;
+
 // find the min 2-norm solution to a sparse linear system
 template <typename Entry, typename Int = int64_t> cholmod_dense *SuiteSparseQR_min2norm
 (
@@ -699,6 +854,35 @@ extern template int SuiteSparseQR_numeric <Complex, int64_t>
     SuiteSparseQR_factorization <Complex, int64_t> *QR,
     cholmod_common *cc      // workspace and parameters
 ) ;
+
+// Returns TRUE if the symbolic analysis in QR was computed for a matrix with
+// the same size and nonzero pattern as A, so that it can be reused by
+// SuiteSparseQR_numeric to factorize A.  FALSE otherwise.
+template <typename Entry, typename Int = int64_t> int
+SuiteSparseQR_symbolic_matches
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_sparse *A,      // sparse matrix to compare with (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+
+// QR factorization that reuses a cached symbolic analysis.  If the analysis
+// in *QRhandle matches the pattern of A, it is reused and only the numeric
+// factorization is done.  Otherwise, *QRhandle is freed (if not NULL) and
+// replaced with a new analysis of A from SuiteSparseQR_symbolic, with rank
+// detection allowed.  Returns 2 if the analysis was reused, 1 if A was
+// analyzed, and 0 on failure (with *QRhandle freed and set to NULL).
+template <typename Entry, typename Int = int64_t> int
+SuiteSparseQR_factorize_cached
+(
+    int ordering,           // all, except 3:given treated as 0:fixed; used
+                            // only if A is analyzed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <Entry, Int> **QRhandle,
+    cholmod_common *cc      // workspace and parameters
+) ;
 #endif
 
 #endif
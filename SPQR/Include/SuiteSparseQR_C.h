@@ -240,6 +240,104 @@ cholmod_dense *SuiteSparseQR_C_qmult /* returns Y, or NULL on failure */
     cholmod_common *cc          /* workspace and parameters */
 ) ;
 
+/* ========================================================================== */
+/* === SuiteSparseQR_C_qless_factorize ====================================== */
+/* ========================================================================== */
+
+/*
+    Q-less QR factorization: the same as SuiteSparseQR_C_factorize, except
+    that only R is kept.  SuiteSparseQR_C_qmult cannot be used with the
+    result.  SuiteSparseQR_C_csne solves the least-squares problem
+    min norm (A*X-B) with the corrected semi-normal equations R'*R*X = A'*B,
+    with one step of iterative refinement, and returns X (n-by-nrhs), or
+    NULL on failure.
+*/
+
+SuiteSparseQR_C_factorization *SuiteSparseQR_C_qless_factorize
+(
+    int ordering,               /* all, except 3:given treated as 0:fixed */
+    double tol,                 /* columns with 2-norm <= tol treated as 0 */
+    cholmod_sparse *A,          /* m-by-n sparse matrix */
+    cholmod_common *cc          /* workspace and parameters */
+) ;
+
+cholmod_dense *SuiteSparseQR_C_csne /* returns X, or NULL on failure */
+(
+    SuiteSparseQR_C_factorization *QR,  /* of an m-by-n sparse matrix A */
+    cholmod_sparse *A,          /* the m-by-n sparse matrix factorized by QR */
+    cholmod_dense *B,           /* right-hand-side, m-by-nrhs */
+    cholmod_common *cc          /* workspace and parameters */
+) ;
+
+/* ========================================================================== */
+/* === SuiteSparseQR_C_append_rows ========================================== */
+/* ========================================================================== */
+
+/*
+    Appends the rows Anew to the matrix A factorized by SuiteSparseQR_C_factorize
+    and updates R, and C = Q'*B if C is present (Bnew NULL means the new rows
+    of B are zero).  Returns 1 on success, 0 if the rows were appended but the
+    matrix should be refactorized, or -1 on failure.  Q is not available after
+    rows are appended.
+*/
+
+int SuiteSparseQR_C_append_rows
+(
+    cholmod_sparse *Anew,       /* k-by-n, the rows to append to A */
+    cholmod_dense *Bnew,        /* k-by-nrhs, the rows to append to B, or NULL */
+    double fill_budget,         /* <= 0: SPQR_DEFAULT_FILL_BUDGET */
+    double rot_budget,          /* <= 0: SPQR_DEFAULT_ROTATION_BUDGET */
+    SuiteSparseQR_C_factorization *QR,  /* of an m-by-n sparse matrix A */
+    cholmod_dense *C,           /* Q'*B, at least n-by-nrhs, updated, or NULL */
+    cholmod_common *cc          /* workspace and parameters */
+) ;
+
+/* ========================================================================== */
+/* === SuiteSparseQR_C_serialize ============================================ */
+/* ========================================================================== */
+
+/*
+    Serializes a QR factorization into a single array of bytes (a blob) that
+    can be written to a file and read back by another process with
+    SuiteSparseQR_C_deserialize.  The blob must be allocated by the caller,
+    with a size given by SuiteSparseQR_C_serialize_size (which returns -1 on
+    failure).  SuiteSparseQR_C_serialize returns 1 on success, 0 on failure.
+    A QR factorization modified by SuiteSparseQR_C_append_rows cannot be
+    serialized.
+*/
+
+int64_t SuiteSparseQR_C_serialize_size
+(
+    SuiteSparseQR_C_factorization *QR,  /* the QR factorization to serialize */
+    cholmod_common *cc                  /* workspace and parameters */
+) ;
+
+int SuiteSparseQR_C_serialize
+(
+    int8_t *blob,                       /* output: the serialized QR */
+    int64_t blobsize,                   /* >= SuiteSparseQR_C_serialize_size */
+    SuiteSparseQR_C_factorization *QR,  /* the QR factorization to serialize */
+    cholmod_common *cc                  /* workspace and parameters */
+) ;
+
+/*
+    Constructs a QR factorization from a blob.  If view is nonzero, the arrays
+    of the factorization are used in place, and the blob must remain valid
+    until the factorization is freed by SuiteSparseQR_C_free.  This allows a
+    file containing the blob to be memory-mapped (read-only) and used without
+    copying it.  The blob must then be aligned to a multiple of 8 bytes.
+    Returns NULL if the blob is invalid, or was created on a platform with
+    different integer or pointer sizes.
+*/
+
+SuiteSparseQR_C_factorization *SuiteSparseQR_C_deserialize
+(
+    int8_t *blob,                       /* input: the serialized QR */
+    int64_t blobsize,                   /* size of the blob, in bytes */
+    int view,                           /* if nonzero, use the blob in place */
+    cholmod_common *cc                  /* workspace and parameters */
+) ;
+
 #endif
 
 void SuiteSparseQR_C_version (int version [3]) ;
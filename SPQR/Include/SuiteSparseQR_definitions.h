@@ -33,6 +33,10 @@
 #define SPQR_DEFAULT_TOL (-2)       /* if tol <= -2, the default tol is used */
 #define SPQR_NO_TOL (-1)            /* if -2 < tol < 0, then no tol is used */
 
+/* refactorization budgets for SuiteSparseQR_append_rows: */
+#define SPQR_DEFAULT_FILL_BUDGET 2      /* nnz(R) may grow by this factor */
+#define SPQR_DEFAULT_ROTATION_BUDGET 10000  /* max rotations on a row of R */
+
 /* for qmult, method can be 0,1,2,3: */
 #define SPQR_QTX 0
 #define SPQR_QX  1
@@ -64,23 +68,23 @@
         #endif
  */
 
-#define SPQR_DATE "June 20, 2024"
+#define SPQR_DATE "Oct 19, 2026"
 #define SPQR_MAIN_VERSION   4
-#define SPQR_SUB_VERSION    3
-#define SPQR_SUBSUB_VERSION 4
+#define SPQR_SUB_VERSION    4
+#define SPQR_SUBSUB_VERSION 0
 
 #define SPQR_VER_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
-#define SPQR_VERSION SPQR_VER_CODE(4,3)
+#define SPQR_VERSION SPQR_VER_CODE(4,4)
 
-#define SPQR__VERSION SUITESPARSE__VERCODE(4,3,4)
+#define SPQR__VERSION SUITESPARSE__VERCODE(4,4,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,0))
-#error "SPQR 4.3.4 requires SuiteSparse_config 7.8.0 or later"
+#error "SPQR 4.4.0 requires SuiteSparse_config 7.8.0 or later"
 #endif
 
 #if !defined (CHOLMOD__VERSION) || \
     (CHOLMOD__VERSION < SUITESPARSE__VERCODE(5,3,0))
-#error "SPQR 4.3.4 requires CHOLMOD 5.3.0 or later"
+#error "SPQR 4.4.0 requires CHOLMOD 5.3.0 or later"
 #endif
 
 #endif
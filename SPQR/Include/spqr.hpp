@@ -85,6 +85,28 @@
 #define FLIP(i) (-(i)-2)
 #define UNFLIP(i) (((i) < EMPTY) ? FLIP (i) : (i))
 
+// -----------------------------------------------------------------------------
+// layout of a serialized QR factorization (see SuiteSparseQR_serialize.cpp)
+// -----------------------------------------------------------------------------
+
+// A blob starts with a header of SPQR_BLOB_HEADER bytes: the int64_t size of
+// the blob, followed by SPQR_BLOB_NHEADER int32_t's (SPQR_BLOB_MAGIC, the
+// SPQR version, SPQR_BLOB_FORMAT, SPQR_BLOB_ALIGN, the sizes of Entry, Int,
+// void *, and the three structs, whether or not the numeric factorization is
+// present, and the number of arrays in the directory).  Each part of the blob
+// starts at a multiple of SPQR_BLOB_ALIGN bytes, so that the arrays can be
+// used in place if the blob itself is suitably aligned.
+
+#define SPQR_BLOB_MAGIC 0x52515053      /* "SPQR" */
+#define SPQR_BLOB_FORMAT 1              /* changed if the layout changes */
+#define SPQR_BLOB_ALIGN 64
+#define SPQR_BLOB_PAD(x) \
+    ((((int64_t) (x) + SPQR_BLOB_ALIGN - 1) / SPQR_BLOB_ALIGN) * SPQR_BLOB_ALIGN)
+#define SPQR_BLOB_HEADER SPQR_BLOB_ALIGN
+#define SPQR_BLOB_NHEADER 14
+#define SPQR_BLOB_ENTRY_SIZE 6          /* position of sizeof (Entry) */
+#define SPQR_BLOB_INT_SIZE 7            /* position of sizeof (Int) */
+
 // -----------------------------------------------------------------------------
 // additional include files
 // -----------------------------------------------------------------------------
@@ -340,6 +362,54 @@ template <typename Entry, typename Int = int64_t> void spqr_freefac
     cholmod_common *cc
 ) ;
 
+template <typename Entry, typename Int = int64_t> spqr_rupdate <Entry, Int> *
+spqr_rupdate_init
+(
+    // inputs, not modified
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    Int nrhs,               // number of columns of C = Q'*B updated with R
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template <typename Entry, typename Int = int64_t> void spqr_rupdate_expand
+(
+    // input, not modified
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+
+    // input/output
+    Int nrhs,               // number of columns of C
+    Int ldc,                // leading dimension of C
+    Entry *C                // Q'*B on input, rows permuted to match R on
+                            // output.  Ignored if NULL.
+) ;
+
+template <typename Entry, typename Int = int64_t> void spqr_rupdate_free
+(
+    spqr_rupdate <Entry, Int> **QRup_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template <typename Entry, typename Int = int64_t> void spqr_rupdate_solve
+(
+    // inputs, not modified
+    int system,             // SPQR_RX_EQUALS_B, ... SPQR_RTX_EQUALS_ETB
+    spqr_rupdate <Entry, Int> *QRup,
+    Int *Q1fill,            // size n, column permutation E (NULL: identity)
+    Int nrhs,               // number of columns of B
+    Int ldb,                // leading dimension of B
+    Entry *B,               // size n-by-nrhs with leading dimension ldb
+
+    // output, contents undefined on input
+    Entry *X,               // size n-by-nrhs or m-by-nrhs, with leading
+                            // dimension n or m
+    // workspace
+    Entry *W                // size n
+) ;
+
 template <typename Int = int64_t> void spqr_stranspose1
 (
     // input, not modified
@@ -361,7 +431,9 @@ template <typename Int = int64_t> void spqr_stranspose1
                         // Sleft [n+1]-1 gives the empty rows of S.
 
     // workspace, not defined on input or output
-    Int *W             // size m
+    Int *W,            // size m
+
+    cholmod_common *cc
 ) ;
 
 
@@ -381,7 +453,36 @@ template <typename Entry, typename Int = int64_t> void spqr_stranspose2
     Entry *Sx,          // size nz, numerical values of S
 
     // workspace, not defined on input or output
-    Int *W             // size m
+    Int *W,            // size m
+
+    cholmod_common *cc
+) ;
+
+template <typename Int = int64_t> Int *spqr_ptranspose_work
+(
+    // input, not modified
+    cholmod_sparse *A,      // m-by-n
+    Int extra,              // additional workspace per thread
+
+    // output
+    int *p_nthreads,        // number of threads to use
+    size_t *p_wsize,        // size of the workspace
+
+    cholmod_common *cc
+) ;
+
+template <typename Int = int64_t> void spqr_ptranspose_scan
+(
+    Int m,
+    Int *X,                 // size m+1
+    int nthreads,
+    Int *Psum               // workspace of size nthreads
+) ;
+
+template <typename Int = int64_t> cholmod_sparse *spqr_ptranspose
+(
+    cholmod_sparse *A,      // m-by-n
+    cholmod_common *cc
 ) ;
 
 
@@ -377,9 +377,12 @@ spqr_cpp_src = {
     '../Source/spqr_rhpack', ...
     '../Source/spqr_rmap', ...
     '../Source/spqr_rsolve', ...
+    '../Source/spqr_rupdate', ...
+    '../Source/spqr_rupdate_solve', ...
     '../Source/spqr_shift', ...
     '../Source/spqr_stranspose1', ...
     '../Source/spqr_stranspose2', ...
+    '../Source/spqr_ptranspose', ...
     '../Source/spqr_trapezoidal', ...
     '../Source/spqr_type', ...
     '../Source/spqr_tol', ...
@@ -387,6 +390,8 @@ spqr_cpp_src = {
     '../Source/SuiteSparseQR_qmult', ...
     '../Source/SuiteSparseQR', ...
     '../Source/SuiteSparseQR_expert', ...
+    '../Source/SuiteSparseQR_append_rows', ...
+    '../Source/SuiteSparseQR_serialize', ...
     '../Source/spqr_cholmod_wrappers', ...
     '../MATLAB/spqr_mx' } ;
 
@@ -50,7 +50,7 @@ int spqr_mx_config (int64_t spumoni, cholmod_common *cc)
     cc->SPQR_grain = 1 ;    // opts.grain
     cc->SPQR_small = 1e6 ;  // opts.small
     cc->SPQR_shrink = 1 ;   // controls SPQR shrink realloc
-    cc->SPQR_nthreads = 0 ; // number of TBB threads (0 = default)
+    cc->SPQR_nthreads = 0 ; // number of OpenMP threads (0 = default)
 
     return (TRUE) ;
 }
@@ -328,14 +328,14 @@ int spqr_mx_get_options
     opts->tol = x_present ? x : SPQR_DEFAULT_TOL ;
 
     // -------------------------------------------------------------------------
-    // cc->SPQR_grain: defaults to 1 (no TBB parallelism)
+    // cc->SPQR_grain: defaults to 1 (no task parallelism)
     // -------------------------------------------------------------------------
 
     get_option (mxopts, "grain", &x, &x_present, NULL, cc) ;
     cc->SPQR_grain = x_present ? x : 1 ;
 
     // -------------------------------------------------------------------------
-    // cc->SPQR_small: defaults to 1e6 (min flop count in a TBB task)
+    // cc->SPQR_small: defaults to 1e6 (min flop count in a task)
     // -------------------------------------------------------------------------
 
     get_option (mxopts, "small", &x, &x_present, NULL, cc) ;
@@ -353,7 +353,7 @@ int spqr_mx_get_options
     // cc->SPQR_nthreads: defaults to 0; # of threads to use
     // -------------------------------------------------------------------------
 
-    // nthreads = 0 means to use the TBB default
+    // nthreads = 0 means to use the OpenMP default
     get_option (mxopts, "nthreads", &x, &x_present, NULL, cc) ;
     cc->SPQR_nthreads = x_present ? ((int) x) : 0 ;
     cc->SPQR_nthreads = MAX (0, cc->SPQR_nthreads) ;
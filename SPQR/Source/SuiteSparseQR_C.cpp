@@ -547,6 +547,307 @@ cholmod_dense *SuiteSparseQR_C_qmult
     }
 }
 
+// =============================================================================
+// === SuiteSparseQR_C_qless_factorize =========================================
+// =============================================================================
+
+SuiteSparseQR_C_factorization *SuiteSparseQR_C_qless_factorize
+(
+    // inputs:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // columns with 2-norm <= tol are treated as 0
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_common *cc      // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (FALSE) ;
+    RETURN_IF_NULL (A, NULL) ;
+    cc->status = CHOLMOD_OK ;
+
+    SuiteSparseQR_C_factorization *QR ;
+    QR = (SuiteSparseQR_C_factorization *) (A->itype == CHOLMOD_INT ?
+        spqr_malloc <int32_t> (1, sizeof (SuiteSparseQR_C_factorization), cc) :
+        spqr_malloc <int64_t> (1, sizeof (SuiteSparseQR_C_factorization), cc)) ;
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        return (NULL) ;
+    }
+    QR->xtype = A->xtype ;
+    QR->itype = A->itype ;
+
+    if (A->itype == CHOLMOD_INT)
+    {
+        QR->factors = (A->xtype == CHOLMOD_REAL) ?
+        ((void *) SuiteSparseQR_qless_factorize <double, int32_t>  (ordering, tol, A, cc)) :
+        ((void *) SuiteSparseQR_qless_factorize <Complex, int32_t> (ordering, tol, A, cc)) ;
+    }
+    else
+    {
+        QR->factors = (A->xtype == CHOLMOD_REAL) ?
+        ((void *) SuiteSparseQR_qless_factorize <double, int64_t>  (ordering, tol, A, cc)) :
+        ((void *) SuiteSparseQR_qless_factorize <Complex, int64_t> (ordering, tol, A, cc)) ;
+    }
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        SuiteSparseQR_C_free (&QR, cc) ;
+    }
+    return (QR) ;
+}
+
+// =============================================================================
+// === SuiteSparseQR_C_csne ====================================================
+// =============================================================================
+
+cholmod_dense *SuiteSparseQR_C_csne
+(
+    SuiteSparseQR_C_factorization *QR,  // of an m-by-n sparse matrix A
+    cholmod_sparse *A,          // the m-by-n sparse matrix factorized by QR
+    cholmod_dense *B,           // right-hand-side, m-by-nrhs
+    cholmod_common *cc          // workspace and parameters
+)
+{
+    RETURN_IF_NULL (QR, NULL) ;
+    if (QR->xtype == CHOLMOD_REAL)
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_csne (
+            (SuiteSparseQR_factorization <double, int32_t>  *) QR->factors, A, B, cc) ;
+        }
+        else
+        {
+            return SuiteSparseQR_csne (
+            (SuiteSparseQR_factorization <double, int64_t>  *) QR->factors, A, B, cc) ;
+        }
+    }
+    else
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_csne (
+            (SuiteSparseQR_factorization <Complex, int32_t>  *) QR->factors, A, B, cc) ;
+        }
+        else
+        {
+            return SuiteSparseQR_csne (
+            (SuiteSparseQR_factorization <Complex, int64_t>  *) QR->factors, A, B, cc) ;
+        }
+    }
+}
+
+// =============================================================================
+// === SuiteSparseQR_C_append_rows =============================================
+// =============================================================================
+
+// Appends the rows Anew to the matrix A factorized by SuiteSparseQR_C_factorize
+// and updates R, and C = Q'*B if C is present (Bnew NULL means the new rows of
+// B are zero).
+
+// returns 1 on success, 0 if A should be refactorized, or -1 on failure
+int SuiteSparseQR_C_append_rows
+(
+    cholmod_sparse *Anew,       // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,        // k-by-nrhs, the rows to append to B, or NULL
+    double fill_budget,         // <= 0: SPQR_DEFAULT_FILL_BUDGET
+    double rot_budget,          // <= 0: SPQR_DEFAULT_ROTATION_BUDGET
+    SuiteSparseQR_C_factorization *QR,  // of an m-by-n sparse matrix A
+    cholmod_dense *C,           // Q'*B, at least n-by-nrhs, updated, or NULL
+    cholmod_common *cc          // workspace and parameters
+)
+{
+    RETURN_IF_NULL (QR, EMPTY) ;
+    if (QR->xtype == CHOLMOD_REAL)
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_append_rows (Anew, Bnew, fill_budget,
+                rot_budget, (SuiteSparseQR_factorization <double, int32_t> *)
+                QR->factors, C, cc) ;
+        }
+        else
+        {
+            return SuiteSparseQR_append_rows (Anew, Bnew, fill_budget,
+                rot_budget, (SuiteSparseQR_factorization <double, int64_t> *)
+                QR->factors, C, cc) ;
+        }
+    }
+    else
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_append_rows (Anew, Bnew, fill_budget,
+                rot_budget, (SuiteSparseQR_factorization <Complex, int32_t> *)
+                QR->factors, C, cc) ;
+        }
+        else
+        {
+            return SuiteSparseQR_append_rows (Anew, Bnew, fill_budget,
+                rot_budget, (SuiteSparseQR_factorization <Complex, int64_t> *)
+                QR->factors, C, cc) ;
+        }
+    }
+}
+
+// =============================================================================
+// === SuiteSparseQR_C_serialize_size ==========================================
+// =============================================================================
+
+// Returns the size of the blob needed by SuiteSparseQR_C_serialize, in bytes,
+// or -1 on failure.
+
+int64_t SuiteSparseQR_C_serialize_size
+(
+    SuiteSparseQR_C_factorization *QR,  // the QR factorization to serialize
+    cholmod_common *cc                  // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (EMPTY) ;
+    RETURN_IF_NULL (QR, EMPTY) ;
+    if (QR->xtype == CHOLMOD_REAL)
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_serialize_size (
+            (SuiteSparseQR_factorization <double, int32_t> *) QR->factors, cc) ;
+        }
+        else
+        {
+            return SuiteSparseQR_serialize_size (
+            (SuiteSparseQR_factorization <double, int64_t> *) QR->factors, cc) ;
+        }
+    }
+    else
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_serialize_size (
+            (SuiteSparseQR_factorization <Complex, int32_t> *) QR->factors, cc);
+        }
+        else
+        {
+            return SuiteSparseQR_serialize_size (
+            (SuiteSparseQR_factorization <Complex, int64_t> *) QR->factors, cc);
+        }
+    }
+}
+
+// =============================================================================
+// === SuiteSparseQR_C_serialize ===============================================
+// =============================================================================
+
+// Serializes a QR factorization into a blob of size blobsize, allocated on
+// input.  Returns TRUE if successful, FALSE otherwise.
+
+int SuiteSparseQR_C_serialize
+(
+    int8_t *blob,                       // output: the serialized QR
+    int64_t blobsize,                   // >= SuiteSparseQR_C_serialize_size
+    SuiteSparseQR_C_factorization *QR,  // the QR factorization to serialize
+    cholmod_common *cc                  // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (FALSE) ;
+    RETURN_IF_NULL (QR, FALSE) ;
+    if (QR->xtype == CHOLMOD_REAL)
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_serialize (blob, blobsize,
+            (SuiteSparseQR_factorization <double, int32_t> *) QR->factors, cc) ;
+        }
+        else
+        {
+            return SuiteSparseQR_serialize (blob, blobsize,
+            (SuiteSparseQR_factorization <double, int64_t> *) QR->factors, cc) ;
+        }
+    }
+    else
+    {
+        if (QR->itype == CHOLMOD_INT)
+        {
+            return SuiteSparseQR_serialize (blob, blobsize,
+            (SuiteSparseQR_factorization <Complex, int32_t> *) QR->factors, cc);
+        }
+        else
+        {
+            return SuiteSparseQR_serialize (blob, blobsize,
+            (SuiteSparseQR_factorization <Complex, int64_t> *) QR->factors, cc);
+        }
+    }
+}
+
+// =============================================================================
+// === SuiteSparseQR_C_deserialize =============================================
+// =============================================================================
+
+// Constructs a QR factorization from a blob created by
+// SuiteSparseQR_C_serialize.  The entry and integer types are taken from the
+// blob header.  If view is TRUE, the blob is used in place and must not be
+// freed or modified until the QR factorization is freed.
+
+SuiteSparseQR_C_factorization *SuiteSparseQR_C_deserialize
+(
+    int8_t *blob,                       // input: the serialized QR
+    int64_t blobsize,                   // size of the blob, in bytes
+    int view,                           // if TRUE, use the blob in place
+    cholmod_common *cc                  // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (blob, NULL) ;
+    cc->status = CHOLMOD_OK ;
+
+    // get the sizes of Entry and Int from the blob header
+    int32_t h [SPQR_BLOB_NHEADER] ;
+    if (blobsize < SPQR_BLOB_HEADER)
+    {
+        ERROR (CHOLMOD_INVALID, "invalid blob") ;
+        return (NULL) ;
+    }
+    memcpy (h, blob + sizeof (int64_t), SPQR_BLOB_NHEADER * sizeof (int32_t)) ;
+    int xtype = (h [SPQR_BLOB_ENTRY_SIZE] == sizeof (double)) ?
+        CHOLMOD_REAL : CHOLMOD_COMPLEX ;
+    int itype = (h [SPQR_BLOB_INT_SIZE] == sizeof (int32_t)) ?
+        CHOLMOD_INT : CHOLMOD_LONG ;
+
+    SuiteSparseQR_C_factorization *QR ;
+    QR = (SuiteSparseQR_C_factorization *) (itype == CHOLMOD_INT ?
+        spqr_malloc <int32_t> (1, sizeof (SuiteSparseQR_C_factorization), cc) :
+        spqr_malloc <int64_t> (1, sizeof (SuiteSparseQR_C_factorization), cc)) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        return (NULL) ;
+    }
+    QR->xtype = xtype ;
+    QR->itype = itype ;
+
+    if (itype == CHOLMOD_INT)
+    {
+        QR->factors = (xtype == CHOLMOD_REAL) ?
+        ((void *) SuiteSparseQR_deserialize <double, int32_t>
+            (blob, blobsize, view, cc)) :
+        ((void *) SuiteSparseQR_deserialize <Complex, int32_t>
+            (blob, blobsize, view, cc)) ;
+    }
+    else
+    {
+        QR->factors = (xtype == CHOLMOD_REAL) ?
+        ((void *) SuiteSparseQR_deserialize <double, int64_t>
+            (blob, blobsize, view, cc)) :
+        ((void *) SuiteSparseQR_deserialize <Complex, int64_t>
+            (blob, blobsize, view, cc)) ;
+    }
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        SuiteSparseQR_C_free (&QR, cc) ;
+    }
+    return (QR) ;
+}
+
 // =============================================================================
 // === SuiteSparseQR_C_version =================================================
 // =============================================================================
@@ -0,0 +1,711 @@
+// =============================================================================
+// === SuiteSparseQR_append_rows ===============================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Append rows to a QR factorization, for streaming least-squares problems in
+// which rows of A (and B) arrive over time.  If QR is the factorization of A,
+// then on output it is the factorization of [A ; Anew], and C = Q'*B is
+// updated to Q'*[B ; Bnew], where Q is the orthogonal factor of the updated
+// factorization.  The basic solution of min ||[A;Anew]*X - [B;Bnew]|| is then
+// X = SuiteSparseQR_solve (SPQR_RETX_EQUALS_B, QR, C, cc).  If Bnew is NULL,
+// the new rows of B are zero, and C is still updated, since the rotations
+// that fold Anew into R also mix the rows of C.  C may be NULL only if it was
+// NULL in all prior calls for this factorization, in which case only R is
+// updated.
+//
+// Each new row is rotated into R with a sequence of Givens rotations, one for
+// each entry in the row, in increasing column order (the method of George and
+// Heath).  The first call copies R from the factorization into a row-oriented
+// form (QR->QRup) that can grow as fill-in occurs.  The Householder vectors
+// are not updated, so Q itself is no longer available once rows have been
+// appended: SuiteSparseQR_qmult cannot be used, and C must be provided by the
+// caller and updated along with R.  A subsequent SuiteSparseQR_numeric
+// discards all appended rows.
+//
+// The rows of R that are dead (because A is rank deficient) stay in their
+// place in the column order of A*E, and are brought to life if a new row has
+// an entry in that column.  The column ordering E is not changed, so R tends
+// to fill in as more rows are appended.  The return value is 0 if nnz(R) has
+// grown by more than fill_budget times its size in the original factorization,
+// or if any row of R has been updated by more than rot_budget rotations (since
+// the rounding error grows with the number of rotations).  In this case the
+// rows have still been appended, but the caller should factorize the whole
+// matrix [A ; Anew] from scratch.
+//
+// Returns 1 on success, 0 if the rows were appended but QR should be
+// recomputed, and EMPTY on error (cc->status is set).  The pattern of R after
+// the new rows are appended is found first, without numerical values, and
+// all the memory needed is allocated before QR or C are modified.  If the
+// method runs out of memory, QR and C are left as they were on input, with
+// any rows appended by prior calls, and the rows can be appended again.
+
+#ifndef NEXPERT
+#include "spqr.hpp"
+
+// =============================================================================
+// === spqr_heap_push ==========================================================
+// =============================================================================
+
+// Add j to the min-heap Heap [0..hlen-1]
+
+template <typename Int> static void spqr_heap_push
+(
+    Int j,
+    Int *Heap,
+    Int *hlen
+)
+{
+    Int k = (*hlen)++ ;
+    while (k > 0)
+    {
+        Int parent = (k-1) / 2 ;
+        if (Heap [parent] <= j) break ;
+        Heap [k] = Heap [parent] ;
+        k = parent ;
+    }
+    Heap [k] = j ;
+}
+
+// =============================================================================
+// === spqr_heap_pop ===========================================================
+// =============================================================================
+
+// Remove and return the smallest entry of the min-heap Heap [0..hlen-1]
+
+template <typename Int> static Int spqr_heap_pop
+(
+    Int *Heap,
+    Int *hlen
+)
+{
+    Int jmin = Heap [0] ;
+    Int j = Heap [--(*hlen)] ;
+    Int n = *hlen ;
+    Int k = 0 ;
+    while (2*k+1 < n)
+    {
+        Int child = 2*k+1 ;
+        if (child+1 < n && Heap [child+1] < Heap [child]) child++ ;
+        if (j <= Heap [child]) break ;
+        Heap [k] = Heap [child] ;
+        k = child ;
+    }
+    Heap [k] = j ;
+    return (jmin) ;
+}
+
+// =============================================================================
+// === spqr_givens =============================================================
+// =============================================================================
+
+// Construct a rotation G = [c s ; -conj(s) c] with c real, so that
+// G * [x ; y] = [r ; 0].
+
+inline void spqr_givens (double x, double y, double *c, double *s, double *r)
+{
+    if (x == 0)
+    {
+        *c = 0 ;
+        *s = 1 ;
+        *r = y ;
+    }
+    else
+    {
+        double rho = SuiteSparse_config_hypot (x, y) ;
+        double alpha = (x > 0) ? 1 : -1 ;
+        *c = fabs (x) / rho ;
+        *s = alpha * y / rho ;
+        *r = alpha * rho ;
+    }
+}
+
+inline void spqr_givens (Complex x, Complex y, double *c, Complex *s,
+    Complex *r)
+{
+    if (x == (Complex) 0)
+    {
+        *c = 0 ;
+        *s = 1 ;
+        *r = y ;
+    }
+    else
+    {
+        double ax = spqr_abs (x) ;
+        double rho = SuiteSparse_config_hypot (ax, spqr_abs (y)) ;
+        Complex alpha = x / ax ;
+        *c = ax / rho ;
+        *s = alpha * spqr_conj (y) / rho ;
+        *r = alpha * rho ;
+    }
+}
+
+// =============================================================================
+// === spqr_append_symbolic ====================================================
+// =============================================================================
+
+// Find the pattern of each row of R that grows when the rows of Anew are
+// appended, ignoring numerical cancellation (every entry of the new row is
+// assumed to be nonzero when it is eliminated).  The numerical update can
+// only skip rotations, so the length found for row j is an upper bound on its
+// length at any time during the numerical update.  R itself is not modified.
+//
+// The new pattern of row j is held in Spool [s+3 ... s+3+len-1], where
+// s = Sp [j], Spool [s] = j, Spool [s+1] = len, and Spool [s+2] is the space
+// reserved for the row.  Sp [j] is EMPTY if row j does not grow.  Spool is
+// reallocated as needed.  Returns FALSE if out of memory, with Mark all zero.
+
+template <typename Entry, typename Int> static int spqr_append_symbolic
+(
+    spqr_rupdate <Entry, Int> *QRup,
+    cholmod_sparse *AT,         // n-by-k, the transpose of Anew
+    Int **Spool_handle,
+    size_t *ssize,              // size of Spool
+    Int *sused,                 // Spool [0..sused-1] is in use
+    cholmod_common *cc
+)
+{
+    Int *ATp = (Int *) AT->p ;
+    Int *ATi = (Int *) AT->i ;
+    Int *Qinv = QRup->Qinv ;
+    Int *Heap = QRup->Heap ;
+    Int *Sp = QRup->Sp ;
+    char *Mark = QRup->Mark ;
+    Int *Spool = *Spool_handle ;
+    Int k = AT->ncol ;
+    Int i, j, p, s, h, t, len, rlen, hlen, *Rrow ;
+
+    for (i = 0 ; i < k ; i++)
+    {
+        hlen = 0 ;
+        for (p = ATp [i] ; p < ATp [i+1] ; p++)
+        {
+            j = Qinv [ATi [p]] ;
+            if (!Mark [j])
+            {
+                Mark [j] = TRUE ;
+                spqr_heap_push (j, Heap, &hlen) ;
+            }
+        }
+
+        while (hlen > 0)
+        {
+            // add the off-diagonal pattern of row j to the pattern of the
+            // new row, using the new pattern of row j if it has grown
+            j = spqr_heap_pop (Heap, &hlen) ;
+            Mark [j] = FALSE ;
+            s = Sp [j] ;
+            rlen = (s == EMPTY) ? QRup->Rlen [j] : Spool [s+1] ;
+            Rrow = (s == EMPTY) ? (QRup->Rj + QRup->Rp [j]) : (Spool + s+3) ;
+            for (t = 1 ; t < rlen ; t++)
+            {
+                Int col = Rrow [t] ;
+                if (!Mark [col])
+                {
+                    Mark [col] = TRUE ;
+                    spqr_heap_push (col, Heap, &hlen) ;
+                }
+            }
+
+            // the new row j is the diagonal and the pattern of the new row.
+            // It contains the old row j, so it is the same if no longer.
+            len = hlen + 1 ;
+            if (len <= rlen)
+            {
+                continue ;
+            }
+            if (s == EMPTY || Spool [s+2] < len)
+            {
+                // place row j at the end of Spool, with room to grow
+                int ok = TRUE ;
+                Int cap = spqr_add (len, len/2, &ok) ;
+                Int snew = spqr_add (spqr_add (*sused, cap, &ok), (Int) 3,
+                    &ok) ;
+                if (ok && snew > (Int) (*ssize))
+                {
+                    Spool = (Int *) spqr_realloc <Int> (
+                        spqr_add (snew, snew, &ok), sizeof (Int), Spool, ssize,
+                        cc) ;
+                    *Spool_handle = Spool ;
+                }
+                if (!ok || cc->status < CHOLMOD_OK)
+                {
+                    // out of memory, or Int overflow
+                    for (h = 0 ; h < hlen ; h++)
+                    {
+                        Mark [Heap [h]] = FALSE ;
+                    }
+                    if (!ok)
+                    {
+                        ERROR (CHOLMOD_OUT_OF_MEMORY, "problem too large") ;
+                    }
+                    return (FALSE) ;
+                }
+                s = *sused ;
+                Sp [j] = s ;
+                Spool [s] = j ;
+                Spool [s+2] = cap ;
+                *sused = snew ;
+            }
+            Spool [s+1] = len ;
+            Spool [s+3] = j ;
+            for (h = 0 ; h < hlen ; h++)
+            {
+                Spool [s+4+h] = Heap [h] ;
+            }
+        }
+    }
+    return (TRUE) ;
+}
+
+// =============================================================================
+// === spqr_append_reserve =====================================================
+// =============================================================================
+
+// Reserve room in the pool of R for each row that grows, as found by
+// spqr_append_symbolic, so that the numerical update does not allocate any
+// memory.  Each such row is moved to the end of the pool, with some extra
+// space for future growth.  If the pool is too small, all rows are first
+// copied into a new and larger pool.  Rows are only moved, so R itself is
+// not changed.  Returns FALSE if out of memory, in which case QRup is
+// unchanged.
+
+template <typename Entry, typename Int> static int spqr_append_reserve
+(
+    spqr_rupdate <Entry, Int> *QRup,
+    Int *Spool,
+    Int sused,
+    cholmod_common *cc
+)
+{
+    Int *Rp = QRup->Rp ;
+    Int *Rlen = QRup->Rlen ;
+    Int *Rcap = QRup->Rcap ;
+    Int *Sp = QRup->Sp ;
+    Int n = QRup->n ;
+    Int i, j, k, p, s, len, pnew, need ;
+
+    // -------------------------------------------------------------------------
+    // find the space needed for the rows that grow
+    // -------------------------------------------------------------------------
+
+    int ok = TRUE ;
+    need = 0 ;
+    for (s = 0 ; s < sused ; s += Spool [s+2] + 3)
+    {
+        j = Spool [s] ;
+        len = Spool [s+1] ;
+        if (Sp [j] == s && len > Rlen [j])
+        {
+            need = spqr_add (need, spqr_add (len, len/2 + 1, &ok), &ok) ;
+        }
+    }
+    if (!ok)
+    {
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "problem too large") ;
+        return (FALSE) ;
+    }
+
+    if (need > QRup->rsize - QRup->rused)
+    {
+
+        // ---------------------------------------------------------------------
+        // compact R into a new pool, leaving room for R to double in size
+        // ---------------------------------------------------------------------
+
+        Int rsize = spqr_add (QRup->rnz, need, &ok) ;
+        rsize = spqr_add (spqr_add (rsize, rsize, &ok), n, &ok) ;
+        if (!ok)
+        {
+            ERROR (CHOLMOD_OUT_OF_MEMORY, "problem too large") ;
+            return (FALSE) ;
+        }
+        Int *Rj = (Int *) spqr_malloc <Int> (rsize, sizeof (Int), cc) ;
+        Entry *Rx = (Entry *) spqr_malloc <Int> (rsize, sizeof (Entry), cc) ;
+        if (cc->status < CHOLMOD_OK)
+        {
+            // out of memory
+            spqr_free <Int> (rsize, sizeof (Int),   Rj, cc) ;
+            spqr_free <Int> (rsize, sizeof (Entry), Rx, cc) ;
+            return (FALSE) ;
+        }
+        pnew = 0 ;
+        for (i = 0 ; i < n ; i++)
+        {
+            p = Rp [i] ;
+            Rp [i] = pnew ;
+            Rcap [i] = Rlen [i] ;
+            for (k = 0 ; k < Rlen [i] ; k++)
+            {
+                Rj [pnew + k] = QRup->Rj [p + k] ;
+                Rx [pnew + k] = QRup->Rx [p + k] ;
+            }
+            pnew += Rlen [i] ;
+        }
+        spqr_free <Int> (QRup->rsize, sizeof (Int),   QRup->Rj, cc) ;
+        spqr_free <Int> (QRup->rsize, sizeof (Entry), QRup->Rx, cc) ;
+        QRup->Rj = Rj ;
+        QRup->Rx = Rx ;
+        QRup->rsize = rsize ;
+        QRup->rused = pnew ;
+    }
+
+    // -------------------------------------------------------------------------
+    // move each row that grows to the end of the pool
+    // -------------------------------------------------------------------------
+
+    for (s = 0 ; s < sused ; s += Spool [s+2] + 3)
+    {
+        j = Spool [s] ;
+        len = Spool [s+1] ;
+        if (Sp [j] == s && len > Rcap [j])
+        {
+            Int *Rj = QRup->Rj ;
+            Entry *Rx = QRup->Rx ;
+            p = Rp [j] ;
+            pnew = QRup->rused ;
+            for (k = 0 ; k < Rlen [j] ; k++)
+            {
+                Rj [pnew + k] = Rj [p + k] ;
+                Rx [pnew + k] = Rx [p + k] ;
+            }
+            Rp [j] = pnew ;
+            Rcap [j] = len + len/2 + 1 ;
+            QRup->rused += Rcap [j] ;
+            ASSERT (QRup->rused <= QRup->rsize) ;
+        }
+    }
+    return (TRUE) ;
+}
+
+// =============================================================================
+// === SuiteSparseQR_append_rows ===============================================
+// =============================================================================
+
+#define FREE_WORK \
+{ \
+    spqr_free_sparse <Int> (&AT, cc) ; \
+    spqr_free <Int> (nrhs, sizeof (Entry), Bk, cc) ; \
+    spqr_free <Int> (ssize, sizeof (Int), Spool, cc) ; \
+}
+
+template <typename Entry, typename Int> int SuiteSparseQR_append_rows
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    double fill_budget,     // refactorize if nnz(R) grows by more than this
+                            // factor; <= 0 means SPQR_DEFAULT_FILL_BUDGET
+    double rot_budget,      // refactorize if any row of R has been rotated
+                            // more than this many times; <= 0 means
+                            // SPQR_DEFAULT_ROTATION_BUDGET
+    // input/output
+    SuiteSparseQR_factorization <Entry, Int> *QR, // of an m-by-n matrix A
+    cholmod_dense *C,       // at least n-by-nrhs: Q'*B on the first call,
+                            // updated on output.  May be NULL only if it
+                            // was NULL in all prior calls, and Bnew is NULL.
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    cholmod_sparse *AT ;
+    spqr_rupdate <Entry, Int> *QRup ;
+    Entry *Bx, *Cx, *Bk, *Rx, *W, *Y ;
+    Int *ATp, *ATi, *Rp, *Rlen, *Rj, *Qinv, *Heap, *Sp, *Spool ;
+    char *Mark ;
+    Entry *ATx ;
+    Int n, k, nrhs, ldb, ldc, i, j, p, pend, len, hlen, h, kk, ps, sused ;
+    size_t ssize ;
+
+    RETURN_IF_NULL_COMMON (EMPTY) ;
+    RETURN_IF_NULL (QR, EMPTY) ;
+    RETURN_IF_NULL (QR->QRnum, EMPTY) ;
+    RETURN_IF_NULL (Anew, EMPTY) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (Anew, EMPTY) ;
+    if (Bnew != NULL)
+    {
+        RETURN_IF_NULL (C, EMPTY) ;
+        RETURN_IF_XTYPE_INVALID (Bnew, EMPTY) ;
+    }
+    if (C != NULL)
+    {
+        RETURN_IF_XTYPE_INVALID (C, EMPTY) ;
+    }
+    cc->status = CHOLMOD_OK ;
+
+    n = QR->nacols ;
+    k = Anew->nrow ;
+    nrhs = (C != NULL) ? C->ncol : 0 ;
+
+    if ((Int) Anew->ncol != n || QR->bncols > 0)
+    {
+        ERROR (CHOLMOD_INVALID, "Anew invalid") ;
+        return (EMPTY) ;
+    }
+    if ((C != NULL && (Int) C->nrow < n) || (Bnew != NULL &&
+        ((Int) Bnew->nrow != k || (Int) Bnew->ncol != nrhs)))
+    {
+        ERROR (CHOLMOD_INVALID, "Bnew or C invalid") ;
+        return (EMPTY) ;
+    }
+    if (QR->QRup != NULL && QR->QRup->nrhs != nrhs)
+    {
+        // C must be updated in every call, or in none of them
+        ERROR (CHOLMOD_INVALID, "C does not match prior calls") ;
+        return (EMPTY) ;
+    }
+
+    if (fill_budget <= 0)
+    {
+        fill_budget = SPQR_DEFAULT_FILL_BUDGET ;
+    }
+    if (rot_budget <= 0)
+    {
+        rot_budget = SPQR_DEFAULT_ROTATION_BUDGET ;
+    }
+
+    Cx  = (C != NULL) ? ((Entry *) C->x) : NULL ;
+    ldc = (C != NULL) ? C->d : 0 ;
+    Bx  = (Bnew != NULL) ? ((Entry *) Bnew->x) : NULL ;
+    ldb = (Bnew != NULL) ? Bnew->d : 0 ;
+
+    // -------------------------------------------------------------------------
+    // get R in row-oriented form, on the first call
+    // -------------------------------------------------------------------------
+
+    // QR->QRup and C are not modified until all memory has been allocated
+    QRup = QR->QRup ;
+    int first = (QRup == NULL) ;
+    if (first)
+    {
+        QRup = spqr_rupdate_init (QR, nrhs, cc) ;
+        if (cc->status < CHOLMOD_OK)
+        {
+            // out of memory
+            return (EMPTY) ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // get the rows of Anew, and workspace for one row of Bnew
+    // -------------------------------------------------------------------------
+
+    Bk = NULL ;
+    Spool = NULL ;
+    ssize = 0 ;
+    sused = 0 ;
+    AT = spqr_transpose <Int> (Anew, 1, cc) ;
+    Bk = (Entry *) spqr_malloc <Int> (nrhs, sizeof (Entry), cc) ;
+
+    // -------------------------------------------------------------------------
+    // reserve room in R for the fill-in from the new rows
+    // -------------------------------------------------------------------------
+
+    int ok = (cc->status == CHOLMOD_OK) &&
+        spqr_append_symbolic (QRup, AT, &Spool, &ssize, &sused, cc) &&
+        spqr_append_reserve (QRup, Spool, sused, cc) ;
+
+    // restore Sp to all EMPTY
+    Sp = QRup->Sp ;
+    for (ps = 0 ; ps < sused ; ps += Spool [ps+2] + 3)
+    {
+        Sp [Spool [ps]] = EMPTY ;
+    }
+
+    if (!ok)
+    {
+        // out of memory: QR and C are unchanged
+        FREE_WORK ;
+        if (first)
+        {
+            spqr_rupdate_free (&QRup, cc) ;
+        }
+        return (EMPTY) ;
+    }
+
+    if (first)
+    {
+        // permute C to match the rows of R
+        spqr_rupdate_expand (QR, nrhs, ldc, Cx) ;
+        QR->QRup = QRup ;
+    }
+
+    ATp = (Int *) AT->p ;
+    ATi = (Int *) AT->i ;
+    ATx = (Entry *) AT->x ;
+
+    Qinv = QRup->Qinv ;
+    Heap = QRup->Heap ;
+    Mark = QRup->Mark ;
+    W = QRup->W ;
+    Y = QRup->Y ;
+    Rp = QRup->Rp ;
+    Rlen = QRup->Rlen ;
+    Rj = QRup->Rj ;
+    Rx = QRup->Rx ;
+
+    // -------------------------------------------------------------------------
+    // rotate each new row into R
+    // -------------------------------------------------------------------------
+
+    for (i = 0 ; i < k ; i++)
+    {
+
+        // ---------------------------------------------------------------------
+        // scatter row i of Anew*E into W, and row i of Bnew (or zero) into Bk
+        // ---------------------------------------------------------------------
+
+        hlen = 0 ;
+        for (p = ATp [i] ; p < ATp [i+1] ; p++)
+        {
+            j = Qinv [ATi [p]] ;
+            W [j] += ATx [p] ;
+            if (!Mark [j])
+            {
+                Mark [j] = TRUE ;
+                spqr_heap_push (j, Heap, &hlen) ;
+            }
+        }
+        for (kk = 0 ; kk < nrhs ; kk++)
+        {
+            Bk [kk] = (Bx != NULL) ? Bx [i + kk*ldb] : 0 ;
+        }
+
+        // ---------------------------------------------------------------------
+        // eliminate the entries of W in increasing column order
+        // ---------------------------------------------------------------------
+
+        while (hlen > 0)
+        {
+            j = spqr_heap_pop (Heap, &hlen) ;
+            Mark [j] = FALSE ;
+            Entry wj = W [j] ;
+            W [j] = 0 ;
+            if (wj == (Entry) 0)
+            {
+                // nothing to eliminate in this column
+                continue ;
+            }
+
+            // scatter the off-diagonal part of row j of R into Y, and add its
+            // pattern to the pattern of W
+            p = Rp [j] ;
+            pend = p + Rlen [j] ;
+            Entry rjj = (p < pend) ? Rx [p] : 0 ;
+            for (p++ ; p < pend ; p++)
+            {
+                Int col = Rj [p] ;
+                Y [col] = Rx [p] ;
+                if (!Mark [col])
+                {
+                    Mark [col] = TRUE ;
+                    spqr_heap_push (col, Heap, &hlen) ;
+                }
+            }
+
+            // the new row j has the diagonal and the pattern of W (which is
+            // all in columns j+1 to n-1), and spqr_append_reserve has left
+            // room for it
+            len = hlen + 1 ;
+            ASSERT (len <= QRup->Rcap [j]) ;
+
+            // apply the rotation to row j of R and the new row
+            double c ;
+            Entry s, r ;
+            spqr_givens (rjj, wj, &c, &s, &r) ;
+            p = Rp [j] ;
+            if (rjj == (Entry) 0)
+            {
+                // row j of R was dead and is now alive
+                QRup->rank++ ;
+            }
+            Rj [p] = j ;
+            Rx [p] = r ;
+            for (h = 0 ; h < hlen ; h++)
+            {
+                Int col = Heap [h] ;
+                Entry y = Y [col] ;
+                Entry w = W [col] ;
+                Rj [p+h+1] = col ;
+                Rx [p+h+1] = c * y + s * w ;
+                W [col] = c * w - spqr_conj (s) * y ;
+                Y [col] = 0 ;
+            }
+            QRup->rnz += len - Rlen [j] ;
+            Rlen [j] = len ;
+
+            // apply the rotation to row j of C and the new row of B
+            for (kk = 0 ; kk < nrhs ; kk++)
+            {
+                Entry cj = Cx [j + kk*ldc] ;
+                Cx [j + kk*ldc] = c * cj + s * Bk [kk] ;
+                Bk [kk] = c * Bk [kk] - spqr_conj (s) * cj ;
+            }
+
+            QRup->Rrot [j]++ ;
+            QRup->maxrot = MAX (QRup->maxrot, QRup->Rrot [j]) ;
+        }
+    }
+
+    QRup->m += k ;
+    FREE_WORK ;
+
+    // -------------------------------------------------------------------------
+    // check the fill-in and rotation budgets
+    // -------------------------------------------------------------------------
+
+    if ((double) QRup->rnz > fill_budget * (double) MAX (QRup->rnz0, n) ||
+        (double) QRup->maxrot > rot_budget)
+    {
+        return (0) ;
+    }
+    return (1) ;
+}
+
+template int SuiteSparseQR_append_rows <double, int32_t>
+(
+    cholmod_sparse *Anew,
+    cholmod_dense *Bnew,
+    double fill_budget,
+    double rot_budget,
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    cholmod_dense *C,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_append_rows <Complex, int32_t>
+(
+    cholmod_sparse *Anew,
+    cholmod_dense *Bnew,
+    double fill_budget,
+    double rot_budget,
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    cholmod_dense *C,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_append_rows <double, int64_t>
+(
+    cholmod_sparse *Anew,
+    cholmod_dense *Bnew,
+    double fill_budget,
+    double rot_budget,
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    cholmod_dense *C,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_append_rows <Complex, int64_t>
+(
+    cholmod_sparse *Anew,
+    cholmod_dense *Bnew,
+    double fill_budget,
+    double rot_budget,
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    cholmod_dense *C,
+    cholmod_common *cc
+) ;
+
+#endif
@@ -22,10 +22,16 @@
 //                               nonzero pattern of A; to be followed by:
 //      SuiteSparseQR_numeric    numeric QR factorization.  Does not exploit
 //                               singletons.  Note that H is always kept.
+//      SuiteSparseQR_symbolic_matches  check if a symbolic analysis can be
+//                               reused for a matrix A
+//      SuiteSparseQR_factorize_cached  numeric factorization, reusing a
+//                               symbolic analysis if it matches A
 //
 //      SuiteSparseQR_solve      forward/backsolve using R from the QR object
 //      SuiteSparseQR_qmult      multiply by Q or Q', using Q from the QR object
 //      SuiteSparseQR_min2norm   min 2-norm solution for x=A\b
+//      SuiteSparseQR_append_rows  append rows to A and update R (see
+//                               SuiteSparseQR_append_rows.cpp)
 //      SuiteSparseQR_free       free the QR object
 //
 // All of these functions keep the Householder vectors.  The
@@ -41,6 +47,9 @@
 
 #ifndef NEXPERT
 #include "spqr.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // =============================================================================
 // === SuiteSparseQR_symbolic ==================================================
@@ -112,6 +121,9 @@ SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_symbolic
     QR->Rmap = NULL ;           // may be allocated by numeric factorization
     QR->RmapInv = NULL ;
 
+    QR->QRup = NULL ;           // no rows appended
+    QR->view = FALSE ;          // arrays are not held in a serialized blob
+
     QR->narows = A->nrow ;
     QR->nacols = A->ncol ;
     QR->bncols = 0 ;            // [A B] is not factorized
@@ -264,8 +276,10 @@ template <typename Entry, typename Int> int SuiteSparseQR_numeric
     // numeric factorization
     // -------------------------------------------------------------------------
 
-    // free the existing numeric factorization, if any
+    // free the existing numeric factorization, if any, and discard any rows
+    // appended by SuiteSparseQR_append_rows
     spqr_freenum (&(QR->QRnum), cc) ;
+    spqr_rupdate_free (&(QR->QRup), cc) ;
 
     // compute the new factorization
     QR->QRnum = spqr_factorize <Entry, Int> (&A, FALSE, tol, n, QR->QRsym, cc) ;
@@ -341,6 +355,267 @@ template int SuiteSparseQR_numeric <Complex, int64_t>
     SuiteSparseQR_factorization <Complex, int64_t> *QR,
     cholmod_common *cc      // workspace and parameters
 ) ;
+// =============================================================================
+// === SuiteSparseQR_symbolic_matches ==========================================
+// =============================================================================
+
+// Returns TRUE if the symbolic analysis in QR was computed for a matrix with
+// the same size and nonzero pattern as A.  The pattern of the analyzed matrix
+// is held in QRsym as S = A(P,Qfill) in row form, with sorted rows, so A is
+// compared with S by sweeping the columns of A in Qfill order, just as
+// spqr_stranspose1 does when it constructs S.  This takes O(nnz(A)+m+n) time,
+// far less than a new analysis, and it is done in parallel if A has sorted
+// columns (see spqr_ptranspose.cpp).  An analysis that exploited singletons,
+// or that factorized [A B], cannot be reused, so FALSE is returned for it.
+
+template <typename Entry, typename Int> int SuiteSparseQR_symbolic_matches
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_sparse *A,      // sparse matrix to compare with (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (FALSE) ;
+    RETURN_IF_NULL (QR, FALSE) ;
+    RETURN_IF_NULL (A, FALSE) ;
+    cc->status = CHOLMOD_OK ;
+
+    // -------------------------------------------------------------------------
+    // check the dimensions
+    // -------------------------------------------------------------------------
+
+    spqr_symbolic <Int> *QRsym = QR->QRsym ;
+    if (QRsym == NULL || QR->n1cols > 0 || QR->bncols > 0 || !A->packed ||
+        A->stype != 0 || QRsym->m != (Int) A->nrow ||
+        QRsym->n != (Int) A->ncol)
+    {
+        return (FALSE) ;
+    }
+
+    Int m = A->nrow ;
+    Int n = A->ncol ;
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    if (QRsym->anz != Ap [n])
+    {
+        return (FALSE) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // compare the pattern of A with S
+    // -------------------------------------------------------------------------
+
+    Int *Qfill = QRsym->Qfill ;
+    Int *PLinv = QRsym->PLinv ;
+    Int *Sp = QRsym->Sp ;
+    Int *Sj = QRsym->Sj ;
+
+    // W [i] is the next entry in row PLinv [i] of S
+    Int *W = (Int *) spqr_malloc <Int> (m, sizeof (Int), cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        return (FALSE) ;
+    }
+
+    int nthreads ;
+    size_t wsize ;
+    Int *Work = spqr_ptranspose_work <Int> (A, 1, &nthreads, &wsize, cc) ;
+    Int *Rstart = Work ;
+    Int *Pstart = (Work == NULL) ? NULL : (Work + (nthreads+1)) ;
+    Int *Match = (Work == NULL) ? NULL : (Pstart + ((size_t) nthreads) * n) ;
+    int match = TRUE ;
+
+    int t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+        if (nthreads > 1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        // this thread handles rows i0:i1-1 of A, or all of A if one thread
+        Int i0 = (Work == NULL) ? 0 : Rstart [t] ;
+        Int i1 = (Work == NULL) ? m : Rstart [t+1] ;
+        Int *Pt = (Work == NULL) ? Ap : (Pstart + ((size_t) t) * n) ;
+        Int *Pnext = Pt + n ;
+        int ok = TRUE ;
+        for (Int i = i0 ; i < i1 ; i++)
+        {
+            W [i] = Sp [PLinv [i]] ;
+        }
+        for (Int col = 0 ; ok && col < n ; col++)
+        {
+            Int j = Qfill ? Qfill [col] : col ;
+            Int pend = (Work == NULL || t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+            for (Int p = Pt [j] ; p < pend ; p++)
+            {
+                // the entry A(i,j) must be the next entry in row PLinv [i]
+                // of S.  Since A and S have the same number of entries, this
+                // ensures that A and S have the same pattern.
+                Int i = Ai [p] ;
+                if (i < i0 || i >= i1)
+                {
+                    ok = FALSE ;
+                    break ;
+                }
+                Int s = W [i]++ ;
+                if (s >= Sp [PLinv [i] + 1] || Sj [s] != col)
+                {
+                    ok = FALSE ;
+                    break ;
+                }
+            }
+        }
+        if (Work == NULL)
+        {
+            match = ok ;
+        }
+        else
+        {
+            Match [t] = ok ;
+        }
+    }
+
+    if (Work != NULL)
+    {
+        for (t = 0 ; t < nthreads ; t++)
+        {
+            match = match && Match [t] ;
+        }
+    }
+
+    spqr_free <Int> (wsize, sizeof (Int), Work, cc) ;
+    spqr_free <Int> (m, sizeof (Int), W, cc) ;
+    return (match) ;
+}
+
+template int SuiteSparseQR_symbolic_matches <double, int32_t>
+(
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    cholmod_sparse *A,      // sparse matrix to compare with (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_symbolic_matches <Complex, int32_t>
+(
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    cholmod_sparse *A,      // sparse matrix to compare with (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_symbolic_matches <double, int64_t>
+(
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    cholmod_sparse *A,      // sparse matrix to compare with (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_symbolic_matches <Complex, int64_t>
+(
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    cholmod_sparse *A,      // sparse matrix to compare with (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+
+// =============================================================================
+// === SuiteSparseQR_factorize_cached ==========================================
+// =============================================================================
+
+// QR factorization of A that reuses the symbolic analysis in *QRhandle, if it
+// matches the pattern of A.  This is useful when a sequence of matrices is
+// factorized, some of which share the same nonzero pattern.  Returns 2 if the
+// analysis was reused, 1 if A was analyzed, or 0 on failure.  Like
+// SuiteSparseQR_symbolic and SuiteSparseQR_numeric, singletons are not
+// exploited, and H is always kept.
+
+template <typename Entry, typename Int> int SuiteSparseQR_factorize_cached
+(
+    int ordering,           // all, except 3:given treated as 0:fixed; used
+                            // only if A is analyzed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <Entry, Int> **QRhandle,
+    cholmod_common *cc      // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (FALSE) ;
+    RETURN_IF_NULL (QRhandle, FALSE) ;
+    RETURN_IF_NULL (A, FALSE) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (A, FALSE) ;
+    cc->status = CHOLMOD_OK ;
+
+    // -------------------------------------------------------------------------
+    // reuse the symbolic analysis, or analyze A
+    // -------------------------------------------------------------------------
+
+    double t0 = SUITESPARSE_TIME ;
+    int result = 2 ;
+    if (*QRhandle == NULL ||
+        !SuiteSparseQR_symbolic_matches <Entry, Int> (*QRhandle, A, cc))
+    {
+        SuiteSparseQR_free <Entry, Int> (QRhandle, cc) ;
+        *QRhandle = SuiteSparseQR_symbolic <Entry, Int> (ordering, TRUE, A,
+            cc) ;
+        if (*QRhandle == NULL)
+        {
+            // out of memory, or invalid input
+            return (0) ;
+        }
+        result = 1 ;
+    }
+    double t1 = SUITESPARSE_TIME ;
+
+    // -------------------------------------------------------------------------
+    // numeric factorization
+    // -------------------------------------------------------------------------
+
+    if (!SuiteSparseQR_numeric <Entry, Int> (tol, A, *QRhandle, cc))
+    {
+        SuiteSparseQR_free <Entry, Int> (QRhandle, cc) ;
+        return (0) ;
+    }
+    cc->SPQR_analyze_time = t1 - t0 ;
+    return (result) ;
+}
+
+template int SuiteSparseQR_factorize_cached <double, int32_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed; used
+                            // only if A is analyzed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <double, int32_t> **QRhandle,
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_factorize_cached <Complex, int32_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed; used
+                            // only if A is analyzed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <Complex, int32_t> **QRhandle,
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_factorize_cached <double, int64_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed; used
+                            // only if A is analyzed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <double, int64_t> **QRhandle,
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_factorize_cached <Complex, int64_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed; used
+                            // only if A is analyzed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <Complex, int64_t> **QRhandle,
+    cholmod_common *cc      // workspace and parameters
+) ;
+
 // =============================================================================
 // === SuiteSparseQR_factorize =================================================
 // =============================================================================
@@ -425,6 +700,80 @@ template SuiteSparseQR_factorization <Complex, int64_t> *SuiteSparseQR_factorize
     cholmod_common *cc
 ) ;
 
+// =============================================================================
+// === SuiteSparseQR_qless_factorize ===========================================
+// =============================================================================
+
+// Q-less QR factorization of a sparse matrix A.  This is the same as
+// SuiteSparseQR_factorize, except that the Householder vectors are not kept.
+// Each front is packed into its R part as soon as it is factorized, and its
+// Householder vectors are discarded, so the memory required for the
+// factorization is not much more than the memory for R itself.  Q is not
+// available, so SuiteSparseQR_qmult cannot be used.  To solve a least-squares
+// problem with this factorization, use SuiteSparseQR_csne.
+
+template <typename Entry, typename Int>
+SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_qless_factorize
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    cholmod_common *cc      // workspace and parameters
+)
+{
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (A, NULL) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (A, NULL) ;
+    cc->status = CHOLMOD_OK ;
+    // B is not present, and H is discarded:
+    int keepH = FALSE ;
+    return (spqr_1factor <Entry, Int> (ordering, tol, 0, keepH, A,
+        0, NULL, NULL, NULL, cc)) ;
+}
+
+template SuiteSparseQR_factorization <double, int32_t> *
+SuiteSparseQR_qless_factorize <double, int32_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <Complex, int32_t> *
+SuiteSparseQR_qless_factorize <Complex, int32_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <double, int64_t> *
+SuiteSparseQR_qless_factorize <double, int64_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <Complex, int64_t> *
+SuiteSparseQR_qless_factorize <Complex, int64_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
 // =============================================================================
 // === spqr_private_rtsolve ====================================================
 // =============================================================================
@@ -483,10 +832,9 @@ template <typename Entry, typename Int> void spqr_private_rtsolve
     keepH = QRnum->keepH ;
     PR (("\nrtsolve keepH %ld n1rows %ld n1cols %ld\n", keepH, n1rows, n1cols));
 
-    // This code is only used when keepH is true.  keepH is tested below,
-    // however, in case this changes in the future (the following assert would
-    // also need to be removed).
-    ASSERT (keepH) ;
+    // If keepH is false (a Q-less factorization from
+    // SuiteSparseQR_qless_factorize), the live pivot columns are given by
+    // Rdead instead of the staircase of each front.
 
     nf = QRsym->nf ;
     Rblock = QRnum->Rblock ;
@@ -640,11 +988,9 @@ template <typename Entry, typename Int> void spqr_private_rtsolve
             }
             else
             {
-                // Ironically, this statement is itself dead code.  In the
-                // current version, keepH is always TRUE whenever rtsolve is
-                // used.  If H was not kept, this statement would determine
-                // whether the the pivot column is live or dead.
-                live = (!Rdead [j]) ;                                   // DEAD
+                // H was not kept; Rdead determines whether the pivot column
+                // is live or dead
+                live = (!Rdead [j]) ;
             }
 
             if (live)
@@ -775,6 +1121,43 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_solve // re
     }
     m = QR->narows ;
     n = QR->nacols ;
+    nrhs = B->ncol ;
+    Bx = (Entry *) B->x ;
+    ldb = B->d ;
+
+    if (QR->QRup != NULL)
+    {
+
+        // ---------------------------------------------------------------------
+        // solve with R after rows have been appended to A
+        // ---------------------------------------------------------------------
+
+        // B is C = Q'*B as updated by SuiteSparseQR_append_rows (only its
+        // first n rows are used), or n-by-nrhs for X = R'\B and R'\(E'*B)
+        m = QR->QRup->m ;
+        if ((system <= SPQR_RETX_EQUALS_B) ? ((Int) B->nrow < n) :
+            ((Int) B->nrow != n))
+        {
+            ERROR (CHOLMOD_INVALID, "invalid dimensions") ;
+            return (NULL) ;
+        }
+        cc->status = CHOLMOD_OK ;
+        Int xrows = (system <= SPQR_RETX_EQUALS_B) ? n : m ;
+        X = spqr_allocate_dense <Int> (xrows, nrhs, xrows, xtype, cc) ;
+        Entry *Wx = (Entry *) spqr_malloc <Int> (n, sizeof (Entry), cc) ;
+        if (cc->status < CHOLMOD_OK)
+        {
+            // out of memory
+            spqr_free_dense <Int> (&X, cc) ;
+            spqr_free <Int> (n, sizeof (Entry), Wx, cc) ;
+            return (NULL) ;
+        }
+        spqr_rupdate_solve (system, QR->QRup, QR->Q1fill, nrhs, ldb, Bx,
+            (Entry *) X->x, Wx) ;
+        spqr_free <Int> (n, sizeof (Entry), Wx, cc) ;
+        return (X) ;
+    }
+
     if ((Int) B->nrow != ((system <= SPQR_RETX_EQUALS_B) ? m : n))
     {
         ERROR (CHOLMOD_INVALID, "invalid dimensions") ;
@@ -785,10 +1168,6 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_solve // re
 
     cc->status = CHOLMOD_OK ;
 
-    nrhs = B->ncol ;
-    Bx = (Entry *) B->x ;
-    ldb = B->d ;
-
     if (system == SPQR_RX_EQUALS_B || system == SPQR_RETX_EQUALS_B)
     {
 
@@ -1115,7 +1494,8 @@ template <typename Entry, typename Int> void spqr_private_Happly
     // input/output
     Int m,
     Int n,
-    Entry *X,               // size m-by-n with leading dimension m; only
+    Int ldx,                // leading dimension of X
+    Entry *X,               // size m-by-n with leading dimension ldx; only
                             // X (n1rows:m-1,:) or X (:,n1rows:n-1) is modified
 
     // workspace, not defined on input or output
@@ -1167,7 +1547,7 @@ template <typename Entry, typename Int> void spqr_private_Happly
     }
     else
     {
-        X2 = X + n1rows * m ;
+        X2 = X + n1rows * ldx ;
         n2 = n - n1rows ; 
         m2 = m ;
     }
@@ -1199,7 +1579,7 @@ template <typename Entry, typename Int> void spqr_private_Happly
                     cc) ;
                 ASSERT (v+h1 <= QR->QRnum->Hm [f]) ;
                 spqr_panel (method, m2, n2, v, h2-h1, Hi+h1, V, H_Tau+h1,
-                    m, X2, C, W, cc) ;
+                    ldx, X2, C, W, cc) ;
             }
         }
     }
@@ -1227,7 +1607,7 @@ template <typename Entry, typename Int> void spqr_private_Happly
                     cc) ;
                 ASSERT (v+h1 <= QR->QRnum->Hm [f]) ;
                 spqr_panel (method, m2, n2, v, h2-h1, Hi+h1, V, H_Tau+h1,
-                    m, X2, C, W, cc) ;
+                    ldx, X2, C, W, cc) ;
             }
         }
     }
@@ -1245,20 +1625,54 @@ template <typename Entry, typename Int> void spqr_private_Happly
 //  method SPQR_QX  (1): Y = Q*X
 //  method SPQR_XQT (2): Y = X*Q'
 //  method SPQR_XQ  (3): Y = X*Q
+//
+// The columns of X (for Q'*X and Q*X) or its rows (for X*Q' and X*Q) are
+// independent of each other, so they are split into blocks of at most QBLOCK
+// columns or rows.  Each block is a separate pass over all the fronts, so the
+// workspace (and the part of Y it updates) stays small enough to remain in
+// cache, no matter how many columns X has.  The blocks are done in parallel,
+// with cc->SPQR_nthreads OpenMP threads (0 means the OpenMP default).  The
+// blocks do not depend on the number of threads, so neither does the result.
 
 #define HCHUNK 32        // FUTURE: make this an input parameter
+#define QBLOCK 128       // max # of columns (or rows) of X in each block
 
 #define FREE_WORK \
 { \
     spqr_free_dense <Int> (&Zdense, cc) ; \
+    FREE_BLOCK_WORK ; \
+}
+
+#define FREE_BLOCK_WORK \
+{ \
     spqr_free_dense <Int> (&Vdense, cc) ; \
     spqr_free_dense <Int> (&Wdense, cc) ; \
     spqr_free_dense <Int> (&Cdense, cc) ; \
-    spqr_free <Int> (maxfn, sizeof (Entry), H_Tau,   cc) ; \
-    spqr_free <Int> (maxfn, sizeof (Int),  H_start, cc) ; \
-    spqr_free <Int> (maxfn, sizeof (Int),  H_end,   cc) ; \
+    spqr_free <Int> (hsize, sizeof (Entry), H_Tau,   cc) ; \
+    spqr_free <Int> (hsize, sizeof (Int),  H_start, cc) ; \
+    spqr_free <Int> (hsize, sizeof (Int),  H_end,   cc) ; \
+}
+
+#define ALLOCATE_BLOCK_WORK \
+{ \
+    hsize = maxfn * nthreads ; \
+    /* C is workspace of size v-by-bsize or bsize-by-v, for each thread */ \
+    Cdense = spqr_allocate_dense <Int> (v, bsize * nthreads, v, xtype, cc) ; \
+    /* V is workspace of size v-by-hchunk, for each thread */ \
+    Vdense = spqr_allocate_dense <Int> (v, hchunk * nthreads, v, xtype, cc) ; \
+    /* W is workspace of size h*h+bsize*h where h = hchunk, for each thread */ \
+    Wdense = spqr_allocate_dense <Int> (hchunk, (hchunk + bsize) * nthreads, \
+        hchunk, xtype, cc) ; \
+    H_Tau   = (Entry *) spqr_malloc <Int> (hsize, sizeof (Entry), cc) ; \
+    H_start = (Int *)  spqr_malloc <Int> (hsize, sizeof (Int),  cc) ; \
+    H_end   = (Int *)  spqr_malloc <Int> (hsize, sizeof (Int),  cc) ; \
 }
 
+// spqr_allocate_dense clears cc->status, so check each pointer instead
+#define BLOCK_WORK_FAILED \
+    (Cdense == NULL || Vdense == NULL || Wdense == NULL || H_Tau == NULL || \
+     H_start == NULL || H_end == NULL)
+
 // returns Y of size m-by-n, or NULL on failure
 template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
 (
@@ -1272,9 +1686,10 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
 )
 {
     cholmod_dense *Ydense, *Cdense, *Vdense, *Wdense, *Zdense ;
-    Entry *X, *Y, *X1, *Y1, *Z1, *C, *V, *Z, *W, *H_Tau ;
+    Entry *X, *Y, *X1, *Y1, *Z1, *C, *V, *Z, *W, *H_Tau, *Xwork ;
     Int *HPinv, *H_start, *H_end ;
-    Int i, k, mh, v, hchunk, ldx, m, n, maxfn, ok ;
+    Int i, k, mh, v, hchunk, ldx, m, n, maxfn, hsize, xsize, bsize, nblocks ;
+    int nthreads ;
 
     // -------------------------------------------------------------------------
     // get inputs
@@ -1283,10 +1698,22 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
     RETURN_IF_NULL_COMMON (NULL) ;
     RETURN_IF_NULL (QR, NULL) ;
     RETURN_IF_NULL (QR->QRnum, NULL) ;
+    if (!QR->QRnum->keepH)
+    {
+        // the Householder vectors were discarded
+        ERROR (CHOLMOD_INVALID, "Q not available in a Q-less factorization") ;
+        return (NULL) ;
+    }
     RETURN_IF_NULL (QR->QRnum->Hm, NULL) ;
     RETURN_IF_NULL (Xdense, NULL) ;
     int64_t xtype = spqr_type <Entry> ( ) ;
     RETURN_IF_XTYPE_INVALID (Xdense, NULL) ;
+    if (QR->QRup != NULL)
+    {
+        // the Householder vectors do not include any appended rows
+        ERROR (CHOLMOD_INVALID, "Q not available after rows are appended") ;
+        return (NULL) ;
+    }
     cc->status = CHOLMOD_OK ;
 
     // get HPinv from QR->HP1inv if singletons exist, else QR->QRnum->HPinv
@@ -1345,91 +1772,59 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
     }
 
     // -------------------------------------------------------------------------
-    // allocate workspace
+    // split X into blocks, and determine the number of threads to use
     // -------------------------------------------------------------------------
 
-    Z = NULL ;
-    Zdense = NULL ;
-    ok = TRUE ;
-    if (method == SPQR_QX || method == SPQR_XQT)
-    {
-        // Z of size m-by-n is needed only for Q*X and X*Q'
-        Zdense = spqr_allocate_dense <Int> (m, n, m, xtype, cc) ;
-        ok = (Zdense != NULL) ;
-    }
+    // xsize is the number of independent columns (or rows) of X
+    xsize = (method <= SPQR_QX) ? n : m ;
+    bsize = MIN (xsize, QBLOCK) ;
+    nblocks = (xsize + bsize - 1) / bsize ;
 
-    hchunk = HCHUNK ;
-    ASSERT (v <= mh) ;
-
-    // C is workspace of size v-by-n or m-by-v
-    Cdense = spqr_allocate_dense <Int> (v, (method <= SPQR_QX) ? n : m,
-        v, xtype, cc) ;
-    Vdense = NULL ;
-    Wdense = NULL ;
-
-    H_Tau   = (Entry *) spqr_malloc <Int> (maxfn, sizeof (Entry), cc) ;
-    H_start = (Int *)  spqr_malloc <Int> (maxfn, sizeof (Int),  cc) ;
-    H_end   = (Int *)  spqr_malloc <Int> (maxfn, sizeof (Int),  cc) ;
-
-    if (!ok || Cdense == NULL || cc->status < CHOLMOD_OK)
+    nthreads = 1 ;
+#ifdef _OPENMP
+    nthreads = cc->SPQR_nthreads ;
+    if (nthreads <= 0)
     {
-        // out of memory; free workspace and result Y
-        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
-        spqr_free_dense <Int> (&Ydense, cc) ;
-        FREE_WORK ;
-        return (NULL) ;
+        nthreads = omp_get_max_threads ( ) ;
     }
+    nthreads = (int) MAX (1, MIN ((Int) nthreads, nblocks)) ;
+#endif
 
     // -------------------------------------------------------------------------
-    // copy X into Z
+    // allocate workspace
     // -------------------------------------------------------------------------
 
+    Z = NULL ;
+    Zdense = NULL ;
     if (method == SPQR_QX || method == SPQR_XQT)
     {
-        // Z = X
-        Z = (Entry *) Zdense->x ;
-        Z1 = Z ;
-        X1 = X ;
-        for (k = 0 ; k < n ; k++)
+        // Z of size m-by-n is needed only for Q*X and X*Q'
+        Zdense = spqr_allocate_dense <Int> (m, n, m, xtype, cc) ;
+        if (Zdense == NULL)
         {
-            for (i = 0 ; i < m ; i++)
-            {
-                Z1 [i] = X1 [i] ;
-            }
-            X1 += ldx ;
-            Z1 += m ;
+            // out of memory; free result Y
+            spqr_free_dense <Int> (&Ydense, cc) ;
+            return (NULL) ;
         }
     }
 
-    // -------------------------------------------------------------------------
-    // allocate O(hchunk) workspace
-    // -------------------------------------------------------------------------
-
-    // V is workspace of size v-by-hchunk
-    Vdense = spqr_allocate_dense <Int> (v, hchunk, v, xtype, cc) ;
-
-    // W is workspace of size h*h+n*h or h*h+m*h where h = hchunk
-    Wdense = spqr_allocate_dense <Int> (hchunk,
-        hchunk + ((method <= SPQR_QX) ? n : m), hchunk, xtype, cc) ;
+    hchunk = HCHUNK ;
+    ASSERT (v <= mh) ;
+    ALLOCATE_BLOCK_WORK ;
 
     // -------------------------------------------------------------------------
     // punt if out of memory
     // -------------------------------------------------------------------------
 
-    if (Vdense == NULL || Wdense == NULL)
+    if (BLOCK_WORK_FAILED)
     {
-        // PUNT: out of memory; try again with hchunk = 1
+        // PUNT: out of memory; try again with one thread and hchunk = 1
         cc->status = CHOLMOD_OK ;
+        FREE_BLOCK_WORK ;
+        nthreads = 1 ;
         hchunk = 1 ;
-
-        spqr_free_dense <Int> (&Vdense, cc) ;
-        spqr_free_dense <Int> (&Wdense, cc) ;
-
-        Vdense = spqr_allocate_dense <Int> (v, hchunk, v, xtype, cc) ;
-        Wdense = spqr_allocate_dense <Int> (hchunk,
-            hchunk + ((method <= SPQR_QX) ? n : m), hchunk, xtype, cc) ;
-
-        if (Vdense == NULL || Wdense == NULL)
+        ALLOCATE_BLOCK_WORK ;
+        if (BLOCK_WORK_FAILED)
         {
             // out of memory; free workspace and result Y
             ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
@@ -1446,18 +1841,13 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
     W = (Entry *) Wdense->x ;
 
     // -------------------------------------------------------------------------
-    // Y = Q'*X, Q*X, X*Q, or X*Q'
+    // copy X into Y or Z, with the row or column permutation if needed
     // -------------------------------------------------------------------------
 
     PR (("Qfmult Method %d m %ld n %ld X %p Y %p\n", method, m, n, X, Y)) ;
 
     if (method == SPQR_QTX)
     {
-
-        // ---------------------------------------------------------------------
-        // Y = Q'*X
-        // ---------------------------------------------------------------------
-
         // Y (P,:) = X, and change leading dimension from ldx to m
         X1 = X ;
         Y1 = Y ;
@@ -1470,23 +1860,81 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             X1 += ldx ;
             Y1 += m ;
         }
-
-        // apply H to Y
-        spqr_private_Happly (method, QR, hchunk, m, n, Y, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
-
     }
-    else if (method == SPQR_QX)
+    else if (method == SPQR_XQ)
+    {
+        // Y (:,P) = X and change leading dimension from ldx to m
+        X1 = X ;
+        for (k = 0 ; k < n ; k++)
+        {
+            Y1 = Y + HPinv [k] * m ;    // m = leading dimension of Y
+            for (i = 0 ; i < m ; i++)
+            {
+                Y1 [i] = X1 [i] ;
+            }
+            X1 += ldx ;
+        }
+    }
+    else
     {
+        // Z = X
+        Z = (Entry *) Zdense->x ;
+        Z1 = Z ;
+        X1 = X ;
+        for (k = 0 ; k < n ; k++)
+        {
+            for (i = 0 ; i < m ; i++)
+            {
+                Z1 [i] = X1 [i] ;
+            }
+            X1 += ldx ;
+            Z1 += m ;
+        }
+    }
 
-        // ---------------------------------------------------------------------
-        // Y = Q*X
-        // ---------------------------------------------------------------------
+    // -------------------------------------------------------------------------
+    // apply H to Y (for Q'*X and X*Q) or Z (for Q*X and X*Q'), in blocks
+    // -------------------------------------------------------------------------
+
+    Xwork = (method == SPQR_QTX || method == SPQR_XQ) ? Y : Z ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        if (nthreads > 1)
+    for (Int b = 0 ; b < nblocks ; b++)
+    {
+        // get the workspace for this thread
+        Int tid = 0 ;
+#ifdef _OPENMP
+        tid = omp_get_thread_num ( ) ;
+#endif
+        Entry *Ct = C + tid * v * bsize ;
+        Entry *Vt = V + tid * v * hchunk ;
+        Entry *Wt = W + tid * hchunk * (hchunk + bsize) ;
+        Int *Ht = H_start + tid * maxfn ;
+        Int *He = H_end + tid * maxfn ;
+        Entry *Taut = H_Tau + tid * maxfn ;
+
+        // apply H to columns (or rows) k1:k2-1 of Y or Z
+        Int k1 = b * bsize ;
+        Int k2 = MIN (k1 + bsize, xsize) ;
+        if (method <= SPQR_QX)
+        {
+            spqr_private_Happly (method, QR, hchunk, m, k2-k1, m,
+                Xwork + k1*m, Taut, Ht, He, Vt, Ct, Wt, cc) ;
+        }
+        else
+        {
+            spqr_private_Happly (method, QR, hchunk, k2-k1, n, m, Xwork + k1,
+                Taut, Ht, He, Vt, Ct, Wt, cc) ;
+        }
+    }
 
-        // apply H to Z
-        spqr_private_Happly (method, QR, hchunk, m, n, Z, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
+    // -------------------------------------------------------------------------
+    // copy Z into Y, with the row or column permutation if needed
+    // -------------------------------------------------------------------------
 
+    if (method == SPQR_QX)
+    {
         // Y = Z (P,:)
         Z1 = Z ;
         Y1 = Y ;
@@ -1499,19 +1947,9 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             Z1 += m ;
             Y1 += m ;
         }
-
     }
     else if (method == SPQR_XQT)
     {
-
-        // ---------------------------------------------------------------------
-        // Y = X*Q'
-        // ---------------------------------------------------------------------
-
-        // apply H to Z
-        spqr_private_Happly (method, QR, hchunk, m, n, Z, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
-
         // Y = Z (:,P)
         Y1 = Y ;
         for (k = 0 ; k < n ; k++)
@@ -1523,31 +1961,6 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             }
             Y1 += m ;
         }
-
-    }
-    else if (method == SPQR_XQ)
-    {
-
-        // ---------------------------------------------------------------------
-        // Y = X*Q
-        // ---------------------------------------------------------------------
-
-        // Y (:,P) = X and change leading dimension from ldx to m
-        X1 = X ;
-        for (k = 0 ; k < n ; k++)
-        {
-            Y1 = Y + HPinv [k] * m ;    // m = leading dimension of Y
-            for (i = 0 ; i < m ; i++)
-            {
-                Y1 [i] = X1 [i] ;
-            }
-            X1 += ldx ;
-        }
-
-        // apply H to Y
-        spqr_private_Happly (method, QR, hchunk, m, n, Y, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
-
     }
 
     // -------------------------------------------------------------------------
@@ -1566,7 +1979,6 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
     return (Ydense) ;
 }
 
-
 template cholmod_dense *SuiteSparseQR_qmult <double, int32_t>
 (
     // inputs, not modified
@@ -1906,4 +2318,162 @@ template cholmod_sparse *SuiteSparseQR_min2norm <Complex, int64_t>
     cholmod_common *cc
 ) ;
 
+// =============================================================================
+// === SuiteSparseQR_csne ======================================================
+// =============================================================================
+
+// Solves the least-squares problem min ||B-A*X|| with the corrected
+// semi-normal equations, using R (but not Q) from a QR factorization of A.
+// The semi-normal equations R'*R*X = A'*B are solved first, with
+// X = E*(R\(R'\(E'*(A'*B)))), and then one step of iterative refinement is
+// done with the residual B-A*X.  The semi-normal equations alone can be much
+// less accurate than X=E*(R\(Q'*B)) when A is ill-conditioned; the
+// refinement step restores most of that accuracy.  QR is normally a Q-less
+// factorization from SuiteSparseQR_qless_factorize, but any factorization of
+// A can be used.  If A is rank deficient, the basic solution is found.
+
+// Y = E*(R\(R'\(E'*C))), or NULL on failure
+template <typename Entry, typename Int> static cholmod_dense *
+spqr_private_seminormal
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_dense *C,
+    cholmod_common *cc
+)
+{
+    cholmod_dense *W, *Y ;
+    W = SuiteSparseQR_solve (SPQR_RTX_EQUALS_ETB, QR, C, cc) ;
+    Y = (W == NULL) ? NULL : SuiteSparseQR_solve (SPQR_RETX_EQUALS_B, QR, W,
+        cc) ;
+    spqr_free_dense <Int> (&W, cc) ;
+    return (Y) ;
+}
+
+// returns X of size n-by-nrhs, or NULL on failure
+template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_csne
+(
+    // inputs, not modified:
+    SuiteSparseQR_factorization <Entry, Int> *QR, // of an m-by-n sparse A
+    cholmod_sparse *A,      // the m-by-n sparse matrix factorized by QR
+    cholmod_dense *B,       // right-hand-side, m-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    cholmod_dense *C, *D, *X, *Resid ;
+    Entry *Xx, *Dx ;
+    Int n, nrhs, k ;
+    double one [2] = {1,0}, zero [2] = {0,0}, minusone [2] = {-1,0} ;
+
+    // -------------------------------------------------------------------------
+    // get inputs
+    // -------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (QR, NULL) ;
+    RETURN_IF_NULL (QR->QRnum, NULL) ;
+    RETURN_IF_NULL (A, NULL) ;
+    RETURN_IF_NULL (B, NULL) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (A, NULL) ;
+    RETURN_IF_XTYPE_INVALID (B, NULL) ;
+    n = QR->nacols ;
+    nrhs = B->ncol ;
+    if ((Int) A->ncol != n || A->nrow != B->nrow)
+    {
+        ERROR (CHOLMOD_INVALID, "invalid dimensions") ;
+        return (NULL) ;
+    }
+    cc->status = CHOLMOD_OK ;
+
+    // -------------------------------------------------------------------------
+    // solve the semi-normal equations, X = E*(R\(R'\(E'*(A'*B))))
+    // -------------------------------------------------------------------------
+
+    // spqr_copy_dense resets cc->status, so check both pointers
+    C = spqr_allocate_dense <Int> (n, nrhs, n, xtype, cc) ;
+    Resid = spqr_copy_dense <Int> (B, cc) ;
+    if (C == NULL || Resid == NULL)
+    {
+        // out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        spqr_free_dense <Int> (&C, cc) ;
+        spqr_free_dense <Int> (&Resid, cc) ;
+        return (NULL) ;
+    }
+
+    // C = A'*B
+    spqr_sdmult <Int> (A, TRUE, one, zero, B, C, cc) ;
+    X = spqr_private_seminormal (QR, C, cc) ;
+    D = NULL ;
+
+    // -------------------------------------------------------------------------
+    // one step of iterative refinement
+    // -------------------------------------------------------------------------
+
+    if (X != NULL)
+    {
+        // Resid = B - A*X
+        spqr_sdmult <Int> (A, FALSE, minusone, one, X, Resid, cc) ;
+        // C = A'*Resid
+        spqr_sdmult <Int> (A, TRUE, one, zero, Resid, C, cc) ;
+        // D = E*(R\(R'\(E'*C)))
+        D = spqr_private_seminormal (QR, C, cc) ;
+    }
+
+    if (D != NULL)
+    {
+        // X = X + D
+        Xx = (Entry *) X->x ;
+        Dx = (Entry *) D->x ;
+        for (k = 0 ; k < n*nrhs ; k++)
+        {
+            Xx [k] += Dx [k] ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // free workspace and return result
+    // -------------------------------------------------------------------------
+
+    spqr_free_dense <Int> (&C, cc) ;
+    spqr_free_dense <Int> (&D, cc) ;
+    spqr_free_dense <Int> (&Resid, cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        spqr_free_dense <Int> (&X, cc) ;
+    }
+    return (X) ;
+}
+
+template cholmod_dense *SuiteSparseQR_csne <double, int32_t>
+(
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_csne <Complex, int32_t>
+(
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_csne <double, int64_t>
+(
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_csne <Complex, int64_t>
+(
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
+
 #endif
@@ -0,0 +1,698 @@
+// =============================================================================
+// === SuiteSparseQR_serialize =================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Serialize a QR factorization into a single array of bytes (a "blob"), so
+// that it can be saved to a file and reused by another process, without
+// recomputing the factorization:
+//
+//      SuiteSparseQR_serialize_size    size of the blob, in bytes
+//      SuiteSparseQR_serialize         write the blob
+//      SuiteSparseQR_deserialize       construct a QR factorization from a
+//                                      blob, either by copying it or by
+//                                      using it in place
+//
+// The symbolic analysis (QR->QRsym), the numeric factorization (QR->QRnum,
+// including the Householder vectors in the stacks and their HStair, HTau, and
+// Hii descriptors, if kept) and the singletons and permutations of QR are all
+// included, so the deserialized QR can be used with SuiteSparseQR_solve,
+// SuiteSparseQR_qmult, and SuiteSparseQR_numeric.  A QR object from
+// SuiteSparseQR_symbolic (with no numeric factorization) can also be
+// serialized.  The GPU metadata QRsym->QRgpu is not included.  A QR object to
+// which rows have been appended by SuiteSparseQR_append_rows cannot be
+// serialized.
+//
+// The blob consists of a header (see spqr.hpp), copies of the three structs
+// (SuiteSparseQR_factorization, spqr_symbolic, and spqr_numeric), and a
+// directory with the offset of each array in the blob (zero if the array is
+// not present), followed by the arrays themselves.  The stacks of the numeric
+// factorization are held in a single region, and the R block of each front is
+// stored as a (stack, offset) pair.  Every part starts at a multiple of
+// SPQR_BLOB_ALIGN bytes from the start of the blob.  The blob can only be
+// read on a platform with the same sizes of the structs and of Entry, Int,
+// and pointers; SuiteSparseQR_deserialize checks this, and the format
+// SPQR_BLOB_FORMAT.
+//
+// If the blob is memory-mapped from a file (with mmap, for example), and
+// SuiteSparseQR_deserialize is used with view = TRUE, then only the structs
+// and two small arrays of pointers are allocated; the rest of the
+// factorization is used directly from the mapped file.  The blob must then
+// remain in place until the QR factorization is freed with
+// SuiteSparseQR_free.  QR->Rmap and QR->RmapInv are always copied, since
+// SuiteSparseQR_numeric can modify or allocate them, so the blob itself is
+// never modified.
+
+#ifndef NEXPERT
+#include "spqr.hpp"
+
+// one array of a QR factorization
+struct spqr_blob_array
+{
+    void **p ;          // the array is *p, or NULL if not present
+    int64_t n ;         // number of entries in *p
+    size_t size ;       // size of each entry
+} ;
+
+// number of arrays in spqr_blob_arrays, and the number of slots in the
+// directory, which also holds the stacks and the R block positions
+#define SPQR_BLOB_NARRAYS 39
+#define SPQR_BLOB_NSLOTS (SPQR_BLOB_NARRAYS + 2)
+
+// =============================================================================
+// === spqr_blob_arrays ========================================================
+// =============================================================================
+
+// Describes each array of the QR factorization, in the order they appear in
+// the blob.  Only the scalars of QR, QR->QRsym, and QR->QRnum are used.
+
+#define ARRAY(object,count,type)                    \
+{                                                   \
+    Array [k].p = (void **) &(object) ;             \
+    Array [k].n = (int64_t) (count) ;               \
+    Array [k].size = sizeof (type) ;                \
+    k++ ;                                           \
+}
+
+template <typename Entry, typename Int> static void spqr_blob_arrays
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    spqr_blob_array *Array      // size SPQR_BLOB_NARRAYS
+)
+{
+    int k = 0 ;
+
+    // singletons and permutations
+    int64_t m = QR->narows ;
+    int64_t n = QR->nacols ;
+    ARRAY (QR->R1p,     QR->n1rows+1,   Int) ;
+    ARRAY (QR->R1j,     QR->r1nz,       Int) ;
+    ARRAY (QR->R1x,     QR->r1nz,       Entry) ;
+    ARRAY (QR->Q1fill,  n + QR->bncols, Int) ;
+    ARRAY (QR->P1inv,   m,              Int) ;
+    ARRAY (QR->HP1inv,  m,              Int) ;
+    ARRAY (QR->Rmap,    n,              Int) ;
+    ARRAY (QR->RmapInv, n,              Int) ;
+
+    // symbolic analysis
+    spqr_symbolic <Int> *QRsym = QR->QRsym ;
+    int64_t sm = QRsym->m ;
+    int64_t sn = QRsym->n ;
+    int64_t nf = QRsym->nf ;
+    int64_t ntasks = MAX (QRsym->ntasks, 0) ;
+    int64_t ns = MAX (QRsym->ns, 0) ;
+    ARRAY (QRsym->Qfill,          sn,            Int) ;
+    ARRAY (QRsym->Super,          nf+1,          Int) ;
+    ARRAY (QRsym->Rp,             nf+1,          Int) ;
+    ARRAY (QRsym->Rj,             QRsym->rjsize, Int) ;
+    ARRAY (QRsym->Parent,         nf+1,          Int) ;
+    ARRAY (QRsym->Childp,         nf+2,          Int) ;
+    ARRAY (QRsym->Child,          nf+1,          Int) ;
+    ARRAY (QRsym->Post,           nf+1,          Int) ;
+    ARRAY (QRsym->PLinv,          sm,            Int) ;
+    ARRAY (QRsym->Sleft,          sn+2,          Int) ;
+    ARRAY (QRsym->Sp,             sm+1,          Int) ;
+    ARRAY (QRsym->Sj,             QRsym->anz,    Int) ;
+    ARRAY (QRsym->Hip,            nf+1,          Int) ;
+    ARRAY (QRsym->Fm,             nf+1,          Int) ;
+    ARRAY (QRsym->Cm,             nf+1,          Int) ;
+    ARRAY (QRsym->ColCount,       sn,            Int) ;
+    ARRAY (QRsym->TaskChildp,     ntasks+2,      Int) ;
+    ARRAY (QRsym->TaskChild,      ntasks+1,      Int) ;
+    ARRAY (QRsym->TaskFront,      nf+1,          Int) ;
+    ARRAY (QRsym->TaskFrontp,     ntasks+2,      Int) ;
+    ARRAY (QRsym->TaskStack,      ntasks+1,      Int) ;
+    ARRAY (QRsym->On_stack,       nf+1,          Int) ;
+    ARRAY (QRsym->Stack_maxstack, ns+2,          Int) ;
+
+    // numeric factorization, if present
+    spqr_numeric <Entry, Int> *QRnum = QR->QRnum ;
+    if (QRnum != NULL)
+    {
+        ARRAY (QRnum->Rdead,      QRnum->n,      char) ;
+        ARRAY (QRnum->HStair,     QRnum->rjsize, Int) ;
+        ARRAY (QRnum->HTau,       QRnum->rjsize, Entry) ;
+        ARRAY (QRnum->Hii,        QRnum->hisize, Int) ;
+        ARRAY (QRnum->HPinv,      QRnum->m,      Int) ;
+        ARRAY (QRnum->Hm,         QRnum->nf,     Int) ;
+        ARRAY (QRnum->Hr,         QRnum->nf,     Int) ;
+        ARRAY (QRnum->Stack_size, QRnum->ns,     Int) ;
+    }
+    for ( ; k < SPQR_BLOB_NARRAYS ; k++)
+    {
+        Array [k].p = NULL ;
+        Array [k].n = 0 ;
+        Array [k].size = 0 ;
+    }
+}
+
+// size of the header, the three structs, and the directory
+template <typename Entry, typename Int> static int64_t spqr_blob_prefix ( )
+{
+    return (SPQR_BLOB_HEADER
+        + SPQR_BLOB_PAD (sizeof (SuiteSparseQR_factorization <Entry, Int>))
+        + SPQR_BLOB_PAD (sizeof (spqr_symbolic <Int>))
+        + SPQR_BLOB_PAD (sizeof (spqr_numeric <Entry, Int>))
+        + SPQR_BLOB_PAD (SPQR_BLOB_NSLOTS * sizeof (int64_t))) ;
+}
+
+// size of a stack of the numeric factorization, in # of entries
+template <typename Entry, typename Int> static int64_t spqr_blob_stacksize
+(
+    spqr_numeric <Entry, Int> *QRnum,
+    Int stack
+)
+{
+    return ((QRnum->Stack_size != NULL) ? QRnum->Stack_size [stack] :
+        QRnum->maxstack) ;
+}
+
+// =============================================================================
+// === SuiteSparseQR_serialize_size ============================================
+// =============================================================================
+
+template <typename Entry, typename Int> int64_t SuiteSparseQR_serialize_size
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_common *cc
+)
+{
+    RETURN_IF_NULL_COMMON (EMPTY) ;
+    RETURN_IF_NULL (QR, EMPTY) ;
+    RETURN_IF_NULL (QR->QRsym, EMPTY) ;
+    if (QR->QRup != NULL)
+    {
+        ERROR (CHOLMOD_INVALID, "cannot serialize after rows are appended") ;
+        return (EMPTY) ;
+    }
+    cc->status = CHOLMOD_OK ;
+
+    spqr_blob_array Array [SPQR_BLOB_NARRAYS] ;
+    spqr_blob_arrays (QR, Array) ;
+
+    int64_t size = spqr_blob_prefix <Entry, Int> ( ) ;
+    for (int k = 0 ; k < SPQR_BLOB_NARRAYS ; k++)
+    {
+        if (Array [k].p != NULL && *(Array [k].p) != NULL)
+        {
+            size += SPQR_BLOB_PAD (Array [k].n * Array [k].size) ;
+        }
+    }
+
+    spqr_numeric <Entry, Int> *QRnum = QR->QRnum ;
+    if (QRnum != NULL)
+    {
+        // all stacks in a single region, and the (stack, offset) pairs
+        int64_t stacks = 0 ;
+        for (Int stack = 0 ; stack < QRnum->ns ; stack++)
+        {
+            stacks += spqr_blob_stacksize (QRnum, stack) ;
+        }
+        size += SPQR_BLOB_PAD (stacks * sizeof (Entry)) ;
+        size += SPQR_BLOB_PAD (2 * QRnum->nf * sizeof (int64_t)) ;
+    }
+    return (size) ;
+}
+
+template int64_t SuiteSparseQR_serialize_size <double, int32_t>
+(
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    cholmod_common *cc
+) ;
+template int64_t SuiteSparseQR_serialize_size <Complex, int32_t>
+(
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    cholmod_common *cc
+) ;
+template int64_t SuiteSparseQR_serialize_size <double, int64_t>
+(
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    cholmod_common *cc
+) ;
+template int64_t SuiteSparseQR_serialize_size <Complex, int64_t>
+(
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    cholmod_common *cc
+) ;
+
+// =============================================================================
+// === SuiteSparseQR_serialize =================================================
+// =============================================================================
+
+// copy n bytes to the blob, and pad with zeros to a multiple of SPQR_BLOB_ALIGN
+#define SERIALIZE(object,nbytes)                                    \
+{                                                                   \
+    int64_t s = (int64_t) (nbytes) ;                                \
+    memcpy (blob + offset, object, s) ;                             \
+    memset (blob + offset + s, 0, SPQR_BLOB_PAD (s) - s) ;          \
+    offset += SPQR_BLOB_PAD (s) ;                                   \
+}
+
+template <typename Entry, typename Int> int SuiteSparseQR_serialize
+(
+    int8_t *blob,           // output: of size blobsize, allocated on input
+    int64_t blobsize,       // size of blob, >= SuiteSparseQR_serialize_size
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_common *cc
+)
+{
+
+    // -------------------------------------------------------------------------
+    // check inputs
+    // -------------------------------------------------------------------------
+
+    int64_t required = SuiteSparseQR_serialize_size (QR, cc) ;
+    if (required < 0)
+    {
+        // QR is invalid
+        return (FALSE) ;
+    }
+    RETURN_IF_NULL (blob, FALSE) ;
+    if (blobsize < required)
+    {
+        ERROR (CHOLMOD_INVALID, "blob too small") ;
+        return (FALSE) ;
+    }
+
+    spqr_symbolic <Int> *QRsym = QR->QRsym ;
+    spqr_numeric <Entry, Int> *QRnum = QR->QRnum ;
+
+    // -------------------------------------------------------------------------
+    // header
+    // -------------------------------------------------------------------------
+
+    int32_t h [SPQR_BLOB_NHEADER] ;
+    h [0]  = SPQR_BLOB_MAGIC ;
+    h [1]  = SPQR_MAIN_VERSION ;
+    h [2]  = SPQR_SUB_VERSION ;
+    h [3]  = SPQR_SUBSUB_VERSION ;
+    h [4]  = SPQR_BLOB_FORMAT ;
+    h [5]  = SPQR_BLOB_ALIGN ;
+    h [6]  = sizeof (Entry) ;       // double or complex
+    h [7]  = sizeof (Int) ;         // int32_t or int64_t
+    h [8]  = sizeof (void *) ;
+    h [9]  = sizeof (SuiteSparseQR_factorization <Entry, Int>) ;
+    h [10] = sizeof (spqr_symbolic <Int>) ;
+    h [11] = sizeof (spqr_numeric <Entry, Int>) ;
+    h [12] = (QRnum != NULL) ;
+    h [13] = SPQR_BLOB_NSLOTS ;
+    memset (blob, 0, SPQR_BLOB_HEADER) ;
+    memcpy (blob, &required, sizeof (int64_t)) ;
+    memcpy (blob + sizeof (int64_t), h, SPQR_BLOB_NHEADER * sizeof (int32_t)) ;
+    int64_t offset = SPQR_BLOB_HEADER ;
+
+    // -------------------------------------------------------------------------
+    // structs, with their pointers cleared
+    // -------------------------------------------------------------------------
+
+    SuiteSparseQR_factorization <Entry, Int> QR2 ;
+    spqr_symbolic <Int> QRsym2 ;
+    spqr_numeric <Entry, Int> QRnum2 ;
+    spqr_blob_array Array [SPQR_BLOB_NARRAYS] ;
+    memcpy (&QR2, QR, sizeof (QR2)) ;
+    memcpy (&QRsym2, QRsym, sizeof (QRsym2)) ;
+    memset (&QRnum2, 0, sizeof (QRnum2)) ;
+    if (QRnum != NULL)
+    {
+        memcpy (&QRnum2, QRnum, sizeof (QRnum2)) ;
+    }
+    QR2.QRsym = &QRsym2 ;
+    QR2.QRnum = (QRnum != NULL) ? &QRnum2 : NULL ;
+    spqr_blob_arrays (&QR2, Array) ;
+    for (int k = 0 ; k < SPQR_BLOB_NARRAYS ; k++)
+    {
+        if (Array [k].p != NULL) *(Array [k].p) = NULL ;
+    }
+    QR2.QRsym = NULL ;
+    QR2.QRnum = NULL ;
+    QR2.QRup = NULL ;
+    QR2.view = FALSE ;
+    QRsym2.QRgpu = NULL ;
+    QRsym2.view = FALSE ;
+    QRnum2.Rblock = NULL ;
+    QRnum2.Stacks = NULL ;
+    QRnum2.view = FALSE ;
+    SERIALIZE (&QR2,    sizeof (QR2)) ;
+    SERIALIZE (&QRsym2, sizeof (QRsym2)) ;
+    SERIALIZE (&QRnum2, sizeof (QRnum2)) ;
+
+    // -------------------------------------------------------------------------
+    // arrays
+    // -------------------------------------------------------------------------
+
+    int64_t Dir [SPQR_BLOB_NSLOTS] ;
+    int64_t dir_offset = offset ;
+    offset += SPQR_BLOB_PAD (SPQR_BLOB_NSLOTS * sizeof (int64_t)) ;
+
+    spqr_blob_arrays (QR, Array) ;
+    for (int k = 0 ; k < SPQR_BLOB_NARRAYS ; k++)
+    {
+        Dir [k] = 0 ;
+        if (Array [k].p != NULL && *(Array [k].p) != NULL)
+        {
+            Dir [k] = offset ;
+            SERIALIZE (*(Array [k].p), Array [k].n * Array [k].size) ;
+        }
+    }
+    Dir [SPQR_BLOB_NARRAYS] = 0 ;
+    Dir [SPQR_BLOB_NARRAYS+1] = 0 ;
+
+    if (QRnum != NULL)
+    {
+
+        // ---------------------------------------------------------------------
+        // stacks, in a single region
+        // ---------------------------------------------------------------------
+
+        Int ns = QRnum->ns ;
+        Dir [SPQR_BLOB_NARRAYS] = offset ;
+        int64_t s = 0 ;
+        for (Int stack = 0 ; stack < ns ; stack++)
+        {
+            int64_t sbytes = spqr_blob_stacksize (QRnum, stack) * sizeof (Entry);
+            memcpy (blob + offset + s, QRnum->Stacks [stack], sbytes) ;
+            s += sbytes ;
+        }
+        memset (blob + offset + s, 0, SPQR_BLOB_PAD (s) - s) ;
+        offset += SPQR_BLOB_PAD (s) ;
+
+        // ---------------------------------------------------------------------
+        // position of each R block: the stack it is in, and its offset
+        // ---------------------------------------------------------------------
+
+        // This uses the same mapping of fronts to stacks as spqr_factorize.
+        Int nf = QRnum->nf ;
+        Int ntasks = QRnum->ntasks ;
+        Int *TaskFront = QRsym->TaskFront ;
+        Int *TaskFrontp = QRsym->TaskFrontp ;
+        Int *TaskStack = QRsym->TaskStack ;
+        Dir [SPQR_BLOB_NARRAYS+1] = offset ;
+        int8_t *Rpos = blob + offset ;
+        for (Int task = 0 ; task < ntasks ; task++)
+        {
+            Int kfirst = (ntasks == 1) ? 0  : TaskFrontp [task] ;
+            Int klast  = (ntasks == 1) ? nf : TaskFrontp [task+1] ;
+            int64_t pos [2] ;
+            pos [0] = (ntasks == 1) ? 0 : TaskStack [task] ;
+            for (Int kf = kfirst ; kf < klast ; kf++)
+            {
+                Int f = (ntasks == 1) ? kf : TaskFront [kf] ;
+                pos [1] = QRnum->Rblock [f] - QRnum->Stacks [pos [0]] ;
+                ASSERT (pos [1] >= 0 &&
+                    pos [1] <= spqr_blob_stacksize (QRnum, (Int) pos [0])) ;
+                memcpy (Rpos + 2 * f * sizeof (int64_t), pos,
+                    2 * sizeof (int64_t)) ;
+            }
+        }
+        s = 2 * nf * sizeof (int64_t) ;
+        memset (blob + offset + s, 0, SPQR_BLOB_PAD (s) - s) ;
+        offset += SPQR_BLOB_PAD (s) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // directory
+    // -------------------------------------------------------------------------
+
+    ASSERT (offset == required) ;
+    offset = dir_offset ;
+    SERIALIZE (Dir, SPQR_BLOB_NSLOTS * sizeof (int64_t)) ;
+    return (TRUE) ;
+}
+
+template int SuiteSparseQR_serialize <double, int32_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_serialize <Complex, int32_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_serialize <double, int64_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_serialize <Complex, int64_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    cholmod_common *cc
+) ;
+
+// =============================================================================
+// === SuiteSparseQR_deserialize ===============================================
+// =============================================================================
+
+#define FREE_ALL_AND_RETURN_IF_INVALID(invalid)                     \
+{                                                                   \
+    if (invalid)                                                    \
+    {                                                               \
+        spqr_freefac (&QR, cc) ;                                    \
+        ERROR (CHOLMOD_INVALID, "invalid blob") ;                   \
+        return (NULL) ;                                             \
+    }                                                               \
+}
+
+template <typename Entry, typename Int>
+SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_deserialize
+(
+    int8_t *blob,           // input: serialized blob
+    int64_t blobsize,       // size of blob
+    int view,               // if TRUE, use the blob in place
+    cholmod_common *cc
+)
+{
+    SuiteSparseQR_factorization <Entry, Int> *QR ;
+    spqr_symbolic <Int> *QRsym ;
+    spqr_numeric <Entry, Int> *QRnum ;
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (blob, NULL) ;
+    cc->status = CHOLMOD_OK ;
+
+    // -------------------------------------------------------------------------
+    // check the header
+    // -------------------------------------------------------------------------
+
+    int64_t prefix = spqr_blob_prefix <Entry, Int> ( ) ;
+    int64_t required = 0 ;
+    int32_t h [SPQR_BLOB_NHEADER] ;
+    if (blobsize >= prefix)
+    {
+        memcpy (&required, blob, sizeof (int64_t)) ;
+        memcpy (h, blob + sizeof (int64_t),
+            SPQR_BLOB_NHEADER * sizeof (int32_t)) ;
+    }
+    if (blobsize < prefix || required < prefix || required > blobsize
+        || h [0] != SPQR_BLOB_MAGIC
+        || h [4] != SPQR_BLOB_FORMAT
+        || h [5] != SPQR_BLOB_ALIGN
+        || h [6] != (int32_t) sizeof (Entry)
+        || h [7] != (int32_t) sizeof (Int)
+        || h [8] != (int32_t) sizeof (void *)
+        || h [9] != (int32_t) sizeof (SuiteSparseQR_factorization <Entry, Int>)
+        || h [10] != (int32_t) sizeof (spqr_symbolic <Int>)
+        || h [11] != (int32_t) sizeof (spqr_numeric <Entry, Int>)
+        || h [13] != SPQR_BLOB_NSLOTS
+        || (view && ((uintptr_t) blob) % sizeof (double) != 0))
+    {
+        ERROR (CHOLMOD_INVALID, "invalid blob") ;
+        return (NULL) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // get the structs
+    // -------------------------------------------------------------------------
+
+    int64_t offset = SPQR_BLOB_HEADER ;
+    QR = (SuiteSparseQR_factorization <Entry, Int> *) spqr_malloc <Int> (1,
+        sizeof (SuiteSparseQR_factorization <Entry, Int>), cc) ;
+    QRsym = (spqr_symbolic <Int> *) spqr_malloc <Int> (1,
+        sizeof (spqr_symbolic <Int>), cc) ;
+    QRnum = (h [12]) ? ((spqr_numeric <Entry, Int> *) spqr_malloc <Int> (1,
+        sizeof (spqr_numeric <Entry, Int>), cc)) : NULL ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        spqr_free <Int> (1, sizeof (SuiteSparseQR_factorization <Entry, Int>),
+            QR, cc) ;
+        spqr_free <Int> (1, sizeof (spqr_symbolic <Int>), QRsym, cc) ;
+        spqr_free <Int> (1, sizeof (spqr_numeric <Entry, Int>), QRnum, cc) ;
+        return (NULL) ;
+    }
+
+    memcpy (QR, blob + offset, sizeof (SuiteSparseQR_factorization <Entry,Int>));
+    offset += SPQR_BLOB_PAD (sizeof (SuiteSparseQR_factorization <Entry,Int>)) ;
+    memcpy (QRsym, blob + offset, sizeof (spqr_symbolic <Int>)) ;
+    offset += SPQR_BLOB_PAD (sizeof (spqr_symbolic <Int>)) ;
+    if (QRnum != NULL)
+    {
+        memcpy (QRnum, blob + offset, sizeof (spqr_numeric <Entry, Int>)) ;
+        QRnum->Rblock = NULL ;
+        QRnum->Stacks = NULL ;
+        QRnum->view = (view != 0) ;
+    }
+    offset += SPQR_BLOB_PAD (sizeof (spqr_numeric <Entry, Int>)) ;
+    QR->QRsym = QRsym ;
+    QR->QRnum = QRnum ;
+    QR->QRup = NULL ;
+    QR->view = (view != 0) ;
+    QRsym->QRgpu = NULL ;
+    QRsym->view = (view != 0) ;
+
+    // clear all other pointers, so that QR can be safely freed
+    spqr_blob_array Array [SPQR_BLOB_NARRAYS] ;
+    spqr_blob_arrays (QR, Array) ;
+    for (int k = 0 ; k < SPQR_BLOB_NARRAYS ; k++)
+    {
+        if (Array [k].p != NULL) *(Array [k].p) = NULL ;
+    }
+
+    // -------------------------------------------------------------------------
+    // get the arrays
+    // -------------------------------------------------------------------------
+
+    int64_t Dir [SPQR_BLOB_NSLOTS] ;
+    memcpy (Dir, blob + offset, SPQR_BLOB_NSLOTS * sizeof (int64_t)) ;
+
+    for (int k = 0 ; k < SPQR_BLOB_NARRAYS ; k++)
+    {
+        int64_t p = Dir [k] ;
+        if (Array [k].p == NULL || p == 0) continue ;
+        int64_t s = Array [k].n * Array [k].size ;
+        FREE_ALL_AND_RETURN_IF_INVALID (Array [k].n < 0 || p < prefix ||
+            p % SPQR_BLOB_ALIGN != 0 || p > required - s) ;
+        if (view && Array [k].p != (void **) &(QR->Rmap) &&
+                    Array [k].p != (void **) &(QR->RmapInv))
+        {
+            *(Array [k].p) = (void *) (blob + p) ;
+        }
+        else
+        {
+            // copy the array; Rmap and RmapInv are copied even for a view
+            *(Array [k].p) = spqr_malloc <Int> (Array [k].n, Array [k].size,
+                cc) ;
+            if (cc->status < CHOLMOD_OK)
+            {
+                // out of memory
+                spqr_freefac (&QR, cc) ;
+                return (NULL) ;
+            }
+            memcpy (*(Array [k].p), blob + p, s) ;
+        }
+    }
+
+    if (QRnum != NULL)
+    {
+        Int ns = QRnum->ns ;
+        Int nf = QRnum->nf ;
+        FREE_ALL_AND_RETURN_IF_INVALID (ns < 0 || nf < 0 ||
+            Dir [SPQR_BLOB_NARRAYS] < prefix ||
+            Dir [SPQR_BLOB_NARRAYS+1] < prefix) ;
+        QRnum->Stacks = (Entry **) spqr_calloc <Int> (ns, sizeof (Entry *), cc);
+        QRnum->Rblock = (Entry **) spqr_calloc <Int> (nf, sizeof (Entry *), cc);
+        if (cc->status < CHOLMOD_OK)
+        {
+            // out of memory
+            spqr_freefac (&QR, cc) ;
+            return (NULL) ;
+        }
+
+        // ---------------------------------------------------------------------
+        // get the stacks
+        // ---------------------------------------------------------------------
+
+        int64_t p = Dir [SPQR_BLOB_NARRAYS] ;
+        for (Int stack = 0 ; stack < ns ; stack++)
+        {
+            int64_t stacksize = spqr_blob_stacksize (QRnum, stack) ;
+            int64_t s = stacksize * sizeof (Entry) ;
+            FREE_ALL_AND_RETURN_IF_INVALID (stacksize < 0 || p > required - s) ;
+            if (view)
+            {
+                QRnum->Stacks [stack] = (Entry *) (blob + p) ;
+            }
+            else
+            {
+                QRnum->Stacks [stack] = (Entry *) spqr_malloc <Int> (stacksize,
+                    sizeof (Entry), cc) ;
+                if (cc->status < CHOLMOD_OK)
+                {
+                    // out of memory
+                    spqr_freefac (&QR, cc) ;
+                    return (NULL) ;
+                }
+                memcpy ((void *) QRnum->Stacks [stack], blob + p, s) ;
+            }
+            p += s ;
+        }
+
+        // ---------------------------------------------------------------------
+        // get the R blocks
+        // ---------------------------------------------------------------------
+
+        p = Dir [SPQR_BLOB_NARRAYS+1] ;
+        FREE_ALL_AND_RETURN_IF_INVALID (
+            p > required - (int64_t) (2 * nf * sizeof (int64_t))) ;
+        for (Int f = 0 ; f < nf ; f++)
+        {
+            int64_t pos [2] ;
+            memcpy (pos, blob + p + 2 * f * sizeof (int64_t),
+                2 * sizeof (int64_t)) ;
+            FREE_ALL_AND_RETURN_IF_INVALID (pos [0] < 0 || pos [0] >= ns ||
+                pos [1] < 0 ||
+                pos [1] > spqr_blob_stacksize (QRnum, (Int) pos [0])) ;
+            QRnum->Rblock [f] = QRnum->Stacks [pos [0]] + pos [1] ;
+        }
+    }
+
+    return (QR) ;
+}
+
+template SuiteSparseQR_factorization <double, int32_t> *
+SuiteSparseQR_deserialize <double, int32_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    int view,
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <Complex, int32_t> *
+SuiteSparseQR_deserialize <Complex, int32_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    int view,
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <double, int64_t> *
+SuiteSparseQR_deserialize <double, int64_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    int view,
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <Complex, int64_t> *
+SuiteSparseQR_deserialize <Complex, int64_t>
+(
+    int8_t *blob,
+    int64_t blobsize,
+    int view,
+    cholmod_common *cc
+) ;
+
+#endif
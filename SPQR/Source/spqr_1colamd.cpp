@@ -152,7 +152,7 @@ template <typename Entry, typename Int> int spqr_1colamd  // TRUE if OK, FALSE o
     // create AT = spones (A')
     // -------------------------------------------------------------------------
 
-    AT = spqr_transpose <Int> (A, 0, cc) ;       // [
+    AT = spqr_ptranspose <Int> (A, cc) ;         // [
 
     if (cc->status < CHOLMOD_OK)
     {
@@ -146,6 +146,8 @@ template <typename Entry, typename Int> SuiteSparseQR_factorization <Entry, Int>
     QR->Rmap = NULL ;
     QR->RmapInv = NULL ;
     QR->HP1inv = NULL ;
+    QR->QRup = NULL ;
+    QR->view = FALSE ;
 
     QR->narows = m ;
     QR->nacols = n ;
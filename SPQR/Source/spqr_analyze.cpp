@@ -93,7 +93,7 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
 
     do_parallel_analysis = (cc->SPQR_grain > 1) ;
 
-    // The analysis for TBB parallelism attempts to construct a task graph with
+    // The analysis for task parallelism attempts to construct a task graph with
     // leaf nodes with flop counts >= max ((total flops) / cc->SPQR_grain,
     // cc->SPQR_small).  If cc->SPQR_grain <= 1, or if the total flop
     // count is less than cc->SPQR_small, then no parallelism will be
@@ -121,7 +121,7 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
     }
 
     // Disable the GPU if the Householder vectors are requested, if we're
-    // using TBB, if rank detection is requested, or if A is not real
+    // using OpenMP tasks, if rank detection is requested, or if A is not real
     if (keepH || do_parallel_analysis || do_rank_detection ||
         A->xtype != CHOLMOD_REAL)
     {
@@ -177,7 +177,7 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
     // supernodal Cholesky ordering and analysis of A'A
     // -------------------------------------------------------------------------
 
-    AT = spqr_transpose <Int> (A, 0, cc) ;   // AT = spones (A') [
+    AT = spqr_ptranspose <Int> (A, cc) ;     // AT = spones (A') [
 
     // save the current CHOLMOD settings
     Int save [6] ;
@@ -342,6 +342,7 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
         return (NULL) ;
     }
 
+    QRsym->view = FALSE ;       // see SuiteSparseQR_deserialize
     QRsym->m = m ;
     QRsym->n = n ;
     QRsym->do_rank_detection = do_rank_detection ;
@@ -618,7 +619,7 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
 
     // use W [0:m-1] workspace in spqr_stranspose1:
     spqr_stranspose1 (A, QRsym->Qfill, QRsym->Sp, QRsym->Sj, QRsym->PLinv,
-        Sleft, W) ;
+        Sleft, W, cc) ;
 
     // -------------------------------------------------------------------------
     // determine flop counts, front sizes, and sequential memory usage
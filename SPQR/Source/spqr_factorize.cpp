@@ -279,7 +279,7 @@ template <typename Entry, typename Int> spqr_numeric <Entry, Int> *spqr_factoriz
     if (cc->status == CHOLMOD_OK)
     {
         // use Wi as workspace (Iwork (0:m-1)) [
-        spqr_stranspose2 (A, Qfill, Sp, PLinv, Sx, Wi) ;
+        spqr_stranspose2 (A, Qfill, Sp, PLinv, Sx, Wi, cc) ;
         // Wi no longer needed ]
     }
 
@@ -320,6 +320,8 @@ template <typename Entry, typename Int> spqr_numeric <Entry, Int> *spqr_factoriz
         return (NULL) ;
     }
 
+    QRnum->view = FALSE ;       // see SuiteSparseQR_deserialize
+
     Rblock     = (Entry **) spqr_malloc <Int> (nf, sizeof (Entry *), cc) ;
     Rdead      = (char *)   spqr_calloc <Int> (n,  sizeof (char),    cc) ;
 
@@ -496,23 +498,16 @@ template <typename Entry, typename Int> spqr_numeric <Entry, Int> *spqr_factoriz
 
     if (ntasks == 1)
     {
-        // Just one task, with or without TBB installed: don't use TBB
+        // Just one task: factorize all fronts in postorder
         spqr_kernel <Entry, Int> (0, &Blob) ;        // sequential case
     }
     else
     {
-#if 0 /* ifdef HAVE_TBB (TBB removed) */
-        // parallel case: TBB is installed, and there is more than one task
+        // parallel case: factorize the task tree with OpenMP tasks.  This
+        // does tasks 0 to ntasks-2 in order if OpenMP is not available, or if
+        // cc->SPQR_nthreads is 1.
         int nthreads = MAX (0, cc->SPQR_nthreads) ;
         spqr_parallel (ntasks, nthreads, &Blob) ;
-#else
-        // TBB not installed, but the work is still split into multiple tasks.
-        // do tasks 0 to ntasks-2 (skip the placeholder root task id = ntasks-1)
-        for (Int id = 0 ; id < ntasks-1 ; id++)
-        {
-            spqr_kernel (id, &Blob) ;
-        }
-#endif
     }
 
     PR (("] did the kernel\n")) ;
@@ -37,6 +37,20 @@ template <typename Entry, typename Int> void spqr_freefac
 
     spqr_freenum (& (QR->QRnum), cc) ;
     spqr_freesym (& (QR->QRsym), cc) ;
+    spqr_rupdate_free (& (QR->QRup), cc) ;
+
+    if (QR->view)
+    {
+        // the arrays are held in a serialized blob, except for Rmap and
+        // RmapInv, which are copied by SuiteSparseQR_deserialize or allocated
+        // by SuiteSparseQR_numeric
+        spqr_free <Int> (n, sizeof (Int), QR->Rmap,    cc) ;
+        spqr_free <Int> (n, sizeof (Int), QR->RmapInv, cc) ;
+        spqr_free <Int> (1, sizeof (SuiteSparseQR_factorization <Entry, Int>),
+            QR, cc) ;
+        *QR_handle = NULL ;
+        return ;
+    }
 
     spqr_free <Int> (n+bncols, sizeof (Int),  QR->Q1fill,  cc) ; 
     spqr_free <Int> (m,        sizeof (Int),  QR->P1inv,   cc) ;
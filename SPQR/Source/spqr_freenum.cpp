@@ -38,6 +38,16 @@ template <typename Entry, typename Int> void spqr_freenum
     maxstack = QRnum->maxstack ;
 
     spqr_free <Int> (nf, sizeof (Entry *), QRnum->Rblock, cc) ;
+
+    if (QRnum->view)
+    {
+        // all other arrays are held in a serialized blob
+        spqr_free <Int> (ns, sizeof (Entry *), QRnum->Stacks, cc) ;
+        spqr_free <Int> (1, sizeof (spqr_numeric<Entry, Int>), QRnum, cc) ;
+        *QRnum_handle = NULL ;
+        return ;
+    }
+
     spqr_free <Int> (n,  sizeof (char),    QRnum->Rdead,  cc) ;
 
     if (QRnum->keepH)
@@ -36,6 +36,14 @@ template <typename Int> void spqr_freesym
     anz = QRsym->anz ;
     rjsize = QRsym->rjsize ;
 
+    if (QRsym->view)
+    {
+        // the arrays are held in a serialized blob
+        spqr_free <Int> (1, sizeof (spqr_symbolic <Int>), QRsym, cc) ;
+        *QRsym_handle = NULL ;
+        return ;
+    }
+
     spqr_free <Int> (n,      sizeof (Int), QRsym->Qfill, cc) ;
     spqr_free <Int> (nf+1,   sizeof (Int), QRsym->Super, cc) ;
     spqr_free <Int> (nf+1,   sizeof (Int), QRsym->Rp, cc) ;
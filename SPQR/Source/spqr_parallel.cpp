@@ -7,79 +7,80 @@
 
 //------------------------------------------------------------------------------
 
-// Factorize all the tasks in parallel with TBB.
-// The GPU is not used.
+// Factorize all the tasks in parallel with OpenMP tasks.  The GPU is not used.
+//
+// The task tree is given by QRsym->TaskChildp and QRsym->TaskChild.  Each task
+// is a set of fronts (TaskFrontp, TaskFront) that are factorized in order, on
+// the stack TaskStack [task].  A task can start once all of its child tasks
+// are done.  Each stack is used by a single chain of tasks from a leaf towards
+// the root, so sibling subtrees can be factorized at the same time.  The root
+// task id = ntasks-1 is a placeholder with no fronts.  If OpenMP is not
+// available, or only one thread is to be used, the tasks are done in order.
+//
+// The result does not depend on the number of threads, since each front is
+// factorized by the same sequence of operations, in any schedule.
 
-#if 0 /* ifdef HAVE_TBB (TBB removed) */
 #include "spqr.hpp"
-#include <tbb/task_scheduler_init.h>
-#include <tbb/task.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
-using namespace tbb ;
+#ifdef _OPENMP
 
 // =============================================================================
 // === spqr_zippy ==============================================================
 // =============================================================================
 
-template <typename Entry, typename Int> class spqr_zippy: public task
-{
-  public:
-
-    // -------------------------------------------------------------------------
-    // spqr_zippy state
-    // -------------------------------------------------------------------------
+// Factorize the subtree rooted at task id: spawn an OpenMP task for each child
+// subtree, wait for all of them to finish, and then do the task itself.
 
-    const Int id ;
-    spqr_blob <Entry> *Blob ;
+template <typename Entry, typename Int> static void spqr_zippy
+(
+    Int id,
+    Int ntasks,
+    spqr_blob <Entry, Int> *Blob
+)
+{
 
     // -------------------------------------------------------------------------
-    // spqr_zippy constructor
+    // spawn my children
     // -------------------------------------------------------------------------
 
-    spqr_zippy (Int id_, spqr_blob <Entry> *Blob_) : id (id_), Blob (Blob_) { }
+    Int *TaskChildp = Blob->QRsym->TaskChildp ;
+    Int *TaskChild  = Blob->QRsym->TaskChild ;
+    Int pfirst = TaskChildp [id] ;
+    Int plast  = TaskChildp [id+1] ;
 
-    // -------------------------------------------------------------------------
-    // spqr_zippy task
-    // -------------------------------------------------------------------------
-
-    task* execute ( )
+    if (plast - pfirst > 1)
     {
-
-        // ---------------------------------------------------------------------
-        // spawn my children
-        // ---------------------------------------------------------------------
-
-        Int *TaskChildp = Blob->QRsym->TaskChildp ;
-        Int *TaskChild  = Blob->QRsym->TaskChild ;
-        Int pfirst = TaskChildp [id] ;
-        Int plast  = TaskChildp [id+1] ;
-        Int nchildren = plast - pfirst ;
-
-        if (nchildren > 0)
+        // spawn all but the last child as OpenMP tasks
+        for (Int p = pfirst ; p < plast-1 ; p++)
         {
-            // create a list of TBB tasks, one for each child
-            task_list TasksToDo ;
-            for (Int i = 0 ; i < nchildren ; i++)
-            {
-                Int child = TaskChild [pfirst+i] ;
-                TasksToDo.push_back (*new (allocate_child ( ))
-                    spqr_zippy (child, Blob)) ;
-            }
-            // spawn all children and wait for all of them to finish
-            set_ref_count (nchildren + 1) ;
-            spawn_and_wait_for_all (TasksToDo) ;
+            Int child = TaskChild [p] ;
+            #pragma omp task default(none) firstprivate(child, ntasks, Blob)
+            spqr_zippy (child, ntasks, Blob) ;
         }
+        // this thread does the last child itself, then waits for the rest
+        spqr_zippy (TaskChild [plast-1], ntasks, Blob) ;
+        #pragma omp taskwait
+    }
+    else if (plast - pfirst == 1)
+    {
+        // just one child: no need to create a new OpenMP task
+        spqr_zippy (TaskChild [pfirst], ntasks, Blob) ;
+    }
 
-        // ---------------------------------------------------------------------
-        // chilren are done, do my own task
-        // ---------------------------------------------------------------------
+    // -------------------------------------------------------------------------
+    // children are done, do my own task (skip the placeholder root task)
+    // -------------------------------------------------------------------------
 
+    if (id < ntasks-1)
+    {
         spqr_kernel (id, Blob) ;
-
-        return (NULL) ;
     }
-} ;
+}
 
+#endif
 
 // =============================================================================
 // === spqr_parallel ===========================================================
@@ -88,17 +89,36 @@ template <typename Entry, typename Int> class spqr_zippy: public task
 template <typename Entry, typename Int> void spqr_parallel
 (
     Int ntasks,
-    int nthreads,
+    int nthreads,       // # of threads to use; 0 (or less) means the default
     spqr_blob <Entry, Int> *Blob
 )
 {
-    // fire up TBB on the task tree, starting at the root id = ntasks-1
-    task_scheduler_init
-        init (nthreads <= 0 ? (task_scheduler_init::automatic) : nthreads) ;
-    spqr_zippy <Entry> & a = *new (task::allocate_root ( ))
-        spqr_zippy <Entry, Int> (ntasks-1, Blob) ;
-    task::spawn_root_and_wait (a) ;
+
+#ifdef _OPENMP
+    if (nthreads <= 0)
+    {
+        nthreads = omp_get_max_threads ( ) ;
+    }
+    // no more threads than there are (non-root) tasks
+    nthreads = (int) MIN ((Int) nthreads, ntasks-1) ;
+    if (nthreads > 1)
+    {
+        // factorize the task tree, starting at the root id = ntasks-1
+        #pragma omp parallel num_threads(nthreads)
+        #pragma omp single nowait
+        spqr_zippy (ntasks-1, ntasks, Blob) ;
+        return ;
+    }
+#endif
+
+    // OpenMP not available, or only one thread: do tasks 0 to ntasks-2 in
+    // order (skip the placeholder root task id = ntasks-1)
+    for (Int id = 0 ; id < ntasks-1 ; id++)
+    {
+        spqr_kernel (id, Blob) ;
+    }
 }
+
 template void spqr_parallel <double, int32_t>
 (
     int32_t ntasks,
@@ -123,4 +143,3 @@ template void spqr_parallel <Complex, int64_t>
     int nthreads,
     spqr_blob <Complex, int64_t> *Blob
 ) ;
-#endif
@@ -0,0 +1,405 @@
+// =============================================================================
+// === spqr_ptranspose =========================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Parallel transposes of a sparse matrix A with sorted columns.  The rows of A
+// are split into nthreads contiguous ranges, one per thread.  Since each
+// column of A is sorted, the entries of column j that lie in the rows of
+// thread t are a contiguous part of that column, found by binary search.
+// Each thread then sweeps all the columns of A but visits only the entries in
+// its own rows, so the threads write to disjoint rows of the result without
+// any synchronization, and the result does not depend on the number of
+// threads.
+//
+// This pays off for tall matrices: each thread does n binary searches, which
+// is cheap compared with the nnz(A)/nthreads entries it handles.
+// spqr_ptranspose_work decides how many threads to use; it returns NULL (one
+// thread) if OpenMP is not available, if A does not have sorted columns, or if
+// A is too small.  The callers then use their sequential methods.
+//
+// spqr_ptranspose_work and spqr_ptranspose_scan are used by spqr_stranspose1,
+// spqr_stranspose2, and SuiteSparseQR_symbolic_matches.
+
+#include "spqr.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// each thread handles at least this many entries of A
+#define SPQR_PTRANSPOSE_CHUNK 65536
+
+// =============================================================================
+// === spqr_ptranspose_work ====================================================
+// =============================================================================
+
+// Determines the number of threads to use and allocates their workspace, of
+// size wsize = (nthreads+1) + nthreads*(n+extra).  The workspace starts with
+// Rstart [0..nthreads], where thread t owns rows Rstart [t] to Rstart [t+1]-1
+// of A, followed by Pstart [t*n + j] for each thread t and column j: the
+// position in column j of its first entry in row Rstart [t] or later.  Entry
+// positions Pstart [t*n + j] to Pstart [(t+1)*n + j]-1 of column j belong to
+// thread t (with Ap [j+1] in place of Pstart [nthreads*n + j]).  The
+// remaining nthreads*extra entries are left for the caller.
+//
+// Returns NULL and nthreads = 1 if only one thread is to be used, or if out of
+// memory (in which case cc->status is restored to CHOLMOD_OK, so that the
+// caller can use its sequential method instead).
+
+template <typename Int> Int *spqr_ptranspose_work
+(
+    // input, not modified
+    cholmod_sparse *A,      // m-by-n
+    Int extra,              // additional workspace per thread
+
+    // output
+    int *p_nthreads,        // number of threads to use
+    size_t *p_wsize,        // size of the workspace
+
+    cholmod_common *cc
+)
+{
+    int nthreads = 1 ;
+    *p_nthreads = 1 ;
+    *p_wsize = 0 ;
+
+#ifdef _OPENMP
+    Int m = A->nrow ;
+    Int n = A->ncol ;
+    Int *Ap = (Int *) A->p ;
+    Int anz = Ap [n] ;
+
+    if (A->sorted && A->packed)
+    {
+        nthreads = cc->SPQR_nthreads ;
+        if (nthreads <= 0)
+        {
+            nthreads = omp_get_max_threads ( ) ;
+        }
+        // each thread needs at least SPQR_PTRANSPOSE_CHUNK entries, and its
+        // n binary searches must be cheap compared with its entries
+        double work = MIN ((double) anz / SPQR_PTRANSPOSE_CHUNK,
+                           (double) anz / (4 * ((double) n + 1))) ;
+        nthreads = (int) MIN ((double) nthreads, work) ;
+        nthreads = (int) MIN ((Int) nthreads, m) ;
+    }
+    if (nthreads <= 1)
+    {
+        return (NULL) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // allocate the workspace
+    // -------------------------------------------------------------------------
+
+    size_t wsize = (nthreads+1) + ((size_t) nthreads) * (n + extra) ;
+    Int *Work = (Int *) spqr_malloc <Int> (wsize, sizeof (Int), cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory; the caller uses its sequential method instead
+        cc->status = CHOLMOD_OK ;
+        return (NULL) ;
+    }
+    Int *Rstart = Work ;
+    Int *Pstart = Work + (nthreads+1) ;
+    Int *Ai = (Int *) A->i ;
+
+    // -------------------------------------------------------------------------
+    // split the rows of A, and find the start of each thread in each column
+    // -------------------------------------------------------------------------
+
+    for (int t = 0 ; t <= nthreads ; t++)
+    {
+        Rstart [t] = (Int) (((int64_t) t * (int64_t) m) / nthreads) ;
+    }
+
+    int t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int i0 = Rstart [t] ;
+        Int *Pt = Pstart + ((size_t) t) * n ;
+        for (Int j = 0 ; j < n ; j++)
+        {
+            // find the first entry in A(i0:m-1,j)
+            Int lo = Ap [j] ;
+            Int hi = Ap [j+1] ;
+            while (lo < hi)
+            {
+                Int mid = lo + (hi - lo) / 2 ;
+                if (Ai [mid] < i0)
+                {
+                    lo = mid + 1 ;
+                }
+                else
+                {
+                    hi = mid ;
+                }
+            }
+            Pt [j] = lo ;
+        }
+    }
+
+    *p_nthreads = nthreads ;
+    *p_wsize = wsize ;
+    return (Work) ;
+#else
+    return (NULL) ;
+#endif
+}
+
+template int32_t *spqr_ptranspose_work <int32_t>
+(
+    // input, not modified
+    cholmod_sparse *A,      // m-by-n
+    int32_t extra,          // additional workspace per thread
+
+    // output
+    int *p_nthreads,        // number of threads to use
+    size_t *p_wsize,        // size of the workspace
+
+    cholmod_common *cc
+) ;
+
+template int64_t *spqr_ptranspose_work <int64_t>
+(
+    // input, not modified
+    cholmod_sparse *A,      // m-by-n
+    int64_t extra,          // additional workspace per thread
+
+    // output
+    int *p_nthreads,        // number of threads to use
+    size_t *p_wsize,        // size of the workspace
+
+    cholmod_common *cc
+) ;
+
+// =============================================================================
+// === spqr_ptranspose_scan ====================================================
+// =============================================================================
+
+// Replaces X [0..m-1] with cumsum ([0 X]), and sets X [m] to the total, with
+// nthreads threads.  Each thread sums its own range of X, and then computes
+// the cumulative sum of that range.  Psum is workspace of size nthreads.
+
+template <typename Int> void spqr_ptranspose_scan
+(
+    Int m,
+    Int *X,                 // size m+1
+    int nthreads,
+    Int *Psum               // workspace of size nthreads
+)
+{
+#ifdef _OPENMP
+    int t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int i0 = (Int) (((int64_t) t * (int64_t) m) / nthreads) ;
+        Int i1 = (Int) (((int64_t) (t+1) * (int64_t) m) / nthreads) ;
+        Int s = 0 ;
+        for (Int i = i0 ; i < i1 ; i++)
+        {
+            s += X [i] ;
+        }
+        Psum [t] = s ;
+    }
+
+    Int s = 0 ;
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int c = Psum [t] ;
+        Psum [t] = s ;
+        s += c ;
+    }
+    X [m] = s ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int i0 = (Int) (((int64_t) t * (int64_t) m) / nthreads) ;
+        Int i1 = (Int) (((int64_t) (t+1) * (int64_t) m) / nthreads) ;
+        Int s = Psum [t] ;
+        for (Int i = i0 ; i < i1 ; i++)
+        {
+            Int c = X [i] ;
+            X [i] = s ;
+            s += c ;
+        }
+    }
+#else
+    Int s = 0 ;
+    for (Int i = 0 ; i < m ; i++)
+    {
+        Int c = X [i] ;
+        X [i] = s ;
+        s += c ;
+    }
+    X [m] = s ;
+#endif
+}
+
+template void spqr_ptranspose_scan <int32_t>
+(
+    int32_t m,
+    int32_t *X,             // size m+1
+    int nthreads,
+    int32_t *Psum           // workspace of size nthreads
+) ;
+
+template void spqr_ptranspose_scan <int64_t>
+(
+    int64_t m,
+    int64_t *X,             // size m+1
+    int nthreads,
+    int64_t *Psum           // workspace of size nthreads
+) ;
+
+// =============================================================================
+// === spqr_ptranspose =========================================================
+// =============================================================================
+
+// AT = spones (A'), in parallel if possible, or with spqr_transpose otherwise.
+// Row i of A becomes column i of AT, which is filled by the thread that owns
+// row i.  Its entries are in increasing order, since each thread sweeps the
+// columns of A in order.
+
+template <typename Int> cholmod_sparse *spqr_ptranspose
+(
+    cholmod_sparse *A,      // m-by-n
+    cholmod_common *cc
+)
+{
+    int nthreads ;
+    size_t wsize ;
+    Int *Work = spqr_ptranspose_work <Int> (A, 1, &nthreads, &wsize, cc) ;
+    if (Work == NULL)
+    {
+        return (spqr_transpose <Int> (A, 0, cc)) ;
+    }
+
+#ifdef _OPENMP
+    Int m = A->nrow ;
+    Int n = A->ncol ;
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    Int anz = Ap [n] ;
+
+    cholmod_sparse *AT = spqr_allocate_sparse <Int> (n, m, anz, TRUE, TRUE, 0,
+        CHOLMOD_PATTERN, cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        spqr_free <Int> (wsize, sizeof (Int), Work, cc) ;
+        return (NULL) ;
+    }
+    Int *ATp = (Int *) AT->p ;
+    Int *ATi = (Int *) AT->i ;
+
+    Int *Rstart = Work ;
+    Int *Pstart = Work + (nthreads+1) ;
+    Int *Psum = Pstart + ((size_t) nthreads) * n ;
+
+    // -------------------------------------------------------------------------
+    // count the entries in each row of A
+    // -------------------------------------------------------------------------
+
+    int t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int *Pt = Pstart + ((size_t) t) * n ;
+        Int *Pnext = Pt + n ;
+        for (Int i = Rstart [t] ; i < Rstart [t+1] ; i++)
+        {
+            ATp [i] = 0 ;
+        }
+        for (Int j = 0 ; j < n ; j++)
+        {
+            Int pend = (t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+            for (Int p = Pt [j] ; p < pend ; p++)
+            {
+                ATp [Ai [p]]++ ;
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // ATp = cumsum ([0 ATp])
+    // -------------------------------------------------------------------------
+
+    // Rstart [t] = (t*m)/nthreads, so the scan splits ATp the same way
+    spqr_ptranspose_scan <Int> (m, ATp, nthreads, Psum) ;
+
+    // -------------------------------------------------------------------------
+    // fill AT, advancing ATp [i] to the end of column i of AT
+    // -------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int *Pt = Pstart + ((size_t) t) * n ;
+        Int *Pnext = Pt + n ;
+        for (Int j = 0 ; j < n ; j++)
+        {
+            Int pend = (t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+            for (Int p = Pt [j] ; p < pend ; p++)
+            {
+                ATi [ATp [Ai [p]]++] = j ;
+            }
+        }
+        // the end of the last column of thread t is the start of thread t+1
+        Psum [t] = (Rstart [t+1] > Rstart [t]) ? ATp [Rstart [t+1]-1] : EMPTY ;
+    }
+
+    // -------------------------------------------------------------------------
+    // shift ATp back to the start of each column
+    // -------------------------------------------------------------------------
+
+    // ATp [i] is now the start of column i+1.  Each thread shifts its own
+    // range, and takes the start of its first column from the thread before.
+    Int s = 0 ;
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int c = Psum [t] ;
+        Psum [t] = s ;
+        if (c != EMPTY) s = c ;
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int i0 = Rstart [t] ;
+        for (Int i = Rstart [t+1]-1 ; i > i0 ; i--)
+        {
+            ATp [i] = ATp [i-1] ;
+        }
+        if (Rstart [t+1] > i0)
+        {
+            ATp [i0] = Psum [t] ;
+        }
+    }
+    ASSERT (ATp [m] == anz) ;
+
+    spqr_free <Int> (wsize, sizeof (Int), Work, cc) ;
+    return (AT) ;
+#else
+    return (NULL) ;
+#endif
+}
+
+template cholmod_sparse *spqr_ptranspose <int32_t>
+(
+    cholmod_sparse *A,      // m-by-n
+    cholmod_common *cc
+) ;
+
+template cholmod_sparse *spqr_ptranspose <int64_t>
+(
+    cholmod_sparse *A,      // m-by-n
+    cholmod_common *cc
+) ;
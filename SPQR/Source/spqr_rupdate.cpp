@@ -0,0 +1,412 @@
+// =============================================================================
+// === spqr_rupdate ============================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// spqr_rupdate_init: creates the row-oriented R used by
+// SuiteSparseQR_append_rows, from the singleton rows and the multifrontal
+// R of a QR factorization.
+//
+// R is held by rows, and is n-by-n upper triangular in the column order of
+// A*E, where E = QR->Q1fill.  If A is rank deficient, the squeezed R of the
+// factorization is expanded so that R(j,j) is the diagonal entry for column
+// j, and the rows of dead columns are empty.  Only the first QR->rank rows of
+// the factorization are used, which is the same R used for the basic solution
+// x = E*(R\(Q'*b)).
+//
+// spqr_rupdate_expand: expands C = Q'*B in the same way as R, so that its rows
+// match the rows of the row-oriented R.
+//
+// spqr_rupdate_free: frees the object.
+
+#include "spqr.hpp"
+
+// =============================================================================
+// === spqr_rupdate_free =======================================================
+// =============================================================================
+
+template <typename Entry, typename Int> void spqr_rupdate_free
+(
+    spqr_rupdate <Entry, Int> **QRup_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    spqr_rupdate <Entry, Int> *QRup ;
+    Int n, rsize ;
+
+    if (QRup_handle == NULL || *QRup_handle == NULL)
+    {
+        // nothing to do; caller probably ran out of memory
+        return ;
+    }
+    QRup = *QRup_handle ;
+
+    n     = QRup->n ;
+    rsize = QRup->rsize ;
+
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Rp,   cc) ;
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Rlen, cc) ;
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Rcap, cc) ;
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Rrot, cc) ;
+    spqr_free <Int> (rsize, sizeof (Int),   QRup->Rj,   cc) ;
+    spqr_free <Int> (rsize, sizeof (Entry), QRup->Rx,   cc) ;
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Qinv, cc) ;
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Heap, cc) ;
+    spqr_free <Int> (n,     sizeof (Int),   QRup->Sp,   cc) ;
+    spqr_free <Int> (n,     sizeof (char),  QRup->Mark, cc) ;
+    spqr_free <Int> (n,     sizeof (Entry), QRup->W,    cc) ;
+    spqr_free <Int> (n,     sizeof (Entry), QRup->Y,    cc) ;
+
+    spqr_free <Int> (1, sizeof (spqr_rupdate <Entry, Int>), QRup, cc) ;
+    *QRup_handle = NULL ;
+}
+
+template void spqr_rupdate_free <double, int32_t>
+(
+    spqr_rupdate <double, int32_t> **QRup_handle,
+    cholmod_common *cc
+) ;
+template void spqr_rupdate_free <Complex, int32_t>
+(
+    spqr_rupdate <Complex, int32_t> **QRup_handle,
+    cholmod_common *cc
+) ;
+template void spqr_rupdate_free <double, int64_t>
+(
+    spqr_rupdate <double, int64_t> **QRup_handle,
+    cholmod_common *cc
+) ;
+template void spqr_rupdate_free <Complex, int64_t>
+(
+    spqr_rupdate <Complex, int64_t> **QRup_handle,
+    cholmod_common *cc
+) ;
+
+// =============================================================================
+// === spqr_rupdate_init =======================================================
+// =============================================================================
+
+#define FREE_WORK \
+{ \
+    spqr_free <Int> (n+1, sizeof (Int),   Rcp, cc) ; \
+    spqr_free <Int> (rnz, sizeof (Int),   Rci, cc) ; \
+    spqr_free <Int> (rnz, sizeof (Entry), Rcx, cc) ; \
+}
+
+template <typename Entry, typename Int> spqr_rupdate <Entry, Int> *
+spqr_rupdate_init
+(
+    // inputs, not modified
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    Int nrhs,               // number of columns of C = Q'*B updated with R
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    spqr_rupdate <Entry, Int> *QRup ;
+    Int *Rcp, *Rci, *R1p, *R1j, *Q1fill, *RmapInv, *Rp, *Rlen, *Rcap, *Rj ;
+    Entry *Rcx, *R1x, *Rx ;
+    Int n, n1rows, n1cols, rank, rnz, rsize, i, j, k, p, pr, row ;
+
+    n = QR->nacols ;
+    n1rows = QR->n1rows ;
+    n1cols = QR->n1cols ;
+    rank = QR->rank ;
+    R1p = QR->R1p ;
+    R1j = QR->R1j ;
+    R1x = QR->R1x ;
+    Q1fill = QR->Q1fill ;
+    RmapInv = QR->RmapInv ;
+    ASSERT ((RmapInv == NULL) == (rank == n)) ;
+
+    // -------------------------------------------------------------------------
+    // get the first rank rows of R in compressed-column form
+    // -------------------------------------------------------------------------
+
+    rnz = 0 ;
+    Rci = NULL ;
+    Rcx = NULL ;
+    Rcp = (Int *) spqr_calloc <Int> (n+1, sizeof (Int), cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        return (NULL) ;
+    }
+
+    // count the entries in the multifrontal R and in the singleton rows R1
+    spqr_rcount (QR->QRsym, QR->QRnum, n1rows, rank, n - n1cols, FALSE,
+        Rcp + n1cols, (Int *) NULL, (Int *) NULL, (Int *) NULL) ;
+    for (k = 0 ; k < n1rows ; k++)
+    {
+        for (p = R1p [k] ; p < R1p [k+1] ; p++)
+        {
+            Rcp [R1j [p]]++ ;
+        }
+    }
+    rnz = spqr_cumsum (n, Rcp) ;
+    Rci = (Int   *) spqr_malloc <Int> (rnz, sizeof (Int),   cc) ;
+    Rcx = (Entry *) spqr_malloc <Int> (rnz, sizeof (Entry), cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        FREE_WORK ;
+        return (NULL) ;
+    }
+
+    // place the singleton rows, then the multifrontal rows
+    for (k = 0 ; k < n1rows ; k++)
+    {
+        for (p = R1p [k] ; p < R1p [k+1] ; p++)
+        {
+            pr = Rcp [R1j [p]]++ ;
+            Rci [pr] = k ;
+            Rcx [pr] = R1x [p] ;
+        }
+    }
+    spqr_rconvert (QR->QRsym, QR->QRnum, n1rows, rank, n - n1cols, FALSE,
+        Rcp + n1cols, Rci, Rcx, (Int *) NULL, (Int *) NULL, (Entry *) NULL,
+        (Int *) NULL, (Int *) NULL, (Entry *) NULL, (Entry *) NULL) ;
+    spqr_shift (n, Rcp) ;
+
+    // -------------------------------------------------------------------------
+    // allocate the QRup object
+    // -------------------------------------------------------------------------
+
+    QRup = (spqr_rupdate <Entry, Int> *)
+        spqr_malloc <Int> (1, sizeof (spqr_rupdate <Entry, Int>), cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory
+        FREE_WORK ;
+        return (NULL) ;
+    }
+
+    // leave room for R to double in size before the pool is compacted
+    int ok = TRUE ;
+    rsize = spqr_add (spqr_add (rnz, rnz, &ok), n, &ok) ;
+
+    QRup->n = n ;
+    QRup->m = QR->narows ;
+    QRup->rsize = ok ? rsize : 0 ;
+    QRup->Rp   = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Rlen = (Int *) spqr_calloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Rcap = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Rrot = (Int *) spqr_calloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Rj   = (Int *) spqr_malloc <Int> (QRup->rsize, sizeof (Int), cc) ;
+    QRup->Rx   = (Entry *) spqr_malloc <Int> (QRup->rsize, sizeof (Entry), cc);
+    QRup->Qinv = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Heap = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Sp   = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+    QRup->Mark = (char *) spqr_calloc <Int> (n, sizeof (char), cc) ;
+    QRup->W    = (Entry *) spqr_calloc <Int> (n, sizeof (Entry), cc) ;
+    QRup->Y    = (Entry *) spqr_calloc <Int> (n, sizeof (Entry), cc) ;
+
+    if (!ok || cc->status < CHOLMOD_OK)
+    {
+        // out of memory or Int overflow
+        spqr_rupdate_free (&QRup, cc) ;
+        FREE_WORK ;
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        return (NULL) ;
+    }
+
+    Rp = QRup->Rp ;
+    Rlen = QRup->Rlen ;
+    Rcap = QRup->Rcap ;
+    Rj = QRup->Rj ;
+    Rx = QRup->Rx ;
+
+    // -------------------------------------------------------------------------
+    // count the entries in each row of the expanded R
+    // -------------------------------------------------------------------------
+
+    // row i of the squeezed R is row RmapInv [i] of the expanded R.  A slot is
+    // reserved for the diagonal of each nonempty row.
+    for (j = 0 ; j < n ; j++)
+    {
+        for (p = Rcp [j] ; p < Rcp [j+1] ; p++)
+        {
+            i = Rci [p] ;
+            row = RmapInv ? RmapInv [i] : i ;
+            ASSERT (row >= 0 && row <= j) ;
+            if (row < j)
+            {
+                if (Rlen [row] == 0) Rlen [row] = 1 ;
+                Rlen [row]++ ;
+            }
+            else if (Rlen [row] == 0)
+            {
+                Rlen [row] = 1 ;
+            }
+        }
+    }
+
+    rnz = 0 ;
+    for (row = 0 ; row < n ; row++)
+    {
+        Rp [row] = rnz ;
+        Rcap [row] = Rlen [row] ;
+        if (Rlen [row] > 0)
+        {
+            // the diagonal may be an exact zero, if it is not in the
+            // factorization
+            Rj [rnz] = row ;
+            Rx [rnz] = 0 ;
+        }
+        rnz += Rlen [row] ;
+        Rlen [row] = MIN (Rlen [row], 1) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // place the entries in each row, diagonal first
+    // -------------------------------------------------------------------------
+
+    for (j = 0 ; j < n ; j++)
+    {
+        for (p = Rcp [j] ; p < Rcp [j+1] ; p++)
+        {
+            i = Rci [p] ;
+            row = RmapInv ? RmapInv [i] : i ;
+            if (row == j)
+            {
+                Rx [Rp [row]] = Rcx [p] ;
+            }
+            else
+            {
+                pr = Rp [row] + Rlen [row]++ ;
+                Rj [pr] = j ;
+                Rx [pr] = Rcx [p] ;
+            }
+        }
+    }
+
+    QRup->rused = rnz ;
+    QRup->rnz = rnz ;
+    QRup->rnz0 = rnz ;
+    QRup->maxrot = 0 ;
+    QRup->nrhs = nrhs ;
+    QRup->rank = 0 ;
+    for (row = 0 ; row < n ; row++)
+    {
+        ASSERT (Rlen [row] == Rcap [row]) ;
+        if (Rlen [row] > 0 && Rx [Rp [row]] != (Entry) 0)
+        {
+            QRup->rank++ ;
+        }
+    }
+
+    for (k = 0 ; k < n ; k++)
+    {
+        QRup->Qinv [Q1fill ? Q1fill [k] : k] = k ;
+        QRup->Sp [k] = EMPTY ;
+    }
+
+    FREE_WORK ;
+    return (QRup) ;
+}
+
+template spqr_rupdate <double, int32_t> *spqr_rupdate_init <double, int32_t>
+(
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    int32_t nrhs,
+    cholmod_common *cc
+) ;
+template spqr_rupdate <Complex, int32_t> *spqr_rupdate_init <Complex, int32_t>
+(
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    int32_t nrhs,
+    cholmod_common *cc
+) ;
+template spqr_rupdate <double, int64_t> *spqr_rupdate_init <double, int64_t>
+(
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    int64_t nrhs,
+    cholmod_common *cc
+) ;
+template spqr_rupdate <Complex, int64_t> *spqr_rupdate_init <Complex, int64_t>
+(
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    int64_t nrhs,
+    cholmod_common *cc
+) ;
+
+// =============================================================================
+// === spqr_rupdate_expand =====================================================
+// =============================================================================
+
+template <typename Entry, typename Int> void spqr_rupdate_expand
+(
+    // input, not modified
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+
+    // input/output
+    Int nrhs,               // number of columns of C
+    Int ldc,                // leading dimension of C
+    Entry *C                // Q'*B on input, rows permuted to match R on
+                            // output.  Ignored if NULL.
+)
+{
+    Int *RmapInv = QR->RmapInv ;
+    Int *Rmap = QR->Rmap ;
+    Int n = QR->nacols ;
+    Int rank = QR->rank ;
+    Int i, j ;
+
+    if (C != NULL && RmapInv != NULL)
+    {
+        for (Int kk = 0 ; kk < nrhs ; kk++)
+        {
+            // RmapInv is increasing and RmapInv [i] >= i, so C can be
+            // expanded in place, from the bottom up
+            for (i = rank-1 ; i >= 0 ; i--)
+            {
+                C [RmapInv [i]] = C [i] ;
+            }
+            for (j = 0 ; j < n ; j++)
+            {
+                if (Rmap [j] >= rank)
+                {
+                    // dead column j has no row in R
+                    C [j] = 0 ;
+                }
+            }
+            C += ldc ;
+        }
+    }
+}
+
+template void spqr_rupdate_expand <double, int32_t>
+(
+    SuiteSparseQR_factorization <double, int32_t> *QR,
+    int32_t nrhs,
+    int32_t ldc,
+    double *C
+) ;
+template void spqr_rupdate_expand <Complex, int32_t>
+(
+    SuiteSparseQR_factorization <Complex, int32_t> *QR,
+    int32_t nrhs,
+    int32_t ldc,
+    Complex *C
+) ;
+template void spqr_rupdate_expand <double, int64_t>
+(
+    SuiteSparseQR_factorization <double, int64_t> *QR,
+    int64_t nrhs,
+    int64_t ldc,
+    double *C
+) ;
+template void spqr_rupdate_expand <Complex, int64_t>
+(
+    SuiteSparseQR_factorization <Complex, int64_t> *QR,
+    int64_t nrhs,
+    int64_t ldc,
+    Complex *C
+) ;
@@ -0,0 +1,197 @@
+// =============================================================================
+// === spqr_rupdate_solve ======================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Solve with the row-oriented R of a factorization to which rows have been
+// appended (see spqr_rupdate_init and SuiteSparseQR_append_rows).  R is n-by-n
+// and upper triangular, and dead rows (with R(j,j) zero) are skipped, giving
+// the basic solution in which the corresponding entries of X are zero.
+//
+// system=SPQR_RX_EQUALS_B    (0): X = R\B         B is n-by-k and X is n-by-k
+// system=SPQR_RETX_EQUALS_B  (1): X = E*(R\B)     as above, E is a permutation
+// system=SPQR_RTX_EQUALS_B   (2): X = R'\B        B is n-by-k and X is m-by-k
+// system=SPQR_RTX_EQUALS_ETB (3): X = R'\(E'*B)   as above, E is a permutation
+//
+// For the first two systems, only the first n rows of B are used.  For the
+// last two, rows n to m-1 of X are zero, where m is the number of rows of A,
+// including all appended rows.
+
+#include "spqr.hpp"
+
+template <typename Entry, typename Int> void spqr_rupdate_solve
+(
+    // inputs, not modified
+    int system,             // SPQR_RX_EQUALS_B, ... SPQR_RTX_EQUALS_ETB
+    spqr_rupdate <Entry, Int> *QRup,
+    Int *Q1fill,            // size n, column permutation E (NULL: identity)
+    Int nrhs,               // number of columns of B
+    Int ldb,                // leading dimension of B
+    Entry *B,               // size n-by-nrhs with leading dimension ldb
+
+    // output, contents undefined on input
+    Entry *X,               // size n-by-nrhs or m-by-nrhs, with leading
+                            // dimension n or m
+    // workspace
+    Entry *W                // size n
+)
+{
+    Entry xj, rjj ;
+    Int *Rp, *Rlen, *Rj ;
+    Entry *Rx ;
+    Int n, m, i, j, p, pend, kk ;
+
+    n = QRup->n ;
+    m = QRup->m ;
+    Rp = QRup->Rp ;
+    Rlen = QRup->Rlen ;
+    Rj = QRup->Rj ;
+    Rx = QRup->Rx ;
+
+    if (system == SPQR_RX_EQUALS_B || system == SPQR_RETX_EQUALS_B)
+    {
+
+        // ---------------------------------------------------------------------
+        // X = E*(R\B) or X = R\B
+        // ---------------------------------------------------------------------
+
+        for (kk = 0 ; kk < nrhs ; kk++)
+        {
+            // backsolve with rows n-1 down to 0 of R
+            for (j = n-1 ; j >= 0 ; j--)
+            {
+                p = Rp [j] ;
+                pend = p + Rlen [j] ;
+                rjj = (p < pend) ? Rx [p] : 0 ;
+                if (rjj == (Entry) 0)
+                {
+                    // dead row
+                    W [j] = 0 ;
+                    continue ;
+                }
+                xj = B [j] ;
+                for (p++ ; p < pend ; p++)
+                {
+                    xj -= Rx [p] * W [Rj [p]] ;
+                }
+                W [j] = spqr_divide (xj, rjj) ;
+            }
+            if (system == SPQR_RETX_EQUALS_B && Q1fill != NULL)
+            {
+                for (j = 0 ; j < n ; j++)
+                {
+                    X [Q1fill [j]] = W [j] ;
+                }
+            }
+            else
+            {
+                for (j = 0 ; j < n ; j++)
+                {
+                    X [j] = W [j] ;
+                }
+            }
+            B += ldb ;
+            X += n ;
+        }
+
+    }
+    else
+    {
+
+        // ---------------------------------------------------------------------
+        // X = R'\(E'*B) or X = R'\B
+        // ---------------------------------------------------------------------
+
+        for (kk = 0 ; kk < nrhs ; kk++)
+        {
+            if (system == SPQR_RTX_EQUALS_ETB && Q1fill != NULL)
+            {
+                for (j = 0 ; j < n ; j++)
+                {
+                    X [j] = B [Q1fill [j]] ;
+                }
+            }
+            else
+            {
+                for (j = 0 ; j < n ; j++)
+                {
+                    X [j] = B [j] ;
+                }
+            }
+            for (i = n ; i < m ; i++)
+            {
+                X [i] = 0 ;
+            }
+            // forward solve with R', one row of R at a time
+            for (j = 0 ; j < n ; j++)
+            {
+                p = Rp [j] ;
+                pend = p + Rlen [j] ;
+                rjj = (p < pend) ? Rx [p] : 0 ;
+                if (rjj == (Entry) 0)
+                {
+                    // dead row
+                    X [j] = 0 ;
+                    continue ;
+                }
+                xj = spqr_divide (X [j], spqr_conj (rjj)) ;
+                X [j] = xj ;
+                for (p++ ; p < pend ; p++)
+                {
+                    X [Rj [p]] -= spqr_conj (Rx [p]) * xj ;
+                }
+            }
+            B += ldb ;
+            X += m ;
+        }
+    }
+}
+
+template void spqr_rupdate_solve <double, int32_t>
+(
+    int system,
+    spqr_rupdate <double, int32_t> *QRup,
+    int32_t *Q1fill,
+    int32_t nrhs,
+    int32_t ldb,
+    double *B,
+    double *X,
+    double *W
+) ;
+template void spqr_rupdate_solve <Complex, int32_t>
+(
+    int system,
+    spqr_rupdate <Complex, int32_t> *QRup,
+    int32_t *Q1fill,
+    int32_t nrhs,
+    int32_t ldb,
+    Complex *B,
+    Complex *X,
+    Complex *W
+) ;
+template void spqr_rupdate_solve <double, int64_t>
+(
+    int system,
+    spqr_rupdate <double, int64_t> *QRup,
+    int64_t *Q1fill,
+    int64_t nrhs,
+    int64_t ldb,
+    double *B,
+    double *X,
+    double *W
+) ;
+template void spqr_rupdate_solve <Complex, int64_t>
+(
+    int system,
+    spqr_rupdate <Complex, int64_t> *QRup,
+    int64_t *Q1fill,
+    int64_t nrhs,
+    int64_t ldb,
+    Complex *B,
+    Complex *X,
+    Complex *W
+) ;
@@ -17,8 +17,180 @@
 //
 // The time taken by this function is O(nnz(A)+m+n).  In practice, it takes
 // slightly more time than computing the transpose, S=A'.
+//
+// If A has sorted columns and is large enough, S is constructed in parallel
+// with cc->SPQR_nthreads OpenMP threads, each of which handles a range of the
+// rows of A (see spqr_ptranspose.cpp).  A row of S is numbered by the leftmost
+// column (in Qfill order) of its row of A, and ties are broken by the order of
+// the rows in that column, which is increasing for sorted columns.  Each
+// thread counts the rows of its own range with each leftmost column, and the
+// counts are combined in order of the thread ranges, so the result is the same
+// as the sequential method.
 
 #include "spqr.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef _OPENMP
+
+// =============================================================================
+// === spqr_pstranspose1 =======================================================
+// =============================================================================
+
+// S = A (P,Qfill)' with nthreads threads.  Work is from spqr_ptranspose_work,
+// with n+1 extra entries per thread.
+
+template <typename Int> static void spqr_pstranspose1
+(
+    cholmod_sparse *A,
+    Int *Qfill,
+    Int *Sp,
+    Int *Sj,
+    Int *PLinv,
+    Int *Sleft,
+    Int *W,
+    int nthreads,
+    Int *Work
+)
+{
+    Int m = A->nrow ;
+    Int n = A->ncol ;
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    Int *Rstart = Work ;
+    Int *Pstart = Work + (nthreads+1) ;
+    Int *Count = Pstart + ((size_t) nthreads) * n ;    // size nthreads*(n+1)
+    int t ;
+
+    // -------------------------------------------------------------------------
+    // find the leftmost column of each row, and count the entries in each row
+    // -------------------------------------------------------------------------
+
+    // PLinv [i] = FLIP (col) if col is the leftmost column of row i of A, and
+    // W [i] = # of entries in row i.  Count [t*(n+1) + col] is the number of
+    // rows of thread t with leftmost column col, and Count [t*(n+1) + n] is
+    // the number of its empty rows.
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int *Pt = Pstart + ((size_t) t) * n ;
+        Int *Pnext = Pt + n ;
+        Int *Ct = Count + ((size_t) t) * (n+1) ;
+        for (Int i = Rstart [t] ; i < Rstart [t+1] ; i++)
+        {
+            PLinv [i] = EMPTY ;
+            W [i] = 0 ;
+        }
+        for (Int col = 0 ; col < n ; col++)
+        {
+            Int j = Qfill ? Qfill [col] : col ;
+            Int pend = (t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+            Ct [col] = 0 ;
+            for (Int p = Pt [j] ; p < pend ; p++)
+            {
+                Int i = Ai [p] ;
+                if (PLinv [i] == EMPTY)
+                {
+                    PLinv [i] = FLIP (col) ;
+                    Ct [col]++ ;
+                }
+                W [i]++ ;
+            }
+        }
+        Ct [n] = 0 ;
+        for (Int i = Rstart [t] ; i < Rstart [t+1] ; i++)
+        {
+            if (PLinv [i] == EMPTY) Ct [n]++ ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Sleft = cumsum of the counts, and the first row of S for each thread
+    // -------------------------------------------------------------------------
+
+    Int k = 0 ;
+    for (Int col = 0 ; col <= n ; col++)
+    {
+        Sleft [col] = k ;
+        for (t = 0 ; t < nthreads ; t++)
+        {
+            Int *Ct = Count + ((size_t) t) * (n+1) ;
+            Int c = Ct [col] ;
+            Ct [col] = k ;
+            k += c ;
+        }
+    }
+    ASSERT (k == m) ;
+    Sleft [n+1] = m ;
+
+    // -------------------------------------------------------------------------
+    // find PLinv, and the row counts of S
+    // -------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int *Pt = Pstart + ((size_t) t) * n ;
+        Int *Pnext = Pt + n ;
+        Int *Ct = Count + ((size_t) t) * (n+1) ;
+        for (Int col = 0 ; col < n ; col++)
+        {
+            Int j = Qfill ? Qfill [col] : col ;
+            Int pend = (t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+            for (Int p = Pt [j] ; p < pend ; p++)
+            {
+                Int i = Ai [p] ;
+                if (PLinv [i] == FLIP (col))
+                {
+                    // row i is the next row of S with leftmost column col
+                    PLinv [i] = Ct [col]++ ;
+                }
+            }
+        }
+        for (Int i = Rstart [t] ; i < Rstart [t+1] ; i++)
+        {
+            if (PLinv [i] == EMPTY)
+            {
+                // empty rows of A are placed last in S, in order
+                PLinv [i] = Ct [n]++ ;
+            }
+            Sp [PLinv [i]] = W [i] ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Sp = cumsum ([0 Sp])
+    // -------------------------------------------------------------------------
+
+    spqr_ptranspose_scan <Int> (m, Sp, nthreads, Count) ;
+
+    // -------------------------------------------------------------------------
+    // create S = A (p,q)', or S=A(p,q) if S is considered to be in row-form
+    // -------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Int *Pt = Pstart + ((size_t) t) * n ;
+        Int *Pnext = Pt + n ;
+        for (Int i = Rstart [t] ; i < Rstart [t+1] ; i++)
+        {
+            W [i] = Sp [PLinv [i]] ;
+        }
+        for (Int col = 0 ; col < n ; col++)
+        {
+            Int j = Qfill ? Qfill [col] : col ;
+            Int pend = (t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+            for (Int p = Pt [j] ; p < pend ; p++)
+            {
+                Sj [W [Ai [p]]++] = col ;
+            }
+        }
+    }
+}
+#endif
 
 template <typename Int> void spqr_stranspose1
 (
@@ -42,11 +214,30 @@ template <typename Int> void spqr_stranspose1
                         // Sleft [n+1]-1 gives the empty rows of S.
 
     // workspace, not defined on input or output
-    Int *W              // size m
+    Int *W,             // size m
+
+    cholmod_common *cc
 )
 {
     Int i, j, p, pend, t, k, row, col, kstart, s, m, n, *Ap, *Ai ;
 
+    // -------------------------------------------------------------------------
+    // use the parallel method, if possible
+    // -------------------------------------------------------------------------
+
+#ifdef _OPENMP
+    int nthreads ;
+    size_t wsize ;
+    Int *Work = spqr_ptranspose_work <Int> (A, (Int) (A->ncol + 1),
+        &nthreads, &wsize, cc) ;
+    if (Work != NULL)
+    {
+        spqr_pstranspose1 (A, Qfill, Sp, Sj, PLinv, Sleft, W, nthreads, Work) ;
+        spqr_free <Int> (wsize, sizeof (Int), Work, cc) ;
+        return ;
+    }
+#endif
+
     // -------------------------------------------------------------------------
     // get inputs
     // -------------------------------------------------------------------------
@@ -186,7 +377,9 @@ template void spqr_stranspose1 <int32_t>
                         // Sleft [n+1]-1 gives the empty rows of S.
 
     // workspace, not defined on input or output
-    int32_t *W              // size m
+    int32_t *W,             // size m
+
+    cholmod_common *cc
 ) ;
 
 template void spqr_stranspose1 <int64_t>
@@ -211,5 +404,7 @@ template void spqr_stranspose1 <int64_t>
                         // Sleft [n+1]-1 gives the empty rows of S.
 
     // workspace, not defined on input or output
-    int64_t *W              // size m
+    int64_t *W,             // size m
+
+    cholmod_common *cc
 ) ;
@@ -7,9 +7,15 @@
 
 //------------------------------------------------------------------------------
 
-// Construct the numerical values of S = A (p,q) in compressed-row form
+// Construct the numerical values of S = A (p,q) in compressed-row form.  If A
+// has sorted columns and is large enough, this is done in parallel with
+// cc->SPQR_nthreads OpenMP threads, each of which fills the rows of S for its
+// own range of the rows of A (see spqr_ptranspose.cpp).
 
 #include "spqr.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 template <typename Entry, typename Int> void spqr_stranspose2
 (
@@ -27,7 +33,9 @@ template <typename Entry, typename Int> void spqr_stranspose2
     Entry *Sx,          // size nz, numerical values of S
 
     // workspace, not defined on input or output
-    Int *W             // size m
+    Int *W,            // size m
+
+    cholmod_common *cc
 )
 {
     Int i, j, p, pend, row, col, s, m, n, *Ap, *Ai ;
@@ -43,6 +51,43 @@ template <typename Entry, typename Int> void spqr_stranspose2
     Ai = (Int *) A->i ;
     Ax = (Entry *) A->x ;
 
+    // -------------------------------------------------------------------------
+    // use the parallel method, if possible
+    // -------------------------------------------------------------------------
+
+#ifdef _OPENMP
+    int nthreads ;
+    size_t wsize ;
+    Int *Work = spqr_ptranspose_work <Int> (A, 0, &nthreads, &wsize, cc) ;
+    if (Work != NULL)
+    {
+        Int *Rstart = Work ;
+        Int *Pstart = Work + (nthreads+1) ;
+        int t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (t = 0 ; t < nthreads ; t++)
+        {
+            Int *Pt = Pstart + ((size_t) t) * n ;
+            Int *Pnext = Pt + n ;
+            for (Int i = Rstart [t] ; i < Rstart [t+1] ; i++)
+            {
+                W [i] = Sp [PLinv [i]] ;
+            }
+            for (Int col = 0 ; col < n ; col++)
+            {
+                Int j = Qfill ? Qfill [col] : col ;
+                Int pend = (t == nthreads-1) ? Ap [j+1] : Pnext [j] ;
+                for (Int p = Pt [j] ; p < pend ; p++)
+                {
+                    Sx [W [Ai [p]]++] = Ax [p] ;
+                }
+            }
+        }
+        spqr_free <Int> (wsize, sizeof (Int), Work, cc) ;
+        return ;
+    }
+#endif
+
     // -------------------------------------------------------------------------
     // create S = A (p,q)', or S=A(p,q) if S is considered to be in row-form
     // -------------------------------------------------------------------------
@@ -82,7 +127,9 @@ template void spqr_stranspose2 <double, int32_t>
     double *Sx,          // size nz, numerical values of S
 
     // workspace, not defined on input or output
-    int32_t *W             // size m
+    int32_t *W,             // size m
+
+    cholmod_common *cc
 ) ;
 template void spqr_stranspose2 <Complex, int32_t>
 (
@@ -100,7 +147,9 @@ template void spqr_stranspose2 <Complex, int32_t>
     Complex *Sx,          // size nz, numerical values of S
 
     // workspace, not defined on input or output
-    int32_t *W             // size m
+    int32_t *W,             // size m
+
+    cholmod_common *cc
 ) ;
 
 template void spqr_stranspose2 <double, int64_t>
@@ -119,7 +168,9 @@ template void spqr_stranspose2 <double, int64_t>
     double *Sx,          // size nz, numerical values of S
 
     // workspace, not defined on input or output
-    int64_t *W             // size m
+    int64_t *W,             // size m
+
+    cholmod_common *cc
 ) ;
 template void spqr_stranspose2 <Complex, int64_t>
 (
@@ -137,5 +188,7 @@ template void spqr_stranspose2 <Complex, int64_t>
     Complex *Sx,          // size nz, numerical values of S
 
     // workspace, not defined on input or output
-    int64_t *W             // size m
+    int64_t *W,             // size m
+
+    cholmod_common *cc
 ) ;
@@ -243,6 +243,12 @@ int main (int argc, char **argv)
         fclose (file) ;
     }
 
+    // -------------------------------------------------------------------------
+    // test the parallel transposes on a large matrix
+    // -------------------------------------------------------------------------
+
+    nfail += test_ptranspose <Int> (cc) ;
+
     // -------------------------------------------------------------------------
     // report the results
     // -------------------------------------------------------------------------
@@ -1098,6 +1098,96 @@ template <typename Entry, typename Int> double dense_resid
     return (CHECK_NAN (resid / anorm)) ;
 }
 
+// =============================================================================
+// === scaled_xdiff ============================================================
+// =============================================================================
+
+// compute norm (X2 - (s*X1 + e), inf) / max (norm (X1, inf), 1), where X1 and
+// X2 are n-by-nb, and e is zero except for an entry of one in each column of
+// row ej (if ej >= 0)
+
+template <typename Entry, typename Int> double scaled_xdiff
+(
+    cholmod_dense *X1dense,
+    cholmod_dense *X2dense,
+    double s,
+    Int ej
+)
+{
+    if (X1dense == NULL || X2dense == NULL) return (0) ;
+    Int n = X1dense->nrow ;
+    Int nb = X1dense->ncol ;
+    Entry *X1 = (Entry *) X1dense->x ;
+    Entry *X2 = (Entry *) X2dense->x ;
+    double xnorm = 1, xdiff = 0 ;
+    for (Int k = 0 ; k < n*nb ; k++)
+    {
+        Entry e = (k % n == ej) ? 1 : 0 ;
+        xnorm = MAX (xnorm, spqr_abs (X1 [k])) ;
+        xdiff = MAX (xdiff, spqr_abs (X2 [k] - (s * X1 [k] + e))) ;
+    }
+    return (CHECK_NAN (xdiff / xnorm)) ;
+}
+
+// =============================================================================
+// === append_rows_out_of_memory ===============================================
+// =============================================================================
+
+// Call SuiteSparseQR_append_rows, with each malloc failing in turn until it
+// succeeds.  Each time it runs out of memory, QR and C must be unchanged.
+// Returns the result of the call that succeeds, or EMPTY if QR or C changed.
+
+template <typename Entry, typename Int> int append_rows_out_of_memory
+(
+    cholmod_sparse *Anew,
+    cholmod_dense *Bnew,
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_dense *C,
+    cholmod_common *cc
+)
+{
+    spqr_rupdate <Entry, Int> *QRup = QR->QRup ;
+    Int rnz = (QRup != NULL) ? QRup->rnz : 0 ;
+    Int m = (QRup != NULL) ? QRup->m : 0 ;
+    size_t csize = C->d * C->ncol * sizeof (Entry) ;
+    cholmod_dense *X1 = SuiteSparseQR_solve <Entry,Int>
+        (SPQR_RETX_EQUALS_B, QR, C, cc) ;
+    Entry *Csave = (Entry *) spqr_malloc <Int> (csize, 1, cc) ;
+    if (X1 == NULL || Csave == NULL)
+    {
+        spqr_free_dense <Int> (&X1, cc) ;
+        spqr_free <Int> (csize, 1, Csave, cc) ;
+        return (EMPTY) ;
+    }
+    memcpy (Csave, C->x, csize) ;
+
+    int ok = EMPTY, changed = FALSE ;
+    test_memory_handler (cc, false) ;
+    for (int64_t tries = 0 ; ok == EMPTY && !changed ; tries++)
+    {
+        my_tries = tries ;
+        ok = SuiteSparseQR_append_rows <Entry,Int> (Anew, Bnew, 0, 0, QR, C,
+            cc) ;
+        my_tries = -2 ;
+        if (ok == EMPTY)
+        {
+            changed = (cc->status != CHOLMOD_OUT_OF_MEMORY) ||
+                (QR->QRup != QRup) || (memcmp (Csave, C->x, csize) != 0) ||
+                (QRup != NULL && (QRup->rnz != rnz || QRup->m != m)) ;
+            cholmod_dense *X2 = SuiteSparseQR_solve <Entry,Int>
+                (SPQR_RETX_EQUALS_B, QR, C, cc) ;
+            changed = changed || (scaled_xdiff <Entry,Int> (X1, X2, 1, -1)
+                != 0) ;
+            spqr_free_dense <Int> (&X2, cc) ;
+        }
+    }
+    normal_memory_handler (cc, false) ;
+
+    spqr_free_dense <Int> (&X1, cc) ;
+    spqr_free <Int> (csize, 1, Csave, cc) ;
+    return (changed ? EMPTY : ok) ;
+}
+
 // =============================================================================
 // === check_r_factor ==========================================================
 // =============================================================================
@@ -1548,6 +1638,98 @@ template <typename Entry, typename Int> double check_qmult
 }
 
 
+// =============================================================================
+// === check_qmult_blocks ======================================================
+// =============================================================================
+
+// SuiteSparseQR_qmult splits the columns of X (for Q'*X and Q*X) or its rows
+// (for X*Q' and X*Q) into blocks of at most 128.  Apply Q to an X with 300
+// columns (or rows), and compare the result with Q applied to each column (or
+// row) of X on its own.  The result must be identical with 1 and 4 threads.
+
+template <typename Entry, typename Int> double check_qmult_blocks
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_common *cc
+)
+{
+    int xtype = spqr_type <Entry> ( ) ;
+    Entry range = (Entry) 1.0 ;
+    double err = 0 ;
+    Int m = QR->narows, nx = 300, i, k ;
+    int save_nthreads = cc->SPQR_nthreads ;
+
+    for (int method = 0 ; method <= 3 ; method++)
+    {
+        // X is m-by-nx for Q'*X and Q*X, or nx-by-m for X*Q' and X*Q
+        int cols = (method <= SPQR_QX) ;
+        Int xrow = cols ? m : nx ;
+        Int xcol = cols ? nx : m ;
+        cholmod_dense *Xdense = spqr_zeros <Int> (xrow, xcol, xtype, cc) ;
+        cholmod_dense *X1dense = cols ? spqr_zeros <Int> (m, 1, xtype, cc) :
+            spqr_zeros <Int> (1, m, xtype, cc) ;
+        Entry *X = (Entry *) Xdense->x ;
+        Entry *X1 = (Entry *) X1dense->x ;
+        for (k = 0 ; k < xrow*xcol ; k++)
+        {
+            X [k] = erand (range) ;
+        }
+
+        // Y = Q'*X, Q*X, X*Q', or X*Q, with 1 and 4 threads
+        cholmod_dense *Ydense [2] ;
+        for (int t = 0 ; t < 2 ; t++)
+        {
+            cc->SPQR_nthreads = (t == 0) ? 1 : 4 ;
+            Ydense [t] = SuiteSparseQR_qmult <Entry,Int> (method, QR, Xdense,
+                cc) ;
+        }
+        cc->SPQR_nthreads = save_nthreads ;
+
+        if (Ydense [0] == NULL || Ydense [1] == NULL)
+        {
+            err = 1 ;
+        }
+        else
+        {
+            Entry *Y = (Entry *) Ydense [0]->x ;
+            Int ldy = Ydense [0]->d ;
+            err += (memcmp (Y, Ydense [1]->x, ldy * xcol * sizeof (Entry))
+                != 0) ;
+
+            // apply Q to each column (or row) of X on its own
+            for (k = 0 ; k < nx ; k++)
+            {
+                for (i = 0 ; i < m ; i++)
+                {
+                    X1 [i] = cols ? X [i + k*m] : X [k + i*nx] ;
+                }
+                cholmod_dense *Zdense = SuiteSparseQR_qmult <Entry,Int>
+                    (method, QR, X1dense, cc) ;
+                if (Zdense == NULL)
+                {
+                    err = 1 ;
+                    break ;
+                }
+                Entry *Z = (Entry *) Zdense->x ;
+                for (i = 0 ; i < m ; i++)
+                {
+                    Entry y = cols ? Y [i + k*ldy] : Y [k + i*ldy] ;
+                    double e1 = spqr_abs (y - Z [i]) ;
+                    e1 = CHECK_NAN (e1) ;
+                    err = MAX (err, e1) ;
+                }
+                spqr_free_dense <Int> (&Zdense, cc) ;
+            }
+        }
+        spqr_free_dense <Int> (&Ydense [0], cc) ;
+        spqr_free_dense <Int> (&Ydense [1], cc) ;
+        spqr_free_dense <Int> (&X1dense, cc) ;
+        spqr_free_dense <Int> (&Xdense, cc) ;
+    }
+    return (err) ;
+}
+
+
 // =============================================================================
 // === check_rc ================================================================
 // =============================================================================
@@ -2344,6 +2526,441 @@ template <typename Entry, typename Int> void qrtest
                     maxerr = MAX (maxerr, err) ;
                     printf (" ... error handling done\n\n") ;
                 }
+                spqr_free_dense <Int> (&Bdense, cc) ;
+
+                // -------------------------------------------------------------
+                // qmult with more than one block of columns (or rows) of X
+                // -------------------------------------------------------------
+
+                if (!split && ordering == 0 && tol == SPQR_DEFAULT_TOL)
+                {
+                    err = check_qmult_blocks <Entry,Int> (QR, cc) ;
+                    printf ("order %d : qmult blocks      Err25: %g\n",
+                        ordering, err) ;
+                    maxerr = MAX (maxerr, err) ;
+                }
+
+                // -------------------------------------------------------------
+                // serialize QR, and apply Q' with a copy and a view of the blob
+                // -------------------------------------------------------------
+
+                int64_t blobsize = SuiteSparseQR_serialize_size (QR, cc) ;
+                int8_t *blob = (blobsize < 0) ? NULL : (int8_t *)
+                    spqr_malloc <Int> (blobsize, sizeof (int8_t), cc) ;
+                if (QR != NULL && blob != NULL &&
+                    SuiteSparseQR_serialize (blob, blobsize, QR, cc))
+                {
+                    nb = 2 ;
+                    Bdense = spqr_zeros <Int> (m, nb, xtype, cc) ;
+                    B = (Entry *) Bdense->x ;
+                    for (k = 0 ; k < m*nb ; k++)
+                    {
+                        B [k] = erand (range) ;
+                    }
+                    cholmod_dense *C1dense = SuiteSparseQR_qmult <Entry,Int>
+                        (SPQR_QTX, QR, Bdense, cc) ;
+                    cholmod_dense *X1dense = SuiteSparseQR_solve <Entry,Int>
+                        (SPQR_RETX_EQUALS_B, QR, C1dense, cc) ;
+                    for (int view = 0 ; view <= 1 ; view++)
+                    {
+                        SuiteSparseQR_factorization <Entry,Int> *QR2 ;
+                        QR2 = SuiteSparseQR_deserialize <Entry,Int> (blob,
+                            blobsize, view, cc) ;
+                        cholmod_dense *C2dense = SuiteSparseQR_qmult
+                            <Entry,Int> (SPQR_QTX, QR2, Bdense, cc) ;
+                        cholmod_dense *X2dense = SuiteSparseQR_solve
+                            <Entry,Int> (SPQR_RETX_EQUALS_B, QR2, C2dense, cc) ;
+                        if (C1dense != NULL && C2dense != NULL &&
+                            X1dense != NULL && X2dense != NULL)
+                        {
+                            // both must match the original QR exactly
+                            Entry *C1 = (Entry *) C1dense->x ;
+                            Entry *C2 = (Entry *) C2dense->x ;
+                            Entry *X1 = (Entry *) X1dense->x ;
+                            Entry *X2 = (Entry *) X2dense->x ;
+                            double cdiff = 0 ;
+                            for (k = 0 ; k < m*nb ; k++)
+                            {
+                                cdiff = MAX (cdiff, spqr_abs (C1 [k] - C2 [k]));
+                            }
+                            for (k = 0 ; k < n*nb ; k++)
+                            {
+                                cdiff = MAX (cdiff, spqr_abs (X1 [k] - X2 [k]));
+                            }
+                            maxerr = MAX (maxerr, cdiff) ;
+                            printf ("Serialize %d %d : %g\n", ordering, view,
+                                cdiff) ;
+                        }
+                        spqr_free_dense <Int> (&X2dense, cc) ;
+                        spqr_free_dense <Int> (&C2dense, cc) ;
+                        SuiteSparseQR_free (&QR2, cc) ;
+                    }
+                    spqr_free_dense <Int> (&X1dense, cc) ;
+                    spqr_free_dense <Int> (&C1dense, cc) ;
+                    spqr_free_dense <Int> (&Bdense, cc) ;
+
+                    // truncated blob
+                    printf ("Error testing ... expect 1 error message:\n") ;
+                    err = (SuiteSparseQR_deserialize <Entry,Int> (blob,
+                        blobsize-1, FALSE, cc) != NULL) ;
+                    printf ("order %d : error handling    Err18: %g\n",
+                        ordering, err) ;
+                    maxerr = MAX (maxerr, err) ;
+                }
+                spqr_free <Int> (blobsize, sizeof (int8_t), blob, cc) ;
+
+                // -------------------------------------------------------------
+                // refactorize a view of a serialized QR, with A(:,0) zero
+                // -------------------------------------------------------------
+
+                // SuiteSparseQR_numeric allocates Rmap and RmapInv for the
+                // view when A(:,0) is dropped; they must be freed with the
+                // view, and the blob itself must not change.
+                SuiteSparseQR_factorization <Entry,Int> *QR3 =
+                    SuiteSparseQR_symbolic <Entry,Int> (ordering, TRUE, A, cc) ;
+                if (QR3 != NULL && A->packed &&
+                    SuiteSparseQR_numeric <Entry,Int> (tol, A, QR3, cc))
+                {
+                    blobsize = SuiteSparseQR_serialize_size (QR3, cc) ;
+                    blob = (int8_t *) spqr_malloc <Int> (2*blobsize,
+                        sizeof (int8_t), cc) ;
+                    SuiteSparseQR_factorization <Entry,Int> *QR4 = NULL ;
+                    if (blob != NULL &&
+                        SuiteSparseQR_serialize (blob, blobsize, QR3, cc))
+                    {
+                        memcpy (blob + blobsize, blob, blobsize) ;
+                        QR4 = SuiteSparseQR_deserialize <Entry,Int> (blob,
+                            blobsize, TRUE, cc) ;
+                    }
+                    Int p0 = Ap [0], p1 = (n > 0) ? Ap [1] : p0 ;
+                    Entry *A0 = (Entry *) spqr_malloc <Int> (p1 - p0 + 1,
+                        sizeof (Entry), cc) ;
+                    if (QR4 != NULL && A0 != NULL)
+                    {
+                        for (Int p = p0 ; p < p1 ; p++)
+                        {
+                            A0 [p-p0] = Ax [p] ;
+                            Ax [p] = 0 ;
+                        }
+                        int ok = SuiteSparseQR_numeric <Entry,Int> (tol, A,
+                            QR4, cc) ;
+                        for (Int p = p0 ; p < p1 ; p++)
+                        {
+                            Ax [p] = A0 [p-p0] ;
+                        }
+                        // a zero column is dropped if rank detection is on
+                        err = (ok && (tol >= 0 || tol <= SPQR_DEFAULT_TOL) &&
+                            p1 > p0 && QR3->rank == n && QR4->rank == n) ;
+                        err += (memcmp (blob, blob + blobsize, blobsize) != 0) ;
+                        // refactorize again with the original A
+                        err += !SuiteSparseQR_numeric <Entry,Int> (tol, A,
+                            QR4, cc) ;
+                        err += (QR4->rank != QR3->rank) ;
+                        printf ("order %d : refactorize view  Err22: %g\n",
+                            ordering, err) ;
+                        maxerr = MAX (maxerr, err) ;
+                    }
+                    spqr_free <Int> (p1 - p0 + 1, sizeof (Entry), A0, cc) ;
+                    SuiteSparseQR_free (&QR4, cc) ;
+                    spqr_free <Int> (2*blobsize, sizeof (int8_t), blob, cc) ;
+                }
+                SuiteSparseQR_free (&QR3, cc) ;
+
+                // -------------------------------------------------------------
+                // Q-less QR, and x=A\b with the corrected semi-normal equations
+                // -------------------------------------------------------------
+
+                // The CSNE solution must match x=E*(R\(Q'*b)) from a QR that
+                // keeps H, both for A and (as the basic solution, with x(0)=0)
+                // for A with A(:,0) set to zero.
+                for (int deficient = 0 ; deficient <= 1 ; deficient++)
+                {
+                    Int a0 = (n > 0) ? (Ap [1] - Ap [0]) : 0 ;
+                    if (QR == NULL || m < n || QR->rank != n || !A->packed ||
+                        (deficient && a0 == 0))
+                    {
+                        break ;
+                    }
+                    Entry *A0 = (Entry *) spqr_malloc <Int> (a0+1,
+                        sizeof (Entry), cc) ;
+                    if (A0 == NULL)
+                    {
+                        break ;
+                    }
+                    for (k = 0 ; deficient && k < a0 ; k++)
+                    {
+                        A0 [k] = Ax [Ap [0] + k] ;
+                        Ax [Ap [0] + k] = 0 ;
+                    }
+                    nb = 2 ;
+                    Bdense = spqr_zeros <Int> (m, nb, xtype, cc) ;
+                    B = (Entry *) Bdense->x ;
+                    for (k = 0 ; k < m*nb ; k++)
+                    {
+                        B [k] = erand (range) ;
+                    }
+                    SuiteSparseQR_factorization <Entry,Int> *QR1, *QR2 ;
+                    QR1 = SuiteSparseQR_factorize <Entry,Int> (ordering, tol, A,
+                        cc) ;
+                    QR2 = SuiteSparseQR_qless_factorize <Entry,Int> (ordering,
+                        tol, A, cc) ;
+                    cholmod_dense *Cdense = NULL, *X1dense = NULL,
+                        *X2dense = NULL ;
+                    if (QR1 != NULL && QR2 != NULL && QR1->rank == n-deficient
+                        && QR2->rank == n-deficient)
+                    {
+                        Cdense = SuiteSparseQR_qmult <Entry,Int> (SPQR_QTX, QR1,
+                            Bdense, cc) ;
+                        X1dense = SuiteSparseQR_solve <Entry,Int>
+                            (SPQR_RETX_EQUALS_B, QR1, Cdense, cc) ;
+                        X2dense = SuiteSparseQR_csne <Entry,Int> (QR2, A,
+                            Bdense, cc) ;
+                    }
+                    if (X1dense != NULL && X2dense != NULL)
+                    {
+                        Entry *X1 = (Entry *) X1dense->x ;
+                        Entry *X2 = (Entry *) X2dense->x ;
+                        double xdiff = 0, xnorm = 0 ;
+                        for (k = 0 ; k < n*nb ; k++)
+                        {
+                            xdiff = MAX (xdiff, spqr_abs (X1 [k] - X2 [k])) ;
+                            xnorm = MAX (xnorm, spqr_abs (X1 [k])) ;
+                        }
+                        xdiff = (xnorm == 0) ? xdiff : (xdiff / xnorm) ;
+                        err = (xdiff > 1e-8) ;
+                        for (k = 0 ; deficient && k < nb ; k++)
+                        {
+                            err += (spqr_abs (X2 [k*n]) != 0) ;
+                        }
+                        printf ("CSNE %d %d : %g\n", ordering, deficient, xdiff) ;
+                        printf ("order %d : csne              Err23: %g\n",
+                            ordering, err) ;
+                        maxerr = MAX (maxerr, err) ;
+                    }
+                    if (QR2 != NULL && !deficient)
+                    {
+                        printf ("Error testing ... expect 1 error message:\n") ;
+                        cholmod_dense *Ydense = SuiteSparseQR_qmult
+                            <Entry,Int> (SPQR_QTX, QR2, Bdense, cc) ;
+                        err = (Ydense != NULL) ;
+                        printf ("order %d : error handling    Err19: %g\n",
+                            ordering, err) ;
+                        maxerr = MAX (maxerr, err) ;
+                        spqr_free_dense <Int> (&Ydense, cc) ;
+                    }
+                    for (k = 0 ; deficient && k < a0 ; k++)
+                    {
+                        Ax [Ap [0] + k] = A0 [k] ;
+                    }
+                    spqr_free <Int> (a0+1, sizeof (Entry), A0, cc) ;
+                    SuiteSparseQR_free (&QR1, cc) ;
+                    SuiteSparseQR_free (&QR2, cc) ;
+                    spqr_free_dense <Int> (&X1dense, cc) ;
+                    spqr_free_dense <Int> (&X2dense, cc) ;
+                    spqr_free_dense <Int> (&Cdense, cc) ;
+                    spqr_free_dense <Int> (&Bdense, cc) ;
+                }
+
+                // -------------------------------------------------------------
+                // factorize A twice, reusing the symbolic analysis
+                // -------------------------------------------------------------
+
+                {
+                    SuiteSparseQR_factorization <Entry,Int> *QR2 = NULL ;
+                    int r1 = SuiteSparseQR_factorize_cached <Entry,Int>
+                        (ordering, tol, A, &QR2, cc) ;
+                    int r2 = SuiteSparseQR_factorize_cached <Entry,Int>
+                        (ordering, tol, A, &QR2, cc) ;
+                    if (r1 != 0 && r2 != 0)
+                    {
+                        err = (r1 != 1 || r2 != 2) ;
+                        printf ("order %d : cached analysis   Err20: %g\n",
+                            ordering, err) ;
+                        maxerr = MAX (maxerr, err) ;
+                    }
+
+                    // drop the last entry of A: the pattern has changed, so
+                    // A2 must be analyzed again, and then A once more
+                    cholmod_sparse *A2 = (Ap [n] > 0) ?
+                        spqr_copy <Int> (A, 0, 1, cc) : NULL ;
+                    if (A2 != NULL && A2->packed)
+                    {
+                        Int *A2p = (Int *) A2->p ;
+                        Int anz = A2p [n] ;
+                        for (k = 1 ; k <= n ; k++)
+                        {
+                            if (A2p [k] == anz) A2p [k] = anz-1 ;
+                        }
+                        int r3 = SuiteSparseQR_factorize_cached <Entry,Int>
+                            (ordering, tol, A2, &QR2, cc) ;
+                        int r4 = SuiteSparseQR_factorize_cached <Entry,Int>
+                            (ordering, tol, A, &QR2, cc) ;
+                        err = (r3 != 1 || r4 != 1) ;
+                        printf ("order %d : changed pattern   Err24: %g\n",
+                            ordering, err) ;
+                        maxerr = MAX (maxerr, err) ;
+                    }
+                    spqr_free_sparse <Int> (&A2, cc) ;
+                    SuiteSparseQR_free (&QR2, cc) ;
+                }
+
+                // -------------------------------------------------------------
+                // append the rows of A again: x=[A;A]\[b;b] is the same as x=A\b
+                // -------------------------------------------------------------
+
+                if (QR != NULL && m >= n && QR->rank == n)
+                {
+                    cholmod_dense *X1dense, *X2dense, *X3dense, *X4dense ;
+                    nb = 2 ;
+                    Bdense = spqr_zeros <Int> (m, nb, xtype, cc) ;
+                    B = (Entry *) Bdense->x ;
+                    for (k = 0 ; k < m*nb ; k++)
+                    {
+                        B [k] = erand (range) ;
+                    }
+                    Cdense = SuiteSparseQR_qmult <Entry,Int> (SPQR_QTX, QR,
+                        Bdense, cc) ;
+                    X1dense = SuiteSparseQR_solve <Entry,Int>
+                        (SPQR_RETX_EQUALS_B, QR, Cdense, cc) ;
+                    int ok = SuiteSparseQR_append_rows <Entry,Int> (A, Bdense,
+                        0, 0, QR, Cdense, cc) ;
+                    X2dense = SuiteSparseQR_solve <Entry,Int>
+                        (SPQR_RETX_EQUALS_B, QR, Cdense, cc) ;
+                    err = (ok < 0) ;
+                    resid = scaled_xdiff <Entry,Int> (X1dense, X2dense, 1, -1) ;
+                    maxresid [m<n][wh] = MAX (maxresid [m<n][wh], resid) ;
+                    printf ("Append %d : %g\n", ordering, resid) ;
+
+                    // append A again without B, whose new rows are then zero:
+                    // x=[A;A;A]\[b;b;0] is 2/3 of x=A\b.  C must still be
+                    // updated, since the rotations mix its rows.  QR and C
+                    // are unchanged each time the method runs out of memory.
+                    ok = append_rows_out_of_memory <Entry,Int> (A, NULL, QR,
+                        Cdense, cc) ;
+                    err += (ok < 0) ;
+                    X3dense = SuiteSparseQR_solve <Entry,Int>
+                        (SPQR_RETX_EQUALS_B, QR, Cdense, cc) ;
+                    resid = scaled_xdiff <Entry,Int> (X1dense, X3dense, 2./3,
+                        -1) ;
+                    maxresid [m<n][wh] = MAX (maxresid [m<n][wh], resid) ;
+                    printf ("Append without B %d : %g\n", ordering, resid) ;
+                    spqr_free_dense <Int> (&X3dense, cc) ;
+
+                    // exceed the fill-in budget, and then the rotation budget.
+                    // The rows are still appended, so the solution of
+                    // x=[A;A;A;A;A]\[b;b;0;0;0] is 2/5 of x=A\b.  An A with
+                    // no entries never exceeds either budget.
+                    ok = SuiteSparseQR_append_rows <Entry,Int> (A, NULL, 1e-9,
+                        1e30, QR, Cdense, cc) ;
+                    err += (ok != (Ap [n] == 0)) ;
+                    ok = SuiteSparseQR_append_rows <Entry,Int> (A, NULL, 1e30,
+                        0.5, QR, Cdense, cc) ;
+                    err += (ok != (Ap [n] == 0)) ;
+                    X3dense = SuiteSparseQR_solve <Entry,Int>
+                        (SPQR_RETX_EQUALS_B, QR, Cdense, cc) ;
+                    resid = scaled_xdiff <Entry,Int> (X1dense, X3dense, 2./5,
+                        -1) ;
+                    maxresid [m<n][wh] = MAX (maxresid [m<n][wh], resid) ;
+                    printf ("Append over budget %d : %g\n", ordering, resid) ;
+
+                    // append a dense row e' with b = e'*x, where x is the
+                    // current solution, which then does not change.  R fills
+                    // in and is moved to a larger pool, and QR and C are
+                    // unchanged each time the method runs out of memory.
+                    cholmod_dense *E1dense = spqr_ones <Int> (1, n, xtype, cc) ;
+                    cholmod_sparse *E1 = spqr_dense_to_sparse <Int> (E1dense,
+                        TRUE, cc) ;
+                    cholmod_dense *B1 = spqr_zeros <Int> (1, nb, xtype, cc) ;
+                    Entry *X3 = (Entry *) X3dense->x ;
+                    Entry *B1x = (Entry *) B1->x ;
+                    for (k = 0 ; k < n*nb ; k++)
+                    {
+                        B1x [k / n] += X3 [k] ;
+                    }
+                    ok = append_rows_out_of_memory <Entry,Int> (E1, B1, QR,
+                        Cdense, cc) ;
+                    err += (ok < 0) ;
+                    X4dense = SuiteSparseQR_solve <Entry,Int>
+                        (SPQR_RETX_EQUALS_B, QR, Cdense, cc) ;
+                    resid = scaled_xdiff <Entry,Int> (X3dense, X4dense, 1,
+                        -1) ;
+                    maxresid [m<n][wh] = MAX (maxresid [m<n][wh], resid) ;
+                    printf ("Append dense row %d : %g\n", ordering, resid) ;
+                    spqr_free_dense <Int> (&X4dense, cc) ;
+                    spqr_free_dense <Int> (&E1dense, cc) ;
+                    spqr_free_sparse <Int> (&E1, cc) ;
+                    spqr_free_dense <Int> (&B1, cc) ;
+                    spqr_free_dense <Int> (&X3dense, cc) ;
+
+                    // Q is no longer available, and C must be updated in all
+                    // calls once it has been updated
+                    printf ("Error testing ... expect 2 error messages:\n") ;
+                    err += (SuiteSparseQR_qmult <Entry,Int> (SPQR_QTX, QR,
+                        Bdense, cc) != NULL) ;
+                    err += (SuiteSparseQR_append_rows <Entry,Int> (A, NULL, 0,
+                        0, QR, NULL, cc) != EMPTY) ;
+                    printf ("order %d : error handling    Err17: %g\n",
+                        ordering, err) ;
+                    maxerr = MAX (maxerr, err) ;
+                    spqr_free_dense <Int> (&X1dense, cc) ;
+                    spqr_free_dense <Int> (&X2dense, cc) ;
+                    spqr_free_dense <Int> (&Cdense, cc) ;
+
+                    // rank-deficient append: with A(:,0) set to zero, the row
+                    // of R for column 0 is dead and x(0) = 0.  Appending the
+                    // row e_0' with b = 1 brings it to life, so x(0) becomes 1
+                    // and the rest of x is unchanged.
+                    Int a0 = Ap [1] - Ap [0] ;
+                    Entry *A0 = (Entry *) spqr_malloc <Int> (a0, sizeof (Entry),
+                        cc) ;
+                    SuiteSparseQR_factorization <Entry,Int> *QR1 = NULL ;
+                    if (A0 != NULL && a0 > 0)
+                    {
+                        for (k = 0 ; k < a0 ; k++)
+                        {
+                            A0 [k] = Ax [Ap [0] + k] ;
+                            Ax [Ap [0] + k] = 0 ;
+                        }
+                        QR1 = SuiteSparseQR_factorize <Entry,Int> (ordering,
+                            tol, A, cc) ;
+                        for (k = 0 ; k < a0 ; k++)
+                        {
+                            Ax [Ap [0] + k] = A0 [k] ;
+                        }
+                    }
+                    spqr_free <Int> (a0, sizeof (Entry), A0, cc) ;
+                    if (QR1 != NULL && QR1->rank == n-1)
+                    {
+                        cholmod_sparse *E0 = spqr_speye <Int> (1, n, xtype,
+                            cc) ;
+                        cholmod_dense *B0 = spqr_ones <Int> (1, nb, xtype,
+                            cc) ;
+                        Cdense = SuiteSparseQR_qmult <Entry,Int> (SPQR_QTX,
+                            QR1, Bdense, cc) ;
+                        X1dense = SuiteSparseQR_solve <Entry,Int>
+                            (SPQR_RETX_EQUALS_B, QR1, Cdense, cc) ;
+                        ok = append_rows_out_of_memory <Entry,Int> (E0, B0,
+                            QR1, Cdense, cc) ;
+                        err = (ok < 0) || (QR1->QRup == NULL) ||
+                            (QR1->QRup->rank != n) ;
+                        X2dense = SuiteSparseQR_solve <Entry,Int>
+                            (SPQR_RETX_EQUALS_B, QR1, Cdense, cc) ;
+                        resid = scaled_xdiff <Entry,Int> (X1dense, X2dense, 1,
+                            0) ;
+                        maxresid [m<n][wh] = MAX (maxresid [m<n][wh], resid) ;
+                        printf ("Append rank deficient %d : %g\n", ordering,
+                            resid) ;
+                        printf ("order %d : rank deficient    Err21: %g\n",
+                            ordering, err) ;
+                        maxerr = MAX (maxerr, err) ;
+                        spqr_free_dense <Int> (&X1dense, cc) ;
+                        spqr_free_dense <Int> (&X2dense, cc) ;
+                        spqr_free_dense <Int> (&Cdense, cc) ;
+                        spqr_free_dense <Int> (&B0, cc) ;
+                        spqr_free_sparse <Int> (&E0, cc) ;
+                    }
+                    SuiteSparseQR_free (&QR1, cc) ;
+                }
 
                 SuiteSparseQR_free (&QR, cc) ;
                 spqr_free_dense <Int> (&Bdense, cc) ;
@@ -2518,6 +3135,157 @@ template <typename Entry, typename Int> void qrtest
     errs [4] = CHECK_NAN (maxresid [1][1]) ;
 }
 
+// =============================================================================
+// === test_ptranspose =========================================================
+// =============================================================================
+
+// The parallel transposes (spqr_ptranspose.cpp) are used only for matrices
+// with at least twice SPQR_PTRANSPOSE_CHUNK entries, which is larger than any
+// matrix in the test set.  Construct a tall random matrix large enough for 4
+// threads, and check that S, PLinv, Sleft, the values of S, spones(A'), and
+// SuiteSparseQR_symbolic_matches are the same with 1 and 4 threads.
+
+template <typename Int> int test_ptranspose (cholmod_common *cc)
+{
+    Int m = 40000, n = 80, i, j, k, p ;
+    int64_t nzmax = m*n/8 ;
+    double err = 0 ;
+
+    // A(i,j) is present with probability 1/10, except that every 13th row of
+    // A is empty
+    cholmod_sparse *A = spqr_allocate_sparse <Int> (m, n, nzmax, TRUE, TRUE, 0,
+        CHOLMOD_REAL, cc) ;
+    Int *Qfill = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+    Int *W = (Int *) spqr_malloc <Int> (m, sizeof (Int), cc) ;
+    if (A == NULL || Qfill == NULL || W == NULL)
+    {
+        spqr_free_sparse <Int> (&A, cc) ;
+        spqr_free <Int> (n, sizeof (Int), Qfill, cc) ;
+        spqr_free <Int> (m, sizeof (Int), W, cc) ;
+        return (1) ;
+    }
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    double *Ax = (double *) A->x ;
+    p = 0 ;
+    for (j = 0 ; j < n ; j++)
+    {
+        Ap [j] = p ;
+        for (i = 0 ; i < m && p < nzmax ; i++)
+        {
+            if (i % 13 != 7 && nrand (10) == 0)
+            {
+                Ai [p] = i ;
+                Ax [p] = xrand ( ) ;
+                p++ ;
+            }
+        }
+    }
+    Ap [n] = p ;
+    Int anz = p ;
+
+    // Qfill is a random permutation
+    for (k = 0 ; k < n ; k++)
+    {
+        Qfill [k] = k ;
+    }
+    for (k = n-1 ; k > 0 ; k--)
+    {
+        j = nrand (k+1) ;
+        Int t = Qfill [k] ;
+        Qfill [k] = Qfill [j] ;
+        Qfill [j] = t ;
+    }
+
+    // with 4 threads, the transposes must take the parallel path
+    int nthreads, save_nthreads = cc->SPQR_nthreads ;
+    size_t wsize ;
+    cc->SPQR_nthreads = 4 ;
+    Int *Work = spqr_ptranspose_work <Int> (A, 0, &nthreads, &wsize, cc) ;
+    spqr_free <Int> (wsize, sizeof (Int), Work, cc) ;
+#ifdef _OPENMP
+    err += (nthreads != 4) ;
+#endif
+
+    // a symbolic analysis of A, for SuiteSparseQR_symbolic_matches
+    SuiteSparseQR_factorization <double,Int> *QR =
+        SuiteSparseQR_symbolic <double,Int> (SPQR_ORDERING_COLAMD, FALSE, A,
+        cc) ;
+    err += (QR == NULL) ;
+
+    Int *Sp [2], *Sj [2], *PLinv [2], *Sleft [2] ;
+    double *Sx [2] ;
+    cholmod_sparse *AT [2] ;
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        cc->SPQR_nthreads = (t == 0) ? 1 : 4 ;
+        Sp    [t] = (Int *) spqr_malloc <Int> (m+1, sizeof (Int), cc) ;
+        Sj    [t] = (Int *) spqr_malloc <Int> (anz, sizeof (Int), cc) ;
+        PLinv [t] = (Int *) spqr_malloc <Int> (m, sizeof (Int), cc) ;
+        Sleft [t] = (Int *) spqr_malloc <Int> (n+2, sizeof (Int), cc) ;
+        Sx    [t] = (double *) spqr_malloc <Int> (anz, sizeof (double), cc) ;
+        AT    [t] = NULL ;
+        if (Sp [t] != NULL && Sj [t] != NULL && PLinv [t] != NULL &&
+            Sleft [t] != NULL && Sx [t] != NULL)
+        {
+            spqr_stranspose1 <Int> (A, Qfill, Sp [t], Sj [t], PLinv [t],
+                Sleft [t], W, cc) ;
+            spqr_stranspose2 <double,Int> (A, Qfill, Sp [t], PLinv [t], Sx [t],
+                W, cc) ;
+            AT [t] = spqr_ptranspose <Int> (A, cc) ;
+        }
+        err += (AT [t] == NULL) ;
+
+        // move the first entry of A(:,0) down by one row, if that row of
+        // A(:,0) is empty, so A has the same number of entries as before
+        // but no longer matches the analysis
+        if (QR != NULL)
+        {
+            err += !SuiteSparseQR_symbolic_matches <double,Int> (QR, A, cc) ;
+            i = Ai [0] ;
+            if (anz > 1 && Ap [1] > 1 && Ai [1] > i+1)
+            {
+                Ai [0] = i+1 ;
+                err += SuiteSparseQR_symbolic_matches <double,Int> (QR, A, cc) ;
+                Ai [0] = i ;
+            }
+        }
+    }
+
+    // the results with 4 threads must be identical to those with 1 thread
+    if (err == 0)
+    {
+        err += (memcmp (Sp    [0], Sp    [1], (m+1) * sizeof (Int)) != 0) ;
+        err += (memcmp (Sj    [0], Sj    [1], anz   * sizeof (Int)) != 0) ;
+        err += (memcmp (PLinv [0], PLinv [1], m     * sizeof (Int)) != 0) ;
+        err += (memcmp (Sleft [0], Sleft [1], (n+2) * sizeof (Int)) != 0) ;
+        err += (memcmp (Sx    [0], Sx    [1], anz   * sizeof (double)) != 0) ;
+        err += (memcmp (AT [0]->p, AT [1]->p, (m+1) * sizeof (Int)) != 0) ;
+        err += (memcmp (AT [0]->i, AT [1]->i, anz   * sizeof (Int)) != 0) ;
+    }
+
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        spqr_free <Int> (m+1, sizeof (Int),    Sp    [t], cc) ;
+        spqr_free <Int> (anz, sizeof (Int),    Sj    [t], cc) ;
+        spqr_free <Int> (m,   sizeof (Int),    PLinv [t], cc) ;
+        spqr_free <Int> (n+2, sizeof (Int),    Sleft [t], cc) ;
+        spqr_free <Int> (anz, sizeof (double), Sx    [t], cc) ;
+        spqr_free_sparse <Int> (&AT [t], cc) ;
+    }
+    SuiteSparseQR_free (&QR, cc) ;
+    spqr_free <Int> (n, sizeof (Int), Qfill, cc) ;
+    spqr_free <Int> (m, sizeof (Int), W, cc) ;
+    spqr_free_sparse <Int> (&A, cc) ;
+    cc->SPQR_nthreads = save_nthreads ;
+
+    printf ("parallel transposes, nnz(A) = %ld : Err %g\n", (int64_t) anz,
+        err) ;
+    fprintf (stderr, "parallel transposes, nnz(A) = %ld : %s\n",
+        (int64_t) anz, (err == 0) ? "OK." : "FAIL") ;
+    return (err != 0) ;
+}
+
 // =============================================================================
 // === do_matrix2 ==============================================================
 // =============================================================================
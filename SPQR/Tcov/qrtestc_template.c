@@ -32,8 +32,11 @@ static void QRTESTC
     Real resid, one [2] = {1,0}, minusone [2] = {-1,0} ;
     Int m, n ;
 #ifndef NEXPERT
-    cholmod_dense *Y ;
-    int split ;
+    cholmod_dense *Y, *X2, *Y2 ;
+    SuiteSparseQR_C_factorization *QR2 ;
+    int8_t *blob ;
+    int64_t blobsize, k, xsize ;
+    int split, view ;
 #endif
 
     m = A->nrow ;
@@ -107,11 +110,45 @@ static void QRTESTC
         resid = CHOLMOD (norm_dense (Resid, 1, cc)) / MAX (anorm, 1) ;
         resid = (resid < 0 || resid != resid) ? 9e99 : resid ;
         CHOLMOD (free_dense (&Resid, cc)) ;
-        CHOLMOD (free_dense (&X, cc)) ;
 
         maxresid [m>n][0] = MAX (maxresid [m>n][0], resid) ;
         printf ("Resid_C3  %d : %g\n", m>n, resid) ;
 
+        /* serialize QR, and solve again with a copy and a view of the blob */
+        blobsize = SuiteSparseQR_C_serialize_size (QR, cc) ;
+        blob = (blobsize < 0) ? NULL :
+            (int8_t *) CHOLMOD (malloc (blobsize, sizeof (int8_t), cc)) ;
+        if (X != NULL && blob != NULL &&
+            SuiteSparseQR_C_serialize (blob, blobsize, QR, cc))
+        {
+            for (view = 0 ; view <= 1 ; view++)
+            {
+                QR2 = SuiteSparseQR_C_deserialize (blob, blobsize, view, cc) ;
+                Y2 = SuiteSparseQR_C_qmult (0, QR2, B, cc) ;
+                X2 = SuiteSparseQR_C_solve (1, QR2, Y2, cc) ;
+
+                /* X2 must be identical to X */
+                resid = (X2 == NULL) ? 9e99 : 0 ;
+                xsize = n * ((X->xtype == CHOLMOD_COMPLEX) ? 2 : 1) ;
+                for (k = 0 ; X2 != NULL && k < xsize ; k++)
+                {
+                    Real d = ((Real *) X->x) [k] - ((Real *) X2->x) [k] ;
+                    resid = MAX (resid, (d < 0) ? -d : d) ;
+                }
+                maxresid [m>n][0] = MAX (maxresid [m>n][0], resid) ;
+                printf ("Resid_C4  %d %d : %g\n", m>n, view, resid) ;
+
+                CHOLMOD (free_dense (&X2, cc)) ;
+                CHOLMOD (free_dense (&Y2, cc)) ;
+                SuiteSparseQR_C_free (&QR2, cc) ;
+            }
+        }
+        if (blob != NULL)
+        {
+            CHOLMOD (free (blobsize, sizeof (int8_t), blob, cc)) ;
+        }
+
+        CHOLMOD (free_dense (&X, cc)) ;
         CHOLMOD (free_dense (&Y, cc)) ;
         SuiteSparseQR_C_free (&QR, cc) ;
     }
@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Demo/umfpack_parallel_demo: test the parallel paths of UMFPACK
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    The parallel paths of UMFPACK are compiled only in a release build with
+    OpenMP, and not in the statement coverage test in UMFPACK/Tcov.  This
+    program factorizes a matrix with many independent blocks with
+    Control [UMFPACK_NTHREADS] = 1 and 4, with the unsymmetric and the
+    symmetric strategies, and compares the solutions.
+    It then compares the results of umfpack_dl_triplet_to_col,
+    umfpack_dl_transpose, the singleton search, the scaling in
+    umfpack_dl_numeric, and umfpack_dl_scale on a large matrix with 1 and 4
+    threads, which must be identical.  It returns 0 if all tests pass, and 1
+    otherwise.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "umfpack.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define MAX(a,b) (((a) > (b)) ? (a) : (b))
+#define MIN(a,b) (((a) < (b)) ? (a) : (b))
+
+static int nfail = 0 ;
+
+static void check (int ok, const char *what)
+{
+    if (!ok)
+    {
+        printf ("umfpack_parallel_demo: FAIL: %s\n", what) ;
+        nfail++ ;
+    }
+}
+
+// same: return 1 if the two arrays of n entries of size s are identical
+static int same (const void *X, const void *Y, int64_t n, size_t s)
+{
+    return (memcmp (X, Y, n * s) == 0) ;
+}
+
+static void set_threads (int nthreads)
+{
+#ifdef _OPENMP
+    omp_set_num_threads (nthreads) ;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// gen_matrix: generate an n-by-n matrix with diagonal blocks
+//------------------------------------------------------------------------------
+
+// Each diagonal block of size nb is tridiagonal with two more entries in each
+// row, in random columns of the block no more than band away from the
+// diagonal, and is diagonally dominant.  If connect is true, every fourth
+// block is lower triangular, so that it is removed by the singleton search,
+// and an entry in the last row of each block links it to the next block.
+// The matrix is returned in triplet form, with duplicates.
+
+static int64_t gen_matrix
+(
+    int64_t n,
+    int64_t nb,
+    int64_t band,
+    int connect,
+    int64_t **Ti_handle,
+    int64_t **Tj_handle,
+    double **Tx_handle
+)
+{
+    int64_t nzmax = 6*n, nz = 0, i, k, lo, hi, j1, j2 ;
+    int64_t *Ti = malloc (nzmax * sizeof (int64_t)) ;
+    int64_t *Tj = malloc (nzmax * sizeof (int64_t)) ;
+    double  *Tx = malloc (nzmax * sizeof (double)) ;
+    if (!Ti || !Tj || !Tx) { printf ("out of memory\n") ; exit (1) ; }
+    srand (1) ;
+    for (i = 0 ; i < n ; i++)
+    {
+        lo = (i / nb) * nb ;
+        hi = (lo + nb < n) ? (lo + nb) : n ;
+        int lower = connect && ((i / nb) % 4 == 0) ;
+        Ti [nz] = i ; Tj [nz] = i ; Tx [nz++] = 8 ;
+        if (i > lo)
+        {
+            Ti [nz] = i ; Tj [nz] = i-1 ; Tx [nz++] = -1 ;
+            if (!lower)
+            {
+                Ti [nz] = i-1 ; Tj [nz] = i ; Tx [nz++] = -2 ;
+            }
+        }
+        else if (connect && i > 0)
+        {
+            // link this block to the previous one
+            Ti [nz] = i-1 ; Tj [nz] = i ; Tx [nz++] = -1 ;
+        }
+        j1 = MAX (lo, i - band) ;
+        j2 = lower ? i : MIN (hi-1, i + band) ;
+        for (k = 0 ; k < 2 ; k++)
+        {
+            // a random entry in the block, possibly a duplicate
+            Ti [nz] = i ;
+            Tj [nz] = j1 + rand ( ) % (j2 - j1 + 1) ;
+            Tx [nz++] = ((double) (rand ( ) % 1000)) / 1000 ;
+        }
+    }
+    (*Ti_handle) = Ti ;
+    (*Tj_handle) = Tj ;
+    (*Tx_handle) = Tx ;
+    return (nz) ;
+}
+
+//------------------------------------------------------------------------------
+// factorize_and_solve: solve Ax=b with the given number of threads
+//------------------------------------------------------------------------------
+
+static int factorize_and_solve
+(
+    int64_t n,
+    const int64_t *Ap,
+    const int64_t *Ai,
+    const double *Ax,
+    double *x,
+    const double *b,
+    int nthreads,
+    int strategy,
+    double *nblocks
+)
+{
+    double Control [UMFPACK_CONTROL], Info [UMFPACK_INFO] ;
+    void *Symbolic = NULL, *Numeric = NULL ;
+    int status ;
+    umfpack_dl_defaults (Control) ;
+    Control [UMFPACK_NTHREADS] = nthreads ;
+    Control [UMFPACK_STRATEGY] = strategy ;
+    status = umfpack_dl_symbolic (n, n, Ap, Ai, Ax, &Symbolic, Control, Info) ;
+    if (status == UMFPACK_OK)
+    {
+        status = umfpack_dl_numeric (Ap, Ai, Ax, Symbolic, &Numeric, Control,
+            Info) ;
+        (*nblocks) = Info [UMFPACK_NUMERIC_NBLOCKS] ;
+    }
+    if (status == UMFPACK_OK)
+    {
+        status = umfpack_dl_solve (UMFPACK_A, Ap, Ai, Ax, x, b, Numeric,
+            Control, Info) ;
+    }
+    umfpack_dl_free_symbolic (&Symbolic) ;
+    umfpack_dl_free_numeric (&Numeric) ;
+    return (status) ;
+}
+
+//------------------------------------------------------------------------------
+// resid: relative residual norm(A*x-b,inf) / (norm(A,1) norm(x,inf) + ...)
+//------------------------------------------------------------------------------
+
+static double resid
+(
+    int64_t n,
+    const int64_t *Ap,
+    const int64_t *Ai,
+    const double *Ax,
+    const double *x,
+    const double *b
+)
+{
+    double *r = malloc (n * sizeof (double)), rnorm = 0, anorm = 0, xnorm = 0,
+        bnorm = 0, s ;
+    int64_t i, j, p ;
+    if (!r) { printf ("out of memory\n") ; exit (1) ; }
+    for (i = 0 ; i < n ; i++) r [i] = -b [i] ;
+    for (j = 0 ; j < n ; j++)
+    {
+        s = 0 ;
+        for (p = Ap [j] ; p < Ap [j+1] ; p++)
+        {
+            r [Ai [p]] += Ax [p] * x [j] ;
+            s += fabs (Ax [p]) ;
+        }
+        anorm = MAX (anorm, s) ;
+    }
+    for (i = 0 ; i < n ; i++)
+    {
+        rnorm = MAX (rnorm, fabs (r [i])) ;
+        xnorm = MAX (xnorm, fabs (x [i])) ;
+        bnorm = MAX (bnorm, fabs (b [i])) ;
+    }
+    free (r) ;
+    return (rnorm / (anorm * xnorm + bnorm)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_large: compare the parallel and sequential paths on a large matrix
+//------------------------------------------------------------------------------
+
+// The matrix is large enough for umfpack_dl_triplet_to_col,
+// umfpack_dl_transpose, umf_singletons, and the scaling in umf_kernel_init to
+// use up to 4 threads, and for umfpack_dl_scale to use 2.  The matrix has a
+// single connected component, so umfpack_dl_numeric does not factorize
+// independent groups, and the results with 1 and 4 threads must be identical.
+
+static void test_large (void)
+{
+    int64_t n = 600000, nb = 1000, nz, anz = 0, i, k ;
+    int64_t *Ti, *Tj, *Ap [2], *Ai [2], *Map [2], *Rp [2], *Ri [2], *Sp [2],
+        *Si [2], *P, *Q ;
+    double *Tx, *Ax [2], *Rx [2], *Sx [2], *b, *X [2], *Y [2],
+        Control [UMFPACK_CONTROL], Info [2][UMFPACK_INFO] ;
+    void *Symbolic, *Numeric ;
+    int threads [2] = { 1, 4 }, status [2] ;
+
+    nz = gen_matrix (n, nb, 4, 1, &Ti, &Tj, &Tx) ;
+    P = malloc (n * sizeof (int64_t)) ;
+    Q = malloc (n * sizeof (int64_t)) ;
+    if (!P || !Q) { printf ("out of memory\n") ; exit (1) ; }
+    for (i = 0 ; i < n ; i++)
+    {
+        // P and Q are permutations of 0:n-1, since 7919 and n are coprime
+        P [i] = (i * 7919) % n ;
+        Q [i] = n - 1 - i ;
+    }
+
+    for (k = 0 ; k < 2 ; k++)
+    {
+        set_threads (threads [k]) ;
+        Ap [k]  = malloc ((n+1) * sizeof (int64_t)) ;
+        Ai [k]  = malloc (nz * sizeof (int64_t)) ;
+        Ax [k]  = malloc (nz * sizeof (double)) ;
+        Map [k] = malloc (nz * sizeof (int64_t)) ;
+        Rp [k]  = malloc ((n+1) * sizeof (int64_t)) ;
+        Ri [k]  = malloc (nz * sizeof (int64_t)) ;
+        Rx [k]  = malloc (nz * sizeof (double)) ;
+        Sp [k]  = malloc ((n+1) * sizeof (int64_t)) ;
+        Si [k]  = malloc (nz * sizeof (int64_t)) ;
+        Sx [k]  = malloc (nz * sizeof (double)) ;
+        if (!Ap [k] || !Ai [k] || !Ax [k] || !Map [k] || !Rp [k] || !Ri [k]
+            || !Rx [k] || !Sp [k] || !Si [k] || !Sx [k])
+        {
+            printf ("out of memory\n") ;
+            exit (1) ;
+        }
+
+        // triplet form to compressed-column form, with and without Map
+        check (umfpack_dl_triplet_to_col (n, n, nz, Ti, Tj, Tx, Ap [k], Ai [k],
+            Ax [k], NULL) == UMFPACK_OK, "triplet_to_col") ;
+        check (umfpack_dl_triplet_to_col (n, n, nz, Ti, Tj, Tx, Ap [k], Ai [k],
+            Ax [k], Map [k]) == UMFPACK_OK, "triplet_to_col with Map") ;
+        anz = Ap [k][n] ;
+
+        // transpose with and without the permutations
+        check (umfpack_dl_transpose (n, n, Ap [k], Ai [k], Ax [k], NULL, NULL,
+            Rp [k], Ri [k], Rx [k]) == UMFPACK_OK, "transpose") ;
+        check (umfpack_dl_transpose (n, n, Ap [k], Ai [k], Ax [k], P, Q,
+            Sp [k], Si [k], Sx [k]) == UMFPACK_OK, "permuted transpose") ;
+    }
+    printf ("large matrix: n %g triplets %g nz %g\n", (double) n, (double) nz,
+        (double) anz) ;
+
+    check (same (Ap [0], Ap [1], n+1, sizeof (int64_t)) &&
+        same (Ai [0], Ai [1], anz, sizeof (int64_t)) &&
+        same (Ax [0], Ax [1], anz, sizeof (double)) &&
+        same (Map [0], Map [1], nz, sizeof (int64_t)),
+        "parallel triplet_to_col differs") ;
+    check (same (Rp [0], Rp [1], n+1, sizeof (int64_t)) &&
+        same (Ri [0], Ri [1], anz, sizeof (int64_t)) &&
+        same (Rx [0], Rx [1], anz, sizeof (double)),
+        "parallel transpose differs") ;
+    check (same (Sp [0], Sp [1], n+1, sizeof (int64_t)) &&
+        same (Si [0], Si [1], anz, sizeof (int64_t)) &&
+        same (Sx [0], Sx [1], anz, sizeof (double)),
+        "parallel permuted transpose differs") ;
+
+    //--------------------------------------------------------------------------
+    // factorize, solve, and scale with 1 and 4 threads
+    //--------------------------------------------------------------------------
+
+    b = malloc (n * sizeof (double)) ;
+    if (!b) { printf ("out of memory\n") ; exit (1) ; }
+    for (i = 0 ; i < n ; i++) b [i] = 1 + (double) (i % 17) ;
+    umfpack_dl_defaults (Control) ;
+    for (k = 0 ; k < 2 ; k++)
+    {
+        set_threads (threads [k]) ;
+        Control [UMFPACK_NTHREADS] = threads [k] ;
+        X [k] = malloc (n * sizeof (double)) ;
+        Y [k] = malloc (n * sizeof (double)) ;
+        if (!X [k] || !Y [k]) { printf ("out of memory\n") ; exit (1) ; }
+        Symbolic = NULL ;
+        Numeric = NULL ;
+        status [k] = umfpack_dl_symbolic (n, n, Ap [0], Ai [0], Ax [0],
+            &Symbolic, Control, Info [k]) ;
+        if (status [k] == UMFPACK_OK)
+        {
+            status [k] = umfpack_dl_numeric (Ap [0], Ai [0], Ax [0], Symbolic,
+                &Numeric, Control, Info [k]) ;
+        }
+        if (status [k] == UMFPACK_OK)
+        {
+            status [k] = umfpack_dl_solve (UMFPACK_A, Ap [0], Ai [0], Ax [0],
+                X [k], b, Numeric, Control, Info [k]) ;
+        }
+        if (status [k] == UMFPACK_OK)
+        {
+            status [k] = umfpack_dl_scale (Y [k], b, Numeric) ;
+        }
+        check (status [k] == UMFPACK_OK, "large factorization") ;
+        umfpack_dl_free_symbolic (&Symbolic) ;
+        umfpack_dl_free_numeric (&Numeric) ;
+    }
+    printf ("large matrix: singletons %g, nnz(L+U) %g, residual %g\n",
+        Info [0][UMFPACK_COL_SINGLETONS] + Info [0][UMFPACK_ROW_SINGLETONS],
+        Info [0][UMFPACK_LNZ] + Info [0][UMFPACK_UNZ],
+        resid (n, Ap [0], Ai [0], Ax [0], X [0], b)) ;
+
+    check (Info [0][UMFPACK_COL_SINGLETONS] == Info [1][UMFPACK_COL_SINGLETONS]
+        && Info [0][UMFPACK_ROW_SINGLETONS] == Info [1][UMFPACK_ROW_SINGLETONS],
+        "parallel singletons differ") ;
+    check (Info [0][UMFPACK_LNZ] == Info [1][UMFPACK_LNZ] &&
+        Info [0][UMFPACK_UNZ] == Info [1][UMFPACK_UNZ],
+        "parallel factors differ") ;
+    check (same (X [0], X [1], n, sizeof (double)),
+        "parallel large solution differs") ;
+    check (same (Y [0], Y [1], n, sizeof (double)),
+        "parallel umfpack_dl_scale differs") ;
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    for (k = 0 ; k < 2 ; k++)
+    {
+        free (X [k]) ; free (Y [k]) ;
+        free (Ap [k]) ; free (Ai [k]) ; free (Ax [k]) ; free (Map [k]) ;
+        free (Rp [k]) ; free (Ri [k]) ; free (Rx [k]) ;
+        free (Sp [k]) ; free (Si [k]) ; free (Sx [k]) ;
+    }
+    free (Ti) ; free (Tj) ; free (Tx) ; free (P) ; free (Q) ; free (b) ;
+    set_threads (threads [1]) ;
+}
+
+//------------------------------------------------------------------------------
+// umfpack_parallel_demo main program
+//------------------------------------------------------------------------------
+
+int main (void)
+{
+    printf ("%s\n", UMFPACK_VERSION) ;
+
+    int64_t n = 40000, nb = 500, nz, i, k ;
+    int64_t *Ti, *Tj, *Ap, *Ai ;
+    double *Tx, *Ax, *b, *x1, *x4, *x4b, err, xnorm, r1, r4, nblocks1,
+        nblocks4 ;
+    int status1, status4, status4b ;
+    int strategy [2] = { UMFPACK_STRATEGY_UNSYMMETRIC,
+        UMFPACK_STRATEGY_SYMMETRIC } ;
+
+    //--------------------------------------------------------------------------
+    // generate the matrix and the right-hand side
+    //--------------------------------------------------------------------------
+
+    nz = gen_matrix (n, nb, nb, 0, &Ti, &Tj, &Tx) ;
+    Ap = malloc ((n+1) * sizeof (int64_t)) ;
+    Ai = malloc (nz * sizeof (int64_t)) ;
+    Ax = malloc (nz * sizeof (double)) ;
+    b  = malloc (n * sizeof (double)) ;
+    x1 = malloc (n * sizeof (double)) ;
+    x4 = malloc (n * sizeof (double)) ;
+    x4b = malloc (n * sizeof (double)) ;
+    if (!Ap || !Ai || !Ax || !b || !x1 || !x4 || !x4b)
+    {
+        printf ("out of memory\n") ;
+        return (1) ;
+    }
+    check (umfpack_dl_triplet_to_col (n, n, nz, Ti, Tj, Tx, Ap, Ai, Ax, NULL)
+        == UMFPACK_OK, "triplet_to_col") ;
+    for (i = 0 ; i < n ; i++) b [i] = 1 + (double) (i % 17) ;
+    printf ("n %g nz %g blocks of size %g\n", (double) n, (double) Ap [n],
+        (double) nb) ;
+
+    //--------------------------------------------------------------------------
+    // factorize the independent blocks sequentially, and in parallel
+    //--------------------------------------------------------------------------
+
+    for (k = 0 ; k < 2 ; k++)
+    {
+        status1  = factorize_and_solve (n, Ap, Ai, Ax, x1,  b, 1, strategy [k],
+            &nblocks1) ;
+        status4  = factorize_and_solve (n, Ap, Ai, Ax, x4,  b, 4, strategy [k],
+            &nblocks4) ;
+        status4b = factorize_and_solve (n, Ap, Ai, Ax, x4b, b, 4, strategy [k],
+            &nblocks4) ;
+        check (status1 == UMFPACK_OK, "sequential factorization") ;
+        check (status4 == UMFPACK_OK && status4b == UMFPACK_OK,
+            "parallel factorization") ;
+        printf ("strategy %d: blocks factorized in parallel: %g\n",
+            strategy [k], nblocks4) ;
+        check (nblocks1 == 1 && nblocks4 == 4, "independent groups") ;
+
+        // both must solve the system accurately
+        r1 = resid (n, Ap, Ai, Ax, x1, b) ;
+        r4 = resid (n, Ap, Ai, Ax, x4, b) ;
+        printf ("residual: 1 thread %g, 4 threads %g\n", r1, r4) ;
+        check (r1 < 1e-14 && r4 < 1e-14, "residual") ;
+
+        // the groups have the same ordering and fronts as the whole matrix,
+        // but their pivots are searched and scaled on their own, so the
+        // solutions can differ by rounding errors
+        err = 0 ;
+        xnorm = 0 ;
+        for (i = 0 ; i < n ; i++)
+        {
+            err = MAX (err, fabs (x1 [i] - x4 [i])) ;
+            xnorm = MAX (xnorm, fabs (x1 [i])) ;
+        }
+        printf ("difference between the solutions: %g\n", err / xnorm) ;
+        check (err <= 1e-12 * xnorm, "parallel solution differs") ;
+
+        // the parallel factorization is deterministic
+        for (i = 0 ; i < n ; i++)
+        {
+            check (x4 [i] == x4b [i], "parallel solution not repeatable") ;
+            if (x4 [i] != x4b [i]) break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the parallel and sequential paths on a large matrix
+    //--------------------------------------------------------------------------
+
+    test_large ( ) ;
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    free (Ti) ; free (Tj) ; free (Tx) ;
+    free (Ap) ; free (Ai) ; free (Ax) ;
+    free (b) ; free (x1) ; free (x4) ; free (x4b) ;
+    printf ("umfpack_parallel_demo: %s\n", nfail ? "FAILED" : "all tests passed") ;
+    return (nfail ? 1 : 0) ;
+}
@@ -29,11 +29,13 @@
 /* size of Info and Control arrays */
 /* -------------------------------------------------------------------------- */
 
-/* These might be larger in future versions, since there are only 3 unused
- * entries in Info, and no unused entries in Control. */
+/* These might be larger in future versions, since there is only 1 unused
+ * entry in Info.  Control was increased from 20 to 30 entries in UMFPACK
+ * 7.0.0, when Control [UMFPACK_NTHREADS] was added.  This changed the ABI,
+ * so applications compiled with UMFPACK 6.x must be recompiled. */
 
 #define UMFPACK_INFO 90
-#define UMFPACK_CONTROL 20
+#define UMFPACK_CONTROL 30
 
 /* -------------------------------------------------------------------------- */
 /* Version, copyright, and license */
@@ -74,23 +76,23 @@
  * below.
  */
 
-#define UMFPACK_DATE "Sept 23, 2024"
-#define UMFPACK_MAIN_VERSION   6
-#define UMFPACK_SUB_VERSION    3
-#define UMFPACK_SUBSUB_VERSION 5
+#define UMFPACK_DATE "Oct 19, 2026"
+#define UMFPACK_MAIN_VERSION   7
+#define UMFPACK_SUB_VERSION    0
+#define UMFPACK_SUBSUB_VERSION 0
 
 #define UMFPACK_VER_CODE(main,sub) SUITESPARSE_VER_CODE(main,sub)
-#define UMFPACK_VER UMFPACK_VER_CODE(6,3)
+#define UMFPACK_VER UMFPACK_VER_CODE(7,0)
 
-#define UMFPACK__VERSION SUITESPARSE__VERCODE(6,3,5)
+#define UMFPACK__VERSION SUITESPARSE__VERCODE(7,0,0)
 #if !defined (SUITESPARSE__VERSION) || \
     (SUITESPARSE__VERSION < SUITESPARSE__VERCODE(7,8,0))
-#error "UMFPACK 6.3.5 requires SuiteSparse_config 7.8.0 or later"
+#error "UMFPACK 7.0.0 requires SuiteSparse_config 7.8.0 or later"
 #endif
 
 #if !defined (AMD__VERSION) || \
     (AMD__VERSION < SUITESPARSE__VERCODE(3,3,3))
-#error "UMFPACK 6.3.5 requires AMD 3.3.3 or later"
+#error "UMFPACK 7.0.0 requires AMD 3.3.3 or later"
 #endif
 
 // user code should not directly use GB_STR or GB_XSTR
@@ -213,7 +215,13 @@
 #define UMFPACK_SOLVE_TIME 85       /* solve time (seconds) */
 #define UMFPACK_SOLVE_WALLTIME 86   /* solve time (wall clock, seconds) */
 
-/* Info [87, 88, 89] unused */
+/* computed in UMFPACK_refactor: */
+#define UMFPACK_RGROWTH 87          /* reciprocal pivot growth */
+
+/* computed in UMFPACK_numeric: */
+#define UMFPACK_NUMERIC_NBLOCKS 88  /* # of blocks factorized in parallel */
+
+/* Info [89] unused */
 
 /* Unused parts of Info may be used in future versions of UMFPACK. */
 
@@ -242,6 +250,10 @@
 #define UMFPACK_SCALE 16                /* what row scaling to do */
 #define UMFPACK_FRONT_ALLOC_INIT 17     /* frontal matrix allocation ratio */
 #define UMFPACK_DROPTOL 18              /* drop tolerance for entries in L,U */
+#define UMFPACK_NTHREADS 20             /* # of threads for independent blocks */
+#define UMFPACK_MEMORY_LIMIT 21         /* max. bytes used by UMFPACK_numeric */
+#define UMFPACK_ILU_DROPTOL 22          /* drop tolerance for incomplete LU */
+#define UMFPACK_ILU_FILL 23             /* max. entries per col of L, row of U*/
 
 /* used in UMFPACK_*solve only: */
 #define UMFPACK_IRSTEP 7                /* max # of iterative refinements */
@@ -253,6 +265,8 @@
 #define UMFPACK_STRATEGY_THRESH_SYM 9          /* symmetry threshold */
 #define UMFPACK_STRATEGY_THRESH_NNZDIAG 12     /* nnz(diag(A)) threshold */
 
+/* Control [24..29] unused */
+
 /* -------------------------------------------------------------------------- */
 
 /* Control [UMFPACK_STRATEGY] is one of the following: */
@@ -286,6 +300,14 @@
 
 /* AMD/COLAMD means: use AMD for symmetric strategy, COLAMD for unsymmetric */
 
+/* compression methods for umfpack_*_serialize_*_compressed (the same as the
+   GxB_COMPRESSION_* methods of SuiteSparse:GraphBLAS): */
+#define UMFPACK_COMPRESSION_NONE (-1)   /* no compression */
+#define UMFPACK_COMPRESSION_DEFAULT 0   /* ZSTD (level 1) */
+#define UMFPACK_COMPRESSION_LZ4 1000    /* LZ4 */
+#define UMFPACK_COMPRESSION_LZ4HC 2000  /* LZ4HC, with default level 9 */
+#define UMFPACK_COMPRESSION_ZSTD 3000   /* ZSTD, with default level 1 */
+
 /* -------------------------------------------------------------------------- */
 /* default values of Control: */
 /* -------------------------------------------------------------------------- */
@@ -307,6 +329,10 @@
 #define UMFPACK_DEFAULT_DROPTOL 0
 #define UMFPACK_DEFAULT_ORDERING UMFPACK_ORDERING_AMD
 #define UMFPACK_DEFAULT_SINGLETONS TRUE
+#define UMFPACK_DEFAULT_NTHREADS 1
+#define UMFPACK_DEFAULT_MEMORY_LIMIT 0  /* no limit */
+#define UMFPACK_DEFAULT_ILU_DROPTOL 0   /* complete LU */
+#define UMFPACK_DEFAULT_ILU_FILL 0      /* no limit */
 
 // added for v6.0.0.  Default changed fro 0.5 to 0.3
 #define UMFPACK_DEFAULT_STRATEGY_THRESH_SYM 0.3         /* was 0.5 */
@@ -344,6 +370,7 @@
 
 #define UMFPACK_ERROR_ordering_failed (-18)
 #define UMFPACK_ERROR_invalid_blob (-19)
+#define UMFPACK_ERROR_memory_limit (-20)
 
 /* -------------------------------------------------------------------------- */
 /* solve codes */
@@ -451,6 +478,54 @@ int umfpack_zl_symbolic
     double Info [UMFPACK_INFO]
 ) ;
 
+int umfpack_si_symbolic
+(
+    int32_t n_row,
+    int32_t n_col,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_sl_symbolic
+(
+    int64_t n_row,
+    int64_t n_col,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_ci_symbolic
+(
+    int32_t n_row,
+    int32_t n_col,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_cl_symbolic
+(
+    int64_t n_row,
+    int64_t n_col,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
 /*
 double int32_t Syntax:
 
@@ -492,6 +567,13 @@ packed complex Syntax:
 
     Same as above, except Az is NULL.
 
+single precision Syntax:
+
+    Same as above, except that Ax and Az are float, and umfpack_si_*,
+    umfpack_sl_*, umfpack_ci_*, or umfpack_cl_* is used in place of
+    umfpack_di_*, umfpack_dl_*, umfpack_zi_*, or umfpack_zl_*.  The Symbolic
+    object can only be used by the single precision routines.
+
 Purpose:
 
     Given nonzero pattern of a sparse matrix A in column-oriented form,
@@ -643,6 +725,14 @@ Arguments:
         Control [UMFPACK_SINGLETONS]: If false (0), then singletons are
             not removed prior to factorization.  Default: true (1).
 
+        Control [UMFPACK_NTHREADS]: The maximum number of threads used to
+            check the matrix and to build its row form when searching for
+            singletons, for large matrices only (with at least 256K entries
+            for each thread).  The singletons and permutations do not depend
+            on the number of threads.  If zero or negative, the number of
+            threads is given by omp_get_max_threads.  Ignored if UMFPACK is
+            compiled without OpenMP.  Default: 1.
+
         Control [UMFPACK_DENSE_COL]:
             If COLAMD is used, columns with more than
             max (16, Control [UMFPACK_DENSE_COL] * 16 * sqrt (n_row)) entries
@@ -988,6 +1078,50 @@ int umfpack_zl_numeric
     double Info [UMFPACK_INFO]
 ) ;
 
+int umfpack_si_numeric
+(
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_sl_numeric
+(
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_ci_numeric
+(
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_cl_numeric
+(
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    void *Symbolic,
+    void **Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
 /*
 double int32_t Syntax:
 
@@ -1029,6 +1163,16 @@ packed complex Syntax:
 
     Same as above, except that Az is NULL.
 
+single precision Syntax:
+
+    Same as above, except that Ax and Az are float, and umfpack_si_*,
+    umfpack_sl_*, umfpack_ci_*, or umfpack_cl_* is used in place of
+    umfpack_di_*, umfpack_dl_*, umfpack_zi_*, or umfpack_zl_*.  The Symbolic
+    object must come from umfpack_si_*symbolic (etc).  The LU factors are
+    held in single precision, taking about half the memory of the double
+    precision factors, and the dense frontal matrix updates use the single
+    precision BLAS.  See also umfpack_*_solve_mixed.
+
 Purpose:
 
     Given a sparse matrix A in column-oriented form, and a symbolic analysis
@@ -1266,6 +1410,76 @@ Arguments:
 
             Default: 0.0.
 
+        Control [UMFPACK_NTHREADS]:
+
+            If greater than one, and if the matrix is square and its rows and
+            columns can be permuted into two or more independent diagonal
+            blocks (the connected components of the bipartite graph of A),
+            then the blocks are placed into at most this many groups and each
+            group is factorized in parallel with OpenMP.  The LU factors of
+            the groups are merged into a single Numeric object, which can be
+            used in the same way as any other.  The column order within each
+            block is the one given by the Symbolic object, from which the
+            Symbolic object of each group is extracted.  The matrix is
+            factorized as a whole, without parallelism, if it cannot be split
+            (as is the case for most matrices), or if any group is
+            structurally singular.  The independent subtrees of the frontal
+            tree of a single block are not factorized in parallel.  If zero or
+            negative, the number of threads is given by omp_get_max_threads.
+            If UMFPACK is compiled without OpenMP, the groups are factorized
+            one at a time.  This parameter also sets the number of threads
+            used by umfpack_*_msolve, and the number used to compute the row
+            scale factors of a large matrix that is factorized as a whole (the
+            scale factors do not depend on the number of threads).
+
+            Default: 1 (factorize the matrix as a whole).
+
+        Control [UMFPACK_MEMORY_LIMIT]:
+
+            If greater than zero, this is a hard limit (in bytes) on the memory
+            allocated by umfpack_*_numeric: the fixed-size part of the Numeric
+            object, the workspace, and the variable-sized part of the Numeric
+            object.  It does not include the Symbolic object or the input
+            matrix.  If the limit is too small to even start the factorization
+            (see Info [UMFPACK_VARIABLE_INIT_ESTIMATE]), umfpack_*_numeric
+            returns UMFPACK_ERROR_memory_limit before allocating anything.
+            Otherwise, the initial size of the variable-sized part is reduced
+            to fit in the limit, if necessary (see Control [UMFPACK_ALLOC_INIT])
+            and it is never increased beyond the limit.  Once it reaches the
+            limit, umfpack_*_numeric relies only on garbage collection, and it
+            returns UMFPACK_ERROR_memory_limit if that does not recover enough
+            space.  Setting this parameter also disables the parallel
+            factorization of independent blocks (Control [UMFPACK_NTHREADS]).
+
+            Default: 0 (no limit).
+
+        Control [UMFPACK_ILU_DROPTOL], Control [UMFPACK_ILU_FILL]:
+
+            If either is greater than zero, an incomplete LU factorization is
+            computed, for use as a preconditioner for an iterative method.
+            The same ordering, singletons, and pivoting strategy are used as
+            for the complete LU factorization.  Before each column of L and
+            row of U is used to update the frontal matrix, entries with
+            |L(i,k)| <= droptol and |U(k,j)| <= droptol*|U(k,k)| are dropped,
+            where droptol is Control [UMFPACK_ILU_DROPTOL].  If
+            Control [UMFPACK_ILU_FILL] = lfil is greater than zero, only the
+            lfil largest entries of each column of L and each row of U
+            (excluding the diagonal) are kept.  Rows and columns of the
+            contribution block in which all entries are <= droptol in
+            magnitude are also dropped, which limits the growth of the
+            subsequent frontal matrices.  Entries of the contribution block
+            are compared with droptol after row scaling, so scaling
+            (Control [UMFPACK_SCALE]) should not be disabled.  The factors can
+            be used with umfpack_*_solve in the usual way, but iterative
+            refinement should be disabled (Control [UMFPACK_IRSTEP] = 0).
+            umfpack_*_numeric may report UMFPACK_WARNING_singular_matrix even
+            if A is nonsingular, if a pivot becomes zero because of dropping.
+            umfpack_*_refactor cannot be used with an incomplete
+            factorization, and returns UMFPACK_ERROR_invalid_Numeric_object
+            if given one.
+
+            Default: 0 and 0 (complete LU factorization).
+
     double Info [UMFPACK_INFO] ;        Output argument.
 
         Contains statistics about the numeric factorization.  If a
@@ -1293,6 +1507,11 @@ Arguments:
 
                 Insufficient memory to complete the numeric factorization.
 
+            UMFPACK_ERROR_memory_limit
+
+                The numeric factorization does not fit in the memory limit
+                given by Control [UMFPACK_MEMORY_LIMIT].
+
             UMFPACK_ERROR_argument_missing
 
                 One or more required arguments are missing.
@@ -1475,6 +1694,11 @@ Arguments:
         Info [UMFPACK_ALL_UNZ]: the number of entries in U, including the
             diagonal, if no small entries are dropped.
 
+        Info [UMFPACK_NUMERIC_NBLOCKS]: the number of groups of independent
+            blocks that were factorized in parallel (see
+            Control [UMFPACK_NTHREADS]), or 1 if the matrix was factorized as
+            a whole.
+
         Only the above listed Info [...] entries are accessed.  The remaining
         entries of Info are not accessed or modified by umfpack_*_numeric.
         Future versions might modify different parts of Info.
@@ -1536,6 +1760,58 @@ int umfpack_zl_solve
     double Info [UMFPACK_INFO]
 ) ;
 
+int umfpack_si_solve
+(
+    int sys,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ],
+    float X [ ],
+    const float B [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_sl_solve
+(
+    int sys,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ],
+    float X [ ],
+    const float B [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_ci_solve
+(
+    int sys,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    float Xx [ ],      float Xz [ ],
+    const float Bx [ ], const float Bz [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_cl_solve
+(
+    int sys,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    float Xx [ ],      float Xz [ ],
+    const float Bx [ ], const float Bz [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
 /*
 double int32_t Syntax:
 
@@ -1583,6 +1859,15 @@ packed complex Syntax:
 
     Same as above, Xz, Bz, and Az are NULL.
 
+single precision Syntax:
+
+    Same as above, except that Ax, Az, X, Xx, Xz, B, Bx, and Bz are float,
+    and umfpack_si_*, umfpack_sl_*, umfpack_ci_*, or umfpack_cl_* is used in
+    place of umfpack_di_*, umfpack_dl_*, umfpack_zi_*, or umfpack_zl_*.
+    Iterative refinement is done in single precision.  To refine the solution
+    of a double precision system with single precision factors, use
+    umfpack_*_solve_mixed instead.
+
 Purpose:
 
     Given LU factors computed by umfpack_*_numeric (PAQ=LU, PRAQ=LU, or
@@ -1672,8 +1957,8 @@ Arguments:
 
         The right-hand side vector, b, stored as a conventional array of size n
         (or two arrays of size n for complex versions).  This routine does not
-        solve for multiple right-hand-sides, nor does it allow b to be stored in
-        a sparse-column form.
+        solve for multiple right-hand-sides (see umfpack_*_msolve), nor does it
+        allow b to be stored in a sparse-column form.
 
         If Az, Xz, or Bz are NULL, then both real
         and imaginary parts are contained in Bx[0..2*n-1], with Bx[2*k]
@@ -1806,6 +2091,26 @@ void umfpack_zl_free_symbolic
     void **Symbolic
 ) ;
 
+void umfpack_si_free_symbolic
+(
+    void **Symbolic
+) ;
+
+void umfpack_sl_free_symbolic
+(
+    void **Symbolic
+) ;
+
+void umfpack_ci_free_symbolic
+(
+    void **Symbolic
+) ;
+
+void umfpack_cl_free_symbolic
+(
+    void **Symbolic
+) ;
+
 /*
 double int32_t Syntax:
 
@@ -1831,6 +2136,11 @@ complex int64_t Syntax:
     void *Symbolic ;
     umfpack_zl_free_symbolic (&Symbolic) ;
 
+single precision Syntax:
+
+    Same as above, with umfpack_si_free_symbolic, umfpack_sl_free_symbolic,
+    umfpack_ci_free_symbolic, or umfpack_cl_free_symbolic.
+
 Purpose:
 
     Deallocates the Symbolic object and sets the Symbolic handle to NULL.  This
@@ -1868,6 +2178,26 @@ void umfpack_zl_free_numeric
     void **Numeric
 ) ;
 
+void umfpack_si_free_numeric
+(
+    void **Numeric
+) ;
+
+void umfpack_sl_free_numeric
+(
+    void **Numeric
+) ;
+
+void umfpack_ci_free_numeric
+(
+    void **Numeric
+) ;
+
+void umfpack_cl_free_numeric
+(
+    void **Numeric
+) ;
+
 /*
 double int32_t Syntax:
 
@@ -1893,6 +2223,11 @@ complex int64_t Syntax:
     void *Numeric ;
     umfpack_zl_free_numeric (&Numeric) ;
 
+single precision Syntax:
+
+    Same as above, with umfpack_si_free_numeric, umfpack_sl_free_numeric,
+    umfpack_ci_free_numeric, or umfpack_cl_free_numeric.
+
 Purpose:
 
     Deallocates the Numeric object and sets the Numeric handle to NULL.  This
@@ -2030,6 +2365,58 @@ int umfpack_zl_qsymbolic
     double Info [UMFPACK_INFO]
 ) ;
 
+int umfpack_si_qsymbolic
+(
+    int32_t n_row,
+    int32_t n_col,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ],
+    const int32_t Qinit [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_sl_qsymbolic
+(
+    int64_t n_row,
+    int64_t n_col,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ],
+    const int64_t Qinit [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_ci_qsymbolic
+(
+    int32_t n_row,
+    int32_t n_col,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    const int32_t Qinit [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_cl_qsymbolic
+(
+    int64_t n_row,
+    int64_t n_col,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const float Ax [ ], const float Az [ ],
+    const int64_t Qinit [ ],
+    void **Symbolic,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
 int umfpack_di_fsymbolic
 (
     int32_t n_row,
@@ -2131,6 +2518,13 @@ packed complex Syntax:
 
     Same as above, except Az is NULL.
 
+single precision Syntax:
+
+    Same as above for umfpack_*_qsymbolic, except that Ax and Az are float,
+    and umfpack_si_*, umfpack_sl_*, umfpack_ci_*, or umfpack_cl_* is used in
+    place of umfpack_di_*, umfpack_dl_*, umfpack_zi_*, or umfpack_zl_*.
+    There is no single precision umfpack_*_fsymbolic.
+
 Purpose:
 
     Given the nonzero pattern of a sparse matrix A in column-oriented form, and
@@ -2470,43 +2864,691 @@ Arguments:
         umfpack_zl_wsolve       4*n             10*n
 */
 
-//==============================================================================
-//==== Matrix manipulation routines ============================================
-//==============================================================================
-
 //------------------------------------------------------------------------------
-// umfpack_triplet_to_col
+// umfpack_msolve
 //------------------------------------------------------------------------------
 
-int umfpack_di_triplet_to_col
+int umfpack_di_msolve
 (
-    int32_t n_row,
-    int32_t n_col,
-    int32_t nz,
-    const int32_t Ti [ ],
-    const int32_t Tj [ ],
-    const double Tx [ ],
-    int32_t Ap [ ],
-    int32_t Ai [ ],
-    double Ax [ ],
-    int32_t Map [ ]
+    int sys,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ],
+    int32_t nrhs,
+    double X [ ],
+    int32_t ldx,
+    const double B [ ],
+    int32_t ldb,
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
 ) ;
 
-int umfpack_dl_triplet_to_col
+int umfpack_dl_msolve
 (
-    int64_t n_row,
-    int64_t n_col,
-    int64_t nz,
-    const int64_t Ti [ ],
-    const int64_t Tj [ ],
-    const double Tx [ ],
-    int64_t Ap [ ],
-    int64_t Ai [ ],
-    double Ax [ ],
-    int64_t Map [ ]
+    int sys,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ],
+    int64_t nrhs,
+    double X [ ],
+    int64_t ldx,
+    const double B [ ],
+    int64_t ldb,
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
 ) ;
 
-int umfpack_zi_triplet_to_col
+int umfpack_zi_msolve
+(
+    int sys,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    int32_t nrhs,
+    double Xx [ ],       double Xz [ ],
+    int32_t ldx,
+    const double Bx [ ], const double Bz [ ],
+    int32_t ldb,
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zl_msolve
+(
+    int sys,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    int64_t nrhs,
+    double Xx [ ],       double Xz [ ],
+    int64_t ldx,
+    const double Bx [ ], const double Bz [ ],
+    int64_t ldb,
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai, nrhs, ldx, ldb ;
+    int sys ;
+    double *B, *X, *Ax, Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_di_msolve (sys, Ap, Ai, Ax, nrhs, X, ldx, B, ldb,
+        Numeric, Control, Info) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai, nrhs, ldx, ldb ;
+    int sys ;
+    double *B, *X, *Ax, Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_dl_msolve (sys, Ap, Ai, Ax, nrhs, X, ldx, B, ldb,
+        Numeric, Control, Info) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai, nrhs, ldx, ldb ;
+    int sys ;
+    double *Bx, *Bz, *Xx, *Xz, *Ax, *Az, Info [UMFPACK_INFO],
+        Control [UMFPACK_CONTROL] ;
+    int status = umfpack_zi_msolve (sys, Ap, Ai, Ax, Az, nrhs, Xx, Xz, ldx,
+        Bx, Bz, ldb, Numeric, Control, Info) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai, nrhs, ldx, ldb ;
+    int sys ;
+    double *Bx, *Bz, *Xx, *Xz, *Ax, *Az, Info [UMFPACK_INFO],
+        Control [UMFPACK_CONTROL] ;
+    int status = umfpack_zl_msolve (sys, Ap, Ai, Ax, Az, nrhs, Xx, Xz, ldx,
+        Bx, Bz, ldb, Numeric, Control, Info) ;
+
+packed complex Syntax:
+
+    Same as above, except Xz, Bz, and/or Az are NULL.
+
+Purpose:
+
+    Solves the same systems as umfpack_*_solve, for nrhs right-hand sides at
+    once.  Column j of the n-by-nrhs matrix X is the solution of the system
+    with column j of the n-by-nrhs matrix B as its right-hand side.  The
+    result is the same as calling umfpack_*_solve for each column in turn,
+    but the right-hand sides are handled in blocks, so that each pass over
+    the LU factors is shared by all columns of a block.  This is much faster
+    than solving one column at a time when the factors do not fit in cache.
+
+    Iterative refinement is done as in umfpack_*_solve, separately for each
+    column: the refinement of a column stops once its own backward error is
+    small, and the remaining columns of the block continue.
+
+    The blocks of right-hand sides are solved in parallel with OpenMP, if
+    Control [UMFPACK_NTHREADS] is not one.  The workspace is allocated
+    internally, one copy for each thread.
+
+Returns:
+
+    The status code is returned.  See Info [UMFPACK_STATUS], below.
+
+Arguments:
+
+    int sys ;           Input argument, not modified.
+
+        Defines which system to solve, as described in umfpack_*_solve.
+        Iterative refinement is performed only when sys is UMFPACK_A,
+        UMFPACK_At, or UMFPACK_Aat.
+
+    Int Ap [n+1] ;      Input argument, not modified.
+    Int Ai [nz] ;       Input argument, not modified.
+    double Ax [nz] ;    Input argument, not modified.
+                        Size 2*nz for packed complex case.
+    double Az [nz] ;    Input argument, not modified, for complex versions.
+
+        The matrix A, as described in umfpack_*_solve.  These arrays are only
+        accessed if iterative refinement is performed.  If Az is NULL, A is
+        in packed complex form.
+
+    Int nrhs ;          Input argument, not modified.
+
+        The number of right-hand sides.  If zero, nothing is done.
+
+    double X [ldx*nrhs] ;   Output argument.
+    or:
+    double Xx [ldx*nrhs] ;  Output argument, real part.
+                            Size 2*ldx*nrhs for packed complex case.
+    double Xz [ldx*nrhs] ;  Output argument, imaginary part.
+    Int ldx ;               Input argument, not modified.
+
+        The solutions, stored by column with leading dimension ldx >= n.
+        Entry i of column j is X [i+j*ldx].  If Xz is NULL, X is in packed
+        complex form: the real and imaginary parts of entry i of column j
+        are Xx [2*(i+j*ldx)] and Xx [2*(i+j*ldx)+1].  Entries n to ldx-1 of
+        each column are not modified.
+
+    double B [ldb*nrhs] ;   Input argument, not modified.
+    or:
+    double Bx [ldb*nrhs] ;  Input argument, not modified, real part.
+                            Size 2*ldb*nrhs for packed complex case.
+    double Bz [ldb*nrhs] ;  Input argument, not modified, imaginary part.
+    Int ldb ;               Input argument, not modified.
+
+        The right-hand sides, stored by column with leading dimension
+        ldb >= n, in the same form as X.  If Bz is NULL, B is in packed
+        complex form.  Each of A, X, and B can be split or packed
+        independently of the others.  B and X must not overlap.
+
+    void *Numeric ;             Input argument, not modified.
+
+        Numeric must point to a valid Numeric object, computed by
+        umfpack_*_numeric.
+
+    double Control [UMFPACK_CONTROL] ;  Input argument, not modified.
+
+        If a (double *) NULL pointer is passed, then the default control
+        settings are used.  The following Control parameters are used:
+
+        Control [UMFPACK_IRSTEP]:  The maximum number of iterative refinement
+            steps to attempt for each column, as in umfpack_*_solve.
+            Default: 2.
+
+        Control [UMFPACK_NTHREADS]:  The maximum number of threads.  The
+            blocks of right-hand sides are divided into this many ranges of
+            consecutive columns.  If zero or negative, the number of threads
+            is given by omp_get_max_threads.  Ignored if UMFPACK is compiled
+            without OpenMP.  Default: 1.
+
+    double Info [UMFPACK_INFO] ;        Output argument.
+
+        Contains statistics about the solve.  If a (double *) NULL pointer is
+        passed, then no statistics are returned in Info (this is not an error
+        condition).  The following statistics are computed in
+        umfpack_*_msolve:
+
+        Info [UMFPACK_STATUS]: status code.  This is also the return value,
+            whether or not Info is present.  The values are the same as for
+            umfpack_*_solve, and in addition:
+
+            UMFPACK_ERROR_invalid_system
+
+                The sys argument is not valid, the matrix A is not square,
+                nrhs is negative, or ldx or ldb is less than n.
+
+            If the blocks of right-hand sides are solved by more than one
+            thread, the status is the first error of any thread, if any, or
+            else the first warning of any thread.
+
+        Info [UMFPACK_NROW], Info [UMFPACK_NCOL], Info [UMFPACK_NZ]:  as in
+            umfpack_*_solve.
+
+        Info [UMFPACK_IR_TAKEN], Info [UMFPACK_IR_ATTEMPTED]:  the largest
+            number of iterative refinement steps taken or attempted for any
+            one column.
+
+        Info [UMFPACK_OMEGA1], Info [UMFPACK_OMEGA2]:  the largest sparse
+            backward error estimates of any column, or -1 if iterative
+            refinement was not performed.
+
+        Info [UMFPACK_SOLVE_FLOPS]:  the number of floating point operations
+            performed, for all columns.
+
+        Info [UMFPACK_SOLVE_TIME]:  The time taken, in seconds.
+
+        Info [UMFPACK_SOLVE_WALLTIME]:  The wallclock time taken, in seconds.
+
+        Only the above listed Info [...] entries are accessed.  The remaining
+        entries of Info are not accessed or modified by umfpack_*_msolve.
+        Future versions might modify different parts of Info.
+*/
+
+//------------------------------------------------------------------------------
+// umfpack_solve_mixed
+//------------------------------------------------------------------------------
+
+int umfpack_si_solve_mixed
+(
+    int sys,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ],
+    double X [ ],
+    const double B [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_sl_solve_mixed
+(
+    int sys,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ],
+    double X [ ],
+    const double B [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_ci_solve_mixed
+(
+    int sys,
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    double Xx [ ],       double Xz [ ],
+    const double Bx [ ], const double Bz [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_cl_solve_mixed
+(
+    int sys,
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    double Xx [ ],       double Xz [ ],
+    const double Bx [ ], const double Bz [ ],
+    void *Numeric,
+    const double Control [UMFPACK_CONTROL],
+    double Info [UMFPACK_INFO]
+) ;
+
+/*
+single int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai ;
+    int sys ;
+    double *B, *X, *Ax, Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_si_solve_mixed (sys, Ap, Ai, Ax, X, B, Numeric,
+        Control, Info) ;
+
+single int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai ;
+    int sys ;
+    double *B, *X, *Ax, Info [UMFPACK_INFO], Control [UMFPACK_CONTROL] ;
+    int status = umfpack_sl_solve_mixed (sys, Ap, Ai, Ax, X, B, Numeric,
+        Control, Info) ;
+
+single complex int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai ;
+    int sys ;
+    double *Bx, *Bz, *Xx, *Xz, *Ax, *Az, Info [UMFPACK_INFO],
+        Control [UMFPACK_CONTROL] ;
+    int status = umfpack_ci_solve_mixed (sys, Ap, Ai, Ax, Az, Xx, Xz, Bx, Bz,
+        Numeric, Control, Info) ;
+
+single complex int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai ;
+    int sys ;
+    double *Bx, *Bz, *Xx, *Xz, *Ax, *Az, Info [UMFPACK_INFO],
+        Control [UMFPACK_CONTROL] ;
+    int status = umfpack_cl_solve_mixed (sys, Ap, Ai, Ax, Az, Xx, Xz, Bx, Bz,
+        Numeric, Control, Info) ;
+
+packed complex Syntax:
+
+    Same as above, except Xz, Bz, and/or Az are NULL.
+
+Purpose:
+
+    Solves a double precision linear system Ax=b, A'x=b, or A.'x=b, using the
+    single precision LU factors of A computed by umfpack_si_numeric,
+    umfpack_sl_numeric, umfpack_ci_numeric, or umfpack_cl_numeric.  The
+    factors are used to solve for a correction in single precision, and the
+    residual r = b-Ax and the solution x are computed and accumulated in
+    double precision.  If A is not too ill-conditioned (roughly, if
+    cond(A)*FLT_EPSILON is much less than one), the solution converges to
+    about the same backward error as umfpack_*_solve with a double precision
+    factorization, while the factorization takes about half the memory and
+    less time.
+
+    A is given in double precision, and must be the same matrix (to within
+    single precision) as the one passed to umfpack_*_numeric to compute the
+    factors.
+
+Returns:
+
+    The status code is returned.  See Info [UMFPACK_STATUS], below.
+
+Arguments:
+
+    int sys ;           Input argument, not modified.
+
+        Defines which system to solve.  Only UMFPACK_A, UMFPACK_At, and
+        UMFPACK_Aat are supported, as described in umfpack_*_solve.
+
+    Int Ap [n+1] ;      Input argument, not modified.
+    Int Ai [nz] ;       Input argument, not modified.
+    double Ax [nz] ;    Input argument, not modified.
+                        Size 2*nz for packed complex case.
+    double Az [nz] ;    Input argument, not modified, for complex versions.
+
+        The matrix A in double precision, in the same form as for
+        umfpack_*_solve.  Required if iterative refinement is performed.  If
+        Az is NULL, A is in packed complex form.
+
+    double X [n] ;      Output argument.
+    or:
+    double Xx [n] ;     Output argument, real part.
+                        Size 2*n for packed complex case.
+    double Xz [n] ;     Output argument, imaginary part.
+
+        The solution x.  If Xz is NULL, X is in packed complex form.
+
+    double B [n] ;      Input argument, not modified.
+    or:
+    double Bx [n] ;     Input argument, not modified, real part.
+                        Size 2*n for packed complex case.
+    double Bz [n] ;     Input argument, not modified, imaginary part.
+
+        The right-hand side b.  If Bz is NULL, B is in packed complex form.
+        Each of A, X, and B can be split or packed independently of the
+        others.  B and X must not overlap.
+
+    void *Numeric ;             Input argument, not modified.
+
+        Numeric must point to a valid Numeric object, computed by one of the
+        single precision umfpack_*_numeric routines.
+
+    double Control [UMFPACK_CONTROL] ;  Input argument, not modified.
+
+        If a (double *) NULL pointer is passed, then the default control
+        settings are used.  The following Control parameter is used:
+
+        Control [UMFPACK_IRSTEP]:  The maximum number of refinement steps.
+            Refinement stops early once the backward error is as small as
+            it can be made, or when it fails to decrease by half.  If zero,
+            only the single precision solution is computed (promoted to
+            double).  With single precision factors, more steps are usually
+            needed than with double precision factors; a value of 10 or so is
+            typical.  Default: 2.
+
+    double Info [UMFPACK_INFO] ;        Output argument.
+
+        Contains statistics about the solve.  If a (double *) NULL pointer is
+        passed, then no statistics are returned in Info (this is not an error
+        condition).  The same statistics are returned as for umfpack_*_solve,
+        and in addition:
+
+        Info [UMFPACK_STATUS]:
+
+            UMFPACK_ERROR_invalid_system
+
+                The matrix is not square, or sys is not UMFPACK_A, UMFPACK_At,
+                or UMFPACK_Aat.
+
+            UMFPACK_ERROR_argument_missing
+
+                X or B is missing, or A is missing and Control [UMFPACK_IRSTEP]
+                is greater than zero.
+*/
+
+//------------------------------------------------------------------------------
+// umfpack_refactor
+//------------------------------------------------------------------------------
+
+int umfpack_di_refactor
+(
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ],
+    void *Numeric,
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_dl_refactor
+(
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ],
+    void *Numeric,
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zi_refactor
+(
+    const int32_t Ap [ ],
+    const int32_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    void *Numeric,
+    double Info [UMFPACK_INFO]
+) ;
+
+int umfpack_zl_refactor
+(
+    const int64_t Ap [ ],
+    const int64_t Ai [ ],
+    const double Ax [ ], const double Az [ ],
+    void *Numeric,
+    double Info [UMFPACK_INFO]
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai ;
+    double *Ax, Info [UMFPACK_INFO] ;
+    int status = umfpack_di_refactor (Ap, Ai, Ax, Numeric, Info) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai ;
+    double *Ax, Info [UMFPACK_INFO] ;
+    int status = umfpack_dl_refactor (Ap, Ai, Ax, Numeric, Info) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int32_t *Ap, *Ai ;
+    double *Ax, *Az, Info [UMFPACK_INFO] ;
+    int status = umfpack_zi_refactor (Ap, Ai, Ax, Az, Numeric, Info) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    void *Numeric ;
+    int64_t *Ap, *Ai ;
+    double *Ax, *Az, Info [UMFPACK_INFO] ;
+    int status = umfpack_zl_refactor (Ap, Ai, Ax, Az, Numeric, Info) ;
+
+packed complex Syntax:
+
+    Same as above, except that Az is NULL.
+
+Purpose:
+
+    Given a Numeric object computed by umfpack_*_numeric for a matrix with
+    the same nonzero pattern as A, umfpack_*_refactor recomputes the
+    numerical values of the LU factors of A in place.  The row and column
+    permutations P and Q, the kind of row scaling, and the nonzero pattern of
+    L and U are all reused; only the scale factors R and the values of L and
+    U are recomputed.  No pivot search is done, no frontal matrices or
+    elements are created, and no memory in the Numeric object is
+    reallocated, so this is much faster than umfpack_*_numeric when a
+    sequence of matrices with identical pattern and similar values is to be
+    factorized.
+
+    Since the pivots are not chosen for the new values, the factorization can
+    be inaccurate or unstable.  The reciprocal pivot growth is returned in
+    Info [UMFPACK_RGROWTH]; if it is small, the caller should discard the
+    Numeric object and call umfpack_*_numeric instead.
+
+    Only square matrices for which umfpack_*_numeric found n pivots can be
+    refactorized.  If the new matrix has a nonzero entry, or a nonzero
+    entry of L or U, that does not fit in the pattern held in the Numeric
+    object (which can occur if A has a different pattern, if
+    umfpack_*_numeric dropped entries because Control [UMFPACK_DROPTOL] > 0,
+    or if an entry of L or U happened to be exactly zero when the Numeric
+    object was computed), then UMFPACK_ERROR_different_pattern is returned.
+    The Numeric object is not modified if an error occurs.
+
+Returns:
+
+    The status code is returned.  See Info [UMFPACK_STATUS], below.
+
+Arguments:
+
+    Int Ap [n+1] ;      Input argument, not modified.
+    Int Ai [nz] ;       Input argument, not modified.
+    double Ax [nz] ;    Input argument, not modified.
+                        Size 2*nz for packed complex case.
+
+        The new matrix A, in compressed column form as described in
+        umfpack_*_numeric.  Row indices in each column must be sorted and
+        free of duplicates.  It should have the same pattern as the matrix
+        that was factorized by umfpack_*_numeric to obtain the Numeric object.
+
+    double Az [nz] ;    Input argument, not modified, for complex versions.
+
+        For the complex versions, this holds the imaginary part of A.  The
+        imaginary part of column j is held in Az [(Ap [j]) ... (Ap [j+1]-1)].
+
+        If Az is NULL, then both real
+        and imaginary parts are contained in Ax[0..2*nz-1], with Ax[2*k]
+        and Ax[2*k+1] being the real and imaginary part of the kth entry.
+
+    void *Numeric ;     Input/output argument.
+
+        The Numeric object computed by umfpack_*_numeric (or by a prior call
+        to umfpack_*_refactor).  On output, it holds the LU factors of the
+        new matrix, if successful.
+
+    double Info [UMFPACK_INFO] ;        Output argument.
+
+        Contains statistics about the refactorization.  If a (double *) NULL
+        pointer is passed, then no statistics are returned in Info (this is
+        not an error condition).  The following statistics are computed in
+        umfpack_*_refactor:
+
+        Info [UMFPACK_STATUS]: status code.  This is also the return value,
+            whether or not Info is present.
+
+            UMFPACK_OK
+
+                The refactorization was successful.
+
+            UMFPACK_WARNING_singular_matrix
+
+                The refactorization was successful, but the new matrix is
+                singular (a zero pivot was encountered).
+
+            UMFPACK_ERROR_out_of_memory
+
+                Insufficient memory for the workspace.
+
+            UMFPACK_ERROR_argument_missing
+
+                One or more required arguments are missing.
+
+            UMFPACK_ERROR_invalid_Numeric_object
+
+                The Numeric object provided as input is invalid, or holds an
+                incomplete LU factorization (see Control [UMFPACK_ILU_DROPTOL]
+                and Control [UMFPACK_ILU_FILL] in umfpack_*_numeric).  The
+                Numeric object is not modified.
+
+            UMFPACK_ERROR_invalid_system
+
+                The matrix is rectangular, or umfpack_*_numeric found it to
+                be structurally singular.
+
+            UMFPACK_ERROR_invalid_matrix
+
+                The row indices in a column of A are not sorted, contain
+                duplicates, or are out of range.
+
+            UMFPACK_ERROR_different_pattern
+
+                The new matrix does not fit in the pattern of the LU factors
+                held in the Numeric object.  Use umfpack_*_numeric instead.
+
+        Info [UMFPACK_NROW], Info [UMFPACK_NCOL]:  the dimensions of A.
+
+        Info [UMFPACK_NZ]:  the number of entries in A.
+
+        Info [UMFPACK_RGROWTH]:  the reciprocal pivot growth,
+            min over all columns j of max (abs (R*A (:,j))) / max (abs (U (:,j))),
+            where the permutations are applied to A, and columns of U that are
+            entirely zero are skipped.  A value much smaller than one
+            indicates that the fixed pivot sequence was a poor choice for the
+            new values.
+
+        Info [UMFPACK_RCOND], Info [UMFPACK_UMIN], Info [UMFPACK_UMAX],
+        Info [UMFPACK_UDIAG_NZ], Info [UMFPACK_WAS_SCALED],
+        Info [UMFPACK_RSMIN], Info [UMFPACK_RSMAX], Info [UMFPACK_LNZ],
+        Info [UMFPACK_UNZ], Info [UMFPACK_FLOPS], Info [UMFPACK_NUMERIC_TIME],
+        Info [UMFPACK_NUMERIC_WALLTIME]:  as described in umfpack_*_numeric,
+            for the new factorization.  The flop count is that of the
+            refactorization.
+*/
+
+//==============================================================================
+//==== Matrix manipulation routines ============================================
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// umfpack_triplet_to_col
+//------------------------------------------------------------------------------
+
+int umfpack_di_triplet_to_col
+(
+    int32_t n_row,
+    int32_t n_col,
+    int32_t nz,
+    const int32_t Ti [ ],
+    const int32_t Tj [ ],
+    const double Tx [ ],
+    int32_t Ap [ ],
+    int32_t Ai [ ],
+    double Ax [ ],
+    int32_t Map [ ]
+) ;
+
+int umfpack_dl_triplet_to_col
+(
+    int64_t n_row,
+    int64_t n_col,
+    int64_t nz,
+    const int64_t Ti [ ],
+    const int64_t Tj [ ],
+    const double Tx [ ],
+    int64_t Ap [ ],
+    int64_t Ai [ ],
+    double Ax [ ],
+    int64_t Map [ ]
+) ;
+
+int umfpack_zi_triplet_to_col
 (
     int32_t n_row,
     int32_t n_col,
@@ -2621,6 +3663,12 @@ Purpose:
     The matrix may be singular (nz can be zero, and empty rows and/or columns
     may exist).  It may also be rectangular and/or complex.
 
+    If UMFPACK is compiled with OpenMP, the conversion is done in parallel
+    for large matrices, using up to omp_get_max_threads ( ) threads.  Each
+    thread needs an extra workspace of size max (n_row,n_col) integers.  The
+    output (A and Map) is the same for any number of threads, including the
+    order in which duplicates are summed.
+
 Returns:
 
     UMFPACK_OK if successful.
@@ -2953,11 +4001,16 @@ Purpose:
     A' or A.', by solving with the sys argument UMFPACK_At or UMFPACK_Aat,
     respectively, in umfpack_*_*solve.
 
+    If UMFPACK is compiled with OpenMP, the transpose is done in parallel for
+    large matrices, using up to omp_get_max_threads ( ) threads.  The output
+    is the same for any number of threads.
+
 Returns:
 
     UMFPACK_OK if successful.
     UMFPACK_ERROR_out_of_memory if umfpack_*_transpose fails to allocate a
-        size-max (n_row,n_col) workspace.
+        size-max (n_row,n_col) workspace (size n_row for each thread, if
+        more than one thread is used).
     UMFPACK_ERROR_argument_missing if Ai, Ap, Ri, and/or Rp are missing.
     UMFPACK_ERROR_n_nonpositive if n_row <= 0 or n_col <= 0
     UMFPACK_ERROR_invalid_permutation if P and/or Q are invalid.
@@ -3948,7 +5001,11 @@ complex int64_t Syntax:
 Purpose:
 
     Saves a Numeric object to a file, which can later be read by
-    umfpack_*_load_numeric.  The Numeric object is not modified.
+    umfpack_*_load_numeric or umfpack_*_load_numeric_mmap.  The Numeric
+    object is not modified.  The file holds the same bytes as the blob
+    created by umfpack_*_serialize_numeric, with each part aligned to a
+    multiple of 64 bytes.  Files written by earlier versions of UMFPACK, which
+    did not align the parts of the file, cannot be read by this version.
 
 Returns:
 
@@ -4031,12 +5088,16 @@ Purpose:
     Loads a Numeric object from a file created by umfpack_*_save_numeric.  The
     Numeric handle passed to this routine is overwritten with the new object.
     If that object exists prior to calling this routine, a memory leak will
-    occur.  The contents of Numeric are ignored on input.
+    occur.  The contents of Numeric are ignored on input.  See also
+    umfpack_*_load_numeric_mmap, which uses the file in place.
 
 Returns:
 
     UMFPACK_OK if successful.
     UMFPACK_ERROR_out_of_memory if not enough memory is available.
+    UMFPACK_ERROR_invalid_Numeric_object if the file does not hold a Numeric
+        object saved by this version of UMFPACK, for this platform and for the
+        same type (di, dl, zi, or zl).
     UMFPACK_ERROR_file_IO if an I/O error occurred.
 
 Arguments:
@@ -4055,6 +5116,105 @@ Arguments:
         object.
 */
 
+//------------------------------------------------------------------------------
+// umfpack_load_numeric_mmap
+//------------------------------------------------------------------------------
+
+int umfpack_di_load_numeric_mmap
+(
+    void **Numeric,
+    char *filename
+) ;
+
+int umfpack_dl_load_numeric_mmap
+(
+    void **Numeric,
+    char *filename
+) ;
+
+int umfpack_zi_load_numeric_mmap
+(
+    void **Numeric,
+    char *filename
+) ;
+
+int umfpack_zl_load_numeric_mmap
+(
+    void **Numeric,
+    char *filename
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    char *filename ;
+    void *Numeric ;
+    int status = umfpack_di_load_numeric_mmap (&Numeric, filename) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    char *filename ;
+    void *Numeric ;
+    int status = umfpack_dl_load_numeric_mmap (&Numeric, filename) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    char *filename ;
+    void *Numeric ;
+    int status = umfpack_zi_load_numeric_mmap (&Numeric, filename) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    char *filename ;
+    void *Numeric ;
+    int status = umfpack_zl_load_numeric_mmap (&Numeric, filename) ;
+
+Purpose:
+
+    Loads a Numeric object from a file created by umfpack_*_save_numeric,
+    like umfpack_*_load_numeric, except that the file is mapped into memory
+    (with mmap) and its contents are used in place rather than read into
+    newly allocated arrays.  The resulting Numeric object can be used by any
+    UMFPACK routine that takes a Numeric object.  Only a small header is
+    allocated, and the pages of the factors are read from the file only when
+    they are first used, so a large Numeric object can be loaded quickly and
+    with little memory.  The mapping is private:  the file is never modified,
+    even by umfpack_*_refactor (which modifies a copy of the pages it
+    changes).  The mapping is removed by umfpack_*_free_numeric.
+
+    The file must not be modified or truncated while the Numeric object is in
+    use.  On platforms without memory-mapped files (Windows), or if the file
+    cannot be mapped, this routine falls back to umfpack_*_load_numeric.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_out_of_memory if not enough memory is available.
+    UMFPACK_ERROR_invalid_Numeric_object if the file does not hold a Numeric
+        object saved by this version of UMFPACK, for this platform and for the
+        same type (di, dl, zi, or zl).
+    UMFPACK_ERROR_file_IO if an I/O error occurred.
+
+Arguments:
+
+    void **Numeric ;        Output argument.
+
+        **Numeric is the address of a (void *) pointer variable in the user's
+        calling routine (see Syntax, above).  On input, the contents of this
+        variable are not defined.  On output, this variable holds a (void *)
+        pointer to the Numeric object (if successful), or (void *) NULL if
+        a failure occurred.
+
+    char *filename ;        Input argument, not modified.
+
+        A string that contains the filename from which to read the Numeric
+        object.  If NULL, the default name "numeric.umf" is used.
+*/
+
 //------------------------------------------------------------------------------
 // umfpack_copy_numeric
 //------------------------------------------------------------------------------
@@ -4161,10 +5321,195 @@ int umfpack_zi_serialize_numeric_size
     void *Numeric               // input: Numeric object to serialize
 ) ;
 
-int umfpack_zl_serialize_numeric_size
+int umfpack_zl_serialize_numeric_size
+(
+    int64_t *blobsize,          // output: required size of blob
+    void *Numeric               // input: Numeric object to serialize
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    void *Numeric ;
+    int status = umfpack_di_serialize_numeric_size (&blobsize, Numeric) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    void *Numeric ;
+    int status = umfpack_dl_serialize_numeric_size (&blobsize, Numeric) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    void *Numeric ;
+    int status = umfpack_zi_serialize_numeric_size (&blobsize, Numeric) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    void *Numeric ;
+    int status = umfpack_zl_serialize_numeric_size (&blobsize, Numeric) ;
+
+Purpose:
+
+    Determines the required size of the serialized "blob" for the input to
+    umfpack_*_serialize_numeric.  The Numeric object is not modified.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_invalid_Numeric_object if Numeric is not valid.
+    UMFPACK_ERROR_argument_missing if blobsize is NULL.
+
+Arguments:
+
+    int64_t *blobsize ;     Output argument.
+
+        Required size of the blob to hold the Numeric object, in bytes.
+
+    void *Numeric ;         Input argument, not modified.
+
+        Numeric must point to a valid Numeric object, computed by
+        umfpack_*_numeric or created by umfpack_*_deserialize_numeric,
+        umfpack_*_load_numeric, or umfpack_*_copy_numeric.
+*/
+
+//------------------------------------------------------------------------------
+// umfpack_serialize_numeric
+//------------------------------------------------------------------------------
+
+int umfpack_di_serialize_numeric
+(
+    int8_t *blob,           // output: serialized blob of size blobsize,
+                            // allocated but unitialized on input.
+    int64_t blobsize,       // input: size of the blob
+    void *Numeric           // input: Numeric object to serialize
+) ;
+
+int umfpack_dl_serialize_numeric
+(
+    int8_t *blob,           // output: serialized blob of size blobsize,
+                            // allocated but unitialized on input.
+    int64_t blobsize,       // input: size of the blob
+    void *Numeric           // input: Numeric object to serialize
+) ;
+
+int umfpack_zi_serialize_numeric
+(
+    int8_t *blob,           // output: serialized blob of size blobsize,
+                            // allocated but unitialized on input.
+    int64_t blobsize,       // input: size of the blob
+    void *Numeric           // input: Numeric object to serialize
+) ;
+
+int umfpack_zl_serialize_numeric
+(
+    int8_t *blob,           // output: serialized blob of size blobsize,
+                            // allocated but unitialized on input.
+    int64_t blobsize,       // input: size of the blob
+    void *Numeric           // input: Numeric object to serialize
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_di_serialize_numeric (blob, blobsize, Numeric) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_dl_serialize_numeric (blob, blobsize, Numeric) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_zi_serialize_numeric (blob, blobsize, Numeric) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_zl_serialize_numeric (blob, blobsize, Numeric) ;
+
+Purpose:
+
+    Copies the contents of a Numeric object into the serialized "blob".
+    Numeric object is not modified.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_argument_missing if blob or Numeric are NULL.
+    UMFPACK_ERROR_invalid_Numeric_object if Numeric is not valid.
+    UMFPACK_ERROR_invalid_blob if blob is too small.
+
+Arguments:
+
+    int8_t *blob ;          Output  argument.
+
+        A user-allocated array of size blobsize.  On output, it contains the
+        serialized blob created from the Numeric object.
+
+    int64_t blobsize ;      Input argument, not modified.
+
+        Size of the blob, in bytes.  Must be at least as large as the
+        value returned by umfpack_*_serialize_numeric_size.
+
+    void *Numeric ;         Input argument, not modified.
+
+        Numeric must point to a valid Numeric object, computed by
+        umfpack_*_numeric or created by umfpack_*_deserialize_numeric,
+        umfpack_*_load_numeric, or umfpack_*_copy_numeric.
+*/
+
+//------------------------------------------------------------------------------
+// umfpack_serialize_numeric_compressed_size
+//------------------------------------------------------------------------------
+
+int umfpack_di_serialize_numeric_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Numeric,             // input: Numeric object to serialize
+    int method                  // input: compression method
+) ;
+
+int umfpack_dl_serialize_numeric_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Numeric,             // input: Numeric object to serialize
+    int method                  // input: compression method
+) ;
+
+int umfpack_zi_serialize_numeric_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Numeric,             // input: Numeric object to serialize
+    int method                  // input: compression method
+) ;
+
+int umfpack_zl_serialize_numeric_compressed_size
 (
-    int64_t *blobsize,          // output: required size of blob
-    void *Numeric               // input: Numeric object to serialize
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Numeric,             // input: Numeric object to serialize
+    int method                  // input: compression method
 ) ;
 
 /*
@@ -4172,34 +5517,43 @@ double int32_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_di_serialize_numeric_size (&blobsize, Numeric) ;
+    int status = umfpack_di_serialize_numeric_compressed_size (&blobsize,
+        Numeric, method) ;
 
 double int64_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_dl_serialize_numeric_size (&blobsize, Numeric) ;
+    int status = umfpack_dl_serialize_numeric_compressed_size (&blobsize,
+        Numeric, method) ;
 
 complex int32_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_zi_serialize_numeric_size (&blobsize, Numeric) ;
+    int status = umfpack_zi_serialize_numeric_compressed_size (&blobsize,
+        Numeric, method) ;
 
 complex int64_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_zl_serialize_numeric_size (&blobsize, Numeric) ;
+    int status = umfpack_zl_serialize_numeric_compressed_size (&blobsize,
+        Numeric, method) ;
 
 Purpose:
 
-    Determines the required size of the serialized "blob" for the input to
-    umfpack_*_serialize_numeric.  The Numeric object is not modified.
+    Determines an upper bound on the size of the compressed "blob" created by
+    umfpack_*_serialize_numeric_compressed.  The Numeric object is not
+    modified.
 
 Returns:
 
@@ -4211,49 +5565,77 @@ Arguments:
 
     int64_t *blobsize ;     Output argument.
 
-        Required size of the blob to hold the Numeric object, in bytes.
+        Upper bound on the size of the compressed blob, in bytes.
 
-    void *Numeric ;         Input argument, not modified.
+    void *Numeric ;      Input argument, not modified.
 
         Numeric must point to a valid Numeric object, computed by
         umfpack_*_numeric or created by umfpack_*_deserialize_numeric,
         umfpack_*_load_numeric, or umfpack_*_copy_numeric.
+
+    int method ;            Input argument, not modified.
+
+        The compression method, the same as for GxB_Matrix_serialize in
+        SuiteSparse:GraphBLAS:
+
+        UMFPACK_COMPRESSION_NONE (-1): no compression.
+        UMFPACK_COMPRESSION_DEFAULT (0): ZSTD, level 1.
+        UMFPACK_COMPRESSION_LZ4 (1000): LZ4.
+        UMFPACK_COMPRESSION_LZ4HC (2000): LZ4HC, level 9.
+        UMFPACK_COMPRESSION_ZSTD (3000): ZSTD, level 1.
+
+        A level can be added to the LZ4HC method (1 to 9) or the ZSTD method
+        (1 to 19); higher levels give smaller blobs but take more time.  For
+        example, use UMFPACK_COMPRESSION_ZSTD+5 for ZSTD at level 5.  A level
+        of zero or out of range gives the default level for that method.  An
+        unrecognized method (other than negative) gives the default method.
+        If UMFPACK is compiled without the compression libraries (with
+        -DUMFPACK_USE_COMPRESSION=OFF in CMake, which defines NCOMPRESSION),
+        all methods give no compression.
 */
 
 //------------------------------------------------------------------------------
-// umfpack_serialize_numeric
+// umfpack_serialize_numeric_compressed
 //------------------------------------------------------------------------------
 
-int umfpack_di_serialize_numeric
+int umfpack_di_serialize_numeric_compressed
 (
-    int8_t *blob,           // output: serialized blob of size blobsize,
-                            // allocated but unitialized on input.
-    int64_t blobsize,       // input: size of the blob
-    void *Numeric           // input: Numeric object to serialize
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Numeric,         // input: Numeric object to serialize
+    int method              // input: compression method
 ) ;
 
-int umfpack_dl_serialize_numeric
+int umfpack_dl_serialize_numeric_compressed
 (
-    int8_t *blob,           // output: serialized blob of size blobsize,
-                            // allocated but unitialized on input.
-    int64_t blobsize,       // input: size of the blob
-    void *Numeric           // input: Numeric object to serialize
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Numeric,         // input: Numeric object to serialize
+    int method              // input: compression method
 ) ;
 
-int umfpack_zi_serialize_numeric
+int umfpack_zi_serialize_numeric_compressed
 (
-    int8_t *blob,           // output: serialized blob of size blobsize,
-                            // allocated but unitialized on input.
-    int64_t blobsize,       // input: size of the blob
-    void *Numeric           // input: Numeric object to serialize
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Numeric,         // input: Numeric object to serialize
+    int method              // input: compression method
 ) ;
 
-int umfpack_zl_serialize_numeric
+int umfpack_zl_serialize_numeric_compressed
 (
-    int8_t *blob,           // output: serialized blob of size blobsize,
-                            // allocated but unitialized on input.
-    int64_t blobsize,       // input: size of the blob
-    void *Numeric           // input: Numeric object to serialize
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Numeric,         // input: Numeric object to serialize
+    int method              // input: compression method
 ) ;
 
 /*
@@ -4262,62 +5644,86 @@ double int32_t Syntax:
     #include "umfpack.h"
     int64_t blobsize ;
     int8_t *blob ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_di_serialize_numeric (blob, blobsize, Numeric) ;
+    int status = umfpack_di_serialize_numeric_compressed (blob, &blobsize,
+        Numeric, method) ;
 
 double int64_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
     int8_t *blob ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_dl_serialize_numeric (blob, blobsize, Numeric) ;
+    int status = umfpack_dl_serialize_numeric_compressed (blob, &blobsize,
+        Numeric, method) ;
 
 complex int32_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
     int8_t *blob ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_zi_serialize_numeric (blob, blobsize, Numeric) ;
+    int status = umfpack_zi_serialize_numeric_compressed (blob, &blobsize,
+        Numeric, method) ;
 
 complex int64_t Syntax:
 
     #include "umfpack.h"
     int64_t blobsize ;
     int8_t *blob ;
+    int method ;
     void *Numeric ;
-    int status = umfpack_zl_serialize_numeric (blob, blobsize, Numeric) ;
+    int status = umfpack_zl_serialize_numeric_compressed (blob, &blobsize,
+        Numeric, method) ;
 
 Purpose:
 
-    Copies the contents of a Numeric object into the serialized "blob".
-    Numeric object is not modified.
+    Serializes a Numeric object into a compressed "blob", which is typically
+    much smaller than the blob created by umfpack_*_serialize_numeric.  The
+    serialized Numeric object is split into blocks of 1MB, which are
+    compressed in parallel (if UMFPACK is compiled with OpenMP) with the LZ4
+    or ZSTD libraries included in UMFPACK (in UMFPACK/lz4 and UMFPACK/zstd).
+    The compressed blob can be read back by
+    umfpack_*_deserialize_numeric.  The Numeric object is not modified.
+
+    Workspace of the size returned by umfpack_*_serialize_numeric_size is
+    allocated, and freed on return.
 
 Returns:
 
     UMFPACK_OK if successful.
-    UMFPACK_ERROR_argument_missing if blob or Numeric are NULL.
+    UMFPACK_ERROR_argument_missing if blob, blobsize, or Numeric are NULL.
     UMFPACK_ERROR_invalid_Numeric_object if Numeric is not valid.
     UMFPACK_ERROR_invalid_blob if blob is too small.
+    UMFPACK_ERROR_out_of_memory if not enough memory is available.
 
 Arguments:
 
     int8_t *blob ;          Output  argument.
 
         A user-allocated array of size blobsize.  On output, it contains the
-        serialized blob created from the Numeric object.
+        compressed blob created from the Numeric object.
 
-    int64_t blobsize ;      Input argument, not modified.
+    int64_t *blobsize ;     Input/output argument.
 
-        Size of the blob, in bytes.  Must be at least as large as the
-        value returned by umfpack_*_serialize_numeric_size.
+        On input, the size of the blob, in bytes, which must be at least as
+        large as the value returned by
+        umfpack_*_serialize_numeric_compressed_size.  On output, the actual
+        size of the compressed blob.  The rest of the blob is not used, and
+        the blob may be reallocated to this smaller size.
 
-    void *Numeric ;         Input argument, not modified.
+    void *Numeric ;      Input argument, not modified.
 
         Numeric must point to a valid Numeric object, computed by
         umfpack_*_numeric or created by umfpack_*_deserialize_numeric,
         umfpack_*_load_numeric, or umfpack_*_copy_numeric.
+
+    int method ;            Input argument, not modified.
+
+        The compression method; see umfpack_*_serialize_numeric_compressed_size.
 */
 
 //------------------------------------------------------------------------------
@@ -4388,7 +5794,11 @@ complex int64_t Syntax:
 Purpose:
 
     Constructs a new Numeric object from the serialized "blob".
-    The blob is not modified.
+    The blob is not modified.  See also umfpack_*_deserialize_numeric_view,
+    which uses the blob in place instead of copying it.  If the blob was
+    created by umfpack_*_serialize_numeric_compressed, it is first
+    decompressed into workspace of size umfpack_*_serialize_numeric_size,
+    which is freed on return.
 
 Returns:
 
@@ -4409,7 +5819,125 @@ Arguments:
     int8_t *blob ;          Input argument, not modified.
 
         A user-allocated array of size blobsize containing a blob created
-        by umfpack_*_serialize_numeric.
+        by umfpack_*_serialize_numeric or umfpack_*_serialize_numeric_compressed.
+
+    int64_t blobsize ;      Input argument, not modified.
+
+        Size of the blob, in bytes.
+*/
+
+//------------------------------------------------------------------------------
+// umfpack_deserialize_numeric_view
+//------------------------------------------------------------------------------
+
+int umfpack_di_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object using the blob in place
+    int8_t *blob,           // input: serialized blob, used in place
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+int umfpack_dl_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object using the blob in place
+    int8_t *blob,           // input: serialized blob, used in place
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+int umfpack_zi_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object using the blob in place
+    int8_t *blob,           // input: serialized blob, used in place
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+int umfpack_zl_deserialize_numeric_view
+(
+    void **Numeric,         // output: Numeric object using the blob in place
+    int8_t *blob,           // input: serialized blob, used in place
+    int64_t blobsize        // size of the blob in bytes
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_di_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_dl_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_zi_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    void *Numeric ;
+    int status = umfpack_zl_deserialize_numeric_view (&Numeric, blob,
+        blobsize) ;
+
+Purpose:
+
+    Constructs a new Numeric object from the serialized "blob", like
+    umfpack_*_deserialize_numeric, except that the contents of the blob are
+    not copied.  Instead, the arrays of the Numeric object point into the
+    blob itself; only a small header is allocated.  Each part of the blob is
+    aligned to a multiple of 64 bytes from its start, so the blob must be
+    aligned to at least sizeof (double) bytes (any pointer returned by malloc
+    is suitable).
+
+    The blob must not be freed or modified until the Numeric object is freed
+    by umfpack_*_free_numeric (which does not free the blob).  The blob is
+    not modified by this routine, nor by umfpack_*_solve or any other routine
+    that only reads the Numeric object, so a single blob can be shared by
+    many threads or processes.  However, umfpack_*_refactor modifies the
+    Numeric object in place, and thus the contents of the blob.  A
+    compressed blob, created by umfpack_*_serialize_numeric_compressed,
+    cannot be used in place.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_argument_missing if blob or Numeric are NULL.
+    UMFPACK_ERROR_invalid_Numeric_object if Numeric is not valid.
+    UMFPACK_ERROR_invalid_blob if blob is too small, not suitably aligned, or
+        not created by umfpack_*_serialize_numeric for this version of
+        UMFPACK.
+    UMFPACK_ERROR_out_of_memory if not enough memory is available.
+
+Arguments:
+
+    void **Numeric ;        Output argument.
+
+        On input, the contents of this variable are not defined.  On output,
+        this variable holds a (void *) pointer to the Numeric object (if
+        successful), or (void *) NULL if a failure occurred.
+
+    int8_t *blob ;          Input argument, used in place by the Numeric
+                            object.
+
+        A user-allocated array of size blobsize containing a blob created
+        by umfpack_*_serialize_numeric (or the contents of a file written by
+        umfpack_*_save_numeric).
 
     int64_t blobsize ;      Input argument, not modified.
 
@@ -4848,6 +6376,252 @@ Arguments:
         umfpack_*_load_symbolic, or umfpack_*_copy_symbolic.
 */
 
+//------------------------------------------------------------------------------
+// umfpack_serialize_symbolic_compressed_size
+//------------------------------------------------------------------------------
+
+int umfpack_di_serialize_symbolic_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Symbolic,            // input: Symbolic object to serialize
+    int method                  // input: compression method
+) ;
+
+int umfpack_dl_serialize_symbolic_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Symbolic,            // input: Symbolic object to serialize
+    int method                  // input: compression method
+) ;
+
+int umfpack_zi_serialize_symbolic_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Symbolic,            // input: Symbolic object to serialize
+    int method                  // input: compression method
+) ;
+
+int umfpack_zl_serialize_symbolic_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *Symbolic,            // input: Symbolic object to serialize
+    int method                  // input: compression method
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_di_serialize_symbolic_compressed_size (&blobsize,
+        Symbolic, method) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_dl_serialize_symbolic_compressed_size (&blobsize,
+        Symbolic, method) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_zi_serialize_symbolic_compressed_size (&blobsize,
+        Symbolic, method) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_zl_serialize_symbolic_compressed_size (&blobsize,
+        Symbolic, method) ;
+
+Purpose:
+
+    Determines an upper bound on the size of the compressed "blob" created by
+    umfpack_*_serialize_symbolic_compressed.  The Symbolic object is not
+    modified.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_invalid_Symbolic_object if Symbolic is not valid.
+    UMFPACK_ERROR_argument_missing if blobsize is NULL.
+
+Arguments:
+
+    int64_t *blobsize ;     Output argument.
+
+        Upper bound on the size of the compressed blob, in bytes.
+
+    void *Symbolic ;     Input argument, not modified.
+
+        Symbolic must point to a valid Symbolic object, computed by
+        umfpack_*_symbolic or created by umfpack_*_deserialize_symbolic,
+        umfpack_*_load_symbolic, or umfpack_*_copy_symbolic.
+
+    int method ;            Input argument, not modified.
+
+        The compression method, the same as for GxB_Matrix_serialize in
+        SuiteSparse:GraphBLAS:
+
+        UMFPACK_COMPRESSION_NONE (-1): no compression.
+        UMFPACK_COMPRESSION_DEFAULT (0): ZSTD, level 1.
+        UMFPACK_COMPRESSION_LZ4 (1000): LZ4.
+        UMFPACK_COMPRESSION_LZ4HC (2000): LZ4HC, level 9.
+        UMFPACK_COMPRESSION_ZSTD (3000): ZSTD, level 1.
+
+        A level can be added to the LZ4HC method (1 to 9) or the ZSTD method
+        (1 to 19); higher levels give smaller blobs but take more time.  For
+        example, use UMFPACK_COMPRESSION_ZSTD+5 for ZSTD at level 5.  A level
+        of zero or out of range gives the default level for that method.  An
+        unrecognized method (other than negative) gives the default method.
+        If UMFPACK is compiled without the compression libraries (with
+        -DUMFPACK_USE_COMPRESSION=OFF in CMake, which defines NCOMPRESSION),
+        all methods give no compression.
+*/
+
+//------------------------------------------------------------------------------
+// umfpack_serialize_symbolic_compressed
+//------------------------------------------------------------------------------
+
+int umfpack_di_serialize_symbolic_compressed
+(
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Symbolic,        // input: Symbolic object to serialize
+    int method              // input: compression method
+) ;
+
+int umfpack_dl_serialize_symbolic_compressed
+(
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Symbolic,        // input: Symbolic object to serialize
+    int method              // input: compression method
+) ;
+
+int umfpack_zi_serialize_symbolic_compressed
+(
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Symbolic,        // input: Symbolic object to serialize
+    int method              // input: compression method
+) ;
+
+int umfpack_zl_serialize_symbolic_compressed
+(
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *Symbolic,        // input: Symbolic object to serialize
+    int method              // input: compression method
+) ;
+
+/*
+double int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_di_serialize_symbolic_compressed (blob, &blobsize,
+        Symbolic, method) ;
+
+double int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_dl_serialize_symbolic_compressed (blob, &blobsize,
+        Symbolic, method) ;
+
+complex int32_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_zi_serialize_symbolic_compressed (blob, &blobsize,
+        Symbolic, method) ;
+
+complex int64_t Syntax:
+
+    #include "umfpack.h"
+    int64_t blobsize ;
+    int8_t *blob ;
+    int method ;
+    void *Symbolic ;
+    int status = umfpack_zl_serialize_symbolic_compressed (blob, &blobsize,
+        Symbolic, method) ;
+
+Purpose:
+
+    Serializes a Symbolic object into a compressed "blob", which is typically
+    much smaller than the blob created by umfpack_*_serialize_symbolic.  The
+    serialized Symbolic object is split into blocks of 1MB, which are
+    compressed in parallel (if UMFPACK is compiled with OpenMP) with the LZ4
+    or ZSTD libraries included in UMFPACK (in UMFPACK/lz4 and UMFPACK/zstd).
+    The compressed blob can be read back by
+    umfpack_*_deserialize_symbolic.  The Symbolic object is not modified.
+
+    Workspace of the size returned by umfpack_*_serialize_symbolic_size is
+    allocated, and freed on return.
+
+Returns:
+
+    UMFPACK_OK if successful.
+    UMFPACK_ERROR_argument_missing if blob, blobsize, or Symbolic are NULL.
+    UMFPACK_ERROR_invalid_Symbolic_object if Symbolic is not valid.
+    UMFPACK_ERROR_invalid_blob if blob is too small.
+    UMFPACK_ERROR_out_of_memory if not enough memory is available.
+
+Arguments:
+
+    int8_t *blob ;          Output  argument.
+
+        A user-allocated array of size blobsize.  On output, it contains the
+        compressed blob created from the Symbolic object.
+
+    int64_t *blobsize ;     Input/output argument.
+
+        On input, the size of the blob, in bytes, which must be at least as
+        large as the value returned by
+        umfpack_*_serialize_symbolic_compressed_size.  On output, the actual
+        size of the compressed blob.  The rest of the blob is not used, and
+        the blob may be reallocated to this smaller size.
+
+    void *Symbolic ;     Input argument, not modified.
+
+        Symbolic must point to a valid Symbolic object, computed by
+        umfpack_*_symbolic or created by umfpack_*_deserialize_symbolic,
+        umfpack_*_load_symbolic, or umfpack_*_copy_symbolic.
+
+    int method ;            Input argument, not modified.
+
+        The compression method; see umfpack_*_serialize_symbolic_compressed_size.
+*/
+
 //------------------------------------------------------------------------------
 // umfpack_deserialize_symbolic
 //------------------------------------------------------------------------------
@@ -4916,7 +6690,10 @@ complex int64_t Syntax:
 Purpose:
 
     Constructs a new Symbolic object from the serialized "blob".
-    The blob is not modified.
+    The blob is not modified.  If the blob was created by
+    umfpack_*_serialize_symbolic_compressed, it is first decompressed into
+    workspace of size umfpack_*_serialize_symbolic_size, which is freed on
+    return.
 
 Returns:
 
@@ -4937,7 +6714,7 @@ Arguments:
     int8_t *blob ;          Input argument, not modified.
 
         A user-allocated array of size blobsize containing a blob created
-        by umfpack_*_serialize_symbolic.
+        by umfpack_*_serialize_symbolic or umfpack_*_serialize_symbolic_compressed.
 
     int64_t blobsize ;      Input argument, not modified.
 
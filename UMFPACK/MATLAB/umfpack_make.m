@@ -127,7 +127,7 @@ end
 %-------------------------------------------------------------------------------
 
 % non-user-callable umf_*.[ch] files:
-umfch = { 'assemble', 'blas3_update', ...
+umfch = { 'assemble', 'blas3_update', 'blob', ...
         'build_tuples', 'create_element', ...
         'dump', 'extend_front', 'garbage_collection', ...
         'get_memory', 'init_front', 'kernel', ...
@@ -135,7 +135,7 @@ umfch = { 'assemble', 'blas3_update', ...
         'local_search', 'lsolve', 'ltsolve', ...
         'mem_alloc_element', 'mem_alloc_head_block', ...
         'mem_alloc_tail_block', 'mem_free_tail_block', ...
-        'mem_init_memoryspace', ...
+        'mem_init_memoryspace', 'msolve', 'parallel_numeric', ...
         'report_vector', 'row_search', 'scale_column', ...
         'set_stats', 'solve', 'symbolic_usage', 'transpose', ...
         'tuple_lengths', 'usolve', 'utsolve', 'valid_numeric', ...
@@ -154,11 +154,11 @@ amdsrc = { 'aat', '1', '2', 'dump', 'postorder', 'post_tree', 'defaults', ...
 % user-callable umfpack_*.[ch] files (real/complex):
 user = { 'col_to_triplet', 'defaults', 'free_numeric', ...
         'free_symbolic', 'get_numeric', 'get_lunz', ...
-        'get_symbolic', 'get_determinant', 'numeric', 'qsymbolic', ...
+        'get_symbolic', 'get_determinant', 'numeric', 'refactor', 'qsymbolic', ...
         'report_control', 'report_info', 'report_matrix', ...
         'report_numeric', 'report_perm', 'report_status', ...
         'report_symbolic', 'report_triplet', ...
-        'report_vector', 'solve', 'symbolic', ...
+        'report_vector', 'solve', 'msolve', 'symbolic', ...
         'transpose', 'triplet_to_col', 'scale' ...
 	'load_numeric', 'save_numeric', 'load_symbolic', 'save_symbolic' } ;
 
@@ -370,6 +370,11 @@ for k = 1:length(generic)
 	umfdir, kk, details) ;
 end
 
+% compressed serialization, only one version.  The MATLAB interface does not
+% use it, so LZ4 and ZSTD are not compiled.
+[M, kk] = make (M, '%s -DNCOMPRESSION -c %sumf_%s.c', 'umf_%s.%s', ...
+    'umf_%s_%s.%s', mx, 'compress', 'compress', 'm', obj, umfdir, kk, details) ;
+
 %----------------------------------------
 % AMD routines (long only)
 %----------------------------------------
@@ -10,6 +10,86 @@
 #include "umf_internal.h"
 #include "umf_blas3_update.h"
 
+/* ========================================================================== */
+/* === ilu_drop ============================================================= */
+/* ========================================================================== */
+
+/* Incomplete LU: drop entries of a column of L or row of U before it is used
+ * to update the contribution block.  Entries with magnitude <= tol are set to
+ * zero, and if lfil > 0, only the lfil largest entries are kept.  The zeros
+ * are then removed from the pattern by UMF_store_lu_drop.  The threshold for
+ * lfil is found by bisection on the magnitudes, so no workspace is needed. */
+
+PRIVATE void ilu_drop
+(
+    Int len,
+    Entry X [ ],
+    double tol,
+    Int lfil
+)
+{
+    double s, smax, lo, hi, t ;
+    Int i, cnt, iter ;
+
+    smax = 0 ;
+    cnt = 0 ;
+    for (i = 0 ; i < len ; i++)
+    {
+	APPROX_ABS (s, X [i]) ;
+	if (s <= tol)
+	{
+	    CLEAR (X [i]) ;
+	}
+	else
+	{
+	    smax = MAX (smax, s) ;
+	    cnt++ ;
+	}
+    }
+
+    if (lfil <= 0 || cnt <= lfil)
+    {
+	return ;
+    }
+
+    /* find t so that no more than lfil entries have magnitude > t */
+    lo = tol ;
+    hi = smax ;
+    for (iter = 0 ; iter < 40 && lo < hi ; iter++)
+    {
+	t = (lo + hi) / 2 ;
+	if (t <= lo || t >= hi) break ;
+	cnt = 0 ;
+	for (i = 0 ; i < len ; i++)
+	{
+	    APPROX_ABS (s, X [i]) ;
+	    cnt += (s > t) ;
+	}
+	if (cnt > lfil)
+	{
+	    lo = t ;
+	}
+	else
+	{
+	    hi = t ;
+	    if (cnt == lfil) break ;
+	}
+    }
+
+    for (i = 0 ; i < len ; i++)
+    {
+	APPROX_ABS (s, X [i]) ;
+	if (s <= hi)
+	{
+	    CLEAR (X [i]) ;
+	}
+    }
+}
+
+/* ========================================================================== */
+/* === UMF_blas3_update ===================================================== */
+/* ========================================================================== */
+
 void UMF_blas3_update
 (
     WorkType *Work
@@ -57,9 +137,26 @@ void UMF_blas3_update
     DEBUG7 (("LU block: ")) ; UMF_dump_dense (LU, nb, k, k) ;
 #endif
 
+    if (Work->ilu)
+    {
+	/* incomplete LU: drop small entries in the new columns of L */
+	for (s = 0 ; s < k ; s++)
+	{
+	    ilu_drop (m, L + s*d, Work->ilu_droptol, Work->ilu_fill) ;
+	}
+    }
+
     if (k == 1)
     {
 
+	if (Work->ilu)
+	{
+	    /* drop small entries in the new row of U, relative to the pivot */
+	    double upiv ;
+	    APPROX_ABS (upiv, LU [0]) ;
+	    ilu_drop (n, U, Work->ilu_droptol * upiv, Work->ilu_fill) ;
+	}
+
 #ifndef NBLAS
 	BLAS_GER (m, n, L, U, C, d, blas_ok) ;
         if (sizeof (SUITESPARSE_BLAS_INT) < sizeof (Int) && !blas_ok)
@@ -122,6 +219,17 @@ void UMF_blas3_update
 	    }
 	}
 
+	if (Work->ilu)
+	{
+	    /* drop small entries in the new rows of U, relative to the pivots */
+	    for (s = 0 ; s < k ; s++)
+	    {
+		double upiv ;
+		APPROX_ABS (upiv, LU [s+s*nb]) ;
+		ilu_drop (n, U + s*dc, Work->ilu_droptol * upiv, Work->ilu_fill) ;
+	    }
+	}
+
 	/* rank-k outer product to update the C block */
 	/* C = C - L*U' (U is stored by rows, not columns) */
 
@@ -0,0 +1,259 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_blob: layout of a serialized Numeric object
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Helper routines for the serialized form of a Numeric object, shared by
+    UMFPACK_serialize_numeric, UMFPACK_deserialize_numeric,
+    UMFPACK_deserialize_numeric_view, UMFPACK_save_numeric,
+    UMFPACK_load_numeric, UMFPACK_load_numeric_mmap, and UMFPACK_free_numeric.
+    See umf_blob.h for a description of the layout.
+
+    The header holds the following, in order:
+
+	int64_t required	size of the whole blob, in bytes
+	int32_t valid		NUMERIC_VALID
+	int32_t version [3]	UMFPACK main, sub, and subsub version
+	int32_t sizes [6]	sizeof NumericType, Entry, Int, Unit, double,
+				and void *
+	int32_t format		UMF_BLOB_FORMAT
+	int32_t align		UMF_BLOB_ALIGN
+
+    and is padded with zeros to UMF_BLOB_HEADER bytes.
+*/
+
+/* for open, fstat, mmap, and munmap when compiled with -std=c11 */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "umf_internal.h"
+#include "umf_blob.h"
+
+#if !defined (UMF_WINDOWS) && !defined (UMF_MINGW)
+/* memory-mapped files are available */
+#define UMF_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define NHEADER 12
+
+/* ========================================================================== */
+/* === UMF_numeric_blobsize ================================================= */
+/* ========================================================================== */
+
+/* Returns the size of the serialized Numeric object, in bytes.  Only the
+ * scalar components of the Numeric object are used. */
+
+int64_t UMF_numeric_blobsize
+(
+    const NumericType *Numeric
+)
+{
+    int64_t size, npiv1, n_inner ;
+    npiv1 = Numeric->npiv + 1 ;
+    n_inner = MIN (Numeric->n_row, Numeric->n_col) ;
+
+    /* header and the Numeric struct */
+    size = UMF_BLOB_PREFIX ;
+
+    /* D, Rperm, and Cperm */
+    size += UMF_BLOB_PAD ((n_inner+1) * sizeof (Entry)) ;
+    size += UMF_BLOB_PAD ((Numeric->n_row+1) * sizeof (Int)) ;
+    size += UMF_BLOB_PAD ((Numeric->n_col+1) * sizeof (Int)) ;
+
+    /* Lpos, Lilen, Lip, Upos, Uilen, and Uip */
+    size += 6 * UMF_BLOB_PAD (npiv1 * sizeof (Int)) ;
+
+    /* Rs, if present */
+    if (Numeric->scale != UMFPACK_SCALE_NONE)
+    {
+	size += UMF_BLOB_PAD (Numeric->n_row * sizeof (double)) ;
+    }
+
+    /* Upattern, if present */
+    if (Numeric->ulen > 0)
+    {
+	size += UMF_BLOB_PAD ((Numeric->ulen+1) * sizeof (Int)) ;
+    }
+
+    /* Memory */
+    size += UMF_BLOB_PAD (Numeric->size * sizeof (Unit)) ;
+    return (size) ;
+}
+
+/* ========================================================================== */
+/* === UMF_numeric_blob_header ============================================== */
+/* ========================================================================== */
+
+/* Writes the header of a serialized Numeric object of size blobsize. */
+
+void UMF_numeric_blob_header
+(
+    int8_t header [UMF_BLOB_HEADER],
+    int64_t blobsize
+)
+{
+    int32_t h [NHEADER] ;
+    h [0]  = NUMERIC_VALID ;		    /* tag as a Numeric object */
+    h [1]  = UMFPACK_MAIN_VERSION ;	    /* guard against version changes */
+    h [2]  = UMFPACK_SUB_VERSION ;
+    h [3]  = UMFPACK_SUBSUB_VERSION ;
+    h [4]  = sizeof (NumericType) ;	    /* size of Numeric header */
+    h [5]  = sizeof (Entry) ;		    /* double or double complex */
+    h [6]  = sizeof (Int) ;		    /* Int is int32_t or int64_t */
+    h [7]  = sizeof (Unit) ;
+    h [8]  = sizeof (double) ;
+    h [9]  = sizeof (void *) ;		    /* 32-bit vs 64-bit OS */
+    h [10] = UMF_BLOB_FORMAT ;		    /* layout of the blob */
+    h [11] = UMF_BLOB_ALIGN ;
+    memset (header, 0, UMF_BLOB_HEADER) ;
+    memcpy (header, &blobsize, sizeof (int64_t)) ;
+    memcpy (header + sizeof (int64_t), h, NHEADER * sizeof (int32_t)) ;
+}
+
+/* ========================================================================== */
+/* === UMF_numeric_blob_check =============================================== */
+/* ========================================================================== */
+
+/* Checks the first UMF_BLOB_PREFIX bytes of a serialized Numeric object of
+ * size blobsize, and copies its NumericType struct into *Numeric.  The
+ * pointers in *Numeric are set to NULL.  Returns UMFPACK_OK if the prefix
+ * describes a valid Numeric object of no more than blobsize bytes, and
+ * UMFPACK_ERROR_invalid_blob or UMFPACK_ERROR_invalid_Numeric_object
+ * otherwise. */
+
+Int UMF_numeric_blob_check
+(
+    const int8_t prefix [ ],
+    int64_t blobsize,
+    NumericType *Numeric
+)
+{
+    int64_t required ;
+    int32_t h [NHEADER] ;
+
+    if (blobsize < UMF_BLOB_PREFIX)
+    {
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+    memcpy (&required, prefix, sizeof (int64_t)) ;
+    memcpy (h, prefix + sizeof (int64_t), NHEADER * sizeof (int32_t)) ;
+
+    if (required > blobsize || h [0] != NUMERIC_VALID
+	|| h [4] != (int32_t) sizeof (NumericType)
+	|| h [5] != (int32_t) sizeof (Entry)
+	|| h [6] != (int32_t) sizeof (Int)
+	|| h [7] != (int32_t) sizeof (Unit)
+	|| h [8] != (int32_t) sizeof (double)
+	|| h [9] != (int32_t) sizeof (void *)
+	|| h [10] != UMF_BLOB_FORMAT
+	|| h [11] != UMF_BLOB_ALIGN)
+    {
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    /* get the Numeric struct */
+    memcpy (Numeric, prefix + UMF_BLOB_HEADER, sizeof (NumericType)) ;
+    Numeric->D        = (Entry *) NULL ;
+    Numeric->Rperm    = (Int *) NULL ;
+    Numeric->Cperm    = (Int *) NULL ;
+    Numeric->Lpos     = (Int *) NULL ;
+    Numeric->Lilen    = (Int *) NULL ;
+    Numeric->Lip      = (Int *) NULL ;
+    Numeric->Upos     = (Int *) NULL ;
+    Numeric->Uilen    = (Int *) NULL ;
+    Numeric->Uip      = (Int *) NULL ;
+    Numeric->Rs       = (double *) NULL ;
+    Numeric->Memory   = (Unit *) NULL ;
+    Numeric->Upattern = (Int *) NULL ;
+    Numeric->view     = FALSE ;
+    Numeric->map      = NULL ;
+    Numeric->mapsize  = 0 ;
+
+    if (Numeric->valid != NUMERIC_VALID || Numeric->n_row <= 0 ||
+	Numeric->n_col <= 0 || Numeric->npiv < 0 || Numeric->ulen < 0 ||
+	Numeric->size <= 0)
+    {
+	/* the blob does not contain a valid Numeric object */
+	return (UMFPACK_ERROR_invalid_Numeric_object) ;
+    }
+
+    /* the arrays must match the size recorded in the header */
+    if (UMF_numeric_blobsize (Numeric) != required)
+    {
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+    return (UMFPACK_OK) ;
+}
+
+/* ========================================================================== */
+/* === UMF_numeric_map ====================================================== */
+/* ========================================================================== */
+
+/* Maps a file into memory, and returns a pointer to the start of the mapping
+ * and its size.  The mapping is private (copy-on-write), so the file is never
+ * modified.  Returns NULL if the file cannot be opened or mapped, or if
+ * memory-mapped files are not available on this platform. */
+
+void *UMF_numeric_map
+(
+    const char *filename,
+    int64_t *mapsize
+)
+{
+    void *map = NULL ;
+    *mapsize = 0 ;
+#ifdef UMF_MMAP
+    struct stat st ;
+    int fd = open (filename, O_RDONLY) ;
+    if (fd < 0)
+    {
+	return (NULL) ;
+    }
+    if (fstat (fd, &st) == 0 && st.st_size > 0)
+    {
+	map = mmap (NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE,
+	    MAP_PRIVATE, fd, 0) ;
+	if (map == MAP_FAILED)
+	{
+	    map = NULL ;
+	}
+	else
+	{
+	    *mapsize = (int64_t) st.st_size ;
+	}
+    }
+    /* the mapping remains valid after the file is closed */
+    close (fd) ;
+#endif
+    return (map) ;
+}
+
+/* ========================================================================== */
+/* === UMF_numeric_unmap ==================================================== */
+/* ========================================================================== */
+
+/* Unmaps a file mapped by UMF_numeric_map.  Does nothing if map is NULL. */
+
+void UMF_numeric_unmap
+(
+    void *map,
+    int64_t mapsize
+)
+{
+#ifdef UMF_MMAP
+    if (map != NULL)
+    {
+	(void) munmap (map, (size_t) mapsize) ;
+    }
+#endif
+}
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_blob.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/* A serialized Numeric object (a blob, or a file written by
+ * UMFPACK_save_numeric) consists of a header of UMF_BLOB_HEADER bytes,
+ * followed by the NumericType struct and then each of its arrays.  Each part
+ * starts at a multiple of UMF_BLOB_ALIGN bytes from the start of the blob, so
+ * that the arrays can be used in place if the blob itself is suitably aligned
+ * (see UMFPACK_deserialize_numeric_view and UMFPACK_load_numeric_mmap). */
+
+/* version of the layout, changed if the layout below changes */
+#define UMF_BLOB_FORMAT 2
+
+/* alignment of each part of the blob, in bytes */
+#define UMF_BLOB_ALIGN 64
+
+/* x rounded up to a multiple of UMF_BLOB_ALIGN */
+#define UMF_BLOB_PAD(x) \
+    ((((int64_t) (x) + UMF_BLOB_ALIGN - 1) / UMF_BLOB_ALIGN) * UMF_BLOB_ALIGN)
+
+/* size of the header */
+#define UMF_BLOB_HEADER UMF_BLOB_ALIGN
+
+/* size of the header and the NumericType struct that follows it */
+#define UMF_BLOB_PREFIX (UMF_BLOB_HEADER + UMF_BLOB_PAD (sizeof (NumericType)))
+
+int64_t UMF_numeric_blobsize
+(
+    const NumericType *Numeric
+) ;
+
+void UMF_numeric_blob_header
+(
+    int8_t header [UMF_BLOB_HEADER],
+    int64_t blobsize
+) ;
+
+Int UMF_numeric_blob_check
+(
+    const int8_t prefix [ ],
+    int64_t blobsize,
+    NumericType *Numeric
+) ;
+
+void *UMF_numeric_map
+(
+    const char *filename,
+    int64_t *mapsize
+) ;
+
+void UMF_numeric_unmap
+(
+    void *map,
+    int64_t mapsize
+) ;
@@ -23,7 +23,7 @@
 #include "cholmod.h"
 #endif
 
-#if defined (DINT) || defined (ZINT)
+#if defined (DINT) || defined (ZINT) || defined (SINT) || defined (CINT)
 #define CHOLMOD_start       cholmod_start
 #define CHOLMOD_transpose   cholmod_transpose
 #define CHOLMOD_analyze     cholmod_analyze
@@ -0,0 +1,576 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_codec.h: LZ4 and ZSTD, renamed for use in UMFPACK
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/* UMFPACK includes its own copies of the LZ4 and ZSTD libraries, in
+ * UMFPACK/lz4 and UMFPACK/zstd, which umf_lz4.c and umf_zstd.c compile into
+ * UMFPACK itself.  They use the SuiteSparse memory manager in place of malloc,
+ * calloc, and free.  To avoid any conflict with other copies of these
+ * libraries (in GraphBLAS, or -llz4 and -lzstd linked in by the user
+ * application), every global symbol x that they define is renamed umf_x by
+ * the definitions below.
+ *
+ * If NCOMPRESSION is defined, these libraries are not used, and only the
+ * UMFPACK_COMPRESSION_NONE method is available (see umf_compress.c). */
+
+#ifndef UMF_CODEC_H
+#define UMF_CODEC_H
+
+#ifndef NCOMPRESSION
+
+#define UMF_CAT2(x,y) x ## y
+#define UMF_EVAL2(x,y) UMF_CAT2 (x,y)
+#define UMF_CODEC(x) UMF_EVAL2 (umf_, x)
+
+/* -------------------------------------------------------------------------- */
+/* LZ4 */
+/* -------------------------------------------------------------------------- */
+
+/* LZ4 uses LZ4_malloc, LZ4_calloc, and LZ4_free, defined in umf_lz4.c */
+#define LZ4_USER_MEMORY_FUNCTIONS
+#define LZ4_malloc UMF_CODEC (LZ4_malloc)
+#define LZ4_calloc UMF_CODEC (LZ4_calloc)
+#define LZ4_free UMF_CODEC (LZ4_free)
+void *LZ4_malloc (size_t s) ;
+void *LZ4_calloc (size_t n, size_t s) ;
+void LZ4_free (void *p) ;
+
+#define LZ4_attach_HC_dictionary UMF_CODEC (LZ4_attach_HC_dictionary)
+#define LZ4_attach_dictionary UMF_CODEC (LZ4_attach_dictionary)
+#define LZ4_compress UMF_CODEC (LZ4_compress)
+#define LZ4_compressBound UMF_CODEC (LZ4_compressBound)
+#define LZ4_compressHC UMF_CODEC (LZ4_compressHC)
+#define LZ4_compressHC2 UMF_CODEC (LZ4_compressHC2)
+#define LZ4_compressHC2_continue UMF_CODEC (LZ4_compressHC2_continue)
+#define LZ4_compressHC2_limitedOutput UMF_CODEC (LZ4_compressHC2_limitedOutput)
+#define LZ4_compressHC2_limitedOutput_continue \
+    UMF_CODEC (LZ4_compressHC2_limitedOutput_continue)
+#define LZ4_compressHC2_limitedOutput_withStateHC \
+    UMF_CODEC (LZ4_compressHC2_limitedOutput_withStateHC)
+#define LZ4_compressHC2_withStateHC UMF_CODEC (LZ4_compressHC2_withStateHC)
+#define LZ4_compressHC_continue UMF_CODEC (LZ4_compressHC_continue)
+#define LZ4_compressHC_limitedOutput UMF_CODEC (LZ4_compressHC_limitedOutput)
+#define LZ4_compressHC_limitedOutput_continue \
+    UMF_CODEC (LZ4_compressHC_limitedOutput_continue)
+#define LZ4_compressHC_limitedOutput_withStateHC \
+    UMF_CODEC (LZ4_compressHC_limitedOutput_withStateHC)
+#define LZ4_compressHC_withStateHC UMF_CODEC (LZ4_compressHC_withStateHC)
+#define LZ4_compress_HC UMF_CODEC (LZ4_compress_HC)
+#define LZ4_compress_HC_continue UMF_CODEC (LZ4_compress_HC_continue)
+#define LZ4_compress_HC_continue_destSize \
+    UMF_CODEC (LZ4_compress_HC_continue_destSize)
+#define LZ4_compress_HC_destSize UMF_CODEC (LZ4_compress_HC_destSize)
+#define LZ4_compress_HC_extStateHC UMF_CODEC (LZ4_compress_HC_extStateHC)
+#define LZ4_compress_HC_extStateHC_fastReset \
+    UMF_CODEC (LZ4_compress_HC_extStateHC_fastReset)
+#define LZ4_compress_continue UMF_CODEC (LZ4_compress_continue)
+#define LZ4_compress_default UMF_CODEC (LZ4_compress_default)
+#define LZ4_compress_destSize UMF_CODEC (LZ4_compress_destSize)
+#define LZ4_compress_fast UMF_CODEC (LZ4_compress_fast)
+#define LZ4_compress_fast_continue UMF_CODEC (LZ4_compress_fast_continue)
+#define LZ4_compress_fast_extState UMF_CODEC (LZ4_compress_fast_extState)
+#define LZ4_compress_fast_extState_fastReset \
+    UMF_CODEC (LZ4_compress_fast_extState_fastReset)
+#define LZ4_compress_forceExtDict UMF_CODEC (LZ4_compress_forceExtDict)
+#define LZ4_compress_limitedOutput UMF_CODEC (LZ4_compress_limitedOutput)
+#define LZ4_compress_limitedOutput_continue \
+    UMF_CODEC (LZ4_compress_limitedOutput_continue)
+#define LZ4_compress_limitedOutput_withState \
+    UMF_CODEC (LZ4_compress_limitedOutput_withState)
+#define LZ4_compress_withState UMF_CODEC (LZ4_compress_withState)
+#define LZ4_create UMF_CODEC (LZ4_create)
+#define LZ4_createHC UMF_CODEC (LZ4_createHC)
+#define LZ4_createStream UMF_CODEC (LZ4_createStream)
+#define LZ4_createStreamDecode UMF_CODEC (LZ4_createStreamDecode)
+#define LZ4_createStreamHC UMF_CODEC (LZ4_createStreamHC)
+#define LZ4_decoderRingBufferSize UMF_CODEC (LZ4_decoderRingBufferSize)
+#define LZ4_decompress_fast UMF_CODEC (LZ4_decompress_fast)
+#define LZ4_decompress_fast_continue UMF_CODEC (LZ4_decompress_fast_continue)
+#define LZ4_decompress_fast_usingDict UMF_CODEC (LZ4_decompress_fast_usingDict)
+#define LZ4_decompress_fast_withPrefix64k \
+    UMF_CODEC (LZ4_decompress_fast_withPrefix64k)
+#define LZ4_decompress_safe UMF_CODEC (LZ4_decompress_safe)
+#define LZ4_decompress_safe_continue UMF_CODEC (LZ4_decompress_safe_continue)
+#define LZ4_decompress_safe_forceExtDict \
+    UMF_CODEC (LZ4_decompress_safe_forceExtDict)
+#define LZ4_decompress_safe_partial UMF_CODEC (LZ4_decompress_safe_partial)
+#define LZ4_decompress_safe_usingDict UMF_CODEC (LZ4_decompress_safe_usingDict)
+#define LZ4_decompress_safe_withPrefix64k \
+    UMF_CODEC (LZ4_decompress_safe_withPrefix64k)
+#define LZ4_favorDecompressionSpeed UMF_CODEC (LZ4_favorDecompressionSpeed)
+#define LZ4_freeHC UMF_CODEC (LZ4_freeHC)
+#define LZ4_freeStream UMF_CODEC (LZ4_freeStream)
+#define LZ4_freeStreamDecode UMF_CODEC (LZ4_freeStreamDecode)
+#define LZ4_freeStreamHC UMF_CODEC (LZ4_freeStreamHC)
+#define LZ4_initStream UMF_CODEC (LZ4_initStream)
+#define LZ4_initStreamHC UMF_CODEC (LZ4_initStreamHC)
+#define LZ4_loadDict UMF_CODEC (LZ4_loadDict)
+#define LZ4_loadDictHC UMF_CODEC (LZ4_loadDictHC)
+#define LZ4_resetStream UMF_CODEC (LZ4_resetStream)
+#define LZ4_resetStreamHC UMF_CODEC (LZ4_resetStreamHC)
+#define LZ4_resetStreamHC_fast UMF_CODEC (LZ4_resetStreamHC_fast)
+#define LZ4_resetStreamState UMF_CODEC (LZ4_resetStreamState)
+#define LZ4_resetStreamStateHC UMF_CODEC (LZ4_resetStreamStateHC)
+#define LZ4_resetStream_fast UMF_CODEC (LZ4_resetStream_fast)
+#define LZ4_saveDict UMF_CODEC (LZ4_saveDict)
+#define LZ4_saveDictHC UMF_CODEC (LZ4_saveDictHC)
+#define LZ4_setCompressionLevel UMF_CODEC (LZ4_setCompressionLevel)
+#define LZ4_setStreamDecode UMF_CODEC (LZ4_setStreamDecode)
+#define LZ4_sizeofState UMF_CODEC (LZ4_sizeofState)
+#define LZ4_sizeofStateHC UMF_CODEC (LZ4_sizeofStateHC)
+#define LZ4_sizeofStreamState UMF_CODEC (LZ4_sizeofStreamState)
+#define LZ4_sizeofStreamStateHC UMF_CODEC (LZ4_sizeofStreamStateHC)
+#define LZ4_slideInputBuffer UMF_CODEC (LZ4_slideInputBuffer)
+#define LZ4_slideInputBufferHC UMF_CODEC (LZ4_slideInputBufferHC)
+#define LZ4_uncompress UMF_CODEC (LZ4_uncompress)
+#define LZ4_uncompress_unknownOutputSize \
+    UMF_CODEC (LZ4_uncompress_unknownOutputSize)
+#define LZ4_versionNumber UMF_CODEC (LZ4_versionNumber)
+#define LZ4_versionString UMF_CODEC (LZ4_versionString)
+
+#define LZ4_DISABLE_DEPRECATE_WARNINGS
+#include "lz4.h"
+#include "lz4hc.h"
+
+/* -------------------------------------------------------------------------- */
+/* ZSTD */
+/* -------------------------------------------------------------------------- */
+
+/* ZSTD uses ZSTD_malloc, ZSTD_calloc, and ZSTD_free, defined in umf_zstd.c */
+#define ZSTD_DEPS_MALLOC
+#define ZSTD_malloc UMF_CODEC (ZSTD_malloc)
+#define ZSTD_calloc UMF_CODEC (ZSTD_calloc)
+#define ZSTD_free UMF_CODEC (ZSTD_free)
+void *ZSTD_malloc (size_t s) ;
+void *ZSTD_calloc (size_t n, size_t s) ;
+void ZSTD_free (void *p) ;
+
+/* FSE_isError and HUF_isError are renamed in umf_zstd.c, since ZSTD also
+ * defines them as macros.  ZSTD_isError is not compiled (see umf_zstd.c). */
+#define ERR_getErrorString UMF_CODEC (ERR_getErrorString)
+#define FSE_NCountWriteBound UMF_CODEC (FSE_NCountWriteBound)
+#define FSE_buildCTable_rle UMF_CODEC (FSE_buildCTable_rle)
+#define FSE_buildCTable_wksp UMF_CODEC (FSE_buildCTable_wksp)
+#define FSE_buildDTable_wksp UMF_CODEC (FSE_buildDTable_wksp)
+#define FSE_compressBound UMF_CODEC (FSE_compressBound)
+#define FSE_compress_usingCTable UMF_CODEC (FSE_compress_usingCTable)
+#define FSE_decompress_wksp_bmi2 UMF_CODEC (FSE_decompress_wksp_bmi2)
+#define FSE_getErrorName UMF_CODEC (FSE_getErrorName)
+#define FSE_normalizeCount UMF_CODEC (FSE_normalizeCount)
+#define FSE_optimalTableLog UMF_CODEC (FSE_optimalTableLog)
+#define FSE_optimalTableLog_internal UMF_CODEC (FSE_optimalTableLog_internal)
+#define FSE_readNCount UMF_CODEC (FSE_readNCount)
+#define FSE_readNCount_bmi2 UMF_CODEC (FSE_readNCount_bmi2)
+#define FSE_versionNumber UMF_CODEC (FSE_versionNumber)
+#define FSE_writeNCount UMF_CODEC (FSE_writeNCount)
+#define HIST_count UMF_CODEC (HIST_count)
+#define HIST_countFast UMF_CODEC (HIST_countFast)
+#define HIST_countFast_wksp UMF_CODEC (HIST_countFast_wksp)
+#define HIST_count_simple UMF_CODEC (HIST_count_simple)
+#define HIST_count_wksp UMF_CODEC (HIST_count_wksp)
+#define HIST_isError UMF_CODEC (HIST_isError)
+#define HUF_buildCTable_wksp UMF_CODEC (HUF_buildCTable_wksp)
+#define HUF_cardinality UMF_CODEC (HUF_cardinality)
+#define HUF_compress1X_repeat UMF_CODEC (HUF_compress1X_repeat)
+#define HUF_compress1X_usingCTable UMF_CODEC (HUF_compress1X_usingCTable)
+#define HUF_compress4X_repeat UMF_CODEC (HUF_compress4X_repeat)
+#define HUF_compress4X_usingCTable UMF_CODEC (HUF_compress4X_usingCTable)
+#define HUF_compressBound UMF_CODEC (HUF_compressBound)
+#define HUF_decompress1X1_DCtx_wksp UMF_CODEC (HUF_decompress1X1_DCtx_wksp)
+#define HUF_decompress1X2_DCtx_wksp UMF_CODEC (HUF_decompress1X2_DCtx_wksp)
+#define HUF_decompress1X_DCtx_wksp UMF_CODEC (HUF_decompress1X_DCtx_wksp)
+#define HUF_decompress1X_usingDTable UMF_CODEC (HUF_decompress1X_usingDTable)
+#define HUF_decompress4X_hufOnly_wksp UMF_CODEC (HUF_decompress4X_hufOnly_wksp)
+#define HUF_decompress4X_usingDTable UMF_CODEC (HUF_decompress4X_usingDTable)
+#define HUF_estimateCompressedSize UMF_CODEC (HUF_estimateCompressedSize)
+#define HUF_getErrorName UMF_CODEC (HUF_getErrorName)
+#define HUF_getNbBitsFromCTable UMF_CODEC (HUF_getNbBitsFromCTable)
+#define HUF_minTableLog UMF_CODEC (HUF_minTableLog)
+#define HUF_optimalTableLog UMF_CODEC (HUF_optimalTableLog)
+#define HUF_readCTable UMF_CODEC (HUF_readCTable)
+#define HUF_readDTableX1_wksp UMF_CODEC (HUF_readDTableX1_wksp)
+#define HUF_readDTableX2_wksp UMF_CODEC (HUF_readDTableX2_wksp)
+#define HUF_readStats UMF_CODEC (HUF_readStats)
+#define HUF_readStats_wksp UMF_CODEC (HUF_readStats_wksp)
+#define HUF_selectDecoder UMF_CODEC (HUF_selectDecoder)
+#define HUF_validateCTable UMF_CODEC (HUF_validateCTable)
+#define HUF_writeCTable_wksp UMF_CODEC (HUF_writeCTable_wksp)
+#define POOL_add UMF_CODEC (POOL_add)
+#define POOL_create UMF_CODEC (POOL_create)
+#define POOL_create_advanced UMF_CODEC (POOL_create_advanced)
+#define POOL_free UMF_CODEC (POOL_free)
+#define POOL_joinJobs UMF_CODEC (POOL_joinJobs)
+#define POOL_resize UMF_CODEC (POOL_resize)
+#define POOL_sizeof UMF_CODEC (POOL_sizeof)
+#define POOL_tryAdd UMF_CODEC (POOL_tryAdd)
+#define ZSTDMT_compressStream_generic UMF_CODEC (ZSTDMT_compressStream_generic)
+#define ZSTDMT_createCCtx_advanced UMF_CODEC (ZSTDMT_createCCtx_advanced)
+#define ZSTDMT_freeCCtx UMF_CODEC (ZSTDMT_freeCCtx)
+#define ZSTDMT_getFrameProgression UMF_CODEC (ZSTDMT_getFrameProgression)
+#define ZSTDMT_initCStream_internal UMF_CODEC (ZSTDMT_initCStream_internal)
+#define ZSTDMT_nextInputSizeHint UMF_CODEC (ZSTDMT_nextInputSizeHint)
+#define ZSTDMT_sizeof_CCtx UMF_CODEC (ZSTDMT_sizeof_CCtx)
+#define ZSTDMT_toFlushNow UMF_CODEC (ZSTDMT_toFlushNow)
+#define ZSTDMT_updateCParams_whileCompressing \
+    UMF_CODEC (ZSTDMT_updateCParams_whileCompressing)
+#define ZSTD_CCtxParams_getParameter UMF_CODEC (ZSTD_CCtxParams_getParameter)
+#define ZSTD_CCtxParams_init UMF_CODEC (ZSTD_CCtxParams_init)
+#define ZSTD_CCtxParams_init_advanced UMF_CODEC (ZSTD_CCtxParams_init_advanced)
+#define ZSTD_CCtxParams_reset UMF_CODEC (ZSTD_CCtxParams_reset)
+#define ZSTD_CCtxParams_setParameter UMF_CODEC (ZSTD_CCtxParams_setParameter)
+#define ZSTD_CCtx_getParameter UMF_CODEC (ZSTD_CCtx_getParameter)
+#define ZSTD_CCtx_loadDictionary UMF_CODEC (ZSTD_CCtx_loadDictionary)
+#define ZSTD_CCtx_loadDictionary_advanced \
+    UMF_CODEC (ZSTD_CCtx_loadDictionary_advanced)
+#define ZSTD_CCtx_loadDictionary_byReference \
+    UMF_CODEC (ZSTD_CCtx_loadDictionary_byReference)
+#define ZSTD_CCtx_refCDict UMF_CODEC (ZSTD_CCtx_refCDict)
+#define ZSTD_CCtx_refPrefix UMF_CODEC (ZSTD_CCtx_refPrefix)
+#define ZSTD_CCtx_refPrefix_advanced UMF_CODEC (ZSTD_CCtx_refPrefix_advanced)
+#define ZSTD_CCtx_refThreadPool UMF_CODEC (ZSTD_CCtx_refThreadPool)
+#define ZSTD_CCtx_reset UMF_CODEC (ZSTD_CCtx_reset)
+#define ZSTD_CCtx_setCParams UMF_CODEC (ZSTD_CCtx_setCParams)
+#define ZSTD_CCtx_setFParams UMF_CODEC (ZSTD_CCtx_setFParams)
+#define ZSTD_CCtx_setParameter UMF_CODEC (ZSTD_CCtx_setParameter)
+#define ZSTD_CCtx_setParametersUsingCCtxParams \
+    UMF_CODEC (ZSTD_CCtx_setParametersUsingCCtxParams)
+#define ZSTD_CCtx_setParams UMF_CODEC (ZSTD_CCtx_setParams)
+#define ZSTD_CCtx_setPledgedSrcSize UMF_CODEC (ZSTD_CCtx_setPledgedSrcSize)
+#define ZSTD_CCtx_trace UMF_CODEC (ZSTD_CCtx_trace)
+#define ZSTD_CStreamInSize UMF_CODEC (ZSTD_CStreamInSize)
+#define ZSTD_CStreamOutSize UMF_CODEC (ZSTD_CStreamOutSize)
+#define ZSTD_DCtx_getParameter UMF_CODEC (ZSTD_DCtx_getParameter)
+#define ZSTD_DCtx_loadDictionary UMF_CODEC (ZSTD_DCtx_loadDictionary)
+#define ZSTD_DCtx_loadDictionary_advanced \
+    UMF_CODEC (ZSTD_DCtx_loadDictionary_advanced)
+#define ZSTD_DCtx_loadDictionary_byReference \
+    UMF_CODEC (ZSTD_DCtx_loadDictionary_byReference)
+#define ZSTD_DCtx_refDDict UMF_CODEC (ZSTD_DCtx_refDDict)
+#define ZSTD_DCtx_refPrefix UMF_CODEC (ZSTD_DCtx_refPrefix)
+#define ZSTD_DCtx_refPrefix_advanced UMF_CODEC (ZSTD_DCtx_refPrefix_advanced)
+#define ZSTD_DCtx_reset UMF_CODEC (ZSTD_DCtx_reset)
+#define ZSTD_DCtx_setFormat UMF_CODEC (ZSTD_DCtx_setFormat)
+#define ZSTD_DCtx_setMaxWindowSize UMF_CODEC (ZSTD_DCtx_setMaxWindowSize)
+#define ZSTD_DCtx_setParameter UMF_CODEC (ZSTD_DCtx_setParameter)
+#define ZSTD_DDict_dictContent UMF_CODEC (ZSTD_DDict_dictContent)
+#define ZSTD_DDict_dictSize UMF_CODEC (ZSTD_DDict_dictSize)
+#define ZSTD_DStreamInSize UMF_CODEC (ZSTD_DStreamInSize)
+#define ZSTD_DStreamOutSize UMF_CODEC (ZSTD_DStreamOutSize)
+#define ZSTD_XXH32 UMF_CODEC (ZSTD_XXH32)
+#define ZSTD_XXH32_canonicalFromHash UMF_CODEC (ZSTD_XXH32_canonicalFromHash)
+#define ZSTD_XXH32_copyState UMF_CODEC (ZSTD_XXH32_copyState)
+#define ZSTD_XXH32_createState UMF_CODEC (ZSTD_XXH32_createState)
+#define ZSTD_XXH32_digest UMF_CODEC (ZSTD_XXH32_digest)
+#define ZSTD_XXH32_freeState UMF_CODEC (ZSTD_XXH32_freeState)
+#define ZSTD_XXH32_hashFromCanonical UMF_CODEC (ZSTD_XXH32_hashFromCanonical)
+#define ZSTD_XXH32_reset UMF_CODEC (ZSTD_XXH32_reset)
+#define ZSTD_XXH32_update UMF_CODEC (ZSTD_XXH32_update)
+#define ZSTD_XXH64 UMF_CODEC (ZSTD_XXH64)
+#define ZSTD_XXH64_canonicalFromHash UMF_CODEC (ZSTD_XXH64_canonicalFromHash)
+#define ZSTD_XXH64_copyState UMF_CODEC (ZSTD_XXH64_copyState)
+#define ZSTD_XXH64_createState UMF_CODEC (ZSTD_XXH64_createState)
+#define ZSTD_XXH64_digest UMF_CODEC (ZSTD_XXH64_digest)
+#define ZSTD_XXH64_freeState UMF_CODEC (ZSTD_XXH64_freeState)
+#define ZSTD_XXH64_hashFromCanonical UMF_CODEC (ZSTD_XXH64_hashFromCanonical)
+#define ZSTD_XXH64_reset UMF_CODEC (ZSTD_XXH64_reset)
+#define ZSTD_XXH64_update UMF_CODEC (ZSTD_XXH64_update)
+#define ZSTD_XXH_versionNumber UMF_CODEC (ZSTD_XXH_versionNumber)
+#define ZSTD_adjustCParams UMF_CODEC (ZSTD_adjustCParams)
+#define ZSTD_buildBlockEntropyStats UMF_CODEC (ZSTD_buildBlockEntropyStats)
+#define ZSTD_buildCTable UMF_CODEC (ZSTD_buildCTable)
+#define ZSTD_buildFSETable UMF_CODEC (ZSTD_buildFSETable)
+#define ZSTD_cParam_getBounds UMF_CODEC (ZSTD_cParam_getBounds)
+#define ZSTD_checkCParams UMF_CODEC (ZSTD_checkCParams)
+#define ZSTD_checkContinuity UMF_CODEC (ZSTD_checkContinuity)
+#define ZSTD_compress UMF_CODEC (ZSTD_compress)
+#define ZSTD_compress2 UMF_CODEC (ZSTD_compress2)
+#define ZSTD_compressBegin UMF_CODEC (ZSTD_compressBegin)
+#define ZSTD_compressBegin_advanced UMF_CODEC (ZSTD_compressBegin_advanced)
+#define ZSTD_compressBegin_advanced_internal \
+    UMF_CODEC (ZSTD_compressBegin_advanced_internal)
+#define ZSTD_compressBegin_usingCDict UMF_CODEC (ZSTD_compressBegin_usingCDict)
+#define ZSTD_compressBegin_usingCDict_advanced \
+    UMF_CODEC (ZSTD_compressBegin_usingCDict_advanced)
+#define ZSTD_compressBegin_usingCDict_deprecated \
+    UMF_CODEC (ZSTD_compressBegin_usingCDict_deprecated)
+#define ZSTD_compressBegin_usingDict UMF_CODEC (ZSTD_compressBegin_usingDict)
+#define ZSTD_compressBlock UMF_CODEC (ZSTD_compressBlock)
+#define ZSTD_compressBlock_btlazy2 UMF_CODEC (ZSTD_compressBlock_btlazy2)
+#define ZSTD_compressBlock_btlazy2_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_btlazy2_dictMatchState)
+#define ZSTD_compressBlock_btlazy2_extDict \
+    UMF_CODEC (ZSTD_compressBlock_btlazy2_extDict)
+#define ZSTD_compressBlock_btopt UMF_CODEC (ZSTD_compressBlock_btopt)
+#define ZSTD_compressBlock_btopt_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_btopt_dictMatchState)
+#define ZSTD_compressBlock_btopt_extDict \
+    UMF_CODEC (ZSTD_compressBlock_btopt_extDict)
+#define ZSTD_compressBlock_btultra UMF_CODEC (ZSTD_compressBlock_btultra)
+#define ZSTD_compressBlock_btultra2 UMF_CODEC (ZSTD_compressBlock_btultra2)
+#define ZSTD_compressBlock_btultra_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_btultra_dictMatchState)
+#define ZSTD_compressBlock_btultra_extDict \
+    UMF_CODEC (ZSTD_compressBlock_btultra_extDict)
+#define ZSTD_compressBlock_deprecated UMF_CODEC (ZSTD_compressBlock_deprecated)
+#define ZSTD_compressBlock_doubleFast UMF_CODEC (ZSTD_compressBlock_doubleFast)
+#define ZSTD_compressBlock_doubleFast_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_doubleFast_dictMatchState)
+#define ZSTD_compressBlock_doubleFast_extDict \
+    UMF_CODEC (ZSTD_compressBlock_doubleFast_extDict)
+#define ZSTD_compressBlock_fast UMF_CODEC (ZSTD_compressBlock_fast)
+#define ZSTD_compressBlock_fast_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_fast_dictMatchState)
+#define ZSTD_compressBlock_fast_extDict \
+    UMF_CODEC (ZSTD_compressBlock_fast_extDict)
+#define ZSTD_compressBlock_greedy UMF_CODEC (ZSTD_compressBlock_greedy)
+#define ZSTD_compressBlock_greedy_dedicatedDictSearch \
+    UMF_CODEC (ZSTD_compressBlock_greedy_dedicatedDictSearch)
+#define ZSTD_compressBlock_greedy_dedicatedDictSearch_row \
+    UMF_CODEC (ZSTD_compressBlock_greedy_dedicatedDictSearch_row)
+#define ZSTD_compressBlock_greedy_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_greedy_dictMatchState)
+#define ZSTD_compressBlock_greedy_dictMatchState_row \
+    UMF_CODEC (ZSTD_compressBlock_greedy_dictMatchState_row)
+#define ZSTD_compressBlock_greedy_extDict \
+    UMF_CODEC (ZSTD_compressBlock_greedy_extDict)
+#define ZSTD_compressBlock_greedy_extDict_row \
+    UMF_CODEC (ZSTD_compressBlock_greedy_extDict_row)
+#define ZSTD_compressBlock_greedy_row UMF_CODEC (ZSTD_compressBlock_greedy_row)
+#define ZSTD_compressBlock_lazy UMF_CODEC (ZSTD_compressBlock_lazy)
+#define ZSTD_compressBlock_lazy2 UMF_CODEC (ZSTD_compressBlock_lazy2)
+#define ZSTD_compressBlock_lazy2_dedicatedDictSearch \
+    UMF_CODEC (ZSTD_compressBlock_lazy2_dedicatedDictSearch)
+#define ZSTD_compressBlock_lazy2_dedicatedDictSearch_row \
+    UMF_CODEC (ZSTD_compressBlock_lazy2_dedicatedDictSearch_row)
+#define ZSTD_compressBlock_lazy2_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_lazy2_dictMatchState)
+#define ZSTD_compressBlock_lazy2_dictMatchState_row \
+    UMF_CODEC (ZSTD_compressBlock_lazy2_dictMatchState_row)
+#define ZSTD_compressBlock_lazy2_extDict \
+    UMF_CODEC (ZSTD_compressBlock_lazy2_extDict)
+#define ZSTD_compressBlock_lazy2_extDict_row \
+    UMF_CODEC (ZSTD_compressBlock_lazy2_extDict_row)
+#define ZSTD_compressBlock_lazy2_row UMF_CODEC (ZSTD_compressBlock_lazy2_row)
+#define ZSTD_compressBlock_lazy_dedicatedDictSearch \
+    UMF_CODEC (ZSTD_compressBlock_lazy_dedicatedDictSearch)
+#define ZSTD_compressBlock_lazy_dedicatedDictSearch_row \
+    UMF_CODEC (ZSTD_compressBlock_lazy_dedicatedDictSearch_row)
+#define ZSTD_compressBlock_lazy_dictMatchState \
+    UMF_CODEC (ZSTD_compressBlock_lazy_dictMatchState)
+#define ZSTD_compressBlock_lazy_dictMatchState_row \
+    UMF_CODEC (ZSTD_compressBlock_lazy_dictMatchState_row)
+#define ZSTD_compressBlock_lazy_extDict \
+    UMF_CODEC (ZSTD_compressBlock_lazy_extDict)
+#define ZSTD_compressBlock_lazy_extDict_row \
+    UMF_CODEC (ZSTD_compressBlock_lazy_extDict_row)
+#define ZSTD_compressBlock_lazy_row UMF_CODEC (ZSTD_compressBlock_lazy_row)
+#define ZSTD_compressBound UMF_CODEC (ZSTD_compressBound)
+#define ZSTD_compressCCtx UMF_CODEC (ZSTD_compressCCtx)
+#define ZSTD_compressContinue UMF_CODEC (ZSTD_compressContinue)
+#define ZSTD_compressContinue_public UMF_CODEC (ZSTD_compressContinue_public)
+#define ZSTD_compressEnd UMF_CODEC (ZSTD_compressEnd)
+#define ZSTD_compressEnd_public UMF_CODEC (ZSTD_compressEnd_public)
+#define ZSTD_compressLiterals UMF_CODEC (ZSTD_compressLiterals)
+#define ZSTD_compressRleLiteralsBlock UMF_CODEC (ZSTD_compressRleLiteralsBlock)
+#define ZSTD_compressSequences UMF_CODEC (ZSTD_compressSequences)
+#define ZSTD_compressStream UMF_CODEC (ZSTD_compressStream)
+#define ZSTD_compressStream2 UMF_CODEC (ZSTD_compressStream2)
+#define ZSTD_compressStream2_simpleArgs \
+    UMF_CODEC (ZSTD_compressStream2_simpleArgs)
+#define ZSTD_compressSuperBlock UMF_CODEC (ZSTD_compressSuperBlock)
+#define ZSTD_compress_advanced UMF_CODEC (ZSTD_compress_advanced)
+#define ZSTD_compress_advanced_internal \
+    UMF_CODEC (ZSTD_compress_advanced_internal)
+#define ZSTD_compress_usingCDict UMF_CODEC (ZSTD_compress_usingCDict)
+#define ZSTD_compress_usingCDict_advanced \
+    UMF_CODEC (ZSTD_compress_usingCDict_advanced)
+#define ZSTD_compress_usingDict UMF_CODEC (ZSTD_compress_usingDict)
+#define ZSTD_copyCCtx UMF_CODEC (ZSTD_copyCCtx)
+#define ZSTD_copyDCtx UMF_CODEC (ZSTD_copyDCtx)
+#define ZSTD_copyDDictParameters UMF_CODEC (ZSTD_copyDDictParameters)
+#define ZSTD_copySequencesToSeqStoreExplicitBlockDelim \
+    UMF_CODEC (ZSTD_copySequencesToSeqStoreExplicitBlockDelim)
+#define ZSTD_copySequencesToSeqStoreNoBlockDelim \
+    UMF_CODEC (ZSTD_copySequencesToSeqStoreNoBlockDelim)
+#define ZSTD_createCCtx UMF_CODEC (ZSTD_createCCtx)
+#define ZSTD_createCCtxParams UMF_CODEC (ZSTD_createCCtxParams)
+#define ZSTD_createCCtx_advanced UMF_CODEC (ZSTD_createCCtx_advanced)
+#define ZSTD_createCDict UMF_CODEC (ZSTD_createCDict)
+#define ZSTD_createCDict_advanced UMF_CODEC (ZSTD_createCDict_advanced)
+#define ZSTD_createCDict_advanced2 UMF_CODEC (ZSTD_createCDict_advanced2)
+#define ZSTD_createCDict_byReference UMF_CODEC (ZSTD_createCDict_byReference)
+#define ZSTD_createCStream UMF_CODEC (ZSTD_createCStream)
+#define ZSTD_createCStream_advanced UMF_CODEC (ZSTD_createCStream_advanced)
+#define ZSTD_createDCtx UMF_CODEC (ZSTD_createDCtx)
+#define ZSTD_createDCtx_advanced UMF_CODEC (ZSTD_createDCtx_advanced)
+#define ZSTD_createDDict UMF_CODEC (ZSTD_createDDict)
+#define ZSTD_createDDict_advanced UMF_CODEC (ZSTD_createDDict_advanced)
+#define ZSTD_createDDict_byReference UMF_CODEC (ZSTD_createDDict_byReference)
+#define ZSTD_createDStream UMF_CODEC (ZSTD_createDStream)
+#define ZSTD_createDStream_advanced UMF_CODEC (ZSTD_createDStream_advanced)
+#define ZSTD_crossEntropyCost UMF_CODEC (ZSTD_crossEntropyCost)
+#define ZSTD_cycleLog UMF_CODEC (ZSTD_cycleLog)
+#define ZSTD_dParam_getBounds UMF_CODEC (ZSTD_dParam_getBounds)
+#define ZSTD_decodeLiteralsBlock UMF_CODEC (ZSTD_decodeLiteralsBlock)
+#define ZSTD_decodeSeqHeaders UMF_CODEC (ZSTD_decodeSeqHeaders)
+#define ZSTD_decodingBufferSize_min UMF_CODEC (ZSTD_decodingBufferSize_min)
+#define ZSTD_decompress UMF_CODEC (ZSTD_decompress)
+#define ZSTD_decompressBegin UMF_CODEC (ZSTD_decompressBegin)
+#define ZSTD_decompressBegin_usingDDict \
+    UMF_CODEC (ZSTD_decompressBegin_usingDDict)
+#define ZSTD_decompressBegin_usingDict \
+    UMF_CODEC (ZSTD_decompressBegin_usingDict)
+#define ZSTD_decompressBlock UMF_CODEC (ZSTD_decompressBlock)
+#define ZSTD_decompressBlock_deprecated \
+    UMF_CODEC (ZSTD_decompressBlock_deprecated)
+#define ZSTD_decompressBlock_internal UMF_CODEC (ZSTD_decompressBlock_internal)
+#define ZSTD_decompressBound UMF_CODEC (ZSTD_decompressBound)
+#define ZSTD_decompressContinue UMF_CODEC (ZSTD_decompressContinue)
+#define ZSTD_decompressDCtx UMF_CODEC (ZSTD_decompressDCtx)
+#define ZSTD_decompressStream UMF_CODEC (ZSTD_decompressStream)
+#define ZSTD_decompressStream_simpleArgs \
+    UMF_CODEC (ZSTD_decompressStream_simpleArgs)
+#define ZSTD_decompress_usingDDict UMF_CODEC (ZSTD_decompress_usingDDict)
+#define ZSTD_decompress_usingDict UMF_CODEC (ZSTD_decompress_usingDict)
+#define ZSTD_decompressionMargin UMF_CODEC (ZSTD_decompressionMargin)
+#define ZSTD_dedicatedDictSearch_lazy_loadDictionary \
+    UMF_CODEC (ZSTD_dedicatedDictSearch_lazy_loadDictionary)
+#define ZSTD_defaultCLevel UMF_CODEC (ZSTD_defaultCLevel)
+#define ZSTD_encodeSequences UMF_CODEC (ZSTD_encodeSequences)
+#define ZSTD_endStream UMF_CODEC (ZSTD_endStream)
+#define ZSTD_estimateCCtxSize UMF_CODEC (ZSTD_estimateCCtxSize)
+#define ZSTD_estimateCCtxSize_usingCCtxParams \
+    UMF_CODEC (ZSTD_estimateCCtxSize_usingCCtxParams)
+#define ZSTD_estimateCCtxSize_usingCParams \
+    UMF_CODEC (ZSTD_estimateCCtxSize_usingCParams)
+#define ZSTD_estimateCDictSize UMF_CODEC (ZSTD_estimateCDictSize)
+#define ZSTD_estimateCDictSize_advanced \
+    UMF_CODEC (ZSTD_estimateCDictSize_advanced)
+#define ZSTD_estimateCStreamSize UMF_CODEC (ZSTD_estimateCStreamSize)
+#define ZSTD_estimateCStreamSize_usingCCtxParams \
+    UMF_CODEC (ZSTD_estimateCStreamSize_usingCCtxParams)
+#define ZSTD_estimateCStreamSize_usingCParams \
+    UMF_CODEC (ZSTD_estimateCStreamSize_usingCParams)
+#define ZSTD_estimateDCtxSize UMF_CODEC (ZSTD_estimateDCtxSize)
+#define ZSTD_estimateDDictSize UMF_CODEC (ZSTD_estimateDDictSize)
+#define ZSTD_estimateDStreamSize UMF_CODEC (ZSTD_estimateDStreamSize)
+#define ZSTD_estimateDStreamSize_fromFrame \
+    UMF_CODEC (ZSTD_estimateDStreamSize_fromFrame)
+#define ZSTD_fillDoubleHashTable UMF_CODEC (ZSTD_fillDoubleHashTable)
+#define ZSTD_fillHashTable UMF_CODEC (ZSTD_fillHashTable)
+#define ZSTD_findDecompressedSize UMF_CODEC (ZSTD_findDecompressedSize)
+#define ZSTD_findFrameCompressedSize UMF_CODEC (ZSTD_findFrameCompressedSize)
+#define ZSTD_flushStream UMF_CODEC (ZSTD_flushStream)
+#define ZSTD_frameHeaderSize UMF_CODEC (ZSTD_frameHeaderSize)
+#define ZSTD_freeCCtx UMF_CODEC (ZSTD_freeCCtx)
+#define ZSTD_freeCCtxParams UMF_CODEC (ZSTD_freeCCtxParams)
+#define ZSTD_freeCDict UMF_CODEC (ZSTD_freeCDict)
+#define ZSTD_freeCStream UMF_CODEC (ZSTD_freeCStream)
+#define ZSTD_freeDCtx UMF_CODEC (ZSTD_freeDCtx)
+#define ZSTD_freeDDict UMF_CODEC (ZSTD_freeDDict)
+#define ZSTD_freeDStream UMF_CODEC (ZSTD_freeDStream)
+#define ZSTD_fseBitCost UMF_CODEC (ZSTD_fseBitCost)
+#define ZSTD_generateSequences UMF_CODEC (ZSTD_generateSequences)
+#define ZSTD_getBlockSize UMF_CODEC (ZSTD_getBlockSize)
+#define ZSTD_getCParams UMF_CODEC (ZSTD_getCParams)
+#define ZSTD_getCParamsFromCCtxParams UMF_CODEC (ZSTD_getCParamsFromCCtxParams)
+#define ZSTD_getCParamsFromCDict UMF_CODEC (ZSTD_getCParamsFromCDict)
+#define ZSTD_getDecompressedSize UMF_CODEC (ZSTD_getDecompressedSize)
+#define ZSTD_getDictID_fromCDict UMF_CODEC (ZSTD_getDictID_fromCDict)
+#define ZSTD_getDictID_fromDDict UMF_CODEC (ZSTD_getDictID_fromDDict)
+#define ZSTD_getDictID_fromDict UMF_CODEC (ZSTD_getDictID_fromDict)
+#define ZSTD_getDictID_fromFrame UMF_CODEC (ZSTD_getDictID_fromFrame)
+#define ZSTD_getErrorCode UMF_CODEC (ZSTD_getErrorCode)
+#define ZSTD_getErrorName UMF_CODEC (ZSTD_getErrorName)
+#define ZSTD_getErrorString UMF_CODEC (ZSTD_getErrorString)
+#define ZSTD_getFrameContentSize UMF_CODEC (ZSTD_getFrameContentSize)
+#define ZSTD_getFrameHeader UMF_CODEC (ZSTD_getFrameHeader)
+#define ZSTD_getFrameHeader_advanced UMF_CODEC (ZSTD_getFrameHeader_advanced)
+#define ZSTD_getFrameProgression UMF_CODEC (ZSTD_getFrameProgression)
+#define ZSTD_getParams UMF_CODEC (ZSTD_getParams)
+#define ZSTD_getSeqStore UMF_CODEC (ZSTD_getSeqStore)
+#define ZSTD_getcBlockSize UMF_CODEC (ZSTD_getcBlockSize)
+#define ZSTD_initCStream UMF_CODEC (ZSTD_initCStream)
+#define ZSTD_initCStream_advanced UMF_CODEC (ZSTD_initCStream_advanced)
+#define ZSTD_initCStream_internal UMF_CODEC (ZSTD_initCStream_internal)
+#define ZSTD_initCStream_srcSize UMF_CODEC (ZSTD_initCStream_srcSize)
+#define ZSTD_initCStream_usingCDict UMF_CODEC (ZSTD_initCStream_usingCDict)
+#define ZSTD_initCStream_usingCDict_advanced \
+    UMF_CODEC (ZSTD_initCStream_usingCDict_advanced)
+#define ZSTD_initCStream_usingDict UMF_CODEC (ZSTD_initCStream_usingDict)
+#define ZSTD_initDStream UMF_CODEC (ZSTD_initDStream)
+#define ZSTD_initDStream_usingDDict UMF_CODEC (ZSTD_initDStream_usingDDict)
+#define ZSTD_initDStream_usingDict UMF_CODEC (ZSTD_initDStream_usingDict)
+#define ZSTD_initStaticCCtx UMF_CODEC (ZSTD_initStaticCCtx)
+#define ZSTD_initStaticCDict UMF_CODEC (ZSTD_initStaticCDict)
+#define ZSTD_initStaticCStream UMF_CODEC (ZSTD_initStaticCStream)
+#define ZSTD_initStaticDCtx UMF_CODEC (ZSTD_initStaticDCtx)
+#define ZSTD_initStaticDDict UMF_CODEC (ZSTD_initStaticDDict)
+#define ZSTD_initStaticDStream UMF_CODEC (ZSTD_initStaticDStream)
+#define ZSTD_insertAndFindFirstIndex UMF_CODEC (ZSTD_insertAndFindFirstIndex)
+#define ZSTD_insertBlock UMF_CODEC (ZSTD_insertBlock)
+#define ZSTD_invalidateRepCodes UMF_CODEC (ZSTD_invalidateRepCodes)
+#define ZSTD_isFrame UMF_CODEC (ZSTD_isFrame)
+#define ZSTD_isSkippableFrame UMF_CODEC (ZSTD_isSkippableFrame)
+#define ZSTD_ldm_adjustParameters UMF_CODEC (ZSTD_ldm_adjustParameters)
+#define ZSTD_ldm_blockCompress UMF_CODEC (ZSTD_ldm_blockCompress)
+#define ZSTD_ldm_fillHashTable UMF_CODEC (ZSTD_ldm_fillHashTable)
+#define ZSTD_ldm_generateSequences UMF_CODEC (ZSTD_ldm_generateSequences)
+#define ZSTD_ldm_getMaxNbSeq UMF_CODEC (ZSTD_ldm_getMaxNbSeq)
+#define ZSTD_ldm_getTableSize UMF_CODEC (ZSTD_ldm_getTableSize)
+#define ZSTD_ldm_skipRawSeqStoreBytes UMF_CODEC (ZSTD_ldm_skipRawSeqStoreBytes)
+#define ZSTD_ldm_skipSequences UMF_CODEC (ZSTD_ldm_skipSequences)
+#define ZSTD_loadCEntropy UMF_CODEC (ZSTD_loadCEntropy)
+#define ZSTD_loadDEntropy UMF_CODEC (ZSTD_loadDEntropy)
+#define ZSTD_maxCLevel UMF_CODEC (ZSTD_maxCLevel)
+#define ZSTD_mergeBlockDelimiters UMF_CODEC (ZSTD_mergeBlockDelimiters)
+#define ZSTD_minCLevel UMF_CODEC (ZSTD_minCLevel)
+#define ZSTD_nextInputType UMF_CODEC (ZSTD_nextInputType)
+#define ZSTD_nextSrcSizeToDecompress UMF_CODEC (ZSTD_nextSrcSizeToDecompress)
+#define ZSTD_noCompressLiterals UMF_CODEC (ZSTD_noCompressLiterals)
+#define ZSTD_readSkippableFrame UMF_CODEC (ZSTD_readSkippableFrame)
+#define ZSTD_referenceExternalSequences \
+    UMF_CODEC (ZSTD_referenceExternalSequences)
+#define ZSTD_registerSequenceProducer UMF_CODEC (ZSTD_registerSequenceProducer)
+#define ZSTD_resetCStream UMF_CODEC (ZSTD_resetCStream)
+#define ZSTD_resetDStream UMF_CODEC (ZSTD_resetDStream)
+#define ZSTD_resetSeqStore UMF_CODEC (ZSTD_resetSeqStore)
+#define ZSTD_reset_compressedBlockState \
+    UMF_CODEC (ZSTD_reset_compressedBlockState)
+#define ZSTD_row_update UMF_CODEC (ZSTD_row_update)
+#define ZSTD_selectBlockCompressor UMF_CODEC (ZSTD_selectBlockCompressor)
+#define ZSTD_selectEncodingType UMF_CODEC (ZSTD_selectEncodingType)
+#define ZSTD_seqToCodes UMF_CODEC (ZSTD_seqToCodes)
+#define ZSTD_sequenceBound UMF_CODEC (ZSTD_sequenceBound)
+#define ZSTD_sizeof_CCtx UMF_CODEC (ZSTD_sizeof_CCtx)
+#define ZSTD_sizeof_CDict UMF_CODEC (ZSTD_sizeof_CDict)
+#define ZSTD_sizeof_CStream UMF_CODEC (ZSTD_sizeof_CStream)
+#define ZSTD_sizeof_DCtx UMF_CODEC (ZSTD_sizeof_DCtx)
+#define ZSTD_sizeof_DDict UMF_CODEC (ZSTD_sizeof_DDict)
+#define ZSTD_sizeof_DStream UMF_CODEC (ZSTD_sizeof_DStream)
+#define ZSTD_toFlushNow UMF_CODEC (ZSTD_toFlushNow)
+#define ZSTD_updateTree UMF_CODEC (ZSTD_updateTree)
+#define ZSTD_versionNumber UMF_CODEC (ZSTD_versionNumber)
+#define ZSTD_versionString UMF_CODEC (ZSTD_versionString)
+#define ZSTD_writeLastEmptyBlock UMF_CODEC (ZSTD_writeLastEmptyBlock)
+#define ZSTD_writeSkippableFrame UMF_CODEC (ZSTD_writeSkippableFrame)
+#define g_ZSTD_threading_useless_symbol \
+    UMF_CODEC (g_ZSTD_threading_useless_symbol)
+#define g_debuglevel UMF_CODEC (g_debuglevel)
+
+/* ZSTD is compiled without multithreading (UMFPACK compresses independent
+ * blocks in parallel instead), assembly code, deprecation warnings, or the
+ * tracing hooks, which are weak symbols that the application could define */
+#undef ZSTD_MULTITHREAD
+#define ZSTD_DISABLE_ASM
+#define ZSTD_DISABLE_DEPRECATE_WARNINGS
+#define ZSTD_TRACE 0
+#include "zstd.h"
+
+#endif
+#endif
@@ -0,0 +1,461 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_compress: compress and decompress a serialized object
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Helper routines for UMFPACK_serialize_*_compressed and
+    UMFPACK_deserialize_*.  See umf_compress.h for an overview.  A compressed
+    blob holds the following, in order:
+
+	int64_t cblobsize	size of the whole compressed blob, in bytes
+	int32_t valid		UMF_COMPRESSED_VALID
+	int32_t method		UMFPACK_COMPRESSION_NONE, _LZ4, _LZ4HC, or _ZSTD
+	int64_t size		size of the plain blob, in bytes
+	int64_t nblocks		number of blocks
+	int64_t Bsize [nblocks]	size of each compressed block, in bytes
+	...			the compressed blocks, one after the other
+
+    Each block holds UMF_COMPRESS_BLOCK bytes of the plain blob (except for the
+    last one, which may be smaller).  A block that does not compress to fewer
+    bytes than it holds is stored as-is, so Bsize [k] is never larger than the
+    plain size of the block k, and is equal to it only if block k is stored
+    without compression.
+
+    The blocks are compressed and decompressed in parallel, with one OpenMP
+    thread per block.  The compression and decompression methods use the
+    SuiteSparse memory manager, which is thread-safe, rather than UMF_malloc.
+*/
+
+#include "umfpack.h"
+#include "umf_compress.h"
+#include "umf_codec.h"
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef TRUE
+#define TRUE (1)
+#endif
+#ifndef FALSE
+#define FALSE (0)
+#endif
+#ifndef MAX
+#define MAX(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+#ifndef MIN
+#define MIN(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+/* the debug and test-coverage code is not thread-safe */
+#define PARALLEL_COMPRESS
+#endif
+
+/* size of the header, not including Bsize */
+#define CHEADER (sizeof (int64_t) + 2 * sizeof (int32_t) + 2 * sizeof (int64_t))
+
+/* size of the plain block k of a plain blob of the given size */
+#define BLOCK_SIZE(k,size) \
+    (((k)+1) * UMF_COMPRESS_BLOCK <= (size) ? \
+    ((int64_t) UMF_COMPRESS_BLOCK) : ((size) - (k) * UMF_COMPRESS_BLOCK))
+
+/* ========================================================================== */
+/* === get_method =========================================================== */
+/* ========================================================================== */
+
+/* Decodes the method into the algorithm and its level, exactly as done by
+ * GxB_Matrix_serialize in GraphBLAS.  A negative method means no compression.
+ * An unrecognized method, or a method other than UMFPACK_COMPRESSION_NONE if
+ * NCOMPRESSION is defined, is replaced by the default. */
+
+static void get_method (int method, int *algo, int *level)
+{
+    if (method < 0)
+    {
+	/* no compression if the method is negative */
+	(*algo) = UMFPACK_COMPRESSION_NONE ;
+	(*level) = 0 ;
+	return ;
+    }
+
+    /* a level of zero, or out of range for the method, means the default */
+    (*algo) = 1000 * (method / 1000) ;
+    (*level) = method % 1000 ;
+
+#ifdef NCOMPRESSION
+    (*algo) = UMFPACK_COMPRESSION_NONE ;
+    (*level) = 0 ;
+#else
+    switch (*algo)
+    {
+	default :
+	    /* ZSTD, level 1: fast with good compression */
+	    (*algo) = UMFPACK_COMPRESSION_ZSTD ;
+	    (*level) = 1 ;
+	    break ;
+
+	case UMFPACK_COMPRESSION_LZ4 :
+	    /* the level is ignored */
+	    (*level) = 0 ;
+	    break ;
+
+	case UMFPACK_COMPRESSION_LZ4HC :
+	    /* LZ4HC: level 1 to 9; default 9 */
+	    if ((*level) <= 0 || (*level) > 9) (*level) = 9 ;
+	    break ;
+
+	case UMFPACK_COMPRESSION_ZSTD :
+	    /* ZSTD: level 1 to 19; default 1 */
+	    if ((*level) <= 0 || (*level) > 19) (*level) = 1 ;
+	    break ;
+    }
+#endif
+}
+
+/* ========================================================================== */
+/* === block_bound ========================================================== */
+/* ========================================================================== */
+
+/* Returns the largest size of a plain block of bsize bytes when compressed
+ * with the given algorithm, or stored as-is. */
+
+static int64_t block_bound (int64_t bsize, int algo)
+{
+    int64_t bound = bsize ;
+#ifndef NCOMPRESSION
+    if (algo == UMFPACK_COMPRESSION_ZSTD)
+    {
+	bound = (int64_t) ZSTD_compressBound ((size_t) bsize) ;
+    }
+    else if (algo != UMFPACK_COMPRESSION_NONE)
+    {
+	bound = (int64_t) LZ4_compressBound ((int) bsize) ;
+    }
+#else
+    (void) algo ;
+#endif
+    return (MAX (bound, bsize)) ;
+}
+
+/* ========================================================================== */
+/* === umf_compressed_blobsize ============================================== */
+/* ========================================================================== */
+
+/* Returns an upper bound on the size of the compressed blob, for a plain blob
+ * of the given size. */
+
+int64_t umf_compressed_blobsize
+(
+    int64_t size,
+    int method
+)
+{
+    int algo, level ;
+    int64_t k, nblocks, cblobsize ;
+    get_method (method, &algo, &level) ;
+    nblocks = (size + UMF_COMPRESS_BLOCK - 1) / UMF_COMPRESS_BLOCK ;
+    cblobsize = CHEADER + nblocks * sizeof (int64_t) ;
+    for (k = 0 ; k < nblocks ; k++)
+    {
+	cblobsize += block_bound (BLOCK_SIZE (k, size), algo) ;
+    }
+    return (cblobsize) ;
+}
+
+/* ========================================================================== */
+/* === umf_compress_blob ==================================================== */
+/* ========================================================================== */
+
+/* Compresses the plain blob of the given size into cblob.  On input,
+ * *cblobsize is the size of cblob, which must be at least
+ * umf_compressed_blobsize (size, method).  On output, it is the size of the
+ * compressed blob.  Returns UMFPACK_OK, or UMFPACK_ERROR_invalid_blob if cblob
+ * is too small. */
+
+int umf_compress_blob
+(
+    int8_t *cblob,
+    int64_t *cblobsize,
+    const int8_t *blob,
+    int64_t size,
+    int method
+)
+{
+    int algo, level ;
+    int32_t h [2] ;
+    int64_t k, nblocks, offset, bound ;
+
+    get_method (method, &algo, &level) ;
+    if (*cblobsize < umf_compressed_blobsize (size, method))
+    {
+	/* cblob is not large enough */
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* compress each block into the space for its worst case */
+    /* ---------------------------------------------------------------------- */
+
+    /* block k is first compressed at the offset it would have if each prior
+     * block took the most space possible, so that all blocks can be compressed
+     * at the same time without any workspace */
+    nblocks = (size + UMF_COMPRESS_BLOCK - 1) / UMF_COMPRESS_BLOCK ;
+    bound = block_bound (UMF_COMPRESS_BLOCK, algo) ;
+
+#ifdef PARALLEL_COMPRESS
+    int nthreads = omp_get_max_threads ( ) ;
+    nthreads = (int) MAX (1, MIN (nthreads, nblocks)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+#endif
+    for (k = 0 ; k < nblocks ; k++)
+    {
+	int64_t bsize = BLOCK_SIZE (k, size) ;
+	int64_t csize = 0 ;
+	const int8_t *src = blob + k * UMF_COMPRESS_BLOCK ;
+	int8_t *dst = cblob + CHEADER + nblocks * sizeof (int64_t) + k * bound ;
+#ifndef NCOMPRESSION
+	int64_t cap = block_bound (bsize, algo) ;
+	switch (algo)
+	{
+	    default :
+		break ;
+
+	    case UMFPACK_COMPRESSION_LZ4 :
+		csize = LZ4_compress_default ((const char *) src, (char *) dst,
+		    (int) bsize, (int) cap) ;
+		break ;
+
+	    case UMFPACK_COMPRESSION_LZ4HC :
+		csize = LZ4_compress_HC ((const char *) src, (char *) dst,
+		    (int) bsize, (int) cap, level) ;
+		break ;
+
+	    case UMFPACK_COMPRESSION_ZSTD :
+		{
+		    /* an error code is larger than cap */
+		    size_t result = ZSTD_compress (dst, (size_t) cap, src,
+			(size_t) bsize, level) ;
+		    csize = (result > (size_t) cap) ? 0 : ((int64_t) result) ;
+		}
+		break ;
+	}
+#endif
+	if (csize <= 0 || csize >= bsize)
+	{
+	    /* no compression, or it failed or made the block larger */
+	    memcpy (dst, src, bsize) ;
+	    csize = bsize ;
+	}
+	memcpy (cblob + CHEADER + k * sizeof (int64_t), &csize,
+	    sizeof (int64_t)) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* pack the compressed blocks together */
+    /* ---------------------------------------------------------------------- */
+
+    offset = CHEADER + nblocks * sizeof (int64_t) ;
+    for (k = 0 ; k < nblocks ; k++)
+    {
+	int64_t csize ;
+	int8_t *src = cblob + CHEADER + nblocks * sizeof (int64_t) + k * bound ;
+	memcpy (&csize, cblob + CHEADER + k * sizeof (int64_t),
+	    sizeof (int64_t)) ;
+	if (src != cblob + offset)
+	{
+	    /* the block only moves to the left, perhaps overlapping itself */
+	    memmove (cblob + offset, src, csize) ;
+	}
+	offset += csize ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* write the header */
+    /* ---------------------------------------------------------------------- */
+
+    h [0] = UMF_COMPRESSED_VALID ;
+    h [1] = algo ;
+    memcpy (cblob, &offset, sizeof (int64_t)) ;
+    memcpy (cblob + sizeof (int64_t), h, 2 * sizeof (int32_t)) ;
+    memcpy (cblob + sizeof (int64_t) + 2 * sizeof (int32_t), &size,
+	sizeof (int64_t)) ;
+    memcpy (cblob + 2 * sizeof (int64_t) + 2 * sizeof (int32_t), &nblocks,
+	sizeof (int64_t)) ;
+    (*cblobsize) = offset ;
+    return (UMFPACK_OK) ;
+}
+
+/* ========================================================================== */
+/* === umf_compressed_blob_info ============================================= */
+/* ========================================================================== */
+
+/* Returns TRUE if cblob is tagged as a compressed blob, and FALSE otherwise
+ * (in which case it may be a plain blob).  If TRUE, *size is the size of the
+ * plain blob it holds, or zero if that size is not consistent with the size of
+ * cblob.  The rest of the compressed blob is checked by umf_decompress_blob. */
+
+int umf_compressed_blob_info
+(
+    const int8_t *cblob,
+    int64_t cblobsize,
+    int64_t *size
+)
+{
+    int32_t h [2] ;
+    int64_t plain, nblocks ;
+    (*size) = 0 ;
+    if (cblobsize < (int64_t) CHEADER)
+    {
+	return (FALSE) ;
+    }
+    memcpy (h, cblob + sizeof (int64_t), 2 * sizeof (int32_t)) ;
+    if (h [0] != UMF_COMPRESSED_VALID)
+    {
+	return (FALSE) ;
+    }
+    memcpy (&plain, cblob + sizeof (int64_t) + 2 * sizeof (int32_t),
+	sizeof (int64_t)) ;
+    memcpy (&nblocks, cblob + 2 * sizeof (int64_t) + 2 * sizeof (int32_t),
+	sizeof (int64_t)) ;
+    if (plain > 0
+	&& nblocks == (plain - 1) / UMF_COMPRESS_BLOCK + 1
+	&& nblocks <= (cblobsize - (int64_t) CHEADER) / (int64_t) sizeof (int64_t))
+    {
+	/* the blob has room for the size of each block */
+	(*size) = plain ;
+    }
+    return (TRUE) ;
+}
+
+/* ========================================================================== */
+/* === umf_decompress_blob ================================================== */
+/* ========================================================================== */
+
+/* Decompresses the compressed blob cblob of size cblobsize into the plain
+ * blob of the given size, as returned by umf_compressed_blob_info.  Returns
+ * UMFPACK_OK, UMFPACK_ERROR_invalid_blob if cblob is corrupted or uses a
+ * method not available in this build of UMFPACK, or
+ * UMFPACK_ERROR_out_of_memory. */
+
+int umf_decompress_blob
+(
+    int8_t *blob,
+    int64_t size,
+    const int8_t *cblob,
+    int64_t cblobsize
+)
+{
+    int ok = TRUE ;
+    int32_t h [2] ;
+    int64_t k, nblocks, required, plain, *Boffset ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the header */
+    /* ---------------------------------------------------------------------- */
+
+    if (cblobsize < (int64_t) CHEADER)
+    {
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+    memcpy (&required, cblob, sizeof (int64_t)) ;
+    memcpy (h, cblob + sizeof (int64_t), 2 * sizeof (int32_t)) ;
+    memcpy (&plain, cblob + sizeof (int64_t) + 2 * sizeof (int32_t),
+	sizeof (int64_t)) ;
+    memcpy (&nblocks, cblob + 2 * sizeof (int64_t) + 2 * sizeof (int32_t),
+	sizeof (int64_t)) ;
+    if (required > cblobsize || h [0] != UMF_COMPRESSED_VALID
+	|| plain != size || size <= 0
+	|| nblocks != (size + UMF_COMPRESS_BLOCK - 1) / UMF_COMPRESS_BLOCK
+	|| nblocks > (cblobsize - (int64_t) CHEADER) / (int64_t) sizeof (int64_t))
+    {
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+    switch (h [1])
+    {
+	case UMFPACK_COMPRESSION_NONE :
+#ifndef NCOMPRESSION
+	case UMFPACK_COMPRESSION_LZ4 :
+	case UMFPACK_COMPRESSION_LZ4HC :
+	case UMFPACK_COMPRESSION_ZSTD :
+#endif
+	    break ;
+	default :
+	    /* unknown method, or compression is not available */
+	    return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the start of each compressed block */
+    /* ---------------------------------------------------------------------- */
+
+    Boffset = (int64_t *) SuiteSparse_malloc (nblocks + 1, sizeof (int64_t)) ;
+    if (Boffset == NULL)
+    {
+	return (UMFPACK_ERROR_out_of_memory) ;
+    }
+    Boffset [0] = CHEADER + nblocks * sizeof (int64_t) ;
+    for (k = 0 ; ok && k < nblocks ; k++)
+    {
+	int64_t csize ;
+	memcpy (&csize, cblob + CHEADER + k * sizeof (int64_t),
+	    sizeof (int64_t)) ;
+	ok = (csize > 0 && csize <= BLOCK_SIZE (k, size)) ;
+	Boffset [k+1] = Boffset [k] + csize ;
+    }
+    if (!ok || Boffset [nblocks] != required)
+    {
+	(void) SuiteSparse_free (Boffset) ;
+	return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* decompress each block */
+    /* ---------------------------------------------------------------------- */
+
+#ifdef PARALLEL_COMPRESS
+    int nthreads = omp_get_max_threads ( ) ;
+    nthreads = (int) MAX (1, MIN (nthreads, nblocks)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+	reduction(&&:ok)
+#endif
+    for (k = 0 ; k < nblocks ; k++)
+    {
+	int64_t bsize = BLOCK_SIZE (k, size) ;
+	int64_t csize = Boffset [k+1] - Boffset [k] ;
+	const int8_t *src = cblob + Boffset [k] ;
+	int8_t *dst = blob + k * UMF_COMPRESS_BLOCK ;
+	int64_t result = 0 ;
+	if (csize == bsize)
+	{
+	    /* the block is stored as-is */
+	    memcpy (dst, src, bsize) ;
+	    result = bsize ;
+	}
+#ifndef NCOMPRESSION
+	else if (h [1] == UMFPACK_COMPRESSION_ZSTD)
+	{
+	    /* an error code is larger than bsize */
+	    size_t s = ZSTD_decompress (dst, (size_t) bsize, src,
+		(size_t) csize) ;
+	    result = (s > (size_t) bsize) ? (-1) : ((int64_t) s) ;
+	}
+	else if (h [1] != UMFPACK_COMPRESSION_NONE)
+	{
+	    /* LZ4 and LZ4HC use the same decompression method */
+	    result = LZ4_decompress_safe ((const char *) src, (char *) dst,
+		(int) csize, (int) bsize) ;
+	}
+#endif
+	ok = ok && (result == bsize) ;
+    }
+
+    (void) SuiteSparse_free (Boffset) ;
+    return (ok ? UMFPACK_OK : UMFPACK_ERROR_invalid_blob) ;
+}
@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_compress.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/* A compressed blob holds a serialized Symbolic or Numeric object (a "plain"
+ * blob, as created by UMFPACK_serialize_symbolic or UMFPACK_serialize_numeric)
+ * in compressed form.  The plain blob is split into blocks of
+ * UMF_COMPRESS_BLOCK bytes, each of which is compressed independently (and in
+ * parallel) with LZ4, LZ4HC, or ZSTD.  A compressed blob is recognized by
+ * UMFPACK_deserialize_symbolic and UMFPACK_deserialize_numeric, which
+ * decompress it before constructing the object.
+ *
+ * These routines do not depend on the Int or Entry type, and are compiled
+ * only once (see Source2/umf_gn_compress.c). */
+
+/* tag for a compressed blob, in the same place as the valid field of the
+ * header of a plain blob, and distinct from NUMERIC_VALID and SYMBOLIC_VALID */
+#define UMF_COMPRESSED_VALID 338115251
+
+/* size of each block of the plain blob, in bytes */
+#define UMF_COMPRESS_BLOCK (1024 * 1024)
+
+int64_t umf_compressed_blobsize
+(
+    int64_t size,
+    int method
+) ;
+
+int umf_compress_blob
+(
+    int8_t *cblob,
+    int64_t *cblobsize,
+    const int8_t *blob,
+    int64_t size,
+    int method
+) ;
+
+int umf_compressed_blob_info
+(
+    const int8_t *cblob,
+    int64_t cblobsize,
+    int64_t *size
+) ;
+
+int umf_decompress_blob
+(
+    int8_t *blob,
+    int64_t size,
+    const int8_t *cblob,
+    int64_t cblobsize
+) ;
@@ -131,13 +131,27 @@
  * A is m-by-k with leading dimension ldac
  * B is k-by-n with leading dimension ldb
  * C is m-by-n with leading dimension ldac */
-#ifdef COMPLEX
+#if defined (COMPLEX) && defined (SINGLE)
+#define BLAS_GEMM(m,n,k,A,B,ldb,C,ldac,ok) \
+{ \
+    float alpha [2] = {-1,0}, beta [2] = {1,0} ; \
+    SUITESPARSE_BLAS_cgemm ("N", "T", m, n, k, alpha, A, ldac, B, ldb, \
+        beta, C, ldac, ok) ; \
+}
+#elif defined (COMPLEX)
 #define BLAS_GEMM(m,n,k,A,B,ldb,C,ldac,ok) \
 { \
     double alpha [2] = {-1,0}, beta [2] = {1,0} ; \
     SUITESPARSE_BLAS_zgemm ("N", "T", m, n, k, alpha, A, ldac, B, ldb, \
         beta, C, ldac, ok) ; \
 }
+#elif defined (SINGLE)
+#define BLAS_GEMM(m,n,k,A,B,ldb,C,ldac,ok) \
+{ \
+    float alpha = -1, beta = 1 ; \
+    SUITESPARSE_BLAS_sgemm ("N", "T", m, n, k, &alpha, A, ldac, B, ldb, \
+        &beta, C, ldac, ok) ; \
+}
 #else
 #define BLAS_GEMM(m,n,k,A,B,ldb,C,ldac,ok) \
 { \
@@ -156,12 +170,24 @@
  * A is m-by-n with leading dimension d
    x is a column vector with stride 1
    y is a column vector with stride 1 */
-#ifdef COMPLEX
+#if defined (COMPLEX) && defined (SINGLE)
+#define BLAS_GER(m,n,x,y,A,d,ok) \
+{ \
+    float alpha [2] = {-1,0} ; \
+    SUITESPARSE_BLAS_cgeru (m, n, alpha, x, 1, y, 1, A, d, ok) ; \
+}
+#elif defined (COMPLEX)
 #define BLAS_GER(m,n,x,y,A,d,ok) \
 { \
     double alpha [2] = {-1,0} ; \
     SUITESPARSE_BLAS_zgeru (m, n, alpha, x, 1, y, 1, A, d, ok) ; \
 }
+#elif defined (SINGLE)
+#define BLAS_GER(m,n,x,y,A,d,ok) \
+{ \
+    float alpha = -1 ; \
+    SUITESPARSE_BLAS_sger (m, n, &alpha, x, 1, y, 1, A, d, ok) ; \
+}
 #else
 #define BLAS_GER(m,n,x,y,A,d,ok) \
 { \
@@ -178,12 +204,24 @@
 /* y = y - A*x, where A is m-by-n with leading dimension d,
    x is a column vector with stride 1
    y is a column vector with stride 1 */
-#ifdef COMPLEX
+#if defined (COMPLEX) && defined (SINGLE)
+#define BLAS_GEMV(m,n,A,x,y,d,ok) \
+{ \
+    float alpha [2] = {-1,0}, beta [2] = {1,0} ; \
+    SUITESPARSE_BLAS_cgemv ("N", m, n, alpha, A, d, x, 1, beta, y, 1, ok) ; \
+}
+#elif defined (COMPLEX)
 #define BLAS_GEMV(m,n,A,x,y,d,ok) \
 { \
     double alpha [2] = {-1,0}, beta [2] = {1,0} ; \
     SUITESPARSE_BLAS_zgemv ("N", m, n, alpha, A, d, x, 1, beta, y, 1, ok) ; \
 }
+#elif defined (SINGLE)
+#define BLAS_GEMV(m,n,A,x,y,d,ok) \
+{ \
+    float alpha = -1, beta = 1 ; \
+    SUITESPARSE_BLAS_sgemv ("N", m, n, &alpha, A, d, x, 1, &beta, y, 1, ok) ; \
+}
 #else
 #define BLAS_GEMV(m,n,A,x,y,d,ok) \
 { \
@@ -200,11 +238,21 @@
 /* solve Lx=b, where:
  * B is a column vector (m-by-1) with leading dimension d
  * A is m-by-m with leading dimension d */
-#ifdef COMPLEX
+#if defined (COMPLEX) && defined (SINGLE)
+#define BLAS_TRSV(m,A,b,d,ok) \
+{ \
+    SUITESPARSE_BLAS_ctrsv ("L", "N", "U", m, A, d, b, 1, ok) ; \
+}
+#elif defined (COMPLEX)
 #define BLAS_TRSV(m,A,b,d,ok) \
 { \
     SUITESPARSE_BLAS_ztrsv ("L", "N", "U", m, A, d, b, 1, ok) ; \
 }
+#elif defined (SINGLE)
+#define BLAS_TRSV(m,A,b,d,ok) \
+{ \
+    SUITESPARSE_BLAS_strsv ("L", "N", "U", m, A, d, b, 1, ok) ; \
+}
 #else
 #define BLAS_TRSV(m,A,b,d,ok) \
 { \
@@ -220,13 +268,27 @@
 /* solve XL'=B where:
  * B is m-by-n with leading dimension ldb
  * A is n-by-n with leading dimension lda */
-#ifdef COMPLEX
+#if defined (COMPLEX) && defined (SINGLE)
+#define BLAS_TRSM_RIGHT(m,n,A,lda,B,ldb,ok) \
+{ \
+    float alpha [2] = {1,0} ; \
+    SUITESPARSE_BLAS_ctrsm ("R", "L", "T", "U", m, n, alpha, A, \
+        lda, B, ldb, ok) ; \
+}
+#elif defined (COMPLEX)
 #define BLAS_TRSM_RIGHT(m,n,A,lda,B,ldb,ok) \
 { \
     double alpha [2] = {1,0} ; \
     SUITESPARSE_BLAS_ztrsm ("R", "L", "T", "U", m, n, alpha, A, \
         lda, B, ldb, ok) ; \
 }
+#elif defined (SINGLE)
+#define BLAS_TRSM_RIGHT(m,n,A,lda,B,ldb,ok) \
+{ \
+    float alpha = 1 ; \
+    SUITESPARSE_BLAS_strsm ("R", "L", "T", "U", m, n, &alpha, A, \
+        lda, B, ldb, ok) ; \
+}
 #else
 #define BLAS_TRSM_RIGHT(m,n,A,lda,B,ldb,ok) \
 { \
@@ -242,7 +304,15 @@
 /* -------------------------------------------------------------------------- */
 
 /* x = s*x, where x is a stride-1 vector of length n */
-#ifdef COMPLEX
+#if defined (COMPLEX) && defined (SINGLE)
+#define BLAS_SCAL(n,s,x,ok) \
+{ \
+    float alpha [2] ; \
+    alpha [0] = REAL_COMPONENT (s) ; \
+    alpha [1] = IMAG_COMPONENT (s) ; \
+    SUITESPARSE_BLAS_cscal (n, alpha, x, 1, ok) ; \
+}
+#elif defined (COMPLEX)
 #define BLAS_SCAL(n,s,x,ok) \
 { \
     double alpha [2] ; \
@@ -250,6 +320,12 @@
     alpha [1] = IMAG_COMPONENT (s) ; \
     SUITESPARSE_BLAS_zscal (n, alpha, x, 1, ok) ; \
 }
+#elif defined (SINGLE)
+#define BLAS_SCAL(n,s,x,ok) \
+{ \
+    float alpha = REAL_COMPONENT (s) ; \
+    SUITESPARSE_BLAS_sscal (n, &alpha, x, 1, ok) ; \
+}
 #else
 #define BLAS_SCAL(n,s,x,ok) \
 { \
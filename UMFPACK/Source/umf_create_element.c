@@ -34,6 +34,125 @@ UMFPACK_IVDEP
     }
 }
 
+/* ========================================================================== */
+/* === ilu_prune ============================================================ */
+/* ========================================================================== */
+
+/* Incomplete LU: remove the rows and columns of the contribution block whose
+ * entries are all <= droptol in magnitude, so that they are not carried into
+ * subsequent frontal matrices.  Rows are only removed if the next frontal
+ * matrix does not inherit the rows of this one (and likewise for columns),
+ * and only if the row (or column) still has entries in other elements, so
+ * that it cannot become empty.  The front is compacted in place. */
+
+PRIVATE void ilu_prune
+(
+    NumericType *Numeric,
+    WorkType *Work,
+    SymbolicType *Symbolic
+)
+{
+    double s, tol ;
+    Entry *Fcblock, *Fs, *Fd ;
+    Int i, j, k, row, col, fnrows, fncols, fnr_curr, keep, *Frows, *Fcols,
+	*Frpos, *Fcpos, *Row_degree, *Col_degree ;
+
+    tol = Work->ilu_droptol ;
+    if (tol <= 0)
+    {
+	return ;
+    }
+
+    Row_degree = Numeric->Rperm ;
+    Col_degree = Numeric->Cperm ;
+    Frows = Work->Frows ;
+    Fcols = Work->Fcols ;
+    Frpos = Work->Frpos ;
+    Fcpos = Work->Fcpos ;
+    Fcblock = Work->Fcblock ;
+    fnrows = Work->fnrows ;
+    fncols = Work->fncols ;
+    fnr_curr = Work->fnr_curr ;
+
+    /* ---------------------------------------------------------------------- */
+    /* remove small columns */
+    /* ---------------------------------------------------------------------- */
+
+    if (!Work->pivrow_in_front && !Symbolic->fixQ)
+    {
+	k = 0 ;
+	for (j = 0 ; j < fncols ; j++)
+	{
+	    col = Fcols [j] ;
+	    Fs = Fcblock + j * fnr_curr ;
+	    keep = (col == Work->pivcol || Col_degree [col] <= 0) ;
+	    for (i = 0 ; !keep && i < fnrows ; i++)
+	    {
+		APPROX_ABS (s, Fs [i]) ;
+		keep = (s > tol) ;
+	    }
+	    if (keep)
+	    {
+		if (k < j)
+		{
+		    Fd = Fcblock + k * fnr_curr ;
+		    copy_column (fnrows, Fs, Fd) ;
+		    Fcols [k] = col ;
+		}
+		Fcpos [col] = k * fnr_curr ;
+		k++ ;
+	    }
+	    else
+	    {
+		Fcpos [col] = EMPTY ;
+	    }
+	}
+	DEBUG2 (("ilu: dropped "ID" of "ID" columns\n", fncols - k, fncols)) ;
+	fncols = k ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* remove small rows */
+    /* ---------------------------------------------------------------------- */
+
+    if (!Work->pivcol_in_front)
+    {
+	k = 0 ;
+	for (i = 0 ; i < fnrows ; i++)
+	{
+	    row = Frows [i] ;
+	    keep = (row == Work->pivrow || Row_degree [row] <= 0) ;
+	    for (j = 0 ; !keep && j < fncols ; j++)
+	    {
+		APPROX_ABS (s, Fcblock [i + j * fnr_curr]) ;
+		keep = (s > tol) ;
+	    }
+	    if (keep)
+	    {
+		if (k < i)
+		{
+		    for (j = 0 ; j < fncols ; j++)
+		    {
+			Fcblock [k + j * fnr_curr] = Fcblock [i + j * fnr_curr];
+		    }
+		    Frows [k] = row ;
+		}
+		Frpos [row] = k ;
+		k++ ;
+	    }
+	    else
+	    {
+		Frpos [row] = EMPTY ;
+	    }
+	}
+	DEBUG2 (("ilu: dropped "ID" of "ID" rows\n", fnrows - k, fnrows)) ;
+	fnrows = k ;
+    }
+
+    Work->fnrows = fnrows ;
+    Work->fncols = fncols ;
+}
+
 /* ========================================================================== */
 /* === UMF_create_element =================================================== */
 /* ========================================================================== */
@@ -89,6 +208,14 @@ Int UMF_create_element
     tp1 = (Tuple *) NULL ;
     tp2 = (Tuple *) NULL ;
 
+    if (Work->ilu)
+    {
+	/* incomplete LU: remove small rows and columns from the front */
+	ilu_prune (Numeric, Work, Symbolic) ;
+	fncols = Work->fncols ;
+	fnrows = Work->fnrows ;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* add the current frontal matrix to the degrees of each column */
     /* ---------------------------------------------------------------------- */
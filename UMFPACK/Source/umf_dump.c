@@ -924,9 +924,9 @@ void UMF_dump_packed_memory
 
 void UMF_dump_col_matrix
 (
-    const double Ax [ ],	/* Ax [0..nz-1]: real values, in column order */
+    const Scalar Ax [ ],	/* Ax [0..nz-1]: real values, in column order */
 #ifdef COMPLEX
-    const double Az [ ],	/* Az [0..nz-1]: imag values, in column order */
+    const Scalar Az [ ],	/* Az [0..nz-1]: imag values, in column order */
 #endif
     const Int Ai [ ],		/* Ai [0..nz-1]: row indices, in column order */
     const Int Ap [ ],		/* Ap [0..n_col]: column pointers */
@@ -964,7 +964,7 @@ void UMF_dump_col_matrix
 	    row = Ai [p] ;
 	    ASSERT (row >= 0 && row < n_row) ;
 	    DEBUG6 (("\t"ID" ", row)) ;
-	    if (Ax != (double *) NULL)
+	    if (Ax != (Scalar *) NULL)
 	    {
 #ifdef COMPLEX
 		if (split)
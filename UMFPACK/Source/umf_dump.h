@@ -68,9 +68,9 @@ void UMF_dump_packed_memory
 
 void UMF_dump_col_matrix
 (
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     const Int Ai [ ],
     const Int Ap [ ],
@@ -10,7 +10,8 @@
 /*
     Reallocate the workspace (Numeric->Memory) and shift elements downwards.
     needunits: increase in size so that the free space is at least this many
-    Units (to which the tuple lengths is added).
+    Units (to which the tuple lengths is added).  Numeric->Memory is never
+    made larger than Work->max_size, if that limit is nonzero.
 
     Return TRUE if successful, FALSE if out of memory.
 */
@@ -114,6 +115,19 @@ Int UMF_get_memory
     }
     newsize = MAX (newsize, Numeric->size) ;
 
+    if (Work->max_size > 0 && newsize > Work->max_size)
+    {
+	/* Do not exceed the memory limit (Control [UMFPACK_MEMORY_LIMIT]). */
+	/* If this is not enough, rely on garbage collection instead. */
+	DEBUGm3 (("Realloc hit memory limit "ID"\n", Work->max_size)) ;
+	newsize = Work->max_size ;
+	if (newsize < Numeric->size + 2)
+	{
+	    newsize = Numeric->size ;
+	}
+	minsize = MIN (minsize, newsize) ;
+    }
+
     DEBUG0 ((
     "REALLOC MEMORY: needunits "ID" old size: "ID" new size: "ID" Units \n",
 	needunits, Numeric->size, newsize)) ;
@@ -128,7 +142,7 @@ Int UMF_get_memory
     /* reallocate the memory, if possible, and make it bigger */
     /* ---------------------------------------------------------------------- */
 
-    mnew = (Unit *) NULL ;
+    mnew = (newsize == Numeric->size) ? Numeric->Memory : (Unit *) NULL ;
     while (!mnew)
     {
 	mnew = (Unit *) UMF_realloc (Numeric->Memory, newsize, sizeof (Unit)) ;
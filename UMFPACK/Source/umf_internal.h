@@ -198,7 +198,7 @@
 /* integer type for AMD: int32_t or int64_t */
 /* ------------------------------------------------------------------------- */
 
-#if defined (DLONG) || defined (ZLONG)
+#if defined (DLONG) || defined (ZLONG) || defined (SLONG) || defined (CLONG)
 
     #define Int int64_t
     #define UInt uint64_t
@@ -495,9 +495,10 @@ typedef union Unit_union Unit ;
     first defense against corrupted *Symbolic or *Numeric pointers passed to an
     UMFPACK routine.  They also ensure that the objects are used only by the
     same version that created them (umfpack_di_*, umfpack_dl_*, umfpack_zi_*,
-    or umfpack_zl_*).  The values have also been changed since prior releases of
-    the code to ensure that all routines that operate on the objects are of the
-    same release.  The values themselves are purely arbitrary.  They are less
+    umfpack_zl_*, umfpack_si_*, umfpack_sl_*, umfpack_ci_*, or umfpack_cl_*).
+    The values have also been changed since prior releases of the code to
+    ensure that all routines that operate on the objects are of the same
+    release.  The values themselves are purely arbitrary.  They are less
     than the ANSI C required minimums of INT_MAX and LONG_MAX, respectively.
 */
 
@@ -517,6 +518,22 @@ typedef union Unit_union Unit ;
 #define NUMERIC_VALID  129987754
 #define SYMBOLIC_VALID 110291734
 #endif
+#ifdef SINT
+#define NUMERIC_VALID  19937
+#define SYMBOLIC_VALID 43977
+#endif
+#ifdef SLONG
+#define NUMERIC_VALID  319989761
+#define SYMBOLIC_VALID 311293715
+#endif
+#ifdef CINT
+#define NUMERIC_VALID  21997
+#define SYMBOLIC_VALID 46957
+#endif
+#ifdef CLONG
+#define NUMERIC_VALID  229987753
+#define SYMBOLIC_VALID 210291737
+#endif
 
 typedef struct	/* NumericType */
 {
@@ -534,7 +551,8 @@ typedef struct	/* NumericType */
 	rcond ;		/* min (D) / max (D) */
 
     Int
-	scale ;
+	scale,
+	ilu ;		/* TRUE if an incomplete LU factorization */
 
     Int valid ;		/* set to NUMERIC_VALID, for validity check */
 
@@ -603,6 +621,13 @@ typedef struct	/* NumericType */
 
     Int maxnrows, maxncols ;	/* not the same as Symbolic->maxnrows/cols* */
 
+    /* for a Numeric object that lives in a serialized blob: */
+    Int view ;		/* TRUE if D, Rperm, ..., Memory point into a blob */
+			/* owned by the user, and are not free'd by */
+			/* UMFPACK_free_numeric */
+    void *map ;		/* the blob, if mmap'ed by UMFPACK_load_numeric_mmap */
+    int64_t mapsize ;	/* size of the mapping, in bytes */
+
 } NumericType ;
 
 
@@ -838,6 +863,15 @@ typedef struct	/* WorkType */
 	pivrow_in_front,	/* true if current pivot row in Frows */
 	pivcol_in_front ;	/* true if current pivot column in Fcols */
 
+    Int max_size ;	/* largest allowed size of Numeric->Memory, in Units, */
+			/* from Control [UMFPACK_MEMORY_LIMIT] (0: no limit) */
+
+    Int ilu ;		/* true if computing an incomplete LU factorization */
+    Int ilu_fill ;	/* max # entries kept in each col of L, row of U */
+    double ilu_droptol ;	/* drop tolerance for incomplete LU */
+
+    Int nthreads ;	/* # of threads for the row scale factors */
+
     /* ----------------------------------------------------------------------
      * Current frontal matrix
      * ----------------------------------------------------------------------
@@ -37,9 +37,9 @@ Int UMF_kernel
 (
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     NumericType *Numeric,
     WorkType *Work,
@@ -82,7 +82,7 @@ Int UMF_kernel
     Front_npivcol = Symbolic->Front_npivcol ;
     nb = Symbolic->nb ;
     fixQ = Symbolic->fixQ ;
-    drop = Numeric->droptol > 0.0 ;
+    drop = Numeric->droptol > 0.0 || Work->ilu ;
 
 #ifndef NDEBUG
     for (chain = 0 ; chain < nchains ; chain++)
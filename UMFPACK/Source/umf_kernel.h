@@ -11,9 +11,9 @@ Int UMF_kernel
 (
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     NumericType *Numeric,
     WorkType *Work,
@@ -29,6 +29,138 @@
 #include "umf_mem_free_tail_block.h"
 #include "umf_scale.h"
 
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+/* the debug and test-coverage code is not thread-safe */
+#define PARALLEL_SCALE
+#endif
+
+#ifdef PARALLEL_SCALE
+
+/* ========================================================================== */
+/* === scale_factors ======================================================== */
+/* ========================================================================== */
+
+/* Compute the row scale factors with nthreads threads, and check the input
+ * matrix.  Each thread handles a contiguous range of rows and scans the
+ * columns in order, so each Rs [row] is summed in the same order as in the
+ * sequential code and the result is identical.  Returns FALSE if the matrix
+ * is invalid. */
+
+PRIVATE Int scale_factors
+(
+    Int n_row,
+    Int n_col,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const Scalar Ax [ ],
+#ifdef COMPLEX
+    const Scalar Az [ ],
+    Int split,
+#endif
+    int do_max,
+    double Rs [ ],
+    Int nthreads
+)
+{
+    Int col, p, p1, p2, row, ilast, t, ok ;
+
+    /* check the matrix: columns must be sorted, with no duplicates */
+    ok = TRUE ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+	private(p, p1, p2, row, ilast) reduction(&&:ok)
+    for (col = 0 ; col < n_col ; col++)
+    {
+	if (!ok) continue ;
+	ilast = EMPTY ;
+	p1 = Ap [col] ;
+	p2 = Ap [col+1] ;
+	if (p1 > p2)
+	{
+	    ok = FALSE ;
+	    continue ;
+	}
+	for (p = p1 ; p < p2 ; p++)
+	{
+	    row = Ai [p] ;
+	    if (row <= ilast || row >= n_row)
+	    {
+		ok = FALSE ;
+		break ;
+	    }
+	    ilast = row ;
+	}
+    }
+    if (!ok)
+    {
+	return (FALSE) ;
+    }
+
+    /* compute the scale factors, one range of rows for each thread */
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(col, p, p1, p2, row)
+    for (t = 0 ; t < nthreads ; t++)
+    {
+	Int r1 = (Int) (((double) n_row) * t / nthreads) ;
+	Int r2 = (Int) (((double) n_row) * (t+1) / nthreads) ;
+	if (t == nthreads-1) r2 = n_row ;
+	for (row = r1 ; row < r2 ; row++)
+	{
+	    Rs [row] = 0.0 ;
+	}
+	for (col = 0 ; col < n_col ; col++)
+	{
+	    p1 = Ap [col] ;
+	    p2 = Ap [col+1] ;
+	    if (p1 == p2 || Ai [p1] >= r2 || Ai [p2-1] < r1) continue ;
+	    if (Ai [p1] < r1)
+	    {
+		/* find the first entry in row r1 or later */
+		Int lo = p1, hi = p2 - 1 ;
+		while (lo < hi)
+		{
+		    Int mid = (lo + hi) / 2 ;
+		    if (Ai [mid] < r1)
+		    {
+			lo = mid + 1 ;
+		    }
+		    else
+		    {
+			hi = mid ;
+		    }
+		}
+		p1 = lo ;
+	    }
+	    for (p = p1 ; p < p2 && Ai [p] < r2 ; p++)
+	    {
+		Entry aij ;
+		double value, rs ;
+		row = Ai [p] ;
+		ASSIGN (aij, Ax, Az, p, split) ;
+		APPROX_ABS (value, aij) ;
+		rs = Rs [row] ;
+		if (!SCALAR_IS_NAN (rs))
+		{
+		    if (SCALAR_IS_NAN (value))
+		    {
+			Rs [row] = value ;
+		    }
+		    else if (do_max)
+		    {
+			Rs [row] = MAX (rs, value) ;
+		    }
+		    else
+		    {
+			Rs [row] += value ;
+		    }
+		}
+	    }
+	}
+    }
+    return (TRUE) ;
+}
+
+#endif
+
 /* ========================================================================== */
 /* === packsp =============================================================== */
 /* ========================================================================== */
@@ -140,9 +272,9 @@ Int UMF_kernel_init
 (
     const Int Ap [ ],		/* user's input matrix (not modified) */
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     NumericType *Numeric,
     WorkType *Work,
@@ -356,55 +488,74 @@ Int UMF_kernel_init
     if (do_scale)
     {
 	int do_max = Numeric->scale == UMFPACK_SCALE_MAX ;
-	for (row = 0 ; row < n_row ; row++)
+#ifdef PARALLEL_SCALE
+	Int nthreads = MIN (Work->nthreads, nz / UMF_SCALE_CHUNK) ;
+	if (nthreads > 1)
 	{
-	    Rs [row] = 0.0 ;
-	}
-	for (col = 0 ; col < n_col ; col++)
-	{
-	    ilast = EMPTY ;
-	    p1 = Ap [col] ;
-	    p2 = Ap [col+1] ;
-	    if (p1 > p2)
+	    if (!scale_factors (n_row, n_col, Ap, Ai, Ax,
+#ifdef COMPLEX
+		Az, split,
+#endif
+		do_max, Rs, nthreads))
 	    {
 		/* invalid matrix */
-		DEBUGm4 (("invalid matrix (Ap)\n")) ;
 		return (FALSE) ;
 	    }
-	    for (p = p1 ; p < p2 ; p++)
+	}
+	else
+#endif
+	{
+	    for (row = 0 ; row < n_row ; row++)
+	    {
+		Rs [row] = 0.0 ;
+	    }
+	    for (col = 0 ; col < n_col ; col++)
 	    {
-		Entry aij ;
-		double value ;
-		row = Ai [p] ;
-		if (row <= ilast || row >= n_row)
+		ilast = EMPTY ;
+		p1 = Ap [col] ;
+		p2 = Ap [col+1] ;
+		if (p1 > p2)
 		{
-		    /* invalid matrix, columns must be sorted, no duplicates */
-		    DEBUGm4 (("invalid matrix (Ai)\n")) ;
+		    /* invalid matrix */
+		    DEBUGm4 (("invalid matrix (Ap)\n")) ;
 		    return (FALSE) ;
 		}
-		ASSIGN (aij, Ax, Az, p, split) ;
-		APPROX_ABS (value, aij) ;
-		rs = Rs [row] ;
-		if (!SCALAR_IS_NAN (rs))
+		for (p = p1 ; p < p2 ; p++)
 		{
-		    if (SCALAR_IS_NAN (value))
+		    Entry aij ;
+		    double value ;
+		    row = Ai [p] ;
+		    if (row <= ilast || row >= n_row)
 		    {
-			/* if any entry in the row is NaN, then the scale factor
-			 * is NaN too (for now) and then set to 1.0 below */
-			Rs [row] = value ;
+			/* invalid matrix: columns must be sorted, no duplicates */
+			DEBUGm4 (("invalid matrix (Ai)\n")) ;
+			return (FALSE) ;
 		    }
-		    else if (do_max)
+		    ASSIGN (aij, Ax, Az, p, split) ;
+		    APPROX_ABS (value, aij) ;
+		    rs = Rs [row] ;
+		    if (!SCALAR_IS_NAN (rs))
 		    {
-			Rs [row] = MAX (rs, value) ;
-		    }
-		    else
-		    {
-			Rs [row] += value ;
+			if (SCALAR_IS_NAN (value))
+			{
+			    /* if any entry in the row is NaN, then the scale
+			     * factor is NaN too (for now) and then set to 1.0
+			     * below */
+			    Rs [row] = value ;
+			}
+			else if (do_max)
+			{
+			    Rs [row] = MAX (rs, value) ;
+			}
+			else
+			{
+			    Rs [row] += value ;
+			}
 		    }
+		    DEBUG4 (("i "ID" j "ID" value %g,  Rs[i]: %g\n",
+			row, col, value, Rs[row])) ;
+		    ilast = row ;
 		}
-		DEBUG4 (("i "ID" j "ID" value %g,  Rs[i]: %g\n",
-		    row, col, value, Rs[row])) ;
-		ilast = row ;
 	    }
 	}
 	DEBUG2 (("Rs[0] = %30.20e\n", Rs [0])) ;
@@ -7,13 +7,16 @@
 
 //------------------------------------------------------------------------------
 
+/* minimum number of entries for each thread when computing scale factors */
+#define UMF_SCALE_CHUNK (256*1024)
+
 Int UMF_kernel_init
 (
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     NumericType *Numeric,
     WorkType *Work,
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_lz4: wrapper for the LZ4 compression library
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Compiles the unmodified lz4.c and lz4hc.c from UMFPACK/lz4 into UMFPACK,
+    with all of the LZ4_* symbols renamed (see umf_codec.h).  LZ4 is compiled
+    with LZ4_USER_MEMORY_FUNCTIONS, and uses the SuiteSparse memory manager in
+    place of malloc, calloc, and free.  Nothing is compiled if NCOMPRESSION is
+    defined.
+*/
+
+#include "umfpack.h"
+
+#ifndef NCOMPRESSION
+#include "umf_codec.h"
+
+void *LZ4_malloc (size_t s)
+{
+    return (SuiteSparse_malloc (1, s)) ;
+}
+
+void *LZ4_calloc (size_t n, size_t s)
+{
+    return (SuiteSparse_calloc (n, s)) ;
+}
+
+void LZ4_free (void *p)
+{
+    (void) SuiteSparse_free (p) ;
+}
+
+/* LZ4 uses switch statements with no default case */
+#if defined (__GNUC__)
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#include "lz4.c"
+#include "lz4hc.c"
+
+#endif
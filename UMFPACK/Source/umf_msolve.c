@@ -0,0 +1,1382 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_msolve: solve a linear system with multiple right-hand sides
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Not user-callable.  Solves a linear system with nrhs right-hand sides,
+    using the numerical factorization computed by UMFPACK_numeric.  The
+    right-hand sides are taken UMF_MSOLVE_NB at a time, and each block is
+    held in the workspace with the UMF_MSOLVE_NB entries of each row stored
+    contiguously.  The forward and backward solves then walk the Lchains and
+    Uchains in Numeric->Memory once per block instead of once per column, as
+    UMF_lsolve, UMF_usolve, UMF_ltsolve, and UMF_utsolve would.  The same
+    operations are done on each column as in those routines, in the same
+    order.  No workspace is dynamically allocated.
+
+    Iterative refinement for Ax=b, A'x=b, and A.'x=b is done as in UMF_solve,
+    with a separate backward error and stopping test for each column.  A
+    column that has converged is dropped from the block, and the correction
+    solves for the remaining ones still share a single pass over L and U.
+
+    Info [UMFPACK_IR_TAKEN], Info [UMFPACK_IR_ATTEMPTED], Info [UMFPACK_OMEGA1]
+    and Info [UMFPACK_OMEGA2] are the largest values over all columns.
+    Info [UMFPACK_SOLVE_FLOPS] is the total for all columns.
+
+    Returns UMFPACK_OK, UMFPACK_WARNING_singular_matrix,
+    UMFPACK_ERROR_argument_missing, or UMFPACK_ERROR_invalid_system, just
+    like UMF_solve.
+*/
+
+#include "umf_internal.h"
+#include "umf_msolve.h"
+
+#define NB UMF_MSOLVE_NB
+
+/* offset of column j of a dense matrix with leading dimension ld */
+#define COL_OFFSET(j,ld,split) ((split) ? ((j) * (ld)) : (2 * (j) * (ld)))
+
+/* apply the row scale factor Rs [i] to an entry, or to a scalar */
+#define SCALE_ROW(x,i) \
+{ \
+    if (do_recip) \
+    { \
+	SCALE (x, Rs [i]) ; \
+    } \
+    else \
+    { \
+	SCALE_DIV (x, Rs [i]) ; \
+    } \
+}
+#define SCALE_ROW_SCALAR(d,i) \
+{ \
+    (d) = (do_recip) ? ((d) * Rs [i]) : ((d) / Rs [i]) ; \
+}
+
+/* ========================================================================== */
+/* === block kernels ======================================================== */
+/* ========================================================================== */
+
+/* In all of the following, X [k*NB + c] holds entry k of column c of the
+ * block of right-hand sides. */
+
+/* -------------------------------------------------------------------------- */
+/* nonzeros: find the columns with a nonzero entry in row xr of a block */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE Int nonzeros
+(
+    const Entry xr [ ],
+    Entry xk [ ],
+    Int Cols [ ]
+)
+{
+    Int c, nz = 0 ;
+    for (c = 0 ; c < NB ; c++)
+    {
+	if (IS_NONZERO (xr [c]))
+	{
+	    xk [nz] = xr [c] ;
+	    Cols [nz++] = c ;
+	}
+    }
+    return (nz) ;
+}
+
+/* -------------------------------------------------------------------------- */
+/* scatter:  X (Xi [j], Cols) -= xk * xp [j], for j = 0..deg-1 */
+/* -------------------------------------------------------------------------- */
+
+/* xk [t] is the multiplier for column Cols [t], t = 0..nz-1, and
+ * Cols [t] == t if nz == NB.  The conjugate of xp [j] is used if conj is
+ * TRUE. */
+
+PRIVATE void scatter
+(
+    Entry X [ ],
+    const Int Xi [ ],
+    const Entry xp [ ],
+    Int deg,
+    const Entry xk [ ],
+    const Int Cols [ ],
+    Int nz,
+    Int conj
+)
+{
+    Entry *xr ;
+    Int j, c, t ;
+
+    for (j = 0 ; j < deg ; j++)
+    {
+	xr = X + Xi [j] * NB ;
+	if (nz == NB)
+	{
+#ifdef COMPLEX
+	    if (conj)
+	    {
+		for (c = 0 ; c < NB ; c++)
+		{
+		    MULT_SUB_CONJ (xr [c], xk [c], xp [j]) ;
+		}
+	    }
+	    else
+#endif
+	    {
+		for (c = 0 ; c < NB ; c++)
+		{
+		    MULT_SUB (xr [c], xk [c], xp [j]) ;
+		}
+	    }
+	}
+	else
+	{
+#ifdef COMPLEX
+	    if (conj)
+	    {
+		for (t = 0 ; t < nz ; t++)
+		{
+		    MULT_SUB_CONJ (xr [Cols [t]], xk [t], xp [j]) ;
+		}
+	    }
+	    else
+#endif
+	    {
+		for (t = 0 ; t < nz ; t++)
+		{
+		    MULT_SUB (xr [Cols [t]], xk [t], xp [j]) ;
+		}
+	    }
+	}
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* gather:  xk -= X (Xi [j], :) * xp [j], for j = 0..deg-1 */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE void gather
+(
+    Entry xk [ ],
+    const Entry X [ ],
+    const Int Xi [ ],
+    const Entry xp [ ],
+    Int deg,
+    Int conj
+)
+{
+    const Entry *xr ;
+    Int j, c ;
+
+    for (j = 0 ; j < deg ; j++)
+    {
+	xr = X + Xi [j] * NB ;
+#ifdef COMPLEX
+	if (conj)
+	{
+	    for (c = 0 ; c < NB ; c++)
+	    {
+		MULT_SUB_CONJ (xk [c], xr [c], xp [j]) ;
+	    }
+	}
+	else
+#endif
+	{
+	    for (c = 0 ; c < NB ; c++)
+	    {
+		MULT_SUB (xk [c], xr [c], xp [j]) ;
+	    }
+	}
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* divide:  xr = xk / d, or xk / conjugate (d) */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE void divide
+(
+    Entry xr [ ],
+    const Entry xk [ ],
+    Entry d,
+    Int conj
+)
+{
+    Int c ;
+
+#ifdef NO_DIVIDE_BY_ZERO
+    /* Do not divide by zero */
+    if (IS_ZERO (d)) return ;
+#endif
+
+#ifdef COMPLEX
+    if (conj)
+    {
+	for (c = 0 ; c < NB ; c++)
+	{
+	    DIV_CONJ (xr [c], xk [c], d) ;
+	}
+    }
+    else
+#endif
+    {
+	for (c = 0 ; c < NB ; c++)
+	{
+	    DIV (xr [c], xk [c], d) ;
+	}
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* lsolve_block:  solve L X = B, as UMF_lsolve */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE double lsolve_block
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int Pattern [ ]
+)
+{
+    Entry xk [NB] ;
+    Entry *xp, *Lval ;
+    Int Cols [NB], k, deg, *ip, j, *Lpos, *Lilen, *Lip, llen, lp, pos, npiv,
+	n1, *Li, nz ;
+
+    npiv = Numeric->npiv ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    n1 = Numeric->n1 ;
+
+    /* singletons */
+    for (k = 0 ; k < n1 ; k++)
+    {
+	deg = Lilen [k] ;
+	if (deg > 0)
+	{
+	    nz = nonzeros (X + k*NB, xk, Cols) ;
+	    if (nz > 0)
+	    {
+		lp = Lip [k] ;
+		Li = (Int *) (Numeric->Memory + lp) ;
+		lp += UNITS (Int, deg) ;
+		Lval = (Entry *) (Numeric->Memory + lp) ;
+		scatter (X, Li, Lval, deg, xk, Cols, nz, FALSE) ;
+	    }
+	}
+    }
+
+    /* rest of L */
+    deg = 0 ;
+    for (k = n1 ; k < npiv ; k++)
+    {
+	/* make column of L in Pattern [0..deg-1] */
+	lp = Lip [k] ;
+	if (lp < 0)
+	{
+	    /* start of a new Lchain */
+	    lp = -lp ;
+	    deg = 0 ;
+	}
+	pos = Lpos [k] ;
+	if (pos != EMPTY)
+	{
+	    /* remove pivot row */
+	    ASSERT (deg > 0 && pos >= 0 && pos < deg) ;
+	    ASSERT (Pattern [pos] == k) ;
+	    Pattern [pos] = Pattern [--deg] ;
+	}
+	ip = (Int *) (Numeric->Memory + lp) ;
+	llen = Lilen [k] ;
+	for (j = 0 ; j < llen ; j++)
+	{
+	    /* concatenate the pattern */
+	    Pattern [deg++] = *ip++ ;
+	}
+
+	/* use column k of L */
+	nz = nonzeros (X + k*NB, xk, Cols) ;
+	if (nz > 0)
+	{
+	    xp = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	    scatter (X, Pattern, xp, deg, xk, Cols, nz, FALSE) ;
+	}
+    }
+
+    return (MULTSUB_FLOPS * ((double) Numeric->lnz)) ;
+}
+
+/* -------------------------------------------------------------------------- */
+/* usolve_block:  solve U X = B, as UMF_usolve */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE double usolve_block
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int Pattern [ ]
+)
+{
+    Entry xk [NB] ;
+    Entry *xp, *D, *Uval ;
+    Int c, k, deg, j, *ip, *Upos, *Uilen, pos, *Uip, n, ulen, up, newUchain,
+	npiv, n1, *Ui ;
+
+    n = Numeric->n_row ;
+    npiv = Numeric->npiv ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+    D = Numeric->D ;
+    n1 = Numeric->n1 ;
+
+#ifndef NO_DIVIDE_BY_ZERO
+    /* handle the singular part of D, up to just before the last pivot */
+    for (k = n-1 ; k >= npiv ; k--)
+    {
+	/* This is an *** intentional *** divide-by-zero, to get Inf or Nan,
+	 * as appropriate.  It is not a bug. */
+	divide (X + k*NB, X + k*NB, D [k], FALSE) ;
+    }
+#endif
+
+    deg = Numeric->ulen ;
+    for (j = 0 ; j < deg ; j++)
+    {
+	/* make last pivot row of U (singular matrices only) */
+	Pattern [j] = Numeric->Upattern [j] ;
+    }
+
+    /* nonsingletons */
+    for (k = npiv-1 ; k >= n1 ; k--)
+    {
+	/* use row k of U */
+	up = Uip [k] ;
+	ulen = Uilen [k] ;
+	newUchain = (up < 0) ;
+	if (newUchain)
+	{
+	    up = -up ;
+	    xp = (Entry *) (Numeric->Memory + up + UNITS (Int, ulen)) ;
+	}
+	else
+	{
+	    xp = (Entry *) (Numeric->Memory + up) ;
+	}
+	for (c = 0 ; c < NB ; c++)
+	{
+	    xk [c] = X [k*NB + c] ;
+	}
+	gather (xk, X, Pattern, xp, deg, FALSE) ;
+	divide (X + k*NB, xk, D [k], FALSE) ;
+
+	/* make row k-1 of U in Pattern [0..deg-1] */
+	if (k == n1) break ;
+	if (newUchain)
+	{
+	    /* next row is a new Uchain */
+	    deg = ulen ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Pattern [j] = *ip++ ;
+	    }
+	}
+	else
+	{
+	    deg -= ulen ;
+	    ASSERT (deg >= 0) ;
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add the pivot column */
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+    }
+
+    /* singletons */
+    for (k = n1 - 1 ; k >= 0 ; k--)
+    {
+	deg = Uilen [k] ;
+	for (c = 0 ; c < NB ; c++)
+	{
+	    xk [c] = X [k*NB + c] ;
+	}
+	if (deg > 0)
+	{
+	    up = Uip [k] ;
+	    Ui = (Int *) (Numeric->Memory + up) ;
+	    up += UNITS (Int, deg) ;
+	    Uval = (Entry *) (Numeric->Memory + up) ;
+	    gather (xk, X, Ui, Uval, deg, FALSE) ;
+	}
+	divide (X + k*NB, xk, D [k], FALSE) ;
+    }
+
+    return (DIV_FLOPS * ((double) n) + MULTSUB_FLOPS * ((double) Numeric->unz));
+}
+
+/* -------------------------------------------------------------------------- */
+/* ltsolve_block:  solve L' X = B or L.' X = B, as UMF_lhsolve, UMF_ltsolve */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE double ltsolve_block
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int Pattern [ ],
+    Int conj
+)
+{
+    Entry xk [NB] ;
+    Entry *xp, *Lval ;
+    Int c, k, deg, *ip, j, *Lpos, *Lilen, kstart, kend, *Lip, llen, lp, pos,
+	npiv, n1, *Li ;
+
+    npiv = Numeric->npiv ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    kstart = npiv ;
+    n1 = Numeric->n1 ;
+
+    /* non-singletons */
+    for (kend = npiv-1 ; kend >= n1 ; kend = kstart-1)
+    {
+	/* find the start of this Lchain */
+	kstart = kend ;
+	while (kstart >= 0 && Lip [kstart] > 0)
+	{
+	    kstart-- ;
+	}
+
+	/* scan the whole chain to find the pattern of the last column of L */
+	deg = 0 ;
+	for (k = kstart ; k <= kend ; k++)
+	{
+	    pos = Lpos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* remove pivot row */
+		ASSERT (k != kstart && pos >= 0 && pos < deg) ;
+		Pattern [pos] = Pattern [--deg] ;
+	    }
+	    lp = (k == kstart) ? (-Lip [k]) : (Lip [k]) ;
+	    ip = (Int *) (Numeric->Memory + lp) ;
+	    llen = Lilen [k] ;
+	    for (j = 0 ; j < llen ; j++)
+	    {
+		/* concatenate the pattern */
+		Pattern [deg++] = *ip++ ;
+	    }
+	}
+
+	/* solve using this chain, in reverse order */
+	for (k = kend ; k >= kstart ; k--)
+	{
+	    /* use column k of L */
+	    lp = (k == kstart) ? (-Lip [k]) : (Lip [k]) ;
+	    llen = Lilen [k] ;
+	    xp = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	    for (c = 0 ; c < NB ; c++)
+	    {
+		xk [c] = X [k*NB + c] ;
+	    }
+	    gather (xk, X, Pattern, xp, deg, conj) ;
+	    for (c = 0 ; c < NB ; c++)
+	    {
+		X [k*NB + c] = xk [c] ;
+	    }
+
+	    /* construct column k-1 of L: un-concatenate the pattern */
+	    deg -= llen ;
+	    pos = Lpos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add pivot row */
+		ASSERT (k != kstart && pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+    }
+
+    /* singletons */
+    for (k = n1 - 1 ; k >= 0 ; k--)
+    {
+	deg = Lilen [k] ;
+	if (deg > 0)
+	{
+	    for (c = 0 ; c < NB ; c++)
+	    {
+		xk [c] = X [k*NB + c] ;
+	    }
+	    lp = Lip [k] ;
+	    Li = (Int *) (Numeric->Memory + lp) ;
+	    lp += UNITS (Int, deg) ;
+	    Lval = (Entry *) (Numeric->Memory + lp) ;
+	    gather (xk, X, Li, Lval, deg, conj) ;
+	    for (c = 0 ; c < NB ; c++)
+	    {
+		X [k*NB + c] = xk [c] ;
+	    }
+	}
+    }
+
+    return (MULTSUB_FLOPS * ((double) Numeric->lnz)) ;
+}
+
+/* -------------------------------------------------------------------------- */
+/* utsolve_block:  solve U' X = B or U.' X = B, as UMF_uhsolve, UMF_utsolve */
+/* -------------------------------------------------------------------------- */
+
+PRIVATE double utsolve_block
+(
+    NumericType *Numeric,
+    Entry X [ ],
+    Int Pattern [ ],
+    Int conj
+)
+{
+    Entry xk [NB] ;
+    Entry *xp, *D, *Uval ;
+    Int Cols [NB], k, deg, j, *ip, *Upos, *Uilen, kstart, kend, up, *Uip, n,
+	uhead, ulen, pos, npiv, n1, *Ui, nz ;
+
+    n = Numeric->n_row ;
+    npiv = Numeric->npiv ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+    D = Numeric->D ;
+    kend = 0 ;
+    n1 = Numeric->n1 ;
+
+    /* singletons */
+    for (k = 0 ; k < n1 ; k++)
+    {
+	divide (X + k*NB, X + k*NB, D [k], conj) ;
+	deg = Uilen [k] ;
+	if (deg > 0)
+	{
+	    nz = nonzeros (X + k*NB, xk, Cols) ;
+	    if (nz > 0)
+	    {
+		up = Uip [k] ;
+		Ui = (Int *) (Numeric->Memory + up) ;
+		up += UNITS (Int, deg) ;
+		Uval = (Entry *) (Numeric->Memory + up) ;
+		scatter (X, Ui, Uval, deg, xk, Cols, nz, conj) ;
+	    }
+	}
+    }
+
+    /* nonsingletons */
+    for (kstart = n1 ; kstart < npiv ; kstart = kend + 1)
+    {
+	/* find the end of this Uchain */
+	kend = kstart ;
+	while (kend < npiv && Uip [kend+1] > 0)
+	{
+	    kend++ ;
+	}
+
+	/* start with last row in Uchain of U in Pattern [0..deg-1] */
+	k = kend+1 ;
+	if (k == npiv)
+	{
+	    /* last pivot row of U (singular matrices only) */
+	    deg = Numeric->ulen ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Pattern [j] = Numeric->Upattern [j] ;
+	    }
+	}
+	else
+	{
+	    up = -Uip [k] ;
+	    ASSERT (up > 0) ;
+	    deg = Uilen [k] ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Pattern [j] = *ip++ ;
+	    }
+	}
+
+	/* scan the Uchain to find the pattern of its first row, pushing the
+	 * deleted entries on the stack at the bottom of Pattern */
+	uhead = n ;
+	for (k = kend ; k > kstart ; k--)
+	{
+	    ulen = Uilen [k] ;
+	    for (j = 0 ; j < ulen ; j++)
+	    {
+		Pattern [--uhead] = Pattern [--deg] ;
+	    }
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add the pivot column */
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+
+	/* solve using this Uchain, in reverse order */
+	for (k = kstart ; k <= kend ; k++)
+	{
+	    /* construct row k */
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* remove the pivot column */
+		ASSERT (k > kstart && pos >= 0 && pos < deg) ;
+		ASSERT (Pattern [pos] == k) ;
+		Pattern [pos] = Pattern [--deg] ;
+	    }
+	    up = Uip [k] ;
+	    ulen = Uilen [k] ;
+	    if (k > kstart)
+	    {
+		/* concatenate the deleted pattern; pop from the stack */
+		for (j = 0 ; j < ulen ; j++)
+		{
+		    Pattern [deg++] = Pattern [uhead++] ;
+		}
+	    }
+
+	    /* use row k of U */
+	    divide (X + k*NB, X + k*NB, D [k], conj) ;
+	    nz = nonzeros (X + k*NB, xk, Cols) ;
+	    if (nz > 0)
+	    {
+		if (k == kstart)
+		{
+		    up = -up ;
+		    xp = (Entry *) (Numeric->Memory + up + UNITS (Int, ulen)) ;
+		}
+		else
+		{
+		    xp = (Entry *) (Numeric->Memory + up) ;
+		}
+		scatter (X, Pattern, xp, deg, xk, Cols, nz, conj) ;
+	    }
+	}
+	ASSERT (uhead == n) ;
+    }
+
+#ifndef NO_DIVIDE_BY_ZERO
+    for (k = npiv ; k < n ; k++)
+    {
+	/* This is an *** intentional *** divide-by-zero, to get Inf or Nan,
+	 * as appropriate.  It is not a bug. */
+	/* For conjugate solve, D [k] == conjugate (D [k]), in this case */
+	divide (X + k*NB, X + k*NB, D [k], FALSE) ;
+    }
+#endif
+
+    return (DIV_FLOPS * ((double) n) + MULTSUB_FLOPS * ((double) Numeric->unz));
+}
+
+/* ========================================================================== */
+/* === do_step ============================================================== */
+/* ========================================================================== */
+
+/* Perform one step of iterative refinement for column c of the block, as
+ * do_step in UMF_solve.  If Rs is not NULL, the residual W is scaled by R
+ * before its norm is taken (Y, Z2, and B2 are already scaled).  Returns TRUE
+ * if iterative refinement is done for this column.  cinfo [0..3] holds
+ * omega1, omega2, and the number of steps taken and attempted. */
+
+PRIVATE Int do_step
+(
+    double omega [3],
+    Int step,
+    Int c,
+    const double B2 [ ],
+    Entry X [ ],
+    const Entry W [ ],
+    const double Y [ ],
+    const double Z2 [ ],
+    Entry S [ ],
+    Int n,
+    const double Rs [ ],
+    Int do_recip,
+    double cinfo [4]
+)
+{
+    double last_omega [3], tau, nctau, d1, wd1, d2, wd2, xi, yix, wi, xnorm ;
+    Int i ;
+
+    nctau = 1000 * n * DBL_EPSILON ;
+
+    last_omega [0] = omega [0] ;
+    last_omega [1] = omega [1] ;
+    last_omega [2] = omega [2] ;
+
+    /* xnorm = ||x|| maxnorm */
+    xnorm = 0.0 ;
+    for (i = 0 ; i < n ; i++)
+    {
+	ABS (xi, X [i*NB + c]) ;
+	if (SCALAR_IS_NAN (xi))
+	{
+	    xnorm = xi ;
+	    break ;
+	}
+	xnorm = MAX (xnorm, xi) ;
+    }
+
+    omega [1] = 0. ;
+    omega [2] = 0. ;
+    for (i = 0 ; i < n ; i++)
+    {
+	yix = Y [i] * xnorm ;
+	tau = (yix + B2 [i*NB + c]) * nctau ;
+	d1 = Z2 [i*NB + c] + B2 [i*NB + c] ;
+	ABS (wi, W [i*NB + c]) ;
+	if (Rs != (double *) NULL)
+	{
+	    SCALE_ROW_SCALAR (wi, i) ;
+	}
+	if (SCALAR_IS_NAN (d1))
+	{
+	    omega [1] = d1 ;
+	    omega [2] = d1 ;
+	    break ;
+	}
+	if (SCALAR_IS_NAN (tau))
+	{
+	    omega [1] = tau ;
+	    omega [2] = tau ;
+	    break ;
+	}
+	if (d1 > tau)		/* a double relop, but no NaN's here */
+	{
+	    wd1 = wi / d1 ;
+	    omega [1] = MAX (omega [1], wd1) ;
+	}
+	else if (tau > 0.0)	/* a double relop, but no NaN's here */
+	{
+	    d2 = Z2 [i*NB + c] + yix ;
+	    wd2 = wi / d2 ;
+	    omega [2] = MAX (omega [2], wd2) ;
+	}
+    }
+
+    omega [0] = omega [1] + omega [2] ;
+    cinfo [0] = omega [1] ;
+    cinfo [1] = omega [2] ;
+    cinfo [2] = step ;
+    cinfo [3] = step ;
+
+    /* stop the iterations if the backward error is small, or NaN */
+    if (SCALAR_IS_NAN (omega [0]) || omega [0] < DBL_EPSILON)
+    {
+	return (TRUE) ;
+    }
+
+    /* stop if insufficient decrease in omega */
+    if (step > 0 && omega [0] > last_omega [0] / 2)
+    {
+	if (omega [0] > last_omega [0])
+	{
+	    /* last iteration better than this one, reinstate it */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		X [i*NB + c] = S [i*NB + c] ;
+	    }
+	    cinfo [0] = last_omega [1] ;
+	    cinfo [1] = last_omega [2] ;
+	}
+	cinfo [2] = step - 1 ;
+	return (TRUE) ;
+    }
+
+    /* save current solution in case we need to reinstate */
+    for (i = 0 ; i < n ; i++)
+    {
+	S [i*NB + c] = X [i*NB + c] ;
+    }
+    return (FALSE) ;
+}
+
+/* ========================================================================== */
+/* === UMF_msolve =========================================================== */
+/* ========================================================================== */
+
+Int UMF_msolve
+(
+    int sys,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+    double Xx [ ],
+    Int ldx,
+    const double Bx [ ],
+    Int ldb,
+#ifdef COMPLEX
+    const double Az [ ],
+    double Xz [ ],
+    const double Bz [ ],
+#endif
+    Int nrhs,
+    NumericType *Numeric,
+    Int irstep,
+    double Info [UMFPACK_INFO],
+    Int Pattern [ ],		/* size n */
+    double SolveWork [ ]	/* size UMF_MSOLVE_WSIZE (n, irstep) */
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    Entry aij, axx, *Rb, *Wb, *Xb, *Sb, *xr, *wr ;
+    double omega [3*NB], cinfo [4*NB], d, yi, flops, kflops ;
+    double *Rs, *Z2b, *B2b, *Y, *z2r, *xx ;
+    const double *bx ;
+    Int *Rperm, *Cperm, Act [NB], i, j, p, n, c, t, nz, step, status, j1,
+	ncols, nact, do_scale, do_recip, done, Bsplit, Xsplit ;
+#ifdef COMPLEX
+    const double *bz ;
+    double *xz ;
+    Int Asplit ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* initializations */
+    /* ---------------------------------------------------------------------- */
+
+    ASSERT (Numeric && Xx && Bx && Pattern && SolveWork && Info) ;
+    ASSERT (Numeric->n_row == Numeric->n_col) ;
+
+    n = Numeric->n_row ;
+    Rperm = Numeric->Rperm ;
+    Cperm = Numeric->Cperm ;
+    Rs = Numeric->Rs ;		/* row scale factors */
+    do_scale = (Rs != (double *) NULL) ;
+    do_recip = FALSE ;
+#ifndef NRECIPROCAL
+    do_recip = Numeric->do_recip ;
+#endif
+    flops = 0 ;
+    nz = 0 ;
+    Info [UMFPACK_SOLVE_FLOPS] = 0 ;
+    Info [UMFPACK_IR_TAKEN] = 0 ;
+    Info [UMFPACK_IR_ATTEMPTED] = 0 ;
+
+    if (Numeric->nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+    {
+	/* Note that systems involving just L return UMFPACK_OK, even if */
+	/* A is singular (L is always has a unit diagonal). */
+	status = UMFPACK_WARNING_singular_matrix ;
+	irstep = 0 ;
+    }
+    else
+    {
+	status = UMFPACK_OK ;
+    }
+    irstep = MAX (0, irstep) ;
+
+    switch (sys)
+    {
+	case UMFPACK_A:
+	case UMFPACK_At:
+	case UMFPACK_Aat:
+	    break ;
+	case UMFPACK_Pt_L:
+	case UMFPACK_L:
+	case UMFPACK_Lt_P:
+	case UMFPACK_Lat_P:
+	case UMFPACK_Lt:
+	case UMFPACK_Lat:
+	    status = UMFPACK_OK ;
+	    irstep = 0 ;
+	    break ;
+	case UMFPACK_U_Qt:
+	case UMFPACK_U:
+	case UMFPACK_Q_Ut:
+	case UMFPACK_Q_Uat:
+	case UMFPACK_Ut:
+	case UMFPACK_Uat:
+	    irstep = 0 ;
+	    break ;
+	default:
+	    return (UMFPACK_ERROR_invalid_system) ;
+    }
+
+    if (irstep > 0 && (!Ap || !Ai || !Ax))
+    {
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+#ifdef COMPLEX
+    Asplit = SPLIT (Az) ;
+    Xsplit = SPLIT (Xz) ;
+    Bsplit = SPLIT (Bz) ;
+#else
+    Xsplit = TRUE ;
+    Bsplit = TRUE ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* partition the workspace */
+    /* ---------------------------------------------------------------------- */
+
+    Rb = (Entry *) SolveWork ;	/* Entry Rb [0..n*NB-1], b or the residual */
+    Wb = Rb + n*NB ;		/* Entry Wb [0..n*NB-1], for L and U solves */
+    Xb = Wb + n*NB ;		/* Entry Xb [0..n*NB-1], the solution */
+    Sb = (Entry *) NULL ;	/* unused if no iterative refinement */
+    Z2b = (double *) NULL ;
+    B2b = (double *) NULL ;
+    Y = (double *) NULL ;
+    if (irstep > 0)
+    {
+	Sb = Xb + n*NB ;		/* Entry Sb [0..n*NB-1] */
+	Z2b = (double *) (Sb + n*NB) ;	/* double Z2b [0..n*NB-1] */
+	B2b = Z2b + n*NB ;		/* double B2b [0..n*NB-1] */
+	Y = B2b + n*NB ;		/* double Y [0..n-1] */
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* Y (i) = 1-norm of row i of R A, A' R, or A.' R */
+    /* ---------------------------------------------------------------------- */
+
+    if (irstep > 0)
+    {
+	nz = Ap [n] ;
+	Info [UMFPACK_NZ] = nz ;
+	flops += (ABS_FLOPS + 2) * nz ;
+	if (sys == UMFPACK_A)
+	{
+	    for (i = 0 ; i < n ; i++)
+	    {
+		Y [i] = 0. ;
+	    }
+	    for (p = 0 ; p < nz ; p++)
+	    {
+		ASSIGN (aij, Ax, Az, p, Asplit) ;
+		ABS (d, aij) ;
+		Y [Ai [p]] += d ;
+	    }
+	    if (do_scale)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    SCALE_ROW_SCALAR (Y [i], i) ;
+		}
+	    }
+	}
+	else
+	{
+	    /* abs (aij) is the same as abs (conj (aij)) */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		yi = 0. ;
+		for (p = Ap [i] ; p < Ap [i+1] ; p++)
+		{
+		    ASSIGN (aij, Ax, Az, p, Asplit) ;
+		    ABS (d, aij) ;
+		    if (do_scale)
+		    {
+			SCALE_ROW_SCALAR (d, Ai [p]) ;
+		    }
+		    yi += d ;
+		}
+		Y [i] = yi ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve for each block of right-hand sides */
+    /* ---------------------------------------------------------------------- */
+
+    for (j1 = 0 ; j1 < nrhs ; j1 += NB)
+    {
+
+	ncols = MIN (NB, nrhs - j1) ;
+
+	/* ------------------------------------------------------------------ */
+	/* Rb = B (:, j1:j1+ncols-1), padded with zero columns */
+	/* ------------------------------------------------------------------ */
+
+	for (c = 0 ; c < NB ; c++)
+	{
+	    if (c < ncols)
+	    {
+		bx = Bx + COL_OFFSET (j1 + c, ldb, Bsplit) ;
+#ifdef COMPLEX
+		bz = Bsplit ? (Bz + (j1 + c) * ldb) : ((double *) NULL) ;
+#endif
+		for (i = 0 ; i < n ; i++)
+		{
+		    ASSIGN (Rb [i*NB + c], bx, bz, i, Bsplit) ;
+		}
+		Act [c] = c ;
+	    }
+	    else
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    CLEAR (Rb [i*NB + c]) ;
+		}
+	    }
+	}
+	nact = ncols ;
+
+	if (irstep > 0)
+	{
+	    /* B2 = abs (B), scaled by R for Ax=b */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		for (c = 0 ; c < NB ; c++)
+		{
+		    ABS (B2b [i*NB + c], Rb [i*NB + c]) ;
+		}
+		if (do_scale && sys == UMFPACK_A)
+		{
+		    for (c = 0 ; c < NB ; c++)
+		    {
+			SCALE_ROW_SCALAR (B2b [i*NB + c], i) ;
+		    }
+		}
+	    }
+	    for (c = 0 ; c < 3*NB ; c++)
+	    {
+		omega [c] = 0. ;
+	    }
+	}
+
+	for (step = 0 ; step <= irstep ; step++)
+	{
+
+	    /* -------------------------------------------------------------- */
+	    /* Wb = P R Rb, Q' Rb, P Rb, or Rb */
+	    /* -------------------------------------------------------------- */
+
+	    if (sys == UMFPACK_A || sys == UMFPACK_Pt_L)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    xr = Rb + Rperm [i] * NB ;
+		    for (c = 0 ; c < NB ; c++)
+		    {
+			Wb [i*NB + c] = xr [c] ;
+		    }
+		    if (do_scale && sys == UMFPACK_A)
+		    {
+			for (c = 0 ; c < NB ; c++)
+			{
+			    SCALE_ROW (Wb [i*NB + c], Rperm [i]) ;
+			}
+		    }
+		}
+	    }
+	    else if (sys == UMFPACK_At || sys == UMFPACK_Aat
+		  || sys == UMFPACK_Q_Ut || sys == UMFPACK_Q_Uat)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    xr = Rb + Cperm [i] * NB ;
+		    for (c = 0 ; c < NB ; c++)
+		    {
+			Wb [i*NB + c] = xr [c] ;
+		    }
+		}
+	    }
+	    else
+	    {
+		for (i = 0 ; i < n*NB ; i++)
+		{
+		    Wb [i] = Rb [i] ;
+		}
+	    }
+
+	    /* -------------------------------------------------------------- */
+	    /* solve with L and/or U, one pass for the whole block */
+	    /* -------------------------------------------------------------- */
+
+	    kflops = 0 ;
+	    switch (sys)
+	    {
+		case UMFPACK_A:
+		    kflops += lsolve_block (Numeric, Wb, Pattern) ;
+		    kflops += usolve_block (Numeric, Wb, Pattern) ;
+		    break ;
+		case UMFPACK_At:
+		    kflops += utsolve_block (Numeric, Wb, Pattern, TRUE) ;
+		    kflops += ltsolve_block (Numeric, Wb, Pattern, TRUE) ;
+		    break ;
+		case UMFPACK_Aat:
+		    kflops += utsolve_block (Numeric, Wb, Pattern, FALSE) ;
+		    kflops += ltsolve_block (Numeric, Wb, Pattern, FALSE) ;
+		    break ;
+		case UMFPACK_Pt_L:
+		case UMFPACK_L:
+		    kflops += lsolve_block (Numeric, Wb, Pattern) ;
+		    break ;
+		case UMFPACK_Lt_P:
+		case UMFPACK_Lt:
+		    kflops += ltsolve_block (Numeric, Wb, Pattern, TRUE) ;
+		    break ;
+		case UMFPACK_Lat_P:
+		case UMFPACK_Lat:
+		    kflops += ltsolve_block (Numeric, Wb, Pattern, FALSE) ;
+		    break ;
+		case UMFPACK_U_Qt:
+		case UMFPACK_U:
+		    kflops += usolve_block (Numeric, Wb, Pattern) ;
+		    break ;
+		case UMFPACK_Q_Ut:
+		case UMFPACK_Ut:
+		    kflops += utsolve_block (Numeric, Wb, Pattern, TRUE) ;
+		    break ;
+		case UMFPACK_Q_Uat:
+		case UMFPACK_Uat:
+		    kflops += utsolve_block (Numeric, Wb, Pattern, FALSE) ;
+		    break ;
+	    }
+	    flops += kflops * nact ;
+
+	    /* -------------------------------------------------------------- */
+	    /* Rb = Q Wb, R P' Wb, P' Wb, or Wb, and X = Rb or X += Rb */
+	    /* -------------------------------------------------------------- */
+
+	    /* The correction is placed in Rb (no longer needed) for step > 0 */
+	    xr = (step == 0) ? Xb : Rb ;
+	    if (sys == UMFPACK_A || sys == UMFPACK_U_Qt)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    wr = xr + Cperm [i] * NB ;
+		    for (c = 0 ; c < NB ; c++)
+		    {
+			wr [c] = Wb [i*NB + c] ;
+		    }
+		}
+	    }
+	    else if (sys == UMFPACK_At || sys == UMFPACK_Aat
+		  || sys == UMFPACK_Lt_P || sys == UMFPACK_Lat_P)
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    wr = xr + Rperm [i] * NB ;
+		    for (c = 0 ; c < NB ; c++)
+		    {
+			wr [c] = Wb [i*NB + c] ;
+		    }
+		}
+		if (do_scale && sys != UMFPACK_Lt_P && sys != UMFPACK_Lat_P)
+		{
+		    flops += SCALE_FLOPS * n * nact ;
+		    for (i = 0 ; i < n ; i++)
+		    {
+			for (c = 0 ; c < NB ; c++)
+			{
+			    SCALE_ROW (xr [i*NB + c], i) ;
+			}
+		    }
+		}
+	    }
+	    else
+	    {
+		for (i = 0 ; i < n*NB ; i++)
+		{
+		    xr [i] = Wb [i] ;
+		}
+	    }
+
+	    if (step > 0)
+	    {
+		flops += ASSEMBLE_FLOPS * n * nact ;
+		for (i = 0 ; i < n ; i++)
+		{
+		    for (t = 0 ; t < nact ; t++)
+		    {
+			c = Act [t] ;
+			ASSEMBLE (Xb [i*NB + c], Rb [i*NB + c]) ;
+		    }
+		}
+	    }
+
+	    if (irstep == 0) break ;
+
+	    /* -------------------------------------------------------------- */
+	    /* Rb = B - A X (or A' X or A.' X), Z2 = |A||X|, for active columns */
+	    /* -------------------------------------------------------------- */
+
+	    /* inactive columns of Rb are set to zero, so that the next
+	     * correction does not change them */
+	    for (i = 0 ; i < n*NB ; i++)
+	    {
+		CLEAR (Rb [i]) ;
+		Z2b [i] = 0. ;
+	    }
+	    for (t = 0 ; t < nact ; t++)
+	    {
+		c = Act [t] ;
+		bx = Bx + COL_OFFSET (j1 + c, ldb, Bsplit) ;
+#ifdef COMPLEX
+		bz = Bsplit ? (Bz + (j1 + c) * ldb) : ((double *) NULL) ;
+#endif
+		for (i = 0 ; i < n ; i++)
+		{
+		    ASSIGN (Rb [i*NB + c], bx, bz, i, Bsplit) ;
+		}
+	    }
+
+	    flops += (MULT_FLOPS + DECREMENT_FLOPS + ABS_FLOPS + 1) * nz * nact;
+	    if (sys == UMFPACK_A)
+	    {
+		/* A is stored by column */
+		for (j = 0 ; j < n ; j++)
+		{
+		    xr = Xb + j*NB ;
+		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+		    {
+			i = Ai [p] ;
+			ASSIGN (aij, Ax, Az, p, Asplit) ;
+			wr = Rb + i*NB ;
+			z2r = Z2b + i*NB ;
+			for (t = 0 ; t < nact ; t++)
+			{
+			    c = Act [t] ;
+			    MULT (axx, aij, xr [c]) ;
+			    DECREMENT (wr [c], axx) ;
+			    ABS (d, axx) ;
+			    z2r [c] += d ;
+			}
+		    }
+		}
+		if (do_scale)
+		{
+		    /* Z2 = R Z2; the residual is scaled in do_step */
+		    for (i = 0 ; i < n ; i++)
+		    {
+			for (c = 0 ; c < NB ; c++)
+			{
+			    SCALE_ROW_SCALAR (Z2b [i*NB + c], i) ;
+			}
+		    }
+		}
+	    }
+	    else
+	    {
+		/* A' and A.' are stored by row */
+		for (i = 0 ; i < n ; i++)
+		{
+		    wr = Rb + i*NB ;
+		    z2r = Z2b + i*NB ;
+		    for (p = Ap [i] ; p < Ap [i+1] ; p++)
+		    {
+			ASSIGN (aij, Ax, Az, p, Asplit) ;
+			xr = Xb + Ai [p] * NB ;
+			for (t = 0 ; t < nact ; t++)
+			{
+			    c = Act [t] ;
+			    if (sys == UMFPACK_At)
+			    {
+				MULT_CONJ (axx, xr [c], aij) ;
+			    }
+			    else
+			    {
+				MULT (axx, xr [c], aij) ;
+			    }
+			    DECREMENT (wr [c], axx) ;
+			    ABS (d, axx) ;
+			    z2r [c] += d ;
+			}
+		    }
+		}
+	    }
+
+	    /* -------------------------------------------------------------- */
+	    /* sparse backward error estimate, for each active column */
+	    /* -------------------------------------------------------------- */
+
+	    flops += (2*ABS_FLOPS + 5) * n * nact ;
+	    ncols = nact ;
+	    nact = 0 ;
+	    for (t = 0 ; t < ncols ; t++)
+	    {
+		c = Act [t] ;
+		done = do_step (omega + 3*c, step, c, B2b, Xb, Rb, Y, Z2b, Sb,
+		    n, (do_scale && sys == UMFPACK_A) ? Rs : (double *) NULL,
+		    do_recip, cinfo + 4*c) ;
+		if (done)
+		{
+		    for (i = 0 ; i < n ; i++)
+		    {
+			CLEAR (Rb [i*NB + c]) ;
+		    }
+		}
+		else
+		{
+		    Act [nact++] = c ;
+		}
+	    }
+	    if (nact == 0) break ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* X (:, j1:j1+ncols-1) = Xb */
+	/* ------------------------------------------------------------------ */
+
+	ncols = MIN (NB, nrhs - j1) ;
+	for (c = 0 ; c < ncols ; c++)
+	{
+	    xx = Xx + COL_OFFSET (j1 + c, ldx, Xsplit) ;
+#ifdef COMPLEX
+	    if (Xsplit)
+	    {
+		xz = Xz + (j1 + c) * ldx ;
+		for (i = 0 ; i < n ; i++)
+		{
+		    xx [i] = REAL_COMPONENT (Xb [i*NB + c]) ;
+		    xz [i] = IMAG_COMPONENT (Xb [i*NB + c]) ;
+		}
+	    }
+	    else
+	    {
+		for (i = 0 ; i < n ; i++)
+		{
+		    xx [2*i  ] = REAL_COMPONENT (Xb [i*NB + c]) ;
+		    xx [2*i+1] = IMAG_COMPONENT (Xb [i*NB + c]) ;
+		}
+	    }
+#else
+	    for (i = 0 ; i < n ; i++)
+	    {
+		xx [i] = Xb [i*NB + c] ;
+	    }
+#endif
+
+	    if (irstep > 0)
+	    {
+		/* the largest backward error and number of steps taken */
+		Info [UMFPACK_OMEGA1] = MAX (Info [UMFPACK_OMEGA1], cinfo [4*c]) ;
+		Info [UMFPACK_OMEGA2] = MAX (Info [UMFPACK_OMEGA2], cinfo [4*c+1]);
+		Info [UMFPACK_IR_TAKEN] = MAX (Info [UMFPACK_IR_TAKEN],
+		    cinfo [4*c+2]) ;
+		Info [UMFPACK_IR_ATTEMPTED] = MAX (Info [UMFPACK_IR_ATTEMPTED],
+		    cinfo [4*c+3]) ;
+	    }
+	}
+    }
+
+    /* return UMFPACK_OK, or UMFPACK_WARNING_singular_matrix */
+    Info [UMFPACK_SOLVE_FLOPS] = flops ;
+    return (status) ;
+}
@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_msolve.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/* number of right-hand sides solved together in one pass over L and U */
+#define UMF_MSOLVE_NB 8
+
+/* size of the SolveWork array for UMF_msolve, in units of doubles */
+#define UMF_MSOLVE_WSIZE(n,irstep) \
+    (((irstep) > 0) ? \
+    ((4 * (sizeof (Entry) / sizeof (double)) + 2) * UMF_MSOLVE_NB * (n) + (n)) \
+    : (3 * (sizeof (Entry) / sizeof (double)) * UMF_MSOLVE_NB * (n)))
+
+Int UMF_msolve
+(
+    int sys,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+    double Xx [ ],
+    Int ldx,
+    const double Bx [ ],
+    Int ldb,
+#ifdef COMPLEX
+    const double Az [ ],
+    double Xz [ ],
+    const double Bz [ ],
+#endif
+    Int nrhs,
+    NumericType *Numeric,
+    Int irstep,
+    double Info [UMFPACK_INFO],
+    Int Pattern [ ],
+    double SolveWork [ ]
+) ;
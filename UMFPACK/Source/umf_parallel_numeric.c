@@ -0,0 +1,1497 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_parallel_numeric: factorize independent blocks in parallel
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Called by UMFPACK_numeric when Control [UMFPACK_NTHREADS] > 1.
+
+    The rows and columns of A are split into the connected components of the
+    bipartite graph of A: two columns are in the same component if they have
+    a row in common.  No frontal matrix can span two components, so each
+    component is a set of independent subtrees of the column elimination
+    tree, together with the singletons that feed them.  The components are
+    placed into at most nthreads groups of about equal work, and each group
+    is factorized as a matrix of its own, with its own frontal matrices and
+    its own Numeric->Memory, by UMFPACK_numeric.  The groups are factorized
+    in parallel.  The columns of each group are kept in the order given by
+    the Symbolic object, and each row is placed at the same position as the
+    column with the same index (when that column is in the same group), so
+    that the diagonal of A remains on the diagonal of each group for the
+    symmetric strategy.  The Symbolic object of each group is extracted from
+    the Symbolic object of A (its singletons, fronts, and chains), so the
+    groups are not analyzed again.
+
+    This is the only source of parallelism in UMFPACK_numeric.  The
+    independent subtrees of the frontal tree of a single component are
+    factorized one after the other, so a matrix whose bipartite graph is
+    connected (an irreducible matrix, which includes most matrices that do
+    not come from several decoupled subproblems) is factorized sequentially,
+    regardless of Control [UMFPACK_NTHREADS].
+
+    The LU factors of the groups are then merged into a single Numeric object
+    for the whole matrix, with the groups along its diagonal.  The pattern of
+    L and U is stored in chains that cannot continue from one group into the
+    next, so the first column of L and the first row of U of each group start
+    a new chain.  Only the singletons of the first group remain singletons
+    in the merged object; those of the other groups are stored as chains of
+    length one.
+
+    Returns TRUE if the Numeric object has been created, in which case
+    Info [UMFPACK_STATUS] is UMFPACK_OK or UMFPACK_WARNING_singular_matrix.
+    Returns FALSE if the matrix is rectangular, has only one component, is
+    structurally singular, or is invalid, or if any group fails for any
+    reason (including running out of memory).  The caller then factorizes
+    the matrix as a whole, which also reports any error in the input.
+
+    Dynamic memory usage:  8*n integers for the components, plus space for
+    one copy of the pattern and values of each group while it is being
+    factorized, plus the Numeric objects of the groups.  The merged Numeric
+    object is about the same size as the sum of the Numeric objects of the
+    groups, which are freed when this routine returns.
+*/
+
+#include "umf_internal.h"
+#include "umf_parallel_numeric.h"
+#include "umf_set_stats.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
+
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_MALLOC_COUNT) \
+    && !defined (UMF_TCOV_TEST)
+/* UMF_malloc_count and the test-coverage counters are not thread-safe */
+#define PARALLEL_GROUPS
+#endif
+
+typedef struct	/* CompWork */
+{
+    double work ;	/* number of entries and columns in the component */
+    Int comp ;		/* the component */
+} CompWork ;
+
+PRIVATE int compare_work
+(
+    const void *a,
+    const void *b
+) ;
+
+PRIVATE Int find_root
+(
+    Int Set [ ],
+    Int i
+) ;
+
+PRIVATE NumericType *factorize_group
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const Scalar Ax [ ],
+#ifdef COMPLEX
+    const Scalar Az [ ],
+#endif
+    const SymbolicType *Symbolic,
+    Int n,
+    Int m,
+    Int g,
+    const Int Gcol [ ],
+    const Int Comp [ ],
+    const Int Cgroup [ ],
+    const Int Local [ ],
+    const double Control [ ],
+    double Info [ ]
+) ;
+
+PRIVATE SymbolicType *group_symbolic
+(
+    const SymbolicType *Symbolic,
+    Int n,
+    Int m,
+    Int bnz,
+    Int g,
+    const Int Comp [ ],
+    const Int Cgroup [ ],
+    const Int Local [ ]
+) ;
+
+PRIVATE Int first_udeg
+(
+    NumericType *G
+) ;
+
+PRIVATE NumericType *merge_groups
+(
+    NumericType *Gnum [ ],
+    Int ngroups,
+    const Int Gstart [ ],
+    const Int Gcol [ ],
+    const Int Grow [ ],
+    Int n
+) ;
+
+/* ========================================================================== */
+/* === UMF_parallel_numeric ================================================= */
+/* ========================================================================== */
+
+Int UMF_parallel_numeric
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const Scalar Ax [ ],
+#ifdef COMPLEX
+    const Scalar Az [ ],
+#endif
+    SymbolicType *Symbolic,
+    Int nthreads,
+    const double Control [ ],
+    NumericType **NumericHandle,
+    double Info [ ]
+)
+{
+
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    double Control2 [UMFPACK_CONTROL], *Load, *Ginfo, *Gi ;
+    NumericType **Gnum, *Numeric ;
+    CompWork *Order ;
+    Int n, nz, i, j, p, r, s, t, c, g, row, col, ncomp, ngroups, ok,
+	*Iwork, *Set, *Comp, *Local, *Gcol, *Grow, *Cwork, *Ncol, *Nrow,
+	*Next, *Cgroup, *Gstart ;
+
+    *NumericHandle = (NumericType *) NULL ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the matrix */
+    /* ---------------------------------------------------------------------- */
+
+    n = Symbolic->n_row ;
+    nz = Symbolic->nz ;
+    if (n != Symbolic->n_col || n < 2 || nthreads < 2
+	|| Ap [0] != 0 || Ap [n] != nz)
+    {
+	return (FALSE) ;
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+	if (Ap [j] > Ap [j+1])
+	{
+	    return (FALSE) ;
+	}
+	for (p = Ap [j] ; p < Ap [j+1] ; p++)
+	{
+	    row = Ai [p] ;
+	    if (row < 0 || row >= n || (p > Ap [j] && row <= Ai [p-1]))
+	    {
+		/* invalid matrix: UMF_kernel reports the error */
+		return (FALSE) ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the connected components of the bipartite graph of A */
+    /* ---------------------------------------------------------------------- */
+
+    Iwork = (Int *) UMF_malloc (8*n, sizeof (Int)) ;
+    if (!Iwork)
+    {
+	return (FALSE) ;
+    }
+    Set   = Iwork ;		/* size 2*n */
+    Comp  = Iwork + 2*n ;	/* size 2*n */
+    Local = Iwork + 4*n ;	/* size 2*n */
+    Gcol  = Iwork + 6*n ;	/* size n */
+    Grow  = Iwork + 7*n ;	/* size n */
+
+    /* node j < n is column j, and node n+i is row i */
+    for (i = 0 ; i < 2*n ; i++)
+    {
+	Set [i] = i ;
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+	r = find_root (Set, j) ;
+	for (p = Ap [j] ; p < Ap [j+1] ; p++)
+	{
+	    s = find_root (Set, n + Ai [p]) ;
+	    if (s != r)
+	    {
+		Set [s] = r ;
+	    }
+	}
+    }
+
+    ncomp = 0 ;
+    for (i = 0 ; i < 2*n ; i++)
+    {
+	if (Set [i] == i)
+	{
+	    Comp [i] = ncomp++ ;
+	}
+    }
+    for (i = 0 ; i < 2*n ; i++)
+    {
+	Comp [i] = Comp [find_root (Set, i)] ;
+    }
+    DEBUG1 (("parallel numeric: n "ID" ncomp "ID"\n", n, ncomp)) ;
+
+    if (ncomp < 2)
+    {
+	/* A is irreducible (in the bipartite sense) */
+	(void) UMF_free ((void *) Iwork) ;
+	return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* place the components into groups of about equal work */
+    /* ---------------------------------------------------------------------- */
+
+    Cwork = (Int *) UMF_malloc (4*ncomp + 1, sizeof (Int)) ;
+    Order = (CompWork *) UMF_malloc (ncomp, sizeof (CompWork)) ;
+    Load = (double *) UMF_malloc (ncomp, sizeof (double)) ;
+    if (!Cwork || !Order || !Load)
+    {
+	(void) UMF_free ((void *) Iwork) ;
+	(void) UMF_free ((void *) Cwork) ;
+	(void) UMF_free ((void *) Order) ;
+	(void) UMF_free ((void *) Load) ;
+	return (FALSE) ;
+    }
+    Ncol   = Cwork ;		    /* size ncomp */
+    Nrow   = Cwork + ncomp ;	    /* size ncomp, and Next of size ngroups */
+    Cgroup = Cwork + 2*ncomp ;	    /* size ncomp */
+    Gstart = Cwork + 3*ncomp ;	    /* size ngroups+1 */
+    Next   = Nrow ;
+
+    for (c = 0 ; c < ncomp ; c++)
+    {
+	Ncol [c] = 0 ;
+	Nrow [c] = 0 ;
+	Order [c].work = 0 ;
+	Order [c].comp = c ;
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+	c = Comp [j] ;
+	Ncol [c]++ ;
+	Order [c].work += 1 + (Ap [j+1] - Ap [j]) ;
+    }
+    for (i = 0 ; i < n ; i++)
+    {
+	Nrow [Comp [n+i]]++ ;
+    }
+    ok = TRUE ;
+    for (c = 0 ; ok && c < ncomp ; c++)
+    {
+	/* a component that is not square is structurally singular */
+	ok = (Ncol [c] == Nrow [c]) ;
+    }
+
+    if (ok)
+    {
+	/* assign each component, largest first, to the least loaded group */
+	qsort (Order, (size_t) ncomp, sizeof (CompWork), compare_work) ;
+	ngroups = MIN (ncomp, nthreads) ;
+	for (g = 0 ; g < ngroups ; g++)
+	{
+	    Load [g] = 0 ;
+	    Gstart [g] = 0 ;
+	}
+	for (t = 0 ; t < ncomp ; t++)
+	{
+	    c = Order [t].comp ;
+	    g = 0 ;
+	    for (s = 1 ; s < ngroups ; s++)
+	    {
+		if (Load [s] < Load [g])
+		{
+		    g = s ;
+		}
+	    }
+	    Cgroup [c] = g ;
+	    Load [g] += Order [t].work ;
+	    Gstart [g] += Ncol [c] ;
+	}
+	s = 0 ;
+	for (g = 0 ; g < ngroups ; g++)
+	{
+	    t = Gstart [g] ;
+	    Gstart [g] = s ;
+	    Next [g] = s ;
+	    s += t ;
+	}
+	Gstart [ngroups] = n ;
+    }
+
+    (void) UMF_free ((void *) Order) ;
+    (void) UMF_free ((void *) Load) ;
+    if (!ok)
+    {
+	(void) UMF_free ((void *) Iwork) ;
+	(void) UMF_free ((void *) Cwork) ;
+	return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the columns and rows of each group, and their local indices */
+    /* ---------------------------------------------------------------------- */
+
+    /* columns of each group in the order given by Symbolic->Cperm_init */
+    for (t = 0 ; t < n ; t++)
+    {
+	col = Symbolic->Cperm_init [t] ;
+	g = Cgroup [Comp [col]] ;
+	Local [col] = Next [g] - Gstart [g] ;
+	Gcol [Next [g]++] = col ;
+    }
+
+    /* row i takes the place of column i, if both are in the same group */
+    for (i = 0 ; i < n ; i++)
+    {
+	Grow [i] = EMPTY ;
+	Local [n+i] = EMPTY ;
+    }
+    for (i = 0 ; i < n ; i++)
+    {
+	g = Cgroup [Comp [n+i]] ;
+	if (Cgroup [Comp [i]] == g)
+	{
+	    Local [n+i] = Local [i] ;
+	    Grow [Gstart [g] + Local [i]] = i ;
+	}
+    }
+
+    /* the remaining rows take the remaining places, in ascending order */
+    for (g = 0 ; g < ngroups ; g++)
+    {
+	Next [g] = Gstart [g] ;
+    }
+    for (i = 0 ; i < n ; i++)
+    {
+	if (Local [n+i] == EMPTY)
+	{
+	    g = Cgroup [Comp [n+i]] ;
+	    while (Grow [Next [g]] != EMPTY)
+	    {
+		Next [g]++ ;
+	    }
+	    ASSERT (Next [g] < Gstart [g+1]) ;
+	    Local [n+i] = Next [g] - Gstart [g] ;
+	    Grow [Next [g]++] = i ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize each group */
+    /* ---------------------------------------------------------------------- */
+
+    if (Control != (double *) NULL)
+    {
+	for (i = 0 ; i < UMFPACK_CONTROL ; i++)
+	{
+	    Control2 [i] = Control [i] ;
+	}
+    }
+    else
+    {
+	UMFPACK_defaults (Control2) ;
+    }
+    Control2 [UMFPACK_NTHREADS] = 1 ;
+
+    Gnum = (NumericType **) UMF_malloc (ngroups, sizeof (NumericType *)) ;
+    Ginfo = (double *) UMF_malloc (ngroups * UMFPACK_INFO, sizeof (double)) ;
+    ok = (Gnum != (NumericType **) NULL && Ginfo != (double *) NULL) ;
+
+    if (ok)
+    {
+	for (g = 0 ; g < ngroups ; g++)
+	{
+	    Gnum [g] = (NumericType *) NULL ;
+	}
+
+#ifdef PARALLEL_GROUPS
+	#pragma omp parallel for num_threads(ngroups) schedule(dynamic,1)
+#endif
+	for (g = 0 ; g < ngroups ; g++)
+	{
+	    Gnum [g] = factorize_group (Ap, Ai, Ax,
+#ifdef COMPLEX
+		Az,
+#endif
+		Symbolic, n, Gstart [g+1] - Gstart [g], g, Gcol + Gstart [g],
+		Comp, Cgroup, Local, Control2, Ginfo + g * UMFPACK_INFO) ;
+	}
+
+	for (g = 0 ; ok && g < ngroups ; g++)
+	{
+	    ok = (Gnum [g] != (NumericType *) NULL) ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* merge the groups into a single Numeric object */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric = (NumericType *) NULL ;
+    if (ok)
+    {
+	Numeric = merge_groups (Gnum, ngroups, Gstart, Gcol, Grow, n) ;
+    }
+
+    if (Numeric != (NumericType *) NULL)
+    {
+	UMF_set_stats (
+	    Info,
+	    Symbolic,
+	    (double) Numeric->max_usage,	/* actual peak Numeric->Memory */
+	    (double) Numeric->size,		/* actual final Numeric->Memory */
+	    Numeric->flops,			/* actual "true flops" */
+	    (double) Numeric->lnz + n,		/* actual nz in L */
+	    (double) Numeric->unz + Numeric->nnzpiv,	/* actual nz in U */
+	    (double) Numeric->maxfrsize,	/* actual largest front size */
+	    (double) 0,				/* actual Numeric->Upattern size */
+	    (double) Numeric->npiv,		/* actual # pivots found */
+	    (double) Numeric->maxnrows,		/* actual largest #rows in front */
+	    (double) Numeric->maxncols,		/* actual largest #cols in front */
+	    Numeric->scale != UMFPACK_SCALE_NONE,
+	    Symbolic->prefer_diagonal,
+	    ACTUAL) ;
+
+	Info [UMFPACK_FORCED_UPDATES] = 0 ;
+	Info [UMFPACK_NOFF_DIAG] = Symbolic->prefer_diagonal ? 0 : EMPTY ;
+	for (g = 0 ; g < ngroups ; g++)
+	{
+	    Gi = Ginfo + g * UMFPACK_INFO ;
+	    Info [UMFPACK_FORCED_UPDATES] += Gi [UMFPACK_FORCED_UPDATES] ;
+	    if (Symbolic->prefer_diagonal && Gi [UMFPACK_NOFF_DIAG] > 0)
+	    {
+		Info [UMFPACK_NOFF_DIAG] += Gi [UMFPACK_NOFF_DIAG] ;
+	    }
+	}
+	Info [UMFPACK_VARIABLE_INIT] = Numeric->init_usage ;
+	Info [UMFPACK_ALLOC_INIT_USED] = Numeric->alloc_init ;
+	Info [UMFPACK_NUMERIC_DEFRAG] = Numeric->ngarbage ;
+	Info [UMFPACK_NUMERIC_REALLOC] = Numeric->nrealloc ;
+	Info [UMFPACK_NUMERIC_COSTLY_REALLOC] = Numeric->ncostly ;
+	Info [UMFPACK_COMPRESSED_PATTERN] = Numeric->isize ;
+	Info [UMFPACK_LU_ENTRIES] = Numeric->nLentries + Numeric->nUentries +
+	    Numeric->npiv ;
+	Info [UMFPACK_UDIAG_NZ] = Numeric->nnzpiv ;
+	Info [UMFPACK_RSMIN] = Numeric->rsmin ;
+	Info [UMFPACK_RSMAX] = Numeric->rsmax ;
+	Info [UMFPACK_WAS_SCALED] = Numeric->scale ;
+	Info [UMFPACK_ALL_LNZ] = Numeric->all_lnz + n ;
+	Info [UMFPACK_ALL_UNZ] = Numeric->all_unz + Numeric->nnzpiv ;
+	Info [UMFPACK_NZDROPPED] =
+	      (Numeric->all_lnz - Numeric->lnz)
+	    + (Numeric->all_unz - Numeric->unz) ;
+
+	if (SCALAR_IS_ZERO (Numeric->min_udiag)
+	 || SCALAR_IS_ZERO (Numeric->max_udiag)
+	 || SCALAR_IS_NAN (Numeric->min_udiag)
+	 || SCALAR_IS_NAN (Numeric->max_udiag))
+	{
+	    /* rcond is zero if there is any zero or NaN on the diagonal */
+	    Numeric->rcond = 0.0 ;
+	}
+	else
+	{
+	    Numeric->rcond = Numeric->min_udiag / Numeric->max_udiag ;
+	}
+	Info [UMFPACK_UMIN]  = Numeric->min_udiag ;
+	Info [UMFPACK_UMAX]  = Numeric->max_udiag ;
+	Info [UMFPACK_RCOND] = Numeric->rcond ;
+	Info [UMFPACK_NUMERIC_NBLOCKS] = ngroups ;
+
+	Info [UMFPACK_STATUS] = UMFPACK_OK ;
+	if (Numeric->nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+	{
+	    /* there are zeros and/or NaN's on the diagonal of U */
+	    Info [UMFPACK_STATUS] = UMFPACK_WARNING_singular_matrix ;
+	}
+
+	Numeric->valid = NUMERIC_VALID ;
+	*NumericHandle = Numeric ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* free workspace and the Numeric objects of each group */
+    /* ---------------------------------------------------------------------- */
+
+    if (Gnum != (NumericType **) NULL)
+    {
+	for (g = 0 ; g < ngroups ; g++)
+	{
+	    UMFPACK_free_numeric ((void **) &(Gnum [g])) ;
+	}
+    }
+    (void) UMF_free ((void *) Gnum) ;
+    (void) UMF_free ((void *) Ginfo) ;
+    (void) UMF_free ((void *) Cwork) ;
+    (void) UMF_free ((void *) Iwork) ;
+
+    return (Numeric != (NumericType *) NULL) ;
+}
+
+
+/* ========================================================================== */
+/* === compare_work ========================================================= */
+/* ========================================================================== */
+
+/* sort components by decreasing work, and by component number for ties */
+
+PRIVATE int compare_work
+(
+    const void *a,
+    const void *b
+)
+{
+    const CompWork *x = (const CompWork *) a ;
+    const CompWork *y = (const CompWork *) b ;
+    if (x->work > y->work) return (-1) ;
+    if (x->work < y->work) return (1) ;
+    return ((x->comp < y->comp) ? (-1) : ((x->comp > y->comp) ? 1 : 0)) ;
+}
+
+
+/* ========================================================================== */
+/* === find_root ============================================================ */
+/* ========================================================================== */
+
+/* Find the root of the set containing node i, with path halving. */
+
+PRIVATE Int find_root
+(
+    Int Set [ ],
+    Int i
+)
+{
+    while (Set [i] != i)
+    {
+	Set [i] = Set [Set [i]] ;
+	i = Set [i] ;
+    }
+    return (i) ;
+}
+
+
+/* ========================================================================== */
+/* === factorize_group ====================================================== */
+/* ========================================================================== */
+
+/* Extract the m-by-m matrix B = A (rows, Gcol) of group g, with row i of A
+ * as row Local [n+i] of B, and factorize it, with a Symbolic object derived
+ * from that of A.  Returns its Numeric object, or NULL if the group fails or
+ * is structurally singular. */
+
+PRIVATE NumericType *factorize_group
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const Scalar Ax [ ],
+#ifdef COMPLEX
+    const Scalar Az [ ],
+#endif
+    const SymbolicType *Symbolic,   /* Symbolic object of A */
+    Int n,
+    Int m,
+    Int g,
+    const Int Gcol [ ],
+    const Int Comp [ ],
+    const Int Cgroup [ ],
+    const Int Local [ ],
+    const double Control [ ],
+    double Info [ ]
+)
+{
+    Entry *Tx, *Bx ;
+    Int *Bp, *Bi, *Tp, *Ti, *W, j, p, r, t, col, bnz, status ;
+    void *Numeric ;
+    SymbolicType *S ;
+    NumericType *G ;
+#ifdef COMPLEX
+    Int split = SPLIT (Az) ;
+#endif
+
+    bnz = 0 ;
+    for (j = 0 ; j < m ; j++)
+    {
+	col = Gcol [j] ;
+	bnz += Ap [col+1] - Ap [col] ;
+    }
+
+    Bp = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    Tp = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    W  = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    Bi = (Int *) UMF_malloc (bnz+1, sizeof (Int)) ;
+    Ti = (Int *) UMF_malloc (bnz+1, sizeof (Int)) ;
+    Bx = (Entry *) UMF_malloc (bnz+1, sizeof (Entry)) ;
+    Tx = (Entry *) UMF_malloc (bnz+1, sizeof (Entry)) ;
+
+    status = UMFPACK_ERROR_out_of_memory ;
+    S = (SymbolicType *) NULL ;
+    Numeric = (void *) NULL ;
+
+    if (Bp && Tp && W && Bi && Ti && Bx && Tx)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* T = B', with the column indices of each row of B in order */
+	/* ------------------------------------------------------------------ */
+
+	for (r = 0 ; r < m ; r++)
+	{
+	    W [r] = 0 ;
+	}
+	for (j = 0 ; j < m ; j++)
+	{
+	    col = Gcol [j] ;
+	    for (p = Ap [col] ; p < Ap [col+1] ; p++)
+	    {
+		W [Local [n + Ai [p]]]++ ;
+	    }
+	}
+	Tp [0] = 0 ;
+	for (r = 0 ; r < m ; r++)
+	{
+	    Tp [r+1] = Tp [r] + W [r] ;
+	    W [r] = Tp [r] ;
+	}
+	for (j = 0 ; j < m ; j++)
+	{
+	    col = Gcol [j] ;
+	    for (p = Ap [col] ; p < Ap [col+1] ; p++)
+	    {
+		t = W [Local [n + Ai [p]]]++ ;
+		Ti [t] = j ;
+		ASSIGN (Tx [t], Ax, Az, p, split) ;
+	    }
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* B = T', with the row indices of each column of B in order */
+	/* ------------------------------------------------------------------ */
+
+	for (j = 0 ; j < m ; j++)
+	{
+	    W [j] = 0 ;
+	}
+	for (t = 0 ; t < bnz ; t++)
+	{
+	    W [Ti [t]]++ ;
+	}
+	Bp [0] = 0 ;
+	for (j = 0 ; j < m ; j++)
+	{
+	    Bp [j+1] = Bp [j] + W [j] ;
+	    W [j] = Bp [j] ;
+	}
+	for (r = 0 ; r < m ; r++)
+	{
+	    for (t = Tp [r] ; t < Tp [r+1] ; t++)
+	    {
+		p = W [Ti [t]]++ ;
+		Bi [p] = r ;
+		Bx [p] = Tx [t] ;
+	    }
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* factorize B (complex B is held in packed form) */
+	/* ------------------------------------------------------------------ */
+
+	S = group_symbolic (Symbolic, n, m, bnz, g, Comp, Cgroup, Local) ;
+	if (S != (SymbolicType *) NULL)
+	{
+	    status = UMFPACK_numeric (Bp, Bi, (Scalar *) Bx,
+#ifdef COMPLEX
+		(Scalar *) NULL,
+#endif
+		(void *) S, &Numeric, Control, Info) ;
+	}
+	UMFPACK_free_symbolic ((void **) &S) ;
+    }
+
+    (void) UMF_free ((void *) Bp) ;
+    (void) UMF_free ((void *) Tp) ;
+    (void) UMF_free ((void *) W) ;
+    (void) UMF_free ((void *) Bi) ;
+    (void) UMF_free ((void *) Ti) ;
+    (void) UMF_free ((void *) Bx) ;
+    (void) UMF_free ((void *) Tx) ;
+
+    G = (NumericType *) Numeric ;
+    if (G != (NumericType *) NULL && (G->npiv < m || G->ulen > 0))
+    {
+	/* structurally singular */
+	DEBUG1 (("group status "ID" npiv "ID" m "ID"\n", status, G->npiv, m)) ;
+	UMFPACK_free_numeric (&Numeric) ;
+	G = (NumericType *) NULL ;
+    }
+    return (G) ;
+}
+
+/* ========================================================================== */
+/* === group_symbolic ======================================================= */
+/* ========================================================================== */
+
+/* Construct the Symbolic object of the m-by-m matrix B of group g (see
+ * factorize_group) from the Symbolic object of A, without analyzing B again.
+ * The columns of B are already in the order given by Symbolic->Cperm_init,
+ * so the singletons of the group come first, followed by the pivot columns
+ * of the fronts of the group, in the same order as in A.  Each front, each
+ * chain, and the rows assigned to each front lie within a single component,
+ * so the fronts and chains of B are those of A, renumbered.  Two chains of A
+ * become one chain of B if the fronts between them belong to other groups.
+ *
+ * The memory required by UMF_kernel_init is computed exactly, as in
+ * UMFPACK_symbolic, but the estimates of the peak and final size of
+ * Numeric->Memory (which require the size of each front) are those of A,
+ * scaled by the fraction of the entries of A that are in B.  UMFPACK_numeric
+ * reallocates Numeric->Memory if the estimate is too low.
+ *
+ * Returns NULL if out of memory, or if the structure of the Symbolic object
+ * of A does not split along the groups (which does not occur for the Symbolic
+ * objects computed by UMFPACK_symbolic). */
+
+PRIVATE SymbolicType *group_symbolic
+(
+    const SymbolicType *Symbolic,   /* Symbolic object of A */
+    Int n,
+    Int m,
+    Int bnz,			    /* # of entries in B */
+    Int g,
+    const Int Comp [ ],
+    const Int Cgroup [ ],
+    const Int Local [ ]
+)
+{
+    double frac ;
+    SymbolicType *S ;
+    Int *Flocal, *Rimap, f, fl, k, t, c, col, row, nfr, n1, nfr_g, n1_g,
+	nchains_g, fpivcol, f1rows, esize, tlen, rdeg, head_usage, tail_usage,
+	ok ;
+
+    nfr = Symbolic->nfr ;
+    n1 = Symbolic->n1 ;
+
+    S = (SymbolicType *) UMF_malloc (1, sizeof (SymbolicType)) ;
+    if (!S)
+    {
+	return ((SymbolicType *) NULL) ;
+    }
+    S->valid = 0 ;
+    S->Chain_start = (Int *) NULL ;
+    S->Chain_maxrows = (Int *) NULL ;
+    S->Chain_maxcols = (Int *) NULL ;
+    S->Front_npivcol = (Int *) NULL ;
+    S->Front_parent = (Int *) NULL ;
+    S->Front_1strow = (Int *) NULL ;
+    S->Front_leftmostdesc = (Int *) NULL ;
+    S->Esize = (Int *) NULL ;
+    S->Diagonal_map = (Int *) NULL ;
+    S->Cperm_init = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    S->Rperm_init = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    S->Cdeg = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    S->Rdeg = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    Flocal = (Int *) UMF_malloc (nfr+1, sizeof (Int)) ;
+    Rimap = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+    ok = (S->Cperm_init && S->Rperm_init && S->Cdeg && S->Rdeg && Flocal
+	&& Rimap) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* scalar information */
+    /* ---------------------------------------------------------------------- */
+
+    frac = (double) bnz / (double) MAX (1, Symbolic->nz) ;
+    S->n_row = m ;
+    S->n_col = m ;
+    S->nz = bnz ;
+    S->nb = Symbolic->nb ;
+    S->nempty_row = 0 ;
+    S->nempty_col = 0 ;
+    S->nempty = 0 ;
+    S->dense_row_threshold = Symbolic->dense_row_threshold ;
+    S->strategy = Symbolic->strategy ;
+    S->ordering = Symbolic->ordering ;
+    S->fixQ = Symbolic->fixQ ;
+    S->prefer_diagonal = Symbolic->prefer_diagonal ;
+    S->amd_dmax = Symbolic->amd_dmax ;
+    S->max_nchains = Symbolic->max_nchains ;
+    S->nzaat = Symbolic->nzaat ;
+    S->nzdiag = Symbolic->nzdiag ;
+    S->sym = Symbolic->sym ;
+    S->peak_sym_usage = Symbolic->peak_sym_usage ;
+    S->amd_lunz = (Symbolic->amd_lunz > 0) ? (frac * Symbolic->amd_lunz) :
+	Symbolic->amd_lunz ;
+    S->lunz_bound = MAX (1, frac * Symbolic->lunz_bound) ;
+    S->num_mem_size_est = frac * Symbolic->num_mem_size_est ;
+
+    /* ---------------------------------------------------------------------- */
+    /* columns, in the order of Symbolic->Cperm_init */
+    /* ---------------------------------------------------------------------- */
+
+    n1_g = 0 ;
+    k = 0 ;
+    for (t = 0 ; ok && t < n ; t++)
+    {
+	col = Symbolic->Cperm_init [t] ;
+	if (Cgroup [Comp [col]] == g)
+	{
+	    ASSERT (Local [col] == k) ;
+	    S->Cperm_init [k] = k ;
+	    S->Cdeg [k] = Symbolic->Cdeg [t] ;
+	    k++ ;
+	    if (t < n1)
+	    {
+		/* a singleton and its pivot row are in the same group */
+		row = Symbolic->Rperm_init [t] ;
+		ok = (Cgroup [Comp [n+row]] == g) ;
+		n1_g++ ;
+	    }
+	}
+    }
+    ok = ok && (k == m) ;
+    S->n1 = n1_g ;
+    S->n1r = 0 ;
+    S->n1c = 0 ;
+
+    /* ---------------------------------------------------------------------- */
+    /* rows, in the order of Symbolic->Rperm_init */
+    /* ---------------------------------------------------------------------- */
+
+    k = 0 ;
+    for (t = 0 ; ok && t < n ; t++)
+    {
+	row = Symbolic->Rperm_init [t] ;
+	if (Cgroup [Comp [n+row]] == g)
+	{
+	    S->Rperm_init [k] = Local [n+row] ;
+	    S->Rdeg [k] = Symbolic->Rdeg [t] ;
+	    Rimap [Local [n+row]] = k ;
+	    k++ ;
+	}
+    }
+    ok = ok && (k == m) ;
+    if (ok)
+    {
+	S->Cperm_init [m] = EMPTY ;
+	S->Rperm_init [m] = EMPTY ;
+	S->Cdeg [m] = EMPTY ;
+	S->Rdeg [m] = EMPTY ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the fronts of the group */
+    /* ---------------------------------------------------------------------- */
+
+    nfr_g = 0 ;
+    k = n1 ;
+    for (f = 0 ; ok && f < nfr ; f++)
+    {
+	Flocal [f] = EMPTY ;
+	fpivcol = Symbolic->Front_npivcol [f] ;
+	ok = (fpivcol > 0) ;
+	for (t = k ; ok && t < k + fpivcol ; t++)
+	{
+	    c = Cgroup [Comp [Symbolic->Cperm_init [t]]] ;
+	    ok = (c == Cgroup [Comp [Symbolic->Cperm_init [k]]]) ;
+	}
+	if (ok && Cgroup [Comp [Symbolic->Cperm_init [k]]] == g)
+	{
+	    Flocal [f] = nfr_g++ ;
+	    for (t = Symbolic->Front_1strow [f] ;
+		ok && t < Symbolic->Front_1strow [f+1] ; t++)
+	    {
+		row = Symbolic->Rperm_init [t] ;
+		ok = (Cgroup [Comp [n+row]] == g) ;
+	    }
+	}
+	k += fpivcol ;
+    }
+    if (ok)
+    {
+	Flocal [nfr] = EMPTY ;
+	S->nfr = nfr_g ;
+	S->Front_npivcol = (Int *) UMF_malloc (nfr_g+1, sizeof (Int)) ;
+	S->Front_parent = (Int *) UMF_malloc (nfr_g+1, sizeof (Int)) ;
+	S->Front_1strow = (Int *) UMF_malloc (nfr_g+1, sizeof (Int)) ;
+	S->Front_leftmostdesc = (Int *) UMF_malloc (nfr_g+1, sizeof (Int)) ;
+	ok = (S->Front_npivcol && S->Front_parent && S->Front_1strow
+	    && S->Front_leftmostdesc) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* renumber the fronts */
+    /* ---------------------------------------------------------------------- */
+
+    k = n1_g ;
+    for (f = 0 ; ok && f < nfr ; f++)
+    {
+	fl = Flocal [f] ;
+	if (fl != EMPTY)
+	{
+	    t = Symbolic->Front_parent [f] ;
+	    S->Front_parent [fl] = (t == EMPTY) ? EMPTY : Flocal [t] ;
+	    ok = (t == EMPTY || Flocal [t] != EMPTY) ;
+	    S->Front_npivcol [fl] = Symbolic->Front_npivcol [f] ;
+	    t = Flocal [Symbolic->Front_leftmostdesc [f]] ;
+	    S->Front_leftmostdesc [fl] = t ;
+	    ok = ok && (t != EMPTY) ;
+	    S->Front_1strow [fl] = k ;
+	    f1rows = Symbolic->Front_1strow [f+1] - Symbolic->Front_1strow [f] ;
+	    k += f1rows ;
+	}
+    }
+    if (ok)
+    {
+	/* the dummy front is empty, since B has no empty rows or columns */
+	ok = (k == m) ;
+	S->Front_npivcol [nfr_g] = 0 ;
+	S->Front_parent [nfr_g] = EMPTY ;
+	S->Front_1strow [nfr_g] = m ;
+	S->Front_leftmostdesc [nfr_g] = EMPTY ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the chains, and the largest front in each chain */
+    /* ---------------------------------------------------------------------- */
+
+    nchains_g = 0 ;
+    for (fl = 0 ; ok && fl < nfr_g ; fl++)
+    {
+	if (S->Front_parent [fl] != fl+1)
+	{
+	    nchains_g++ ;
+	}
+    }
+    if (ok)
+    {
+	S->nchains = nchains_g ;
+	S->Chain_start = (Int *) UMF_malloc (nchains_g+1, sizeof (Int)) ;
+	S->Chain_maxrows = (Int *) UMF_malloc (nchains_g+1, sizeof (Int)) ;
+	S->Chain_maxcols = (Int *) UMF_malloc (nchains_g+1, sizeof (Int)) ;
+	ok = (S->Chain_start && S->Chain_maxrows && S->Chain_maxcols) ;
+    }
+    if (ok)
+    {
+	c = 0 ;
+	S->Chain_start [0] = 0 ;
+	for (fl = 0 ; fl < nfr_g ; fl++)
+	{
+	    if (S->Front_parent [fl] != fl+1)
+	    {
+		S->Chain_start [++c] = fl+1 ;
+	    }
+	}
+	for (c = 0 ; c <= nchains_g ; c++)
+	{
+	    /* Chain_maxrows of A is odd, and so is the max of any of them */
+	    S->Chain_maxrows [c] = (c < nchains_g) ? 1 : 0 ;
+	    S->Chain_maxcols [c] = (c < nchains_g) ? 1 : 0 ;
+	}
+	c = 0 ;
+	for (t = 0 ; t < Symbolic->nchains ; t++)
+	{
+	    for (f = Symbolic->Chain_start [t] ;
+		f < Symbolic->Chain_start [t+1] ; f++)
+	    {
+		fl = Flocal [f] ;
+		if (fl != EMPTY)
+		{
+		    while (S->Chain_start [c+1] <= fl)
+		    {
+			c++ ;
+		    }
+		    S->Chain_maxrows [c] =
+			MAX (S->Chain_maxrows [c], Symbolic->Chain_maxrows [t]);
+		    S->Chain_maxcols [c] =
+			MAX (S->Chain_maxcols [c], Symbolic->Chain_maxcols [t]);
+		}
+	    }
+	}
+	S->maxnrows = 1 ;
+	S->maxncols = 1 ;
+	for (c = 0 ; c < nchains_g ; c++)
+	{
+	    S->maxnrows = MAX (S->maxnrows, S->Chain_maxrows [c]) ;
+	    S->maxncols = MAX (S->maxncols, S->Chain_maxcols [c]) ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* element sizes and the diagonal map */
+    /* ---------------------------------------------------------------------- */
+
+    S->esize = (ok && Symbolic->Esize) ? (m - n1_g) : 0 ;
+    if (S->esize > 0)
+    {
+	S->Esize = (Int *) UMF_malloc (S->esize, sizeof (Int)) ;
+	ok = (S->Esize != (Int *) NULL) ;
+	k = 0 ;
+	for (t = n1 ; ok && t < n ; t++)
+	{
+	    if (Cgroup [Comp [Symbolic->Cperm_init [t]]] == g)
+	    {
+		S->Esize [k++] = Symbolic->Esize [t - n1] ;
+	    }
+	}
+    }
+
+    if (ok && Symbolic->Diagonal_map)
+    {
+	/* row k of B is the diagonal of column k of B */
+	S->Diagonal_map = (Int *) UMF_malloc (m+1, sizeof (Int)) ;
+	ok = (S->Diagonal_map != (Int *) NULL) ;
+	for (k = 0 ; ok && k < m ; k++)
+	{
+	    S->Diagonal_map [k] = Rimap [k] ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* memory required by UMF_kernel_init, as computed by UMFPACK_symbolic */
+    /* ---------------------------------------------------------------------- */
+
+    if (ok)
+    {
+	head_usage = 1 ;
+	tail_usage = 2 + UNITS (Int *, m+1) + UNITS (Entry *, m+1) + 2 ;
+	for (k = 0 ; k < n1_g ; k++)
+	{
+	    head_usage += UNITS (Int, S->Cdeg [k] - 1)
+		+ UNITS (Entry, S->Cdeg [k] - 1)
+		+ UNITS (Int, S->Rdeg [k] - 1)
+		+ UNITS (Entry, S->Rdeg [k] - 1) ;
+	}
+	for (k = n1_g ; k < m ; k++)
+	{
+	    esize = S->Esize ? S->Esize [k - n1_g] : S->Cdeg [k] ;
+	    if (esize > 0)
+	    {
+		tail_usage += GET_ELEMENT_SIZE (esize, 1) + 1 ;
+	    }
+	    /* column tuples */
+	    tlen = S->Esize ? ((esize > 0) + (S->Cdeg [k] - esize)) : 1 ;
+	    tail_usage += 1 + UNITS (Tuple, TUPLES (tlen)) ;
+	}
+	for (k = n1_g ; k < m ; k++)
+	{
+	    rdeg = S->Rdeg [k] ;
+	    if (S->Esize && rdeg > S->dense_row_threshold)
+	    {
+		/* dense row element, with a single row tuple */
+		tail_usage += GET_ELEMENT_SIZE (1, rdeg) + 1 ;
+		rdeg = 1 ;
+	    }
+	    tail_usage += 1 + UNITS (Tuple, TUPLES (rdeg)) ;
+	}
+	S->num_mem_init_usage = head_usage + tail_usage ;
+	S->dnum_mem_init_usage = (double) S->num_mem_init_usage ;
+	S->num_mem_usage_est = MAX (S->dnum_mem_init_usage,
+	    ceil (frac * Symbolic->num_mem_usage_est)) ;
+	S->valid = SYMBOLIC_VALID ;
+    }
+
+    (void) UMF_free ((void *) Flocal) ;
+    (void) UMF_free ((void *) Rimap) ;
+    if (!ok)
+    {
+	DEBUG1 (("group "ID": Symbolic object does not split\n", g)) ;
+	UMFPACK_free_symbolic ((void **) &S) ;
+    }
+    return (S) ;
+}
+
+
+/* ========================================================================== */
+/* === first_udeg =========================================================== */
+/* ========================================================================== */
+
+/* Returns the number of off-diagonal entries in the first nonsingleton row of
+ * U (row n1) of a square nonsingular Numeric object, by following the Uchains
+ * backwards from the last row, as UMF_usolve does. */
+
+PRIVATE Int first_udeg
+(
+    NumericType *G
+)
+{
+    Int k, deg ;
+    deg = 0 ;
+    for (k = G->npiv - 1 ; k > G->n1 ; k--)
+    {
+	if (G->Uip [k] < 0)
+	{
+	    deg = G->Uilen [k] ;
+	}
+	else
+	{
+	    deg -= G->Uilen [k] ;
+	    if (G->Upos [k] != EMPTY)
+	    {
+		deg++ ;
+	    }
+	}
+    }
+    return (deg) ;
+}
+
+
+/* ========================================================================== */
+/* === merge_groups ========================================================= */
+/* ========================================================================== */
+
+/* Merge the Numeric objects of the groups into a single Numeric object. Group
+ * g holds the pivots Gstart [g] to Gstart [g+1]-1.  Returns NULL if out of
+ * memory. */
+
+PRIVATE NumericType *merge_groups
+(
+    NumericType *Gnum [ ],
+    Int ngroups,
+    const Int Gstart [ ],
+    const Int Gcol [ ],
+    const Int Grow [ ],
+    Int n
+)
+{
+    double d ;
+    Entry *D, *xp, *xg ;
+    Unit *Memory ;
+    NumericType *Numeric, *G ;
+    Int g, k, K, j, m, o, kmax, plen, deg, shift, base, q, lp, up, size,
+	do_recip, ilu, scale, *ip, *gp, *Rperm, *Cperm, *Lpos, *Lilen, *Lip, *Upos,
+	*Uilen, *Uip ;
+
+    /* ---------------------------------------------------------------------- */
+    /* find the size of the merged Numeric->Memory */
+    /* ---------------------------------------------------------------------- */
+
+    size = 1 ;
+    do_recip = TRUE ;
+    ilu = FALSE ;
+    for (g = 0 ; g < ngroups ; g++)
+    {
+	G = Gnum [g] ;
+	size += G->size - 1 ;
+	do_recip = do_recip && G->do_recip ;
+	ilu = ilu || G->ilu ;
+	if (g > 0)
+	{
+	    /* new Uchains for the singletons and first row of the group */
+	    m = Gstart [g+1] - Gstart [g] ;
+	    kmax = MIN (G->n1, m-1) ;
+	    for (k = 0 ; k <= kmax ; k++)
+	    {
+		plen = (k == 0) ? 0 : G->Uilen [k-1] ;
+		deg = (k < G->n1) ? G->Uilen [k] : first_udeg (G) ;
+		size += UNITS (Int, plen) + UNITS (Entry, deg) ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate the Numeric object */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric = (NumericType *) UMF_malloc (1, sizeof (NumericType)) ;
+    if (!Numeric)
+    {
+	return ((NumericType *) NULL) ;
+    }
+    Numeric->valid = 0 ;
+    Numeric->view = FALSE ;
+    Numeric->map = NULL ;
+    Numeric->mapsize = 0 ;
+    scale = Gnum [0]->scale ;
+    Numeric->D = (Entry *) UMF_malloc (n+1, sizeof (Entry)) ;
+    Numeric->Rperm = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Cperm = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Lpos = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Lilen = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Lip = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Upos = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Uilen = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Uip = (Int *) UMF_malloc (n+1, sizeof (Int)) ;
+    Numeric->Rs = (scale != UMFPACK_SCALE_NONE) ?
+	((double *) UMF_malloc (n, sizeof (double))) : ((double *) NULL) ;
+    Numeric->Upattern = (Int *) NULL ;
+    Numeric->Memory = (Unit *) UMF_malloc (size, sizeof (Unit)) ;
+
+    if (!Numeric->D || !Numeric->Rperm || !Numeric->Cperm || !Numeric->Lpos
+	|| !Numeric->Lilen || !Numeric->Lip || !Numeric->Upos
+	|| !Numeric->Uilen || !Numeric->Uip || !Numeric->Memory
+	|| (scale != UMFPACK_SCALE_NONE && !Numeric->Rs))
+    {
+	UMFPACK_free_numeric ((void **) &Numeric) ;
+	return ((NumericType *) NULL) ;
+    }
+
+    D = Numeric->D ;
+    Rperm = Numeric->Rperm ;
+    Cperm = Numeric->Cperm ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+    Memory = Numeric->Memory ;
+
+    /* ---------------------------------------------------------------------- */
+    /* scalars */
+    /* ---------------------------------------------------------------------- */
+
+    G = Gnum [0] ;
+    Numeric->relpt = G->relpt ;
+    Numeric->relpt2 = G->relpt2 ;
+    Numeric->droptol = G->droptol ;
+    Numeric->alloc_init = G->alloc_init ;
+    Numeric->front_alloc_init = G->front_alloc_init ;
+    Numeric->scale = scale ;
+    Numeric->ilu = ilu ;
+    Numeric->do_recip = do_recip ;
+    Numeric->n_row = n ;
+    Numeric->n_col = n ;
+    Numeric->n1 = G->n1 ;
+    Numeric->npiv = n ;
+    Numeric->ulen = 0 ;
+    Numeric->size = size ;
+    Numeric->ihead = size ;
+    Numeric->itail = size ;
+    Numeric->ibig = EMPTY ;
+    Numeric->tail_usage = 0 ;
+    Numeric->rsmin = G->rsmin ;
+    Numeric->rsmax = G->rsmax ;
+    Numeric->flops = 0 ;
+    Numeric->init_usage = 0 ;
+    Numeric->max_usage = 0 ;
+    Numeric->ngarbage = 0 ;
+    Numeric->nrealloc = 0 ;
+    Numeric->ncostly = 0 ;
+    Numeric->isize = 0 ;
+    Numeric->nLentries = 0 ;
+    Numeric->nUentries = 0 ;
+    Numeric->lnz = 0 ;
+    Numeric->all_lnz = 0 ;
+    Numeric->unz = 0 ;
+    Numeric->all_unz = 0 ;
+    Numeric->maxfrsize = 0 ;
+    Numeric->maxnrows = 0 ;
+    Numeric->maxncols = 0 ;
+
+    for (g = 0 ; g < ngroups ; g++)
+    {
+	G = Gnum [g] ;
+	Numeric->rsmin = MIN (Numeric->rsmin, G->rsmin) ;
+	Numeric->rsmax = MAX (Numeric->rsmax, G->rsmax) ;
+	Numeric->flops += G->flops ;
+	Numeric->init_usage += G->init_usage ;
+	Numeric->max_usage += G->max_usage ;
+	Numeric->ngarbage += G->ngarbage ;
+	Numeric->nrealloc += G->nrealloc ;
+	Numeric->ncostly += G->ncostly ;
+	Numeric->isize += G->isize ;
+	Numeric->nLentries += G->nLentries ;
+	Numeric->nUentries += G->nUentries ;
+	Numeric->lnz += G->lnz ;
+	Numeric->all_lnz += G->all_lnz ;
+	Numeric->unz += G->unz ;
+	Numeric->all_unz += G->all_unz ;
+	Numeric->maxfrsize = MAX (Numeric->maxfrsize, G->maxfrsize) ;
+	Numeric->maxnrows = MAX (Numeric->maxnrows, G->maxnrows) ;
+	Numeric->maxncols = MAX (Numeric->maxncols, G->maxncols) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* copy the LU factors of each group */
+    /* ---------------------------------------------------------------------- */
+
+    /* Memory [0] is the head marker of the first group.  The rest of the
+     * Memory of each group is copied after the Memory of the prior group, so
+     * that offset p in group g becomes p+shift. */
+    Memory [0] = Gnum [0]->Memory [0] ;
+    base = 1 ;
+    for (g = 0 ; g < ngroups ; g++)
+    {
+	G = Gnum [g] ;
+	o = Gstart [g] ;
+	m = Gstart [g+1] - o ;
+	shift = base - 1 ;
+	if (G->size > 1)
+	{
+	    memcpy (Memory + base, G->Memory + 1, (G->size - 1) * sizeof (Unit));
+	}
+	base += G->size - 1 ;
+
+	for (k = 0 ; k < m ; k++)
+	{
+	    K = o + k ;
+	    D [K] = G->D [k] ;
+	    Rperm [K] = Grow [o + G->Rperm [k]] ;
+	    Cperm [K] = Gcol [o + G->Cperm [k]] ;
+	    Lpos [K] = G->Lpos [k] ;
+	    Lilen [K] = G->Lilen [k] ;
+	    Upos [K] = G->Upos [k] ;
+	    Uilen [K] = G->Uilen [k] ;
+
+	    /* shift the L and U pointers, and the row and column indices */
+	    lp = G->Lip [k] ;
+	    lp = (lp < 0) ? (lp - shift) : (lp + shift) ;
+	    Lip [K] = lp ;
+	    if (Lilen [K] > 0)
+	    {
+		ip = (Int *) (Memory + ((lp < 0) ? (-lp) : lp)) ;
+		for (j = 0 ; j < Lilen [K] ; j++)
+		{
+		    ip [j] += o ;
+		}
+	    }
+	    up = G->Uip [k] ;
+	    up = (up < 0) ? (up - shift) : (up + shift) ;
+	    Uip [K] = up ;
+	    if (Uilen [K] > 0 && (up < 0 || k < G->n1))
+	    {
+		ip = (Int *) (Memory + ((up < 0) ? (-up) : up)) ;
+		for (j = 0 ; j < Uilen [K] ; j++)
+		{
+		    ip [j] += o ;
+		}
+	    }
+	}
+
+	if (scale != UMFPACK_SCALE_NONE)
+	{
+	    for (k = 0 ; k < m ; k++)
+	    {
+		/* the reciprocal scale factors of a group become divisors if
+		 * any other group does not use reciprocals */
+		Numeric->Rs [Grow [o + k]] = (G->do_recip == do_recip) ?
+		    G->Rs [k] : (1.0 / G->Rs [k]) ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* start new Lchains and Uchains at the start of each group */
+    /* ---------------------------------------------------------------------- */
+
+    q = base ;
+    for (g = 1 ; g < ngroups ; g++)
+    {
+	G = Gnum [g] ;
+	o = Gstart [g] ;
+	m = Gstart [g+1] - o ;
+	kmax = MIN (G->n1, m-1) ;
+	for (k = 0 ; k <= kmax ; k++)
+	{
+	    K = o + k ;
+
+	    /* column K of L starts a new Lchain (the singleton layout of a
+	     * column of L is the same as the start of an Lchain) */
+	    lp = Lip [K] ;
+	    Lip [K] = (lp > 0) ? (-lp) : ((lp == 0) ? (-1) : lp) ;
+	    Lpos [K] = EMPTY ;
+
+	    /* row K of U starts a new Uchain: the pattern of row K-1 (empty
+	     * for the last row of the prior group), then the values of row K */
+	    plen = 0 ;
+	    if (k > 0)
+	    {
+		plen = G->Uilen [k-1] ;
+		gp = (Int *) (G->Memory + G->Uip [k-1]) ;
+		ip = (Int *) (Memory + q) ;
+		for (j = 0 ; j < plen ; j++)
+		{
+		    ip [j] = gp [j] + o ;
+		}
+	    }
+	    if (k < G->n1)
+	    {
+		deg = G->Uilen [k] ;
+		xg = (Entry *) (G->Memory + G->Uip [k] + UNITS (Int, deg)) ;
+	    }
+	    else
+	    {
+		deg = first_udeg (G) ;
+		up = G->Uip [k] ;
+		xg = (Entry *) ((up < 0) ?
+		    (G->Memory - up + UNITS (Int, G->Uilen [k])) :
+		    (G->Memory + up)) ;
+	    }
+	    xp = (Entry *) (Memory + q + UNITS (Int, plen)) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		xp [j] = xg [j] ;
+	    }
+	    Uip [K] = -q ;
+	    Uilen [K] = plen ;
+	    Upos [K] = EMPTY ;
+	    q += UNITS (Int, plen) + UNITS (Entry, deg) ;
+	    Numeric->isize += plen ;
+	}
+    }
+    ASSERT (q == size) ;
+
+    Rperm [n] = EMPTY ;
+    Cperm [n] = EMPTY ;
+    Upos [n] = EMPTY ;
+    Lpos [n] = EMPTY ;
+    Uip [n] = EMPTY ;
+    Lip [n] = EMPTY ;
+    Uilen [n] = 0 ;
+    Lilen [n] = 0 ;
+    CLEAR (D [n]) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* find the smallest and largest entries in D, as UMF_kernel_wrapup does */
+    /* ---------------------------------------------------------------------- */
+
+    Numeric->nnzpiv = 0 ;
+    Numeric->min_udiag = 0 ;
+    Numeric->max_udiag = 0 ;
+    for (k = 0 ; k < n ; k++)
+    {
+	ABS (d, D [k]) ;
+	if (SCALAR_IS_NONZERO (d))
+	{
+	    Numeric->nnzpiv++ ;
+	}
+	if (k == 0)
+	{
+	    Numeric->min_udiag = d ;
+	    Numeric->max_udiag = d ;
+	}
+	else
+	{
+	    if (SCALAR_IS_NONZERO (Numeric->min_udiag))
+	    {
+		if (SCALAR_IS_ZERO (d) || SCALAR_IS_NAN (d))
+		{
+		    Numeric->min_udiag = d ;
+		}
+		else if (!SCALAR_IS_NAN (Numeric->min_udiag))
+		{
+		    Numeric->min_udiag = MIN (Numeric->min_udiag, d) ;
+		}
+	    }
+	    if (SCALAR_IS_NAN (d))
+	    {
+		Numeric->max_udiag = d ;
+	    }
+	    else if (!SCALAR_IS_NAN (Numeric->max_udiag))
+	    {
+		Numeric->max_udiag = MAX (Numeric->max_udiag, d) ;
+	    }
+	}
+    }
+
+    return (Numeric) ;
+}
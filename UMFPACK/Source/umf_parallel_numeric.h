@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_parallel_numeric.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+Int UMF_parallel_numeric
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const Scalar Ax [ ],
+#ifdef COMPLEX
+    const Scalar Az [ ],
+#endif
+    SymbolicType *Symbolic,
+    Int nthreads,
+    const double Control [ ],
+    NumericType **NumericHandle,
+    double Info [ ]
+) ;
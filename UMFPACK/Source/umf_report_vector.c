@@ -17,8 +17,8 @@
 PRIVATE void print_value
 (
     Int i,
-    const double Xx [ ],
-    const double Xz [ ],    /* used for complex case only */
+    const Scalar Xx [ ],
+    const Scalar Xz [ ],    /* used for complex case only */
     Int scalar		    /* if true, then print real part only */
 )
 {
@@ -45,8 +45,8 @@ PRIVATE void print_value
 int UMF_report_vector
 (
     Int n,
-    const double Xx [ ],
-    const double Xz [ ],
+    const Scalar Xx [ ],
+    const Scalar Xz [ ],
     Int prl,
     Int user,
     Int scalar
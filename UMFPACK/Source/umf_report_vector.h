@@ -10,8 +10,8 @@
 int UMF_report_vector
 (
     Int n,
-    const double Xx [ ],
-    const double Xz [ ],
+    const Scalar Xx [ ],
+    const Scalar Xz [ ],
     Int prl,
     Int user,
     Int scalar
@@ -13,6 +13,10 @@
     the problem is so large that it would cause integer overflow.
 
     This routine has many double relop's, but the NaN case is ignored.
+
+    UMF_numeric_usage returns the size of the O(n) part of the Numeric object
+    plus the Work object, during factorization, in Units.  This is all the
+    memory used by UMFPACK_numeric except for Numeric->Memory.
 */
 
 #include "umf_internal.h"
@@ -39,31 +43,16 @@ void UMF_set_stats
 )
 {
 
-    double sym_size, work_usage, nn, n_row, n_col, n_inner, num_On_size1,
-	num_On_size2, num_usage, sym_maxncols, sym_maxnrows, elen, n1 ;
+    double sym_size, n_row, n_col, n_inner, num_On_size2, num_usage ;
 
     n_col = Symbolic->n_col ;
     n_row = Symbolic->n_row ;
-    n1 = Symbolic->n1 ;
-    nn = MAX (n_row, n_col) ;
     n_inner = MIN (n_row, n_col) ;
-    sym_maxncols = MIN (Symbolic->maxncols + Symbolic->nb, n_col) ;
-    sym_maxnrows = MIN (Symbolic->maxnrows + Symbolic->nb, n_row) ;
-    elen = (n_col - n1) + (n_row - n1) + MIN (n_col - n1, n_row - n1) + 1 ;
 
     /* final Symbolic object size */
     sym_size = UMF_symbolic_usage (Symbolic->n_row, Symbolic->n_col,
 	Symbolic->nchains, Symbolic->nfr, Symbolic->esize, prefer_diagonal) ;
 
-    /* size of O(n) part of Numeric object during factorization, */
-    /* except Numeric->Memory and Numeric->Upattern */
-    num_On_size1 =
-	DUNITS (NumericType, 1)		/* Numeric structure */
-	+ DUNITS (Entry, n_inner+1)	/* D */
-	+ 4 * DUNITS (Int, n_row+1)	/* Rperm, Lpos, Uilen, Uip */
-	+ 4 * DUNITS (Int, n_col+1)	/* Cperm, Upos, Lilen, Lip */
-	+ (scale ? DUNITS (Entry, n_row) : 0) ;   /* Rs, row scale factors */
-
     /* size of O(n) part of Numeric object after factorization, */
     /* except Numeric->Memory and Numeric->Upattern */
     num_On_size2 =
@@ -100,6 +89,53 @@ void UMF_set_stats
     DEBUGm4 (("maxnrows %g maxncols %g\n", maxnrows, maxncols)) ;
     DEBUGm4 (("maxfrsize %g\n", maxfrsize)) ;
 
+    /* Peak memory for just UMFPACK_numeric. */
+    num_usage =
+	sym_size	/* size of Symbolic object */
+	+ UMF_numeric_usage (Symbolic, scale)	/* O(n) part and Work-> arrays */
+	+ max_usage ;	/* peak size of Numeric->Memory */
+
+    /* peak memory usage for both UMFPACK_*symbolic and UMFPACK_numeric. */
+    Info [UMFPACK_PEAK_MEMORY + what] =
+	MAX (Symbolic->peak_sym_usage, num_usage) ;
+
+    Info [UMFPACK_FLOPS + what] = flops ;
+    Info [UMFPACK_LNZ + what] = lnz ;
+    Info [UMFPACK_UNZ + what] = unz ;
+}
+
+
+/* ========================================================================== */
+/* === UMF_numeric_usage ==================================================== */
+/* ========================================================================== */
+
+double UMF_numeric_usage
+(
+    SymbolicType *Symbolic,
+    Int scale			/* true if scaling the rows of A */
+)
+{
+    double work_usage, nn, n_row, n_col, n_inner, num_On_size1, sym_maxncols,
+	sym_maxnrows, elen, n1 ;
+
+    n_col = Symbolic->n_col ;
+    n_row = Symbolic->n_row ;
+    n1 = Symbolic->n1 ;
+    nn = MAX (n_row, n_col) ;
+    n_inner = MIN (n_row, n_col) ;
+    sym_maxncols = MIN (Symbolic->maxncols + Symbolic->nb, n_col) ;
+    sym_maxnrows = MIN (Symbolic->maxnrows + Symbolic->nb, n_row) ;
+    elen = (n_col - n1) + (n_row - n1) + MIN (n_col - n1, n_row - n1) + 1 ;
+
+    /* size of O(n) part of Numeric object during factorization, */
+    /* except Numeric->Memory and Numeric->Upattern */
+    num_On_size1 =
+	DUNITS (NumericType, 1)		/* Numeric structure */
+	+ DUNITS (Entry, n_inner+1)	/* D */
+	+ 4 * DUNITS (Int, n_row+1)	/* Rperm, Lpos, Uilen, Uip */
+	+ 4 * DUNITS (Int, n_col+1)	/* Cperm, Upos, Lilen, Lip */
+	+ (scale ? DUNITS (Entry, n_row) : 0) ;   /* Rs, row scale factors */
+
     /* UMF_kernel usage, from work_alloc routine in umf_kernel.c */
     work_usage =
 	/* Work-> arrays, except for current frontal matrix which is allocated
@@ -116,18 +152,5 @@ void UMF_set_stats
 	+ DUNITS (Int, Symbolic->nfr + 1)	/* Front_new1strow */
 	+ ((n_row == n_col) ? (2 * DUNITS (Int, nn)) : 0) ;  /* Diag map,imap */
 
-    /* Peak memory for just UMFPACK_numeric. */
-    num_usage =
-	sym_size	/* size of Symbolic object */
-	+ num_On_size1	/* O(n) part of Numeric object (excl. Upattern) */
-	+ work_usage	/* Work-> arrays (including Upattern) */
-	+ max_usage ;	/* peak size of Numeric->Memory */
-
-    /* peak memory usage for both UMFPACK_*symbolic and UMFPACK_numeric. */
-    Info [UMFPACK_PEAK_MEMORY + what] =
-	MAX (Symbolic->peak_sym_usage, num_usage) ;
-
-    Info [UMFPACK_FLOPS + what] = flops ;
-    Info [UMFPACK_LNZ + what] = lnz ;
-    Info [UMFPACK_UNZ + what] = unz ;
+    return (num_On_size1 + work_usage) ;
 }
@@ -25,3 +25,9 @@ void UMF_set_stats
     Int prefer_diagonal,
     Int what
 ) ;
+
+double UMF_numeric_usage
+(
+    SymbolicType *Symbolic,
+    Int scale
+) ;
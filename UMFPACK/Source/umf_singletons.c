@@ -34,10 +34,25 @@
  * permuted to block triangular form, but UMFPACK does not perform the full
  * BTF permutation (see also "dmperm" in MATLAB, CSparse cs_dmperm,
  * and SuiteSparse/BTF).
+ *
+ * If nthreads > 1, the scan of A and the construction of its row form are
+ * split among OpenMP threads, each thread taking a contiguous range of
+ * columns with about the same number of entries.  Thread t counts the
+ * entries in each row of its range in Count [t*n_row ... (t+1)*n_row-1],
+ * which then gives the offsets for its part of the row form.  The singleton
+ * queue itself is processed in order, so the permutations are the same for
+ * any number of threads.
  */
 
 #include "umf_internal.h"
 #include "umf_singletons.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
+
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+/* the debug and test-coverage code is not thread-safe */
+#define PARALLEL_SINGLETONS
+#endif
 
 #ifndef NDEBUG
 
@@ -136,10 +151,16 @@ PRIVATE void create_row_form
     Int Ri [ ],		    /* Ri [0..nz-1]:  column indices for R */
 
     /* workspace, not defined on input or output */
-    Int W [ ]		    /* size n_row */
+    Int W [ ],		    /* size n_row */
+
+    /* parallel construction, if nthreads > 1: */
+    Int nthreads,
+    const Int Colstart [ ], /* size nthreads+1, column ranges of each thread */
+    Int Count [ ]	    /* size nthreads*n_row, row counts of each range,
+			     * destroyed on output */
 )
 {
-    Int row, col, p, p2 ;
+    Int row, col, p, p2, t ;
 
     /* create the row pointers */
     Rp [0] = 0 ;
@@ -150,6 +171,44 @@ PRIVATE void create_row_form
 	W [row] = Rp [row] ;
     }
 
+    if (nthreads > 1)
+    {
+	/* replace the row counts of each range with their starting offsets */
+#ifdef PARALLEL_SINGLETONS
+	#pragma omp parallel for num_threads(nthreads) schedule(static) \
+	    private(t)
+#endif
+	for (row = 0 ; row < n_row ; row++)
+	{
+	    Int c, pr = Rp [row] ;
+	    for (t = 0 ; t < nthreads ; t++)
+	    {
+		c = Count [t*n_row + row] ;
+		Count [t*n_row + row] = pr ;
+		pr += c ;
+	    }
+	}
+
+	/* create the indices for the row-form, one range of columns each */
+#ifdef PARALLEL_SINGLETONS
+	#pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	    private(col, p, p2)
+#endif
+	for (t = 0 ; t < nthreads ; t++)
+	{
+	    Int *Wt = Count + t*n_row ;
+	    for (col = Colstart [t] ; col < Colstart [t+1] ; col++)
+	    {
+		p2 = Ap [col+1] ;
+		for (p = Ap [col] ; p < p2 ; p++)
+		{
+		    Ri [Wt [Ai [p]]++] = col ;
+		}
+	    }
+	}
+	return ;
+    }
+
     /* create the indices for the row-form */
     for (col = 0 ; col < n_col ; col++)
     {
@@ -338,7 +397,12 @@ PRIVATE Int find_any_singletons	    /* returns # of singletons found */
     Int Rp [ ],		    /* size n_row+1 */
     Int Ri [ ],		    /* size nz */
     Int W [ ],		    /* size n_row */
-    Int Next [ ]	    /* size MAX (n_row, n_col) */
+    Int Next [ ],	    /* size MAX (n_row, n_col) */
+
+    /* for the parallel construction of the row form: */
+    Int nthreads,
+    const Int Colstart [ ],
+    Int Count [ ]
 )
 {
     Int n1, col, row, row_form, head, tail, n1r, n1c ;
@@ -373,7 +437,8 @@ PRIVATE Int find_any_singletons	    /* returns # of singletons found */
 	/* create the row-form of A */
 	/* ------------------------------------------------------------------ */
 
-	create_row_form (n_row, n_col, Ap, Ai, Rdeg, Rp, Ri, W) ;
+	create_row_form (n_row, n_col, Ap, Ai, Rdeg, Rp, Ri, W,
+		nthreads, Colstart, Count) ;
 	row_form = TRUE ;
 
 	/* ------------------------------------------------------------------ */
@@ -417,7 +482,8 @@ PRIVATE Int find_any_singletons	    /* returns # of singletons found */
 
 	if (!row_form)
 	{
-	    create_row_form (n_row, n_col, Ap, Ai, Rdeg, Rp, Ri, W) ;
+	    create_row_form (n_row, n_col, Ap, Ai, Rdeg, Rp, Ri, W,
+		nthreads, Colstart, Count) ;
 	}
 
 	/* ------------------------------------------------------------------ */
@@ -466,7 +532,12 @@ PRIVATE Int find_user_singletons	/* returns # singletons found */
     /* workspace, not defined on input or output */
     Int Rp [ ],		    /* size n_row+1 */
     Int Ri [ ],		    /* size nz */
-    Int W [ ]		    /* size n_row */
+    Int W [ ],		    /* size n_row */
+
+    /* for the parallel construction of the row form: */
+    Int nthreads,
+    const Int Colstart [ ],
+    Int Count [ ]
 )
 {
     Int n1, col, row, p, p2, pivcol, pivrow, found, k, n1r, n1c ;
@@ -504,7 +575,8 @@ PRIVATE Int find_user_singletons	/* returns # singletons found */
     }
 
     /* there is at least one row or column singleton.  Look for more. */
-    create_row_form (n_row, n_col, Ap, Ai, Rdeg, Rp, Ri, W) ;
+    create_row_form (n_row, n_col, Ap, Ai, Rdeg, Rp, Ri, W,
+	nthreads, Colstart, Count) ;
 
     n1 = 0 ;
 
@@ -768,11 +840,14 @@ Int UMF_singletons
     Int Rp [ ],		/* size n_row+1 */
     Int Ri [ ],		/* size nz */
     Int W [ ],		/* size n_row */
-    Int Next [ ]	/* size MAX (n_row, n_col) */
+    Int Next [ ],	/* size MAX (n_row, n_col) */
+
+    Int nthreads	/* number of threads to use */
 )
 {
     Int n1, s, col, row, p, p1, p2, cdeg, last_row, is_sym, k,
-	nempty_row, nempty_col, max_cdeg, max_rdeg, n1c, n1r ;
+	nempty_row, nempty_col, max_cdeg, max_rdeg, n1c, n1r, t, nz, ok,
+	*Count, Colstart [UMF_SINGLETONS_MAXTHREADS+1] ;
 
     /* ---------------------------------------------------------------------- */
     /* initializations */
@@ -791,31 +866,139 @@ Int UMF_singletons
     {
 	return (UMFPACK_ERROR_invalid_matrix) ;
     }
-    for (row = 0 ; row < n_row ; row++)
+
+    /* give each thread at least UMF_SINGLETONS_CHUNK entries */
+    nz = Ap [n_col] ;
+    Count = (Int *) NULL ;
+#ifdef PARALLEL_SINGLETONS
+    nthreads = MIN (nthreads, nz / UMF_SINGLETONS_CHUNK) ;
+    nthreads = MIN (nthreads, UMF_SINGLETONS_MAXTHREADS) ;
+#else
+    nthreads = 1 ;
+#endif
+    if (nthreads > 1)
     {
-	Rdeg [row] = 0 ;
+	Count = (Int *) UMF_malloc (nthreads * n_row, sizeof (Int)) ;
+	if (Count == (Int *) NULL)
+	{
+	    /* not enough memory for the parallel scan; do it sequentially */
+	    nthreads = 1 ;
+	}
     }
-    for (col = 0 ; col < n_col ; col++)
+
+    if (nthreads > 1)
     {
-	p1 = Ap [col] ;
-	p2 = Ap [col+1] ;
-	cdeg = p2 - p1 ;
-	if (cdeg < 0)
+
+	/* ------------------------------------------------------------------ */
+	/* split the columns into ranges with about nz/nthreads entries */
+	/* ------------------------------------------------------------------ */
+
+	Colstart [0] = 0 ;
+	col = 0 ;
+	for (t = 1 ; t < nthreads ; t++)
+	{
+	    Int pt = (Int) (((double) nz) * t / nthreads) ;
+	    while (col < n_col && Ap [col] < pt) col++ ;
+	    Colstart [t] = col ;
+	}
+	Colstart [nthreads] = n_col ;
+
+	/* ------------------------------------------------------------------ */
+	/* check each range of columns and count its entries in each row */
+	/* ------------------------------------------------------------------ */
+
+	ok = TRUE ;
+#ifdef PARALLEL_SINGLETONS
+	#pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	    private(col, row, p, p1, p2, cdeg, last_row) reduction(&&:ok)
+#endif
+	for (t = 0 ; t < nthreads ; t++)
 	{
+	    Int *Wt = Count + t*n_row ;
+	    for (row = 0 ; row < n_row ; row++)
+	    {
+		Wt [row] = 0 ;
+	    }
+	    for (col = Colstart [t] ; ok && col < Colstart [t+1] ; col++)
+	    {
+		p1 = Ap [col] ;
+		p2 = Ap [col+1] ;
+		cdeg = p2 - p1 ;
+		if (cdeg < 0)
+		{
+		    ok = FALSE ;
+		    break ;
+		}
+		last_row = EMPTY ;
+		for (p = p1 ; p < p2 ; p++)
+		{
+		    row = Ai [p] ;
+		    if (row <= last_row || row >= n_row)
+		    {
+			ok = FALSE ;
+			break ;
+		    }
+		    Wt [row]++ ;
+		    last_row = row ;
+		}
+		Cdeg [col] = cdeg ;
+	    }
+	}
+	if (!ok)
+	{
+	    (void) UMF_free ((void *) Count) ;
 	    return (UMFPACK_ERROR_invalid_matrix) ;
 	}
-	last_row = EMPTY ;
-	for (p = p1 ; p < p2 ; p++)
+
+	/* the row degrees are the sums of the counts of each range */
+#ifdef PARALLEL_SINGLETONS
+	#pragma omp parallel for num_threads(nthreads) schedule(static) \
+	    private(t)
+#endif
+	for (row = 0 ; row < n_row ; row++)
+	{
+	    Int rdeg = 0 ;
+	    for (t = 0 ; t < nthreads ; t++)
+	    {
+		rdeg += Count [t*n_row + row] ;
+	    }
+	    Rdeg [row] = rdeg ;
+	}
+
+    }
+    else
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* sequential scan */
+	/* ------------------------------------------------------------------ */
+
+	for (row = 0 ; row < n_row ; row++)
 	{
-	    row = Ai [p] ;
-	    if (row <= last_row || row >= n_row)
+	    Rdeg [row] = 0 ;
+	}
+	for (col = 0 ; col < n_col ; col++)
+	{
+	    p1 = Ap [col] ;
+	    p2 = Ap [col+1] ;
+	    cdeg = p2 - p1 ;
+	    if (cdeg < 0)
 	    {
 		return (UMFPACK_ERROR_invalid_matrix) ;
 	    }
-	    Rdeg [row]++ ;
-	    last_row = row ;
+	    last_row = EMPTY ;
+	    for (p = p1 ; p < p2 ; p++)
+	    {
+		row = Ai [p] ;
+		if (row <= last_row || row >= n_row)
+		{
+		    return (UMFPACK_ERROR_invalid_matrix) ;
+		}
+		Rdeg [row]++ ;
+		last_row = row ;
+	    }
+	    Cdeg [col] = cdeg ;
 	}
-	Cdeg [col] = cdeg ;
     }
 
     /* ---------------------------------------------------------------------- */
@@ -836,7 +1019,8 @@ Int UMF_singletons
 	{
 	    /* look for singletons, but respect the user's input permutation */
 	    n1 = find_user_singletons (n_row, n_col, Ap, Ai, Quser,
-		    Cdeg, Rdeg, Cperm, Rperm, &n1r, &n1c, Rp, Ri, W) ;
+		    Cdeg, Rdeg, Cperm, Rperm, &n1r, &n1c, Rp, Ri, W,
+		    nthreads, Colstart, Count) ;
 	}
 	else
 	{
@@ -851,7 +1035,13 @@ Int UMF_singletons
     {
 	/* look for singletons anywhere */
 	n1 = find_any_singletons (n_row, n_col, Ap, Ai,
-		Cdeg, Rdeg, Cperm, Rperm, &n1r, &n1c, Rp, Ri, W, Next) ;
+		Cdeg, Rdeg, Cperm, Rperm, &n1r, &n1c, Rp, Ri, W, Next,
+		nthreads, Colstart, Count) ;
+    }
+
+    if (Count != (Int *) NULL)
+    {
+	(void) UMF_free ((void *) Count) ;
     }
 
     /* ---------------------------------------------------------------------- */
@@ -882,6 +1072,10 @@ Int UMF_singletons
     /* compute the inverse of Rperm */
     /* ---------------------------------------------------------------------- */
 
+#ifdef PARALLEL_SINGLETONS
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+	if (nthreads > 1)
+#endif
     for (k = 0 ; k < n_row ; k++)
     {
 	ASSERT (Rperm [k] >= 0 && Rperm [k] < n_row) ;
@@ -7,6 +7,12 @@
 
 //------------------------------------------------------------------------------
 
+/* minimum number of entries for each thread in UMF_singletons */
+#define UMF_SINGLETONS_CHUNK (256*1024)
+
+/* maximum number of threads used by UMF_singletons */
+#define UMF_SINGLETONS_MAXTHREADS 64
+
 Int UMF_singletons
 (
     Int n_row,
@@ -31,5 +37,6 @@ Int UMF_singletons
     Int Rp [ ],
     Int Ri [ ],
     Int W [ ],
-    Int Next [ ]
+    Int Next [ ],
+    Int nthreads
 ) ;
@@ -56,13 +56,13 @@ Int UMF_solve
     int sys,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
-    double Xx [ ],
-    const double Bx [ ],
+    const Scalar Ax [ ],
+    Scalar Xx [ ],
+    const Scalar Bx [ ],
 #ifdef COMPLEX
-    const double Az [ ],
-    double Xz [ ],
-    const double Bz [ ],
+    const Scalar Az [ ],
+    Scalar Xz [ ],
+    const Scalar Bz [ ],
 #endif
     NumericType *Numeric,
     Int irstep,
@@ -1211,7 +1211,7 @@ Int UMF_solve
     }
 
 #ifdef COMPLEX
-    /* copy the solution back, from Entry X [ ] to double Xx [ ] and Xz [ ] */
+    /* copy the solution back, from Entry X [ ] to Scalar Xx [ ] and Xz [ ] */
     if (AXsplit)
     {
 	for (i = 0 ; i < n ; i++)
@@ -1257,7 +1257,7 @@ PRIVATE Int do_step		/* return TRUE if iterative refinement done */
 
     nctau = 1000 * n * DBL_EPSILON ;
     DEBUG0 (("do_step start: nctau = %30.20e\n", nctau)) ;
-    ASSERT (UMF_report_vector (n, (double *) X, (double *) NULL, UMF_debug,
+    ASSERT (UMF_report_vector (n, (Scalar *) X, (Scalar *) NULL, UMF_debug,
 	FALSE, FALSE) == UMFPACK_OK) ;
 
     /* for approximate flop count, assume d1 > tau is always true */
@@ -1338,7 +1338,7 @@ PRIVATE Int do_step		/* return TRUE if iterative refinement done */
     if (SCALAR_IS_NAN (omega [0]))
     {
 	DEBUG0 (("omega[0] is NaN - done.\n")) ;
-	ASSERT (UMF_report_vector (n, (double *) X, (double *) NULL, UMF_debug,
+	ASSERT (UMF_report_vector (n, (Scalar *) X, (Scalar *) NULL, UMF_debug,
 	    FALSE, FALSE) == UMFPACK_OK) ;
 	return (TRUE) ;
     }
@@ -1346,7 +1346,7 @@ PRIVATE Int do_step		/* return TRUE if iterative refinement done */
     if (omega [0] < DBL_EPSILON)    /* double relop, but no NaN case here */
     {
 	DEBUG0 (("omega[0] too small - done.\n")) ;
-	ASSERT (UMF_report_vector (n, (double *) X, (double *) NULL, UMF_debug,
+	ASSERT (UMF_report_vector (n, (Scalar *) X, (Scalar *) NULL, UMF_debug,
 	    FALSE, FALSE) == UMFPACK_OK) ;
 	return (TRUE) ;
     }
@@ -1371,7 +1371,7 @@ PRIVATE Int do_step		/* return TRUE if iterative refinement done */
 	    Info [UMFPACK_OMEGA2] = last_omega [2] ;
 	}
 	Info [UMFPACK_IR_TAKEN] = step - 1 ;
-	ASSERT (UMF_report_vector (n, (double *) X, (double *) NULL, UMF_debug,
+	ASSERT (UMF_report_vector (n, (Scalar *) X, (Scalar *) NULL, UMF_debug,
 	    FALSE, FALSE) == UMFPACK_OK) ;
 	return (TRUE) ;
     }
@@ -1389,7 +1389,7 @@ PRIVATE Int do_step		/* return TRUE if iterative refinement done */
     /* iterative refinement continues */
     /* ---------------------------------------------------------------------- */
 
-    ASSERT (UMF_report_vector (n, (double *) X, (double *) NULL, UMF_debug,
+    ASSERT (UMF_report_vector (n, (Scalar *) X, (Scalar *) NULL, UMF_debug,
 	FALSE, FALSE) == UMFPACK_OK) ;
     return (FALSE) ;
 }
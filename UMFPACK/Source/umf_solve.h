@@ -13,13 +13,13 @@ Int UMF_solve
     int sys,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
-    double Xx [ ],
-    const double Bx [ ],
+    const Scalar Ax [ ],
+    Scalar Xx [ ],
+    const Scalar Bx [ ],
 #ifdef COMPLEX
-    const double Az [ ],
-    double Xz [ ],
-    const double Bz [ ],
+    const Scalar Az [ ],
+    Scalar Xz [ ],
+    const Scalar Bz [ ],
 #endif
     NumericType *Numeric,
     Int irstep,
@@ -0,0 +1,592 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_solve_mixed: mixed-precision solve of a linear system
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Not user-callable.  Solves Ax=b, A'x=b, or A.'x=b using a single precision
+    factorization computed by UMFPACK_numeric (umfpack_si_numeric, etc), where
+    A, x, and b are double.  Only compiled for the single precision versions.
+
+    The solution x and the residual r = b - A*x are held in double precision.
+    Each step solves A*w = r with the single precision LU factors, and updates
+    x = x + w.  Iterative refinement stops when the sparse backward error of
+    Arioli, Demmel, and Duff (see umf_solve.c) falls below DBL_EPSILON, when it
+    fails to decrease by a factor of two, or after irstep steps.  Since the
+    residual is computed in double precision, the solution is accurate to
+    double precision if A is not too ill-conditioned (cond(A)*FLT_EPSILON
+    well below one), even though the factors are single precision.
+
+    Returns UMFPACK_OK, UMFPACK_WARNING_singular_matrix (in which case no
+    iterative refinement is done), UMFPACK_ERROR_argument_missing, or
+    UMFPACK_ERROR_invalid_system if sys is not UMFPACK_A, UMFPACK_At, or
+    UMFPACK_Aat.  No workspace is dynamically allocated.
+*/
+
+#include "umf_internal.h"
+#include "umf_solve_mixed.h"
+#include "umf_lsolve.h"
+#include "umf_usolve.h"
+#include "umf_ltsolve.h"
+#include "umf_utsolve.h"
+
+/* -------------------------------------------------------------------------- */
+/* double precision entries */
+/* -------------------------------------------------------------------------- */
+
+/* The Entry type holds the single precision entries of the LU factors.  A
+ * DEntry holds a double precision entry of x, r, or b. */
+
+#ifdef COMPLEX
+
+#define DEntry DoubleComplex
+
+/* c = s1 [p] + s2 [p] i, where s1 and s2 are double, and packed if s2 NULL */
+#define DASSIGN(c,s1,s2,p,split) \
+{ \
+    if (split) \
+    { \
+	(c).Real = (s1) [p] ; \
+	(c).Imag = (s2) [p] ; \
+    } \
+    else \
+    { \
+	(c).Real = (s1) [2*(p)] ; \
+	(c).Imag = (s1) [2*(p)+1] ; \
+    } \
+}
+
+/* w = x rounded to single precision */
+#define DEMOTE(w,x) \
+{ \
+    (w).Real = (float) ((x).Real) ; \
+    (w).Imag = (float) ((x).Imag) ; \
+}
+
+/* x = w, promoted to double precision */
+#define PROMOTE(x,w) \
+{ \
+    (x).Real = (w).Real ; \
+    (x).Imag = (w).Imag ; \
+}
+
+#else
+
+#define DEntry double
+#define DASSIGN(c,s1,s2,p,split) { (c) = (s1) [p] ; }
+#define DEMOTE(w,x)		  { (w) = (float) (x) ; }
+#define PROMOTE(x,w)		  { (x) = (w) ; }
+
+#endif
+
+PRIVATE Int do_step
+(
+    double omega [3],
+    Int step,
+    const double B2 [ ],
+    DEntry X [ ],
+    const DEntry R [ ],
+    const double Y [ ],
+    const double Z2 [ ],
+    DEntry S [ ],
+    Int n,
+    double Info [UMFPACK_INFO]
+) ;
+
+/* ========================================================================== */
+/* === UMF_solve_mixed ====================================================== */
+/* ========================================================================== */
+
+Int UMF_solve_mixed
+(
+    int sys,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+    double Xx [ ],
+    const double Bx [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+    double Xz [ ],
+    const double Bz [ ],
+#endif
+    NumericType *Numeric,
+    Int irstep,
+    double Info [UMFPACK_INFO],
+    Int Pattern [ ],		/* size n */
+    double SolveWork [ ]	/* size UMF_SOLVE_MIXED_WSIZE (n) */
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    DEntry aij, axx, ri, xj, *X, *R, *S ;
+    Entry *W ;
+    double omega [3], d, yi, z2i, flops, *Y, *B2, *Z2, *Rs ;
+    Int *Rperm, *Cperm, i, j, k, n, p, p2, nz, step, status, do_scale ;
+#ifdef COMPLEX
+    Int Asplit, Bsplit, Xsplit ;
+#endif
+#ifndef NRECIPROCAL
+    Int do_recip = Numeric->do_recip ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* initializations */
+    /* ---------------------------------------------------------------------- */
+
+    ASSERT (Numeric && Xx && Bx && Pattern && SolveWork && Info) ;
+
+    omega [0] = 0. ;
+    omega [1] = 0. ;
+    omega [2] = 0. ;
+    Rperm = Numeric->Rperm ;
+    Cperm = Numeric->Cperm ;
+    Rs = Numeric->Rs ;		/* row scale factors */
+    do_scale = (Rs != (double *) NULL) ;
+    flops = 0 ;
+    Info [UMFPACK_SOLVE_FLOPS] = 0 ;
+    Info [UMFPACK_IR_TAKEN] = 0 ;
+    Info [UMFPACK_IR_ATTEMPTED] = 0 ;
+
+    /* UMFPACK_solve_mixed does not call this routine if A is rectangular */
+    ASSERT (Numeric->n_row == Numeric->n_col) ;
+    n = Numeric->n_row ;
+    if (Numeric->nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+    {
+	DEBUGm4 (("Note, matrix is singular in umf_solve_mixed\n")) ;
+	status = UMFPACK_WARNING_singular_matrix ;
+	irstep = 0 ;
+    }
+    else
+    {
+	status = UMFPACK_OK ;
+    }
+    irstep = MAX (0, irstep) ;			/* make sure irstep is >= 0 */
+
+    if (sys != UMFPACK_A && sys != UMFPACK_At && sys != UMFPACK_Aat)
+    {
+	return (UMFPACK_ERROR_invalid_system) ;
+    }
+    if (irstep > 0 && (!Ap || !Ai || !Ax))
+    {
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* get the workspace */
+    /* ---------------------------------------------------------------------- */
+
+#ifdef COMPLEX
+    /* A, B, and X in split format if Az, Bz, and Xz present */
+    Asplit = (Az != (double *) NULL) ;
+    Bsplit = (Bz != (double *) NULL) ;
+    Xsplit = (Xz != (double *) NULL) ;
+    X = Xsplit ? ((DEntry *) SolveWork) : ((DEntry *) Xx) ;
+    R = (DEntry *) (SolveWork + 2*n) ;	/* DEntry R [0..n-1] */
+    S = (DEntry *) (SolveWork + 4*n) ;	/* DEntry S [0..n-1] */
+    W = (Entry *) (SolveWork + 6*n) ;	/* Entry W [0..n-1] */
+    Y = SolveWork + 7*n ;		/* double Y [0..n-1] */
+    B2 = SolveWork + 8*n ;		/* double B2 [0..n-1] */
+    Z2 = SolveWork + 9*n ;		/* double Z2 [0..n-1] */
+#else
+    X = (DEntry *) Xx ;			/* DEntry X [0..n-1] */
+    R = (DEntry *) SolveWork ;		/* DEntry R [0..n-1] */
+    S = (DEntry *) (SolveWork + n) ;	/* DEntry S [0..n-1] */
+    W = (Entry *) (SolveWork + 2*n) ;	/* Entry W [0..n-1] */
+    Y = SolveWork + 3*n ;		/* double Y [0..n-1] */
+    B2 = SolveWork + 4*n ;		/* double B2 [0..n-1] */
+    Z2 = SolveWork + 5*n ;		/* double Z2 [0..n-1] */
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* Y (i) = 1-norm of row i of A, A', or A.', and B2 = abs (B) */
+    /* ---------------------------------------------------------------------- */
+
+    if (irstep > 0)
+    {
+	nz = Ap [n] ;
+	Info [UMFPACK_NZ] = nz ;
+	flops += (ABS_FLOPS + 1) * nz ;
+	if (sys == UMFPACK_A)
+	{
+	    /* A is stored by column */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		Y [i] = 0. ;
+	    }
+	    for (p = 0 ; p < nz ; p++)
+	    {
+		/* Y [Ai [p]] += ABS (Ax [p]) ; */
+		DASSIGN (aij, Ax, Az, p, Asplit) ;
+		ABS (d, aij) ;
+		Y [Ai [p]] += d ;
+	    }
+	}
+	else
+	{
+	    /* A' and A.' are stored by row */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		yi = 0. ;
+		p2 = Ap [i+1] ;
+		for (p = Ap [i] ; p < p2 ; p++)
+		{
+		    DASSIGN (aij, Ax, Az, p, Asplit) ;
+		    ABS (d, aij) ;
+		    yi += d ;
+		}
+		Y [i] = yi ;
+	    }
+	}
+	flops += ABS_FLOPS * n ;
+	for (i = 0 ; i < n ; i++)
+	{
+	    /* B2 [i] = ABS (B [i]) ; */
+	    DASSIGN (ri, Bx, Bz, i, Bsplit) ;
+	    ABS (B2 [i], ri) ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* R = b and X = 0 */
+    /* ---------------------------------------------------------------------- */
+
+    for (i = 0 ; i < n ; i++)
+    {
+	DASSIGN (R [i], Bx, Bz, i, Bsplit) ;
+    }
+    for (i = 0 ; i < n ; i++)
+    {
+	CLEAR (X [i]) ;
+    }
+
+    for (step = 0 ; step <= irstep ; step++)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* solve A w = r with the single precision factors, and x = x + w */
+	/* ------------------------------------------------------------------ */
+
+	if (sys == UMFPACK_A)
+	{
+	    /* W = P R r, rounded to single precision */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		k = Rperm [i] ;
+		ri = R [k] ;
+		if (do_scale)
+		{
+#ifndef NRECIPROCAL
+		    if (do_recip)
+		    {
+			/* multiply by the scale factors */
+			SCALE (ri, Rs [k]) ;
+		    }
+		    else
+#endif
+		    {
+			/* divide by the scale factors */
+			SCALE_DIV (ri, Rs [k]) ;
+		    }
+		}
+		DEMOTE (W [i], ri) ;
+	    }
+	    flops += UMF_lsolve (Numeric, W, Pattern) ;
+	    flops += UMF_usolve (Numeric, W, Pattern) ;
+
+	    /* X = X + Q W */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		PROMOTE (ri, W [i]) ;
+		ASSEMBLE (X [Cperm [i]], ri) ;
+	    }
+	}
+	else
+	{
+	    /* W = Q' r, rounded to single precision */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		DEMOTE (W [i], R [Cperm [i]]) ;
+	    }
+	    if (sys == UMFPACK_At)
+	    {
+		/* A' is the complex conjugate transpose */
+		flops += UMF_uhsolve (Numeric, W, Pattern) ;
+		flops += UMF_lhsolve (Numeric, W, Pattern) ;
+	    }
+	    else
+	    {
+		/* A.' is the array transpose */
+		flops += UMF_utsolve (Numeric, W, Pattern) ;
+		flops += UMF_ltsolve (Numeric, W, Pattern) ;
+	    }
+
+	    /* X = X + R P' W */
+	    for (i = 0 ; i < n ; i++)
+	    {
+		k = Rperm [i] ;
+		PROMOTE (ri, W [i]) ;
+		if (do_scale)
+		{
+#ifndef NRECIPROCAL
+		    if (do_recip)
+		    {
+			/* multiply by the scale factors */
+			SCALE (ri, Rs [k]) ;
+		    }
+		    else
+#endif
+		    {
+			/* divide by the scale factors */
+			SCALE_DIV (ri, Rs [k]) ;
+		    }
+		}
+		ASSEMBLE (X [k], ri) ;
+	    }
+	}
+	flops += (ASSEMBLE_FLOPS + (do_scale ? SCALE_FLOPS : 0)) * n ;
+
+	/* ------------------------------------------------------------------ */
+	/* sparse backward error estimate */
+	/* ------------------------------------------------------------------ */
+
+	if (irstep > 0)
+	{
+
+	    /* -------------------------------------------------------------- */
+	    /* R = b - A x and Z2 = |A||x|, in double precision */
+	    /* -------------------------------------------------------------- */
+
+	    flops += (MULT_FLOPS + DECREMENT_FLOPS + ABS_FLOPS + 1) * nz ;
+	    if (sys == UMFPACK_A)
+	    {
+		/* A is stored by column */
+		for (i = 0 ; i < n ; i++)
+		{
+		    DASSIGN (R [i], Bx, Bz, i, Bsplit) ;
+		    Z2 [i] = 0. ;
+		}
+		for (j = 0 ; j < n ; j++)
+		{
+		    xj = X [j] ;
+		    p2 = Ap [j+1] ;
+		    for (p = Ap [j] ; p < p2 ; p++)
+		    {
+			i = Ai [p] ;
+			/* axx = Ax [p] * xj ; */
+			DASSIGN (aij, Ax, Az, p, Asplit) ;
+			MULT (axx, aij, xj) ;
+			/* R [i] -= axx ; */
+			DECREMENT (R [i], axx) ;
+			/* Z2 [i] += ABS (axx) ; */
+			ABS (d, axx) ;
+			Z2 [i] += d ;
+		    }
+		}
+	    }
+	    else
+	    {
+		/* A' and A.' are stored by row */
+		for (i = 0 ; i < n ; i++)
+		{
+		    DASSIGN (ri, Bx, Bz, i, Bsplit) ;
+		    z2i = 0. ;
+		    p2 = Ap [i+1] ;
+		    for (p = Ap [i] ; p < p2 ; p++)
+		    {
+			DASSIGN (aij, Ax, Az, p, Asplit) ;
+			if (sys == UMFPACK_At)
+			{
+			    /* axx = conjugate (Ax [p]) * X [Ai [p]] ; */
+			    MULT_CONJ (axx, X [Ai [p]], aij) ;
+			}
+			else
+			{
+			    /* axx = Ax [p] * X [Ai [p]] ; */
+			    MULT (axx, aij, X [Ai [p]]) ;
+			}
+			DECREMENT (ri, axx) ;
+			ABS (d, axx) ;
+			z2i += d ;
+		    }
+		    R [i] = ri ;
+		    Z2 [i] = z2i ;
+		}
+	    }
+
+	    flops += (2*ABS_FLOPS + 5) * n ;
+	    if (do_step (omega, step, B2, X, R, Y, Z2, S, n, Info))
+	    {
+		/* iterative refinement is done */
+		break ;
+	    }
+	}
+    }
+
+#ifdef COMPLEX
+    /* copy the solution back, from DEntry X [ ] to double Xx [ ] and Xz [ ] */
+    if (Xsplit)
+    {
+	for (i = 0 ; i < n ; i++)
+	{
+	    Xx [i] = REAL_COMPONENT (X [i]) ;
+	    Xz [i] = IMAG_COMPONENT (X [i]) ;
+	}
+    }
+#endif
+
+    /* return UMFPACK_OK, or UMFPACK_WARNING_singular_matrix */
+    Info [UMFPACK_SOLVE_FLOPS] = flops ;
+    return (status) ;
+}
+
+
+/* ========================================================================== */
+/* === do_step ============================================================== */
+/* ========================================================================== */
+
+/* Perform one step of iterative refinement.  Same as do_step in umf_solve.c,
+ * except that X, R, and S are double precision. */
+
+PRIVATE Int do_step		/* return TRUE if iterative refinement done */
+(
+    double omega [3],
+    Int step,			/* which step of iterative refinement to do */
+    const double B2 [ ],	/* abs (B) */
+    DEntry X [ ],
+    const DEntry R [ ],		/* residual, b - A x */
+    const double Y [ ],
+    const double Z2 [ ],
+    DEntry S [ ],
+    Int n,
+    double Info [UMFPACK_INFO]
+)
+{
+    double last_omega [3], tau, nctau, d1, wd1, d2, wd2, xi, yix, ri, xnorm ;
+    Int i ;
+
+    nctau = 1000 * n * DBL_EPSILON ;
+
+    /* ---------------------------------------------------------------------- */
+    /* save the last iteration in case we need to reinstate it */
+    /* ---------------------------------------------------------------------- */
+
+    last_omega [0] = omega [0] ;
+    last_omega [1] = omega [1] ;
+    last_omega [2] = omega [2] ;
+
+    /* ---------------------------------------------------------------------- */
+    /* compute sparse backward errors: omega [1] and omega [2] */
+    /* ---------------------------------------------------------------------- */
+
+    /* xnorm = ||x|| maxnorm */
+    xnorm = 0.0 ;
+    for (i = 0 ; i < n ; i++)
+    {
+	/* xi = ABS (X [i]) ; */
+	ABS (xi, X [i]) ;
+	if (SCALAR_IS_NAN (xi))
+	{
+	    xnorm = xi ;
+	    break ;
+	}
+	/* no NaN's to consider here: */
+	xnorm = MAX (xnorm, xi) ;
+    }
+
+    omega [1] = 0. ;
+    omega [2] = 0. ;
+    for (i = 0 ; i < n ; i++)
+    {
+	yix = Y [i] * xnorm ;
+	tau = (yix + B2 [i]) * nctau ;
+	d1 = Z2 [i] + B2 [i] ;
+	/* ri = ABS (R [i]) ; */
+	ABS (ri, R [i]) ;
+	if (SCALAR_IS_NAN (d1))
+	{
+	    omega [1] = d1 ;
+	    omega [2] = d1 ;
+	    break ;
+	}
+	if (SCALAR_IS_NAN (tau))
+	{
+	    omega [1] = tau ;
+	    omega [2] = tau ;
+	    break ;
+	}
+	if (d1 > tau)		/* a double relop, but no NaN's here */
+	{
+	    wd1 = ri / d1 ;
+	    omega [1] = MAX (omega [1], wd1) ;
+	}
+	else if (tau > 0.0)	/* a double relop, but no NaN's here */
+	{
+	    d2 = Z2 [i] + yix ;
+	    wd2 = ri / d2 ;
+	    omega [2] = MAX (omega [2], wd2) ;
+	}
+    }
+
+    omega [0] = omega [1] + omega [2] ;
+    Info [UMFPACK_OMEGA1] = omega [1] ;
+    Info [UMFPACK_OMEGA2] = omega [2] ;
+
+    /* ---------------------------------------------------------------------- */
+    /* stop the iterations if the backward error is small, or NaN */
+    /* ---------------------------------------------------------------------- */
+
+    Info [UMFPACK_IR_TAKEN] = step ;
+    Info [UMFPACK_IR_ATTEMPTED] = step ;
+
+    if (SCALAR_IS_NAN (omega [0]) || omega [0] < DBL_EPSILON)
+    {
+	DEBUG0 (("omega[0] is NaN or too small - done.\n")) ;
+	return (TRUE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* stop if insufficient decrease in omega */
+    /* ---------------------------------------------------------------------- */
+
+    /* double relop, but no NaN case here: */
+    if (step > 0 && omega [0] > last_omega [0] / 2)
+    {
+	DEBUG0 (("stop refinement\n")) ;
+	if (omega [0] > last_omega [0])
+	{
+	    /* last iteration better than this one, reinstate it */
+	    DEBUG0 (("last iteration better\n")) ;
+	    for (i = 0 ; i < n ; i++)
+	    {
+		X [i] = S [i] ;
+	    }
+	    Info [UMFPACK_OMEGA1] = last_omega [1] ;
+	    Info [UMFPACK_OMEGA2] = last_omega [2] ;
+	}
+	Info [UMFPACK_IR_TAKEN] = step - 1 ;
+	return (TRUE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* save current solution in case we need to reinstate */
+    /* ---------------------------------------------------------------------- */
+
+    for (i = 0 ; i < n ; i++)
+    {
+	S [i] = X [i] ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* iterative refinement continues */
+    /* ---------------------------------------------------------------------- */
+
+    return (FALSE) ;
+}
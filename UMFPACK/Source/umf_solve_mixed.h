@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_solve_mixed.h
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/* size of the SolveWork array for UMF_solve_mixed, in units of doubles */
+#ifdef COMPLEX
+#define UMF_SOLVE_MIXED_WSIZE(n) (10 * (n))
+#else
+#define UMF_SOLVE_MIXED_WSIZE(n) (6 * (n))
+#endif
+
+Int UMF_solve_mixed
+(
+    int sys,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+    double Xx [ ],
+    const double Bx [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+    double Xz [ ],
+    const double Bz [ ],
+#endif
+    NumericType *Numeric,
+    Int irstep,
+    double Info [UMFPACK_INFO],
+    Int Pattern [ ],
+    double SolveWork [ ]
+) ;
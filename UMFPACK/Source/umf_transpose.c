@@ -15,19 +15,29 @@
 	Uses Gustavson's method (Two Fast Algorithms for Sparse Matrices:
 	Multiplication and Permuted Transposition, ACM Trans. on Math. Softw.,
 	vol 4, no 3, pp. 250-269).
+
+	The columns of A (P,Q) are split into nthreads contiguous ranges.
+	Thread t counts and then places the entries of its range, using
+	W [t*n_row ... (t+1)*n_row-1] for the row pointers.  Since the ranges
+	are placed in order, R is the same for any number of threads.
 */
 
 #include "umf_internal.h"
 #include "umf_transpose.h"
 #include "umf_is_permutation.h"
 
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+/* the debug and test-coverage code is not thread-safe */
+#define PARALLEL_TRANSPOSE
+#endif
+
 Int UMF_transpose
 (
     Int n_row,			/* A is n_row-by-n_col */
     Int n_col,
     const Int Ap [ ],		/* size n_col+1 */
     const Int Ai [ ],		/* size nz = Ap [n_col] */
-    const double Ax [ ],	/* size nz if present */
+    const Scalar Ax [ ],	/* size nz if present */
 
     const Int P [ ],	/* P [k] = i means original row i is kth row in A(P,Q)*/
 			/* P is identity if not present */
@@ -41,14 +51,15 @@ Int UMF_transpose
 			/* output matrix: Rp, Ri, Rx, and Rz: */
     Int Rp [ ],		/* size n_row+1 */
     Int Ri [ ],		/* size nz */
-    double Rx [ ],	/* size nz, if present */
+    Scalar Rx [ ],	/* size nz, if present */
 
-    Int W [ ],		/* size max (n_row,n_col) workspace */
+    Int W [ ],		/* size max (n_row,n_col,nthreads*n_row) workspace */
+    Int nthreads,	/* number of threads to use */
 
     Int check		/* if true, then check inputs */
 #ifdef COMPLEX
-    , const double Az [ ]	/* size nz */
-    , double Rz [ ]		/* size nz */
+    , const Scalar Az [ ]	/* size nz */
+    , Scalar Rz [ ]		/* size nz */
     , Int do_conjugate		/* if true, then do conjugate transpose */
 				/* otherwise, do array transpose */
 #endif
@@ -59,7 +70,7 @@ Int UMF_transpose
     /* local variables */
     /* ---------------------------------------------------------------------- */
 
-    Int i, j, k, p, bp, newj, do_values ;
+    Int i, j, k, p, bp, newj, do_values, ncols, t ;
 #ifdef COMPLEX
     Int split ;
 #endif
@@ -111,37 +122,34 @@ Int UMF_transpose
     /* count the entries in each row of A */
     /* ---------------------------------------------------------------------- */
 
-    /* use W as workspace for RowCount */
+    /* use W [t*n_row ...] as workspace for the row counts of the columns
+       handled by thread t */
 
-    for (i = 0 ; i < n_row ; i++)
-    {
-	W [i] = 0 ;
-	Rp [i] = 0 ;
-    }
+    ncols = (Q != (Int *) NULL) ? nq : n_col ;
 
-    if (Q != (Int *) NULL)
+#ifdef PARALLEL_TRANSPOSE
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(i, j, p, newj)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	for (newj = 0 ; newj < nq ; newj++)
+	Int *Wt = W + t * n_row ;
+	Int j1 = (Int) (((double) ncols) * t / nthreads) ;
+	Int j2 = (Int) (((double) ncols) * (t+1) / nthreads) ;
+	if (t == nthreads-1) j2 = ncols ;
+	for (i = 0 ; i < n_row ; i++)
 	{
-	    j = Q [newj] ;
-	    ASSERT (j >= 0 && j < n_col) ;
-	    for (p = Ap [j] ; p < Ap [j+1] ; p++)
-	    {
-		i = Ai [p] ;
-		ASSERT (i >= 0 && i < n_row) ;
-		W [i]++ ;
-	    }
+	    Wt [i] = 0 ;
 	}
-    }
-    else
-    {
-	for (j = 0 ; j < n_col ; j++)
+	for (newj = j1 ; newj < j2 ; newj++)
 	{
+	    j = (Q != (Int *) NULL) ? Q [newj] : newj ;
+	    ASSERT (j >= 0 && j < n_col) ;
 	    for (p = Ap [j] ; p < Ap [j+1] ; p++)
 	    {
 		i = Ai [p] ;
 		ASSERT (i >= 0 && i < n_row) ;
-		W [i]++ ;
+		Wt [i]++ ;
 	    }
 	}
     }
@@ -150,37 +158,26 @@ Int UMF_transpose
     /* compute the row pointers for R = A (P,Q) */
     /* ---------------------------------------------------------------------- */
 
-    if (P != (Int *) NULL)
-    {
-	Rp [0] = 0 ;
-	for (k = 0 ; k < n_row ; k++)
-	{
-	    i = P [k] ;
-	    ASSERT (i >= 0 && i < n_row) ;
-	    Rp [k+1] = Rp [k] + W [i] ;
-	}
-	for (k = 0 ; k < n_row ; k++)
-	{
-	    i = P [k] ;
-	    ASSERT (i >= 0 && i < n_row) ;
-	    W [i] = Rp [k] ;
-	}
-    }
-    else
+    /* the entries of row k of R from the tth range of columns start at
+       Rp [k] + (the number of entries in row k in ranges 0 to t-1) */
+    Rp [0] = 0 ;
+    for (k = 0 ; k < n_row ; k++)
     {
-	Rp [0] = 0 ;
-	for (i = 0 ; i < n_row ; i++)
+	Int cnt = 0 ;
+	i = (P != (Int *) NULL) ? P [k] : k ;
+	ASSERT (i >= 0 && i < n_row) ;
+	for (t = 0 ; t < nthreads ; t++)
 	{
-	    Rp [i+1] = Rp [i] + W [i] ;
-	}
-	for (i = 0 ; i < n_row ; i++)
-	{
-	    W [i] = Rp [i] ;
+	    Int c = W [t*n_row + i] ;
+	    W [t*n_row + i] = Rp [k] + cnt ;
+	    cnt += c ;
 	}
+	Rp [k+1] = Rp [k] + cnt ;
     }
     ASSERT (Rp [n_row] <= Ap [n_col]) ;
 
-    /* at this point, W holds the permuted row pointers */
+    /* at this point, W [t*n_row ...] holds the permuted row pointers for the
+       tth range of columns */
 
     /* ---------------------------------------------------------------------- */
     /* construct the row form of B */
@@ -190,183 +187,197 @@ Int UMF_transpose
 
 #ifdef COMPLEX
     split = SPLIT (Az) && SPLIT (Rz) ;
+#endif
 
-    if (do_conjugate && do_values)
+#ifdef PARALLEL_TRANSPOSE
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(j, p, bp, newj)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	if (Q != (Int *) NULL)
+	Int *Wt = W + t * n_row ;
+	Int j1 = (Int) (((double) ncols) * t / nthreads) ;
+	Int j2 = (Int) (((double) ncols) * (t+1) / nthreads) ;
+	if (t == nthreads-1) j2 = ncols ;
+
+#ifdef COMPLEX
+	if (do_conjugate && do_values)
 	{
-	    if (split)
+	    if (Q != (Int *) NULL)
 	    {
-		/* R = A (P,Q)' */
-		for (newj = 0 ; newj < nq ; newj++)
+		if (split)
 		{
-		    j = Q [newj] ;
-		    ASSERT (j >= 0 && j < n_col) ;
-		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+		    /* R = A (P,Q)' */
+		    for (newj = j1 ; newj < j2 ; newj++)
 		    {
-			bp = W [Ai [p]]++ ;
-			Ri [bp] = newj ;
-			Rx [bp] = Ax [p] ;
-			Rz [bp] = -Az [p] ;
+			j = Q [newj] ;
+			ASSERT (j >= 0 && j < n_col) ;
+			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			{
+			    bp = Wt [Ai [p]]++ ;
+			    Ri [bp] = newj ;
+			    Rx [bp] = Ax [p] ;
+			    Rz [bp] = -Az [p] ;
+			}
 		    }
 		}
-	    }
-	    else
-	    {
-		/* R = A (P,Q)' (merged complex values) */
-		for (newj = 0 ; newj < nq ; newj++)
+		else
 		{
-		    j = Q [newj] ;
-		    ASSERT (j >= 0 && j < n_col) ;
-		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+		    /* R = A (P,Q)' (merged complex values) */
+		    for (newj = j1 ; newj < j2 ; newj++)
 		    {
-			bp = W [Ai [p]]++ ;
-			Ri [bp] = newj ;
-			Rx [2*bp] = Ax [2*p] ;
-			Rx [2*bp+1] = -Ax [2*p+1] ;
+			j = Q [newj] ;
+			ASSERT (j >= 0 && j < n_col) ;
+			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			{
+			    bp = Wt [Ai [p]]++ ;
+			    Ri [bp] = newj ;
+			    Rx [2*bp] = Ax [2*p] ;
+			    Rx [2*bp+1] = -Ax [2*p+1] ;
+			}
 		    }
 		}
 	    }
-	}
-	else
-	{
-	    if (split)
+	    else
 	    {
-		/* R = A (P,:)' */
-		for (j = 0 ; j < n_col ; j++)
+		if (split)
 		{
-		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+		    /* R = A (P,:)' */
+		    for (j = j1 ; j < j2 ; j++)
 		    {
-			bp = W [Ai [p]]++ ;
-			Ri [bp] = j ;
-			Rx [bp] = Ax [p] ;
-			Rz [bp] = -Az [p] ;
+			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			{
+			    bp = Wt [Ai [p]]++ ;
+			    Ri [bp] = j ;
+			    Rx [bp] = Ax [p] ;
+			    Rz [bp] = -Az [p] ;
+			}
 		    }
 		}
-	    }
-	    else
-	    {
-		/* R = A (P,:)' (merged complex values) */
-		for (j = 0 ; j < n_col ; j++)
+		else
 		{
-		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+		    /* R = A (P,:)' (merged complex values) */
+		    for (j = j1 ; j < j2 ; j++)
 		    {
-			bp = W [Ai [p]]++ ;
-			Ri [bp] = j ;
-			Rx [2*bp] = Ax [2*p] ;
-			Rx [2*bp+1] = -Ax [2*p+1] ;
+			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			{
+			    bp = Wt [Ai [p]]++ ;
+			    Ri [bp] = j ;
+			    Rx [2*bp] = Ax [2*p] ;
+			    Rx [2*bp+1] = -Ax [2*p+1] ;
+			}
 		    }
 		}
 	    }
 	}
-    }
-    else
+	else
 #endif
-    {
-	if (Q != (Int *) NULL)
 	{
-	    if (do_values)
+	    if (Q != (Int *) NULL)
 	    {
+		if (do_values)
+		{
 #ifdef COMPLEX
-		if (split)
+		    if (split)
 #endif
-		{
-		    /* R = A (P,Q).' */
-		    for (newj = 0 ; newj < nq ; newj++)
 		    {
-			j = Q [newj] ;
-			ASSERT (j >= 0 && j < n_col) ;
-			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			/* R = A (P,Q).' */
+			for (newj = j1 ; newj < j2 ; newj++)
 			{
-			    bp = W [Ai [p]]++ ;
-			    Ri [bp] = newj ;
-			    Rx [bp] = Ax [p] ;
+			    j = Q [newj] ;
+			    ASSERT (j >= 0 && j < n_col) ;
+			    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			    {
+				bp = Wt [Ai [p]]++ ;
+				Ri [bp] = newj ;
+				Rx [bp] = Ax [p] ;
 #ifdef COMPLEX
-			    Rz [bp] = Az [p] ;
+				Rz [bp] = Az [p] ;
 #endif
+			    }
 			}
 		    }
-		}
 #ifdef COMPLEX
+		    else
+		    {
+			/* R = A (P,Q).' (merged complex values) */
+			for (newj = j1 ; newj < j2 ; newj++)
+			{
+			    j = Q [newj] ;
+			    ASSERT (j >= 0 && j < n_col) ;
+			    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			    {
+				bp = Wt [Ai [p]]++ ;
+				Ri [bp] = newj ;
+				Rx [2*bp] = Ax [2*p] ;
+				Rx [2*bp+1] = Ax [2*p+1] ;
+			    }
+			}
+		    }
+#endif
+		}
 		else
 		{
-		    /* R = A (P,Q).' (merged complex values) */
-		    for (newj = 0 ; newj < nq ; newj++)
+		    /* R = pattern of A (P,Q).' */
+		    for (newj = j1 ; newj < j2 ; newj++)
 		    {
 			j = Q [newj] ;
 			ASSERT (j >= 0 && j < n_col) ;
 			for (p = Ap [j] ; p < Ap [j+1] ; p++)
 			{
-			    bp = W [Ai [p]]++ ;
-			    Ri [bp] = newj ;
-			    Rx [2*bp] = Ax [2*p] ;
-			    Rx [2*bp+1] = Ax [2*p+1] ;
+			    Ri [Wt [Ai [p]]++] = newj ;
 			}
 		    }
 		}
-#endif
 	    }
 	    else
 	    {
-		/* R = pattern of A (P,Q).' */
-		for (newj = 0 ; newj < nq ; newj++)
+		if (do_values)
 		{
-		    j = Q [newj] ;
-		    ASSERT (j >= 0 && j < n_col) ;
-		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
-		    {
-			Ri [W [Ai [p]]++] = newj ;
-		    }
-		}
-	    }
-	}
-	else
-	{
-	    if (do_values)
-	    {
 #ifdef COMPLEX
-		if (split)
+		    if (split)
 #endif
-		{
-		    /* R = A (P,:).' */
-		    for (j = 0 ; j < n_col ; j++)
 		    {
-			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			/* R = A (P,:).' */
+			for (j = j1 ; j < j2 ; j++)
 			{
-			    bp = W [Ai [p]]++ ;
-			    Ri [bp] = j ;
-			    Rx [bp] = Ax [p] ;
+			    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			    {
+				bp = Wt [Ai [p]]++ ;
+				Ri [bp] = j ;
+				Rx [bp] = Ax [p] ;
 #ifdef COMPLEX
-			    Rz [bp] = Az [p] ;
+				Rz [bp] = Az [p] ;
 #endif
+			    }
 			}
 		    }
-		}
 #ifdef COMPLEX
-		else
-		{
-		    /* R = A (P,:).' (merged complex values) */
-		    for (j = 0 ; j < n_col ; j++)
+		    else
 		    {
-			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			/* R = A (P,:).' (merged complex values) */
+			for (j = j1 ; j < j2 ; j++)
 			{
-			    bp = W [Ai [p]]++ ;
-			    Ri [bp] = j ;
-			    Rx [2*bp] = Ax [2*p] ;
-			    Rx [2*bp+1] = Ax [2*p+1] ;
+			    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			    {
+				bp = Wt [Ai [p]]++ ;
+				Ri [bp] = j ;
+				Rx [2*bp] = Ax [2*p] ;
+				Rx [2*bp+1] = Ax [2*p+1] ;
+			    }
 			}
 		    }
-		}
 #endif
-	    }
-	    else
-	    {
-		/* R = pattern of A (P,:).' */
-		for (j = 0 ; j < n_col ; j++)
+		}
+		else
 		{
-		    for (p = Ap [j] ; p < Ap [j+1] ; p++)
+		    /* R = pattern of A (P,:).' */
+		    for (j = j1 ; j < j2 ; j++)
 		    {
-			Ri [W [Ai [p]]++] = j ;
+			for (p = Ap [j] ; p < Ap [j+1] ; p++)
+			{
+			    Ri [Wt [Ai [p]]++] = j ;
+			}
 		    }
 		}
 	    }
@@ -384,8 +395,9 @@ Int UMF_transpose
 	{
 	    i = k ;
 	}
-	DEBUG3 ((ID":  W[i] "ID" Rp[k+1] "ID"\n", i, W [i], Rp [k+1])) ;
-	ASSERT (W [i] == Rp [k+1]) ;
+	DEBUG3 ((ID":  W[i] "ID" Rp[k+1] "ID"\n", i,
+	    W [(nthreads-1)*n_row + i], Rp [k+1])) ;
+	ASSERT (W [(nthreads-1)*n_row + i] == Rp [k+1]) ;
     }
     DEBUG2 (("UMF_transpose, output matrix:\n")) ;
     UMF_dump_col_matrix (Rx,
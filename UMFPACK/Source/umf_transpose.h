@@ -7,24 +7,28 @@
 
 //------------------------------------------------------------------------------
 
+/* minimum number of entries for each thread in UMF_transpose */
+#define UMF_TRANSPOSE_CHUNK (256*1024)
+
 Int UMF_transpose
 (
     Int n_row,
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
     const Int P [ ],
     const Int Q [ ],
     Int nq,
     Int Rp [ ],
     Int Ri [ ],
-    double Rx [ ],
+    Scalar Rx [ ],
     Int W [ ],
+    Int nthreads,
     Int check
 #ifdef COMPLEX
-    , const double Az [ ]
-    , double Rz [ ]
+    , const Scalar Az [ ]
+    , Scalar Rz [ ]
     , Int do_conjugate
 #endif
 ) ;
@@ -15,11 +15,22 @@
 
     Compiled into four different routines for each version (di, dl, zi, zl),
     for a total of 16 different routines.
+
+    The work is split among nthreads threads.  Thread t handles a contiguous
+    range of the triplets, and then a contiguous range of the rows, using its
+    own part of W (W [t*nn ... (t+1)*nn-1], where nn = max (n_row, n_col)) for
+    its counts.  The threads handle their ranges in order, so the result is
+    the same as with one thread, no matter how many threads are used.
 */
 
 #include "umf_internal.h"
 #include "umf_triplet.h"
 
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+/* the debug and test-coverage code is not thread-safe */
+#define PARALLEL_TRIPLET
+#endif
+
 #ifdef DO_MAP
 #ifdef DO_VALUES
 Int UMF_triplet_map_x
@@ -43,8 +54,9 @@ Int UMF_triplet_nomap_nox
     Int Ai [ ],			/* size nz */
     Int Rp [ ],			/* size n_row + 1 */
     Int Rj [ ],			/* size nz */
-    Int W [ ],			/* size max (n_row, n_col) */
-    Int RowCount [ ]		/* size n_row */
+    Int W [ ],			/* size nthreads * max (n_row, n_col) */
+    Int RowCount [ ],		/* size n_row */
+    Int nthreads		/* number of threads to use */
 #ifdef DO_VALUES
     , const double Tx [ ]	/* size nz */
     , double Ax [ ]		/* size nz */
@@ -66,7 +78,7 @@ Int UMF_triplet_nomap_nox
     /* local variables */
     /* ---------------------------------------------------------------------- */
 
-    Int i, j, k, p, cp, p1, p2, pdest, pj ;
+    Int i, j, k, p, t, nn, invalid ;
 #ifdef DO_MAP
     Int duplicates ;
 #endif
@@ -80,82 +92,124 @@ Int UMF_triplet_nomap_nox
     /* count the entries in each row (also counting duplicates) */
     /* ---------------------------------------------------------------------- */
 
-    /* use W as workspace for row counts (including duplicates) */
-    for (i = 0 ; i < n_row ; i++)
-    {
-	W [i] = 0 ;
-    }
+    nn = MAX (n_row, n_col) ;
+    invalid = FALSE ;
 
-    for (k = 0 ; k < nz ; k++)
+    /* use W [t*nn ...] as workspace for the row counts of the triplets in the
+       kth range, k = t*nz/nthreads to (t+1)*nz/nthreads-1 (including
+       duplicates) */
+#ifdef PARALLEL_TRIPLET
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(i, j, k) reduction(||:invalid)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	i = Ti [k] ;
-	j = Tj [k] ;
-	if (i < 0 || i >= n_row || j < 0 || j >= n_col)
+	Int *Wt = W + t * nn ;
+	Int k1 = (Int) (((double) nz) * t / nthreads) ;
+	Int k2 = (Int) (((double) nz) * (t+1) / nthreads) ;
+	if (t == nthreads-1) k2 = nz ;
+	for (i = 0 ; i < n_row ; i++)
 	{
-	    return (UMFPACK_ERROR_invalid_matrix) ;
+	    Wt [i] = 0 ;
 	}
-	W [i]++ ;
+	for (k = k1 ; k < k2 ; k++)
+	{
+	    i = Ti [k] ;
+	    j = Tj [k] ;
+	    if (i < 0 || i >= n_row || j < 0 || j >= n_col)
+	    {
+		invalid = TRUE ;
+		break ;
+	    }
+	    Wt [i]++ ;
 #ifndef NDEBUG
-	DEBUG1 ((ID " triplet: "ID" "ID" ", k, i, j)) ;
+	    DEBUG1 ((ID " triplet: "ID" "ID" ", k, i, j)) ;
 #ifdef DO_VALUES
-	{
-	    Entry tt ;
-	    ASSIGN (tt, Tx, Tz, k, split) ;
-	    EDEBUG2 (tt) ;
-	    DEBUG1 (("\n")) ;
-	}
+	    {
+		Entry tt ;
+		ASSIGN (tt, Tx, Tz, k, split) ;
+		EDEBUG2 (tt) ;
+		DEBUG1 (("\n")) ;
+	    }
 #endif
 #endif
+	}
+    }
+
+    if (invalid)
+    {
+	return (UMFPACK_ERROR_invalid_matrix) ;
     }
 
     /* ---------------------------------------------------------------------- */
     /* compute the row pointers */
     /* ---------------------------------------------------------------------- */
 
+    /* the entries of row i in the tth range of triplets start at
+       Rp [i] + (the number of entries in row i in ranges 0 to t-1) */
     Rp [0] = 0 ;
     for (i = 0 ; i < n_row ; i++)
     {
-	Rp [i+1] = Rp [i] + W [i] ;
-	W [i] = Rp [i] ;
+	Int cnt = 0 ;
+	for (t = 0 ; t < nthreads ; t++)
+	{
+	    Int c = W [t*nn + i] ;
+	    W [t*nn + i] = Rp [i] + cnt ;
+	    cnt += c ;
+	}
+	Rp [i+1] = Rp [i] + cnt ;
     }
 
-    /* W is now equal to the row pointers */
+    /* W [t*nn + i] is now the position of the first entry of row i in the
+       tth range */
 
     /* ---------------------------------------------------------------------- */
     /* construct the row form */
     /* ---------------------------------------------------------------------- */
 
-    for (k = 0 ; k < nz ; k++)
+#ifdef PARALLEL_TRIPLET
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(k, p)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	p = W [Ti [k]]++ ;
+	Int *Wt = W + t * nn ;
+	Int k1 = (Int) (((double) nz) * t / nthreads) ;
+	Int k2 = (Int) (((double) nz) * (t+1) / nthreads) ;
+	if (t == nthreads-1) k2 = nz ;
+	for (k = k1 ; k < k2 ; k++)
+	{
+	    p = Wt [Ti [k]]++ ;
 #ifdef DO_MAP
-	Map [k] = p ;
+	    Map [k] = p ;
 #endif
-	Rj [p] = Tj [k] ;
+	    Rj [p] = Tj [k] ;
 #ifdef DO_VALUES
 #ifdef COMPLEX
-	if (split)
-	{
-	    Rx [p] = Tx [k] ;
-	    Rz [p] = Tz [k] ;
-	}
-	else
-	{
-	    Rx [2*p  ] = Tx [2*k  ] ;
-	    Rx [2*p+1] = Tx [2*k+1] ;
-	}
+	    if (split)
+	    {
+		Rx [p] = Tx [k] ;
+		Rz [p] = Tz [k] ;
+	    }
+	    else
+	    {
+		Rx [2*p  ] = Tx [2*k  ] ;
+		Rx [2*p+1] = Tx [2*k+1] ;
+	    }
 #else
-	Rx [p] = Tx [k] ;
+	    Rx [p] = Tx [k] ;
 #endif
 #endif
+	}
     }
 
-    /* Rp stays the same, but W [i] is advanced to the start of row i+1 */
+    /* Rp stays the same, but W [(nthreads-1)*nn + i] is advanced to the start
+       of row i+1 */
 
 #ifndef NDEBUG
     for (i = 0 ; i < n_row ; i++)
     {
-	ASSERT (W [i] == Rp [i+1]) ;
+	ASSERT (W [(nthreads-1)*nn + i] == Rp [i+1]) ;
     }
 #ifdef DO_MAP
     for (k = 0 ; k < nz ; k++)
@@ -175,98 +229,118 @@ Int UMF_triplet_nomap_nox
     /* sum up duplicates */
     /* ---------------------------------------------------------------------- */
 
-    /* use W [j] to hold position in Ri/Rx/Rz of a_ij, for row i [ */
-
-    for (j = 0 ; j < n_col ; j++)
-    {
-	W [j] = EMPTY ;
-    }
+    /* thread t handles the rows i = t*n_row/nthreads to
+       (t+1)*n_row/nthreads-1, and uses Wt [j] to hold position in Ri/Rx/Rz
+       of a_ij, for row i [ */
 
 #ifdef DO_MAP
     duplicates = FALSE ;
 #endif
 
-    for (i = 0 ; i < n_row ; i++)
+#ifdef PARALLEL_TRIPLET
+#ifdef DO_MAP
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(i, j, p) reduction(||:duplicates)
+#else
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(i, j, p)
+#endif
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	p1 = Rp [i] ;
-	p2 = Rp [i+1] ;
-	pdest = p1 ;
-	/* At this point, W [j] < p1 holds true for all columns j, */
-	/* because Ri/Rx/Rz is stored in row oriented order. */
-#ifndef NDEBUG
-	if (UMF_debug >= -2)
+	Int *Wt = W + t * nn ;
+	Int i1 = (Int) (((double) n_row) * t / nthreads) ;
+	Int i2 = (Int) (((double) n_row) * (t+1) / nthreads) ;
+	if (t == nthreads-1) i2 = n_row ;
+
+	for (j = 0 ; j < n_col ; j++)
 	{
-	    for (j = 0 ; j < n_col ; j++)
-	    {
-		ASSERT (W [j] < p1) ;
-	    }
+	    Wt [j] = EMPTY ;
 	}
-#endif
-	for (p = p1 ; p < p2 ; p++)
+
+	for (i = i1 ; i < i2 ; i++)
 	{
-	    j = Rj [p] ;
-	    ASSERT (j >= 0 && j < n_col) ;
-	    pj = W [j] ;
-	    if (pj >= p1)
+	    Int p1 = Rp [i] ;
+	    Int p2 = Rp [i+1] ;
+	    Int pdest = p1 ;
+	    /* At this point, Wt [j] < p1 holds true for all columns j, */
+	    /* because Ri/Rx/Rz is stored in row oriented order. */
+#ifndef NDEBUG
+	    if (UMF_debug >= -2)
 	    {
-		/* this column index, j, is already in row i, at position pj */
-		ASSERT (pj < p) ;
-		ASSERT (Rj [pj] == j) ;
-#ifdef DO_MAP
-		Map2 [p] = pj ;
-		duplicates = TRUE ;
-#endif
-#ifdef DO_VALUES
-		/* sum the entry */
-#ifdef COMPLEX
-		if (split)
+		for (j = 0 ; j < n_col ; j++)
 		{
-		    Rx [pj] += Rx [p] ;
-		    Rz [pj] += Rz [p] ;
+		    ASSERT (Wt [j] < p1) ;
 		}
-		else
-		{
-		    Rx[2*pj  ] += Rx[2*p  ] ;
-		    Rx[2*pj+1] += Rx[2*p+1] ;
-		}
-#else
-		Rx [pj] += Rx [p] ;
-#endif
-#endif
 	    }
-	    else
+#endif
+	    for (p = p1 ; p < p2 ; p++)
 	    {
-		/* keep the entry */
-		/* also keep track in W[j] of position of a_ij for case above */
-		W [j] = pdest ;
+		Int pj ;
+		j = Rj [p] ;
+		ASSERT (j >= 0 && j < n_col) ;
+		pj = Wt [j] ;
+		if (pj >= p1)
+		{
+		    /* this column index, j, is already in row i, at position pj */
+		    ASSERT (pj < p) ;
+		    ASSERT (Rj [pj] == j) ;
 #ifdef DO_MAP
-		Map2 [p] = pdest ;
+		    Map2 [p] = pj ;
+		    duplicates = TRUE ;
 #endif
-		/* no need to move the entry if pdest is equal to p */
-		if (pdest != p)
-		{
-		    Rj [pdest] = j ;
 #ifdef DO_VALUES
+		    /* sum the entry */
 #ifdef COMPLEX
 		    if (split)
 		    {
-			Rx [pdest] = Rx [p] ;
-			Rz [pdest] = Rz [p] ;
+			Rx [pj] += Rx [p] ;
+			Rz [pj] += Rz [p] ;
 		    }
 		    else
 		    {
-			Rx [2*pdest  ] = Rx [2*p  ] ;
-			Rx [2*pdest+1] = Rx [2*p+1] ;
+			Rx[2*pj  ] += Rx[2*p  ] ;
+			Rx[2*pj+1] += Rx[2*p+1] ;
 		    }
 #else
-		    Rx [pdest] = Rx [p] ;
+		    Rx [pj] += Rx [p] ;
+#endif
+#endif
+		}
+		else
+		{
+		    /* keep the entry */
+		    /* also keep track in Wt[j] of position of a_ij for case above */
+		    Wt [j] = pdest ;
+#ifdef DO_MAP
+		    Map2 [p] = pdest ;
+#endif
+		    /* no need to move the entry if pdest is equal to p */
+		    if (pdest != p)
+		    {
+			Rj [pdest] = j ;
+#ifdef DO_VALUES
+#ifdef COMPLEX
+			if (split)
+			{
+			    Rx [pdest] = Rx [p] ;
+			    Rz [pdest] = Rz [p] ;
+			}
+			else
+			{
+			    Rx [2*pdest  ] = Rx [2*p  ] ;
+			    Rx [2*pdest+1] = Rx [2*p+1] ;
+			}
+#else
+			Rx [pdest] = Rx [p] ;
 #endif
 #endif
+		    }
+		    pdest++ ;
 		}
-		pdest++ ;
 	    }
+	    RowCount [i] = pdest - p1 ;
 	}
-	RowCount [i] = pdest - p1 ;
     }
 
     /* done using W for position of a_ij ] */
@@ -278,6 +352,9 @@ Int UMF_triplet_nomap_nox
 #ifdef DO_MAP
     if (duplicates)
     {
+#ifdef PARALLEL_TRIPLET
+	#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 	for (k = 0 ; k < nz ; k++)
 	{
 	    Map [k] = Map2 [Map [k]] ;
@@ -311,19 +388,30 @@ Int UMF_triplet_nomap_nox
     /* count the entries in each column */
     /* ---------------------------------------------------------------------- */
 
-    /* [ use W as work space for column counts of A */
-    for (j = 0 ; j < n_col ; j++)
-    {
-	W [j] = 0 ;
-    }
-
-    for (i = 0 ; i < n_row ; i++)
+    /* [ use W [t*nn ...] as work space for the column counts of the rows
+       handled by thread t */
+#ifdef PARALLEL_TRIPLET
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(i, j, p)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	for (p = Rp [i] ; p < Rp [i] + RowCount [i] ; p++)
+	Int *Wt = W + t * nn ;
+	Int i1 = (Int) (((double) n_row) * t / nthreads) ;
+	Int i2 = (Int) (((double) n_row) * (t+1) / nthreads) ;
+	if (t == nthreads-1) i2 = n_row ;
+	for (j = 0 ; j < n_col ; j++)
+	{
+	    Wt [j] = 0 ;
+	}
+	for (i = i1 ; i < i2 ; i++)
 	{
-	    j = Rj [p] ;
-	    ASSERT (j >= 0 && j < n_col) ;
-	    W [j]++ ;
+	    for (p = Rp [i] ; p < Rp [i] + RowCount [i] ; p++)
+	    {
+		j = Rj [p] ;
+		ASSERT (j >= 0 && j < n_col) ;
+		Wt [j]++ ;
+	    }
 	}
     }
 
@@ -334,44 +422,60 @@ Int UMF_triplet_nomap_nox
     Ap [0] = 0 ;
     for (j = 0 ; j < n_col ; j++)
     {
-	Ap [j+1] = Ap [j] + W [j] ;
+	Int cnt = 0 ;
+	for (t = 0 ; t < nthreads ; t++)
+	{
+	    Int c = W [t*nn + j] ;
+	    W [t*nn + j] = Ap [j] + cnt ;
+	    cnt += c ;
+	}
+	Ap [j+1] = Ap [j] + cnt ;
     }
     /* done using W as workspace for column counts of A ] */
 
-    for (j = 0 ; j < n_col ; j++)
-    {
-	W [j] = Ap [j] ;
-    }
+    /* W [t*nn + j] is now the position of the first entry in column j from
+       the rows handled by thread t */
 
     /* ---------------------------------------------------------------------- */
     /* construct the column form */
     /* ---------------------------------------------------------------------- */
 
-    for (i = 0 ; i < n_row ; i++)
+#ifdef PARALLEL_TRIPLET
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+	private(i, p)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
     {
-	for (p = Rp [i] ; p < Rp [i] + RowCount [i] ; p++)
+	Int *Wt = W + t * nn ;
+	Int i1 = (Int) (((double) n_row) * t / nthreads) ;
+	Int i2 = (Int) (((double) n_row) * (t+1) / nthreads) ;
+	if (t == nthreads-1) i2 = n_row ;
+	for (i = i1 ; i < i2 ; i++)
 	{
-	    cp = W [Rj [p]]++ ;
+	    for (p = Rp [i] ; p < Rp [i] + RowCount [i] ; p++)
+	    {
+		Int cp = Wt [Rj [p]]++ ;
 #ifdef DO_MAP
-	    Map2 [p] = cp ;
+		Map2 [p] = cp ;
 #endif
-	    Ai [cp] = i ;
+		Ai [cp] = i ;
 #ifdef DO_VALUES
 #ifdef COMPLEX
-	    if (split)
-	    {
-		Ax [cp] = Rx [p] ;
-		Az [cp] = Rz [p] ;
-	    }
-	    else
-	    {
-		Ax [2*cp  ] = Rx [2*p  ] ;
-		Ax [2*cp+1] = Rx [2*p+1] ;
-	    }
+		if (split)
+		{
+		    Ax [cp] = Rx [p] ;
+		    Az [cp] = Rz [p] ;
+		}
+		else
+		{
+		    Ax [2*cp  ] = Rx [2*p  ] ;
+		    Ax [2*cp+1] = Rx [2*p+1] ;
+		}
 #else
-	    Ax [cp] = Rx [p] ;
+		Ax [cp] = Rx [p] ;
 #endif
 #endif
+	    }
 	}
     }
 
@@ -380,6 +484,9 @@ Int UMF_triplet_nomap_nox
     /* ---------------------------------------------------------------------- */
 
 #ifdef DO_MAP
+#ifdef PARALLEL_TRIPLET
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
     for (k = 0 ; k < nz ; k++)
     {
 	Map [k] = Map2 [Map [k]] ;
@@ -391,7 +498,7 @@ Int UMF_triplet_nomap_nox
 #ifndef NDEBUG
     for (j = 0 ; j < n_col ; j++)
     {
-	ASSERT (W [j] == Ap [j+1]) ;
+	ASSERT (W [(nthreads-1)*nn + j] == Ap [j+1]) ;
     }
 
     UMF_dump_col_matrix (
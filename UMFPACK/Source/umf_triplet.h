@@ -7,6 +7,9 @@
 
 //------------------------------------------------------------------------------
 
+/* minimum number of triplets for each thread in UMF_triplet_* */
+#define UMF_TRIPLET_CHUNK (256*1024)
+
 Int UMF_triplet_map_x
 (
     Int n_row,
@@ -19,7 +22,8 @@ Int UMF_triplet_map_x
     Int Rp [ ],
     Int Rj [ ],
     Int W [ ],
-    Int RowCount [ ]
+    Int RowCount [ ],
+    Int nthreads
     , const double Tx [ ]
     , double Ax [ ]
     , double Rx [ ]
@@ -44,7 +48,8 @@ Int UMF_triplet_map_nox
     Int Rp [ ],
     Int Rj [ ],
     Int W [ ],
-    Int RowCount [ ]
+    Int RowCount [ ],
+    Int nthreads
     , Int Map [ ]
     , Int Map2 [ ]
 ) ;
@@ -61,7 +66,8 @@ Int UMF_triplet_nomap_x
     Int Rp [ ],
     Int Rj [ ],
     Int W [ ],
-    Int RowCount [ ]
+    Int RowCount [ ],
+    Int nthreads
     , const double Tx [ ]
     , double Ax [ ]
     , double Rx [ ]
@@ -84,5 +90,6 @@ Int UMF_triplet_nomap_nox
     Int Rp [ ],
     Int Rj [ ],
     Int W [ ],
-    Int RowCount [ ]
+    Int RowCount [ ],
+    Int nthreads
 ) ;
@@ -14,26 +14,51 @@
    DLONG:	double precision, int64_t integers
    ZLONG:	complex double precision, int64_t integers
    ZINT:	complex double precision, int32_t integers
+   SINT:	single precision, int32_t integers
+   SLONG:	single precision, int64_t integers
+   CINT:	complex single precision, int32_t integers
+   CLONG:	complex single precision, int64_t integers
 */
 
 /* Set DINT as the default, if nothing is defined */
-#if !defined (DLONG) && !defined (DINT) && !defined (ZLONG) && !defined (ZINT)
+#if !defined (DLONG) && !defined (DINT) && !defined (ZLONG) && !defined (ZINT) \
+ && !defined (SLONG) && !defined (SINT) && !defined (CLONG) && !defined (CINT)
 #define DINT
 #endif
 
 /* Determine if this is a real or complex version */
-#if defined (ZLONG) || defined (ZINT)
+#if defined (ZLONG) || defined (ZINT) || defined (CLONG) || defined (CINT)
 #define COMPLEX
 #endif
 
+/* Determine if this is a single or double precision version */
+#if defined (SLONG) || defined (SINT) || defined (CLONG) || defined (CINT)
+#define SINGLE
+#endif
+
 /* -------------------------------------------------------------------------- */
 /* integer type (Int is int32_t or int64_t) defined in umf_internal.h */
 /* -------------------------------------------------------------------------- */
 
-#if defined (DLONG) || defined (ZLONG)
+#if defined (DLONG) || defined (ZLONG) || defined (SLONG) || defined (CLONG)
 #define LONG_INTEGER
 #endif
 
+/* -------------------------------------------------------------------------- */
+/* type of the numerical values passed to and from the user */
+/* -------------------------------------------------------------------------- */
+
+/* The numerical values of A, X, and B are float for the single precision
+ * versions, and double otherwise.  Scalar quantities such as the pivot
+ * tolerances, scale factors, flop counts, and the Control and Info arrays are
+ * always double. */
+
+#ifdef SINGLE
+#define Scalar float
+#else
+#define Scalar double
+#endif
+
 /* -------------------------------------------------------------------------- */
 /* Numerical relop macros for correctly handling the NaN case */
 /* -------------------------------------------------------------------------- */
@@ -108,7 +133,7 @@ SCALAR_IS_LTZERO(x):
 
 #ifndef COMPLEX
 
-#define Entry double
+#define Entry Scalar
 
 #define SPLIT(s)    		    (1)
 #define REAL_COMPONENT(c)	    (c)
@@ -179,7 +204,17 @@ typedef struct
 
 } DoubleComplex ;
 
+typedef struct
+{
+    float component [2] ;	/* real and imaginary parts */
+
+} FloatComplex ;
+
+#ifdef SINGLE
+#define Entry FloatComplex
+#else
 #define Entry DoubleComplex
+#endif
 #define Real component [0]
 #define Imag component [1]
 
@@ -205,7 +240,7 @@ typedef struct
 /* -------------------------------------------------------------------------- */
 
 /* Return TRUE if a complex number is in split form, FALSE if in packed form */
-#define SPLIT(sz) ((sz) != (double *) NULL)
+#define SPLIT(sz) ((sz) != (Scalar *) NULL)
 
 /* -------------------------------------------------------------------------- */
 
@@ -350,22 +385,44 @@ typedef struct
 /* -------------------------------------------------------------------------- */
 
 /* c = a/b, using function pointer */
+#ifdef SINGLE
+#define DIV(c,a,b) \
+{ \
+    double c_real, c_imag ; \
+    (void) SuiteSparse_config_divcomplex \
+        ((a).Real, (a).Imag, (b).Real, (b).Imag, &c_real, &c_imag) ; \
+    (c).Real = c_real ; \
+    (c).Imag = c_imag ; \
+}
+#else
 #define DIV(c,a,b) \
 { \
     (void) SuiteSparse_config_divcomplex \
         ((a).Real, (a).Imag, (b).Real, (b).Imag, \
 	&((c).Real), &((c).Imag)) ; \
 }
+#endif
 
 /* -------------------------------------------------------------------------- */
 
 /* c = a/conjugate(b), using function pointer */
+#ifdef SINGLE
+#define DIV_CONJ(c,a,b) \
+{ \
+    double c_real, c_imag ; \
+    (void) SuiteSparse_config_divcomplex \
+        ((a).Real, (a).Imag, (b).Real, (-(b).Imag), &c_real, &c_imag) ; \
+    (c).Real = c_real ; \
+    (c).Imag = c_imag ; \
+}
+#else
 #define DIV_CONJ(c,a,b) \
 { \
     (void) SuiteSparse_config_divcomplex \
         ((a).Real, (a).Imag, (b).Real, (-(b).Imag), \
 	&((c).Real), &((c).Imag)) ; \
 }
+#endif
 
 /* -------------------------------------------------------------------------- */
 
@@ -452,6 +509,14 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfdi_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfdi_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfdi_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfdi_parallel_numeric
+#define UMF_msolve		 umfdi_msolve
+#define UMF_numeric_blobsize	 umfdi_numeric_blobsize
+#define UMF_numeric_blob_header umfdi_numeric_blob_header
+#define UMF_numeric_blob_check	 umfdi_numeric_blob_check
+#define UMF_numeric_map		 umfdi_numeric_map
+#define UMF_numeric_unmap	 umfdi_numeric_unmap
+#define UMF_numeric_usage	 umf_i_numeric_usage
 #define UMF_realloc		 umf_i_realloc
 #define UMF_report_perm		 umf_i_report_perm
 #define UMF_report_vector	 umfdi_report_vector
@@ -487,6 +552,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_di_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_di_get_determinant
 #define UMFPACK_numeric		 umfpack_di_numeric
+#define UMFPACK_refactor	 umfpack_di_refactor
 #define UMFPACK_qsymbolic	 umfpack_di_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_di_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_di_paru_symbolic
@@ -503,9 +569,12 @@ typedef struct
 #define UMFPACK_save_numeric	 umfpack_di_save_numeric
 #define UMFPACK_save_symbolic	 umfpack_di_save_symbolic
 #define UMFPACK_load_numeric	 umfpack_di_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_di_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_di_deserialize_numeric_view
 #define UMFPACK_load_symbolic	 umfpack_di_load_symbolic
 #define UMFPACK_scale		 umfpack_di_scale
 #define UMFPACK_solve		 umfpack_di_solve
+#define UMFPACK_msolve		 umfpack_di_msolve
 #define UMFPACK_symbolic	 umfpack_di_symbolic
 #define UMFPACK_transpose	 umfpack_di_transpose
 #define UMFPACK_triplet_to_col	 umfpack_di_triplet_to_col
@@ -518,6 +587,10 @@ typedef struct
 #define UMFPACK_serialize_numeric       umfpack_di_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_di_deserialize_numeric
 #define UMFPACK_serialize_numeric_size  umfpack_di_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_di_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_di_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_di_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_di_serialize_numeric_compressed_size
 #define UMFPACK_copy_symbolic	        umfpack_di_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_di_copy_numeric
 
@@ -580,6 +653,14 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfdl_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfdl_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfdl_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfdl_parallel_numeric
+#define UMF_msolve		 umfdl_msolve
+#define UMF_numeric_blobsize	 umfdl_numeric_blobsize
+#define UMF_numeric_blob_header umfdl_numeric_blob_header
+#define UMF_numeric_blob_check	 umfdl_numeric_blob_check
+#define UMF_numeric_map		 umfdl_numeric_map
+#define UMF_numeric_unmap	 umfdl_numeric_unmap
+#define UMF_numeric_usage	 umf_l_numeric_usage
 #define UMF_realloc		 umf_l_realloc
 #define UMF_report_perm		 umf_l_report_perm
 #define UMF_report_vector	 umfdl_report_vector
@@ -615,6 +696,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_dl_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_dl_get_determinant
 #define UMFPACK_numeric		 umfpack_dl_numeric
+#define UMFPACK_refactor	 umfpack_dl_refactor
 #define UMFPACK_qsymbolic	 umfpack_dl_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_dl_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_dl_paru_symbolic
@@ -631,9 +713,12 @@ typedef struct
 #define UMFPACK_save_numeric	 umfpack_dl_save_numeric
 #define UMFPACK_save_symbolic	 umfpack_dl_save_symbolic
 #define UMFPACK_load_numeric	 umfpack_dl_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_dl_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_dl_deserialize_numeric_view
 #define UMFPACK_load_symbolic	 umfpack_dl_load_symbolic
 #define UMFPACK_scale		 umfpack_dl_scale
 #define UMFPACK_solve		 umfpack_dl_solve
+#define UMFPACK_msolve		 umfpack_dl_msolve
 #define UMFPACK_symbolic	 umfpack_dl_symbolic
 #define UMFPACK_transpose	 umfpack_dl_transpose
 #define UMFPACK_triplet_to_col	 umfpack_dl_triplet_to_col
@@ -646,6 +731,10 @@ typedef struct
 #define UMFPACK_serialize_numeric       umfpack_dl_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_dl_deserialize_numeric
 #define UMFPACK_serialize_numeric_size  umfpack_dl_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_dl_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_dl_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_dl_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_dl_serialize_numeric_compressed_size
 #define UMFPACK_copy_symbolic	        umfpack_dl_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_dl_copy_numeric
 
@@ -708,6 +797,14 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfzi_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfzi_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfzi_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfzi_parallel_numeric
+#define UMF_msolve		 umfzi_msolve
+#define UMF_numeric_blobsize	 umfzi_numeric_blobsize
+#define UMF_numeric_blob_header umfzi_numeric_blob_header
+#define UMF_numeric_blob_check	 umfzi_numeric_blob_check
+#define UMF_numeric_map		 umfzi_numeric_map
+#define UMF_numeric_unmap	 umfzi_numeric_unmap
+#define UMF_numeric_usage	 umfzi_numeric_usage
 #define UMF_realloc		 umf_i_realloc
 #define UMF_report_perm		 umf_i_report_perm
 #define UMF_report_vector	 umfzi_report_vector
@@ -743,6 +840,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_zi_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_zi_get_determinant
 #define UMFPACK_numeric		 umfpack_zi_numeric
+#define UMFPACK_refactor	 umfpack_zi_refactor
 #define UMFPACK_qsymbolic	 umfpack_zi_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_zi_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_zi_paru_symbolic
@@ -759,9 +857,12 @@ typedef struct
 #define UMFPACK_save_numeric	 umfpack_zi_save_numeric
 #define UMFPACK_save_symbolic	 umfpack_zi_save_symbolic
 #define UMFPACK_load_numeric	 umfpack_zi_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_zi_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_zi_deserialize_numeric_view
 #define UMFPACK_load_symbolic	 umfpack_zi_load_symbolic
 #define UMFPACK_scale		 umfpack_zi_scale
 #define UMFPACK_solve		 umfpack_zi_solve
+#define UMFPACK_msolve		 umfpack_zi_msolve
 #define UMFPACK_symbolic	 umfpack_zi_symbolic
 #define UMFPACK_transpose	 umfpack_zi_transpose
 #define UMFPACK_triplet_to_col	 umfpack_zi_triplet_to_col
@@ -774,6 +875,10 @@ typedef struct
 #define UMFPACK_serialize_numeric       umfpack_zi_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_zi_deserialize_numeric
 #define UMFPACK_serialize_numeric_size  umfpack_zi_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_zi_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_zi_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_zi_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_zi_serialize_numeric_compressed_size
 #define UMFPACK_copy_symbolic	        umfpack_zi_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_zi_copy_numeric
 
@@ -836,6 +941,14 @@ typedef struct
 #define UMF_mem_alloc_tail_block umfzl_mem_alloc_tail_block
 #define UMF_mem_free_tail_block	 umfzl_mem_free_tail_block
 #define UMF_mem_init_memoryspace umfzl_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfzl_parallel_numeric
+#define UMF_msolve		 umfzl_msolve
+#define UMF_numeric_blobsize	 umfzl_numeric_blobsize
+#define UMF_numeric_blob_header umfzl_numeric_blob_header
+#define UMF_numeric_blob_check	 umfzl_numeric_blob_check
+#define UMF_numeric_map		 umfzl_numeric_map
+#define UMF_numeric_unmap	 umfzl_numeric_unmap
+#define UMF_numeric_usage	 umfzl_numeric_usage
 #define UMF_realloc		 umf_l_realloc
 #define UMF_report_perm		 umf_l_report_perm
 #define UMF_report_vector	 umfzl_report_vector
@@ -871,6 +984,7 @@ typedef struct
 #define UMFPACK_get_symbolic	 umfpack_zl_get_symbolic
 #define UMFPACK_get_determinant	 umfpack_zl_get_determinant
 #define UMFPACK_numeric		 umfpack_zl_numeric
+#define UMFPACK_refactor	 umfpack_zl_refactor
 #define UMFPACK_qsymbolic	 umfpack_zl_qsymbolic
 #define UMFPACK_fsymbolic	 umfpack_zl_fsymbolic
 #define UMFPACK_paru_symbolic	 umfpack_zl_paru_symbolic
@@ -887,9 +1001,12 @@ typedef struct
 #define UMFPACK_save_numeric	 umfpack_zl_save_numeric
 #define UMFPACK_save_symbolic	 umfpack_zl_save_symbolic
 #define UMFPACK_load_numeric	 umfpack_zl_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_zl_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_zl_deserialize_numeric_view
 #define UMFPACK_load_symbolic	 umfpack_zl_load_symbolic
 #define UMFPACK_scale		 umfpack_zl_scale
 #define UMFPACK_solve		 umfpack_zl_solve
+#define UMFPACK_msolve		 umfpack_zl_msolve
 #define UMFPACK_symbolic	 umfpack_zl_symbolic
 #define UMFPACK_transpose	 umfpack_zl_transpose
 #define UMFPACK_triplet_to_col	 umfpack_zl_triplet_to_col
@@ -902,6 +1019,10 @@ typedef struct
 #define UMFPACK_serialize_numeric       umfpack_zl_serialize_numeric
 #define UMFPACK_deserialize_numeric     umfpack_zl_deserialize_numeric
 #define UMFPACK_serialize_numeric_size  umfpack_zl_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_zl_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_zl_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_zl_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_zl_serialize_numeric_compressed_size
 #define UMFPACK_copy_symbolic	        umfpack_zl_copy_symbolic
 #define UMFPACK_copy_numeric	        umfpack_zl_copy_numeric
 
@@ -925,3 +1046,579 @@ typedef struct
 #define UMF_dump_diagonal_map	 umfzl_dump_diagonal_map
 
 #endif
+
+/* -------------------------------------------------------------------------- */
+/* Single precision, with int32_t integers */
+/* -------------------------------------------------------------------------- */
+
+#ifdef SINT
+
+#define UMF_analyze		 umf_i_analyze
+#define UMF_apply_order		 umf_i_apply_order
+#define UMF_assemble		 umfsi_assemble
+#define UMF_assemble_fixq	 umfsi_assemble_fixq
+#define UMF_blas3_update	 umfsi_blas3_update
+#define UMF_build_tuples	 umfsi_build_tuples
+#define UMF_build_tuples_usage	 umfsi_build_tuples_usage
+#define UMF_colamd		 umf_i_colamd
+#define UMF_colamd_set_defaults	 umf_i_colamd_set_defaults
+#define UMF_create_element	 umfsi_create_element
+#define UMF_extend_front	 umfsi_extend_front
+#define UMF_free		 umf_i_free
+#define UMF_fsize		 umf_i_fsize
+#define UMF_garbage_collection	 umfsi_garbage_collection
+#define UMF_get_memory		 umfsi_get_memory
+#define UMF_grow_front		 umfsi_grow_front
+#define UMF_init_front		 umfsi_init_front
+#define UMF_is_permutation	 umf_i_is_permutation
+#define UMF_kernel		 umfsi_kernel
+#define UMF_kernel_init		 umfsi_kernel_init
+#define UMF_kernel_init_usage	 umfsi_kernel_init_usage
+#define UMF_kernel_wrapup	 umfsi_kernel_wrapup
+#define UMF_local_search	 umfsi_local_search
+#define UMF_lsolve		 umfsi_lsolve
+#define UMF_ltsolve		 umfsi_ltsolve
+#define UMF_lhsolve		 umfsi_lhsolve
+#define UMF_malloc		 umf_i_malloc
+#define UMF_mem_alloc_element	 umfsi_mem_alloc_element
+#define UMF_mem_alloc_head_block umfsi_mem_alloc_head_block
+#define UMF_mem_alloc_tail_block umfsi_mem_alloc_tail_block
+#define UMF_mem_free_tail_block	 umfsi_mem_free_tail_block
+#define UMF_mem_init_memoryspace umfsi_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfsi_parallel_numeric
+#define UMF_msolve		 umfsi_msolve
+#define UMF_numeric_blobsize	 umfsi_numeric_blobsize
+#define UMF_numeric_blob_header umfsi_numeric_blob_header
+#define UMF_numeric_blob_check	 umfsi_numeric_blob_check
+#define UMF_numeric_map		 umfsi_numeric_map
+#define UMF_numeric_unmap	 umfsi_numeric_unmap
+#define UMF_numeric_usage	 umfsi_numeric_usage
+#define UMF_realloc		 umf_i_realloc
+#define UMF_report_perm		 umf_i_report_perm
+#define UMF_report_vector	 umfsi_report_vector
+#define UMF_row_search		 umfsi_row_search
+#define UMF_scale		 umfsi_scale
+#define UMF_scale_column	 umfsi_scale_column
+#define UMF_set_stats		 umfsi_set_stats
+#define UMF_singletons		 umf_i_singletons
+#define UMF_solve		 umfsi_solve
+#define UMF_solve_mixed		 umfsi_solve_mixed
+#define UMF_start_front		 umfsi_start_front
+#define UMF_store_lu		 umfsi_store_lu
+#define UMF_store_lu_drop	 umfsi_store_lu_drop
+#define UMF_symbolic_usage	 umfsi_symbolic_usage
+#define UMF_transpose		 umfsi_transpose
+#define UMF_tuple_lengths	 umfsi_tuple_lengths
+#define UMF_usolve		 umfsi_usolve
+#define UMF_utsolve		 umfsi_utsolve
+#define UMF_uhsolve		 umfsi_uhsolve
+#define UMF_valid_numeric	 umfsi_valid_numeric
+#define UMF_valid_symbolic	 umfsi_valid_symbolic
+#define UMF_triplet_map_x	 umfsi_triplet_map_x
+#define UMF_triplet_map_nox	 umfsi_triplet_map_nox
+#define UMF_triplet_nomap_x	 umfsi_triplet_nomap_x
+#define UMF_triplet_nomap_nox	 umfsi_triplet_nomap_nox
+#define UMF_cholmod		 umf_i_cholmod
+
+#define UMFPACK_col_to_triplet	 umfpack_si_col_to_triplet
+#define UMFPACK_defaults	 umfpack_di_defaults	/* same defaults */
+#define UMFPACK_free_numeric	 umfpack_si_free_numeric
+#define UMFPACK_free_symbolic	 umfpack_si_free_symbolic
+#define UMFPACK_get_lunz	 umfpack_si_get_lunz
+#define UMFPACK_get_numeric	 umfpack_si_get_numeric
+#define UMFPACK_get_symbolic	 umfpack_si_get_symbolic
+#define UMFPACK_get_determinant	 umfpack_si_get_determinant
+#define UMFPACK_numeric		 umfpack_si_numeric
+#define UMFPACK_refactor	 umfpack_si_refactor
+#define UMFPACK_qsymbolic	 umfpack_si_qsymbolic
+#define UMFPACK_paru_free_sw     umfpack_si_paru_free_sw
+#define UMFPACK_report_control	 umfpack_si_report_control
+#define UMFPACK_report_info	 umfpack_si_report_info
+#define UMFPACK_report_matrix	 umfpack_si_report_matrix
+#define UMFPACK_report_numeric	 umfpack_si_report_numeric
+#define UMFPACK_report_perm	 umfpack_si_report_perm
+#define UMFPACK_report_status	 umfpack_si_report_status
+#define UMFPACK_report_symbolic	 umfpack_si_report_symbolic
+#define UMFPACK_report_triplet	 umfpack_si_report_triplet
+#define UMFPACK_report_vector	 umfpack_si_report_vector
+#define UMFPACK_save_numeric	 umfpack_si_save_numeric
+#define UMFPACK_save_symbolic	 umfpack_si_save_symbolic
+#define UMFPACK_load_numeric	 umfpack_si_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_si_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_si_deserialize_numeric_view
+#define UMFPACK_load_symbolic	 umfpack_si_load_symbolic
+#define UMFPACK_scale		 umfpack_si_scale
+#define UMFPACK_solve		 umfpack_si_solve
+#define UMFPACK_solve_mixed	 umfpack_si_solve_mixed
+#define UMFPACK_msolve		 umfpack_si_msolve
+#define UMFPACK_symbolic	 umfpack_si_symbolic
+#define UMFPACK_transpose	 umfpack_si_transpose
+#define UMFPACK_triplet_to_col	 umfpack_si_triplet_to_col
+#define UMFPACK_wsolve		 umfpack_si_wsolve
+
+// added in v6.1.0
+#define UMFPACK_serialize_symbolic      umfpack_si_serialize_symbolic
+#define UMFPACK_deserialize_symbolic    umfpack_si_deserialize_symbolic
+#define UMFPACK_serialize_symbolic_size umfpack_si_serialize_symbolic_size
+#define UMFPACK_serialize_numeric       umfpack_si_serialize_numeric
+#define UMFPACK_deserialize_numeric     umfpack_si_deserialize_numeric
+#define UMFPACK_serialize_numeric_size  umfpack_si_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_si_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_si_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_si_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_si_serialize_numeric_compressed_size
+#define UMFPACK_copy_symbolic	        umfpack_si_copy_symbolic
+#define UMFPACK_copy_numeric	        umfpack_si_copy_numeric
+
+/* for debugging only: */
+#define UMF_malloc_count	 umf_i_malloc_count
+#define UMF_debug		 umfsi_debug
+#define UMF_allocfail		 umfsi_allocfail
+#define UMF_gprob		 umfsi_gprob
+#define UMF_dump_dense		 umfsi_dump_dense
+#define UMF_dump_element	 umfsi_dump_element
+#define UMF_dump_rowcol		 umfsi_dump_rowcol
+#define UMF_dump_matrix		 umfsi_dump_matrix
+#define UMF_dump_current_front	 umfsi_dump_current_front
+#define UMF_dump_lu		 umfsi_dump_lu
+#define UMF_dump_memory		 umfsi_dump_memory
+#define UMF_dump_packed_memory	 umfsi_dump_packed_memory
+#define UMF_dump_col_matrix	 umfsi_dump_col_matrix
+#define UMF_dump_chain		 umfsi_dump_chain
+#define UMF_dump_start		 umfsi_dump_start
+#define UMF_dump_rowmerge	 umfsi_dump_rowmerge
+#define UMF_dump_diagonal_map	 umfsi_dump_diagonal_map
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Single precision, with int64_t integers */
+/* -------------------------------------------------------------------------- */
+
+#ifdef SLONG
+
+#define UMF_analyze		 umf_l_analyze
+#define UMF_apply_order		 umf_l_apply_order
+#define UMF_assemble		 umfsl_assemble
+#define UMF_assemble_fixq	 umfsl_assemble_fixq
+#define UMF_blas3_update	 umfsl_blas3_update
+#define UMF_build_tuples	 umfsl_build_tuples
+#define UMF_build_tuples_usage	 umfsl_build_tuples_usage
+#define UMF_colamd		 umf_l_colamd
+#define UMF_colamd_set_defaults	 umf_l_colamd_set_defaults
+#define UMF_create_element	 umfsl_create_element
+#define UMF_extend_front	 umfsl_extend_front
+#define UMF_free		 umf_l_free
+#define UMF_fsize		 umf_l_fsize
+#define UMF_garbage_collection	 umfsl_garbage_collection
+#define UMF_get_memory		 umfsl_get_memory
+#define UMF_grow_front		 umfsl_grow_front
+#define UMF_init_front		 umfsl_init_front
+#define UMF_is_permutation	 umf_l_is_permutation
+#define UMF_kernel		 umfsl_kernel
+#define UMF_kernel_init		 umfsl_kernel_init
+#define UMF_kernel_init_usage	 umfsl_kernel_init_usage
+#define UMF_kernel_wrapup	 umfsl_kernel_wrapup
+#define UMF_local_search	 umfsl_local_search
+#define UMF_lsolve		 umfsl_lsolve
+#define UMF_ltsolve		 umfsl_ltsolve
+#define UMF_lhsolve		 umfsl_lhsolve
+#define UMF_malloc		 umf_l_malloc
+#define UMF_mem_alloc_element	 umfsl_mem_alloc_element
+#define UMF_mem_alloc_head_block umfsl_mem_alloc_head_block
+#define UMF_mem_alloc_tail_block umfsl_mem_alloc_tail_block
+#define UMF_mem_free_tail_block	 umfsl_mem_free_tail_block
+#define UMF_mem_init_memoryspace umfsl_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfsl_parallel_numeric
+#define UMF_msolve		 umfsl_msolve
+#define UMF_numeric_blobsize	 umfsl_numeric_blobsize
+#define UMF_numeric_blob_header umfsl_numeric_blob_header
+#define UMF_numeric_blob_check	 umfsl_numeric_blob_check
+#define UMF_numeric_map		 umfsl_numeric_map
+#define UMF_numeric_unmap	 umfsl_numeric_unmap
+#define UMF_numeric_usage	 umfsl_numeric_usage
+#define UMF_realloc		 umf_l_realloc
+#define UMF_report_perm		 umf_l_report_perm
+#define UMF_report_vector	 umfsl_report_vector
+#define UMF_row_search		 umfsl_row_search
+#define UMF_scale		 umfsl_scale
+#define UMF_scale_column	 umfsl_scale_column
+#define UMF_set_stats		 umfsl_set_stats
+#define UMF_singletons		 umf_l_singletons
+#define UMF_solve		 umfsl_solve
+#define UMF_solve_mixed		 umfsl_solve_mixed
+#define UMF_start_front		 umfsl_start_front
+#define UMF_store_lu		 umfsl_store_lu
+#define UMF_store_lu_drop	 umfsl_store_lu_drop
+#define UMF_symbolic_usage	 umfsl_symbolic_usage
+#define UMF_transpose		 umfsl_transpose
+#define UMF_tuple_lengths	 umfsl_tuple_lengths
+#define UMF_usolve		 umfsl_usolve
+#define UMF_utsolve		 umfsl_utsolve
+#define UMF_uhsolve		 umfsl_uhsolve
+#define UMF_valid_numeric	 umfsl_valid_numeric
+#define UMF_valid_symbolic	 umfsl_valid_symbolic
+#define UMF_triplet_map_x	 umfsl_triplet_map_x
+#define UMF_triplet_map_nox	 umfsl_triplet_map_nox
+#define UMF_triplet_nomap_x	 umfsl_triplet_nomap_x
+#define UMF_triplet_nomap_nox	 umfsl_triplet_nomap_nox
+#define UMF_cholmod		 umf_l_cholmod
+
+#define UMFPACK_col_to_triplet	 umfpack_sl_col_to_triplet
+#define UMFPACK_defaults	 umfpack_dl_defaults	/* same defaults */
+#define UMFPACK_free_numeric	 umfpack_sl_free_numeric
+#define UMFPACK_free_symbolic	 umfpack_sl_free_symbolic
+#define UMFPACK_get_lunz	 umfpack_sl_get_lunz
+#define UMFPACK_get_numeric	 umfpack_sl_get_numeric
+#define UMFPACK_get_symbolic	 umfpack_sl_get_symbolic
+#define UMFPACK_get_determinant	 umfpack_sl_get_determinant
+#define UMFPACK_numeric		 umfpack_sl_numeric
+#define UMFPACK_refactor	 umfpack_sl_refactor
+#define UMFPACK_qsymbolic	 umfpack_sl_qsymbolic
+#define UMFPACK_paru_free_sw     umfpack_sl_paru_free_sw
+#define UMFPACK_report_control	 umfpack_sl_report_control
+#define UMFPACK_report_info	 umfpack_sl_report_info
+#define UMFPACK_report_matrix	 umfpack_sl_report_matrix
+#define UMFPACK_report_numeric	 umfpack_sl_report_numeric
+#define UMFPACK_report_perm	 umfpack_sl_report_perm
+#define UMFPACK_report_status	 umfpack_sl_report_status
+#define UMFPACK_report_symbolic	 umfpack_sl_report_symbolic
+#define UMFPACK_report_triplet	 umfpack_sl_report_triplet
+#define UMFPACK_report_vector	 umfpack_sl_report_vector
+#define UMFPACK_save_numeric	 umfpack_sl_save_numeric
+#define UMFPACK_save_symbolic	 umfpack_sl_save_symbolic
+#define UMFPACK_load_numeric	 umfpack_sl_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_sl_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_sl_deserialize_numeric_view
+#define UMFPACK_load_symbolic	 umfpack_sl_load_symbolic
+#define UMFPACK_scale		 umfpack_sl_scale
+#define UMFPACK_solve		 umfpack_sl_solve
+#define UMFPACK_solve_mixed	 umfpack_sl_solve_mixed
+#define UMFPACK_msolve		 umfpack_sl_msolve
+#define UMFPACK_symbolic	 umfpack_sl_symbolic
+#define UMFPACK_transpose	 umfpack_sl_transpose
+#define UMFPACK_triplet_to_col	 umfpack_sl_triplet_to_col
+#define UMFPACK_wsolve		 umfpack_sl_wsolve
+
+// added in v6.1.0
+#define UMFPACK_serialize_symbolic      umfpack_sl_serialize_symbolic
+#define UMFPACK_deserialize_symbolic    umfpack_sl_deserialize_symbolic
+#define UMFPACK_serialize_symbolic_size umfpack_sl_serialize_symbolic_size
+#define UMFPACK_serialize_numeric       umfpack_sl_serialize_numeric
+#define UMFPACK_deserialize_numeric     umfpack_sl_deserialize_numeric
+#define UMFPACK_serialize_numeric_size  umfpack_sl_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_sl_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_sl_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_sl_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_sl_serialize_numeric_compressed_size
+#define UMFPACK_copy_symbolic	        umfpack_sl_copy_symbolic
+#define UMFPACK_copy_numeric	        umfpack_sl_copy_numeric
+
+/* for debugging only: */
+#define UMF_malloc_count	 umf_l_malloc_count
+#define UMF_debug		 umfsl_debug
+#define UMF_allocfail		 umfsl_allocfail
+#define UMF_gprob		 umfsl_gprob
+#define UMF_dump_dense		 umfsl_dump_dense
+#define UMF_dump_element	 umfsl_dump_element
+#define UMF_dump_rowcol		 umfsl_dump_rowcol
+#define UMF_dump_matrix		 umfsl_dump_matrix
+#define UMF_dump_current_front	 umfsl_dump_current_front
+#define UMF_dump_lu		 umfsl_dump_lu
+#define UMF_dump_memory		 umfsl_dump_memory
+#define UMF_dump_packed_memory	 umfsl_dump_packed_memory
+#define UMF_dump_col_matrix	 umfsl_dump_col_matrix
+#define UMF_dump_chain		 umfsl_dump_chain
+#define UMF_dump_start		 umfsl_dump_start
+#define UMF_dump_rowmerge	 umfsl_dump_rowmerge
+#define UMF_dump_diagonal_map	 umfsl_dump_diagonal_map
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Complex single precision, with int32_t integers */
+/* -------------------------------------------------------------------------- */
+
+#ifdef CINT
+
+#define UMF_analyze		 umf_i_analyze
+#define UMF_apply_order		 umf_i_apply_order
+#define UMF_assemble		 umfci_assemble
+#define UMF_assemble_fixq	 umfci_assemble_fixq
+#define UMF_blas3_update	 umfci_blas3_update
+#define UMF_build_tuples	 umfci_build_tuples
+#define UMF_build_tuples_usage	 umfci_build_tuples_usage
+#define UMF_colamd		 umf_i_colamd
+#define UMF_colamd_set_defaults	 umf_i_colamd_set_defaults
+#define UMF_create_element	 umfci_create_element
+#define UMF_extend_front	 umfci_extend_front
+#define UMF_free		 umf_i_free
+#define UMF_fsize		 umf_i_fsize
+#define UMF_garbage_collection	 umfci_garbage_collection
+#define UMF_get_memory		 umfci_get_memory
+#define UMF_grow_front		 umfci_grow_front
+#define UMF_init_front		 umfci_init_front
+#define UMF_is_permutation	 umf_i_is_permutation
+#define UMF_kernel		 umfci_kernel
+#define UMF_kernel_init		 umfci_kernel_init
+#define UMF_kernel_init_usage	 umfci_kernel_init_usage
+#define UMF_kernel_wrapup	 umfci_kernel_wrapup
+#define UMF_local_search	 umfci_local_search
+#define UMF_lsolve		 umfci_lsolve
+#define UMF_ltsolve		 umfci_ltsolve
+#define UMF_lhsolve		 umfci_lhsolve
+#define UMF_malloc		 umf_i_malloc
+#define UMF_mem_alloc_element	 umfci_mem_alloc_element
+#define UMF_mem_alloc_head_block umfci_mem_alloc_head_block
+#define UMF_mem_alloc_tail_block umfci_mem_alloc_tail_block
+#define UMF_mem_free_tail_block	 umfci_mem_free_tail_block
+#define UMF_mem_init_memoryspace umfci_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfci_parallel_numeric
+#define UMF_msolve		 umfci_msolve
+#define UMF_numeric_blobsize	 umfci_numeric_blobsize
+#define UMF_numeric_blob_header umfci_numeric_blob_header
+#define UMF_numeric_blob_check	 umfci_numeric_blob_check
+#define UMF_numeric_map		 umfci_numeric_map
+#define UMF_numeric_unmap	 umfci_numeric_unmap
+#define UMF_numeric_usage	 umfci_numeric_usage
+#define UMF_realloc		 umf_i_realloc
+#define UMF_report_perm		 umf_i_report_perm
+#define UMF_report_vector	 umfci_report_vector
+#define UMF_row_search		 umfci_row_search
+#define UMF_scale		 umfci_scale
+#define UMF_scale_column	 umfci_scale_column
+#define UMF_set_stats		 umfci_set_stats
+#define UMF_singletons		 umf_i_singletons
+#define UMF_solve		 umfci_solve
+#define UMF_solve_mixed		 umfci_solve_mixed
+#define UMF_start_front		 umfci_start_front
+#define UMF_store_lu		 umfci_store_lu
+#define UMF_store_lu_drop	 umfci_store_lu_drop
+#define UMF_symbolic_usage	 umfci_symbolic_usage
+#define UMF_transpose		 umfci_transpose
+#define UMF_tuple_lengths	 umfci_tuple_lengths
+#define UMF_usolve		 umfci_usolve
+#define UMF_utsolve		 umfci_utsolve
+#define UMF_uhsolve		 umfci_uhsolve
+#define UMF_valid_numeric	 umfci_valid_numeric
+#define UMF_valid_symbolic	 umfci_valid_symbolic
+#define UMF_triplet_map_x	 umfci_triplet_map_x
+#define UMF_triplet_map_nox	 umfci_triplet_map_nox
+#define UMF_triplet_nomap_x	 umfci_triplet_nomap_x
+#define UMF_triplet_nomap_nox	 umfci_triplet_nomap_nox
+#define UMF_cholmod		 umf_i_cholmod
+
+#define UMFPACK_col_to_triplet	 umfpack_ci_col_to_triplet
+#define UMFPACK_defaults	 umfpack_di_defaults	/* same defaults */
+#define UMFPACK_free_numeric	 umfpack_ci_free_numeric
+#define UMFPACK_free_symbolic	 umfpack_ci_free_symbolic
+#define UMFPACK_get_lunz	 umfpack_ci_get_lunz
+#define UMFPACK_get_numeric	 umfpack_ci_get_numeric
+#define UMFPACK_get_symbolic	 umfpack_ci_get_symbolic
+#define UMFPACK_get_determinant	 umfpack_ci_get_determinant
+#define UMFPACK_numeric		 umfpack_ci_numeric
+#define UMFPACK_refactor	 umfpack_ci_refactor
+#define UMFPACK_qsymbolic	 umfpack_ci_qsymbolic
+#define UMFPACK_paru_free_sw     umfpack_ci_paru_free_sw
+#define UMFPACK_report_control	 umfpack_ci_report_control
+#define UMFPACK_report_info	 umfpack_ci_report_info
+#define UMFPACK_report_matrix	 umfpack_ci_report_matrix
+#define UMFPACK_report_numeric	 umfpack_ci_report_numeric
+#define UMFPACK_report_perm	 umfpack_ci_report_perm
+#define UMFPACK_report_status	 umfpack_ci_report_status
+#define UMFPACK_report_symbolic	 umfpack_ci_report_symbolic
+#define UMFPACK_report_triplet	 umfpack_ci_report_triplet
+#define UMFPACK_report_vector	 umfpack_ci_report_vector
+#define UMFPACK_save_numeric	 umfpack_ci_save_numeric
+#define UMFPACK_save_symbolic	 umfpack_ci_save_symbolic
+#define UMFPACK_load_numeric	 umfpack_ci_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_ci_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_ci_deserialize_numeric_view
+#define UMFPACK_load_symbolic	 umfpack_ci_load_symbolic
+#define UMFPACK_scale		 umfpack_ci_scale
+#define UMFPACK_solve		 umfpack_ci_solve
+#define UMFPACK_solve_mixed	 umfpack_ci_solve_mixed
+#define UMFPACK_msolve		 umfpack_ci_msolve
+#define UMFPACK_symbolic	 umfpack_ci_symbolic
+#define UMFPACK_transpose	 umfpack_ci_transpose
+#define UMFPACK_triplet_to_col	 umfpack_ci_triplet_to_col
+#define UMFPACK_wsolve		 umfpack_ci_wsolve
+
+// added in v6.1.0
+#define UMFPACK_serialize_symbolic      umfpack_ci_serialize_symbolic
+#define UMFPACK_deserialize_symbolic    umfpack_ci_deserialize_symbolic
+#define UMFPACK_serialize_symbolic_size umfpack_ci_serialize_symbolic_size
+#define UMFPACK_serialize_numeric       umfpack_ci_serialize_numeric
+#define UMFPACK_deserialize_numeric     umfpack_ci_deserialize_numeric
+#define UMFPACK_serialize_numeric_size  umfpack_ci_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_ci_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_ci_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_ci_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_ci_serialize_numeric_compressed_size
+#define UMFPACK_copy_symbolic	        umfpack_ci_copy_symbolic
+#define UMFPACK_copy_numeric	        umfpack_ci_copy_numeric
+
+/* for debugging only: */
+#define UMF_malloc_count	 umf_i_malloc_count
+#define UMF_debug		 umfci_debug
+#define UMF_allocfail		 umfci_allocfail
+#define UMF_gprob		 umfci_gprob
+#define UMF_dump_dense		 umfci_dump_dense
+#define UMF_dump_element	 umfci_dump_element
+#define UMF_dump_rowcol		 umfci_dump_rowcol
+#define UMF_dump_matrix		 umfci_dump_matrix
+#define UMF_dump_current_front	 umfci_dump_current_front
+#define UMF_dump_lu		 umfci_dump_lu
+#define UMF_dump_memory		 umfci_dump_memory
+#define UMF_dump_packed_memory	 umfci_dump_packed_memory
+#define UMF_dump_col_matrix	 umfci_dump_col_matrix
+#define UMF_dump_chain		 umfci_dump_chain
+#define UMF_dump_start		 umfci_dump_start
+#define UMF_dump_rowmerge	 umfci_dump_rowmerge
+#define UMF_dump_diagonal_map	 umfci_dump_diagonal_map
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Complex single precision, with int64_t integers */
+/* -------------------------------------------------------------------------- */
+
+#ifdef CLONG
+
+#define UMF_analyze		 umf_l_analyze
+#define UMF_apply_order		 umf_l_apply_order
+#define UMF_assemble		 umfcl_assemble
+#define UMF_assemble_fixq	 umfcl_assemble_fixq
+#define UMF_blas3_update	 umfcl_blas3_update
+#define UMF_build_tuples	 umfcl_build_tuples
+#define UMF_build_tuples_usage	 umfcl_build_tuples_usage
+#define UMF_colamd		 umf_l_colamd
+#define UMF_colamd_set_defaults	 umf_l_colamd_set_defaults
+#define UMF_create_element	 umfcl_create_element
+#define UMF_extend_front	 umfcl_extend_front
+#define UMF_free		 umf_l_free
+#define UMF_fsize		 umf_l_fsize
+#define UMF_garbage_collection	 umfcl_garbage_collection
+#define UMF_get_memory		 umfcl_get_memory
+#define UMF_grow_front		 umfcl_grow_front
+#define UMF_init_front		 umfcl_init_front
+#define UMF_is_permutation	 umf_l_is_permutation
+#define UMF_kernel		 umfcl_kernel
+#define UMF_kernel_init		 umfcl_kernel_init
+#define UMF_kernel_init_usage	 umfcl_kernel_init_usage
+#define UMF_kernel_wrapup	 umfcl_kernel_wrapup
+#define UMF_local_search	 umfcl_local_search
+#define UMF_lsolve		 umfcl_lsolve
+#define UMF_ltsolve		 umfcl_ltsolve
+#define UMF_lhsolve		 umfcl_lhsolve
+#define UMF_malloc		 umf_l_malloc
+#define UMF_mem_alloc_element	 umfcl_mem_alloc_element
+#define UMF_mem_alloc_head_block umfcl_mem_alloc_head_block
+#define UMF_mem_alloc_tail_block umfcl_mem_alloc_tail_block
+#define UMF_mem_free_tail_block	 umfcl_mem_free_tail_block
+#define UMF_mem_init_memoryspace umfcl_mem_init_memoryspace
+#define UMF_parallel_numeric	 umfcl_parallel_numeric
+#define UMF_msolve		 umfcl_msolve
+#define UMF_numeric_blobsize	 umfcl_numeric_blobsize
+#define UMF_numeric_blob_header umfcl_numeric_blob_header
+#define UMF_numeric_blob_check	 umfcl_numeric_blob_check
+#define UMF_numeric_map		 umfcl_numeric_map
+#define UMF_numeric_unmap	 umfcl_numeric_unmap
+#define UMF_numeric_usage	 umfcl_numeric_usage
+#define UMF_realloc		 umf_l_realloc
+#define UMF_report_perm		 umf_l_report_perm
+#define UMF_report_vector	 umfcl_report_vector
+#define UMF_row_search		 umfcl_row_search
+#define UMF_scale		 umfcl_scale
+#define UMF_scale_column	 umfcl_scale_column
+#define UMF_set_stats		 umfcl_set_stats
+#define UMF_singletons		 umf_l_singletons
+#define UMF_solve		 umfcl_solve
+#define UMF_solve_mixed		 umfcl_solve_mixed
+#define UMF_start_front		 umfcl_start_front
+#define UMF_store_lu		 umfcl_store_lu
+#define UMF_store_lu_drop	 umfcl_store_lu_drop
+#define UMF_symbolic_usage	 umfcl_symbolic_usage
+#define UMF_transpose		 umfcl_transpose
+#define UMF_tuple_lengths	 umfcl_tuple_lengths
+#define UMF_usolve		 umfcl_usolve
+#define UMF_utsolve		 umfcl_utsolve
+#define UMF_uhsolve		 umfcl_uhsolve
+#define UMF_valid_numeric	 umfcl_valid_numeric
+#define UMF_valid_symbolic	 umfcl_valid_symbolic
+#define UMF_triplet_map_x	 umfcl_triplet_map_x
+#define UMF_triplet_map_nox	 umfcl_triplet_map_nox
+#define UMF_triplet_nomap_x	 umfcl_triplet_nomap_x
+#define UMF_triplet_nomap_nox	 umfcl_triplet_nomap_nox
+#define UMF_cholmod		 umf_l_cholmod
+
+#define UMFPACK_col_to_triplet	 umfpack_cl_col_to_triplet
+#define UMFPACK_defaults	 umfpack_dl_defaults	/* same defaults */
+#define UMFPACK_free_numeric	 umfpack_cl_free_numeric
+#define UMFPACK_free_symbolic	 umfpack_cl_free_symbolic
+#define UMFPACK_get_lunz	 umfpack_cl_get_lunz
+#define UMFPACK_get_numeric	 umfpack_cl_get_numeric
+#define UMFPACK_get_symbolic	 umfpack_cl_get_symbolic
+#define UMFPACK_get_determinant	 umfpack_cl_get_determinant
+#define UMFPACK_numeric		 umfpack_cl_numeric
+#define UMFPACK_refactor	 umfpack_cl_refactor
+#define UMFPACK_qsymbolic	 umfpack_cl_qsymbolic
+#define UMFPACK_paru_free_sw     umfpack_cl_paru_free_sw
+#define UMFPACK_report_control	 umfpack_cl_report_control
+#define UMFPACK_report_info	 umfpack_cl_report_info
+#define UMFPACK_report_matrix	 umfpack_cl_report_matrix
+#define UMFPACK_report_numeric	 umfpack_cl_report_numeric
+#define UMFPACK_report_perm	 umfpack_cl_report_perm
+#define UMFPACK_report_status	 umfpack_cl_report_status
+#define UMFPACK_report_symbolic	 umfpack_cl_report_symbolic
+#define UMFPACK_report_triplet	 umfpack_cl_report_triplet
+#define UMFPACK_report_vector	 umfpack_cl_report_vector
+#define UMFPACK_save_numeric	 umfpack_cl_save_numeric
+#define UMFPACK_save_symbolic	 umfpack_cl_save_symbolic
+#define UMFPACK_load_numeric	 umfpack_cl_load_numeric
+#define UMFPACK_load_numeric_mmap umfpack_cl_load_numeric_mmap
+#define UMFPACK_deserialize_numeric_view umfpack_cl_deserialize_numeric_view
+#define UMFPACK_load_symbolic	 umfpack_cl_load_symbolic
+#define UMFPACK_scale		 umfpack_cl_scale
+#define UMFPACK_solve		 umfpack_cl_solve
+#define UMFPACK_solve_mixed	 umfpack_cl_solve_mixed
+#define UMFPACK_msolve		 umfpack_cl_msolve
+#define UMFPACK_symbolic	 umfpack_cl_symbolic
+#define UMFPACK_transpose	 umfpack_cl_transpose
+#define UMFPACK_triplet_to_col	 umfpack_cl_triplet_to_col
+#define UMFPACK_wsolve		 umfpack_cl_wsolve
+
+// added in v6.1.0
+#define UMFPACK_serialize_symbolic      umfpack_cl_serialize_symbolic
+#define UMFPACK_deserialize_symbolic    umfpack_cl_deserialize_symbolic
+#define UMFPACK_serialize_symbolic_size umfpack_cl_serialize_symbolic_size
+#define UMFPACK_serialize_numeric       umfpack_cl_serialize_numeric
+#define UMFPACK_deserialize_numeric     umfpack_cl_deserialize_numeric
+#define UMFPACK_serialize_numeric_size  umfpack_cl_serialize_numeric_size
+#define UMFPACK_serialize_symbolic_compressed umfpack_cl_serialize_symbolic_compressed
+#define UMFPACK_serialize_symbolic_compressed_size umfpack_cl_serialize_symbolic_compressed_size
+#define UMFPACK_serialize_numeric_compressed umfpack_cl_serialize_numeric_compressed
+#define UMFPACK_serialize_numeric_compressed_size umfpack_cl_serialize_numeric_compressed_size
+#define UMFPACK_copy_symbolic	        umfpack_cl_copy_symbolic
+#define UMFPACK_copy_numeric	        umfpack_cl_copy_numeric
+
+/* for debugging only: */
+#define UMF_malloc_count	 umf_l_malloc_count
+#define UMF_debug		 umfcl_debug
+#define UMF_allocfail		 umfcl_allocfail
+#define UMF_gprob		 umfcl_gprob
+#define UMF_dump_dense		 umfcl_dump_dense
+#define UMF_dump_element	 umfcl_dump_element
+#define UMF_dump_rowcol		 umfcl_dump_rowcol
+#define UMF_dump_matrix		 umfcl_dump_matrix
+#define UMF_dump_current_front	 umfcl_dump_current_front
+#define UMF_dump_lu		 umfcl_dump_lu
+#define UMF_dump_memory		 umfcl_dump_memory
+#define UMF_dump_packed_memory	 umfcl_dump_packed_memory
+#define UMF_dump_col_matrix	 umfcl_dump_col_matrix
+#define UMF_dump_chain		 umfcl_dump_chain
+#define UMF_dump_start		 umfcl_dump_start
+#define UMF_dump_rowmerge	 umfcl_dump_rowmerge
+#define UMF_dump_diagonal_map	 umfcl_dump_diagonal_map
+
+#endif
@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umf_zstd: wrapper for the ZSTD compression library
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    Compiles the unmodified subset of ZSTD in UMFPACK/zstd/zstd_subset into
+    UMFPACK, with all of its global symbols renamed (see umf_codec.h).  ZSTD
+    uses the SuiteSparse memory manager in place of malloc, calloc, and free,
+    and is compiled without multithreading of its own (UMFPACK compresses
+    independent blocks in parallel instead).  Nothing is compiled if
+    NCOMPRESSION is defined.
+*/
+
+#include "umfpack.h"
+
+#ifndef NCOMPRESSION
+#include "umf_codec.h"
+
+void *ZSTD_malloc (size_t s)
+{
+    return (SuiteSparse_malloc (1, s)) ;
+}
+
+void *ZSTD_calloc (size_t n, size_t s)
+{
+    return (SuiteSparse_calloc (n, s)) ;
+}
+
+void ZSTD_free (void *p)
+{
+    (void) SuiteSparse_free (p) ;
+}
+
+/* ZSTD uses switch statements with no default case */
+#if defined (__GNUC__)
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+#include "zstd_subset/common/debug.c"
+/* FSE_isError and HUF_isError are defined here, but are macros elsewhere */
+#define FSE_isError UMF_EVAL2 (umf_, FSE_isError)
+#define HUF_isError UMF_EVAL2 (umf_, HUF_isError)
+#include "zstd_subset/common/entropy_common.c"
+#undef FSE_isError
+#undef HUF_isError
+#include "zstd_subset/common/error_private.c"
+#include "zstd_subset/common/fse_decompress.c"
+#include "zstd_subset/common/pool.c"
+#include "zstd_subset/common/threading.c"
+#include "zstd_subset/common/xxhash.c"
+
+/* zstd_common.c is not compiled, since it #undef's ZSTD_isError just before
+ * defining it, so that the function cannot be renamed.  ZSTD itself uses the
+ * ZSTD_isError macro in zstd_internal.h instead, and so does not need the
+ * function.  The rest of zstd_common.c is here, renamed by umf_codec.h: */
+#include "zstd_subset/common/error_private.h"
+#include "zstd_subset/common/zstd_internal.h"
+
+unsigned ZSTD_versionNumber (void)
+{
+    return (ZSTD_VERSION_NUMBER) ;
+}
+
+const char *ZSTD_versionString (void)
+{
+    return (ZSTD_VERSION_STRING) ;
+}
+
+const char *ZSTD_getErrorName (size_t code)
+{
+    return (ERR_getErrorName (code)) ;
+}
+
+ZSTD_ErrorCode ZSTD_getErrorCode (size_t code)
+{
+    return (ERR_getErrorCode (code)) ;
+}
+
+const char *ZSTD_getErrorString (ZSTD_ErrorCode code)
+{
+    return (ERR_getErrorString (code)) ;
+}
+
+#include "zstd_subset/compress/fse_compress.c"
+#include "zstd_subset/compress/hist.c"
+#include "zstd_subset/compress/huf_compress.c"
+#include "zstd_subset/compress/zstd_compress.c"
+#include "zstd_subset/compress/zstd_compress_literals.c"
+#include "zstd_subset/compress/zstd_compress_sequences.c"
+#include "zstd_subset/compress/zstd_compress_superblock.c"
+#include "zstd_subset/compress/zstd_double_fast.c"
+#include "zstd_subset/compress/zstd_fast.c"
+#include "zstd_subset/compress/zstd_lazy.c"
+#include "zstd_subset/compress/zstd_ldm.c"
+#include "zstd_subset/compress/zstdmt_compress.c"
+#include "zstd_subset/compress/zstd_opt.c"
+
+#include "zstd_subset/decompress/huf_decompress.c"
+#include "zstd_subset/decompress/zstd_ddict.c"
+#include "zstd_subset/decompress/zstd_decompress_block.c"
+#include "zstd_subset/decompress/zstd_decompress.c"
+
+#endif
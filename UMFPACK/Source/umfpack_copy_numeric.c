@@ -80,6 +80,9 @@ int UMFPACK_copy_numeric
     Numeric->Rs       = (double *) NULL ;
     Numeric->Memory   = (Unit *) NULL ;
     Numeric->Upattern = (Int *) NULL ;
+    Numeric->view     = FALSE ;     // the copy owns its arrays, even if
+    Numeric->map      = NULL ;      // the original is a view of a blob
+    Numeric->mapsize  = 0 ;
 
     // umfpack_free_numeric can now be safely called if an error occurs
 
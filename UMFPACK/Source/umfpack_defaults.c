@@ -52,6 +52,10 @@ void UMFPACK_defaults
     Control [UMFPACK_ALLOC_INIT] = UMFPACK_DEFAULT_ALLOC_INIT ;
     Control [UMFPACK_FRONT_ALLOC_INIT] = UMFPACK_DEFAULT_FRONT_ALLOC_INIT ;
     Control [UMFPACK_SCALE] = UMFPACK_DEFAULT_SCALE ;
+    Control [UMFPACK_NTHREADS] = UMFPACK_DEFAULT_NTHREADS ;
+    Control [UMFPACK_MEMORY_LIMIT] = UMFPACK_DEFAULT_MEMORY_LIMIT ;
+    Control [UMFPACK_ILU_DROPTOL] = UMFPACK_DEFAULT_ILU_DROPTOL ;
+    Control [UMFPACK_ILU_FILL] = UMFPACK_DEFAULT_ILU_FILL ;
 
     // added for v6.0.0:
     Control [UMFPACK_STRATEGY_THRESH_SYM] =
@@ -9,7 +9,11 @@
 
 /*
     User-callable.  Loads a Numeric object from a serialized blob created by
-    umfpack_*_serialize_numeric.
+    umfpack_*_serialize_numeric.  UMFPACK_deserialize_numeric copies the
+    contents of the blob, while UMFPACK_deserialize_numeric_view uses them in
+    place.  UMFPACK_deserialize_numeric also accepts a compressed blob created
+    by umfpack_*_serialize_numeric_compressed, which it first decompresses into
+    a temporary blob.
     Initial contribution by Will Kimmerer (MIT); revised by Tim Davis.
 */
 
@@ -17,30 +21,23 @@
 #include "umf_valid_numeric.h"
 #include "umf_malloc.h"
 #include "umf_free.h"
+#include "umf_blob.h"
+#include "umf_compress.h"
 
 // get a component of the Numeric object from the blob
 #define DESERIALIZE(object,type,n)                          \
 {                                                           \
+    int64_t s = (int64_t) (n) * sizeof (type) ;             \
     object = (type *) UMF_malloc (n, sizeof (type)) ;       \
     if (object == (type *) NULL)                            \
     {                                                       \
 	UMFPACK_free_numeric ((void **) &Numeric) ;         \
 	return (UMFPACK_ERROR_out_of_memory) ;              \
     }                                                       \
-    memcpy (object, blob + offset, (n) * sizeof (type)) ;   \
-    offset += (n) * sizeof (type) ;                         \
+    memcpy (object, blob + offset, s) ;                     \
+    offset += UMF_BLOB_PAD (s) ;                            \
 }
 
-// get a single scalar from the blob
-#define DESERIALIZE_SCALAR(type,scalar)                     \
-    type scalar = 0 ;                                       \
-    if (offset + sizeof (type) > blobsize)                  \
-    {                                                       \
-        return (UMFPACK_ERROR_invalid_blob) ;               \
-    }                                                       \
-    memcpy (&scalar, blob + offset, sizeof (type)) ;        \
-    offset += sizeof (type) ;                               \
-
 //==============================================================================
 //==== UMFPACK_deserialize_numeric =============================================
 //==============================================================================
@@ -62,36 +59,40 @@ int UMFPACK_deserialize_numeric
         return (UMFPACK_ERROR_argument_missing) ;
     }
 
-    NumericType *Numeric ;
     (*NumericHandle) = (void *) NULL ;
-    int64_t offset = 0 ;
-
-    // read the blob header:
-    DESERIALIZE_SCALAR (int64_t, required) ;
-    DESERIALIZE_SCALAR (int32_t, valid) ;
-    DESERIALIZE_SCALAR (int32_t, version_main) ;
-    DESERIALIZE_SCALAR (int32_t, version_sub) ;
-    DESERIALIZE_SCALAR (int32_t, version_subsub) ;
-    DESERIALIZE_SCALAR (int32_t, sizeof_Numeric) ;
-    DESERIALIZE_SCALAR (int32_t, sizeof_Entry) ;
-    DESERIALIZE_SCALAR (int32_t, sizeof_Int) ;
-    DESERIALIZE_SCALAR (int32_t, sizeof_Unit) ;
-    DESERIALIZE_SCALAR (int32_t, sizeof_double) ;
-    DESERIALIZE_SCALAR (int32_t, sizeof_void_star) ;
-
-    if (required > blobsize || valid != NUMERIC_VALID
-        || sizeof_Numeric != sizeof (NumericType)
-        || sizeof_Entry != sizeof (Entry)
-        || sizeof_Int != sizeof (Int)
-        || sizeof_Unit != sizeof (Unit)
-        || sizeof_double != sizeof (double)
-        || sizeof_void_star != sizeof (void *))
+
+    //--------------------------------------------------------------------------
+    // decompress the blob, if compressed
+    //--------------------------------------------------------------------------
+
+    int64_t size ;
+    if (umf_compressed_blob_info (blob, blobsize, &size))
     {
-        return (UMFPACK_ERROR_invalid_blob) ;
+        // decompress the blob into a temporary one, and deserialize that
+        if (size <= 0)
+        {
+            return (UMFPACK_ERROR_invalid_blob) ;
+        }
+        Int nunits = (Int) UNITS (int8_t, size) ;
+        int8_t *plain = (int8_t *) UMF_malloc (nunits, sizeof (Unit)) ;
+        if (plain == (int8_t *) NULL)
+        {
+            return (UMFPACK_ERROR_out_of_memory) ;
+        }
+        int status = umf_decompress_blob (plain, size, blob, blobsize) ;
+        if (status == UMFPACK_OK)
+        {
+            status = UMFPACK_deserialize_numeric (NumericHandle, plain, size) ;
+        }
+        (void) UMF_free ((void *) plain) ;
+        return (status) ;
     }
 
+    NumericType *Numeric ;
+    int64_t offset = UMF_BLOB_PREFIX ;
+
     //--------------------------------------------------------------------------
-    // read the Numeric header from the blob
+    // read the blob header and the Numeric header from the blob
     //--------------------------------------------------------------------------
 
     Numeric = (NumericType *) UMF_malloc (1, sizeof (NumericType)) ;
@@ -99,31 +100,14 @@ int UMFPACK_deserialize_numeric
     {
 	return (UMFPACK_ERROR_out_of_memory) ;
     }
-    memcpy (Numeric, blob + offset, sizeof (NumericType)) ;
-    offset += sizeof (NumericType) ;
-
-    if (Numeric->valid != NUMERIC_VALID || Numeric->n_row <= 0 ||
-	Numeric->n_col <= 0 || Numeric->npiv < 0 || Numeric->ulen < 0 ||
-	Numeric->size < 0)
+    int status = UMF_numeric_blob_check (blob, blobsize, Numeric) ;
+    if (status != UMFPACK_OK)
     {
-	// Numeric does not contain a valid Numeric object
+	// blob does not contain a valid Numeric object
 	(void) UMF_free ((void *) Numeric) ;
-	return (UMFPACK_ERROR_invalid_Numeric_object) ;
+	return (status) ;
     }
 
-    Numeric->D        = (Entry *) NULL ;
-    Numeric->Rperm    = (Int *) NULL ;
-    Numeric->Cperm    = (Int *) NULL ;
-    Numeric->Lpos     = (Int *) NULL ;
-    Numeric->Lilen    = (Int *) NULL ;
-    Numeric->Lip      = (Int *) NULL ;
-    Numeric->Upos     = (Int *) NULL ;
-    Numeric->Uilen    = (Int *) NULL ;
-    Numeric->Uip      = (Int *) NULL ;
-    Numeric->Rs       = (double *) NULL ;
-    Numeric->Memory   = (Unit *) NULL ;
-    Numeric->Upattern = (Int *) NULL ;
-
     // UMFPACK_free_numeric can now be safely called if an error occurs
 
     //--------------------------------------------------------------------------
@@ -158,3 +142,97 @@ int UMFPACK_deserialize_numeric
     return (UMFPACK_OK) ;
 }
 
+
+//==============================================================================
+//==== UMFPACK_deserialize_numeric_view ========================================
+//==============================================================================
+
+// Constructs a Numeric object whose arrays point into the blob itself, which
+// must remain in place (and unchanged) until the Numeric object is freed.
+// Only the small NumericType struct is allocated.
+
+// point a component of the Numeric object into the blob
+#define VIEW(object,type,n)                                 \
+{                                                           \
+    int64_t s = (int64_t) (n) * sizeof (type) ;             \
+    object = (type *) (blob + offset) ;                     \
+    offset += UMF_BLOB_PAD (s) ;                            \
+}
+
+int UMFPACK_deserialize_numeric_view
+(
+    void **NumericHandle,   // output: Numeric object using the blob in place
+    int8_t *blob,           // input: serialized blob, not modified by this
+                            // method (but see umfpack_*_refactor)
+    int64_t blobsize        // size of the blob in bytes
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (NumericHandle == NULL || blob == NULL)
+    {
+        return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+    NumericType *Numeric ;
+    (*NumericHandle) = (void *) NULL ;
+    int64_t offset = UMF_BLOB_PREFIX ;
+
+    if (((uintptr_t) blob) % sizeof (double) != 0)
+    {
+        // the arrays in the blob would not be properly aligned
+        return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the blob header and the Numeric header from the blob
+    //--------------------------------------------------------------------------
+
+    Numeric = (NumericType *) UMF_malloc (1, sizeof (NumericType)) ;
+    if (Numeric == (NumericType *) NULL)
+    {
+	return (UMFPACK_ERROR_out_of_memory) ;
+    }
+    int status = UMF_numeric_blob_check (blob, blobsize, Numeric) ;
+    if (status != UMFPACK_OK)
+    {
+	// blob does not contain a valid Numeric object
+	(void) UMF_free ((void *) Numeric) ;
+	return (status) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use the rest of the Numeric object in place
+    //--------------------------------------------------------------------------
+
+    Int n_inner = MIN (Numeric->n_row, Numeric->n_col) ;
+    VIEW (Numeric->D,     Entry, n_inner+1) ;
+    VIEW (Numeric->Rperm, Int,   Numeric->n_row+1) ;
+    VIEW (Numeric->Cperm, Int,   Numeric->n_col+1) ;
+    VIEW (Numeric->Lpos,  Int,   Numeric->npiv+1) ;
+    VIEW (Numeric->Lilen, Int,   Numeric->npiv+1) ;
+    VIEW (Numeric->Lip,   Int,   Numeric->npiv+1) ;
+    VIEW (Numeric->Upos,  Int,   Numeric->npiv+1) ;
+    VIEW (Numeric->Uilen, Int,   Numeric->npiv+1) ;
+    VIEW (Numeric->Uip,   Int,   Numeric->npiv+1) ;
+    if (Numeric->scale != UMFPACK_SCALE_NONE)
+    {
+	VIEW (Numeric->Rs, double, Numeric->n_row) ;
+    }
+    if (Numeric->ulen > 0)
+    {
+	VIEW (Numeric->Upattern, Int, Numeric->ulen+1) ;
+    }
+    VIEW (Numeric->Memory, Unit, Numeric->size) ;
+    Numeric->view = TRUE ;
+
+    // make sure the Numeric object is valid
+    ASSERT (UMF_valid_numeric (Numeric)) ;
+
+    // return new Numeric object
+    (*NumericHandle) = (void *) Numeric ;
+    return (UMFPACK_OK) ;
+}
@@ -9,7 +9,7 @@
 
 /*
     User-callable.  Loads a Symbolic object from a serialized blob created by
-    umfpack_*_serialize_symbolic.
+    umfpack_*_serialize_symbolic or umfpack_*_serialize_symbolic_compressed.
     Initial contribution by Will Kimmerer (MIT); revised by Tim Davis.
 */
 
@@ -17,6 +17,7 @@
 #include "umf_valid_symbolic.h"
 #include "umf_malloc.h"
 #include "umf_free.h"
+#include "umf_compress.h"
 
 // get a component of the Symbolic object from the blob
 #define DESERIALIZE(object,type,n)                          \
@@ -62,8 +63,36 @@ int UMFPACK_deserialize_symbolic
         return (UMFPACK_ERROR_argument_missing) ;
     }
 
-    SymbolicType *Symbolic ;
     (*SymbolicHandle) = (void *) NULL ;
+
+    //--------------------------------------------------------------------------
+    // decompress the blob, if compressed
+    //--------------------------------------------------------------------------
+
+    int64_t size ;
+    if (umf_compressed_blob_info (blob, blobsize, &size))
+    {
+        // decompress the blob into a temporary one, and deserialize that
+        if (size <= 0)
+        {
+            return (UMFPACK_ERROR_invalid_blob) ;
+        }
+        Int nunits = (Int) UNITS (int8_t, size) ;
+        int8_t *plain = (int8_t *) UMF_malloc (nunits, sizeof (Unit)) ;
+        if (plain == (int8_t *) NULL)
+        {
+            return (UMFPACK_ERROR_out_of_memory) ;
+        }
+        int status = umf_decompress_blob (plain, size, blob, blobsize) ;
+        if (status == UMFPACK_OK)
+        {
+            status = UMFPACK_deserialize_symbolic (SymbolicHandle, plain, size) ;
+        }
+        (void) UMF_free ((void *) plain) ;
+        return (status) ;
+    }
+
+    SymbolicType *Symbolic ;
     int64_t offset = 0 ;
 
     // read the blob header:
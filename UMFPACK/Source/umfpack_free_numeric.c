@@ -8,11 +8,13 @@
 //------------------------------------------------------------------------------
 
 /*  User-callable.  Free the entire Numeric object (consists of 11 to 13
- *  malloc'd objects.  See UMFPACK_free_numeric.h for details.
+ *  malloc'd objects, or just 1 if the Numeric object is a view of a
+ *  serialized blob.  See UMFPACK_free_numeric.h for details.
  */
 
 #include "umf_internal.h"
 #include "umf_free.h"
+#include "umf_blob.h"
 
 void UMFPACK_free_numeric
 (
@@ -31,6 +33,15 @@ void UMFPACK_free_numeric
 	return ;
     }
 
+    if (Numeric->view)
+    {
+	/* the arrays live in a blob owned by the user, or in a mapped file */
+	UMF_numeric_unmap (Numeric->map, Numeric->mapsize) ;
+	(void) UMF_free ((void *) Numeric) ;
+	*NumericHandle = (void *) NULL ;
+	return ;
+    }
+
     /* these 9 objects always exist */
     (void) UMF_free ((void *) Numeric->D) ;
     (void) UMF_free ((void *) Numeric->Rperm) ;
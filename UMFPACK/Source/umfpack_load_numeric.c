@@ -9,14 +9,22 @@
 
 /*
     User-callable.  Loads a Numeric object from a file created by
-    umfpack_*_save_numeric.
+    umfpack_*_save_numeric.  UMFPACK_load_numeric reads the file into newly
+    allocated arrays, while UMFPACK_load_numeric_mmap maps the file into
+    memory and uses it in place.
 */
 
 #include "umf_internal.h"
 #include "umf_valid_numeric.h"
 #include "umf_malloc.h"
 #include "umf_free.h"
+#include "umf_blob.h"
 
+/* number of bytes of padding after n objects of the given type */
+#define PAD(n,type) \
+    (UMF_BLOB_PAD ((int64_t) (n) * sizeof (type)) - (int64_t) (n) * sizeof (type))
+
+/* read an object from the file, and skip the padding that follows it */
 #define READ(object,type,n) \
 { \
     object = (type *) UMF_malloc (n, sizeof (type)) ; \
@@ -26,7 +34,8 @@
 	fclose (f) ; \
 	return (UMFPACK_ERROR_out_of_memory) ; \
     } \
-    if (fread (object, sizeof (type), n, f) != (size_t) n) \
+    if (fread (object, sizeof (type), n, f) != (size_t) n || \
+	fread (pad, 1, PAD (n, type), f) != (size_t) PAD (n, type)) \
     { \
 	UMFPACK_free_numeric ((void **) &Numeric) ; \
 	fclose (f) ; \
@@ -53,6 +62,7 @@ int UMFPACK_load_numeric
     NumericType *Numeric ;
     char *filename ;
     FILE *f ;
+    int8_t prefix [UMF_BLOB_PREFIX], pad [UMF_BLOB_ALIGN] ;
 
     *NumericHandle = (void *) NULL ;
 
@@ -75,7 +85,7 @@ int UMFPACK_load_numeric
     }
 
     /* ---------------------------------------------------------------------- */
-    /* read the Numeric header from the file, in binary */
+    /* read the blob header and the Numeric header from the file, in binary */
     /* ---------------------------------------------------------------------- */
 
     Numeric = (NumericType *) UMF_malloc (1, sizeof (NumericType)) ;
@@ -84,42 +94,22 @@ int UMFPACK_load_numeric
 	fclose (f) ;
 	return (UMFPACK_ERROR_out_of_memory) ;
     }
-    if (fread (Numeric, sizeof (NumericType), 1, f) != 1)
-    {
-	(void) UMF_free ((void *) Numeric) ;
-	fclose (f) ;
-	return (UMFPACK_ERROR_file_IO) ;
-    }
-    if (ferror (f))
+    if (fread (prefix, 1, UMF_BLOB_PREFIX, f) != UMF_BLOB_PREFIX || ferror (f))
     {
 	(void) UMF_free ((void *) Numeric) ;
 	fclose (f) ;
 	return (UMFPACK_ERROR_file_IO) ;
     }
 
-    if (Numeric->valid != NUMERIC_VALID || Numeric->n_row <= 0 ||
-	Numeric->n_col <= 0 || Numeric->npiv < 0 || Numeric->ulen < 0 ||
-	Numeric->size <= 0)
+    /* the size of the file is not known; a short file is caught by fread */
+    if (UMF_numeric_blob_check (prefix, INT64_MAX, Numeric) != UMFPACK_OK)
     {
-	/* Numeric does not point to a NumericType object */
+	/* the file does not hold a Numeric object */
 	(void) UMF_free ((void *) Numeric) ;
 	fclose (f) ;
 	return (UMFPACK_ERROR_invalid_Numeric_object) ;
     }
 
-    Numeric->D        = (Entry *) NULL ;
-    Numeric->Rperm    = (Int *) NULL ;
-    Numeric->Cperm    = (Int *) NULL ;
-    Numeric->Lpos     = (Int *) NULL ;
-    Numeric->Lilen    = (Int *) NULL ;
-    Numeric->Lip      = (Int *) NULL ;
-    Numeric->Upos     = (Int *) NULL ;
-    Numeric->Uilen    = (Int *) NULL ;
-    Numeric->Uip      = (Int *) NULL ;
-    Numeric->Rs       = (double *) NULL ;
-    Numeric->Memory   = (Unit *) NULL ;
-    Numeric->Upattern = (Int *) NULL ;
-
     /* umfpack_free_numeric can now be safely called if an error occurs */
 
     /* ---------------------------------------------------------------------- */
@@ -158,3 +148,66 @@ int UMFPACK_load_numeric
     *NumericHandle = (void *) Numeric ;
     return (UMFPACK_OK) ;
 }
+
+/* ========================================================================== */
+/* === UMFPACK_load_numeric_mmap ============================================ */
+/* ========================================================================== */
+
+int UMFPACK_load_numeric_mmap
+(
+    void **NumericHandle,
+    char *user_filename
+)
+{
+    NumericType *Numeric ;
+    char *filename ;
+    void *map ;
+    int64_t mapsize ;
+    int status ;
+
+    *NumericHandle = (void *) NULL ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the filename, or use the default name if filename is NULL */
+    /* ---------------------------------------------------------------------- */
+
+    if (user_filename == (char *) NULL)
+    {
+	filename = "numeric.umf" ;
+    }
+    else
+    {
+	filename = user_filename ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* map the file into memory */
+    /* ---------------------------------------------------------------------- */
+
+    map = UMF_numeric_map (filename, &mapsize) ;
+    if (map == NULL)
+    {
+	/* the file cannot be mapped (or memory-mapped files are not available
+	 * on this platform), so read it in the usual way instead */
+	return (UMFPACK_load_numeric (NumericHandle, user_filename)) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* use the mapped file in place */
+    /* ---------------------------------------------------------------------- */
+
+    status = UMFPACK_deserialize_numeric_view (NumericHandle, (int8_t *) map,
+	mapsize) ;
+    if (status != UMFPACK_OK)
+    {
+	UMF_numeric_unmap (map, mapsize) ;
+	return ((status == UMFPACK_ERROR_out_of_memory) ? status :
+	    UMFPACK_ERROR_invalid_Numeric_object) ;
+    }
+
+    /* the mapping is removed by UMFPACK_free_numeric */
+    Numeric = (NumericType *) (*NumericHandle) ;
+    Numeric->map = map ;
+    Numeric->mapsize = mapsize ;
+    return (UMFPACK_OK) ;
+}
@@ -0,0 +1,299 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umfpack_msolve: solve a linear system with multiple right-hand sides
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    User-callable.  Solves a linear system with one or more right-hand sides,
+    using the numerical factorization computed by UMFPACK_numeric.  See
+    umfpack.h for more details.
+
+    The right-hand sides are solved UMF_MSOLVE_NB at a time by UMF_msolve.
+    The blocks are split into at most Control [UMFPACK_NTHREADS] contiguous
+    ranges of columns, each of which is solved by its own OpenMP thread with
+    its own workspace.
+
+    Dynamic memory usage:  UMFPACK_msolve calls UMF_malloc three times, for
+    workspace of size t*(UMF_MSOLVE_WSIZE (n,irstep)*sizeof(double) +
+    n*sizeof(Int) + UMFPACK_INFO*sizeof(double)) where t is the number of
+    threads used.  On return, all of this workspace is free'd via UMF_free.
+*/
+
+#include "umf_internal.h"
+#include "umf_valid_numeric.h"
+#include "umf_msolve.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+/* the debug and test-coverage code is not thread-safe */
+#define PARALLEL_SOLVE
+#endif
+
+#ifndef NDEBUG
+PRIVATE Int init_count ;
+#endif
+
+int UMFPACK_msolve
+(
+    int sys,
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+#endif
+    Int nrhs,
+    double Xx [ ],
+#ifdef COMPLEX
+    double Xz [ ],
+#endif
+    Int ldx,
+    const double Bx [ ],
+#ifdef COMPLEX
+    const double Bz [ ],
+#endif
+    Int ldb,
+    void *NumericHandle,
+    const double Control [UMFPACK_CONTROL],
+    double User_Info [UMFPACK_INFO]
+)
+{
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    double Info2 [UMFPACK_INFO], stats [2], flops ;
+    double *Info, *W, *TInfo ;
+    NumericType *Numeric ;
+    Int n, i, t, irstep, status, nthreads, nblocks, wsize, xstride, bstride,
+	*Pattern ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the amount of time used by the process so far */
+    /* ---------------------------------------------------------------------- */
+
+    umfpack_tic (stats) ;
+
+#ifndef NDEBUG
+    init_count = UMF_malloc_count ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* get parameters */
+    /* ---------------------------------------------------------------------- */
+
+    irstep = GET_CONTROL (UMFPACK_IRSTEP, UMFPACK_DEFAULT_IRSTEP) ;
+    nthreads = GET_CONTROL (UMFPACK_NTHREADS, UMFPACK_DEFAULT_NTHREADS) ;
+
+    if (User_Info != (double *) NULL)
+    {
+	/* return Info in user's array */
+	Info = User_Info ;
+	/* clear the parts of Info that are set by UMFPACK_msolve */
+	for (i = UMFPACK_IR_TAKEN ; i <= UMFPACK_SOLVE_TIME ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+    }
+    else
+    {
+	/* no Info array passed - use local one instead */
+	Info = Info2 ;
+	for (i = 0 ; i < UMFPACK_INFO ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+    }
+
+    Info [UMFPACK_STATUS] = UMFPACK_OK ;
+    Info [UMFPACK_SOLVE_FLOPS] = 0 ;
+
+    Numeric = (NumericType *) NumericHandle ;
+    if (!UMF_valid_numeric (Numeric))
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_Numeric_object ;
+	return (UMFPACK_ERROR_invalid_Numeric_object) ;
+    }
+
+    Info [UMFPACK_NROW] = Numeric->n_row ;
+    Info [UMFPACK_NCOL] = Numeric->n_col ;
+
+    if (Numeric->n_row != Numeric->n_col)
+    {
+	/* only square systems can be handled */
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_system ;
+	return (UMFPACK_ERROR_invalid_system) ;
+    }
+    n = Numeric->n_row ;
+
+    if (nrhs < 0 || ldx < n || ldb < n)
+    {
+	/* the right-hand sides must be n-by-nrhs, stored by column */
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_system ;
+	return (UMFPACK_ERROR_invalid_system) ;
+    }
+
+    if (Numeric->nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+    {
+	/* turn off iterative refinement if A is singular */
+	/* or if U has NaN's on the diagonal. */
+	irstep = 0 ;
+    }
+
+    if ((!Xx || !Bx) && nrhs > 0)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_argument_missing ;
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+    if (sys >= UMFPACK_Pt_L)
+    {
+	/* no iterative refinement except for nonsingular Ax=b, A'x=b, A.'x=b */
+	irstep = 0 ;
+    }
+    irstep = MAX (0, irstep) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* determine the number of threads */
+    /* ---------------------------------------------------------------------- */
+
+#ifdef PARALLEL_SOLVE
+    if (nthreads <= 0)
+    {
+	nthreads = omp_get_max_threads ( ) ;
+    }
+#else
+    nthreads = 1 ;
+#endif
+    nblocks = (nrhs + UMF_MSOLVE_NB - 1) / UMF_MSOLVE_NB ;
+    nthreads = MAX (1, MIN (nthreads, nblocks)) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate the workspace, one part for each thread */
+    /* ---------------------------------------------------------------------- */
+
+    wsize = UMF_MSOLVE_WSIZE (n, irstep) ;
+    Pattern = (Int *) UMF_malloc (nthreads * n, sizeof (Int)) ;
+    W = (double *) UMF_malloc (nthreads * wsize, sizeof (double)) ;
+    TInfo = (double *) UMF_malloc (nthreads * UMFPACK_INFO, sizeof (double)) ;
+    if (!W || !Pattern || !TInfo)
+    {
+	DEBUGm4 (("out of memory: msolve work\n")) ;
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_out_of_memory ;
+	(void) UMF_free ((void *) W) ;
+	(void) UMF_free ((void *) Pattern) ;
+	(void) UMF_free ((void *) TInfo) ;
+	return (UMFPACK_ERROR_out_of_memory) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve the system, with each thread taking a range of blocks */
+    /* ---------------------------------------------------------------------- */
+
+    /* column j of X starts at Xx + j*xstride (and Xz + j*ldx if split) */
+#ifdef COMPLEX
+    xstride = SPLIT (Xz) ? ldx : (2*ldx) ;
+    bstride = SPLIT (Bz) ? ldb : (2*ldb) ;
+#else
+    xstride = ldx ;
+    bstride = ldb ;
+#endif
+
+#ifdef PARALLEL_SOLVE
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+#endif
+    for (t = 0 ; t < nthreads ; t++)
+    {
+	double *Tinfo = TInfo + t * UMFPACK_INFO ;
+	Int j1 = ((t * nblocks) / nthreads) * UMF_MSOLVE_NB ;
+	Int j2 = MIN (nrhs, (((t+1) * nblocks) / nthreads) * UMF_MSOLVE_NB) ;
+	Int k ;
+	for (k = 0 ; k < UMFPACK_INFO ; k++)
+	{
+	    Tinfo [k] = EMPTY ;
+	}
+	Tinfo [UMFPACK_STATUS] = UMF_msolve (sys, Ap, Ai, Ax,
+	    Xx + j1 * xstride, ldx,
+	    Bx + j1 * bstride, ldb,
+#ifdef COMPLEX
+	    Az,
+	    SPLIT (Xz) ? (Xz + j1 * ldx) : ((double *) NULL),
+	    SPLIT (Bz) ? (Bz + j1 * ldb) : ((double *) NULL),
+#endif
+	    j2 - j1, Numeric, irstep, Tinfo, Pattern + t * n, W + t * wsize) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* combine the status and statistics of each thread */
+    /* ---------------------------------------------------------------------- */
+
+    /* the status is the first error of any thread, if any, or else the first
+     * warning, if any */
+    status = UMFPACK_OK ;
+    flops = 0 ;
+    for (t = 0 ; t < nthreads ; t++)
+    {
+	double *Tinfo = TInfo + t * UMFPACK_INFO ;
+	Int tstatus = (Int) Tinfo [UMFPACK_STATUS] ;
+	if (tstatus < 0 && status >= 0)
+	{
+	    status = tstatus ;
+	}
+	else if (tstatus > 0 && status == UMFPACK_OK)
+	{
+	    status = tstatus ;
+	}
+	if (Tinfo [UMFPACK_SOLVE_FLOPS] > 0)
+	{
+	    flops += Tinfo [UMFPACK_SOLVE_FLOPS] ;
+	}
+	for (i = UMFPACK_IR_TAKEN ; i <= UMFPACK_OMEGA2 ; i++)
+	{
+	    Info [i] = MAX (Info [i], Tinfo [i]) ;
+	}
+	if (Tinfo [UMFPACK_NZ] != EMPTY)
+	{
+	    Info [UMFPACK_NZ] = Tinfo [UMFPACK_NZ] ;
+	}
+    }
+    Info [UMFPACK_SOLVE_FLOPS] = flops ;
+    if (irstep == 0 || nrhs == 0)
+    {
+	/* no iterative refinement was done */
+	Info [UMFPACK_IR_TAKEN] = 0 ;
+	Info [UMFPACK_IR_ATTEMPTED] = 0 ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* free the workspace */
+    /* ---------------------------------------------------------------------- */
+
+    (void) UMF_free ((void *) W) ;
+    (void) UMF_free ((void *) Pattern) ;
+    (void) UMF_free ((void *) TInfo) ;
+    ASSERT (UMF_malloc_count == init_count) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* get the time used by UMFPACK_msolve */
+    /* ---------------------------------------------------------------------- */
+
+    Info [UMFPACK_STATUS] = status ;
+    if (status >= 0)
+    {
+	umfpack_toc (stats) ;
+	Info [UMFPACK_SOLVE_WALLTIME] = stats [0] ;
+	Info [UMFPACK_SOLVE_TIME] = stats [1] ;
+    }
+
+    return (status) ;
+}
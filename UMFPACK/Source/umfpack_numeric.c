@@ -22,10 +22,15 @@
 #include "umf_valid_symbolic.h"
 #include "umf_set_stats.h"
 #include "umf_kernel.h"
+#include "umf_parallel_numeric.h"
 #include "umf_malloc.h"
 #include "umf_free.h"
 #include "umf_realloc.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifndef NDEBUG
 PRIVATE Int init_count ;
 #endif
@@ -46,7 +51,8 @@ PRIVATE Int numeric_alloc
     NumericType **NumericHandle,
     SymbolicType *Symbolic,
     double alloc_init,
-    Int scale
+    Int scale,
+    Int max_size
 ) ;
 
 PRIVATE void error
@@ -64,9 +70,9 @@ int UMFPACK_numeric
 (
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     void *SymbolicHandle,
     void **NumericHandle,
@@ -80,12 +86,14 @@ int UMFPACK_numeric
     /* ---------------------------------------------------------------------- */
 
     double Info2 [UMFPACK_INFO], alloc_init, relpt, relpt2, droptol,
-	front_alloc_init, stats [2] ;
+	front_alloc_init, memory_limit, limit_size, ilu_droptol, ilu_fill,
+	stats [2] ;
     double *Info ;
     WorkType WorkSpace, *Work ;
     NumericType *Numeric ;
     SymbolicType *Symbolic ;
-    Int n_row, n_col, n_inner, newsize, i, status, *inew, npiv, ulen, scale ;
+    Int n_row, n_col, n_inner, newsize, i, status, *inew, npiv, ulen, scale,
+	nthreads, max_size ;
     Unit *mnew ;
 
     /* ---------------------------------------------------------------------- */
@@ -117,10 +125,18 @@ int UMFPACK_numeric
 	UMFPACK_DEFAULT_FRONT_ALLOC_INIT) ;
     scale = GET_CONTROL (UMFPACK_SCALE, UMFPACK_DEFAULT_SCALE) ;
     droptol = GET_CONTROL (UMFPACK_DROPTOL, UMFPACK_DEFAULT_DROPTOL) ;
+    nthreads = GET_CONTROL (UMFPACK_NTHREADS, UMFPACK_DEFAULT_NTHREADS) ;
+    memory_limit = GET_CONTROL (UMFPACK_MEMORY_LIMIT,
+	UMFPACK_DEFAULT_MEMORY_LIMIT) ;
+    ilu_droptol = GET_CONTROL (UMFPACK_ILU_DROPTOL,
+	UMFPACK_DEFAULT_ILU_DROPTOL) ;
+    ilu_fill = GET_CONTROL (UMFPACK_ILU_FILL, UMFPACK_DEFAULT_ILU_FILL) ;
 
     relpt   = MAX (0.0, MIN (relpt,  1.0)) ;
     relpt2  = MAX (0.0, MIN (relpt2, 1.0)) ;
     droptol = MAX (0.0, droptol) ;
+    ilu_droptol = MAX (0.0, ilu_droptol) ;
+    ilu_fill = MAX (0.0, ilu_fill) ;
     front_alloc_init = MIN (1.0, front_alloc_init) ;
 
     if (scale != UMFPACK_SCALE_NONE && scale != UMFPACK_SCALE_MAX)
@@ -128,6 +144,22 @@ int UMFPACK_numeric
 	scale = UMFPACK_DEFAULT_SCALE ;
     }
 
+    if (nthreads <= 0)
+    {
+#ifdef _OPENMP
+	nthreads = omp_get_max_threads ( ) ;
+#else
+	nthreads = 1 ;
+#endif
+    }
+
+    if (memory_limit > 0)
+    {
+	/* the memory limit applies to the matrix as a whole, so do not
+	 * factorize independent blocks in parallel */
+	nthreads = 1 ;
+    }
+
     if (User_Info != (double *) NULL)
     {
 	/* return Info in user's array */
@@ -196,8 +228,54 @@ int UMFPACK_numeric
     }
 
     Info [UMFPACK_NZ] = Ap [n_col] ;
+    Info [UMFPACK_NUMERIC_NBLOCKS] = 1 ;
     *NumericHandle = (void *) NULL ;
 
+    /* ---------------------------------------------------------------------- */
+    /* check the memory limit */
+    /* ---------------------------------------------------------------------- */
+
+    max_size = 0 ;
+    if (memory_limit > 0)
+    {
+	/* Numeric->Memory gets what is left of the memory limit after the
+	 * O(n) part of the Numeric object and the Work object.  Fail before
+	 * allocating anything if it cannot hold even the initial matrix. */
+	limit_size = memory_limit / sizeof (Unit)
+	    - UMF_numeric_usage (Symbolic, scale != UMFPACK_SCALE_NONE) ;
+	DEBUGm4 (("memory limit %g: Numeric->Memory limit %g min %g\n",
+	    memory_limit, limit_size, Symbolic->dnum_mem_init_usage)) ;
+	if (limit_size < Symbolic->dnum_mem_init_usage)
+	{
+	    Info [UMFPACK_STATUS] = UMFPACK_ERROR_memory_limit ;
+	    return (UMFPACK_ERROR_memory_limit) ;
+	}
+	limit_size = MIN (limit_size, ((double) Int_MAX) / sizeof (Unit) - 1) ;
+	max_size = (Int) limit_size ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize independent blocks in parallel, if requested */
+    /* ---------------------------------------------------------------------- */
+
+    if (nthreads > 1 && UMF_parallel_numeric (Ap, Ai, Ax,
+#ifdef COMPLEX
+	Az,
+#endif
+	Symbolic, nthreads, Control, &Numeric, Info))
+    {
+	/* Numeric holds the merged LU factors of all the blocks */
+	*NumericHandle = (void *) Numeric ;
+	umfpack_toc (stats) ;
+	Info [UMFPACK_NUMERIC_WALLTIME] = stats [0] ;
+	Info [UMFPACK_NUMERIC_TIME] = stats [1] ;
+	return ((int) Info [UMFPACK_STATUS]) ;
+    }
+#ifndef NDEBUG
+    /* the blocks were factorized by recursive calls to UMFPACK_numeric */
+    init_count = UMF_malloc_count ;
+#endif
+
     /* ---------------------------------------------------------------------- */
     /* allocate the Work object */
     /* ---------------------------------------------------------------------- */
@@ -219,6 +297,11 @@ int UMFPACK_numeric
     Work->nfr = Symbolic->nfr ;
     Work->nb = Symbolic->nb ;
     Work->n1 = Symbolic->n1 ;
+    Work->max_size = max_size ;
+    Work->ilu_droptol = ilu_droptol ;
+    Work->ilu_fill = (Int) MIN (ilu_fill, (double) MAX (n_row, n_col)) ;
+    Work->ilu = (Work->ilu_droptol > 0 || Work->ilu_fill > 0) ;
+    Work->nthreads = nthreads ;
 
     if (!work_alloc (Work, Symbolic))
     {
@@ -241,10 +324,11 @@ int UMFPACK_numeric
      * (Numeric->Memory).  The size of this object is the larger of
      * (Control [UMFPACK_ALLOC_INIT]) *  (the approximate upper bound computed
      * by UMFPACK_symbolic), and the minimum required to start the numerical
-     * factorization.  * This request is reduced if it fails.
+     * factorization.  * This request is reduced if it fails.  It is also
+     * limited by Control [UMFPACK_MEMORY_LIMIT], if present.
      */
 
-    if (!numeric_alloc (&Numeric, Symbolic, alloc_init, scale))
+    if (!numeric_alloc (&Numeric, Symbolic, alloc_init, scale, max_size))
     {
 	DEBUGm4 (("out of memory: initial numeric\n")) ;
 	Info [UMFPACK_STATUS] = UMFPACK_ERROR_out_of_memory ;
@@ -264,6 +348,7 @@ int UMFPACK_numeric
     Numeric->alloc_init = alloc_init ;
     Numeric->front_alloc_init = front_alloc_init ;
     Numeric->scale = scale ;
+    Numeric->ilu = Work->ilu ;
 
     DEBUG0 (("umf relpt %g %g init %g %g inc %g red %g\n",
 	relpt, relpt2, alloc_init, front_alloc_init,
@@ -292,10 +377,17 @@ int UMFPACK_numeric
 #endif
 	Numeric, Work, Symbolic) ;
 
+    if (status == UMFPACK_ERROR_out_of_memory && max_size > 0
+	&& Numeric->size >= max_size)
+    {
+	/* Numeric->Memory has reached the memory limit */
+	status = UMFPACK_ERROR_memory_limit ;
+    }
+
     Info [UMFPACK_STATUS] = status ;
     if (status < UMFPACK_OK)
     {
-	/* out of memory, or pattern has changed */
+	/* out of memory, memory limit reached, or pattern has changed */
 	error (&Numeric, Work) ;
 	return (status) ;
     }
@@ -533,7 +625,8 @@ PRIVATE Int numeric_alloc
     NumericType **NumericHandle,
     SymbolicType *Symbolic,
     double alloc_init,
-    Int scale
+    Int scale,
+    Int max_size
 )
 {
     double nsize, bsize ;
@@ -556,6 +649,9 @@ PRIVATE Int numeric_alloc
 	return (FALSE) ;	/* out of memory */
     }
     Numeric->valid = 0 ;
+    Numeric->view = FALSE ;
+    Numeric->map = NULL ;
+    Numeric->mapsize = 0 ;
     *NumericHandle = Numeric ;
 
     /* 9 allocations:  accounted for in UMF_set_stats (num_On_size1),
@@ -624,6 +720,14 @@ PRIVATE Int numeric_alloc
     DEBUG0 (("bsize %g\n", bsize)) ;
     nsize = MIN (nsize, bsize) ;
 
+    if (max_size > 0)
+    {
+	/* Numeric->Memory cannot exceed the memory limit.  If the estimate is
+	 * larger than the limit, allocate it all now, to avoid reallocation. */
+	ASSERT (max_size >= min_usage) ;
+	nsize = MIN (nsize, max_size) ;
+    }
+
     Numeric->size = (Int) nsize ;
 
     DEBUG0 (("Num init %g usage_est %g numsize "ID" minusage "ID"\n",
@@ -30,12 +30,22 @@
 #include "umf_singletons.h"
 #include "umf_cholmod.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 PRIVATE void error
 (
     SymbolicType **Symbolic,
     SWType **SW_Handle
 ) ;
 
+#ifdef SINGLE
+/* umfpack_*_paru_free_sw is not user-callable in the single precision
+   versions, since they do not include umfpack_*_paru_symbolic */
+PRIVATE void UMFPACK_paru_free_sw (void **SW_Handle) ;
+#endif
+
 /* worst-case usage for SW object */
 #define SYM_WORK_USAGE(n_col,n_row,Clen) \
     (DUNITS (Int, Clen) + \
@@ -480,9 +490,9 @@ PRIVATE Int prune_singletons
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     Int Cperm1 [ ],
     Int InvRperm1 [ ],
@@ -500,7 +510,7 @@ PRIVATE Int prune_singletons
 #endif
 
     nzdiag = 0 ;
-    do_nzdiag = (Ax != (double *) NULL) ;
+    do_nzdiag = (Ax != (Scalar *) NULL) ;
 
 #ifndef NDEBUG
     DEBUGm4 (("Prune : S = A (Cperm1 (n1+1:end), Rperm1 (n1+1:end))\n")) ;
@@ -639,9 +649,9 @@ PRIVATE int symbolic_analysis
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
 
     /* user-provided ordering (may be NULL) */
@@ -702,7 +712,7 @@ PRIVATE int symbolic_analysis
 	head_usage, tail_usage, lnz, unz, esize, *Esize, rdeg, *Cdeg, *Rdeg,
 	*Cperm1, *Rperm1, n1, oldcol, newcol, n1c, n1r, oldrow,
 	dense_row_threshold, tlen, aggressive, *Rp, *Ri ;
-    Int do_singletons, ordering_option, print_level ;
+    Int do_singletons, ordering_option, print_level, nthreads ;
     int ok ;
 
     SymbolicType *Symbolic = NULL ;
@@ -732,6 +742,15 @@ PRIVATE int symbolic_analysis
     strategy = GET_CONTROL (UMFPACK_STRATEGY, UMFPACK_DEFAULT_STRATEGY) ;
     force_fixQ = GET_CONTROL (UMFPACK_FIXQ, UMFPACK_DEFAULT_FIXQ) ;
     do_singletons = GET_CONTROL (UMFPACK_SINGLETONS,UMFPACK_DEFAULT_SINGLETONS);
+    nthreads = GET_CONTROL (UMFPACK_NTHREADS, UMFPACK_DEFAULT_NTHREADS) ;
+    if (nthreads <= 0)
+    {
+#ifdef _OPENMP
+	nthreads = omp_get_max_threads ( ) ;
+#else
+	nthreads = 1 ;
+#endif
+    }
     AMD_defaults (amd_Control) ;
     amd_Control [AMD_DENSE] =
 	GET_CONTROL (UMFPACK_AMD_DENSE, UMFPACK_DEFAULT_AMD_DENSE) ;
@@ -1080,7 +1099,8 @@ PRIVATE int symbolic_analysis
         do_singletons, /* if false, then do not look for singletons */
 	Cdeg, Cperm1, Rdeg,
 	Rperm1, InvRperm1, &n1, &n1c, &n1r, &nempty_col, &nempty_row, &is_sym,
-	&max_rdeg, /* workspace: */ Rperm_init, Ci, Ci + nz, Ci + nz + n_row) ;
+	&max_rdeg, /* workspace: */ Rperm_init, Ci, Ci + nz, Ci + nz + n_row,
+	nthreads) ;
 
     /* ] done using Rperm_init and Ci as workspace */
 
@@ -1174,11 +1194,11 @@ PRIVATE int symbolic_analysis
 	    /* need to sort the columns of S first */
 	    Rp = Ci ;
 	    Ri = Ci + (n_row) + 1 ;
-	    (void) UMF_transpose (n2, n2, Sp, Si, (double *) NULL,
+	    (void) UMF_transpose (n2, n2, Sp, Si, (Scalar *) NULL,
 		(Int *) NULL, (Int *) NULL, 0,
-		Rp, Ri, (double *) NULL, Wq, FALSE
+		Rp, Ri, (Scalar *) NULL, Wq, 1, FALSE
 #ifdef COMPLEX
-		, (double *) NULL, (double *) NULL, FALSE
+		, (Scalar *) NULL, (Scalar *) NULL, FALSE
 #endif
 		) ;
 	}
@@ -1363,9 +1383,9 @@ PRIVATE int symbolic_analysis
 	 * pointers. */
 
 	(void) prune_singletons (n1, n_col, Ap, Ai,
-	    (double *) NULL,
+	    (Scalar *) NULL,
 #ifdef COMPLEX
-	    (double *) NULL,
+	    (Scalar *) NULL,
 #endif
 	    Cperm1, InvRperm1, Ci, Cperm_init
 #ifndef NDEBUG
@@ -1606,9 +1626,9 @@ PRIVATE int symbolic_analysis
 	/* S = column form submatrix after removing singletons and applying
 	 * initial column ordering (includes singleton ordering) */
 	(void) prune_singletons (n1, n_col, Ap, Ai,
-	    (double *) NULL,
+	    (Scalar *) NULL,
 #ifdef COMPLEX
-	    (double *) NULL,
+	    (Scalar *) NULL,
 #endif
 	    Cperm_init, InvRperm1, Si, Sp
 #ifndef NDEBUG
@@ -1723,10 +1743,10 @@ PRIVATE int symbolic_analysis
 	ASSERT (Clen2 >= n_col) ;
 
 	(void) UMF_transpose (n_row - n1, n_col - n1 - nempty_col,
-	    Sp, Si, (double *) NULL,
-	    P, (Int *) NULL, 0, Bp, Bi, (double *) NULL, W, FALSE
+	    Sp, Si, (Scalar *) NULL,
+	    P, (Int *) NULL, 0, Bp, Bi, (Scalar *) NULL, W, 1, FALSE
 #ifdef COMPLEX
-	    , (double *) NULL, (double *) NULL, FALSE
+	    , (Scalar *) NULL, (Scalar *) NULL, FALSE
 #endif
 	    ) ;
 
@@ -2152,7 +2172,7 @@ PRIVATE int symbolic_analysis
 		CLEAR (aij) ;
 		oldrow = Ai [p] ;
 		newrow = Ci [oldrow] ;
-		if (Ax != (double *) NULL)
+		if (Ax != (Scalar *) NULL)
 		{
 		    ASSIGN (aij, Ax, Az, p, SPLIT (Az)) ;
 		}
@@ -2675,6 +2695,9 @@ PRIVATE int symbolic_analysis
 /* === UMFPACK_paru_free_sw ================================================= */
 /* ========================================================================== */
 
+#ifdef SINGLE
+PRIVATE
+#endif
 void UMFPACK_paru_free_sw
 (
     void **SW_Handle
@@ -2739,9 +2762,9 @@ int UMFPACK_qsymbolic
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     const Int Quser [ ],
     void **SymbolicHandle,
@@ -2770,6 +2793,11 @@ int UMFPACK_qsymbolic
 }
 
 
+#ifndef SINGLE
+
+/* the single precision versions do not include umfpack_*_fsymbolic or
+ * umfpack_*_paru_symbolic */
+
 /* ========================================================================== */
 /* === UMFPACK_fsymbolic ==================================================== */
 /* ========================================================================== */
@@ -2780,9 +2808,9 @@ int UMFPACK_fsymbolic
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
 
     /* user-provided ordering function */
@@ -2841,9 +2869,9 @@ int UMFPACK_paru_symbolic
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
 
     /* user-provided ordering */
@@ -2895,3 +2923,4 @@ int UMFPACK_paru_symbolic
         Control, User_Info, 1)) ;
 }
 
+#endif
@@ -0,0 +1,864 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source/umfpack_refactor: numeric refactorization with fixed pivots
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+/*
+    User-callable.  Recomputes the numerical values of the LU factors held in
+    an existing Numeric object, for a new matrix A with the same nonzero
+    pattern as the one that was factorized by UMFPACK_numeric.  The row and
+    column permutations, the kind of row scaling, and the packed L and U
+    patterns (the Lchains and Uchains) of the Numeric object are all reused.
+    No pivot search is done, and no frontal matrices, elements, or tuples are
+    constructed.  See umfpack.h for a more detailed description.
+
+    The packed column form of L and row form of U are first unpacked into a
+    conventional column form of both L and U (pattern only), with pointers
+    back into Numeric->Memory for the numerical values.  A left-looking
+    factorization of P*R*A*Q is then computed in this fixed pattern.  Since
+    UMFPACK_numeric keeps only the nonzero entries of L and U, an entry in
+    the new factorization can fall outside the pattern.  This is harmless if
+    the entry is zero, which is often the case even though it is the sum of
+    nonzero terms (the terms cancel because of the structure of the matrix,
+    which is why UMFPACK_numeric found it to be zero).  Such an entry is
+    discarded if it is tiny compared with the terms that formed it;
+    otherwise UMFPACK_ERROR_different_pattern is returned.  The results are
+    computed in workspace, and copied into the Numeric object only if
+    successful.
+
+    Dynamic memory usage:  calls UMF_malloc 6 times, for a total space
+    of about 6n + (lnz+unz) integers, 2n + lnz+unz Entry's, n + unz
+    pointers, and 2n + lnz doubles, where lnz and unz are the number of
+    off-diagonal entries held in the L and U patterns.  All of it is freed
+    via UMF_free when done.
+*/
+
+#include "umf_internal.h"
+#include "umf_valid_numeric.h"
+#include "umf_scale.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
+
+/* An entry that falls outside the pattern of L and U is taken to be zero if
+ * its magnitude is no more than FILL_TOL times the sum of the magnitudes of
+ * the terms that formed it.  Entries of L and U inside the pattern can also be
+ * left with just roundoff after cancellation, so the magnitude used for each
+ * of them is the sum of the magnitudes of its own terms, not its value. */
+#define FILL_TOL (1024 * DBL_EPSILON)
+
+/* Mark [i] for a row i outside the pattern of column k */
+#define FILL_MARK(k) (-(k)-2)
+
+PRIVATE Int get_L_pattern
+(
+    NumericType *Numeric,
+    Int Lp [ ],
+    Int Li [ ],
+    Entry **Lval,
+    Int Pattern [ ]
+) ;
+
+PRIVATE Int get_U_pattern
+(
+    NumericType *Numeric,
+    Int Up [ ],
+    Int Ui [ ],
+    Entry **Umap,
+    Int Pattern [ ],
+    Int W [ ]
+) ;
+
+/* ========================================================================== */
+/* === UMFPACK_refactor ===================================================== */
+/* ========================================================================== */
+
+int UMFPACK_refactor
+(
+    const Int Ap [ ],
+    const Int Ai [ ],
+    const double Ax [ ],
+#ifdef COMPLEX
+    const double Az [ ],
+#endif
+    void *NumericHandle,
+    double User_Info [UMFPACK_INFO]
+)
+{
+
+    /* ---------------------------------------------------------------------- */
+    /* local variables */
+    /* ---------------------------------------------------------------------- */
+
+    double Info2 [UMFPACK_INFO], stats [2], rsmin, rsmax, rs, rgrowth, amax,
+	umax, d, flops, *Info, *Rs, *Dwork, *Mag,
+	*Lmag ;
+    Entry x, ujk, *X, *Dnew, *Lx, *Ux, *Xwork, **Lval, **Umap, **Pwork ;
+    NumericType *Numeric ;
+    Int n, nz, i, j, k, p, q, p1, p2, row, col, ilast, status, lnz, unz,
+	do_scale, do_recip, nnzpiv, nfill, *Pinv, *Lp, *Up, *Li, *Ui,
+	*Pattern, *Mark, *Fill, *Iwork, *Iwork2, *Rperm, *Cperm ;
+#ifdef COMPLEX
+    Int split = SPLIT (Az) ;
+#endif
+
+    /* ---------------------------------------------------------------------- */
+    /* get the amount of time used by the process so far */
+    /* ---------------------------------------------------------------------- */
+
+    umfpack_tic (stats) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check input parameters */
+    /* ---------------------------------------------------------------------- */
+
+    if (User_Info != (double *) NULL)
+    {
+	/* return Info in user's array */
+	Info = User_Info ;
+    }
+    else
+    {
+	/* no Info array passed - use local one instead */
+	Info = Info2 ;
+	for (i = 0 ; i < UMFPACK_INFO ; i++)
+	{
+	    Info [i] = EMPTY ;
+	}
+    }
+
+    Info [UMFPACK_STATUS] = UMFPACK_OK ;
+
+    Numeric = (NumericType *) NumericHandle ;
+    if (!UMF_valid_numeric (Numeric) || Numeric->ilu)
+    {
+	/* an incomplete factorization cannot be refactorized, since entries
+	 * were dropped from its pattern */
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_Numeric_object ;
+	return (UMFPACK_ERROR_invalid_Numeric_object) ;
+    }
+
+    n = Numeric->n_row ;
+    Info [UMFPACK_NROW] = n ;
+    Info [UMFPACK_NCOL] = Numeric->n_col ;
+
+    if (n != Numeric->n_col || Numeric->npiv != n || Numeric->ulen != 0)
+    {
+	/* only square, structurally nonsingular systems can be handled */
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_system ;
+	return (UMFPACK_ERROR_invalid_system) ;
+    }
+
+    if (!Ap || !Ai || !Ax)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_argument_missing ;
+	return (UMFPACK_ERROR_argument_missing) ;
+    }
+
+    nz = Ap [n] ;
+    Info [UMFPACK_NZ] = nz ;
+    if (Ap [0] != 0 || nz < 0)
+    {
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_invalid_matrix ;
+	return (UMFPACK_ERROR_invalid_matrix) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate integer workspace and get the pattern of L and U */
+    /* ---------------------------------------------------------------------- */
+
+    do_scale = (Numeric->scale != UMFPACK_SCALE_NONE) ;
+
+    Iwork = (Int *) UMF_malloc (6*n + 2, sizeof (Int)) ;
+    Dwork = (double *) UMF_malloc (2*n, sizeof (double)) ;
+    if (!Iwork || !Dwork)
+    {
+	(void) UMF_free ((void *) Iwork) ;
+	(void) UMF_free ((void *) Dwork) ;
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_out_of_memory ;
+	return (UMFPACK_ERROR_out_of_memory) ;
+    }
+    Pinv    = Iwork ;		/* size n */
+    Lp      = Iwork + n ;	/* size n+1 */
+    Up      = Iwork + 2*n + 1 ;	/* size n+1 */
+    Pattern = Iwork + 3*n + 2 ;	/* size n */
+    Mark    = Iwork + 4*n + 2 ;	/* size n */
+    Fill    = Iwork + 5*n + 2 ;	/* size n */
+    Rs      = Dwork ;		/* size n */
+    Mag     = Dwork + n ;	/* size n */
+
+    lnz = get_L_pattern (Numeric, Lp, (Int *) NULL, (Entry **) NULL, Pattern) ;
+    unz = get_U_pattern (Numeric, Up, (Int *) NULL, (Entry **) NULL, Pattern,
+	Mark) ;
+
+    Iwork2 = (Int *) UMF_malloc (lnz + unz + 1, sizeof (Int)) ;
+    Xwork = (Entry *) UMF_malloc (2*n + lnz + unz + 1, sizeof (Entry)) ;
+    Pwork = (Entry **) UMF_malloc (n + unz + 1, sizeof (Entry *)) ;
+    Lmag = (double *) UMF_malloc (lnz + 1, sizeof (double)) ;
+    if (!Iwork2 || !Xwork || !Pwork || !Lmag)
+    {
+	(void) UMF_free ((void *) Iwork) ;
+	(void) UMF_free ((void *) Dwork) ;
+	(void) UMF_free ((void *) Iwork2) ;
+	(void) UMF_free ((void *) Xwork) ;
+	(void) UMF_free ((void *) Pwork) ;
+	(void) UMF_free ((void *) Lmag) ;
+	Info [UMFPACK_STATUS] = UMFPACK_ERROR_out_of_memory ;
+	return (UMFPACK_ERROR_out_of_memory) ;
+    }
+    Li   = Iwork2 ;		/* size lnz */
+    Ui   = Iwork2 + lnz ;	/* size unz */
+    X    = Xwork ;		/* size n */
+    Dnew = Xwork + n ;		/* size n */
+    Lx   = Xwork + 2*n ;	/* size lnz */
+    Ux   = Xwork + 2*n + lnz ;	/* size unz */
+    Lval = Pwork ;		/* size n */
+    Umap = Pwork + n ;		/* size unz */
+
+    (void) get_L_pattern (Numeric, Lp, Li, Lval, Pattern) ;
+    (void) get_U_pattern (Numeric, Up, Ui, Umap, Pattern, Mark) ;
+
+    /* ---------------------------------------------------------------------- */
+    /* check the input matrix and compute the scale factors, if requested */
+    /* ---------------------------------------------------------------------- */
+
+    /* The scale factors are computed just as in UMF_kernel_init, using the
+     * kind of scaling selected when the Numeric object was created. */
+
+    status = UMFPACK_OK ;
+    rsmin = -1 ;
+    rsmax = -1 ;
+    do_recip = FALSE ;
+
+    if (do_scale)
+    {
+	for (row = 0 ; row < n ; row++)
+	{
+	    Rs [row] = 0.0 ;
+	}
+    }
+    for (col = 0 ; col < n && status == UMFPACK_OK ; col++)
+    {
+	ilast = EMPTY ;
+	p1 = Ap [col] ;
+	p2 = Ap [col+1] ;
+	if (p1 > p2)
+	{
+	    /* invalid matrix */
+	    status = UMFPACK_ERROR_invalid_matrix ;
+	    break ;
+	}
+	for (p = p1 ; p < p2 ; p++)
+	{
+	    row = Ai [p] ;
+	    if (row <= ilast || row >= n)
+	    {
+		/* invalid matrix, columns must be sorted, no duplicates */
+		status = UMFPACK_ERROR_invalid_matrix ;
+		break ;
+	    }
+	    if (do_scale)
+	    {
+		ASSIGN (x, Ax, Az, p, split) ;
+		APPROX_ABS (d, x) ;
+		rs = Rs [row] ;
+		if (!SCALAR_IS_NAN (rs))
+		{
+		    if (SCALAR_IS_NAN (d))
+		    {
+			Rs [row] = d ;
+		    }
+		    else if (Numeric->scale == UMFPACK_SCALE_MAX)
+		    {
+			Rs [row] = MAX (rs, d) ;
+		    }
+		    else
+		    {
+			Rs [row] += d ;
+		    }
+		}
+	    }
+	    ilast = row ;
+	}
+    }
+
+    if (status == UMFPACK_OK && do_scale)
+    {
+	for (row = 0 ; row < n ; row++)
+	{
+	    rs = Rs [row] ;
+	    if (SCALAR_IS_ZERO (rs) || SCALAR_IS_NAN (rs))
+	    {
+		/* don't scale a completely zero row, or one with NaN's */
+		Rs [row] = 1.0 ;
+	    }
+	}
+	rsmin = Rs [0] ;
+	rsmax = Rs [0] ;
+	for (row = 0 ; row < n ; row++)
+	{
+	    rsmin = MIN (rsmin, Rs [row]) ;
+	    rsmax = MAX (rsmax, Rs [row]) ;
+	}
+#ifndef NRECIPROCAL
+	/* multiply by the reciprocal if Rs is not too small */
+	do_recip = (rsmin >= RECIPROCAL_TOLERANCE) ;
+	if (do_recip)
+	{
+	    for (row = 0 ; row < n ; row++)
+	    {
+		Rs [row] = 1.0 / Rs [row] ;
+	    }
+	}
+#endif
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* left-looking factorization of P*R*A*Q in the pattern of L and U */
+    /* ---------------------------------------------------------------------- */
+
+    Rperm = Numeric->Rperm ;
+    Cperm = Numeric->Cperm ;
+    for (k = 0 ; k < n ; k++)
+    {
+	Pinv [Rperm [k]] = k ;
+	Mark [k] = EMPTY ;
+	CLEAR (X [k]) ;
+    }
+
+    rgrowth = 1 ;
+    flops = 0 ;
+
+    for (k = 0 ; k < n && status == UMFPACK_OK ; k++)
+    {
+
+	/* ------------------------------------------------------------------ */
+	/* mark the pattern of column k of L and U */
+	/* ------------------------------------------------------------------ */
+
+	Mark [k] = k ;
+	Mag [k] = 0 ;
+	for (p = Up [k] ; p < Up [k+1] ; p++)
+	{
+	    Mark [Ui [p]] = k ;
+	    Mag [Ui [p]] = 0 ;
+	}
+	for (p = Lp [k] ; p < Lp [k+1] ; p++)
+	{
+	    Mark [Li [p]] = k ;
+	    Mag [Li [p]] = 0 ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* scatter column k of P*R*A*Q into X */
+	/* ------------------------------------------------------------------ */
+
+	col = Cperm [k] ;
+	amax = 0 ;
+	nfill = 0 ;
+	for (p = Ap [col] ; p < Ap [col+1] ; p++)
+	{
+	    row = Ai [p] ;
+	    ASSIGN (x, Ax, Az, p, split) ;
+	    if (do_scale)
+	    {
+#ifndef NRECIPROCAL
+		if (do_recip)
+		{
+		    SCALE (x, Rs [row]) ;
+		}
+		else
+#endif
+		{
+		    SCALE_DIV (x, Rs [row]) ;
+		}
+	    }
+	    i = Pinv [row] ;
+	    X [i] = x ;
+	    ABS (d, x) ;
+	    amax = MAX (amax, d) ;
+	    Mag [i] = d ;
+	    if (Mark [i] != k)
+	    {
+		/* entry of A is not in the pattern of L and U */
+		Mark [i] = FILL_MARK (k) ;
+		Fill [nfill++] = i ;
+	    }
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* compute column k of U, applying the prior columns of L */
+	/* ------------------------------------------------------------------ */
+
+	umax = 0 ;
+	for (p = Up [k] ; p < Up [k+1] ; p++)
+	{
+	    /* Ui [Up [k] ... Up [k+1]-1] is in ascending order */
+	    j = Ui [p] ;
+	    ujk = X [j] ;
+	    CLEAR (X [j]) ;
+	    Ux [p] = ujk ;
+	    if (IS_ZERO (ujk))
+	    {
+		continue ;
+	    }
+	    ABS (d, ujk) ;
+	    umax = MAX (umax, d) ;
+	    d = MAX (d, Mag [j]) ;
+	    for (q = Lp [j] ; q < Lp [j+1] ; q++)
+	    {
+		i = Li [q] ;
+		if (Mark [i] != k)
+		{
+		    /* fill-in is not in the pattern of L and U */
+		    if (Mark [i] != FILL_MARK (k))
+		    {
+			Mark [i] = FILL_MARK (k) ;
+			Fill [nfill++] = i ;
+			Mag [i] = 0 ;
+		    }
+		}
+		Mag [i] += Lmag [q] * d ;
+		MULT_SUB (X [i], Lx [q], ujk) ;
+	    }
+	    flops += MULTSUB_FLOPS * (Lp [j+1] - Lp [j]) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* discard entries outside the pattern, if they have cancelled */
+	/* ------------------------------------------------------------------ */
+
+	for (p = 0 ; p < nfill ; p++)
+	{
+	    i = Fill [p] ;
+	    APPROX_ABS (rs, X [i]) ;
+	    if (!(rs <= FILL_TOL * Mag [i]))
+	    {
+		status = UMFPACK_ERROR_different_pattern ;
+	    }
+	    CLEAR (X [i]) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* get the pivot and compute column k of L */
+	/* ------------------------------------------------------------------ */
+
+	Dnew [k] = X [k] ;
+	CLEAR (X [k]) ;
+	ABS (d, Dnew [k]) ;
+	umax = MAX (umax, d) ;
+
+	for (p = Lp [k] ; p < Lp [k+1] ; p++)
+	{
+	    i = Li [p] ;
+	    Lx [p] = X [i] ;
+	    Lmag [p] = Mag [i] ;
+	    CLEAR (X [i]) ;
+	}
+	UMF_scale (Lp [k+1] - Lp [k], Dnew [k], Lx + Lp [k]) ;
+	flops += DIV_FLOPS * (Lp [k+1] - Lp [k]) ;
+	for (p = Lp [k] ; p < Lp [k+1] ; p++)
+	{
+	    APPROX_ABS (rs, Lx [p]) ;
+	    Lmag [p] = (d == 0) ? rs : MAX (rs, Lmag [p] / d) ;
+	}
+
+	/* ------------------------------------------------------------------ */
+	/* update the reciprocal pivot growth */
+	/* ------------------------------------------------------------------ */
+
+	if (SCALAR_IS_NONZERO (umax))
+	{
+	    d = amax / umax ;
+	    if (d < rgrowth || SCALAR_IS_NAN (d))
+	    {
+		rgrowth = d ;
+	    }
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* copy the results into the Numeric object */
+    /* ---------------------------------------------------------------------- */
+
+    if (status == UMFPACK_OK)
+    {
+	Entry *D, *Lk ;
+	Int lnz2 = 0, unz2 = 0 ;
+
+	for (k = 0 ; k < n ; k++)
+	{
+	    Lk = Lval [k] ;
+	    for (p = Lp [k] ; p < Lp [k+1] ; p++)
+	    {
+		*Lk++ = Lx [p] ;
+		lnz2 += IS_NONZERO (Lx [p]) ;
+	    }
+	}
+	for (p = 0 ; p < unz ; p++)
+	{
+	    *(Umap [p]) = Ux [p] ;
+	    unz2 += IS_NONZERO (Ux [p]) ;
+	}
+
+	/* find the smallest and largest entries in D, as in UMF_kernel_wrapup */
+	D = Numeric->D ;
+	nnzpiv = 0 ;
+	for (k = 0 ; k < n ; k++)
+	{
+	    Int zero_pivot, nan_pivot ;
+	    D [k] = Dnew [k] ;
+	    ABS (d, D [k]) ;
+	    zero_pivot = SCALAR_IS_ZERO (d) ;
+	    nan_pivot = SCALAR_IS_NAN (d) ;
+	    if (!zero_pivot)
+	    {
+		nnzpiv++ ;
+	    }
+	    if (k == 0)
+	    {
+		Numeric->min_udiag = d ;
+		Numeric->max_udiag = d ;
+	    }
+	    else
+	    {
+		if (SCALAR_IS_NONZERO (Numeric->min_udiag))
+		{
+		    if (zero_pivot || nan_pivot)
+		    {
+			Numeric->min_udiag = d ;
+		    }
+		    else if (!SCALAR_IS_NAN (Numeric->min_udiag))
+		    {
+			Numeric->min_udiag = MIN (Numeric->min_udiag, d) ;
+		    }
+		}
+		if (nan_pivot)
+		{
+		    Numeric->max_udiag = d ;
+		}
+		else if (!SCALAR_IS_NAN (Numeric->max_udiag))
+		{
+		    Numeric->max_udiag = MAX (Numeric->max_udiag, d) ;
+		}
+	    }
+	}
+
+	if (SCALAR_IS_ZERO (Numeric->min_udiag)
+	 || SCALAR_IS_ZERO (Numeric->max_udiag)
+	 ||	SCALAR_IS_NAN (Numeric->min_udiag)
+	 ||	SCALAR_IS_NAN (Numeric->max_udiag))
+	{
+	    /* rcond is zero if there is any zero or NaN on the diagonal */
+	    Numeric->rcond = 0.0 ;
+	}
+	else
+	{
+	    Numeric->rcond = Numeric->min_udiag / Numeric->max_udiag ;
+	}
+
+	if (do_scale)
+	{
+	    for (row = 0 ; row < n ; row++)
+	    {
+		Numeric->Rs [row] = Rs [row] ;
+	    }
+	}
+	Numeric->rsmin = rsmin ;
+	Numeric->rsmax = rsmax ;
+	Numeric->do_recip = do_recip ;
+	Numeric->nnzpiv = nnzpiv ;
+	Numeric->lnz = lnz2 ;
+	Numeric->unz = unz2 ;
+
+	Info [UMFPACK_LNZ] = (double) lnz2 + n ;
+	Info [UMFPACK_UNZ] = (double) unz2 + nnzpiv ;
+	Info [UMFPACK_FLOPS] = flops ;
+	Info [UMFPACK_UDIAG_NZ] = nnzpiv ;
+	Info [UMFPACK_RSMIN] = rsmin ;
+	Info [UMFPACK_RSMAX] = rsmax ;
+	Info [UMFPACK_WAS_SCALED] = Numeric->scale ;
+	Info [UMFPACK_UMIN]  = Numeric->min_udiag ;
+	Info [UMFPACK_UMAX]  = Numeric->max_udiag ;
+	Info [UMFPACK_RCOND] = Numeric->rcond ;
+	Info [UMFPACK_RGROWTH] = rgrowth ;
+
+	if (nnzpiv < n
+	|| SCALAR_IS_ZERO (Numeric->rcond) || SCALAR_IS_NAN (Numeric->rcond))
+	{
+	    /* there are zeros and/or NaN's on the diagonal of U */
+	    status = UMFPACK_WARNING_singular_matrix ;
+	}
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* free the workspace and return the result */
+    /* ---------------------------------------------------------------------- */
+
+    (void) UMF_free ((void *) Iwork) ;
+    (void) UMF_free ((void *) Dwork) ;
+    (void) UMF_free ((void *) Iwork2) ;
+    (void) UMF_free ((void *) Xwork) ;
+    (void) UMF_free ((void *) Pwork) ;
+    (void) UMF_free ((void *) Lmag) ;
+
+    Info [UMFPACK_STATUS] = status ;
+
+    umfpack_toc (stats) ;
+    Info [UMFPACK_NUMERIC_WALLTIME] = stats [0] ;
+    Info [UMFPACK_NUMERIC_TIME] = stats [1] ;
+
+    return (status) ;
+}
+
+
+/* ========================================================================== */
+/* === get_L_pattern ======================================================== */
+/* ========================================================================== */
+
+/*
+    Unpacks the pattern of L into column form, in Lp [0..n] and Li [0..lnz-1],
+    where lnz = Lp [n] is returned.  Only Lp is computed if Li is NULL.  The
+    row indices in each column are in the same order as the numerical values
+    held in Numeric->Memory, and Lval [k] points to the first of the values of
+    column k.  See get_L in umfpack_get_numeric.c for a description of the
+    Lchains.
+*/
+
+PRIVATE Int get_L_pattern
+(
+    NumericType *Numeric,
+    Int Lp [ ],		/* of size n+1 */
+    Int Li [ ],		/* of size lnz, or NULL */
+    Entry **Lval,	/* of size n, or NULL if Li is NULL */
+    Int Pattern [ ]	/* workspace of size n */
+)
+{
+    Int deg, j, k, lp, llen, lnz, pos, npiv, n1, *ip, *Lpos, *Lilen, *Lip ;
+
+    npiv = Numeric->npiv ;
+    n1 = Numeric->n1 ;
+    Lpos = Numeric->Lpos ;
+    Lilen = Numeric->Lilen ;
+    Lip = Numeric->Lip ;
+    lnz = 0 ;
+    deg = 0 ;
+
+    /* singletons */
+    for (k = 0 ; k < n1 ; k++)
+    {
+	deg = Lilen [k] ;
+	Lp [k] = lnz ;
+	if (Li != (Int *) NULL)
+	{
+	    Lval [k] = (Entry *) NULL ;
+	    if (deg > 0)
+	    {
+		lp = Lip [k] ;
+		ip = (Int *) (Numeric->Memory + lp) ;
+		Lval [k] = (Entry *) (Numeric->Memory + lp + UNITS (Int, deg)) ;
+		for (j = 0 ; j < deg ; j++)
+		{
+		    Li [lnz + j] = ip [j] ;
+		}
+	    }
+	}
+	lnz += deg ;
+    }
+
+    /* non-singletons */
+    deg = 0 ;
+    for (k = n1 ; k < npiv ; k++)
+    {
+	lp = Lip [k] ;
+	if (lp < 0)
+	{
+	    /* start of a new Lchain */
+	    lp = -lp ;
+	    deg = 0 ;
+	}
+
+	/* remove pivot row */
+	pos = Lpos [k] ;
+	if (pos != EMPTY)
+	{
+	    ASSERT (pos >= 0 && pos < deg) ;
+	    Pattern [pos] = Pattern [--deg] ;
+	}
+
+	/* concatenate the pattern */
+	ip = (Int *) (Numeric->Memory + lp) ;
+	llen = Lilen [k] ;
+	for (j = 0 ; j < llen ; j++)
+	{
+	    Pattern [deg++] = *ip++ ;
+	}
+
+	Lp [k] = lnz ;
+	if (Li != (Int *) NULL)
+	{
+	    Lval [k] = (Entry *) (Numeric->Memory + lp + UNITS (Int, llen)) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Li [lnz + j] = Pattern [j] ;
+	    }
+	}
+	lnz += deg ;
+    }
+
+    Lp [npiv] = lnz ;
+    return (lnz) ;
+}
+
+
+/* ========================================================================== */
+/* === get_U_pattern ======================================================== */
+/* ========================================================================== */
+
+/*
+    Unpacks the pattern of U into column form, in Up [0..n] and Ui [0..unz-1],
+    where unz = Up [n] is returned.  Only Up is computed if Ui is NULL.  The
+    row indices in each column are in ascending order, and Umap [p] points to
+    the numerical value of the entry held in Numeric->Memory.  See get_U in
+    umfpack_get_numeric.c for a description of the Uchains.  The last row of
+    U is empty, since the matrix is square and Numeric->ulen is zero.
+*/
+
+PRIVATE Int get_U_pattern
+(
+    NumericType *Numeric,
+    Int Up [ ],		/* of size n+1 */
+    Int Ui [ ],		/* of size unz, or NULL */
+    Entry **Umap,	/* of size unz, or NULL if Ui is NULL */
+    Int Pattern [ ],	/* workspace of size n */
+    Int W [ ]		/* workspace of size n */
+)
+{
+    Entry *xp ;
+    Int deg, j, k, p, up, ulen, col, pos, npiv, n1, unz, newUchain, *ip,
+	*Upos, *Uilen, *Uip ;
+
+    npiv = Numeric->npiv ;
+    n1 = Numeric->n1 ;
+    Upos = Numeric->Upos ;
+    Uilen = Numeric->Uilen ;
+    Uip = Numeric->Uip ;
+    ASSERT (Numeric->ulen == 0) ;
+
+    if (Ui == (Int *) NULL)
+    {
+	for (col = 0 ; col < npiv ; col++)
+	{
+	    W [col] = 0 ;
+	}
+    }
+    else
+    {
+	for (col = 0 ; col < npiv ; col++)
+	{
+	    W [col] = Up [col+1] ;
+	}
+    }
+
+    /* non-singletons, in reverse order so that each column is sorted */
+    deg = 0 ;
+    for (k = npiv-1 ; k >= n1 ; k--)
+    {
+	up = Uip [k] ;
+	ulen = Uilen [k] ;
+	newUchain = (up < 0) ;
+	if (newUchain)
+	{
+	    up = -up ;
+	    xp = (Entry *) (Numeric->Memory + up + UNITS (Int, ulen)) ;
+	}
+	else
+	{
+	    xp = (Entry *) (Numeric->Memory + up) ;
+	}
+
+	/* row k of U is in Pattern [0..deg-1] */
+	for (j = 0 ; j < deg ; j++)
+	{
+	    col = Pattern [j] ;
+	    if (Ui == (Int *) NULL)
+	    {
+		W [col]++ ;
+	    }
+	    else
+	    {
+		p = --(W [col]) ;
+		Ui [p] = k ;
+		Umap [p] = xp + j ;
+	    }
+	}
+
+	if (k == n1) break ;
+
+	/* make row k-1 of U in Pattern [0..deg-1] */
+	if (newUchain)
+	{
+	    deg = ulen ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		Pattern [j] = *ip++ ;
+	    }
+	}
+	else
+	{
+	    deg -= ulen ;
+	    ASSERT (deg >= 0) ;
+	    pos = Upos [k] ;
+	    if (pos != EMPTY)
+	    {
+		/* add the pivot column */
+		ASSERT (pos >= 0 && pos <= deg) ;
+		Pattern [deg++] = Pattern [pos] ;
+		Pattern [pos] = k ;
+	    }
+	}
+    }
+
+    /* singletons */
+    for (k = n1 - 1 ; k >= 0 ; k--)
+    {
+	deg = Uilen [k] ;
+	if (deg > 0)
+	{
+	    up = Uip [k] ;
+	    ip = (Int *) (Numeric->Memory + up) ;
+	    xp = (Entry *) (Numeric->Memory + up + UNITS (Int, deg)) ;
+	    for (j = 0 ; j < deg ; j++)
+	    {
+		col = ip [j] ;
+		if (Ui == (Int *) NULL)
+		{
+		    W [col]++ ;
+		}
+		else
+		{
+		    p = --(W [col]) ;
+		    Ui [p] = k ;
+		    Umap [p] = xp + j ;
+		}
+	    }
+	}
+    }
+
+    if (Ui == (Int *) NULL)
+    {
+	/* create the column pointers */
+	unz = 0 ;
+	for (col = 0 ; col < npiv ; col++)
+	{
+	    Up [col] = unz ;
+	    unz += W [col] ;
+	}
+	Up [npiv] = unz ;
+    }
+    return (Up [npiv]) ;
+}
@@ -23,7 +23,8 @@ void UMFPACK_report_control
 )
 {
     double drow, dcol, relpt, relpt2, alloc_init, front_alloc_init, amd_alpha,
-	force_fixQ, droptol, aggr ;
+	force_fixQ, droptol, aggr, nthreads, memory_limit, ilu_droptol,
+	ilu_fill ;
     Int prl, nb, irstep, strategy, scale, s ;
     Int do_singletons, ordering_option ;
 
@@ -339,6 +340,67 @@ void UMFPACK_report_control
     PRINTF (("    "ID": drop tolerance: %g\n",
 	(Int) INDEX (UMFPACK_DROPTOL), droptol)) ;
 
+    /* ---------------------------------------------------------------------- */
+    /* number of threads for independent blocks */
+    /* ---------------------------------------------------------------------- */
+
+    nthreads = GET_CONTROL (UMFPACK_NTHREADS, UMFPACK_DEFAULT_NTHREADS) ;
+    PRINTF (("    "ID": number of threads for independent blocks: %g",
+	(Int) INDEX (UMFPACK_NTHREADS), nthreads)) ;
+    if (nthreads <= 0)
+    {
+	PRINTF ((" (all available)\n")) ;
+    }
+    else if (nthreads < 2)
+    {
+	PRINTF ((" (factorize the matrix as a whole)\n")) ;
+    }
+    else
+    {
+	PRINTF (("\n")) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* memory limit */
+    /* ---------------------------------------------------------------------- */
+
+    memory_limit = GET_CONTROL (UMFPACK_MEMORY_LIMIT,
+	UMFPACK_DEFAULT_MEMORY_LIMIT) ;
+    PRINTF (("    "ID": memory limit for numeric factorization (bytes): %g",
+	(Int) INDEX (UMFPACK_MEMORY_LIMIT), memory_limit)) ;
+    if (memory_limit <= 0)
+    {
+	PRINTF ((" (no limit)\n")) ;
+    }
+    else
+    {
+	PRINTF (("\n")) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* incomplete LU */
+    /* ---------------------------------------------------------------------- */
+
+    ilu_droptol = GET_CONTROL (UMFPACK_ILU_DROPTOL,
+	UMFPACK_DEFAULT_ILU_DROPTOL) ;
+    ilu_fill = GET_CONTROL (UMFPACK_ILU_FILL, UMFPACK_DEFAULT_ILU_FILL) ;
+    PRINTF (("    "ID": incomplete LU drop tolerance: %g\n",
+	(Int) INDEX (UMFPACK_ILU_DROPTOL), ilu_droptol)) ;
+    PRINTF (("    "ID": incomplete LU fill limit: %g",
+	(Int) INDEX (UMFPACK_ILU_FILL), ilu_fill)) ;
+    if (ilu_droptol <= 0 && ilu_fill <= 0)
+    {
+	PRINTF ((" (complete LU factorization)\n")) ;
+    }
+    else if (ilu_fill <= 0)
+    {
+	PRINTF ((" (no limit)\n")) ;
+    }
+    else
+    {
+	PRINTF (("\n")) ;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* aggressive absorption */
     /* ---------------------------------------------------------------------- */
@@ -495,6 +495,8 @@ void UMFPACK_report_info
 	Info [UMFPACK_NUMERIC_REALLOC]) ;
     PRINT_INFO ("    costly numeric factorization reallocations:    %.0f\n",
 	Info [UMFPACK_NUMERIC_COSTLY_REALLOC]) ;
+    PRINT_INFO ("    blocks factorized in parallel:                 %.0f\n",
+	Info [UMFPACK_NUMERIC_NBLOCKS]) ;
     PRINT_INFO ("    numeric factorization wallclock time (sec):    %.2f\n",
 	twnum) ;
 
@@ -107,6 +107,10 @@ void UMFPACK_report_status
 	    PRINTF (("ERROR: blob has invalid contents or wrong size\n")) ;
 	    break ;
 
+        case UMFPACK_ERROR_memory_limit:
+	    PRINTF (("ERROR: memory limit exceeded\n")) ;
+	    break ;
+
 	case UMFPACK_ERROR_internal_error:
 	    PRINTF (("INTERNAL ERROR!\n"
 	    "Input arguments might be corrupted or aliased, or an internal\n"
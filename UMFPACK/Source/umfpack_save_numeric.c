@@ -9,16 +9,25 @@
 
 /*
     User-callable.  Saves a Numeric object to a file.  It can later be read back
-    in via a call to umfpack_*_load_numeric.
+    in via a call to umfpack_*_load_numeric or umfpack_*_load_numeric_mmap.
+    The file holds the same bytes as the blob created by
+    umfpack_*_serialize_numeric, with each part aligned to a multiple of
+    UMF_BLOB_ALIGN bytes (see umf_blob.h).
 */
 
 #include "umf_internal.h"
 #include "umf_valid_numeric.h"
+#include "umf_blob.h"
 
+/* write an object to the file, followed by zeros up to the next multiple of
+ * UMF_BLOB_ALIGN bytes */
 #define WRITE(object,type,n) \
 { \
+    int64_t s = (int64_t) (n) * sizeof (type) ; \
     ASSERT (object != (type *) NULL) ; \
-    if (fwrite (object, sizeof (type), n, f) != (size_t) n) \
+    if (fwrite (object, sizeof (type), n, f) != (size_t) n || \
+	fwrite (zeros, 1, UMF_BLOB_PAD (s) - s, f) != \
+	    (size_t) (UMF_BLOB_PAD (s) - s)) \
     { \
 	fclose (f) ; \
 	return (UMFPACK_ERROR_file_IO) ; \
@@ -39,6 +48,7 @@ int UMFPACK_save_numeric
     NumericType *Numeric ;
     char *filename ;
     FILE *f ;
+    int8_t header [UMF_BLOB_HEADER], zeros [UMF_BLOB_ALIGN] ;
 
     /* get the Numeric object */
     Numeric = (NumericType *) NumericHandle ;
@@ -64,7 +74,11 @@ int UMFPACK_save_numeric
 	return (UMFPACK_ERROR_file_IO) ;
     }
 
-    /* write the Numeric object to the file, in binary */
+    /* write the Numeric object to the file, in binary, in the same form as
+     * UMFPACK_serialize_numeric */
+    memset (zeros, 0, UMF_BLOB_ALIGN) ;
+    UMF_numeric_blob_header (header, UMF_numeric_blobsize (Numeric)) ;
+    WRITE (header,         int8_t, UMF_BLOB_HEADER) ;
     WRITE (Numeric,        NumericType, 1) ;
     WRITE (Numeric->D,     Entry, MIN (Numeric->n_row, Numeric->n_col)+1) ;
     WRITE (Numeric->Rperm, Int,   Numeric->n_row+1) ;
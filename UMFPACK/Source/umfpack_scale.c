@@ -19,10 +19,19 @@
 
     If R not present in the Numeric object, then R = I and no floating-point
     work is done.  B is simply copied into X.
+
+    If OpenMP is used, the vector is split among up to omp_get_max_threads
+    threads, with at least UMF_SCALE_CHUNK entries for each thread.
 */
 
 #include "umf_internal.h"
 #include "umf_valid_numeric.h"
+#include "umf_kernel_init.h"
+
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+#include <omp.h>
+#define PARALLEL_SCALE
+#endif
 
 int UMFPACK_scale
 (
@@ -43,6 +52,9 @@ int UMFPACK_scale
 
     NumericType *Numeric ;
     Int n, i ;
+#ifdef PARALLEL_SCALE
+    Int nthreads ;
+#endif
     double *Rs ;
 #ifdef COMPLEX
     Int split = SPLIT (Xz) && SPLIT (Bz) ;
@@ -62,6 +74,12 @@ int UMFPACK_scale
 	return (UMFPACK_ERROR_argument_missing) ;
     }
 
+#ifdef PARALLEL_SCALE
+    nthreads = omp_get_max_threads ( ) ;
+    nthreads = MIN (nthreads, n / UMF_SCALE_CHUNK) ;
+    nthreads = MAX (nthreads, 1) ;
+#endif
+
     /* ---------------------------------------------------------------------- */
     /* X = R*B or R\B */
     /* ---------------------------------------------------------------------- */
@@ -75,6 +93,9 @@ int UMFPACK_scale
 #ifdef COMPLEX
 	    if (split)
 	    {
+#ifdef PARALLEL_SCALE
+		#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 		for (i = 0 ; i < n ; i++)
 		{
 		    Xx [i] = Bx [i] * Rs [i] ;
@@ -83,6 +104,9 @@ int UMFPACK_scale
 	    }
 	    else
 	    {
+#ifdef PARALLEL_SCALE
+		#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 		for (i = 0 ; i < n ; i++)
 		{
 		    Xx [2*i  ] = Bx [2*i  ] * Rs [i] ;
@@ -90,6 +114,9 @@ int UMFPACK_scale
 		}
 	    }
 #else
+#ifdef PARALLEL_SCALE
+	    #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 	    for (i = 0 ; i < n ; i++)
 	    {
 		Xx [i] = Bx [i] * Rs [i] ;
@@ -103,6 +130,9 @@ int UMFPACK_scale
 #ifdef COMPLEX
 	    if (split)
 	    {
+#ifdef PARALLEL_SCALE
+		#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 		for (i = 0 ; i < n ; i++)
 		{
 		    Xx [i] = Bx [i] / Rs [i] ;
@@ -111,6 +141,9 @@ int UMFPACK_scale
 	    }
 	    else
 	    {
+#ifdef PARALLEL_SCALE
+		#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 		for (i = 0 ; i < n ; i++)
 		{
 		    Xx [2*i  ] = Bx [2*i  ] / Rs [i] ;
@@ -118,6 +151,9 @@ int UMFPACK_scale
 		}
 	    }
 #else
+#ifdef PARALLEL_SCALE
+	    #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 	    for (i = 0 ; i < n ; i++)
 	    {
 		Xx [i] = Bx [i] / Rs [i] ;
@@ -131,6 +167,9 @@ int UMFPACK_scale
 #ifdef COMPLEX
         if (split)
 	{
+#ifdef PARALLEL_SCALE
+	    #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 	    for (i = 0 ; i < n ; i++)
 	    {
 		Xx [i] = Bx [i] ;
@@ -139,6 +178,9 @@ int UMFPACK_scale
 	}
 	else
 	{
+#ifdef PARALLEL_SCALE
+	    #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 	    for (i = 0 ; i < n ; i++)
 	    {
 		Xx [2*i  ] = Bx [2*i  ] ;
@@ -146,6 +188,9 @@ int UMFPACK_scale
 	    }
 	}
 #else
+#ifdef PARALLEL_SCALE
+	#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
 	for (i = 0 ; i < n ; i++)
 	{
 	    Xx [i] = Bx [i] ;
@@ -10,12 +10,21 @@
 /*
     User-callable.  Saves a Numeric object to a single int8_t array of bytes
     (the "blob").  It can later be read back to reconstruct the Numeric object
-    via a call to umfpack_*_deserialize_numeric.
+    via a call to umfpack_*_deserialize_numeric, or used in place via
+    umfpack_*_deserialize_numeric_view.  Each part of the blob is aligned to a
+    multiple of UMF_BLOB_ALIGN bytes (see umf_blob.h).
+    umfpack_*_serialize_numeric_compressed creates a compressed blob instead
+    (see umf_compress.h), which umfpack_*_deserialize_numeric also accepts
+    (but which cannot be used in place).
     Initial contribution by Will Kimmerer (MIT); revised by Tim Davis.
 */
 
 #include "umf_internal.h"
 #include "umf_valid_numeric.h"
+#include "umf_blob.h"
+#include "umf_compress.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
 
 //------------------------------------------------------------------------------
 // UMFPACK_serialize_numeric_size: return size of blob for a Numeric object
@@ -44,36 +53,9 @@ int UMFPACK_serialize_numeric_size
 	return (UMFPACK_ERROR_invalid_Numeric_object) ;
     }
 
-    // blob header
-    (*blobsize) += sizeof (int64_t) + 10 * sizeof (int32_t) ;
-
-    // Numeric header struct:
-    (*blobsize) += sizeof (NumericType) ;
-
-    // Lpos, Lilen, Lip, Upos, Uilen, and Uip:
-    (*blobsize) += 6*(Numeric->npiv+1) * sizeof (Int) ;
-
-    // Rperm and Cperm:
-    (*blobsize) += (Numeric->n_row+1) * sizeof (Int) ;
-    (*blobsize) += (Numeric->n_col+1) * sizeof (Int) ;
-
-    // D:
-    Int n_inner = MIN (Numeric->n_row, Numeric->n_col) ;
-    (*blobsize) += (n_inner+1) * sizeof (Entry) ;
-
-    // Rs, if present:
-    if (Numeric->scale != UMFPACK_SCALE_NONE)
-    {
-        (*blobsize) += (Numeric->n_row) * sizeof (double) ;
-    }
-    // Upattern, if present:
-    if (Numeric->ulen > 0)
-    {
-        (*blobsize) += (Numeric->ulen+1) * sizeof (Int) ;
-    }
-
-    // Numeric->Memory
-    (*blobsize) += (Numeric->size) * sizeof (Unit) ;
+    // blob header, Numeric struct, and arrays, each padded to a multiple
+    // of UMF_BLOB_ALIGN bytes
+    (*blobsize) = UMF_numeric_blobsize (Numeric) ;
 
     return (UMFPACK_OK) ;
 }
@@ -84,14 +66,10 @@ int UMFPACK_serialize_numeric_size
 
 #define SERIALIZE(object, type, n)                          \
 {                                                           \
-    memcpy (blob + offset, object, (n) * sizeof (type)) ;   \
-    offset += (n) * sizeof (type) ;                         \
-}
-
-#define SERIALIZE_INT32(x)                                  \
-{                                                           \
-    int32_t scalar = (int32_t) (x) ;                        \
-    SERIALIZE (&scalar, int32_t, 1) ;                       \
+    int64_t s = (int64_t) (n) * sizeof (type) ;             \
+    memcpy (blob + offset, object, s) ;                     \
+    memset (blob + offset + s, 0, UMF_BLOB_PAD (s) - s) ;   \
+    offset += UMF_BLOB_PAD (s) ;                            \
 }
 
 int UMFPACK_serialize_numeric
@@ -125,18 +103,8 @@ int UMFPACK_serialize_numeric
     NumericType *Numeric = (NumericType *) NumericHandle ;
 
     // write the blob header:
-    int64_t offset = 0 ;
-    SERIALIZE (&required, int64_t, 1) ;         // required size of this blob
-    SERIALIZE_INT32 (NUMERIC_VALID) ;           // tag as a Numeric object
-    SERIALIZE_INT32 (UMFPACK_MAIN_VERSION) ;    // gaurd against version changes
-    SERIALIZE_INT32 (UMFPACK_SUB_VERSION) ;
-    SERIALIZE_INT32 (UMFPACK_SUBSUB_VERSION) ;
-    SERIALIZE_INT32 (sizeof (NumericType)) ;    // size of Numeric header
-    SERIALIZE_INT32 (sizeof (Entry)) ;          // double or double complex
-    SERIALIZE_INT32 (sizeof (Int)) ;            // Int is int32_t or int64_t
-    SERIALIZE_INT32 (sizeof (Unit)) ;
-    SERIALIZE_INT32 (sizeof (double)) ;
-    SERIALIZE_INT32 (sizeof (void *)) ;         // 32-bit vs 64-bit OS
+    int64_t offset = UMF_BLOB_HEADER ;
+    UMF_numeric_blob_header (blob, required) ;
 
     // write the Numeric object to the blob
     Int n_inner = MIN (Numeric->n_row, Numeric->n_col) ;
@@ -168,3 +136,89 @@ int UMFPACK_serialize_numeric
     return (UMFPACK_OK) ;
 }
 
+//------------------------------------------------------------------------------
+// UMFPACK_serialize_numeric_compressed_size: bound on size of compressed blob
+//------------------------------------------------------------------------------
+
+int UMFPACK_serialize_numeric_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *NumericHandle,        // input: Numeric object to serialize
+    int method                  // input: compression method
+)
+{
+
+    // check inputs
+    if (blobsize == NULL)
+    {
+        return (UMFPACK_ERROR_argument_missing) ;
+    }
+    (*blobsize) = 0 ;
+
+    // get the size of the uncompressed blob
+    int64_t size ;
+    int status = UMFPACK_serialize_numeric_size (&size, NumericHandle) ;
+    if (status != UMFPACK_OK)
+    {
+        // Numeric object is invalid or NULL
+        return (status) ;
+    }
+
+    // the compressed blob is no larger than this:
+    (*blobsize) = umf_compressed_blobsize (size, method) ;
+    return (UMFPACK_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// UMFPACK_serialize_numeric_compressed: compressed blob of a Numeric object
+//------------------------------------------------------------------------------
+
+// The Numeric object is first serialized into a temporary blob, which is then
+// compressed into the output blob, one block at a time.
+
+int UMFPACK_serialize_numeric_compressed
+(
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *NumericHandle,    // input: Numeric object to serialize
+    int method              // input: compression method
+)
+{
+
+    // check inputs
+    if (blob == NULL || blobsize == NULL)
+    {
+        return (UMFPACK_ERROR_argument_missing) ;
+    }
+    int64_t size ;
+    int status = UMFPACK_serialize_numeric_size (&size, NumericHandle) ;
+    if (status != UMFPACK_OK)
+    {
+        // Numeric object is invalid or NULL
+        return (status) ;
+    }
+    if (umf_compressed_blobsize (size, method) > (*blobsize))
+    {
+        // blob is not large enough
+        return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    // serialize the Numeric object into a temporary blob
+    Int nunits = (Int) UNITS (int8_t, size) ;
+    int8_t *plain = (int8_t *) UMF_malloc (nunits, sizeof (Unit)) ;
+    if (plain == (int8_t *) NULL)
+    {
+        return (UMFPACK_ERROR_out_of_memory) ;
+    }
+    status = UMFPACK_serialize_numeric (plain, size, NumericHandle) ;
+
+    // compress it into the output blob
+    if (status == UMFPACK_OK)
+    {
+        status = umf_compress_blob (blob, blobsize, plain, size, method) ;
+    }
+    (void) UMF_free ((void *) plain) ;
+    return (status) ;
+}
@@ -11,11 +11,16 @@
     User-callable.  Saves a Symbolic object to a single int8_t array of bytes
     (the "blob").  It can later be read back to reconstruct the Symbolic object
     via a call to umfpack_*_deserialize_symbolic.
+    umfpack_*_serialize_symbolic_compressed creates a compressed blob instead
+    (see umf_compress.h), which umfpack_*_deserialize_symbolic also accepts.
     Initial contribution by Will Kimmerer (MIT); revised by Tim Davis.
 */
 
 #include "umf_internal.h"
 #include "umf_valid_symbolic.h"
+#include "umf_compress.h"
+#include "umf_malloc.h"
+#include "umf_free.h"
 
 //------------------------------------------------------------------------------
 // UMFPACK_serialize_symbolic_size: return size of blob for a Symbolic object
@@ -162,3 +167,89 @@ int UMFPACK_serialize_symbolic
     return (UMFPACK_OK) ;
 }
 
+//------------------------------------------------------------------------------
+// UMFPACK_serialize_symbolic_compressed_size: bound on size of compressed blob
+//------------------------------------------------------------------------------
+
+int UMFPACK_serialize_symbolic_compressed_size
+(
+    int64_t *blobsize,          // output: upper bound on size of the blob
+    void *SymbolicHandle,       // input: Symbolic object to serialize
+    int method                  // input: compression method
+)
+{
+
+    // check inputs
+    if (blobsize == NULL)
+    {
+        return (UMFPACK_ERROR_argument_missing) ;
+    }
+    (*blobsize) = 0 ;
+
+    // get the size of the uncompressed blob
+    int64_t size ;
+    int status = UMFPACK_serialize_symbolic_size (&size, SymbolicHandle) ;
+    if (status != UMFPACK_OK)
+    {
+        // Symbolic object is invalid or NULL
+        return (status) ;
+    }
+
+    // the compressed blob is no larger than this:
+    (*blobsize) = umf_compressed_blobsize (size, method) ;
+    return (UMFPACK_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// UMFPACK_serialize_symbolic_compressed: compressed blob of a Symbolic object
+//------------------------------------------------------------------------------
+
+// The Symbolic object is first serialized into a temporary blob, which is then
+// compressed into the output blob, one block at a time.
+
+int UMFPACK_serialize_symbolic_compressed
+(
+    int8_t *blob,           // output: compressed blob, allocated but
+                            // unitialized on input.
+    int64_t *blobsize,      // input: size of the blob; output: size of the
+                            // compressed blob
+    void *SymbolicHandle,   // input: Symbolic object to serialize
+    int method              // input: compression method
+)
+{
+
+    // check inputs
+    if (blob == NULL || blobsize == NULL)
+    {
+        return (UMFPACK_ERROR_argument_missing) ;
+    }
+    int64_t size ;
+    int status = UMFPACK_serialize_symbolic_size (&size, SymbolicHandle) ;
+    if (status != UMFPACK_OK)
+    {
+        // Symbolic object is invalid or NULL
+        return (status) ;
+    }
+    if (umf_compressed_blobsize (size, method) > (*blobsize))
+    {
+        // blob is not large enough
+        return (UMFPACK_ERROR_invalid_blob) ;
+    }
+
+    // serialize the Symbolic object into a temporary blob
+    Int nunits = (Int) UNITS (int8_t, size) ;
+    int8_t *plain = (int8_t *) UMF_malloc (nunits, sizeof (Unit)) ;
+    if (plain == (int8_t *) NULL)
+    {
+        return (UMFPACK_ERROR_out_of_memory) ;
+    }
+    status = UMFPACK_serialize_symbolic (plain, size, SymbolicHandle) ;
+
+    // compress it into the output blob
+    if (status == UMFPACK_OK)
+    {
+        status = umf_compress_blob (blob, blobsize, plain, size, method) ;
+    }
+    (void) UMF_free ((void *) plain) ;
+    return (status) ;
+}
@@ -49,17 +49,17 @@ UMFPACK_solve
     int sys,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
-    double Xx [ ],
+    Scalar Xx [ ],
 #ifdef COMPLEX
-    double Xz [ ],
+    Scalar Xz [ ],
 #endif
-    const double Bx [ ],
+    const Scalar Bx [ ],
 #ifdef COMPLEX
-    const double Bz [ ],
+    const Scalar Bz [ ],
 #endif
     void *NumericHandle,
     const double Control [UMFPACK_CONTROL],
@@ -20,9 +20,9 @@ int UMFPACK_symbolic
     Int n_col,
     const Int Ap [ ],
     const Int Ai [ ],
-    const double Ax [ ],
+    const Scalar Ax [ ],
 #ifdef COMPLEX
-    const double Az [ ],
+    const Scalar Az [ ],
 #endif
     void **SymbolicHandle,
     const double Control [UMFPACK_CONTROL],
@@ -14,8 +14,12 @@
     The complex version can do transpose (') or array transpose (.').
 
     Dynamic memory usage: A single call to UMF_malloc is made, for a workspace
-    of size max (n_row,n_col,1) * sizeof(Int).  This is then free'd on return,
-    via UMF_free.
+    of size max (n_row,n_col,nthreads*n_row,1) * sizeof(Int).  This is then
+    free'd on return, via UMF_free.
+
+    If OpenMP is used, the work is split among nthreads threads, up to
+    omp_get_max_threads, with at least UMF_TRANSPOSE_CHUNK entries of A for
+    each thread.  The result is the same for any number of threads.
 */
 
 #include "umf_internal.h"
@@ -23,6 +27,11 @@
 #include "umf_malloc.h"
 #include "umf_free.h"
 
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+#include <omp.h>
+#define PARALLEL_TRANSPOSE
+#endif
+
 #ifndef NDEBUG
 PRIVATE Int init_count ;
 #endif
@@ -63,7 +72,7 @@ int UMFPACK_transpose
     /* local variables */
     /* ---------------------------------------------------------------------- */
 
-    Int *W, nn ;
+    Int *W, nn, nthreads ;
     int status ;
 
 #ifndef NDEBUG
@@ -75,7 +84,22 @@ int UMFPACK_transpose
     /* allocate workspace */
     /* ---------------------------------------------------------------------- */
 
+    nthreads = 1 ;
+#ifdef PARALLEL_TRANSPOSE
+    if (Ap != (Int *) NULL && n_row > 0 && n_col > 0)
+    {
+	/* give each thread at least UMF_TRANSPOSE_CHUNK entries, and keep the
+	   size of the per-thread workspace below nz */
+	Int nz = Ap [n_col] ;
+	nthreads = omp_get_max_threads ( ) ;
+	nthreads = MIN (nthreads, nz / UMF_TRANSPOSE_CHUNK) ;
+	nthreads = MIN (nthreads, nz / n_row) ;
+	nthreads = MAX (nthreads, 1) ;
+    }
+#endif
+
     nn = MAX (n_row, n_col) ;
+    nn = MAX (nn, nthreads * n_row) ;
     nn = MAX (nn, 1) ;
     W = (Int *) UMF_malloc (nn, sizeof (Int)) ;
     if (!W)
@@ -91,7 +115,7 @@ int UMFPACK_transpose
     /* ---------------------------------------------------------------------- */
 
     status = UMF_transpose (n_row, n_col, Ap, Ai, Ax, P, Q, n_col, Rp, Ri, Rx,
-	W, TRUE
+	W, nthreads, TRUE
 #ifdef COMPLEX
 	, Az, Rz, do_conjugate
 #endif
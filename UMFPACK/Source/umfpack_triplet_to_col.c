@@ -31,6 +31,11 @@
 	For the complex version, additional space is allocated.
 
 	An extra array of size nz*sizeof(Int) is allocated if Map is present.
+
+	If OpenMP is used, the work is split among up to omp_get_max_threads
+	threads, with at least UMF_TRIPLET_CHUNK triplets for each thread.
+	Each thread t > 0 adds MAX (n_row,n_col) * sizeof (Int) to the size of
+	the workspace W.  The result is the same for any number of threads.
 */
 
 #include "umf_internal.h"
@@ -38,6 +43,11 @@
 #include "umf_free.h"
 #include "umf_triplet.h"
 
+#if defined (_OPENMP) && defined (NDEBUG) && !defined (UMF_TCOV_TEST)
+#include <omp.h>
+#define PARALLEL_TRIPLET
+#endif
+
 #ifndef NDEBUG
 PRIVATE Int init_count ;
 #endif
@@ -69,7 +79,7 @@ int UMFPACK_triplet_to_col
     /* local variables */
     /* ---------------------------------------------------------------------- */
 
-    Int *RowCount, *Rp, *Rj, *W, nn, do_values, do_map, *Map2 ;
+    Int *RowCount, *Rp, *Rj, *W, nn, do_values, do_map, *Map2, nthreads ;
     int status ;
     double *Rx ;
 #ifdef COMPLEX
@@ -103,6 +113,20 @@ int UMFPACK_triplet_to_col
 
     nn = MAX (n_row, n_col) ;
 
+    /* ---------------------------------------------------------------------- */
+    /* determine the number of threads to use */
+    /* ---------------------------------------------------------------------- */
+
+    nthreads = 1 ;
+#ifdef PARALLEL_TRIPLET
+    nthreads = omp_get_max_threads ( ) ;
+    /* give each thread at least UMF_TRIPLET_CHUNK triplets, and keep the size
+       of the per-thread workspace below nz */
+    nthreads = MIN (nthreads, nz / UMF_TRIPLET_CHUNK) ;
+    nthreads = MIN (nthreads, nz / nn) ;
+    nthreads = MAX (nthreads, 1) ;
+#endif
+
     /* ---------------------------------------------------------------------- */
     /* allocate workspace */
     /* ---------------------------------------------------------------------- */
@@ -153,7 +177,7 @@ int UMFPACK_triplet_to_col
     Rj = (Int *) UMF_malloc (nz+1, sizeof (Int)) ;
     Rp = (Int *) UMF_malloc (n_row+1, sizeof (Int)) ;
     RowCount = (Int *) UMF_malloc (n_row, sizeof (Int)) ;
-    W = (Int *) UMF_malloc (nn, sizeof (Int)) ;
+    W = (Int *) UMF_malloc (nthreads * nn, sizeof (Int)) ;
     if (!Rj || !Rp || !RowCount || !W)
     {
 	DEBUGm4 (("out of memory: triplet work (int)\n")) ;
@@ -179,7 +203,7 @@ int UMFPACK_triplet_to_col
 	if (do_values)
 	{
 	    status = UMF_triplet_map_x (n_row, n_col, nz, Ti, Tj, Ap, Ai, Rp,
-		Rj, W, RowCount, Tx, Ax, Rx
+		Rj, W, RowCount, nthreads, Tx, Ax, Rx
 #ifdef COMPLEX
 		, Tz, Az, Rz
 #endif
@@ -188,7 +212,7 @@ int UMFPACK_triplet_to_col
 	else
 	{
 	    status = UMF_triplet_map_nox (n_row, n_col, nz, Ti, Tj, Ap, Ai, Rp,
-		Rj, W, RowCount, Map, Map2) ;
+		Rj, W, RowCount, nthreads, Map, Map2) ;
 	}
     }
     else
@@ -196,7 +220,7 @@ int UMFPACK_triplet_to_col
 	if (do_values)
 	{
 	    status = UMF_triplet_nomap_x (n_row, n_col, nz, Ti, Tj, Ap, Ai, Rp,
-		Rj, W, RowCount , Tx, Ax, Rx
+		Rj, W, RowCount, nthreads, Tx, Ax, Rx
 #ifdef COMPLEX
 		, Tz, Az, Rz
 #endif
@@ -205,7 +229,7 @@ int UMFPACK_triplet_to_col
 	else
 	{
 	    status = UMF_triplet_nomap_nox (n_row, n_col, nz, Ti, Tj, Ap, Ai,
-		Rp, Rj, W, RowCount) ;
+		Rp, Rj, W, RowCount, nthreads) ;
 	}
     }
 
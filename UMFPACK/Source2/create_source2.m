@@ -7,7 +7,7 @@
 clear all
 
 UMFCH = {
-   'umf_assemble', 'umf_blas3_update', 'umf_build_tuples', ...
+   'umf_assemble', 'umf_blas3_update', 'umf_blob', 'umf_build_tuples', ...
    'umf_create_element', ...
    'umf_dump', 'umf_extend_front', 'umf_garbage_collection', ...
    'umf_get_memory', ...
@@ -15,6 +15,7 @@ UMFCH = {
    'umf_local_search', 'umf_lsolve', 'umf_ltsolve', 'umf_mem_alloc_element', ...
    'umf_mem_alloc_head_block', 'umf_mem_alloc_tail_block', ...
    'umf_mem_free_tail_block', 'umf_mem_init_memoryspace', ...
+   'umf_msolve', 'umf_parallel_numeric', ...
    'umf_report_vector', 'umf_row_search', 'umf_scale_column', ...
    'umf_set_stats', 'umf_solve', 'umf_symbolic_usage', 'umf_transpose', ...
    'umf_tuple_lengths', 'umf_usolve', 'umf_utsolve', 'umf_valid_numeric', ...
@@ -40,11 +41,13 @@ UMFPACK = {
    'umfpack_col_to_triplet', 'umfpack_defaults', 'umfpack_free_numeric', ...
    'umfpack_free_symbolic', 'umfpack_get_numeric', 'umfpack_get_lunz', ...
    'umfpack_get_symbolic', 'umfpack_get_determinant', 'umfpack_numeric', ...
+   'umfpack_refactor', ...
    'umfpack_qsymbolic', 'umfpack_report_control', 'umfpack_report_info', ...
    'umfpack_report_matrix', 'umfpack_report_numeric', 'umfpack_report_perm', ...
    'umfpack_report_status', 'umfpack_report_symbolic', ...
    'umfpack_report_triplet', ...
-   'umfpack_report_vector', 'umfpack_solve', 'umfpack_symbolic', ...
+   'umfpack_report_vector', 'umfpack_solve', 'umfpack_msolve', ...
+   'umfpack_symbolic', ...
    'umfpack_transpose', 'umfpack_triplet_to_col', 'umfpack_scale', ...
    'umfpack_load_numeric', 'umfpack_save_numeric', 'umfpack_copy_numeric', ...
    'umfpack_serialize_numeric', 'umfpack_deserialize_numeric', ...
@@ -57,7 +60,17 @@ UMFPACKW = { 'umfpack_wsolve' }'
 
 UMFUSER = [UMFPACKW ; UMFPACK ]
 
-GENERIC = { 'umfpack_timer', 'umfpack_tictoc' }'
+% the single precision versions include just the factorization and solve
+UMFCH_SINGLE = [ UMFCH(~strcmp (UMFCH, 'umf_msolve')) ; { 'umf_solve_mixed' } ]
+
+UMFPACK_SINGLE = {
+   'umfpack_symbolic', 'umfpack_qsymbolic', 'umfpack_numeric', ...
+   'umfpack_solve', 'umfpack_solve_mixed', 'umfpack_free_symbolic', ...
+   'umfpack_free_numeric'
+}'
+
+GENERIC = { 'umfpack_timer', 'umfpack_tictoc', 'umf_compress', 'umf_lz4', ...
+    'umf_zstd' }'
 
 %-------------------------------------------------------------------------------
 % four versions of each file (di, dl, zi, zl):
@@ -225,6 +238,57 @@ for kk = 1:length (kinds)
     fclose (f) ;
 end
 
+%-------------------------------------------------------------------------------
+% four single precision versions of each file (si, sl, ci, cl):
+%-------------------------------------------------------------------------------
+
+kinds = { 'si', 'sl', 'ci', 'cl' } ;
+defs1 = { 'SINT', 'SLONG', 'CINT', 'CLONG' } ;
+whats = { 'single int32_t', 'single int64_t', ...
+    'single complex int32_t', 'single complex int64_t' } ;
+
+% each file: { file, name of the new file, additional #define }
+U = [UMFCH_SINGLE ; UMFPACK_SINGLE ] ;
+files = cell (length (U) + 4, 3) ;
+for k = 1:length (U)
+    file = U {k} ;
+    if (isequal (file (1:4), 'umf_'))
+        files (k,:) = { file, [file(1:4), '%s', file(4:end), '.c' ], '' } ;
+    else
+        files (k,:) = { file, [file(1:8), '%s', file(8:end), '.c' ], '' } ;
+    end
+end
+files (end-3,:) = { 'umf_ltsolve',  'umf_%s_lhsolve.c',       'CONJUGATE_SOLVE' };
+files (end-2,:) = { 'umf_utsolve',  'umf_%s_uhsolve.c',       'CONJUGATE_SOLVE' };
+files (end-1,:) = { 'umf_assemble', 'umf_%s_assemble_fixq.c', 'FIXQ' } ;
+files (end  ,:) = { 'umf_store_lu', 'umf_%s_store_lu_drop.c', 'DROP' } ;
+
+for k = 1:size (files, 1)
+    file = files {k,1} ;
+    for kk = 1:length (kinds)
+        kind = kinds {kk} ;
+        what = whats {kk} ;
+        newfile = sprintf (files {k,2}, kind) ;
+        fprintf ('%s\n', newfile) ;
+        f = fopen (newfile, 'w') ;
+        fprintf (f, '//------------------------------------------------------------------------------\n') ;
+        fprintf (f, '// UMFPACK/Source2/%s:\n// %s version of %s\n', ...
+            newfile, what, file) ;
+        fprintf (f, '//------------------------------------------------------------------------------\n') ;
+        fprintf (f, '\n') ;
+        fprintf (f, '// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.\n') ;
+        fprintf (f, '// SPDX-License-Identifier: GPL-2.0+\n') ;
+        fprintf (f, '\n') ;
+        fprintf (f, '#define %s\n', defs1 {kk}) ;
+        if (~isempty (files {k,3}))
+            fprintf (f, '#define %s\n', files {k,3}) ;
+        end
+        fprintf (f, '#include "%s.c"\n', file) ;
+        fprintf (f, '\n') ;
+        fclose (f) ;
+    end
+end
+
 %-------------------------------------------------------------------------------
 % two versions of each file (i, l):
 %-------------------------------------------------------------------------------
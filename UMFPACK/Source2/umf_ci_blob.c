@@ -0,0 +1,11 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_ci_blob.c:
+// single complex int32_t version of umf_blob
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#define CINT
+#include "umf_blob.c"
+
@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_ci_lhsolve.c:
+// single complex int32_t version of umf_ltsolve
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#define CINT
+#define CONJUGATE_SOLVE
+#include "umf_ltsolve.c"
+
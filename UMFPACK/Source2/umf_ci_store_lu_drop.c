@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_ci_store_lu_drop.c:
+// single complex int32_t version of umf_store_lu
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#define CINT
+#define DROP
+#include "umf_store_lu.c"
+
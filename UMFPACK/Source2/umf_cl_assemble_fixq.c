@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_cl_assemble_fixq.c:
+// single complex int64_t version of umf_assemble
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) 2005-2023, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#define CLONG
+#define FIXQ
+#include "umf_assemble.c"
+
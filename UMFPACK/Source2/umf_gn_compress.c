@@ -0,0 +1,10 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_gn_compress.c:
+// generic version of umf_compress
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#include "umf_compress.c"
+
@@ -0,0 +1,10 @@
+//------------------------------------------------------------------------------
+// UMFPACK/Source2/umf_gn_zstd.c:
+// generic version of umf_zstd
+//------------------------------------------------------------------------------
+
+// UMFPACK, Copyright (c) Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+#include "umf_zstd.c"
+
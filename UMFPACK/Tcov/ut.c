@@ -30,6 +30,8 @@
 #include "umf_free.h"
 #include "umf_malloc.h"
 #include "umf_cholmod.h"
+#include "umf_msolve.h"
+#include "umf_blob.h"
 
 /*
 #if defined (UMF_MALLOC_COUNT) || !defined (NDEBUG)
@@ -39,6 +41,17 @@
 
 #define TOL 1e-3
 
+/* the single precision counterpart of the version being tested */
+#if defined (DINT)
+#define UMFPACK_SINGLE(name) umfpack_si_ ## name
+#elif defined (DLONG)
+#define UMFPACK_SINGLE(name) umfpack_sl_ ## name
+#elif defined (ZINT)
+#define UMFPACK_SINGLE(name) umfpack_ci_ ## name
+#else
+#define UMFPACK_SINGLE(name) umfpack_cl_ ## name
+#endif
+
 #define INULL ((Int *) NULL)
 #define DNULL ((double *) NULL)
 
@@ -191,6 +204,39 @@ static void error (char *s, double x)
     exit (1) ;
 }
 
+/* ========================================================================== */
+/* malloc_fail_off, malloc_fail_on: turn simulated malloc failures off and on */
+/* ========================================================================== */
+
+/* Tests that must not be interrupted by the simulated malloc and realloc
+ * failures turn them off, and restore them when done. */
+
+static void malloc_fail_off (int save [6])
+{
+    save [0] = umf_fail ;
+    save [1] = umf_fail_lo ;
+    save [2] = umf_fail_hi ;
+    save [3] = umf_realloc_fail ;
+    save [4] = umf_realloc_lo ;
+    save [5] = umf_realloc_hi ;
+    umf_fail = -1 ;
+    umf_fail_lo = 0 ;
+    umf_fail_hi = 0 ;
+    umf_realloc_fail = -1 ;
+    umf_realloc_lo = 0 ;
+    umf_realloc_hi = 0 ;
+}
+
+static void malloc_fail_on (int save [6])
+{
+    umf_fail = save [0] ;
+    umf_fail_lo = save [1] ;
+    umf_fail_hi = save [2] ;
+    umf_realloc_fail = save [3] ;
+    umf_realloc_lo = save [4] ;
+    umf_realloc_hi = save [5] ;
+}
+
 /* ========================================================================== */
 /* resid: compute the (possibly permuted) residual.  return maxnorm of resid */
 /* ========================================================================== */
@@ -1998,6 +2044,39 @@ static double do_symnum
         Symbolic_copy = NULL ;
     }
 
+    // serialize into a compressed blob
+    {
+        int64_t C_blobsize, C_size ;
+        int8_t *C_blob ;
+        status = UMFPACK_serialize_symbolic_compressed_size (&C_blobsize,
+            Symbolic, UMFPACK_COMPRESSION_DEFAULT) ;
+        if (status != UMFPACK_OK)
+        {
+            error ("UMFPACK_serialize_symbolic_compressed_size failed", 0.) ;
+        }
+        C_blob = malloc (C_blobsize) ;
+        if (!C_blob)
+        {
+            error ("out of memory (compressed symbolic blob)\n", 0.) ;
+        }
+        C_size = C_blobsize ;
+        status = UMFPACK_serialize_symbolic_compressed (C_blob, &C_size,
+            Symbolic, UMFPACK_COMPRESSION_DEFAULT) ;
+        if (status != UMFPACK_OK || C_size > C_blobsize)
+        {
+            error ("UMFPACK_serialize_symbolic_compressed failed", 0.) ;
+        }
+        status = UMFPACK_deserialize_symbolic (&Symbolic_copy, C_blob, C_size) ;
+        if (status != UMFPACK_OK)
+        {
+            error ("deserialize compressed symbolic failed\n", 0.) ;
+        }
+        UMFPACK_free_symbolic (&Symbolic) ;
+        Symbolic = Symbolic_copy ;
+        Symbolic_copy = NULL ;
+        free (C_blob) ;
+    }
+
     free (S_blob) ;
 
     /* ---------------------------------------------------------------------- */
@@ -2178,6 +2257,53 @@ static double do_symnum
         error ("load numeric failed\n", 0.) ;
     }
 
+    /* use the file in place, and compare with the loaded Numeric object */
+    if (n_row == n_col)
+    {
+        void *Numeric_mmap = NULL ;
+        double *x1, *x1z = DNULL, *x2, *x2z = DNULL ;
+        Int e = 1, sz = FALSE, status1, status2 ;
+        int save [6] ;
+#ifdef COMPLEX
+        if (!split) e = 2 ;
+        sz = split ;
+#endif
+        malloc_fail_off (save) ;
+        status = UMFPACK_load_numeric_mmap (&Numeric_mmap, "n.umf") ;
+        if (status != UMFPACK_OK)
+        {
+            error ("load numeric mmap failed\n", 0.) ;
+        }
+        x1 = (double *) malloc (e*n * sizeof (double)) ;
+        x2 = (double *) malloc (e*n * sizeof (double)) ;
+        if (sz) x1z = (double *) malloc (n * sizeof (double)) ;
+        if (sz) x2z = (double *) malloc (n * sizeof (double)) ;
+        if (!x1 || !x2 || (sz && (!x1z || !x2z)))
+        {
+            error ("out of memory: mmap\n", 0.) ;
+        }
+        status1 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x1,x1z),
+            CARG(b,bz), Numeric, Control, Info) ;
+        status2 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x2,x2z),
+            CARG(b,bz), Numeric_mmap, Control, Info) ;
+        if (status1 != status2) error ("solve with mmap: status\n", 0.) ;
+        if (status1 >= 0)
+        {
+            /* same factors, same solve: the results must be identical */
+            if (memcmp (x1, x2, e*n * sizeof (double)) != 0 ||
+                (sz && memcmp (x1z, x2z, n * sizeof (double)) != 0))
+            {
+                error ("solve with mmap: wrong solution\n", 0.) ;
+            }
+        }
+        free (x1) ;
+        free (x1z) ;
+        free (x2) ;
+        free (x2z) ;
+        UMFPACK_free_numeric (&Numeric_mmap) ;
+        malloc_fail_on (save) ;
+    }
+
     if (n < 15)
     {
         int umf_fail_save [3], memcnt ;
@@ -2448,6 +2574,130 @@ static double do_symnum
         Numeric_copy = NULL ;
     }
 
+    // use the blob in place
+    status = UMFPACK_deserialize_numeric_view (&Numeric_copy, N_blob,
+        N_blobsize - 1) ;
+    if (status != UMFPACK_ERROR_invalid_blob)
+    {
+        error ("deserialize numeric view should have failed\n", 0.) ;
+    }
+    status = UMFPACK_deserialize_numeric_view (&Numeric_copy, N_blob,
+        N_blobsize) ;
+    if (status != UMFPACK_OK)
+    {
+        error ("deserialize numeric view failed\n", 0.) ;
+    }
+    {
+        /* a copy of the view owns its memory; Numeric is left unchanged */
+        void *Numeric_view = Numeric_copy ;
+        int save [6] ;
+        Numeric_copy = NULL ;
+        malloc_fail_off (save) ;
+        status = UMFPACK_copy_numeric (&Numeric_copy, Numeric_view) ;
+        if (status != UMFPACK_OK)
+        {
+            error ("copy numeric view failed\n", 0.) ;
+        }
+        UMFPACK_free_numeric (&Numeric_view) ;
+        if (Numeric_view != NULL)
+        {
+            error ("free numeric view failed\n", 0.) ;
+        }
+        if (n_row == n_col)
+        {
+            double *x1, *x1z = DNULL, *x2, *x2z = DNULL ;
+            Int e = 1, sz = FALSE, status1, status2 ;
+#ifdef COMPLEX
+            if (!split) e = 2 ;
+            sz = split ;
+#endif
+            x1 = (double *) malloc (e*n * sizeof (double)) ;
+            x2 = (double *) malloc (e*n * sizeof (double)) ;
+            if (sz) x1z = (double *) malloc (n * sizeof (double)) ;
+            if (sz) x2z = (double *) malloc (n * sizeof (double)) ;
+            if (!x1 || !x2 || (sz && (!x1z || !x2z)))
+            {
+                error ("out of memory: view\n", 0.) ;
+            }
+            status1 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az),
+                CARG(x1,x1z), CARG(b,bz), Numeric, Control, Info) ;
+            status2 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az),
+                CARG(x2,x2z), CARG(b,bz), Numeric_copy, Control, Info) ;
+            if (status1 != status2) error ("solve with view: status\n", 0.) ;
+            if (status1 >= 0 &&
+                (memcmp (x1, x2, e*n * sizeof (double)) != 0 ||
+                (sz && memcmp (x1z, x2z, n * sizeof (double)) != 0)))
+            {
+                error ("solve with view: wrong solution\n", 0.) ;
+            }
+            free (x1) ;
+            free (x1z) ;
+            free (x2) ;
+            free (x2z) ;
+        }
+        UMFPACK_free_numeric (&Numeric_copy) ;
+        malloc_fail_on (save) ;
+    }
+
+    // serialize into a compressed blob, with each method
+    {
+        int64_t C_blobsize, C_size ;
+        int8_t *C_blob ;
+        int methods [5] = { UMFPACK_COMPRESSION_NONE,
+            UMFPACK_COMPRESSION_DEFAULT, UMFPACK_COMPRESSION_LZ4,
+            UMFPACK_COMPRESSION_LZ4HC + 4, UMFPACK_COMPRESSION_ZSTD + 3 } ;
+        for (i = 0 ; i < 5 ; i++)
+        {
+            status = UMFPACK_serialize_numeric_compressed_size (&C_blobsize,
+                Numeric, methods [i]) ;
+            if (status != UMFPACK_OK)
+            {
+                error ("UMFPACK_serialize_numeric_compressed_size failed", 0.) ;
+            }
+            C_blob = malloc (C_blobsize) ;
+            if (!C_blob)
+            {
+                error ("out of memory (compressed numeric blob)\n", 0.) ;
+            }
+            C_size = C_blobsize - 1 ;
+            status = UMFPACK_serialize_numeric_compressed (C_blob, &C_size,
+                Numeric, methods [i]) ;
+            if (status != UMFPACK_ERROR_invalid_blob)
+            {
+                error ("compressed numeric blob should be too small\n", 0.) ;
+            }
+            C_size = C_blobsize ;
+            status = UMFPACK_serialize_numeric_compressed (C_blob, &C_size,
+                Numeric, methods [i]) ;
+            if (status != UMFPACK_OK || C_size > C_blobsize)
+            {
+                error ("UMFPACK_serialize_numeric_compressed failed", 0.) ;
+            }
+            status = UMFPACK_deserialize_numeric (&Numeric_copy, C_blob,
+                C_size - 1) ;
+            if (status != UMFPACK_ERROR_invalid_blob)
+            {
+                error ("deserialize truncated numeric should have failed\n", 0.);
+            }
+            status = UMFPACK_deserialize_numeric_view (&Numeric_copy, C_blob,
+                C_size) ;
+            if (status != UMFPACK_ERROR_invalid_blob)
+            {
+                error ("compressed numeric view should have failed\n", 0.) ;
+            }
+            status = UMFPACK_deserialize_numeric (&Numeric_copy, C_blob,
+                C_size) ;
+            if (status != UMFPACK_OK)
+            {
+                error ("deserialize compressed numeric failed\n", 0.) ;
+            }
+            UMFPACK_free_numeric (&Numeric) ;
+            Numeric = Numeric_copy ;
+            Numeric_copy = NULL ;
+            free (C_blob) ;
+        }
+    }
+
     free (N_blob) ;
 
     /* ---------------------------------------------------------------------- */
@@ -2581,6 +2831,504 @@ static double do_symnum
 
     UMFPACK_report_info (Control, Info) ;
 
+    /* ---------------------------------------------------------------------- */
+    /* refactorize with the same values, and solve Ax=b again */
+    /* ---------------------------------------------------------------------- */
+
+    status = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), Numeric, Info) ;
+    if (prl >= 2) printf ("refactor status "ID"\n", status) ;
+    if (status == UMFPACK_OK || status == UMFPACK_WARNING_singular_matrix)
+    {
+	status = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x,xz), CARG(b,bz), Numeric, Control, Info) ;
+	if (status == UMFPACK_OK)
+	{
+	    double rnorm2 = resid (n, Ap, Ai, Ax, Az, x, xz, b, bz, r, rz, UMFPACK_A, noP, noQ, Wx) ;
+	    if (prl >= 2) printf ("rnorm Ax=b after refactor is %g\n", rnorm2) ;
+	    if (check_tol && rnorm2 > TOL)
+	    {
+		dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+		error ("refactor inaccurate %g\n", rnorm2) ;
+	    }
+	    rnorm = MAX (rnorm, rnorm2) ;
+	}
+    }
+    else if (status != UMFPACK_ERROR_different_pattern
+	&& status != UMFPACK_ERROR_invalid_system)
+    {
+	error ("refactor failed\n", 0.) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize independent blocks in parallel, and solve Ax=b again */
+    /* ---------------------------------------------------------------------- */
+
+    if (n_row == n_col)
+    {
+	double Control2 [UMFPACK_CONTROL] ;
+	void *Symbolic2 = NULL, *Numeric2 = NULL ;
+	UMFPACK_defaults (Control2) ;
+	if (Control != DNULL)
+	{
+	    for (i = 0 ; i < UMFPACK_CONTROL ; i++) Control2 [i] = Control [i] ;
+	}
+	Control2 [UMFPACK_NTHREADS] = 2 ;
+	status = UMFPACK_symbolic (n_row, n_col, Ap, Ai, CARG(Ax,Az),
+	    &Symbolic2, Control2, Info) ;
+	if (status == UMFPACK_OK)
+	{
+	    status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic2, &Numeric2,
+		Control2, Info) ;
+	}
+	if (prl >= 2) printf ("parallel numeric status "ID" blocks %g\n",
+	    status, Info [UMFPACK_NUMERIC_NBLOCKS]) ;
+	if (status == UMFPACK_OK)
+	{
+	    status = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x,xz), CARG(b,bz), Numeric2, Control, Info) ;
+	    if (status == UMFPACK_OK)
+	    {
+		double rnorm2 = resid (n, Ap, Ai, Ax, Az, x, xz, b, bz, r, rz, UMFPACK_A, noP, noQ, Wx) ;
+		if (prl >= 2) printf ("rnorm Ax=b with parallel numeric is %g\n", rnorm2) ;
+		if (check_tol && rnorm2 > TOL)
+		{
+		    dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+		    error ("parallel numeric inaccurate %g\n", rnorm2) ;
+		}
+		rnorm = MAX (rnorm, rnorm2) ;
+	    }
+	}
+	UMFPACK_free_numeric (&Numeric2) ;
+	UMFPACK_free_symbolic (&Symbolic2) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* solve AX=B for many right-hand sides at once, and compare with solve */
+    /* ---------------------------------------------------------------------- */
+
+    if (n_row == n_col && n > 0)
+    {
+	/* 3*UMF_MSOLVE_NB+3 columns give several blocks per thread, and the
+	 * leading dimensions of X and B differ from n and from each other */
+	Int k, e = 1, nrhs = 3*UMF_MSOLVE_NB + 3, ldx = n + 2, ldb = n + 3, s ;
+	double *X3, *X3z = DNULL, *B3, *B3z = DNULL, *xk, *xkz = DNULL, *bk,
+	    *bkz = DNULL, Control3 [UMFPACK_CONTROL], err = 0, xnorm = 0 ;
+	int Sys3 [3] = { UMFPACK_A, UMFPACK_At, UMFPACK_Aat }, save [6] ;
+#ifdef COMPLEX
+	if (!split) e = 2 ;
+#endif
+	malloc_fail_off (save) ;
+	UMFPACK_defaults (Control3) ;
+	if (Control != DNULL)
+	{
+	    for (i = 0 ; i < UMFPACK_CONTROL ; i++) Control3 [i] = Control [i] ;
+	}
+	Control3 [UMFPACK_NTHREADS] = 2 ;
+	X3 = (double *) malloc (e*ldx*nrhs * sizeof (double)) ;
+	B3 = (double *) malloc (e*ldb*nrhs * sizeof (double)) ;
+	xk = (double *) malloc (e*n * sizeof (double)) ;
+	bk = (double *) malloc (e*n * sizeof (double)) ;
+	if (split)
+	{
+	    X3z = (double *) malloc (ldx*nrhs * sizeof (double)) ;
+	    B3z = (double *) malloc (ldb*nrhs * sizeof (double)) ;
+	    xkz = (double *) malloc (n * sizeof (double)) ;
+	    bkz = (double *) malloc (n * sizeof (double)) ;
+	    if (!X3z || !B3z || !xkz || !bkz) error ("out of memory: msolve\n", 0.) ;
+	}
+	if (!X3 || !B3 || !xk || !bk) error ("out of memory: msolve\n", 0.) ;
+
+	/* each column of B is different; the padding of B is garbage */
+	for (k = 0 ; k < nrhs ; k++)
+	{
+	    for (i = 0 ; i < e*ldb ; i++)
+	    {
+		B3 [k*e*ldb + i] = (i < e*n) ?
+		    (b [i] + (double) ((i+3*k) % 7) - 3) : 1e300 ;
+	    }
+#ifdef COMPLEX
+	    if (split) for (i = 0 ; i < ldb ; i++)
+	    {
+		B3z [k*ldb + i] = (i < n) ? (bz [i] - (double) (k % 5)) : 1e300 ;
+	    }
+#endif
+	}
+
+	for (s = 0 ; s < 3 ; s++)
+	{
+	    Int status2 ;
+
+	    /* the padding of X must not be modified */
+	    for (i = 0 ; i < e*ldx*nrhs ; i++) X3 [i] = -1 ;
+	    if (split) for (i = 0 ; i < ldx*nrhs ; i++) X3z [i] = -1 ;
+	    status2 = UMFPACK_msolve (Sys3 [s], Ap, Ai, CARG(Ax,Az), nrhs,
+		CARG(X3,X3z), ldx, CARG(B3,B3z), ldb, Numeric, Control3, Info) ;
+	    if (prl >= 2) printf ("msolve sys %d status "ID"\n", Sys3 [s],
+		status2) ;
+
+	    /* compare each column with umfpack_*_solve */
+	    for (k = 0 ; k < nrhs ; k++)
+	    {
+		for (i = 0 ; i < e*n ; i++) bk [i] = B3 [k*e*ldb + i] ;
+#ifdef COMPLEX
+		if (split) for (i = 0 ; i < n ; i++) bkz [i] = B3z [k*ldb + i] ;
+#endif
+		status = UMFPACK_solve (Sys3 [s], Ap, Ai, CARG(Ax,Az),
+		    CARG(xk,xkz), CARG(bk,bkz), Numeric, Control3, Info) ;
+		if (status != status2) error ("msolve status\n", 0.) ;
+		if (status < 0) break ;
+		for (i = 0 ; i < e*ldx ; i++)
+		{
+		    if (i < e*n)
+		    {
+			err = MAX (err, SCALAR_ABS (X3 [k*e*ldx + i] - xk [i])) ;
+			xnorm = MAX (xnorm, SCALAR_ABS (xk [i])) ;
+		    }
+		    else if (X3 [k*e*ldx + i] != -1)
+		    {
+			error ("msolve modified the padding of X\n", 0.) ;
+		    }
+		}
+#ifdef COMPLEX
+		if (split) for (i = 0 ; i < ldx ; i++)
+		{
+		    if (i < n)
+		    {
+			err = MAX (err, SCALAR_ABS (X3z [k*ldx + i] - xkz [i])) ;
+			xnorm = MAX (xnorm, SCALAR_ABS (xkz [i])) ;
+		    }
+		    else if (X3z [k*ldx + i] != -1)
+		    {
+			error ("msolve modified the padding of X\n", 0.) ;
+		    }
+		}
+#endif
+	    }
+	}
+	if (xnorm > 0) err /= xnorm ;
+	if (prl >= 2) printf ("msolve difference %g\n", err) ;
+	if (check_tol && err > TOL) error ("msolve inaccurate %g\n", err) ;
+	free (X3) ;
+	free (B3) ;
+	free (X3z) ;
+	free (B3z) ;
+	free (xk) ;
+	free (bk) ;
+	free (xkz) ;
+	free (bkz) ;
+	malloc_fail_on (save) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize in single precision, and solve Ax=b with mixed precision */
+    /* ---------------------------------------------------------------------- */
+
+    if (n_row == n_col && n > 0)
+    {
+	Int k, s, e = 1, nz = Ap [n], status3 ;
+	float *Fx, *Fz = (float *) NULL, *Fb, *Fbz = (float *) NULL, *Fx3,
+	    *Fx3z = (float *) NULL ;
+	void *Symbolic3 = NULL, *Numeric3 = NULL ;
+	double Control3 [UMFPACK_CONTROL], rcond ;
+	int Sys3 [3] = { UMFPACK_A, UMFPACK_At, UMFPACK_Aat }, save [6] ;
+#ifdef COMPLEX
+	if (Az == DNULL) e = 2 ;
+#endif
+	malloc_fail_off (save) ;
+	rcond = ((NumericType *) Numeric)->rcond ;
+	UMFPACK_defaults (Control3) ;
+	if (Control != DNULL)
+	{
+	    for (i = 0 ; i < UMFPACK_CONTROL ; i++) Control3 [i] = Control [i] ;
+	}
+	Control3 [UMFPACK_IRSTEP] = 20 ;
+	Fx = (float *) malloc ((e*nz+1) * sizeof (float)) ;
+	Fb = (float *) malloc ((e*n+1) * sizeof (float)) ;
+	Fx3 = (float *) malloc ((e*n+1) * sizeof (float)) ;
+	if (!Fx || !Fb || !Fx3) error ("out of memory: single\n", 0.) ;
+	for (k = 0 ; k < e*nz ; k++) Fx [k] = (float) Ax [k] ;
+	for (i = 0 ; i < e*n ; i++) Fb [i] = (float) b [i] ;
+#ifdef COMPLEX
+	if (Az != DNULL)
+	{
+	    Fz = (float *) malloc ((nz+1) * sizeof (float)) ;
+	    Fbz = (float *) malloc ((n+1) * sizeof (float)) ;
+	    Fx3z = (float *) malloc ((n+1) * sizeof (float)) ;
+	    if (!Fz || !Fbz || !Fx3z) error ("out of memory: single\n", 0.) ;
+	    for (k = 0 ; k < nz ; k++) Fz [k] = (float) Az [k] ;
+	    for (i = 0 ; i < n ; i++) Fbz [i] = (float) bz [i] ;
+	}
+#endif
+	status = UMFPACK_SINGLE (symbolic) (n, n, Ap, Ai, CARG(Fx,Fz),
+	    &Symbolic3, Control3, Info) ;
+	if (status != UMFPACK_OK)
+	{
+	    error ("single precision symbolic failed\n", (double) status) ;
+	}
+	status3 = UMFPACK_SINGLE (numeric) (Ap, Ai, CARG(Fx,Fz), Symbolic3,
+	    &Numeric3, Control3, Info) ;
+	if (prl >= 2) printf ("single numeric status "ID"\n", status3) ;
+	if (status3 != UMFPACK_OK && status3 != UMFPACK_WARNING_singular_matrix)
+	{
+	    error ("single precision numeric failed\n", (double) status3) ;
+	}
+
+	/* the double precision Numeric object cannot be used */
+	if (UMFPACK_SINGLE (solve_mixed) (UMFPACK_A, Ap, Ai, CARG(Ax,Az),
+	    CARG(x,xz), CARG(b,bz), Numeric, Control3, Info)
+	    != UMFPACK_ERROR_invalid_Numeric_object)
+	{
+	    error ("solve_mixed with double Numeric\n", 0.) ;
+	}
+	if (UMFPACK_SINGLE (solve_mixed) (UMFPACK_L, Ap, Ai, CARG(Ax,Az),
+	    CARG(x,xz), CARG(b,bz), Numeric3, Control3, Info)
+	    != UMFPACK_ERROR_invalid_system)
+	{
+	    error ("solve_mixed with sys = UMFPACK_L\n", 0.) ;
+	}
+
+	for (s = 0 ; s < 3 ; s++)
+	{
+	    double rnorm2, err = 0, xnorm = 0 ;
+
+	    /* solve with mixed precision and iterative refinement */
+	    status = UMFPACK_SINGLE (solve_mixed) (Sys3 [s], Ap, Ai,
+		CARG(Ax,Az), CARG(x,xz), CARG(b,bz), Numeric3, Control3, Info) ;
+	    if (prl >= 2) printf ("solve_mixed sys %d status "ID" steps %g\n",
+		Sys3 [s], status, Info [UMFPACK_IR_TAKEN]) ;
+	    if (status != status3) error ("solve_mixed status\n", 0.) ;
+	    if (status != UMFPACK_OK) continue ;
+	    rnorm2 = resid (n, Ap, Ai, Ax, Az, x, xz, b, bz, r, rz, Sys3 [s],
+		noP, noQ, Wx) ;
+	    if (prl >= 2) printf ("rnorm with mixed precision is %g\n", rnorm2) ;
+	    /* refinement converges only if A is well-conditioned */
+	    if (check_tol && rcond > 1e-3 && rnorm2 > TOL)
+	    {
+		dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+		error ("mixed precision solve inaccurate %g\n", rnorm2) ;
+	    }
+
+	    /* solve entirely in single precision, and compare */
+	    status = UMFPACK_SINGLE (solve) (Sys3 [s], Ap, Ai, CARG(Fx,Fz),
+		CARG(Fx3,Fx3z), CARG(Fb,Fbz), Numeric3, Control3, Info) ;
+	    if (status != UMFPACK_OK)
+	    {
+		error ("single precision solve failed\n", (double) status) ;
+	    }
+	    for (i = 0 ; i < e*n ; i++)
+	    {
+		err = MAX (err, SCALAR_ABS (Fx3 [i] - x [i])) ;
+		xnorm = MAX (xnorm, SCALAR_ABS (x [i])) ;
+	    }
+#ifdef COMPLEX
+	    if (Az != DNULL) for (i = 0 ; i < n ; i++)
+	    {
+		err = MAX (err, SCALAR_ABS (Fx3z [i] - xz [i])) ;
+		xnorm = MAX (xnorm, SCALAR_ABS (xz [i])) ;
+	    }
+#endif
+	    if (xnorm > 0) err /= xnorm ;
+	    if (prl >= 2) printf ("single precision solve difference %g\n", err) ;
+	    if (check_tol && rcond > 1e-3 && err > 1e-2)
+	    {
+		dump_mat ("A", n, n, Ap, Ai, CARG(Ax,Az)) ;
+		error ("single precision solve inaccurate %g\n", err) ;
+	    }
+	}
+	UMFPACK_SINGLE (free_numeric) (&Numeric3) ;
+	UMFPACK_SINGLE (free_symbolic) (&Symbolic3) ;
+	free (Fx) ;
+	free (Fz) ;
+	free (Fb) ;
+	free (Fbz) ;
+	free (Fx3) ;
+	free (Fx3z) ;
+	malloc_fail_on (save) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* factorize with a memory limit */
+    /* ---------------------------------------------------------------------- */
+
+    if (n_row == n_col && n > 0)
+    {
+	void *Symbolic4 = NULL, *Numeric4 = NULL ;
+	double Control4 [UMFPACK_CONTROL], Info4 [UMFPACK_INFO], limit ;
+	Int k ;
+	int save [6] ;
+	malloc_fail_off (save) ;
+	UMFPACK_defaults (Control4) ;
+	if (Control != DNULL)
+	{
+	    for (i = 0 ; i < UMFPACK_CONTROL ; i++) Control4 [i] = Control [i] ;
+	}
+	status = UMFPACK_symbolic (n_row, n_col, Ap, Ai, CARG(Ax,Az),
+	    &Symbolic4, Control4, Info4) ;
+	if (status != UMFPACK_OK) error ("memory limit: symbolic\n", 0.) ;
+
+	/* a limit too small to start the factorization fails at once */
+	Control4 [UMFPACK_MEMORY_LIMIT] = 1 ;
+	status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic4, &Numeric4,
+	    Control4, Info4) ;
+	if (status != UMFPACK_ERROR_memory_limit || Numeric4 != NULL)
+	{
+	    error ("memory limit too small\n", 0.) ;
+	}
+	UMFPACK_report_status (Control4, status) ;
+
+	/* limits from the bare minimum up to more than enough */
+	Control4 [UMFPACK_MEMORY_LIMIT] = 0 ;
+	status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic4, &Numeric4,
+	    Control4, Info4) ;
+	if (status < 0) error ("memory limit: numeric\n", 0.) ;
+	UMFPACK_free_numeric (&Numeric4) ;
+	limit = Info4 [UMFPACK_PEAK_MEMORY] * Info4 [UMFPACK_SIZE_OF_UNIT] ;
+	for (k = 0 ; status >= 0 && k < 4 ; k++)
+	{
+	    Control4 [UMFPACK_MEMORY_LIMIT] = limit * (0.25 + 0.5 * k) ;
+	    status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic4, &Numeric4,
+		Control4, Info4) ;
+	    if (prl >= 2) printf ("memory limit %g status "ID" realloc %g\n",
+		Control4 [UMFPACK_MEMORY_LIMIT], status,
+		Info4 [UMFPACK_NUMERIC_REALLOC]) ;
+	    if (status == UMFPACK_ERROR_memory_limit)
+	    {
+		/* only the smaller limits may fail */
+		if (k == 3) error ("memory limit too large\n", 0.) ;
+		status = UMFPACK_OK ;
+	    }
+	    else if (status >= 0)
+	    {
+		if (Info4 [UMFPACK_VARIABLE_PEAK] * Info4 [UMFPACK_SIZE_OF_UNIT]
+		    > Control4 [UMFPACK_MEMORY_LIMIT])
+		{
+		    error ("memory limit exceeded\n", 0.) ;
+		}
+	    }
+	    UMFPACK_free_numeric (&Numeric4) ;
+	}
+	UMFPACK_free_symbolic (&Symbolic4) ;
+	malloc_fail_on (save) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* incomplete LU factorization */
+    /* ---------------------------------------------------------------------- */
+
+    if (n_row == n_col && n > 0)
+    {
+	void *Symbolic5 = NULL, *Numeric5 = NULL ;
+	double Control5 [UMFPACK_CONTROL], Info5 [UMFPACK_INFO], lunz, lunz2,
+	    *x5, *x5z = DNULL ;
+	double Droptol [5] = { 1e-12, 1e-6, 1e-2, 1, 1e30 } ;
+	Int k, e = 1, sz = FALSE, status5 ;
+	int save [6] ;
+#ifdef COMPLEX
+	if (!split) e = 2 ;
+	sz = split ;
+#endif
+	malloc_fail_off (save) ;
+	UMFPACK_defaults (Control5) ;
+	if (Control != DNULL)
+	{
+	    for (i = 0 ; i < UMFPACK_CONTROL ; i++) Control5 [i] = Control [i] ;
+	}
+	Control5 [UMFPACK_IRSTEP] = 0 ;
+	x5 = (double *) malloc ((e*n+1) * sizeof (double)) ;
+	if (sz) x5z = (double *) malloc ((n+1) * sizeof (double)) ;
+	if (!x5 || (sz && !x5z)) error ("out of memory: ILU\n", 0.) ;
+	status = UMFPACK_symbolic (n_row, n_col, Ap, Ai, CARG(Ax,Az),
+	    &Symbolic5, Control5, Info5) ;
+	if (status != UMFPACK_OK) error ("incomplete LU: symbolic\n", 0.) ;
+
+	/* the complete factorization, for comparison */
+	status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic5, &Numeric5,
+	    Control5, Info5) ;
+	if (status < 0) error ("incomplete LU: complete LU failed\n", 0.) ;
+	lunz = Info5 [UMFPACK_LNZ] + Info5 [UMFPACK_UNZ] ;
+	status5 = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x,xz),
+	    CARG(b,bz), Numeric5, Control5, Info5) ;
+	UMFPACK_free_numeric (&Numeric5) ;
+
+	/* a zero drop tolerance with no fill limit drops only the entries
+	 * that are exactly zero, so the factors and the solution are the same
+	 * as those of the complete factorization */
+	Control5 [UMFPACK_ILU_DROPTOL] = 0 ;
+	Control5 [UMFPACK_ILU_FILL] = n ;
+	status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic5, &Numeric5,
+	    Control5, Info5) ;
+	if (prl >= 2) printf ("ILU 0: status "ID" lnz+unz %g (%g)\n", status,
+	    Info5 [UMFPACK_LNZ] + Info5 [UMFPACK_UNZ], lunz) ;
+	if (status < 0) error ("ILU with zero droptol failed\n", 0.) ;
+	if (Info5 [UMFPACK_LNZ] + Info5 [UMFPACK_UNZ] > lunz)
+	{
+	    error ("ILU with zero droptol too large\n", 0.) ;
+	}
+	status = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x5,x5z),
+	    CARG(b,bz), Numeric5, Control5, Info5) ;
+	if (status != status5) error ("ILU with zero droptol: status\n", 0.) ;
+	if (status >= 0 && (memcmp (x5, x, e*n * sizeof (double)) != 0 ||
+	    (sz && memcmp (x5z, xz, n * sizeof (double)) != 0)))
+	{
+	    error ("ILU with zero droptol: wrong factors\n", 0.) ;
+	}
+	UMFPACK_free_numeric (&Numeric5) ;
+
+	/* larger drop tolerances give sparser factors, starting with the
+	 * complete factors.  Dropping entries can change the later pivot
+	 * choices, so the factors may grow slightly compared with those from
+	 * the next smaller drop tolerance. */
+	Control5 [UMFPACK_ILU_FILL] = 0 ;
+	for (k = 0 ; k < 5 ; k++)
+	{
+	    Control5 [UMFPACK_ILU_DROPTOL] = Droptol [k] ;
+	    if (prl >= 2) UMFPACK_report_control (Control5) ;
+	    status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic5, &Numeric5,
+		Control5, Info5) ;
+	    lunz2 = Info5 [UMFPACK_LNZ] + Info5 [UMFPACK_UNZ] ;
+	    if (prl >= 2) printf ("ILU %g: status "ID" lnz+unz %g (%g)\n",
+		Droptol [k], status, lunz2, lunz) ;
+	    if (status < 0) error ("incomplete LU failed\n", 0.) ;
+	    if (lunz2 > 1.1 * lunz + n)
+	    {
+		error ("incomplete LU not sparser\n", lunz2) ;
+	    }
+	    lunz = lunz2 ;
+	    if (status == UMFPACK_OK)
+	    {
+		/* apply the preconditioner */
+		status = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az),
+		    CARG(x5,x5z), CARG(b,bz), Numeric5, Control5, Info5) ;
+		if (status < 0) error ("incomplete LU solve failed\n", 0.) ;
+	    }
+	    UMFPACK_free_numeric (&Numeric5) ;
+	}
+
+	/* a fill limit as well */
+	Control5 [UMFPACK_ILU_DROPTOL] = 1e-2 ;
+	Control5 [UMFPACK_ILU_FILL] = 2 ;
+	status = UMFPACK_numeric (Ap, Ai, CARG(Ax,Az), Symbolic5, &Numeric5,
+	    Control5, Info5) ;
+	if (prl >= 2) printf ("ILU with fill limit: status "ID" lnz+unz %g\n",
+	    status, Info5 [UMFPACK_LNZ] + Info5 [UMFPACK_UNZ]) ;
+	if (status < 0) error ("incomplete LU with fill limit failed\n", 0.) ;
+
+	/* an incomplete factorization cannot be refactorized, and is left
+	 * unchanged */
+	status = UMFPACK_refactor (Ap, Ai, CARG(Ax,Az), Numeric5, Info5) ;
+	if (status != UMFPACK_ERROR_invalid_Numeric_object)
+	{
+	    error ("refactor of incomplete LU not rejected\n", 0.) ;
+	}
+	status = UMFPACK_solve (UMFPACK_A, Ap, Ai, CARG(Ax,Az), CARG(x5,x5z),
+	    CARG(b,bz), Numeric5, Control5, Info5) ;
+	if (status < 0) error ("incomplete LU solve after refactor\n", 0.) ;
+	UMFPACK_free_numeric (&Numeric5) ;
+
+	UMFPACK_free_symbolic (&Symbolic5) ;
+	free (x5) ;
+	free (x5z) ;
+	malloc_fail_on (save) ;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* free everything */
     /* ---------------------------------------------------------------------- */
@@ -6604,8 +7352,8 @@ int main (int argc, char **argv)
             s = UMFPACK_deserialize_numeric (&Numeric_copy, N_blob, 1) ;
             if (Numeric_copy != NULL || s != UMFPACK_ERROR_invalid_blob) error ("103m",0.) ;
 
-            // mangle the N_blob
-            int64_t N_header = sizeof (int64_t) + 10 * sizeof (int32_t) ;
+            // mangle the N_blob, after its header of UMF_BLOB_HEADER bytes
+            int64_t N_header = UMF_BLOB_HEADER ;
             memset (N_blob + N_header, 0, N_blobsize - N_header) ;
 
             s = UMFPACK_deserialize_numeric (&Numeric_copy, N_blob, N_blobsize) ;